@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Generate pre-rotated glyph atlases for the fonts used by Display102.
+
+Each glyph is stored as its columns, left to right. A column is one frame
+buffer row of the portrait panel (physY = 639 - x), padded to whole bytes with
+the top pixel in the MSB, so Display102 can OR it into the frame buffer a byte
+at a time instead of plotting single pixels.
+
+Runs as a PlatformIO pre-build script (regenerates when a font is newer than
+the output) or standalone: python3 fontAtlas_script.py
+"""
+import os
+import re
+
+SCRIPT_NAME = "fontAtlas_script.py"
+
+
+def configure(root):
+    global ROOT, UI_DIR, DRIVER, OUTPUT_FILE
+    ROOT = root
+    UI_DIR = os.path.join(root, "src", "weather", "UI")
+    DRIVER = os.path.join(UI_DIR, "Display102", "Display102.cpp")
+    OUTPUT_FILE = os.path.join(UI_DIR, "FontAtlases102.h")
+
+
+def font_headers():
+    """Font subsets included by the driver whose font it actually returns, in include order."""
+    with open(DRIVER) as f:
+        driver = f.read()
+    used = set(re.findall(r"return &(\w+);", driver))
+    headers = []
+    for name in re.findall(r'#include "\.\./Fonts102/(InterTight\w+\.h)"', driver):
+        path = os.path.join(UI_DIR, "Fonts102", name)
+        with open(path) as f:
+            font_name = re.search(r"const GFXfont (\w+) PROGMEM", f.read()).group(1)
+        if font_name in used:
+            headers.append(path)
+    return headers
+
+
+def parse_font(path):
+    with open(path) as f:
+        source = f.read()
+
+    bitmap_match = re.search(r"const uint8_t (\w+)\[\] PROGMEM = \{(.*?)\};", source, re.S)
+    bitmap = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_match.group(2))]
+
+    glyph_match = re.search(r"const GFXglyph \w+\[\] PROGMEM = \{(.*?)\};", source, re.S)
+    glyphs = [tuple(int(v) for v in g)
+              for g in re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}",
+                                  glyph_match.group(1))]
+
+    font_match = re.search(r"const GFXfont (\w+) PROGMEM = \{.*?,.*?,\s*(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),\s*(\d+)\s*\}",
+                           source, re.S)
+    return {
+        "name": font_match.group(1),
+        "first": int(font_match.group(2), 0),
+        "last": int(font_match.group(3), 0),
+        "bitmap": bitmap,
+        "glyphs": glyphs,
+    }
+
+
+def rotate_glyph(bitmap, offset, width, height):
+    """Row-major packed GFX glyph -> byte-aligned columns, top pixel in the MSB."""
+    column_bytes = (height + 7) // 8
+    columns = []
+    for col in range(width):
+        line = [0] * column_bytes
+        for row in range(height):
+            bit = row * width + col
+            if bitmap[offset + bit // 8] & (0x80 >> (bit % 8)):
+                line[row // 8] |= 0x80 >> (row % 8)
+        columns.extend(line)
+    return columns
+
+
+def format_c_array(c_type, name, values, per_line, fmt):
+    lines = [f"static const {c_type} {name}[] PROGMEM = {{"]
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate():
+    output = [
+        "#pragma once",
+        "",
+        "// Pre-rotated glyph atlases for Display102 - generated by fontAtlas_script.py, do not edit.",
+        "// Glyph columns left to right, ceil(height / 8) bytes each, top pixel in the MSB.",
+        "",
+    ]
+    entries = []
+    total = 0
+    for path in font_headers():
+        font = parse_font(path)
+        data = []
+        offsets = []
+        for offset, width, height, _, _, _ in font["glyphs"]:
+            offsets.append(len(data))
+            data.extend(rotate_glyph(font["bitmap"], offset, width, height))
+        name = font["name"]
+        output.append(f"// {os.path.basename(path)}")
+        output.append(format_c_array("uint8_t", f"{name}_Atlas", data, 16, lambda v: f"0x{v:02X}"))
+        output.append(format_c_array("uint32_t", f"{name}_AtlasOffsets", offsets, 12, str))
+        output.append("")
+        entries.append(f"    {{ &{name}, {name}_Atlas, {name}_AtlasOffsets }},")
+        total += len(data) + 4 * len(offsets)
+
+    output.append("static const FontAtlas_t FONT_ATLASES[] = {")
+    output.extend(entries)
+    output.append("};")
+    output.append("")
+    output.append(f"// Approx. {total} bytes")
+    output.append("")
+    with open(OUTPUT_FILE, "w") as f:
+        f.write("\n".join(output))
+    print(f"Generated {os.path.relpath(OUTPUT_FILE, ROOT)} ({total} bytes)")
+
+
+def is_stale():
+    if not os.path.exists(OUTPUT_FILE):
+        return True
+    generated = os.path.getmtime(OUTPUT_FILE)
+    sources = font_headers() + [os.path.join(ROOT, SCRIPT_NAME)]
+    return any(os.path.getmtime(path) > generated for path in sources)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    IN_PLATFORMIO = True
+except NameError:
+    IN_PLATFORMIO = False
+
+if IN_PLATFORMIO:
+    configure(env.subst("$PROJECT_DIR"))  # noqa: F821
+    if is_stale():
+        generate()
+elif __name__ == "__main__":
+    configure(os.path.dirname(os.path.abspath(__file__)))
+    generate()
@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+"""Subset the InterTight fonts used by Display102 to the glyphs it can draw.
+
+A font that can draw text only known at runtime (location name, SSID, IP
+address) keeps its whole code page: printable ASCII and the Latin-2 upper half.
+Font roles listed in ROLE_CHARACTERS draw nothing but formatted numbers and
+fixed strings, so a font serving only those roles keeps just their characters
+and the literals drawn with them.
+
+Subsets are written to src/weather/UI/Fonts102/ under the original file and
+symbol names. The glyph table keeps its full first..last range, so a dropped
+glyph still advances the cursor; only its bitmap is left out.
+
+Runs as a PlatformIO pre-build script (before fontAtlas_script.py, which
+rotates the subsets) or standalone: python3 fontSubset_script.py
+"""
+import os
+import re
+
+SCRIPT_NAME = "fontSubset_script.py"
+
+# Characters of runtime text drawn in every font without a role restriction -
+# the whole code page of the 8b fonts (gfxlatin2: ISO 8859-2 0xA0-0xFF is
+# stored from glyph 0x80 on)
+RUNTIME_CHARACTERS = ("".join(chr(c) for c in range(0x20, 0x7F))
+                      + bytes(range(0xA0, 0x100)).decode("iso8859_2"))
+
+# Roles that only ever draw these characters (plus their own literals)
+ROLE_CHARACTERS = {
+    "HUGE": "0123456789-°",  # Hero temperature, String(int) + "°"
+}
+
+# Sources whose string literals can reach the display
+TEXT_SOURCES = [
+    os.path.join("src", "weather", "Localization", "Localization.hpp"),
+    os.path.join("src", "weather", "UI", "Screen.cpp"),
+    os.path.join("src", "weather_station.cpp"),
+]
+
+
+def configure(root):
+    global ROOT, UI_DIR, DRIVER, OUTPUT_DIR
+    ROOT = root
+    UI_DIR = os.path.join(root, "src", "weather", "UI")
+    DRIVER = os.path.join(UI_DIR, "Display102", "Display102.cpp")
+    OUTPUT_DIR = os.path.join(UI_DIR, "Fonts102")
+
+
+def read(path):
+    with open(path, encoding="utf-8") as f:
+        return f.read()
+
+
+def font_files():
+    """Font headers the driver includes from Fonts102/, in include order."""
+    return re.findall(r'#include "\.\./Fonts102/(InterTight\w+\.h)"', read(DRIVER))
+
+
+def font_roles():
+    """Font symbol -> set of Font roles it is returned for (getFont and getScaledFont),
+    including the roles of case labels falling through to the return."""
+    roles = {}
+    for labels, font in re.findall(r"((?:case \w+:\s*)+)return &(\w+);", read(DRIVER)):
+        roles.setdefault(font, set()).update(re.findall(r"case (\w+):", labels))
+    return roles
+
+
+C_ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "0": "\0", "\\": "\\", '"': '"', "'": "'"}
+
+
+def unescape(literal):
+    def replace(match):
+        escape = match.group(1)
+        if escape[0] == "x":
+            return chr(int(escape[1:], 16))
+        return C_ESCAPES.get(escape, escape)
+    return re.sub(r"\\(x[0-9A-Fa-f]{1,2}|.)", replace, literal)
+
+
+def string_literals(source):
+    for line in source.splitlines():
+        if line.lstrip().startswith("#include"):
+            continue
+        for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', line):
+            yield unescape(literal)
+
+
+def referenced_roles(roles):
+    """Font roles named anywhere in the text sources - only these ever draw."""
+    sources = "\n".join(read(os.path.join(ROOT, path)) for path in TEXT_SOURCES)
+    named = set()
+    for font_roles_of in roles.values():
+        named.update(role for role in font_roles_of if re.search(r"\b%s\b" % role, sources))
+    return named
+
+
+def role_literals(source, role):
+    """Literals passed straight to drawText()/drawTextScaled() with the given role."""
+    pattern = r"drawText(?:Scaled)?\(\s*%s\s*,\s*\"((?:[^\"\\]|\\.)*)\"" % role
+    return [unescape(s) for s in re.findall(pattern, source)]
+
+
+def parse_font(source):
+    bitmap_match = re.search(r"const uint8_t (\w+)\[\] PROGMEM = \{(.*?)\};", source, re.S)
+    bitmap = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_match.group(2))]
+
+    # Per line, as the comment of the last glyph follows the closing "};"
+    glyph_match = re.search(r"const GFXglyph (\w+)\[\] PROGMEM = \{(.*?)const GFXfont", source, re.S)
+    glyphs = []
+    for line in glyph_match.group(2).splitlines():
+        match = re.search(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}.*?//\s*(.*?U\+([0-9A-Fa-f]+))",
+                          line)
+        if match:
+            values = tuple(int(v) for v in match.groups()[:6])
+            glyphs.append((values, match.group(7), int(match.group(8), 16)))
+
+    font_match = re.search(r"const GFXfont (\w+) PROGMEM = \{.*?,.*?,\s*(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),\s*(\d+)\s*\}",
+                           source, re.S)
+    return {
+        "name": font_match.group(1),
+        "bitmap_name": bitmap_match.group(1),
+        "glyphs_name": glyph_match.group(1),
+        "first": font_match.group(2),
+        "last": font_match.group(3),
+        "y_advance": font_match.group(4),
+        "bitmap": bitmap,
+        "glyphs": glyphs,
+    }
+
+
+def character_sets():
+    """Unrestricted character set, and the set of each role in ROLE_CHARACTERS."""
+    sources = [read(os.path.join(ROOT, path)) for path in TEXT_SOURCES]
+    literal_chars = set(RUNTIME_CHARACTERS)
+    for source in sources:
+        for literal in string_literals(source):
+            literal_chars.update(literal)
+
+    restricted = {}
+    for role, chars in ROLE_CHARACTERS.items():
+        needed = set(chars)
+        for source in sources:
+            for literal in role_literals(source, role):
+                needed.update(literal)
+        restricted[role] = needed
+    return literal_chars, restricted
+
+
+def glyph_bytes(width, height):
+    return (width * height + 7) // 8
+
+
+def subset_font(font, keep):
+    bitmap = []
+    glyph_lines = []
+    kept = 0
+    for index, (values, comment, codepoint) in enumerate(font["glyphs"]):
+        offset, width, height, x_advance, x_offset, y_offset = values
+        if chr(codepoint) in keep and width > 0 and height > 0:
+            new_offset = len(bitmap)
+            bitmap.extend(font["bitmap"][offset:offset + glyph_bytes(width, height)])
+            kept += 1
+        else:
+            new_offset, width, height = 0, 0, 0
+        glyph_lines.append("  { %5d, %3d, %3d, %3d, %4d, %4d }" % (new_offset, width, height, x_advance, x_offset, y_offset)
+                           + ("," if index < len(font["glyphs"]) - 1 else " };") + "   // " + comment)
+    if not bitmap:
+        bitmap = [0x00]  # Keep the array non-empty
+    return bitmap, glyph_lines, kept
+
+
+def format_font(source_name, font, bitmap, glyph_lines, kept):
+    lines = [
+        f"// Subset of ../{source_name} - generated by {SCRIPT_NAME}, do not edit.",
+        f"// {kept} of {len(font['glyphs'])} glyphs keep their bitmap, the rest only advance the cursor.",
+        "",
+        f"const uint8_t {font['bitmap_name']}[] PROGMEM = {{",
+    ]
+    for i in range(0, len(bitmap), 12):
+        lines.append("  " + ", ".join(f"0x{v:02X}" for v in bitmap[i:i + 12]) + ("," if i + 12 < len(bitmap) else " };"))
+    lines.append("")
+    lines.append(f"const GFXglyph {font['glyphs_name']}[] PROGMEM = {{")
+    lines.extend(glyph_lines)
+    lines.append("")
+    lines.append(f"const GFXfont {font['name']} PROGMEM = {{")
+    lines.append(f"  (uint8_t  *){font['bitmap_name']},")
+    lines.append(f"  (GFXglyph *){font['glyphs_name']},")
+    lines.append(f"  {font['first']}, {font['last']}, {font['y_advance']} }};")
+    lines.append("")
+    size = len(bitmap) + 7 * len(glyph_lines) + 7
+    lines.append(f"// Approx. {size} bytes")
+    lines.append("")
+    return "\n".join(lines), size
+
+
+def generate():
+    os.makedirs(OUTPUT_DIR, exist_ok=True)
+    roles = font_roles()
+    drawn = referenced_roles(roles)
+    unrestricted, restricted = character_sets()
+    total_before = 0
+    total_after = 0
+    for name in font_files():
+        font = parse_font(read(os.path.join(UI_DIR, name)))
+        # A role never named in the sources (EXTRA_LARGE) draws nothing; a font
+        # with no drawing role at all is kept whole to stay on the safe side
+        font_roles_used = roles.get(font["name"], set()) & drawn
+        if font_roles_used and font_roles_used <= set(restricted):
+            keep = set().union(*(restricted[role] for role in font_roles_used))
+        else:
+            keep = unrestricted
+        bitmap, glyph_lines, kept = subset_font(font, keep)
+        text, size = format_font(name, font, bitmap, glyph_lines, kept)
+        with open(os.path.join(OUTPUT_DIR, name), "w", encoding="utf-8") as f:
+            f.write(text)
+        total_before += len(font["bitmap"]) + 7 * len(font["glyphs"]) + 7
+        total_after += size
+        print(f"{name}: {kept}/{len(font['glyphs'])} glyphs, {size} bytes")
+    print(f"Generated {os.path.relpath(OUTPUT_DIR, ROOT)} ({total_before} -> {total_after} bytes)")
+
+
+def is_stale():
+    outputs = [os.path.join(OUTPUT_DIR, name) for name in font_files()]
+    if not all(os.path.exists(path) for path in outputs):
+        return True
+    generated = min(os.path.getmtime(path) for path in outputs)
+    sources = [os.path.join(UI_DIR, name) for name in font_files()]
+    sources += [os.path.join(ROOT, path) for path in TEXT_SOURCES]
+    sources += [DRIVER, os.path.join(ROOT, SCRIPT_NAME)]
+    return any(os.path.getmtime(path) > generated for path in sources)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    IN_PLATFORMIO = True
+except NameError:
+    IN_PLATFORMIO = False
+
+if IN_PLATFORMIO:
+    configure(env.subst("$PROJECT_DIR"))  # noqa: F821
+    if is_stale():
+        generate()
+elif __name__ == "__main__":
+    configure(os.path.dirname(os.path.abspath(__file__)))
+    generate()
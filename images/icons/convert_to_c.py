@@ -1,133 +1,421 @@
 #!/usr/bin/env python3
-"""Convert PNG icons to C header file for e-paper display."""
-from PIL import Image
+"""Rasterize the weather icon SVGs at the sizes WeatherScreen draws them.
+
+Each icon is rendered at every WEATHER_ICON_SIZE_* in WeatherIconSizes.h, so the
+firmware blits it 1:1 instead of scaling a 64x64 bitmap at runtime. The output
+uses the glyph atlas layout (see fontAtlas_script.py): columns left to right,
+ceil(size / 8) bytes each, top pixel in the MSB.
+
+The SVGs only use paths, lines, circles and polygons with solid fills and round
+strokes, which are rendered here with Pillow at SUPERSAMPLE times the size. Any
+non-white paint is ink; white strokes cut the outlines between overlapping
+shapes. The drop shadow filter is ignored - at 5% opacity it would not survive
+the 1-bit threshold anyway.
+
+Runs as a PlatformIO pre-build script (regenerates when an SVG, WeatherIconSizes.h
+or this script is newer than the output) or standalone: python3 convert_to_c.py.
+Only regenerating needs Pillow; without it the build keeps the committed header.
+"""
+import math
 import os
+import re
+import xml.etree.ElementTree as ET
 
-ICON_SIZE = 64
-OUTPUT_FILE = "WeatherIconsData.h"
+SCRIPT_NAME = "convert_to_c.py"
+SUPERSAMPLE = 8
+BEZIER_STEPS = 16
+INK_COVERAGE = 128  # Out of 255 - pixels at least half covered by ink are set
 
-# Icon name to C variable name mapping
+# SVG name -> WeatherIcon_t value, in enum order
 ICONS = {
-    "clear-day_bw": "BITMAP_SUN",
-    "clear-night_bw": "BITMAP_MOON", 
-    "cloudy-1-day_bw": "BITMAP_PARTLY_CLOUDY",
-    "cloudy_bw": "BITMAP_CLOUD",
-    "rainy-1_bw": "BITMAP_DRIZZLE",
-    "rainy-2_bw": "BITMAP_RAIN",
-    "snowy-2_bw": "BITMAP_SNOW",
-    "thunderstorms_bw": "BITMAP_THUNDER",
-    "fog_bw": "BITMAP_FOG",
+    "clear-day": "WEATHER_ICON_SUN",
+    "clear-night": "WEATHER_ICON_MOON",
+    "cloudy-1-day": "WEATHER_ICON_PARTLY_CLOUDY",
+    "cloudy": "WEATHER_ICON_CLOUD",
+    "rainy-1": "WEATHER_ICON_DRIZZLE",
+    "rainy-2": "WEATHER_ICON_RAIN",
+    "snowy-2": "WEATHER_ICON_SNOW",
+    "thunderstorms": "WEATHER_ICON_THUNDER",
+    "fog": "WEATHER_ICON_FOG",
 }
 
-def convert_image_to_bytes(img_path, threshold=128):
-    """Convert image to 1-bit packed bytes (MSB first)."""
-    img = Image.open(img_path).convert('L')  # Grayscale
-    img = img.resize((ICON_SIZE, ICON_SIZE), Image.LANCZOS)
-    
-    pixels = list(img.getdata())
-    bytes_data = []
-    
-    for row in range(ICON_SIZE):
-        for col_byte in range(ICON_SIZE // 8):
-            byte_val = 0
-            for bit in range(8):
-                pixel_idx = row * ICON_SIZE + col_byte * 8 + bit
-                # White pixel (>threshold) = 1 (icon), Black pixel = 0 (background)
-                # Images are negated, so white = icon content
-                if pixels[pixel_idx] > threshold:
-                    byte_val |= (1 << (7 - bit))
-            bytes_data.append(byte_val)
-    
-    return bytes_data
-
-def format_c_array(name, data):
-    """Format bytes as C array."""
-    lines = [f"const uint8_t {name}[] PROGMEM = {{"]
-    
-    for i in range(0, len(data), 16):
-        chunk = data[i:i+16]
-        hex_str = ", ".join(f"0x{b:02X}" for b in chunk)
-        lines.append(f"    {hex_str},")
-    
+
+def configure(root):
+    global ROOT, ICON_DIR, SIZES_FILE, OUTPUT_FILE
+    ROOT = root
+    ICON_DIR = os.path.join(root, "images", "icons")
+    SIZES_FILE = os.path.join(root, "src", "weather", "UI", "WeatherIconSizes.h")
+    OUTPUT_FILE = os.path.join(root, "src", "weather", "UI", "WeatherIcons102.h")
+
+
+def icon_sizes():
+    """(define, size) of every distinct icon size, largest first."""
+    with open(SIZES_FILE, encoding="utf-8") as f:
+        defines = re.findall(r"#define (WEATHER_ICON_SIZE_\w+) (\d+)", f.read())
+    sizes = {}
+    for name, value in defines:
+        sizes.setdefault(int(value), name)
+    return [(name, size) for size, name in sorted(sizes.items(), reverse=True)]
+
+
+# ============================================================================
+# SVG geometry
+# ============================================================================
+
+IDENTITY = (1.0, 0.0, 0.0, 1.0, 0.0, 0.0)
+
+
+def multiply(m, n):
+    """m * n for affine (a, b, c, d, e, f): x' = a x + c y + e, y' = b x + d y + f."""
+    a, b, c, d, e, f = m
+    A, B, C, D, E, F = n
+    return (a * A + c * B, b * A + d * B, a * C + c * D, b * C + d * D, a * E + c * F + e, b * E + d * F + f)
+
+
+def apply(m, point):
+    x, y = point
+    return (m[0] * x + m[2] * y + m[4], m[1] * x + m[3] * y + m[5])
+
+
+def numbers(text):
+    return [float(v) for v in re.findall(r"-?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?", text)]
+
+
+def parse_transform(text):
+    m = IDENTITY
+    for name, args in re.findall(r"(\w+)\s*\(([^)]*)\)", text or ""):
+        v = numbers(args)
+        if name == "matrix":
+            t = tuple(v)
+        elif name == "translate":
+            t = (1, 0, 0, 1, v[0], v[1] if len(v) > 1 else 0)
+        elif name == "scale":
+            t = (v[0], 0, 0, v[1] if len(v) > 1 else v[0], 0, 0)
+        elif name == "rotate":
+            a = math.radians(v[0])
+            t = (math.cos(a), math.sin(a), -math.sin(a), math.cos(a), 0, 0)
+            if len(v) == 3:
+                t = multiply(multiply((1, 0, 0, 1, v[1], v[2]), t), (1, 0, 0, 1, -v[1], -v[2]))
+        else:
+            raise ValueError(f"Unsupported transform {name}")
+        m = multiply(m, t)
+    return m
+
+
+def cubic(p0, p1, p2, p3):
+    points = []
+    for i in range(1, BEZIER_STEPS + 1):
+        t = i / BEZIER_STEPS
+        u = 1 - t
+        points.append((u * u * u * p0[0] + 3 * u * u * t * p1[0] + 3 * u * t * t * p2[0] + t * t * t * p3[0],
+                       u * u * u * p0[1] + 3 * u * u * t * p1[1] + 3 * u * t * t * p2[1] + t * t * t * p3[1]))
+    return points
+
+
+def parse_path(d):
+    """Path data -> list of (points, closed) subpaths, curves flattened."""
+    tokens = re.findall(r"[MmLlHhVvCcSsZz]|-?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?", d)
+    subpaths = []
+    points = []
+    current = (0.0, 0.0)
+    control = None
+    command = None
+    i = 0
+
+    def take(n):
+        nonlocal i
+        values = [float(v) for v in tokens[i:i + n]]
+        i += n
+        return values
+
+    while i < len(tokens):
+        if tokens[i].isalpha():
+            command = tokens[i]
+            i += 1
+        relative = command.islower()
+        base = current if relative else (0.0, 0.0)
+        op = command.upper()
+        if op == "Z":
+            if points:
+                subpaths.append((points, True))
+                current = points[0]
+            points = []
+            continue
+        if op == "M":
+            x, y = take(2)
+            if points:
+                subpaths.append((points, False))
+            current = (base[0] + x, base[1] + y)
+            points = [current]
+            command = "l" if relative else "L"  # Further pairs are line-tos
+        elif op == "L":
+            x, y = take(2)
+            current = (base[0] + x, base[1] + y)
+            points.append(current)
+        elif op == "H":
+            (x,) = take(1)
+            current = (base[0] + x if relative else x, current[1])
+            points.append(current)
+        elif op == "V":
+            (y,) = take(1)
+            current = (current[0], base[1] + y if relative else y)
+            points.append(current)
+        elif op in "CS":
+            if op == "C":
+                x1, y1, x2, y2, x, y = take(6)
+                c1 = (base[0] + x1, base[1] + y1)
+            else:
+                x2, y2, x, y = take(4)
+                c1 = (2 * current[0] - control[0], 2 * current[1] - control[1]) if control else current
+            c2 = (base[0] + x2, base[1] + y2)
+            end = (base[0] + x, base[1] + y)
+            points.extend(cubic(current, c1, c2, end))
+            current = end
+            control = c2
+            continue
+        control = None
+    if points:
+        subpaths.append((points, False))
+    return subpaths
+
+
+def shape_subpaths(element):
+    tag = element.tag.split("}")[-1]
+    get = lambda name: float(element.get(name, 0))
+    if tag == "path":
+        return parse_path(element.get("d"))
+    if tag == "line":
+        return [([(get("x1"), get("y1")), (get("x2"), get("y2"))], False)]
+    if tag == "polygon":
+        v = numbers(element.get("points"))
+        return [(list(zip(v[0::2], v[1::2])), True)]
+    if tag == "circle":
+        cx, cy, r = get("cx"), get("cy"), get("r")
+        steps = 64
+        return [([(cx + r * math.cos(2 * math.pi * k / steps), cy + r * math.sin(2 * math.pi * k / steps))
+                  for k in range(steps)], True)]
+    return []
+
+
+STYLE_ATTRIBUTES = ("fill", "stroke", "stroke-width", "stroke-linecap", "stroke-dasharray")
+
+
+def collect_shapes(element, matrix=IDENTITY, style=None):
+    """Depth-first (painter's order) list of (subpaths in root units, style, scale)."""
+    style = dict(style or {"fill": "#000", "stroke": "none", "stroke-width": "1"})
+    for name in STYLE_ATTRIBUTES:
+        if element.get(name) is not None:
+            style[name] = element.get(name)
+    matrix = multiply(matrix, parse_transform(element.get("transform")))
+    tag = element.tag.split("}")[-1]
+    if tag in ("defs", "filter"):
+        return []
+    shapes = []
+    subpaths = shape_subpaths(element)
+    if subpaths:
+        scale = math.sqrt(abs(matrix[0] * matrix[3] - matrix[1] * matrix[2]))
+        transformed = [([apply(matrix, p) for p in points], closed) for points, closed in subpaths]
+        shapes.append((transformed, style, scale))
+    for child in element:
+        shapes.extend(collect_shapes(child, matrix, style))
+    return shapes
+
+
+def is_ink(paint):
+    """Anything painted that is not white."""
+    if paint in (None, "none"):
+        return None
+    return paint.lower() not in ("#fff", "#ffffff", "white")
+
+
+def dash(points, pattern):
+    """Split a polyline into its dashes; pattern in the same units as points."""
+    if not pattern or sum(pattern) <= 0:
+        return [points]
+    if len(pattern) % 2:
+        pattern = pattern * 2
+    dashes = []
+    index, left, on = 0, pattern[0], True
+    current = [points[0]]
+    for a, b in zip(points, points[1:]):
+        length = math.dist(a, b)
+        position = 0.0
+        while length - position > left:
+            position += left
+            t = position / length
+            split = (a[0] + (b[0] - a[0]) * t, a[1] + (b[1] - a[1]) * t)
+            if on:
+                current.append(split)
+                dashes.append(current)
+            current = [split]
+            index = (index + 1) % len(pattern)
+            left, on = pattern[index], not on
+        left -= length - position
+        current.append(b)
+    if on and len(current) > 1:
+        dashes.append(current)
+    return dashes
+
+
+def shape_bounds(shapes):
+    xs, ys = [], []
+    for subpaths, style, scale in shapes:
+        pad = float(style["stroke-width"]) * scale / 2 if is_ink(style["stroke"]) else 0
+        for points, _ in subpaths:
+            xs += [x - pad for x, _ in points] + [x + pad for x, _ in points]
+            ys += [y - pad for _, y in points] + [y + pad for _, y in points]
+    return min(xs), min(ys), max(xs), max(ys)
+
+
+# ============================================================================
+# Rasterization
+# ============================================================================
+
+def stroke(draw, points, closed, width, round_cap, value):
+    """Round-joined stroke as quads plus a disc at every joint."""
+    if closed:
+        points = points + [points[0]]
+    half = width / 2
+    for a, b in zip(points, points[1:]):
+        length = math.dist(a, b)
+        if length == 0:
+            continue
+        nx, ny = (a[1] - b[1]) / length * half, (b[0] - a[0]) / length * half
+        draw.polygon([(a[0] + nx, a[1] + ny), (b[0] + nx, b[1] + ny), (b[0] - nx, b[1] - ny), (a[0] - nx, a[1] - ny)],
+                     fill=value)
+    joints = points if round_cap or closed else points[1:-1]
+    for x, y in joints:
+        draw.ellipse([x - half, y - half, x + half, y + half], fill=value)
+
+
+def render(shapes, size, scale, bounds):
+    """Ink coverage (0..255) of the icon fitted and centred in a size x size square."""
+    canvas_size = size * SUPERSAMPLE
+    canvas = Image.new("L", (canvas_size, canvas_size), 0)
+    draw = ImageDraw.Draw(canvas)
+    ox = (canvas_size - (bounds[2] - bounds[0]) * scale * SUPERSAMPLE) / 2 - bounds[0] * scale * SUPERSAMPLE
+    oy = (canvas_size - (bounds[3] - bounds[1]) * scale * SUPERSAMPLE) / 2 - bounds[1] * scale * SUPERSAMPLE
+    to_canvas = lambda p: (p[0] * scale * SUPERSAMPLE + ox, p[1] * scale * SUPERSAMPLE + oy)
+
+    for subpaths, style, unit in shapes:
+        fill = is_ink(style["fill"])
+        if fill is not None:
+            for points, _ in subpaths:
+                if len(points) > 2:
+                    draw.polygon([to_canvas(p) for p in points], fill=255 if fill else 0)
+        line = is_ink(style["stroke"])
+        if line is not None:
+            factor = unit * scale * SUPERSAMPLE
+            width = float(style["stroke-width"]) * factor
+            pattern = [v * factor for v in numbers(style.get("stroke-dasharray", "none"))]
+            for points, closed in subpaths:
+                points = [to_canvas(p) for p in points]
+                for part in dash(points + ([points[0]] if closed and pattern else []), pattern):
+                    stroke(draw, part, closed and not pattern, width, style.get("stroke-linecap") == "round",
+                           255 if line else 0)
+    return canvas.resize((size, size), Image.BOX)
+
+
+def to_columns(coverage, size):
+    """Coverage image -> glyph atlas columns, top pixel in the MSB."""
+    pixels = coverage.load()
+    column_bytes = (size + 7) // 8
+    columns = []
+    for x in range(size):
+        line = [0] * column_bytes
+        for y in range(size):
+            if pixels[x, y] >= INK_COVERAGE:
+                line[y // 8] |= 0x80 >> (y % 8)
+        columns.extend(line)
+    return columns
+
+
+def format_c_array(name, values):
+    lines = [f"static const uint8_t {name}[] PROGMEM = {{"]
+    for i in range(0, len(values), 16):
+        lines.append("    " + ", ".join(f"0x{v:02X}" for v in values[i:i + 16]) + ",")
     lines.append("};")
     return "\n".join(lines)
 
-def main():
-    output = []
-    output.append("#pragma once")
-    output.append("")
-    output.append("#include <Arduino.h>")
+
+def generate():
+    global Image, ImageDraw
+    from PIL import Image, ImageDraw
+
+    named_sizes = icon_sizes()
+    sizes = [size for _, size in named_sizes]
+    icons = {}
+    for svg, name in ICONS.items():
+        shapes = collect_shapes(ET.parse(os.path.join(ICON_DIR, svg + ".svg")).getroot())
+        icons[name] = (svg, shapes, shape_bounds(shapes))
+
+    output = [
+        "#pragma once",
+        "",
+        f"// Weather icons for Display102 - generated by images/icons/{SCRIPT_NAME}, do not edit.",
+        "// Rasterized from images/icons/*.svg at the sizes WeatherScreen draws them, in the",
+        "// glyph atlas layout: columns left to right, ceil(size / 8) bytes each, top pixel in the MSB.",
+        "",
+        '#include "WeatherIconSizes.h"',
+        "",
+        "typedef enum {",
+    ]
+    output += [f"    {name}," for name in icons]
+    output += ["    WEATHER_ICON_COUNT", "} WeatherIcon_t;", ""]
+    output.append(f"#define WEATHER_ICON_SIZES {len(sizes)}")
+    output.append("static const int WEATHER_ICON_SIZE[WEATHER_ICON_SIZES] = { "
+                  + ", ".join(name for name, _ in named_sizes) + " };")
     output.append("")
-    output.append("// Weather icons for e-paper display")
-    output.append("// Icons are 64x64 pixels, 1-bit (black pixels = 1)")
-    output.append("// Generated from Makin-Things/weather-icons SVG set")
+
+    table = []
+    total = 0
+    for name, (svg, shapes, bounds) in icons.items():
+        output.append(f"// {svg}.svg")
+        entries = []
+        extent = max(bounds[2] - bounds[0], bounds[3] - bounds[1])
+        for size in sizes:
+            columns = to_columns(render(shapes, size, size / extent, bounds), size)
+            output.append(format_c_array(f"{name}_{size}", columns))
+            entries.append(f"{{ {size}, {size}, 1, BITMAP_COLUMNS, {name}_{size} }}")
+            total += len(columns)
+        output.append("")
+        table.append("    { " + ", ".join(entries) + " },")
+
+    output.append("static const Bitmap_t WEATHER_ICONS[WEATHER_ICON_COUNT][WEATHER_ICON_SIZES] = {")
+    output.extend(table)
+    output.append("};")
     output.append("")
-    output.append(f"#define WEATHER_ICON_SIZE {ICON_SIZE}")
-    output.append(f"#define WEATHER_ICON_BYTES ({ICON_SIZE} * {ICON_SIZE} / 8)")
+    output.append(f"// Approx. {total} bytes")
     output.append("")
-    
-    for png_name, c_name in ICONS.items():
-        png_path = f"{png_name}.png"
-        if os.path.exists(png_path):
-            print(f"Converting {png_path} -> {c_name}")
-            data = convert_image_to_bytes(png_path)
-            output.append(f"// {png_name}.svg -> {c_name}")
-            output.append(format_c_array(c_name, data))
-            output.append("")
-        else:
-            print(f"Warning: {png_path} not found")
-    
-    # Add getWeatherIcon function
-    output.append("// Weather code to icon mapping function")
-    output.append("inline const uint8_t* getWeatherIcon(int weatherCode, bool isDay = true) {")
-    output.append("    switch (weatherCode) {")
-    output.append("        case 0:  // Clear sky")
-    output.append("            return isDay ? BITMAP_SUN : BITMAP_MOON;")
-    output.append("        case 1:  // Mainly clear")
-    output.append("            return isDay ? BITMAP_SUN : BITMAP_MOON;")
-    output.append("        case 2:  // Partly cloudy")
-    output.append("            return BITMAP_PARTLY_CLOUDY;")
-    output.append("        case 3:  // Overcast")
-    output.append("            return BITMAP_CLOUD;")
-    output.append("        case 45: // Fog")
-    output.append("        case 48: // Depositing rime fog")
-    output.append("            return BITMAP_FOG;")
-    output.append("        case 51: // Light drizzle")
-    output.append("        case 53: // Moderate drizzle")
-    output.append("        case 55: // Dense drizzle")
-    output.append("        case 56: // Light freezing drizzle")
-    output.append("        case 57: // Dense freezing drizzle")
-    output.append("            return BITMAP_DRIZZLE;")
-    output.append("        case 61: // Slight rain")
-    output.append("        case 63: // Moderate rain")
-    output.append("        case 65: // Heavy rain")
-    output.append("        case 66: // Light freezing rain")
-    output.append("        case 67: // Heavy freezing rain")
-    output.append("        case 80: // Slight rain showers")
-    output.append("        case 81: // Moderate rain showers")
-    output.append("        case 82: // Violent rain showers")
-    output.append("            return BITMAP_RAIN;")
-    output.append("        case 71: // Slight snow")
-    output.append("        case 73: // Moderate snow")
-    output.append("        case 75: // Heavy snow")
-    output.append("        case 77: // Snow grains")
-    output.append("        case 85: // Slight snow showers")
-    output.append("        case 86: // Heavy snow showers")
-    output.append("            return BITMAP_SNOW;")
-    output.append("        case 95: // Thunderstorm")
-    output.append("        case 96: // Thunderstorm with slight hail")
-    output.append("        case 99: // Thunderstorm with heavy hail")
-    output.append("            return BITMAP_THUNDER;")
-    output.append("        default:")
-    output.append("            return BITMAP_CLOUD;")
-    output.append("    }")
-    output.append("}")
-    
-    # Write output
-    with open(OUTPUT_FILE, 'w') as f:
+    with open(OUTPUT_FILE, "w") as f:
         f.write("\n".join(output))
-    
-    print(f"Generated {OUTPUT_FILE}")
+    print(f"Generated {os.path.relpath(OUTPUT_FILE, ROOT)} (sizes {sizes}, {total} bytes)")
+
+
+def is_stale():
+    if not os.path.exists(OUTPUT_FILE):
+        return True
+    generated = os.path.getmtime(OUTPUT_FILE)
+    sources = [os.path.join(ICON_DIR, svg + ".svg") for svg in ICONS]
+    sources += [SIZES_FILE, os.path.join(ICON_DIR, SCRIPT_NAME)]
+    return any(os.path.getmtime(path) > generated for path in sources)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    IN_PLATFORMIO = True
+except NameError:
+    IN_PLATFORMIO = False
 
-if __name__ == "__main__":
-    main()
+if IN_PLATFORMIO:
+    configure(env.subst("$PROJECT_DIR"))  # noqa: F821
+    if is_stale():
+        try:
+            generate()
+        except ImportError as e:
+            if not os.path.exists(OUTPUT_FILE):
+                raise
+            print(f"Warning: {SCRIPT_NAME}: {e}; keeping the committed {os.path.relpath(OUTPUT_FILE, ROOT)}")
+elif __name__ == "__main__":
+    configure(os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__)))))
+    generate()
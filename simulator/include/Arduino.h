@@ -0,0 +1,182 @@
+#pragma once
+// Host shim of the subset of the Arduino-ESP32 core used by the display code.
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+#include <atomic>
+
+#ifndef ARDUINO
+#define ARDUINO 10819
+#endif
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define IRAM_ATTR
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define HEX 16
+#define DEC 10
+
+using std::min;
+using std::max;
+
+class __FlashStringHelper;
+
+extern std::atomic<uint32_t> simHeapAllocations;  // Modelled heap allocations, see String
+
+// String storage that bypasses the counting operator new (Arduino.cpp);
+// String counts its own allocations the way the ESP32 core makes them
+template <typename T>
+struct SimRawAllocator
+{
+    typedef T value_type;
+    SimRawAllocator() = default;
+    template <typename U> SimRawAllocator(const SimRawAllocator<U> &) {}
+    T *allocate(size_t n) { return (T *)malloc(n * sizeof(T)); }
+    void deallocate(T *p, size_t) { free(p); }
+    template <typename U> bool operator==(const SimRawAllocator<U> &) const { return true; }
+    template <typename U> bool operator!=(const SimRawAllocator<U> &) const { return false; }
+};
+
+class String
+{
+    typedef std::basic_string<char, std::char_traits<char>, SimRawAllocator<char>> Store;
+
+public:
+    String() {}
+    String(const char *s) : s_(s ? s : "") { track(); }
+    String(const std::string &s) : s_(s.c_str(), s.length()) { track(); }
+    String(char c) : s_(1, c) {}
+    String(int v, unsigned char base = 10) { fmtInt((long long)v, base); }
+    String(unsigned int v, unsigned char base = 10) { fmtInt((long long)v, base); }
+    String(long v, unsigned char base = 10) { fmtInt((long long)v, base); }
+    String(unsigned long v, unsigned char base = 10) { fmtInt((long long)v, base); }
+    String(long long v, unsigned char base = 10) { fmtInt(v, base); }
+    String(unsigned long long v, unsigned char base = 10) { fmtInt((long long)v, base); }
+    String(float v, unsigned int decimals = 2) { fmtFloat(v, decimals); }
+    String(double v, unsigned int decimals = 2) { fmtFloat(v, decimals); }
+    String(const String &o) : s_(o.s_) { track(); }
+    String(String &&o) : s_(std::move(o.s_)), capacity_(o.capacity_) { o.capacity_ = INLINE_CAPACITY; }
+    String &operator=(const String &o) { s_ = o.s_; track(); return *this; }
+    String &operator=(String &&o)
+    {
+        // The core swaps buffers on move; this one's is released
+        s_ = std::move(o.s_);
+        capacity_ = std::max(capacity_, o.capacity_);
+        o.capacity_ = INLINE_CAPACITY;
+        return *this;
+    }
+
+    unsigned int length() const { return s_.length(); }
+    const char *c_str() const { return s_.c_str(); }
+    char charAt(unsigned int i) const { return i < s_.length() ? s_[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    bool isEmpty() const { return s_.empty(); }
+    int indexOf(char c) const { size_t p = s_.find(c); return p == Store::npos ? -1 : (int)p; }
+    int indexOf(const String &t) const { size_t p = s_.find(t.s_); return p == Store::npos ? -1 : (int)p; }
+    String substring(unsigned int from) const { return from >= s_.length() ? String() : String(s_.substr(from)); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to) std::swap(from, to);
+        if (from >= s_.length()) return String();
+        return String(s_.substr(from, std::min<size_t>(to, s_.length()) - from));
+    }
+    long toInt() const { return atol(s_.c_str()); }
+    float toFloat() const { return atof(s_.c_str()); }
+    bool concat(const String &o) { s_ += o.s_; track(); return true; }
+
+    String &operator+=(const String &o) { s_ += o.s_; track(); return *this; }
+    String &operator+=(const char *o) { s_ += o; track(); return *this; }
+    String &operator+=(char c) { s_ += c; track(); return *this; }
+    bool operator==(const String &o) const { return s_ == o.s_; }
+    bool operator==(const char *o) const { return s_ == o; }
+    bool operator!=(const String &o) const { return s_ != o.s_; }
+    bool operator!=(const char *o) const { return s_ != o; }
+
+    friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.s_); }
+    friend String operator+(const String &a, char b) { return String(a.s_ + b); }
+
+private:
+    // Arduino-ESP32 keeps up to 11 characters inline and reallocates to the
+    // exact length whenever the content outgrows its buffer
+    static const unsigned int INLINE_CAPACITY = 11;
+
+    Store s_;
+    unsigned int capacity_ = INLINE_CAPACITY;
+
+    String(const Store &s) : s_(s) { track(); }
+    void track()
+    {
+        if (s_.length() > capacity_) {
+            simHeapAllocations++;
+            capacity_ = s_.length();
+        }
+    }
+    void fmtInt(long long v, unsigned char base)
+    {
+        char buf[40];
+        if (base == 16) snprintf(buf, sizeof(buf), "%llx", v);
+        else snprintf(buf, sizeof(buf), "%lld", v);
+        s_ = buf;
+        track();
+    }
+    void fmtFloat(double v, unsigned int decimals)
+    {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        s_ = buf;
+        track();
+    }
+};
+
+#include "Print.h"
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    void flush() {}
+    size_t write(uint8_t c) override;
+};
+extern HardwareSerial Serial;
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getMinFreeHeap();
+    uint64_t getEfuseMac() { return 0x123456789ABCULL; }
+};
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+void attachInterruptArg(uint8_t pin, void (*isr)(void *), void *arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+// Simulator controls, see simulator/src/Arduino.cpp
+extern bool simQuiet;             // Drop Serial output
+extern uint32_t simMaxAllocHeap;  // Largest free heap block reported to the firmware
@@ -0,0 +1,14 @@
+#pragma once
+// Compile-only stand-in for the handful of ArduinoJson types the API header touches.
+#include <Arduino.h>
+struct JsonVariant {
+    template <typename T> T as() const { return T(); }
+    JsonVariant operator[](const char *) const { return JsonVariant(); }
+    JsonVariant operator[](int) const { return JsonVariant(); }
+    size_t size() const { return 0; }
+};
+typedef JsonVariant JsonObject;
+typedef JsonVariant JsonArray;
+struct DynamicJsonDocument : JsonVariant { DynamicJsonDocument(size_t) {} };
+struct DeserializationError { explicit operator bool() const { return true; } const char *c_str() const { return "stub"; } };
+inline DeserializationError deserializeJson(DynamicJsonDocument &, const String &) { return DeserializationError(); }
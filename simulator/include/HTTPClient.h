@@ -0,0 +1,14 @@
+#pragma once
+// Host shim - compile-only, requests always fail
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+#define HTTP_CODE_OK 200
+class HTTPClient
+{
+public:
+    bool begin(WiFiClientSecure &, const String &) { return true; }
+    void setTimeout(uint16_t) {}
+    int GET() { return -1; }
+    String getString() { return String(); }
+    void end() {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+// Host shim - every key reads back its default
+#include <Arduino.h>
+class Preferences
+{
+public:
+    bool begin(const char *, bool = false) { return true; }
+    void end() {}
+    String getString(const char *, const String &d) { return d; }
+    bool getBool(const char *, bool d) { return d; }
+    float getFloat(const char *, float d) { return d; }
+    int getInt(const char *, int d) { return d; }
+    uint8_t getUChar(const char *, uint8_t d) { return d; }
+    size_t putString(const char *, const String &) { return 0; }
+    size_t putBool(const char *, bool) { return 0; }
+    size_t putFloat(const char *, float) { return 0; }
+    size_t putInt(const char *, int) { return 0; }
+    size_t putUChar(const char *, uint8_t) { return 0; }
+};
@@ -0,0 +1,30 @@
+#pragma once
+// Host shim of the Arduino Print base class
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class String;
+class __FlashStringHelper;
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s);
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t println() { return write((uint8_t)'\n'); }
+    size_t println(const char *s) { return print(s) + println(); }
+    size_t println(const String &s) { return print(s) + println(); }
+    size_t printf(const char *fmt, ...);
+};
@@ -0,0 +1,3 @@
+#pragma once
+// Host shim - remote logging is dropped
+#define RLOG_DEBUG(msg) do { (void)(msg); } while (0)
@@ -0,0 +1,28 @@
+#pragma once
+// Host shim - SPI bytes go to the simulated panel (simulator/src/Arduino.cpp)
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings
+{
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t /*bitOrder*/ = MSBFIRST, uint8_t /*dataMode*/ = SPI_MODE0) : clock(clock) {}
+    uint32_t clock;
+};
+
+class SPIClass
+{
+public:
+    void begin() {}
+    void end() {}
+    void beginTransaction(SPISettings settings) { clock = settings.clock; }
+    void endTransaction() {}
+    void setFrequency(uint32_t freq) { clock = freq; }
+    uint8_t transfer(uint8_t data);
+    void writeBytes(const uint8_t *data, uint32_t size);
+    void transferBytes(const uint8_t *data, uint8_t *out, uint32_t size);
+    uint32_t clock = 1000000;
+};
+extern SPIClass SPI;
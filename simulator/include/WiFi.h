@@ -0,0 +1,13 @@
+#pragma once
+// Host shim - WiFi is always off in the simulator
+#include <Arduino.h>
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass
+{
+public:
+    wifi_mode_t getMode() { return WIFI_OFF; }
+    bool mode(wifi_mode_t) { return true; }
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,4 @@
+#pragma once
+// Host shim - compile-only
+#include <Arduino.h>
+class WiFiClientSecure { public: void setInsecure() {} };
@@ -0,0 +1,13 @@
+#pragma once
+// Host shim - light sleep and GPIO wake-up are no-ops
+#include <stdint.h>
+
+typedef int gpio_num_t;
+typedef int esp_err_t;
+#define ESP_OK 0
+typedef enum { GPIO_INTR_DISABLE, GPIO_INTR_POSEDGE, GPIO_INTR_NEGEDGE, GPIO_INTR_ANYEDGE, GPIO_INTR_LOW_LEVEL, GPIO_INTR_HIGH_LEVEL } gpio_int_type_t;
+
+inline esp_err_t gpio_wakeup_enable(gpio_num_t, gpio_int_type_t) { return ESP_OK; }
+inline esp_err_t gpio_wakeup_disable(gpio_num_t) { return ESP_OK; }
+inline esp_err_t esp_sleep_enable_gpio_wakeup() { return ESP_OK; }
+inline esp_err_t esp_light_sleep_start() { return ESP_OK; }
@@ -0,0 +1,4 @@
+#pragma once
+// Host shim - microseconds since start-up
+#include <Arduino.h>
+inline int64_t esp_timer_get_time() { return (int64_t)micros(); }
@@ -0,0 +1,14 @@
+#pragma once
+// Host shim: FreeRTOS tasks/semaphores on std::thread
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t UBaseType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) (ms)
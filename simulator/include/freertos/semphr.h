@@ -0,0 +1,33 @@
+#pragma once
+#include "FreeRTOS.h"
+struct SimSemaphore {
+    std::mutex m;
+    std::condition_variable cv;
+    int count = 0;
+};
+typedef SimSemaphore *SemaphoreHandle_t;
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new SimSemaphore(); }
+inline void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s)
+{
+    std::lock_guard<std::mutex> l(s->m);
+    s->count = 1;
+    s->cv.notify_one();
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreTakeTimeout(SemaphoreHandle_t s, TickType_t ms);
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ms) { return xSemaphoreTakeTimeout(s, ms); }
+inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken)
+{
+    if (woken) *woken = pdFALSE;
+    return xSemaphoreGive(s);
+}
+inline BaseType_t xSemaphoreTakeTimeout(SemaphoreHandle_t s, TickType_t ms)
+{
+    std::unique_lock<std::mutex> l(s->m);
+    if (ms == portMAX_DELAY) { s->cv.wait(l, [s] { return s->count > 0; }); }
+    else if (!s->cv.wait_for(l, std::chrono::milliseconds(ms), [s] { return s->count > 0; })) return pdFALSE;
+    s->count = 0;
+    return pdTRUE;
+}
+#define portYIELD_FROM_ISR()
@@ -0,0 +1,8 @@
+#pragma once
+// Host shim of ricmoo/QRCode - see simulator/src/qrcode.cpp
+#include <stdint.h>
+#define ECC_LOW 0
+typedef struct { uint8_t version; uint8_t size; uint8_t ecc; uint8_t mode; uint8_t mask; uint8_t *modules; } QRCode;
+inline uint16_t qrcode_getBufferSize(uint8_t version) { int s = version * 4 + 17; return (s * s + 7) / 8; }
+int8_t qrcode_initText(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, const char *data);
+bool qrcode_getModule(QRCode *qrcode, uint8_t x, uint8_t y);
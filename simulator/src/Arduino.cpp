@@ -0,0 +1,114 @@
+#include <Arduino.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+#include <new>
+#include "SimPanel.hpp"
+
+HardwareSerial Serial;
+EspClass ESP;
+SPIClass SPI;
+WiFiClass WiFi;
+
+bool simQuiet = true;
+uint32_t simMaxAllocHeap = 110 * 1024;
+std::atomic<uint32_t> simHeapAllocations(0);
+
+// Count every C++ heap allocation; String adds its own, see Arduino.h.
+// Every new and delete form is replaced, so they all pair malloc() with free().
+static void *countedAlloc(size_t size)
+{
+    simHeapAllocations++;
+    void *p = malloc(size ? size : 1);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void *operator new(size_t size) { return countedAlloc(size); }
+void *operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if (!simQuiet) fputc(c, stdout);
+    return 1;
+}
+
+size_t Print::print(const String &s) { return write(s.c_str()); }
+
+size_t Print::printf(const char *fmt, ...)
+{
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return write(buf);
+}
+
+uint32_t EspClass::getFreeHeap() { return simMaxAllocHeap + 20 * 1024; }
+uint32_t EspClass::getMaxAllocHeap() { return simMaxAllocHeap; }
+uint32_t EspClass::getMinFreeHeap() { return simMaxAllocHeap; }
+
+static auto bootTime = std::chrono::steady_clock::now();
+unsigned long millis() { return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bootTime).count(); }
+unsigned long micros() { return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count(); }
+void delay(unsigned long) {}
+void delayMicroseconds(unsigned int) {}
+
+static uint8_t pinState[64];
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t val) { if (pin < 64) pinState[pin] = val; }
+int digitalRead(uint8_t pin) { return pin == 4 ? simPanel.busy() : (pin < 64 ? pinState[pin] : 0); }
+
+// BUSY interrupt - the simulated panel refreshes instantly on 0x20
+static void (*busyIsr)(void *) = nullptr;
+static void *busyIsrArg = nullptr;
+void attachInterruptArg(uint8_t pin, void (*isr)(void *), void *arg, int)
+{
+    if (pin == 4) { busyIsr = isr; busyIsrArg = arg; }
+}
+void detachInterrupt(uint8_t pin) { if (pin == 4) busyIsr = nullptr; }
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    if (pinState[17] == 0 && data == 0x20 && busyIsr) { simPanel.write(false, data); busyIsr(busyIsrArg); return 0; }
+    simPanel.write(pinState[17] != 0, data);
+    return 0;
+}
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) simPanel.write(pinState[17] != 0, data[i]);
+}
+
+void SPIClass::transferBytes(const uint8_t *data, uint8_t *out, uint32_t size)
+{
+    writeBytes(data, size);
+    if (out) memset(out, 0, size);
+}
+
+// FreeRTOS shim - tasks are detached threads; vTaskDelete(handle) only forgets them
+#include "freertos/task.h"
+struct SimTask { std::thread t; };
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *, uint32_t, void *arg,
+    UBaseType_t, TaskHandle_t *handle, BaseType_t)
+{
+    SimTask *task = new SimTask{std::thread(fn, arg)};
+    task->t.detach();
+    if (handle) *handle = task;
+    return pdPASS;
+}
+void vTaskDelete(TaskHandle_t handle)
+{
+    if (handle == nullptr) { while (true) std::this_thread::sleep_for(std::chrono::hours(1)); }
+    delete handle;
+}
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }  // Not tracked on the host
+void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+BaseType_t xPortGetCoreID() { return 1; }
@@ -0,0 +1,209 @@
+#include "SimPanel.hpp"
+#include <string.h>
+
+SimPanel simPanel;
+
+SimPanel::SimPanel()
+{
+    memset(ram24, 0xFF, sizeof(ram24));
+    memset(ram26, 0xFF, sizeof(ram26));
+    memset(panel, 0xFF, sizeof(panel));
+}
+
+void SimPanel::write(bool isData, uint8_t b)
+{
+    if (!isData) {
+        cmd = b;
+        argIndex = 0;
+        if (cmd == 0x20) activate();
+        return;
+    }
+    data(b);
+}
+
+void SimPanel::data(uint8_t b)
+{
+    if (cmd == 0x24 || cmd == 0x26) {
+        bytesWritten++;
+        if (xCounter >= 0 && xCounter < WIDTH && yCounter >= 0 && yCounter < HEIGHT) {
+            (cmd == 0x24 ? ram24 : ram26)[yCounter * ROW_BYTES + xCounter / 8] = b;
+        }
+        // Address counter walks the RAM window, X first
+        xCounter += 8;
+        if (xCounter > xEnd) {
+            xCounter = xStart;
+            yCounter++;
+            if (yCounter > yEnd) yCounter = yStart;
+        }
+        return;
+    }
+
+    if (argIndex < 8) args[argIndex] = b;
+    argIndex++;
+    switch (cmd) {
+        case 0x44:  // RAM X window
+            if (argIndex == 4) {
+                xStart = args[0] | (args[1] << 8);
+                xEnd = args[2] | (args[3] << 8);
+            }
+            break;
+        case 0x45:  // RAM Y window
+            if (argIndex == 4) {
+                yStart = args[0] | (args[1] << 8);
+                yEnd = args[2] | (args[3] << 8);
+            }
+            break;
+        case 0x4E:  // RAM X counter
+            if (argIndex == 2) xCounter = args[0] | (args[1] << 8);
+            break;
+        case 0x4F:  // RAM Y counter
+            if (argIndex == 2) yCounter = args[0] | (args[1] << 8);
+            break;
+        case 0x22:  // Display update control
+            updateMode = b;
+            break;
+        default:
+            break;
+    }
+}
+
+void SimPanel::activate()
+{
+    bool full = updateMode != 0xFF;
+    long driven = 0;
+    for (int i = 0; i < ROW_BYTES * HEIGHT; i++) {
+        uint8_t changed = full ? 0xFF : (uint8_t)(ram24[i] ^ ram26[i]);
+        driven += __builtin_popcount(changed);
+        panel[i] = (panel[i] & ~changed) | (ram24[i] & changed);
+    }
+    drivenPixels += driven;
+    if (full) {
+        fullRefreshes++;
+    } else {
+        partialRefreshes++;
+    }
+}
+
+void SimPanel::portraitRow(int vy, uint8_t *row)
+{
+    // Inverse of the firmware rotation: physX = vy, physY = 639 - vx
+    memset(row, 0, HEIGHT / 8);
+    for (int vx = 0; vx < HEIGHT; vx++) {
+        int px = vy;
+        int py = HEIGHT - 1 - vx;
+        bool white = panel[py * ROW_BYTES + px / 8] & (0x80 >> (px % 8));
+        if (!white) row[vx / 8] |= 0x80 >> (vx % 8);
+    }
+}
+
+bool SimPanel::savePBM(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P4\n%d %d\n", HEIGHT, WIDTH);
+    uint8_t row[HEIGHT / 8];
+    for (int vy = 0; vy < WIDTH; vy++) {
+        portraitRow(vy, row);
+        fwrite(row, 1, sizeof(row), f);
+    }
+    fclose(f);
+    return true;
+}
+
+// ============================================================================
+// PNG output - 1-bit greyscale, stored (uncompressed) deflate blocks
+// ============================================================================
+
+static const uint32_t PNG_LINE_BYTES = 1 + SimPanel::HEIGHT / 8;
+static const uint32_t PNG_RAW_BYTES = PNG_LINE_BYTES * SimPanel::WIDTH;
+static const uint32_t PNG_BLOCKS = (PNG_RAW_BYTES + 65534) / 65535;
+
+static uint32_t crcTable[256];
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t length)
+{
+    if (crcTable[1] == 0) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            crcTable[n] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void putBE32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static void writeChunk(FILE *f, const char *type, const uint8_t *data, uint32_t length)
+{
+    uint8_t header[8];
+    putBE32(header, length);
+    memcpy(header + 4, type, 4);
+    fwrite(header, 1, 8, f);
+    if (length > 0) fwrite(data, 1, length, f);
+    uint8_t crc[4];
+    putBE32(crc, crc32(crc32(0, header + 4, 4), data, length));
+    fwrite(crc, 1, 4, f);
+}
+
+bool SimPanel::savePNG(const char *path)
+{
+    // Raw scanlines: filter byte 0 followed by the row, white = 1 as in PNG greyscale
+    static uint8_t raw[PNG_RAW_BYTES];
+    for (int vy = 0; vy < WIDTH; vy++) {
+        uint8_t *line = &raw[vy * PNG_LINE_BYTES];
+        line[0] = 0;
+        portraitRow(vy, line + 1);
+        for (uint32_t i = 1; i < PNG_LINE_BYTES; i++) line[i] = ~line[i];
+    }
+
+    // zlib stream of stored blocks, at most 65535 bytes each
+    static uint8_t zlib[2 + PNG_BLOCKS * 5 + PNG_RAW_BYTES + 4];
+    uint32_t pos = 0;
+    zlib[pos++] = 0x78;
+    zlib[pos++] = 0x01;
+    uint32_t a = 1, b = 0;
+    for (uint32_t i = 0; i < PNG_RAW_BYTES; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    for (uint32_t block = 0, offset = 0; block < PNG_BLOCKS; block++) {
+        uint32_t length = PNG_RAW_BYTES - offset < 65535 ? PNG_RAW_BYTES - offset : 65535;
+        zlib[pos++] = block == PNG_BLOCKS - 1 ? 1 : 0;
+        zlib[pos++] = length & 0xFF;
+        zlib[pos++] = length >> 8;
+        zlib[pos++] = ~length & 0xFF;
+        zlib[pos++] = (~length >> 8) & 0xFF;
+        memcpy(&zlib[pos], &raw[offset], length);
+        pos += length;
+        offset += length;
+    }
+    putBE32(&zlib[pos], (b << 16) | a);
+    pos += 4;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, 8, f);
+    uint8_t ihdr[13];
+    putBE32(ihdr, HEIGHT);     // Portrait width
+    putBE32(ihdr + 4, WIDTH);  // Portrait height
+    ihdr[8] = 1;   // Bit depth
+    ihdr[9] = 0;   // Greyscale
+    ihdr[10] = 0;  // Deflate
+    ihdr[11] = 0;  // Adaptive filtering
+    ihdr[12] = 0;  // No interlace
+    writeChunk(f, "IHDR", ihdr, sizeof(ihdr));
+    writeChunk(f, "IDAT", zlib, pos);
+    writeChunk(f, "IEND", nullptr, 0);
+    fclose(f);
+    return true;
+}
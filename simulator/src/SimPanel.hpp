@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Model of the GDEM102T91 controller as seen over SPI: the two RAM planes,
+ * the RAM window/counters and the visible panel state after each refresh.
+ * Full refreshes show RAM 0x24 as-is, partial ones drive only the pixels
+ * where RAM 0x24 and 0x26 differ.
+ */
+class SimPanel
+{
+public:
+    static const int WIDTH = 960, HEIGHT = 640, ROW_BYTES = WIDTH / 8;
+
+    uint8_t ram24[ROW_BYTES * HEIGHT];
+    uint8_t ram26[ROW_BYTES * HEIGHT];
+    uint8_t panel[ROW_BYTES * HEIGHT];
+
+    // Statistics since start-up
+    int fullRefreshes = 0;
+    int partialRefreshes = 0;
+    long bytesWritten = 0;   // RAM bytes received
+    long drivenPixels = 0;   // Pixels switched by refreshes
+
+    SimPanel();
+
+    // One byte on the bus - DC low is a command, DC high its data
+    void write(bool isData, uint8_t b);
+    int busy() { return 0; }
+
+    // Visible panel in portrait orientation, the way the firmware draws it
+    bool savePBM(const char *path);
+    bool savePNG(const char *path);
+
+private:
+    uint8_t cmd = 0;
+    int argIndex = 0;
+    uint8_t args[8];
+    uint8_t updateMode = 0xF7;
+    int xStart = 0, xEnd = WIDTH - 1, yStart = 0, yEnd = HEIGHT - 1;
+    int xCounter = 0, yCounter = 0;
+
+    void data(uint8_t b);
+    void activate();
+    // Portrait row vy packed MSB first, set bits are black (PBM convention)
+    void portraitRow(int vy, uint8_t *row);
+};
+
+extern SimPanel simPanel;
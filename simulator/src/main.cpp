@@ -0,0 +1,245 @@
+/**
+ * Host renderer - draws WeatherScreen for a built-in WeatherData_t fixture
+ * through the real Display102 driver and writes the simulated panel to a
+ * PBM or PNG file.
+ *
+ *   simulator [-o out.pbm|out.png] [-n frames] [--heap bytes] [--diff]
+ *             [--temperature C] [--weather-code N] [--time epoch]
+ *             [--popup] [--setup] [--max-allocs N] [--location name]
+ *             [--check-glyphs] [--bench] [-v]
+ *
+ * --max-allocs fails the run when a dashboard frame averages more than N heap
+ * allocations (operator new plus String buffers, modelled on the ESP32 core),
+ * or when the text path alone allocates at all.
+ *
+ * --check-glyphs fails the run when a character of the location name has no
+ * bitmap in a font that draws runtime text (e.g. dropped from a font subset).
+ *
+ * --bench skips the dashboard and times full-screen fills per dither tone,
+ * through the span path (fillRect) and through drawPixel.
+ */
+#include <Arduino.h>
+#include "weather/UI/Screen.hpp"
+#include "weather/Logging/Profiler.hpp"
+#include "SimPanel.hpp"
+
+static void fillFixture(WeatherData_t &data)
+{
+    data.current.temperature = 21.4f;
+    data.current.apparentTemperature = 19.6f;
+    data.current.humidity = 64;
+    data.current.windSpeed = 12.5f;
+    data.current.windDirection = 225;
+    data.current.weatherCode = 2;
+    data.current.isDay = true;
+    data.current.precipitation = 0.4f;
+
+    static const int hourlyCodes[] = {0, 1, 2, 3, 45, 51, 61, 71, 80, 95};
+    data.hourlyCount = 24;
+    for (int i = 0; i < 24; i++) {
+        data.hourly[i].hour = (15 + i) % 24;
+        data.hourly[i].temperature = 21.0f - i * 0.4f;
+        data.hourly[i].weatherCode = hourlyCodes[i % 10];
+        data.hourly[i].precipitation = (i % 3) * 0.3f;
+        data.hourly[i].precipitationProbability = (i * 13) % 90;
+    }
+
+    static const int dailyCodes[] = {0, 2, 3, 61, 71, 95, 45};
+    data.dailyCount = 7;
+    for (int i = 0; i < 7; i++) {
+        data.daily[i].dayOfWeek = (i + 1) % 7;
+        data.daily[i].dayOfMonth = 15 + i;
+        data.daily[i].month = 5;
+        data.daily[i].tempMax = 24.0f - i;
+        data.daily[i].tempMin = 12.0f - i * 0.5f;
+        data.daily[i].weatherCode = dailyCodes[i];
+        data.daily[i].precipitationSum = i * 1.2f;
+        data.daily[i].precipitationProbability = i * 12;
+        data.daily[i].sunrise = "05:12";
+        data.daily[i].sunset = "21:03";
+    }
+    data.valid = true;
+}
+
+// Heap allocations made by drawText()/measureText() themselves - every font,
+// UTF-8 input, String and const char* overloads
+static uint32_t textAllocations(Display102 &display)
+{
+    static const Font fonts[] = {EXTRA_SMALL, TINY, SMALL, DAY_NUMBER, MEDIUM, LARGE, HUGE};
+    String label = "Přeháňky a bouřky, 12° / 7°";
+    display.beginDraw();
+    uint32_t before = simHeapAllocations;
+    for (Font font : fonts) {
+        display.drawText(font, label, 10, 100, LEADING, LEADING, 0, 0, GxEPD_BLACK);
+        display.drawText(font, "Délka dne 15h 51m", 320, 200, CENTER, CENTER, 0, 0, GxEPD_DARKGREY, GxEPD_WHITE);
+        display.measureText(font, label, 630, 300, TRAILING, TRAILING, 0, 0);
+    }
+    uint32_t count = simHeapAllocations - before;
+    display.endDraw();
+    return count;
+}
+
+// Characters of text that measure empty - no glyph bitmap - in the fonts that
+// draw runtime text (HUGE only draws the hero temperature)
+static int missingGlyphs(Display102 &display, const char *text)
+{
+    static const Font fonts[] = {EXTRA_SMALL, TINY, SMALL, DAY_NUMBER, MEDIUM, LARGE};
+    int missing = 0;
+    for (const char *c = text; *c; ) {
+        // One UTF-8 sequence
+        size_t length = 1;
+        while ((c[length] & 0xC0) == 0x80) length++;
+        if (*c != ' ') {
+            for (Font font : fonts) {
+                Rectangle_t bounds = display.measureText(font, c, length, 0, 0, LEADING, LEADING, 0, 0);
+                if (bounds.w <= 0) {
+                    fprintf(stderr, "No glyph for '%.*s' in font %d\n", (int)length, c, (int)font);
+                    missing++;
+                }
+            }
+        }
+        c += length;
+    }
+    return missing;
+}
+
+// Full-screen fills per dither tone in megapixels per second of host time -
+// the byte-wide span path against one drawPixel() call per pixel. Only the
+// drawing is timed, on every page of a paged frame.
+static void benchTones(Display102 &display)
+{
+    static const struct { const char *name; uint16_t color; } tones[] = {
+        {"black", GxEPD_BLACK}, {"red", COLOR_RED}, {"verydark", GxEPD_VERYDARK},
+        {"darkgrey", GxEPD_DARKGREY}, {"lightgrey", GxEPD_LIGHTGREY}, {"white", GxEPD_WHITE},
+    };
+    const int spanFills = 200, pixelFills = 5;
+    int w = display.getDisplayWidth(), h = display.getDisplayHeight();
+    double pixels = (double)w * h;
+
+    for (const auto &tone : tones) {
+        unsigned long spanMicros = 0, pixelMicros = 0;
+        display.beginDraw();
+        display.firstPage();
+        do {
+            unsigned long start = micros();
+            for (int i = 0; i < spanFills; i++) {
+                display.fillRect(0, 0, w, h, tone.color);
+            }
+            spanMicros += micros() - start;
+
+            start = micros();
+            for (int i = 0; i < pixelFills; i++) {
+                for (int y = 0; y < h; y++) {
+                    for (int x = 0; x < w; x++) {
+                        display.drawPixel(x, y, tone.color);
+                    }
+                }
+            }
+            pixelMicros += micros() - start;
+        } while (display.nextPage());
+        display.endDraw();
+
+        double spanRate = spanFills * pixels / max(spanMicros, 1UL);
+        double pixelRate = pixelFills * pixels / max(pixelMicros, 1UL);
+        printf("%-10s spans %8.1f Mpx/s  pixels %6.1f Mpx/s  %5.1fx\n",
+               tone.name, spanRate, pixelRate, spanRate / pixelRate);
+    }
+}
+
+static bool endsWith(const char *s, const char *suffix)
+{
+    size_t n = strlen(s), m = strlen(suffix);
+    return n >= m && strcmp(s + n - m, suffix) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *output = "weather.pbm";
+    int frames = 1;
+    bool diff = false, popup = false, setup = false, checkGlyphs = false, bench = false;
+    long maxAllocs = -1;
+
+    static WeatherData_t data;
+    fillFixture(data);
+    WeatherScreenData_t screenData;
+    screenData.currentTime = 1750000000;
+    screenData.batteryLevel = 80;
+    screenData.wifiSignalLevel = 70;
+    screenData.locationName = "Praha";
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "-o") && hasValue) output = argv[++i];
+        else if (!strcmp(argv[i], "-n") && hasValue) frames = max(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "--heap") && hasValue) simMaxAllocHeap = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--temperature") && hasValue) data.current.temperature = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--weather-code") && hasValue) data.current.weatherCode = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--time") && hasValue) screenData.currentTime = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--max-allocs") && hasValue) maxAllocs = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--location") && hasValue) screenData.locationName = argv[++i];
+        else if (!strcmp(argv[i], "--check-glyphs")) checkGlyphs = true;
+        else if (!strcmp(argv[i], "--bench")) bench = true;
+        else if (!strcmp(argv[i], "--diff")) diff = true;
+        else if (!strcmp(argv[i], "--popup")) popup = true;
+        else if (!strcmp(argv[i], "--setup")) setup = true;
+        else if (!strcmp(argv[i], "-v")) simQuiet = false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    static WeatherScreen screen;
+    Display102 &display = screen.getDisplay();
+    display.setDifferentialRefresh(diff);
+
+    if (bench) {
+        benchTones(display);
+        return 0;
+    }
+
+    // With --diff every frame after the first advances the clock by a minute,
+    // so the stats show what a differential wake would drive
+    uint32_t allocsBefore = simHeapAllocations;
+    unsigned long start = micros();
+    for (int i = 0; i < frames; i++) {
+        screen.drawWeatherScreen(screenData, data);
+        if (diff) screenData.currentTime += 60;
+    }
+    unsigned long elapsed = micros() - start;
+    double allocsPerFrame = (double)(simHeapAllocations - allocsBefore) / frames;
+
+    if (popup) {
+        screen.drawPopup(ScreenInfoData_t("Připojte se k WiFi", "WIFI:S:weather;T:nopass;;", "weather-station", 21.5f, true));
+    }
+    if (setup) {
+        screen.drawWebSetupPopupOverlay("weather-AP", "192.168.4.1", "home", "10.0.0.7");
+    }
+
+    uint32_t textAllocs = textAllocations(display);
+
+    printf("frames=%d avg=%.2f ms pages=%d full=%d partial=%d bytes=%ld driven=%ld allocs=%.1f text_allocs=%u\n",
+           frames, elapsed / 1000.0 / frames, display.getPageCount(),
+           simPanel.fullRefreshes, simPanel.partialRefreshes, simPanel.bytesWritten, simPanel.drivenPixels,
+           allocsPerFrame, textAllocs);
+#if PROFILING
+    printf("%s", Profiler::report().c_str());
+#endif
+
+    if (maxAllocs >= 0 && (allocsPerFrame > maxAllocs || textAllocs > 0)) {
+        fprintf(stderr, "%.1f heap allocations per frame (limit %ld), %u in text drawing\n",
+                allocsPerFrame, maxAllocs, textAllocs);
+        return 1;
+    }
+
+    if (checkGlyphs && missingGlyphs(display, screenData.locationName.c_str()) > 0) {
+        return 1;
+    }
+
+    bool saved = endsWith(output, ".png") ? simPanel.savePNG(output) : simPanel.savePBM(output);
+    if (!saved) {
+        fprintf(stderr, "Cannot write %s\n", output);
+        return 1;
+    }
+    return 0;
+}
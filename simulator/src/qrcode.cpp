@@ -0,0 +1,17 @@
+#include <qrcode.h>
+#include <string.h>
+// Deterministic stand-in for ricmoo/QRCode - the modules are a hash of the text,
+// not a scannable code; only their placement and drawing cost matter here
+static uint32_t qrSeed;
+int8_t qrcode_initText(QRCode *q, uint8_t *modules, uint8_t version, uint8_t /*ecc*/, const char *data)
+{
+    q->version = version; q->size = version * 4 + 17; q->modules = modules;
+    qrSeed = 2166136261u;
+    for (const char *p = data; *p; p++) qrSeed = (qrSeed ^ (uint8_t)*p) * 16777619u;
+    return 0;
+}
+bool qrcode_getModule(QRCode * /*q*/, uint8_t x, uint8_t y)
+{
+    uint32_t h = (qrSeed ^ (x * 31 + y * 131)) * 2654435761u;
+    return (h >> 16) & 1;
+}
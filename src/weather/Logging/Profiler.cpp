@@ -0,0 +1,79 @@
+#include "Profiler.hpp"
+
+#if PROFILING
+
+// Ring buffer of the last frames - survives deep sleep
+RTC_DATA_ATTR static ProfileFrame_t rtcFrames[PROFILER_FRAMES];
+RTC_DATA_ATTR static uint32_t rtcFrameCount = 0;
+
+static const char *SECTION_NAMES[PROFILE_SECTIONS] = {
+    "other", "header", "hero", "details", "hourly", "forecast", "sun", "upload", "busy"
+};
+
+ProfileSection_t Profiler::currentSection = PROFILE_OTHER;
+uint32_t Profiler::frameStart = 0;
+uint32_t Profiler::pageStart = 0;
+
+// Times outside a frame are dropped until this wake has begun one; after
+// that they go to its slot, so a refresh waited for before deep sleep still counts
+static ProfileFrame_t *activeFrame = nullptr;
+
+void Profiler::beginFrame()
+{
+    activeFrame = &rtcFrames[rtcFrameCount % PROFILER_FRAMES];
+    memset(activeFrame, 0, sizeof(ProfileFrame_t));
+    activeFrame->sequence = rtcFrameCount++;
+    currentSection = PROFILE_OTHER;
+    frameStart = now();
+    pageStart = frameStart;
+}
+
+void Profiler::endFrame(int pages)
+{
+    if (activeFrame == nullptr) return;
+    activeFrame->totalUs = now() - frameStart;
+    activeFrame->pages = pages;
+}
+
+void Profiler::beginPage()
+{
+    pageStart = now();
+}
+
+void Profiler::endPage(int page)
+{
+    if (activeFrame == nullptr || page >= PROFILER_MAX_PAGES) return;
+    activeFrame->pageUs[page] += now() - pageStart;
+}
+
+void Profiler::add(ProfileSection_t section, uint32_t us)
+{
+    if (activeFrame == nullptr) return;
+    activeFrame->sectionUs[section] += us;
+}
+
+static String formatMs(uint32_t us)
+{
+    return String(us / 1000.0f, 1);
+}
+
+String Profiler::report()
+{
+    String out;
+    uint32_t count = min(rtcFrameCount, (uint32_t)PROFILER_FRAMES);
+    for (uint32_t i = rtcFrameCount - count; i < rtcFrameCount; i++) {
+        const ProfileFrame_t &frame = rtcFrames[i % PROFILER_FRAMES];
+        out += "#" + String(frame.sequence) + " total " + formatMs(frame.totalUs) + " ms";
+        for (int s = 0; s < PROFILE_SECTIONS; s++) {
+            out += " " + String(SECTION_NAMES[s]) + " " + formatMs(frame.sectionUs[s]);
+        }
+        out += " pages";
+        for (int p = 0; p < frame.pages && p < PROFILER_MAX_PAGES; p++) {
+            out += " " + formatMs(frame.pageUs[p]);
+        }
+        out += "\n";
+    }
+    return out;
+}
+
+#endif
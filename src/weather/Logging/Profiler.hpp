@@ -0,0 +1,99 @@
+#pragma once
+#include <Arduino.h>
+#include "../consts.h"
+
+// Render profiler - section, page, SPI upload and BUSY wait times of the last
+// PROFILER_FRAMES frames, kept in RTC memory. With PROFILING 0 (consts.h) every
+// macro below expands to nothing and Profiler.cpp compiles to an empty unit.
+#ifndef PROFILER_FRAMES
+#define PROFILER_FRAMES 8
+#endif
+#define PROFILER_MAX_PAGES 8
+
+typedef enum : uint8_t {
+    PROFILE_OTHER,      // Drawing outside any dashboard section
+    PROFILE_HEADER,
+    PROFILE_HERO,
+    PROFILE_DETAILS,
+    PROFILE_HOURLY,
+    PROFILE_FORECAST,
+    PROFILE_SUN_MOON,
+    PROFILE_UPLOAD,     // SPI RAM upload in nextPage(), on either core
+    PROFILE_WAIT_BUSY,  // Panel refresh, synchronous or waited for
+    PROFILE_SECTIONS
+} ProfileSection_t;
+
+typedef struct {
+    uint32_t sequence;   // Frame number since cold boot
+    uint32_t totalUs;    // firstPage() to the last nextPage(), layout included
+    uint8_t pages;
+    uint32_t sectionUs[PROFILE_SECTIONS];
+    uint32_t pageUs[PROFILER_MAX_PAGES];  // Drawing time per page, upload excluded
+} ProfileFrame_t;
+
+#if PROFILING
+
+#include <esp_timer.h>
+
+class Profiler
+{
+public:
+    static void beginFrame();
+    static void endFrame(int pages);
+    static void beginPage();
+    static void endPage(int page);
+
+    static void add(ProfileSection_t section, uint32_t us);
+    static ProfileSection_t getSection() { return currentSection; }
+    static void setSection(ProfileSection_t section) { currentSection = section; }
+    static uint32_t now() { return (uint32_t)esp_timer_get_time(); }
+
+    // Oldest frame first, one line per frame (times in ms)
+    static String report();
+
+private:
+    static ProfileSection_t currentSection;
+    static uint32_t frameStart;
+    static uint32_t pageStart;
+};
+
+/**
+ * Adds its lifetime to a section. Dashboard sections also become the current
+ * section, so primitives recorded inside them charge their replay time there.
+ */
+class ProfileScope
+{
+public:
+    ProfileScope(ProfileSection_t section) : section(section), previous(Profiler::getSection()), start(Profiler::now())
+    {
+        if (section < PROFILE_UPLOAD) Profiler::setSection(section);
+    }
+    ~ProfileScope()
+    {
+        Profiler::add(section, Profiler::now() - start);
+        if (section < PROFILE_UPLOAD) Profiler::setSection(previous);
+    }
+
+private:
+    ProfileSection_t section;
+    ProfileSection_t previous;
+    uint32_t start;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(section) ProfileScope PROFILE_CONCAT(_profileScope, __LINE__)(section)
+#define PROFILE_FRAME_BEGIN() Profiler::beginFrame()
+#define PROFILE_FRAME_END(pages) Profiler::endFrame(pages)
+#define PROFILE_PAGE_BEGIN() Profiler::beginPage()
+#define PROFILE_PAGE_END(page) Profiler::endPage(page)
+
+#else
+
+#define PROFILE_SCOPE(section)
+#define PROFILE_FRAME_BEGIN()
+#define PROFILE_FRAME_END(pages)
+#define PROFILE_PAGE_BEGIN()
+#define PROFILE_PAGE_END(page)
+
+#endif
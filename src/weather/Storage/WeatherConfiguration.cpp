@@ -12,6 +12,7 @@ void WeatherConfiguration::reset()
     latitude = 50.0755;
     longitude = 14.4378;
     refreshIntervalMinutes = 10;
+    clockMode = false;
     language = "cs";
     fontScale = FONT_SCALE_NORMAL;
     
@@ -31,6 +32,7 @@ void WeatherConfiguration::load()
     latitude = prefs.getFloat("latitude", 50.0755);
     longitude = prefs.getFloat("longitude", 14.4378);
     refreshIntervalMinutes = prefs.getInt("refresh_min", 10);
+    clockMode = prefs.getBool("clock_mode", false);
     
     // Language
     language = prefs.getString("language", "cs");
@@ -56,6 +58,7 @@ void WeatherConfiguration::save()
     prefs.putFloat("latitude", latitude);
     prefs.putFloat("longitude", longitude);
     prefs.putInt("refresh_min", refreshIntervalMinutes);
+    prefs.putBool("clock_mode", clockMode);
     prefs.putString("language", language);
     prefs.putUChar("font_scale", (uint8_t)fontScale);
     
@@ -35,6 +35,9 @@ public:
     // Refresh interval in minutes (default 10 minutes)
     int refreshIntervalMinutes = 10;
     
+    // Clock mode - stay in light sleep between fetches and repaint the time every minute
+    bool clockMode = false;
+    
     // UI language
     String language = "cs";
     
@@ -1,26 +1,33 @@
 #include "Display102.hpp"
 #include "../DisplayTypes.hpp"  // For COLOR_RED
 #include <WiFi.h>
+#include <limits.h>
 #include "../gfxlatin2.h"
 
-// Include fonts (same as 7.5" display)
-#include "../InterTightSemiBold6pt8bfr.h"
-#include "../InterTightBold8pt8bfr.h"
-#include "../InterTightSemiBold8pt8bfr.h"
-#include "../InterTightSemiBold10pt8bfr.h"
-#include "../InterTightSemiBold12pt8bfr.h"
-#include "../InterTightSemiBold14pt8bfr.h"
-#include "../InterTightBold16pt8bfr.h"
-#include "../InterTightBold18pt8bfr.h"
-#include "../InterTightBold22pt8bfr.h"
-#include "../InterTightBold24pt8bfr.h"
-#include "../InterTightBold32pt8bfr.h"
-#include "../InterTightBold34pt8bfr.h"
-#include "../InterTightBold52pt8bfr.h"
+// Include fonts - subsets of ../InterTight*.h generated by fontSubset_script.py
+#include "../Fonts102/InterTightSemiBold6pt8bfr.h"
+#include "../Fonts102/InterTightBold8pt8bfr.h"
+#include "../Fonts102/InterTightSemiBold10pt8bfr.h"
+#include "../Fonts102/InterTightSemiBold12pt8bfr.h"
+#include "../Fonts102/InterTightSemiBold14pt8bfr.h"
+#include "../Fonts102/InterTightBold16pt8bfr.h"
+#include "../Fonts102/InterTightBold18pt8bfr.h"
+#include "../Fonts102/InterTightBold22pt8bfr.h"
+#include "../Fonts102/InterTightBold24pt8bfr.h"
+#include "../Fonts102/InterTightBold34pt8bfr.h"
+#include "../Fonts102/InterTightBold52pt8bfr.h"
+#if EPD102_GLYPH_ATLAS
+#include "../FontAtlases102.h"
+#endif
 
 // Static member initialization
 FontScale_t Display102::currentFontScale = FONT_SCALE_NORMAL;
 
+// Differential refresh state - survives deep sleep
+RTC_DATA_ATTR static uint32_t rtcTileHashes[EPD102_TILE_COUNT];
+RTC_DATA_ATTR static bool rtcTilesValid = false;
+RTC_DATA_ATTR static uint16_t rtcDirtyTiles[EPD102_TILE_GRID_ROWS];  // Repainted outside a frame
+
 void Display102::setFontScale(FontScale_t scale)
 {
     currentFontScale = scale;
@@ -57,6 +64,7 @@ Display102::Display102() : Adafruit_GFX(EPD102_HEIGHT, EPD102_WIDTH)
 
 Display102::~Display102()
 {
+    freeBackBuffer();
     if (frameBuffer != nullptr) {
         free(frameBuffer);
         frameBuffer = nullptr;
@@ -97,17 +105,18 @@ uint16_t Display102::mapColor(uint16_t color)
 
 void Display102::beginDraw()
 {
+    // The panel can't take a new frame while the previous one is still refreshing
+    waitRefresh();
+    
     LOGD("Display102::beginDraw - Allocating frame buffer, max alloc: " + String(ESP.getMaxAllocHeap()));
     
-    if (frameBuffer == nullptr) {
-        frameBuffer = (uint8_t *)malloc(EPD102_ARRAY);
-        if (frameBuffer == nullptr) {
-            LOGD("Display102: Failed to allocate frame buffer!");
-            return;
-        }
+    if (frameBuffer == nullptr && !allocateFrameBuffer()) {
+        LOGD("Display102: Failed to allocate frame buffer even with " + String(EPD102_MAX_PAGES) + " pages!");
+        return;
     }
-    memset(frameBuffer, 0xFF, EPD102_ARRAY);
-    LOGD("Display102::beginDraw - Buffer allocated, max alloc now: " + String(ESP.getMaxAllocHeap()));
+    memset(frameBuffer, 0xFF, _bufferSize);
+    LOGD("Display102::beginDraw - Buffer allocated (" + String(_bufferSize) + " bytes, " + String(_pages) + 
+         " pages), max alloc now: " + String(ESP.getMaxAllocHeap()));
     
     // Power on and initialize display
     powerOn();
@@ -118,12 +127,22 @@ void Display102::endDraw()
 {
     LOGD("Display102::endDraw - Freeing frame buffer");
     
-    // Power off display
-    powerOff();
+    _recording = false;
+    _list.end();
+    freeBackBuffer();
+    
+    // Power off display - after the refresh when it is still running
+    if (_refreshing) {
+        LOGD("Display102::endDraw - Refresh running, power off deferred");
+        _powerOffPending = true;
+    } else {
+        powerOff();
+    }
     
     if (frameBuffer != nullptr) {
         free(frameBuffer);
         frameBuffer = nullptr;
+        _bufferSize = 0;
     }
     LOGD("Display102::endDraw - Buffer freed, max alloc now: " + String(ESP.getMaxAllocHeap()));
 }
@@ -131,8 +150,141 @@ void Display102::endDraw()
 void Display102::clear()
 {
     if (frameBuffer != nullptr) {
-        memset(frameBuffer, 0xFF, EPD102_ARRAY);
+        memset(frameBuffer, 0xFF, _bufferSize);
+    }
+}
+
+bool Display102::allocateFrameBuffer()
+{
+    if (_popupMode) {
+        // Popup buffer holds only the window, no paging
+        setPageCount(1);
+        _bufferSize = popupBufferSize();
+        frameBuffer = (uint8_t *)malloc(_bufferSize);
+        return frameBuffer != nullptr;
+    }
+    
+    int pages = pagesFor(ESP.getMaxAllocHeap());
+    
+    // The estimate can still lose a race with fragmentation - halve the band until malloc succeeds
+    for (; pages <= EPD102_MAX_PAGES; pages *= 2) {
+        setPageCount(pages);
+        frameBuffer = (uint8_t *)malloc(_pageBytes);
+        if (frameBuffer != nullptr) {
+            _bufferSize = _pageBytes;
+            allocateBackBuffer();
+            return true;
+        }
+        LOGD("Display102: " + String(_pageBytes) + " byte buffer failed, max alloc: " + String(ESP.getMaxAllocHeap()));
+    }
+    return false;
+}
+
+// Fewest bands whose buffer fits the largest free block with some reserve left
+int Display102::pagesFor(uint32_t maxAlloc)
+{
+    int pages = 1;
+    while (pages < EPD102_MAX_PAGES && (uint32_t)(EPD102_FRAME_BYTES / pages + EPD102_HEAP_RESERVE) > maxAlloc) {
+        pages *= 2;
+    }
+    return pages;
+}
+
+void Display102::allocateBackBuffer()
+{
+#if EPD102_DOUBLE_BUFFER
+    // Nothing to overlap with a single page; otherwise only when the reserve stays intact
+    if (_pages < 2 || ESP.getMaxAllocHeap() < _pageBytes + EPD102_UPLOAD_STACK + EPD102_HEAP_RESERVE) {
+        LOGD("Display102: Single-buffered paging");
+        return;
+    }
+    _backBuffer = (uint8_t *)malloc(_pageBytes);
+    _uploadStart = xSemaphoreCreateBinary();
+    _uploadDone = xSemaphoreCreateBinary();
+    if (_backBuffer == nullptr || _uploadStart == nullptr || _uploadDone == nullptr ||
+        xTaskCreatePinnedToCore(uploadTaskMain, "epd_upload", EPD102_UPLOAD_STACK, this, 1,
+            &_uploadTask, EPD102_UPLOAD_CORE) != pdPASS) {
+        LOGD("Display102: Double buffer setup failed, single-buffered paging");
+        _uploadTask = nullptr;
+        freeBackBuffer();
+        return;
+    }
+    memset(_backBuffer, 0xFF, _pageBytes);
+    LOGD("Display102: Double-buffered paging, upload on core " + String(EPD102_UPLOAD_CORE));
+#endif
+}
+
+void Display102::freeBackBuffer()
+{
+    if (_uploadTask != nullptr) {
+        // A null band tells the task to exit
+        waitUpload();
+        _uploadBuffer = nullptr;
+        xSemaphoreGive(_uploadStart);
+        xSemaphoreTake(_uploadDone, portMAX_DELAY);
+        _uploadTask = nullptr;
+    }
+    if (_uploadStart != nullptr) {
+        vSemaphoreDelete(_uploadStart);
+        _uploadStart = nullptr;
+    }
+    if (_uploadDone != nullptr) {
+        vSemaphoreDelete(_uploadDone);
+        _uploadDone = nullptr;
+    }
+    if (_backBuffer != nullptr) {
+        free(_backBuffer);
+        _backBuffer = nullptr;
+    }
+}
+
+void Display102::setPageCount(int pages)
+{
+    _pages = pages;
+    _pageRows = EPD102_HEIGHT / pages;
+    _pageBytes = EPD102_FRAME_BYTES / pages;
+    updateView();
+}
+
+uint32_t Display102::popupBufferSize()
+{
+    // Same window geometry as drawPixel()/updateWindow() use in popup mode
+    BufferView_t view = bufferView();
+    return view.stride * view.rows;
+}
+
+Display102::BufferView_t Display102::bufferView(int page)
+{
+    BufferView_t view;
+#if EPD102_PORTRAIT_NATIVE
+    if (_popupMode) {
+        // Popup window padded out to whole bytes and 8-row transpose blocks
+        view.bitOrigin = (_popupX / 8) * 8;
+        view.stride = (_popupX + _popupW + 7) / 8 - _popupX / 8;
+        view.firstRow = (_popupY / 8) * 8;
+        view.rows = ((_popupY + _popupH + 7) / 8) * 8 - view.firstRow;
+    } else {
+        // A page of physical rows is a band of portrait columns
+        view.bitOrigin = EPD102_HEIGHT - (page + 1) * _pageRows;
+        view.stride = _pageRows / 8;
+        view.firstRow = 0;
+        view.rows = EPD102_WIDTH;
+    }
+#else
+    if (_popupMode) {
+        // Popup physical area: X aligned to bytes, one row per popup column
+        view.bitOrigin = (_popupY / 8) * 8;
+        view.stride = (_popupY + _popupH + 7) / 8 - _popupY / 8;
+        view.firstRow = EPD102_HEIGHT - _popupX - _popupW;
+        view.rows = _popupW;
+    } else {
+        view.bitOrigin = 0;
+        view.stride = EPD102_ROW_BYTES;
+        view.firstRow = page * _pageRows;
+        view.rows = _pageRows;
     }
+#endif
+    return view;
 }
 
 // ============================================================================
@@ -161,7 +313,7 @@ void Display102::powerOn()
     pinMode(PIN_DC, OUTPUT);
     pinMode(PIN_CS, OUTPUT);
     
-    SPI.beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
+    SPI.beginTransaction(SPISettings(_spiFrequency, MSBFIRST, SPI_MODE0));
     SPI.begin();
     
     digitalWrite(PIN_PWR_EN, HIGH);
@@ -280,8 +432,68 @@ void Display102::writeCommand(unsigned char command)
     digitalWrite(PIN_CS, HIGH);
 }
 
+void Display102::writeBuffer(const uint8_t *data, size_t length, bool invert)
+{
+    // One burst per call: DC/CS set once instead of per byte
+    unsigned long start = micros();
+    digitalWrite(PIN_DC, HIGH);
+    digitalWrite(PIN_CS, LOW);
+    
+    if (!invert) {
+        SPI.writeBytes(data, length);
+    } else {
+        // data is never _spiChunk here - callers stage into it only for plain writes
+        while (length > 0) {
+            size_t n = length < sizeof(_spiChunk) ? length : sizeof(_spiChunk);
+            for (size_t i = 0; i < n; i++) {
+                _spiChunk[i] = ~data[i];
+            }
+            SPI.writeBytes(_spiChunk, n);
+            data += n;
+            length -= n;
+        }
+    }
+    
+    digitalWrite(PIN_CS, HIGH);
+    _uploadMicros += micros() - start;
+}
+
+void Display102::writeFill(uint8_t value, size_t length)
+{
+    memset(_spiChunk, value, length < sizeof(_spiChunk) ? length : sizeof(_spiChunk));
+    
+    unsigned long start = micros();
+    digitalWrite(PIN_DC, HIGH);
+    digitalWrite(PIN_CS, LOW);
+    while (length > 0) {
+        size_t n = length < sizeof(_spiChunk) ? length : sizeof(_spiChunk);
+        SPI.writeBytes(_spiChunk, n);
+        length -= n;
+    }
+    digitalWrite(PIN_CS, HIGH);
+    _uploadMicros += micros() - start;
+}
+
+void Display102::logUploadRate()
+{
+    uint32_t bytesPerSec = _uploadMicros > 0 ? (uint32_t)((uint64_t)_uploadBytes * 1000000ULL / _uploadMicros) : 0;
+    LOGD("Display102: uploaded " + String(_uploadBytes) + " bytes in " + String(_uploadMicros) + 
+         "us (" + String(bytesPerSec) + " B/s @ " + String(_spiFrequency / 1000000) + " MHz)");
+    _uploadBytes = 0;
+    _uploadMicros = 0;
+}
+
+void Display102::logFrameStats()
+{
+    logUploadRate();
+    LOGD("Display102: frame rendered in " + String(_pages) + " pages, " + String(millis() - _frameStart) + 
+         "ms, min free heap " + String(_minFreeHeap) + " (buffer " + String(_bufferSize) + " bytes)");
+    LOGD("Display102: primitives drawn " + String(_primitivesDrawn) + ", culled " + String(_primitivesCulled));
+}
+
 void Display102::waitBusy()
 {
+    PROFILE_SCOPE(PROFILE_WAIT_BUSY);
     // Note: GDEM102T91 uses HIGH = busy (opposite of 7.5")
     const unsigned long timeout = 30000; // 30 second timeout
     unsigned long start = millis();
@@ -320,6 +532,82 @@ bool Display102::canLightSleep()
     return WiFi.getMode() == WIFI_OFF;
 }
 
+void IRAM_ATTR Display102::busyISR(void *arg)
+{
+    Display102 *display = (Display102 *)arg;
+    BaseType_t woken = pdFALSE;
+    display->_refreshComplete = true;
+    xSemaphoreGiveFromISR(display->_refreshDone, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void Display102::startRefresh()
+{
+    if (_refreshDone == nullptr) {
+        _refreshDone = xSemaphoreCreateBinary();
+    }
+    if (_refreshDone == nullptr) {
+        LOGD("Display102: No semaphore for async refresh, waiting");
+        writeCommand(0x20);
+        waitBusy();
+        return;
+    }
+    
+    // BUSY is low until 0x20 raises it, so the falling edge marks the end
+    _refreshComplete = false;
+    _refreshing = true;
+    _refreshStart = millis();
+    attachInterruptArg(PIN_BUSY, busyISR, this, FALLING);
+    writeCommand(0x20);  // Activate Display Update Sequence
+    LOGD("Display102: Refresh started in background");
+}
+
+bool Display102::waitRefresh(uint32_t timeoutMs)
+{
+    if (!_refreshing) {
+        return true;
+    }
+    PROFILE_SCOPE(PROFILE_WAIT_BUSY);
+    
+    bool completed;
+    if (canLightSleep()) {
+        // Radio is off - light sleep until BUSY drops instead of blocking on
+        // the semaphore. The level wakeup replaces the edge interrupt.
+        detachInterrupt(PIN_BUSY);
+        xSemaphoreTake(_refreshDone, 0);  // Drop an edge that already fired
+        while (digitalRead(PIN_BUSY) == 1 && millis() - _refreshStart < timeoutMs) {
+            gpio_wakeup_enable((gpio_num_t)PIN_BUSY, GPIO_INTR_LOW_LEVEL);
+            esp_sleep_enable_gpio_wakeup();
+            esp_light_sleep_start();
+            gpio_wakeup_disable((gpio_num_t)PIN_BUSY);
+        }
+        completed = digitalRead(PIN_BUSY) == 0;
+    } else {
+        unsigned long elapsed = millis() - _refreshStart;
+        uint32_t remaining = elapsed < timeoutMs ? timeoutMs - elapsed : 0;
+        completed = xSemaphoreTake(_refreshDone, pdMS_TO_TICKS(remaining)) == pdTRUE;
+        if (!completed && digitalRead(PIN_BUSY) == 0) {
+            completed = true;  // Edge missed, but the panel is idle
+        }
+        detachInterrupt(PIN_BUSY);
+    }
+    _refreshing = false;
+    
+    if (completed) {
+        LOGD("Display102: Refresh finished after " + String(millis() - _refreshStart) + "ms");
+    } else {
+        LOGD("Display102::waitRefresh - TIMEOUT after " + String(timeoutMs) + "ms! BUSY pin stuck HIGH");
+    }
+    
+    if (_powerOffPending) {
+        _powerOffPending = false;
+        powerOff();
+    }
+    return completed;
+}
+
 // ============================================================================
 // Paging
 // ============================================================================
@@ -327,9 +615,24 @@ bool Display102::canLightSleep()
 void Display102::firstPage()
 {
     currentPage = 0;
-    
+    updateView();
+    _frameStart = millis();
+    _minFreeHeap = ESP.getFreeHeap();
+    _primitivesDrawn = 0;
+    _primitivesCulled = 0;
+    PROFILE_PAGE_BEGIN();
+    
+    _diffFrame = _diffRefresh && _refreshPolicy.beginFrame(rtcTilesValid) == REFRESH_FAST;
+    _refreshMode = _diffFrame || _fastUpdate ? REFRESH_FAST : REFRESH_FULL;
+    memset(_changedTiles, 0, sizeof(_changedTiles));
+    _changedTileCount = 0;
+    
+    waitUpload();
     if (frameBuffer != nullptr) {
-        memset(frameBuffer, 0xFF, EPD102_ARRAY);
+        memset(frameBuffer, 0xFF, _bufferSize);
+    }
+    if (_backBuffer != nullptr) {
+        memset(_backBuffer, 0xFF, _pageBytes);
     }
 }
 
@@ -341,56 +644,231 @@ bool Display102::nextPage()
     }
     
     LOGD("Display102::nextPage - Page " + String(currentPage));
+    PROFILE_PAGE_END(currentPage);
+    
+    bool isLastPage = (currentPage == _pages - 1);
+    
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < _minFreeHeap) _minFreeHeap = freeHeap;
+    
+    if (_backBuffer != nullptr) {
+        // Hand this band to the upload task and draw the next page into the
+        // other one, which the task cleared after its previous upload
+        waitUpload();
+        _uploadBuffer = frameBuffer;
+        _uploadPage = currentPage;
+        _uploadPending = true;
+        xSemaphoreGive(_uploadStart);
+        frameBuffer = _backBuffer;
+        _backBuffer = _uploadBuffer;
+        if (isLastPage) {
+            waitUpload();
+        }
+    } else {
+        uploadPage(frameBuffer, currentPage);
+        memset(frameBuffer, 0xFF, _pageBytes);
+    }
+    
+    if (isLastPage && _diffRefresh) {
+        finishDiffFrame();
+    }
+    if (isLastPage && _diffFrame && _changedTileCount == 0) {
+        logFrameStats();
+        LOGD("Display102: No tile changed, refresh skipped");
+    } else if (isLastPage) {
+        logFrameStats();
+        if (_diffFrame && _refreshMode == REFRESH_FULL) {
+            // Promoted by the policy after the upload - RAM 0x24 already holds
+            // the whole frame, only the border waveform needs restoring
+            writeCommand(0x3C);  // BorderWaveform
+            writeData(0x01);     // LUT1, for white
+        }
+        writeCommand(0x22);  // Display Update Control
+        writeData(_refreshMode == REFRESH_FAST ? 0xFF : 0xF7);  // Partial update mode / Full update mode with LUT
+        if (_asyncRefresh) {
+            startRefresh();
+        } else {
+            writeCommand(0x20);  // Activate Display Update Sequence
+            waitBusy();
+        }
+    }
+    
+    currentPage++;
+    updateView();
+    PROFILE_PAGE_BEGIN();
+    return currentPage < _pages;
+}
+
+void Display102::uploadPage(const uint8_t *buffer, int page)
+{
+    PROFILE_SCOPE(PROFILE_UPLOAD);
     
-    bool isFirstPage = (currentPage == 0);
-    bool isLastPage = (currentPage == EPD102_PAGES - 1);
+    if (_diffRefresh) {
+        hashPageTiles(buffer, page);
+    }
     
-    if (_fastUpdate) {
+    if (_fastUpdate || _diffFrame) {
         // Partial/fast update mode
-        if (isFirstPage) {
+        if (page == 0) {
             writeCommand(0x3C);  // BorderWaveform
             writeData(0x80);     // 0x80 for partial refresh
         }
         
         // Write data to RAM 0x24
         writeCommand(0x24);
-        for (int i = 0; i < EPD102_ARRAY; i++) {
-            writeData(frameBuffer[i]);
-        }
+        writePage(buffer, page, PLANE_NEW);
         
-        // Write inverted data to RAM 0x26 (for partial refresh)
+        // Write inverted data to RAM 0x26 (for partial refresh) - in a
+        // differential frame only for changed tiles, the rest stays put
         writeCommand(0x26);
-        for (int i = 0; i < EPD102_ARRAY; i++) {
-            writeData(~frameBuffer[i]);
-        }
-        
-        memset(frameBuffer, 0xFF, EPD102_ARRAY);
-        
-        if (isLastPage) {
-            writeCommand(0x22);  // Display Update Control
-            writeData(0xFF);     // Partial update mode
-            writeCommand(0x20);  // Activate Display Update Sequence
-            waitBusy();
-        }
+        writePage(buffer, page, _diffFrame ? PLANE_DIFF : PLANE_INVERTED);
+        _uploadBytes += 2 * _pageBytes;
     } else {
         // Full refresh mode - simple: just write to RAM 0x24
         writeCommand(0x24);
-        for (int i = 0; i < EPD102_ARRAY; i++) {
-            writeData(frameBuffer[i]);
+        writePage(buffer, page, PLANE_NEW);
+        _uploadBytes += _pageBytes;
+    }
+}
+
+void Display102::writePage(const uint8_t *buffer, int page, UploadPlane_t plane)
+{
+#if EPD102_PORTRAIT_NATIVE
+    writeNativeRows(buffer, page, page * _pageRows, (page + 1) * _pageRows - 1, 0, EPD102_ROW_BYTES, plane);
+#else
+    if (plane != PLANE_DIFF) {
+        writeBuffer(buffer, _pageBytes, plane == PLANE_INVERTED);
+        return;
+    }
+    
+    // Changed tiles inverted, staged 8 rows at a time
+    int firstRow = page * _pageRows;
+    for (int row = 0; row < _pageRows; row += 8) {
+        for (int r = 0; r < 8; r++) {
+            const uint8_t *src = &buffer[(row + r) * EPD102_ROW_BYTES];
+            uint8_t *dst = &_spiChunk[r * EPD102_ROW_BYTES];
+            for (int col = 0; col < EPD102_ROW_BYTES; col++) {
+                dst[col] = src[col] ^ planeFlip(plane, firstRow + row + r, col);
+            }
         }
-        
-        memset(frameBuffer, 0xFF, EPD102_ARRAY);
-        
-        if (isLastPage) {
-            writeCommand(0x22);  // Display Update Control
-            writeData(0xF7);     // Full update mode with LUT
-            writeCommand(0x20);  // Activate Display Update Sequence
-            waitBusy();
+        writeBuffer(_spiChunk, sizeof(_spiChunk));
+    }
+#endif
+}
+
+uint8_t Display102::planeFlip(UploadPlane_t plane, int physY, int col)
+{
+    if (plane == PLANE_INVERTED) return 0xFF;
+    if (plane == PLANE_NEW) return 0x00;
+    return (_changedTiles[physY / EPD102_TILE_ROWS] >> (col / EPD102_TILE_COL_BYTES)) & 1 ? 0xFF : 0x00;
+}
+
+void Display102::uploadTaskMain(void *arg)
+{
+    Display102 *display = (Display102 *)arg;
+    while (true) {
+        xSemaphoreTake(display->_uploadStart, portMAX_DELAY);
+        uint8_t *buffer = display->_uploadBuffer;
+        if (buffer == nullptr) {
+            LOGD("Display102: Upload task stack high water mark " + String(uxTaskGetStackHighWaterMark(nullptr)) +
+                 " of " + String(EPD102_UPLOAD_STACK) + " bytes");
+            xSemaphoreGive(display->_uploadDone);
+            vTaskDelete(nullptr);
+            return;
+        }
+        display->uploadPage(buffer, display->_uploadPage);
+        memset(buffer, 0xFF, display->_pageBytes);
+        xSemaphoreGive(display->_uploadDone);
+    }
+}
+
+void Display102::waitUpload()
+{
+    if (_uploadPending) {
+        xSemaphoreTake(_uploadDone, portMAX_DELAY);
+        _uploadPending = false;
+    }
+}
+
+// ============================================================================
+// Differential Refresh
+// ============================================================================
+
+// FNV-1a over a rectangular byte region of the page buffer
+static uint32_t hashRegion(const uint8_t *buffer, int stride, int row, int rows, int byte, int bytes)
+{
+    uint32_t hash = 2166136261u;
+    for (int r = row; r < row + rows; r++) {
+        const uint8_t *p = &buffer[r * stride + byte];
+        for (int b = 0; b < bytes; b++) {
+            hash = (hash ^ p[b]) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+void Display102::hashPageTiles(const uint8_t *buffer, int page)
+{
+    BufferView_t view = bufferView(page);
+    
+    // Tiles are in physical coordinates; pages always hold whole tile rows
+    for (int tileRow = page * _pageRows / EPD102_TILE_ROWS; tileRow < (page + 1) * _pageRows / EPD102_TILE_ROWS; tileRow++) {
+        for (int tileCol = 0; tileCol < EPD102_TILE_GRID_COLS; tileCol++) {
+#if EPD102_PORTRAIT_NATIVE
+            // Physical rows are portrait columns (reversed), physical columns portrait rows
+            int xStart = EPD102_HEIGHT - (tileRow + 1) * EPD102_TILE_ROWS;
+            uint32_t hash = hashRegion(buffer, view.stride,
+                tileCol * EPD102_TILE_COL_BYTES * 8 - view.firstRow, EPD102_TILE_COL_BYTES * 8,
+                (xStart - view.bitOrigin) / 8, EPD102_TILE_ROWS / 8);
+#else
+            uint32_t hash = hashRegion(buffer, view.stride,
+                tileRow * EPD102_TILE_ROWS - view.firstRow, EPD102_TILE_ROWS,
+                tileCol * EPD102_TILE_COL_BYTES, EPD102_TILE_COL_BYTES);
+#endif
+            int index = tileRow * EPD102_TILE_GRID_COLS + tileCol;
+            bool dirty = (rtcDirtyTiles[tileRow] >> tileCol) & 1;
+            if (hash != rtcTileHashes[index] || dirty) {
+                _changedTiles[tileRow] |= 1 << tileCol;
+                _changedTileCount++;
+                rtcTileHashes[index] = hash;
+            }
+        }
+        rtcDirtyTiles[tileRow] = 0;
+    }
+}
+
+void Display102::finishDiffFrame()
+{
+    if (_diffFrame) {
+        LOGD("Display102: Differential frame, " + String(_changedTileCount) + " of " + String(EPD102_TILE_COUNT) + " tiles changed");
+        // Tile granularity overestimates the changed pixels, which errs towards full refreshes
+        _refreshMode = _refreshPolicy.endFrame(REFRESH_FAST, _changedTileCount * EPD102_TILE_PIXELS);
+    } else {
+        _refreshPolicy.endFrame(REFRESH_FULL, 0);
+        LOGD("Display102: Full refresh, tile hashes stored");
+    }
+    rtcTilesValid = true;
+}
+
+void Display102::invalidateTiles()
+{
+    rtcTilesValid = false;
+}
+
+void Display102::invalidateTiles(int x, int y, int w, int h)
+{
+    // Same rotation as the frame: physical rows from x, physical columns from y
+    int physYStart = max(EPD102_HEIGHT - x - w, 0);
+    int physYEnd = min(EPD102_HEIGHT - x, EPD102_HEIGHT) - 1;
+    int colStart = max(y, 0) / 8;
+    int colEnd = (min(y + h, EPD102_WIDTH) - 1) / 8;
+    if (physYStart > physYEnd || colStart > colEnd) return;
+    
+    for (int tileRow = physYStart / EPD102_TILE_ROWS; tileRow <= physYEnd / EPD102_TILE_ROWS; tileRow++) {
+        for (int tileCol = colStart / EPD102_TILE_COL_BYTES; tileCol <= colEnd / EPD102_TILE_COL_BYTES; tileCol++) {
+            rtcDirtyTiles[tileRow] |= 1 << tileCol;
         }
     }
-    
-    currentPage++;
-    return currentPage < EPD102_PAGES;
 }
 
 // ============================================================================
@@ -410,181 +888,813 @@ void Display102::setPopupMode(bool enabled, int x, int y, int w, int h)
     } else {
         LOGD("Display102::setPopupMode - Disabled");
     }
+    updateView();
 }
 
-// ============================================================================
-// Pixel Drawing with Dithering
-// ============================================================================
+void Display102::beginPopupSurface(int x, int y, int w, int h)
+{
+    _surfaceArea = {x, y, w, h};
+    _surfaceWindowCount = 0;
+    _surfaceWindow = -1;
+    LOGD("Display102::beginPopupSurface - area x=" + String(x) + " y=" + String(y) + " w=" + String(w) + " h=" + String(h));
+}
 
-void Display102::drawPixel(int16_t x, int16_t y, uint16_t color)
+bool Display102::addPopupWindow(int x, int y, int w, int h)
 {
-    if (frameBuffer == nullptr) return;
-    if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+    // Clipped to the surface; the rest of the area stays blank
+    int x0 = max(x, _surfaceArea.x), y0 = max(y, _surfaceArea.y);
+    int x1 = min(x + w, _surfaceArea.x + _surfaceArea.w);
+    int y1 = min(y + h, _surfaceArea.y + _surfaceArea.h);
+    if (x0 >= x1 || y0 >= y1) return false;
+    if (_surfaceWindowCount == EPD102_POPUP_WINDOWS) {
+        LOGD("Display102::addPopupWindow - Surface full, window dropped");
+        return false;
+    }
+    _surfaceWindows[_surfaceWindowCount++] = {x0, y0, x1 - x0, y1 - y0};
+    return true;
+}
+
+bool Display102::firstPopupWindow()
+{
+    if (_surfaceWindowCount == 0) return false;
     
-    // Map color with dithering
-    // Note: COLOR_RED (0xF800) needs special handling as it's > LIGHTGREY numerically
-    bool isOddColumn = x % 2;
-    bool isOddLine = y % 2;
-    
-    if (color == COLOR_RED) {
-        // Red: 75% black pattern (3 black, 1 white)
-        color = (isOddColumn && isOddLine) ? 1 : 0;
-    } else if (color < GxEPD_VERYDARK) {
-        color = 0;  // Black
-    } else if (color < GxEPD_DARKGREY) {
-        // Very dark grey: 3 black pixels, 1 white = 75% black
-        color = (isOddColumn && isOddLine) ? 1 : 0;
-    } else if (color < GxEPD_LIGHTGREY) {
-        color = (isOddColumn != isOddLine) ? 1 : 0;  // Dark grey checkerboard (50%)
-    } else if (color < GxEPD_WHITE) {
-        color = (isOddColumn || isOddLine) ? 1 : 0;  // Light grey (25% black)
-    } else {
-        color = 1;  // White
+    _surfaceWindow = 0;
+    setPopupMode(true, _surfaceWindows[0].x, _surfaceWindows[0].y, _surfaceWindows[0].w, _surfaceWindows[0].h);
+    beginDraw();
+    if (frameBuffer == nullptr) {
+        // Leave the panel alone rather than refresh a blank surface
+        _surfaceWindow = -1;
+        return false;
     }
     
-    // Rotate 90° CCW for portrait mode:
-    // Portrait (x,y) -> Physical (y, HEIGHT-1-x)
-    // where HEIGHT = 640 (EPD102_HEIGHT)
-    int16_t physX = y;
-    int16_t physY = EPD102_HEIGHT - 1 - x;
+    // One panel session for the whole surface: the blank area first, the
+    // windows overwrite their part of RAM as they are finished
+    invalidateTiles(_surfaceArea.x, _surfaceArea.y, _surfaceArea.w, _surfaceArea.h);
+    beginWindowSession();
+    writeWindow(_surfaceArea.x, _surfaceArea.y, _surfaceArea.w, _surfaceArea.h, true);
+    return true;
+}
+
+bool Display102::nextPopupWindow()
+{
+    if (_surfaceWindow < 0) return false;
     
-    uint32_t i;
+    const Rectangle_t &done = _surfaceWindows[_surfaceWindow];
+    if (frameBuffer != nullptr) {
+        writeWindow(done.x, done.y, done.w, done.h, false);
+        free(frameBuffer);
+        frameBuffer = nullptr;
+        _bufferSize = 0;
+    }
     
-    if (_popupMode) {
-        // In popup mode, buffer stores only popup window data
-        // Convert physical coords to popup-relative coords
-        // Popup physical area:
-        // phys_x_start = _popupY (aligned to 8)
-        // phys_y_start = EPD102_HEIGHT - _popupX - _popupW
-        int phys_popup_x_start = (_popupY / 8) * 8;
-        int phys_popup_y_start = EPD102_HEIGHT - _popupX - _popupW;
-        int phys_popup_x_end = ((_popupY + _popupH + 7) / 8) * 8 - 1;
-        int phys_popup_bytes_per_row = (phys_popup_x_end - phys_popup_x_start + 1) / 8;
-        
-        // Check if this pixel is within popup window
-        if (physX < phys_popup_x_start || physX > phys_popup_x_end ||
-            physY < phys_popup_y_start || physY >= phys_popup_y_start + _popupW) {
-            return;  // Outside popup window
+    // Next window into a buffer of its own size; one that can't be allocated
+    // is left blank
+    while (++_surfaceWindow < _surfaceWindowCount) {
+        const Rectangle_t &window = _surfaceWindows[_surfaceWindow];
+        setPopupMode(true, window.x, window.y, window.w, window.h);
+        if (allocateFrameBuffer()) {
+            memset(frameBuffer, 0xFF, _bufferSize);
+            return true;
         }
-        
-        // Calculate buffer index relative to popup window
-        int rel_x_byte = (physX - phys_popup_x_start) / 8;
-        int rel_y = physY - phys_popup_y_start;
-        i = rel_x_byte + rel_y * phys_popup_bytes_per_row;
-        
-        // Adjust bit position within byte
-        int bit_in_byte = 7 - ((physX - phys_popup_x_start) % 8);
-        
-        if (i >= EPD102_ARRAY) return;  // Safety check
-        
-        if (color) {
-            frameBuffer[i] |= (1 << bit_in_byte);
-        } else {
-            frameBuffer[i] &= ~(1 << bit_in_byte);
-        }
-        return;
+        LOGD("Display102::nextPopupWindow - No buffer for window " + String(_surfaceWindow));
     }
     
-    // Normal paging mode
-    // Calculate buffer position using physical coordinates
-    i = (physX + physY * EPD102_WIDTH) / EPD102_PIXEL_PER_BYTE;
-    i -= currentPage * EPD102_ARRAY;
-    
-    // Check if within current page
-    if (i >= EPD102_ARRAY) return;
-    
-    // Set or clear bit
-    if (color) {
-        frameBuffer[i] |= (1 << (7 - physX % 8));
-    } else {
-        frameBuffer[i] &= ~(1 << (7 - physX % 8));
-    }
+    _surfaceWindow = -1;
+    logUploadRate();
+    refreshWindows((uint32_t)_surfaceArea.w * _surfaceArea.h);
+    return false;
 }
 
 // ============================================================================
-// Graphics Primitives
+// Display List
 // ============================================================================
 
-void Display102::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+bool Display102::beginRecording()
 {
-    for (int16_t py = y; py < y + h; py++) {
-        for (int16_t px = x; px < x + w; px++) {
-            drawPixel(px, py, color);
-        }
+    // Replay saves layout time per page; an extra page costs more than that
+    uint32_t maxAlloc = ESP.getMaxAllocHeap();
+    if (!_popupMode && maxAlloc > DisplayList::HEAP_BYTES &&
+        pagesFor(maxAlloc - DisplayList::HEAP_BYTES) > pagesFor(maxAlloc)) {
+        LOGD("Display102: Display list would add pages, drawing per page");
+        return false;
+    }
+    if (!_list.begin()) {
+        return false;
     }
+    _recording = true;
+    return true;
 }
 
-void Display102::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+bool Display102::endRecording()
 {
-    Adafruit_GFX::fillCircle(x0, y0, r, mapColor(color));
+    _recording = false;
+    if (_list.hasOverflowed()) {
+        LOGD("Display102::endRecording - Display list overflowed, drawing directly");
+        _list.end();
+        return false;
+    }
+    LOGD("Display102::endRecording - " + String(_list.size()) + " commands recorded");
+    return true;
 }
 
-void Display102::fillRectRounded(int x, int y, int w, int h, int cornerRadius, int color)
+bool Display102::intersectsPage(int x, int y, int w, int h)
 {
-    if (cornerRadius == 0) {
-        fillRect(x, y, w, h, color);
-        return;
+    if (w <= 0 || h <= 0) return false;
+    if (x + w <= 0 || x >= width() || y + h <= 0 || y >= height()) return false;
+    if (_popupMode) {
+        return x < _popupX + _popupW && x + w > _popupX && y < _popupY + _popupH && y + h > _popupY;
     }
-    fillRect(x, y + cornerRadius, w + 1, h - 2 * cornerRadius, color);
-    fillRect(x + cornerRadius, y, w - 2 * cornerRadius + 2, h + 1, color);
-    fillCircle(x + cornerRadius, y + cornerRadius, cornerRadius, color);
-    fillCircle(x + w - cornerRadius, y + cornerRadius, cornerRadius, color);
-    fillCircle(x + cornerRadius, y + h - cornerRadius, cornerRadius, color);
-    fillCircle(x + w - cornerRadius, y + h - cornerRadius, cornerRadius, color);
+    
+    // A page is a band of physical rows = a band of portrait columns
+    // (physY = EPD102_HEIGHT - 1 - x)
+    int pageX0 = EPD102_HEIGHT - getPageRowEnd();
+    int pageX1 = EPD102_HEIGHT - 1 - getPageRowStart();
+    return x <= pageX1 && x + w > pageX0;
 }
 
-void Display102::invertRect(int x, int y, int w, int h)
+bool Display102::cullPrimitive(int x, int y, int w, int h)
 {
-    for (int py = y; py < y + h; py++) {
-        for (int px = x; px < x + w; px++) {
-            if (px < 0 || px >= width() || py < 0 || py >= height()) continue;
-            
-            // Same rotation as drawPixel: 90° CCW
-            int16_t physX = py;
-            int16_t physY = EPD102_HEIGHT - 1 - px;
-            
-            uint32_t i = (physX + physY * EPD102_WIDTH) / EPD102_PIXEL_PER_BYTE;
-            i -= currentPage * EPD102_ARRAY;
-            
-            if (i < EPD102_ARRAY) {
-                int bit = 7 - physX % 8;
-                frameBuffer[i] ^= (1 << bit);
-            }
+    bool visible = intersectsPage(x, y, w, h);
+    if (_nestedDraw == 0) {
+        if (visible) {
+            _primitivesDrawn++;
+        } else {
+            _primitivesCulled++;
         }
     }
+    return !visible;
 }
 
-void Display102::drawCatmullRomCurve(int x[], int y[], int n, int thickness, int color)
+void Display102::replay()
 {
-    if (n < 2) return;
+    if (!hasRecording()) return;
     
-    float step = 0.01f;
+#if PROFILING
+    // Charge replay time to the section each primitive was recorded in
+    ProfileSection_t section = PROFILE_OTHER;
+    uint32_t sectionStart = Profiler::now();
+#endif
+    
+    // Every primitive culls itself against the page band
+    for (int i = 0; i < _list.size(); i++) {
+        const DrawCommand_t &cmd = _list.at(i);
+        
+#if PROFILING
+        if (cmd.section != section) {
+            uint32_t now = Profiler::now();
+            Profiler::add(section, now - sectionStart);
+            section = cmd.section;
+            sectionStart = now;
+        }
+#endif
+        switch (cmd.type) {
+            case CMD_PIXEL:
+                drawPixel(cmd.x, cmd.y, cmd.color);
+                break;
+            case CMD_FILL_RECT:
+                fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color);
+                break;
+            case CMD_FILL_CIRCLE:
+                fillCircleMapped(cmd.x, cmd.y, cmd.w, cmd.color);
+                break;
+            case CMD_INVERT_RECT:
+                invertRect(cmd.x, cmd.y, cmd.w, cmd.h);
+                break;
+            case CMD_COPY_RECT:
+                copyRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.boundsX, cmd.boundsY);
+                break;
+            case CMD_TEXT:
+                printText((const GFXfont *)cmd.data, (const char *)cmd.pooled, cmd.x, cmd.y,
+                    cmd.boundsX - cmd.x, cmd.boundsY - cmd.y, cmd.boundsW, cmd.boundsH, cmd.color);
+                break;
+            case CMD_BLIT:
+                blit((const Bitmap_t *)cmd.data, cmd.x, cmd.y, cmd.arg, (BlitOp_t)cmd.w, cmd.color);
+                break;
+            case CMD_IMAGE:
+                drawImage((const uint8_t *)cmd.data, cmd.x, cmd.y, cmd.w, cmd.h, LEADING, LEADING, 0);
+                break;
+            case CMD_CURVE: {
+                const int16_t *points = (const int16_t *)cmd.pooled;
+                int xs[DISPLAY_LIST_MAX_CURVE_POINTS], ys[DISPLAY_LIST_MAX_CURVE_POINTS];
+                for (int p = 0; p < cmd.w; p++) {
+                    xs[p] = points[2 * p];
+                    ys[p] = points[2 * p + 1];
+                }
+                drawCatmullRomCurve(xs, ys, cmd.w, cmd.arg, cmd.color);
+            } break;
+        }
+    }
+    
+#if PROFILING
+    Profiler::add(section, Profiler::now() - sectionStart);
+#endif
+}
+
+// ============================================================================
+// Pixel Drawing with Dithering
+// ============================================================================
+
+// Greyscale tones of the 2x2 ordered dither
+typedef enum : uint8_t {
+    DITHER_BLACK,
+    DITHER_VERYDARK,   // 75% black, also used for RED
+    DITHER_DARKGREY,   // 50% checkerboard
+    DITHER_LIGHTGREY,  // 25% black
+    DITHER_WHITE,
+    DITHER_TONES
+} DitherTone_t;
+
+// 8-pixel pattern byte per tone and row parity (1 = white). Along a row the
+// pattern alternates with the bit position, bit 7 being an even coordinate.
+// The 2x2 patterns are symmetric in x and y, so one table serves both
+// framebuffer layouts.
+static const uint8_t DITHER_PATTERNS[DITHER_TONES][2] = {
+    {0x00, 0x00},  // Black
+    {0x00, 0x55},  // Very dark grey: white only at odd/odd
+    {0x55, 0xAA},  // Dark grey: white where parities differ
+    {0x55, 0xFF},  // Light grey: black only at even/even
+    {0xFF, 0xFF},  // White
+};
+
+// Note: COLOR_RED (0xF800) needs special handling as it's > LIGHTGREY numerically
+static inline DitherTone_t ditherTone(uint16_t color)
+{
+    if (color == COLOR_RED) return DITHER_VERYDARK;  // Red: 75% black pattern
+    if (color < GxEPD_VERYDARK) return DITHER_BLACK;
+    if (color < GxEPD_DARKGREY) return DITHER_VERYDARK;
+    if (color < GxEPD_LIGHTGREY) return DITHER_DARKGREY;
+    if (color < GxEPD_WHITE) return DITHER_LIGHTGREY;
+    return DITHER_WHITE;
+}
+
+void Display102::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_PIXEL, x, y, 1, 1);
+        if (cmd) {
+            cmd->x = x;
+            cmd->y = y;
+            cmd->color = color;
+        }
+        return;
+    }
+    if (frameBuffer == nullptr) return;
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+    
+    uint8_t mask;
+    uint8_t *p = pixelByte(x, y, mask);
+    if (p == nullptr) return;
+    
+    // Mask picks this pixel's bit out of the tone's row pattern
+    uint8_t pattern = DITHER_PATTERNS[ditherTone(color)][Geometry102_t::rowParity(Geometry102_t::row(x, y))];
+    *p = (*p & ~mask) | (pattern & mask);
+}
+
+uint8_t *Display102::pixelByte(int x, int y, uint8_t &mask)
+{
+    // Rotation (portrait: physical (y, HEIGHT-1-x)) is folded in by the geometry
+    int bit = Geometry102_t::bit(x, y) - _view.bitOrigin;
+    int row = Geometry102_t::row(x, y) - _view.firstRow;
+    // Outside the current page / popup window - one unsigned compare per axis
+    if ((unsigned)bit >= (unsigned)(_view.stride << 3) || (unsigned)row >= (unsigned)_view.rows) {
+        return nullptr;
+    }
+    mask = Geometry102_t::maskOf(bit);
+    return &frameBuffer[row * _view.stride + Geometry102_t::byteOf(bit)];
+}
+
+// ============================================================================
+// Graphics Primitives
+// ============================================================================
+
+void Display102::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_FILL_RECT, x, y, w, h);
+        if (cmd) {
+            cmd->x = x;
+            cmd->y = y;
+            cmd->w = w;
+            cmd->h = h;
+            cmd->color = color;
+        }
+        return;
+    }
+    if (cullPrimitive(x, y, w, h)) return;
+    
+    regionSpans(x, y, w, h, REGION_FILL, color);
+}
+
+// Adafruit_GFX routes lines, circles and scaled glyphs through these
+void Display102::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    writeFillRect(x, y, w, 1, color);
+}
+
+void Display102::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    writeFillRect(x, y, 1, h, color);
+}
+
+void Display102::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (_recording) {
+        fillRect(x, y, w, h, color);
+        return;
+    }
+    regionSpans(x, y, w, h, REGION_FILL, color);
+}
+
+// 8 pixels of a 1bpp line from pixel pos on, MSB first; whole bytes outside
+// the line read as 0 (pos may be negative)
+static inline uint8_t bitmapByte(const uint8_t *line, int stride, int pos)
+{
+    int byte = pos >> 3;  // Floor
+    int shift = pos & 7;
+    uint8_t high = (unsigned)byte < (unsigned)stride ? line[byte] : 0;
+    if (shift == 0) return high;
+    uint8_t low = (unsigned)(byte + 1) < (unsigned)stride ? line[byte + 1] : 0;
+    return (uint8_t)(high << shift) | (low >> (8 - shift));
+}
+
+// One byte of a region: edge mask m selects the pixels inside the rectangle
+static inline void regionByte(uint8_t *p, uint8_t m, bool invert, uint8_t pattern)
+{
+    *p = invert ? *p ^ m : (*p & ~m) | (pattern & m);
+}
+
+// Whole bytes of a region, as aligned 32-bit words where possible
+static inline void regionRun(uint8_t *p, int n, bool invert, uint8_t pattern)
+{
+    for (; n > 0 && ((uintptr_t)p & 3); n--, p++) {
+        regionByte(p, 0xFF, invert, pattern);
+    }
+    uint32_t word = pattern * 0x01010101u;  // Same byte in every lane
+    for (; n >= 4; n -= 4, p += 4) {
+        uint32_t *w = (uint32_t *)p;
+        *w = invert ? ~*w : word;
+    }
+    for (; n > 0; n--, p++) {
+        regionByte(p, 0xFF, invert, pattern);
+    }
+}
+
+void Display102::regionSpans(int x, int y, int w, int h, RegionOp_t op, uint16_t color, int fromX, int fromY)
+{
+    if (frameBuffer == nullptr) return;
+    
+    // Clip to the virtual screen, also the source of a copy
+    int dx = fromX - x;
+    int dy = fromY - y;
+    int x0 = max(x, 0), y0 = max(y, 0);
+    int x1 = min(x + w, (int)width()), y1 = min(y + h, (int)height());
+    if (op == REGION_COPY) {
+        x0 = max(x0, -dx);
+        y0 = max(y0, -dy);
+        x1 = min(x1, (int)width() - dx);
+        y1 = min(y1, (int)height() - dy);
+    }
+    if (x0 >= x1 || y0 >= y1) return;
+    w = x1 - x0;
+    h = y1 - y0;
+    
+    // Portrait columns become physical rows, portrait rows physical columns
+    BufferView_t view = bufferView();
+    int bitEnd = view.bitOrigin + view.stride * 8;
+    int rowEnd = view.firstRow + view.rows;
+    int bit0 = max(Geometry102_t::bitStart(x0, y0, w, h), view.bitOrigin);
+    int bit1 = min(Geometry102_t::bitEnd(x0, y0, w, h), bitEnd);  // Exclusive
+    int row0 = max(Geometry102_t::rowStart(x0, y0, w, h), view.firstRow);
+    int row1 = min(Geometry102_t::rowEnd(x0, y0, w, h), rowEnd);
+    
+    // A copy source row/bit is a fixed offset away and has to be buffered too
+    int rowDelta = Geometry102_t::row(x0 + dx, y0 + dy) - Geometry102_t::row(x0, y0);
+    int bitDelta = Geometry102_t::bit(x0 + dx, y0 + dy) - Geometry102_t::bit(x0, y0);
+    if (op == REGION_COPY) {
+        bit0 = max(bit0, view.bitOrigin - bitDelta);
+        bit1 = min(bit1, bitEnd - bitDelta);
+        row0 = max(row0, view.firstRow - rowDelta);
+        row1 = min(row1, rowEnd - rowDelta);
+    }
+    bit0 -= view.bitOrigin;
+    bit1 -= view.bitOrigin;
+    if (bit0 >= bit1 || row0 >= row1) return;
+    
+    int byte0 = bit0 / 8;
+    int byte1 = (bit1 - 1) / 8;
+    uint8_t firstMask = 0xFF >> (bit0 % 8);
+    uint8_t lastMask = 0xFF << (7 - (bit1 - 1) % 8);
+    if (byte0 == byte1) {
+        firstMask &= lastMask;
+    }
+    
+    if (op == REGION_COPY) {
+        // Rows in the order that reads every source row before it is overwritten;
+        // within a row the source bits are gathered first, so overlap is fine
+        uint8_t source[Geometry102_t::ROW_BYTES];
+        int step = rowDelta < 0 ? -1 : 1;
+        int first = step > 0 ? row0 : row1 - 1;
+        for (int r = first; r >= row0 && r < row1; r += step) {
+            const uint8_t *from = frameBuffer + (r + rowDelta - view.firstRow) * view.stride;
+            uint8_t *row = frameBuffer + (r - view.firstRow) * view.stride;
+            for (int b = byte0; b <= byte1; b++) {
+                source[b - byte0] = bitmapByte(from, view.stride, b * 8 + bitDelta);
+            }
+            row[byte0] = (row[byte0] & ~firstMask) | (source[0] & firstMask);
+            if (byte1 > byte0) {
+                memcpy(row + byte0 + 1, source + 1, byte1 - byte0 - 1);
+                row[byte1] = (row[byte1] & ~lastMask) | (source[byte1 - byte0] & lastMask);
+            }
+        }
+        return;
+    }
+    
+    // One tone lookup per region; row parity only picks one of two patterns
+    bool invert = op == REGION_INVERT;
+    const uint8_t *patterns = DITHER_PATTERNS[ditherTone(color)];
+    
+    for (int r = row0; r < row1; r++) {
+        uint8_t pattern = patterns[Geometry102_t::rowParity(r)];
+        uint8_t *row = frameBuffer + (r - view.firstRow) * view.stride;
+        
+        regionByte(row + byte0, firstMask, invert, pattern);
+        if (byte1 > byte0) {
+            regionRun(row + byte0 + 1, byte1 - byte0 - 1, invert, pattern);
+            regionByte(row + byte1, lastMask, invert, pattern);
+        }
+    }
+}
+
+void Display102::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_FILL_CIRCLE, x0 - r, y0 - r, 2 * r + 1, 2 * r + 1);
+        if (cmd) {
+            cmd->x = x0;
+            cmd->y = y0;
+            cmd->w = r;
+            cmd->color = mapColor(color);
+        }
+        return;
+    }
+    fillCircleMapped(x0, y0, r, mapColor(color));
+}
+
+void Display102::fillCircleMapped(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    if (cullPrimitive(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1)) return;
+    Adafruit_GFX::fillCircle(x0, y0, r, color);
+}
+
+void Display102::fillRectRounded(int x, int y, int w, int h, int cornerRadius, int color)
+{
+    if (cornerRadius == 0) {
+        fillRect(x, y, w, h, color);
+        return;
+    }
+    fillRect(x, y + cornerRadius, w + 1, h - 2 * cornerRadius, color);
+    fillRect(x + cornerRadius, y, w - 2 * cornerRadius + 2, h + 1, color);
+    fillCircle(x + cornerRadius, y + cornerRadius, cornerRadius, color);
+    fillCircle(x + w - cornerRadius, y + cornerRadius, cornerRadius, color);
+    fillCircle(x + cornerRadius, y + h - cornerRadius, cornerRadius, color);
+    fillCircle(x + w - cornerRadius, y + h - cornerRadius, cornerRadius, color);
+}
+
+void Display102::invertRect(int x, int y, int w, int h)
+{
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_INVERT_RECT, x, y, w, h);
+        if (cmd) {
+            cmd->x = x;
+            cmd->y = y;
+            cmd->w = w;
+            cmd->h = h;
+        }
+        return;
+    }
+    if (cullPrimitive(x, y, w, h)) return;
+    
+    regionSpans(x, y, w, h, REGION_INVERT, 0);
+}
+
+void Display102::copyRect(int x, int y, int w, int h, int toX, int toY)
+{
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_COPY_RECT, toX, toY, w, h);
+        if (cmd) {
+            cmd->x = x;
+            cmd->y = y;
+            cmd->w = w;
+            cmd->h = h;
+        }
+        return;
+    }
+    if (cullPrimitive(toX, toY, w, h)) return;
+    
+    regionSpans(toX, toY, w, h, REGION_COPY, 0, x, y);
+}
+
+// Curves are split in 1/256 px and rasterized as polylines in CURVE_ONE units
+// per pixel; the finer split keeps the rounding of ten halvings below 1/16 px
+static const int CURVE_SPLIT_SHIFT = 4;
+static const int CURVE_ONE = 16;
+// Flatness bound of a piece - the control points' distance from the chord at
+// thirds, which keeps the piece within 1/4 px of its chord - and its longest
+// chord, which keeps the rasterizer's products within 32 bits
+static const int CURVE_FLATNESS = 11 << CURVE_SPLIT_SHIFT;
+static const int CURVE_MAX_CHORD = (64 * CURVE_ONE) << CURVE_SPLIT_SHIFT;
+static const int CURVE_MAX_DEPTH = 10;
+
+static inline int curveFixed(int value)
+{
+    return (min(max(value, -1500), 1500) * CURVE_ONE) << CURVE_SPLIT_SHIFT;
+}
+
+static inline uint32_t isqrt32(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > value) bit >>= 2;
+    while (bit) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static inline int floorDiv(int a, int b)
+{
+    int q = a / b;
+    return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+static inline int ceilDiv(int a, int b)
+{
+    return -floorDiv(-a, b);
+}
+
+// Offsets along the bit axis where line u crosses the capsule of radius r
+// around segment a-b (round caps: a disk at each end, the body between them).
+// A capsule is convex, so the crossing is one interval, the hull of the parts.
+static bool capsuleSpan(int u, int au, int av, int bu, int bv, int r, int &lo, int &hi)
+{
+    lo = INT_MAX;
+    hi = INT_MIN;
+    int pu = u - au;
+    if (abs(pu) <= r) {
+        int half = isqrt32(r * r - pu * pu);
+        lo = min(lo, av - half);
+        hi = max(hi, av + half);
+    }
+    if (abs(u - bu) <= r) {
+        int half = isqrt32(r * r - (u - bu) * (u - bu));
+        lo = min(lo, bv - half);
+        hi = max(hi, bv + half);
+    }
+    
+    int du = bu - au, dv = bv - av;
+    int length2 = du * du + dv * dv;
+    if (length2 == 0) return lo <= hi;
+    
+    // Body: pv = v - av within r of the segment's line, |pu*dv - pv*du| <= r*|d|,
+    // and projecting inside the segment, 0 <= pu*du + pv*dv <= |d|^2
+    int bodyLo = INT_MIN, bodyHi = INT_MAX;
+    int reach = r * (int)isqrt32(length2);
+    int cross = pu * dv;
+    if (du == 0) {
+        if (abs(cross) > reach) return lo <= hi;
+    } else if (du > 0) {
+        bodyLo = ceilDiv(cross - reach, du);
+        bodyHi = floorDiv(cross + reach, du);
+    } else {
+        bodyLo = ceilDiv(cross + reach, du);
+        bodyHi = floorDiv(cross - reach, du);
+    }
+    int along = pu * du;
+    if (dv == 0) {
+        if (along < 0 || along > length2) return lo <= hi;
+    } else if (dv > 0) {
+        bodyLo = max(bodyLo, ceilDiv(-along, dv));
+        bodyHi = min(bodyHi, floorDiv(length2 - along, dv));
+    } else {
+        bodyLo = max(bodyLo, ceilDiv(length2 - along, dv));
+        bodyHi = min(bodyHi, floorDiv(-along, dv));
+    }
+    if (bodyLo <= bodyHi) {
+        lo = min(lo, av + bodyLo);
+        hi = max(hi, av + bodyHi);
+    }
+    return lo <= hi;
+}
+
+void Display102::drawCatmullRomCurve(int x[], int y[], int n, int thickness, int color)
+{
+    if (n < 2) return;
+    
+    Rectangle_t bounds;
+    curveBounds(x, y, n, thickness, bounds);
+    
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_CURVE, bounds.x, bounds.y, bounds.w, bounds.h);
+        if (cmd) {
+            cmd->pooled = _list.storePoints(x, y, n);
+            cmd->w = n;
+            cmd->arg = thickness;
+            cmd->color = color;
+        }
+        return;
+    }
+    
+    if (cullPrimitive(bounds.x, bounds.y, bounds.w, bounds.h)) return;
+    
+    // Each segment as a cubic Bezier, split in half until it is flat and short;
+    // the piece end points make a polyline, rasterized whenever the buffer fills
+    int16_t points[2 * EPD102_CURVE_POINTS];
+    int count = 0;
+    int radius = max(thickness, 1) * CURVE_ONE / 2;
+    uint16_t mapped = mapColor(color);
     
     for (int i = 0; i < n - 1; i++) {
-        int p0x = (i == 0) ? x[i] : x[i - 1];
-        int p0y = (i == 0) ? y[i] : y[i - 1];
-        int p1x = x[i], p1y = y[i];
-        int p2x = x[i + 1], p2y = y[i + 1];
-        int p3x = (i + 2 < n) ? x[i + 2] : x[i + 1];
-        int p3y = (i + 2 < n) ? y[i + 2] : y[i + 1];
+        int p0x = curveFixed((i == 0) ? x[i] : x[i - 1]);
+        int p0y = curveFixed((i == 0) ? y[i] : y[i - 1]);
+        int p1x = curveFixed(x[i]), p1y = curveFixed(y[i]);
+        int p2x = curveFixed(x[i + 1]), p2y = curveFixed(y[i + 1]);
+        int p3x = curveFixed((i + 2 < n) ? x[i + 2] : x[i + 1]);
+        int p3y = curveFixed((i + 2 < n) ? y[i + 2] : y[i + 1]);
+        
+        if (count == 0) {
+            points[0] = p1x >> CURVE_SPLIT_SHIFT;
+            points[1] = p1y >> CURVE_SPLIT_SHIFT;
+            count = 1;
+        }
+        
+        // Pieces still to split, first half on top: x0 y0 .. x3 y3 and depth
+        int stack[CURVE_MAX_DEPTH + 1][9];
+        int top = 0;
+        int *c = stack[0];
+        c[0] = p1x;                     c[1] = p1y;
+        c[2] = p1x + (p2x - p0x) / 6;   c[3] = p1y + (p2y - p0y) / 6;
+        c[4] = p2x - (p3x - p1x) / 6;   c[5] = p2y - (p3y - p1y) / 6;
+        c[6] = p2x;                     c[7] = p2y;
+        c[8] = 0;
+        while (top >= 0) {
+            c = stack[top];
+            int deviation = max(max(abs(3 * c[2] - 2 * c[0] - c[6]), abs(3 * c[3] - 2 * c[1] - c[7])),
+                                max(abs(3 * c[4] - c[0] - 2 * c[6]), abs(3 * c[5] - c[1] - 2 * c[7])));
+            int chord = max(abs(c[6] - c[0]), abs(c[7] - c[1]));
+            if (c[8] == CURVE_MAX_DEPTH || (deviation <= CURVE_FLATNESS && chord <= CURVE_MAX_CHORD)) {
+                int px = (c[6] + (1 << (CURVE_SPLIT_SHIFT - 1))) >> CURVE_SPLIT_SHIFT;
+                int py = (c[7] + (1 << (CURVE_SPLIT_SHIFT - 1))) >> CURVE_SPLIT_SHIFT;
+                if (px != points[2 * count - 2] || py != points[2 * count - 1]) {
+                    if (count == EPD102_CURVE_POINTS) {
+                        fillPolyline(points, count, radius, mapped);
+                        points[0] = points[2 * count - 2];
+                        points[1] = points[2 * count - 1];
+                        count = 1;
+                    }
+                    points[2 * count] = px;
+                    points[2 * count + 1] = py;
+                    count++;
+                }
+                top--;
+                continue;
+            }
+            
+            // de Casteljau at t = 1/2: the second half replaces c, the first goes on top
+            int *first = stack[top + 1];
+            for (int axis = 0; axis < 2; axis++) {
+                int p01 = (c[axis] + c[2 + axis]) / 2;
+                int p12 = (c[2 + axis] + c[4 + axis]) / 2;
+                int p23 = (c[4 + axis] + c[6 + axis]) / 2;
+                int p012 = (p01 + p12) / 2;
+                int p123 = (p12 + p23) / 2;
+                int mid = (p012 + p123) / 2;
+                first[axis] = c[axis];
+                first[2 + axis] = p01;
+                first[4 + axis] = p012;
+                first[6 + axis] = mid;
+                c[axis] = mid;
+                c[2 + axis] = p123;
+                c[4 + axis] = p23;
+            }
+            c[8]++;
+            first[8] = c[8];
+            top++;
+        }
+    }
+    fillPolyline(points, count, radius, mapped);
+}
+
+void Display102::fillPolyline(const int16_t *points, int count, int radius, uint16_t color)
+{
+    if (frameBuffer == nullptr || count < 1) return;
+    
+    // Lines (frame buffer rows) the stroke can reach, within the current view
+    int first = INT_MAX, last = INT_MIN;
+    for (int i = 0; i < count; i++) {
+        int u = Geometry102_t::line(points[2 * i], points[2 * i + 1]);
+        first = min(first, u);
+        last = max(last, u);
+    }
+    int viewFirst = Geometry102_t::lineOf(_view.firstRow);
+    int viewLast = Geometry102_t::lineOf(_view.firstRow + _view.rows - 1);
+    first = max(ceilDiv(first - radius, CURVE_ONE), min(viewFirst, viewLast));
+    last = min(floorDiv(last + radius, CURVE_ONE), max(viewFirst, viewLast));
+    
+    // Segments by the lowest line they reach, swept into an active list that
+    // holds those reaching the current line
+    static_assert(EPD102_CURVE_POINTS <= 256, "Segment indices are bytes");
+    int segments = max(count - 1, 1);
+    uint8_t order[EPD102_CURVE_POINTS];
+    uint8_t active[EPD102_CURVE_POINTS];
+    auto segmentPoint = [&](int s, int end) { return &points[2 * min(s + end, count - 1)]; };
+    auto segmentLow = [&](int s) {
+        const int16_t *a = segmentPoint(s, 0), *b = segmentPoint(s, 1);
+        return min(Geometry102_t::line(a[0], a[1]), Geometry102_t::line(b[0], b[1])) - radius;
+    };
+    for (int s = 0; s < segments; s++) {
+        int at = s;
+        int low = segmentLow(s);
+        while (at > 0 && segmentLow(order[at - 1]) > low) {
+            order[at] = order[at - 1];
+            at--;
+        }
+        order[at] = s;
+    }
+    int next = 0, activeCount = 0;
+    
+    // Per line, the crossing of every active capsule, sorted by start and
+    // merged, so each covered pixel is written once
+    int16_t spans[2 * EPD102_CURVE_POINTS];
+    for (int line = first; line <= last; line++) {
+        int u = line * CURVE_ONE;
+        while (next < segments && segmentLow(order[next]) <= u) {
+            active[activeCount++] = order[next++];
+        }
         
-        for (float t = 0; t <= 1.0f; t += step) {
-            float t2 = t * t;
-            float t3 = t2 * t;
-            float x_pos = 0.5f * ((2 * p1x) +
-                                  (-p0x + p2x) * t +
-                                  (2 * p0x - 5 * p1x + 4 * p2x - p3x) * t2 +
-                                  (-p0x + 3 * p1x - 3 * p2x + p3x) * t3);
-            float y_pos = 0.5f * ((2 * p1y) +
-                                  (-p0y + p2y) * t +
-                                  (2 * p0y - 5 * p1y + 4 * p2y - p3y) * t2 +
-                                  (-p0y + 3 * p1y - 3 * p2y + p3y) * t3);
+        int spanCount = 0;
+        for (int k = 0; k < activeCount; ) {
+            const int16_t *a = segmentPoint(active[k], 0), *b = segmentPoint(active[k], 1);
+            int au = Geometry102_t::line(a[0], a[1]), av = Geometry102_t::bit(a[0], a[1]);
+            int bu = Geometry102_t::line(b[0], b[1]), bv = Geometry102_t::bit(b[0], b[1]);
+            if (u > max(au, bu) + radius) {
+                active[k] = active[--activeCount];
+                continue;
+            }
+            k++;
+            
+            int lo, hi;
+            if (!capsuleSpan(u, au, av, bu, bv, radius, lo, hi)) continue;
+            lo = ceilDiv(lo, CURVE_ONE);
+            hi = floorDiv(hi, CURVE_ONE);
+            if (lo > hi) continue;
             
-            fillCircle((int)(x_pos + 0.5f), (int)(y_pos + 0.5f), thickness / 2, color);
+            int at = spanCount++;
+            while (at > 0 && spans[2 * at - 2] > lo) {
+                spans[2 * at] = spans[2 * at - 2];
+                spans[2 * at + 1] = spans[2 * at - 1];
+                at--;
+            }
+            spans[2 * at] = lo;
+            spans[2 * at + 1] = hi;
+        }
+        
+        for (int i = 0; i < spanCount; ) {
+            int lo = spans[2 * i], hi = spans[2 * i + 1];
+            for (i++; i < spanCount && spans[2 * i] <= hi + 1; i++) {
+                hi = max(hi, (int)spans[2 * i + 1]);
+            }
+            if (Geometry102_t::BITS_ALONG_X) {
+                regionSpans(lo, line, hi - lo + 1, 1, REGION_FILL, color);
+            } else {
+                regionSpans(line, lo, 1, hi - lo + 1, REGION_FILL, color);
+            }
         }
     }
 }
 
+void Display102::curveBounds(int x[], int y[], int n, int thickness, Rectangle_t &bounds)
+{
+    int minX = x[0], maxX = x[0], minY = y[0], maxY = y[0];
+    for (int i = 1; i < n; i++) {
+        minX = min(minX, x[i]);
+        maxX = max(maxX, x[i]);
+        minY = min(minY, y[i]);
+        maxY = max(maxY, y[i]);
+    }
+    // Catmull-Rom can overshoot the control points a little
+    int pad = thickness / 2 + max(maxX - minX, maxY - minY) / 4 + 1;
+    bounds.x = minX - pad;
+    bounds.y = minY - pad;
+    bounds.w = maxX - minX + 2 * pad + 1;
+    bounds.h = maxY - minY + 2 * pad + 1;
+}
+
 void Display102::drawImage(const uint8_t *data, int x, int y, int w, int h,
     Alignment horizontal, Alignment vertical, int margin)
 {
@@ -599,20 +1709,224 @@ void Display102::drawImage(const uint8_t *data, int x, int y, int w, int h,
         case LEADING: y = y + margin; break;
     }
     
-    // Draw 4-bit greyscale image with dithering
-    for (int16_t j = 0; j < h; j++) {
-        for (int16_t i = 0; i < w; i++) {
-            uint8_t pixelData = pgm_read_byte(&data[j * (w / 2) + i / 2]);
-            uint8_t grey = (i % 2 == 0) ? (pixelData & 0x0F) << 4 : (pixelData & 0xF0);
-            grey |= grey >> 4;  // Expand to 8-bit
-            
-            uint16_t color;
-            if (grey < 64) color = GxEPD_BLACK;
-            else if (grey < 128) color = GxEPD_DARKGREY;
-            else if (grey < 192) color = GxEPD_LIGHTGREY;
-            else color = GxEPD_WHITE;
-            
-            drawPixel(x + i, y + j, color);
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_IMAGE, x, y, w, h);
+        if (cmd) {
+            cmd->data = data;
+            cmd->x = x;
+            cmd->y = y;
+            cmd->w = w;
+            cmd->h = h;
+        }
+        return;
+    }
+    if (cullPrimitive(x, y, w, h)) return;
+    
+    greySpans(data, x, y, w, h);
+}
+
+// ============================================================================
+// Bitmaps
+// ============================================================================
+
+void Display102::blit(const Bitmap_t *bitmap, int x, int y, int scale, BlitOp_t op, uint16_t color)
+{
+    if (bitmap == nullptr || scale < 1) return;
+    int w = bitmap->width * scale;
+    int h = bitmap->height * scale;
+    
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_BLIT, x, y, w, h);
+        if (cmd) {
+            cmd->data = bitmap;
+            cmd->arg = scale;
+            cmd->x = x;
+            cmd->y = y;
+            cmd->w = op;
+            cmd->color = color;
+        }
+        return;
+    }
+    if (cullPrimitive(x, y, w, h)) return;
+    
+    blitSpans(bitmap, x, y, scale, op, color);
+}
+
+// Level (0..3) of pixel pos in a bitmap line; 1bpp ink is full level
+static inline uint8_t bitmapLevel(const Bitmap_t *bitmap, int stride, int line, int pos)
+{
+    int bit = pos * bitmap->bpp;
+    uint8_t value = bitmap->data[line * stride + (bit >> 3)] >> (8 - bitmap->bpp - (bit & 7));
+    return bitmap->bpp == 1 ? (value & 1) * 3 : value & 3;
+}
+
+// Raster op on one frame buffer byte; levels[n] = bits whose source level is n
+// (levels[0] = background bits inside the bitmap)
+static inline void blitByte(uint8_t *p, BlitOp_t op, const uint8_t levels[4],
+    uint8_t pattern, uint8_t light, uint8_t dark)
+{
+    uint8_t ink = levels[1] | levels[2] | levels[3];
+    switch (op) {
+        case BLIT_SET:
+            *p = (*p & ~(ink | levels[0])) | (pattern & ink) | levels[0];
+            break;
+        case BLIT_CLEAR:
+            *p |= ink;
+            break;
+        case BLIT_INVERT:
+            *p ^= ink;
+            break;
+        case BLIT_TRANSPARENT:
+            *p = (*p & ~ink) | (pattern & ink);
+            break;
+        case BLIT_TONE:
+            *p = (*p & ~ink) | (light & levels[1]) | (dark & levels[2]) | (pattern & levels[3]);
+            break;
+    }
+}
+
+void Display102::blitSpans(const Bitmap_t *bitmap, int x, int y, int scale, BlitOp_t op, uint16_t color)
+{
+    if (frameBuffer == nullptr) return;
+    
+    // Clip to the virtual screen, then to the buffered rows and bits
+    int x0 = max(x, 0);
+    int y0 = max(y, 0);
+    int x1 = min(x + bitmap->width * scale, (int)width());
+    int y1 = min(y + bitmap->height * scale, (int)height());
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    BufferView_t view = bufferView();
+    int bit0 = Geometry102_t::bitStart(x0, y0, x1 - x0, y1 - y0);
+    int bit1 = Geometry102_t::bitEnd(x0, y0, x1 - x0, y1 - y0);  // Exclusive
+    int row0 = Geometry102_t::rowStart(x0, y0, x1 - x0, y1 - y0);
+    int row1 = Geometry102_t::rowEnd(x0, y0, x1 - x0, y1 - y0);
+    bit0 = max(bit0, view.bitOrigin) - view.bitOrigin;
+    bit1 = min(bit1, view.bitOrigin + view.stride * 8) - view.bitOrigin;
+    row0 = max(row0, view.firstRow);
+    row1 = min(row1, view.firstRow + view.rows);
+    if (bit0 >= bit1 || row0 >= row1) return;
+    
+    // Frame buffer row r is the virtual line lineOf(r); bitmap pixel (across,
+    // along) covers line lineOrigin + across * scale from bit bitOrigin + along * scale
+    int lineOrigin = Geometry102_t::line(x, y);
+    int bitOrigin = Geometry102_t::bit(x, y) - view.bitOrigin;
+    bool linesAlongRows = (bitmap->layout == BITMAP_COLUMNS) != Geometry102_t::BITS_ALONG_X;
+    int lineLength = bitmap->layout == BITMAP_COLUMNS ? bitmap->height : bitmap->width;
+    int stride = (lineLength * bitmap->bpp + 7) / 8;
+    bool wholeBytes = linesAlongRows && bitmap->bpp == 1 && scale == 1;
+    
+    const uint8_t *patterns = DITHER_PATTERNS[ditherTone(color)];
+    const uint8_t *lightPatterns = DITHER_PATTERNS[DITHER_LIGHTGREY];
+    const uint8_t *darkPatterns = DITHER_PATTERNS[DITHER_DARKGREY];
+    
+    for (int r = row0; r < row1; r++) {
+        int parity = Geometry102_t::rowParity(r);
+        uint8_t pattern = patterns[parity];
+        uint8_t light = lightPatterns[parity];
+        uint8_t dark = darkPatterns[parity];
+        uint8_t *dst = frameBuffer + (r - view.firstRow) * view.stride;
+        int across = (Geometry102_t::lineOf(r) - lineOrigin) / scale;
+        uint8_t levels[4] = {0, 0, 0, 0};
+        
+        if (wholeBytes) {
+            // Source line straight into the row, one shifted byte per destination byte
+            const uint8_t *line = bitmap->data + across * stride;
+            for (int d = bit0 >> 3; d <= (bit1 - 1) >> 3; d++) {
+                uint8_t range = 0xFF;
+                if (d == bit0 >> 3) range &= 0xFF >> (bit0 & 7);
+                if (d == (bit1 - 1) >> 3) range &= 0xFF << (7 - ((bit1 - 1) & 7));
+                levels[3] = bitmapByte(line, stride, d * 8 - bitOrigin) & range;
+                levels[0] = range & ~levels[3];
+                blitByte(dst + d, op, levels, pattern, light, dark);
+            }
+            continue;
+        }
+        
+        // Pixel by pixel along the row, one read per source pixel, one write per byte
+        int along = (bit0 - bitOrigin) / scale;
+        int repeat = (bit0 - bitOrigin) % scale;
+        uint8_t level = linesAlongRows ? bitmapLevel(bitmap, stride, across, along)
+                                       : bitmapLevel(bitmap, stride, along, across);
+        for (int b = bit0; b < bit1; b++) {
+            levels[level] |= 0x80 >> (b & 7);
+            if ((b & 7) == 7 || b == bit1 - 1) {
+                blitByte(dst + (b >> 3), op, levels, pattern, light, dark);
+                levels[0] = levels[1] = levels[2] = levels[3] = 0;
+            }
+            if (++repeat == scale && b + 1 < bit1) {
+                repeat = 0;
+                along++;
+                level = linesAlongRows ? bitmapLevel(bitmap, stride, across, along)
+                                       : bitmapLevel(bitmap, stride, along, across);
+            }
+        }
+    }
+}
+
+// Tone of each 4-bit grey level: quarters of the range, darkest first
+static const uint8_t GREY_TONES[16] = {
+    DITHER_BLACK, DITHER_BLACK, DITHER_BLACK, DITHER_BLACK,
+    DITHER_DARKGREY, DITHER_DARKGREY, DITHER_DARKGREY, DITHER_DARKGREY,
+    DITHER_LIGHTGREY, DITHER_LIGHTGREY, DITHER_LIGHTGREY, DITHER_LIGHTGREY,
+    DITHER_WHITE, DITHER_WHITE, DITHER_WHITE, DITHER_WHITE,
+};
+
+void Display102::greySpans(const uint8_t *data, int x, int y, int w, int h)
+{
+    if (frameBuffer == nullptr) return;
+    
+    // Clip to the virtual screen, then to the buffered rows and bits - rows
+    // outside the current page are never decoded
+    int x0 = max(x, 0);
+    int y0 = max(y, 0);
+    int x1 = min(x + w, (int)width());
+    int y1 = min(y + h, (int)height());
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    BufferView_t view = bufferView();
+    int bit0 = Geometry102_t::bitStart(x0, y0, x1 - x0, y1 - y0);
+    int bit1 = Geometry102_t::bitEnd(x0, y0, x1 - x0, y1 - y0);  // Exclusive
+    int row0 = Geometry102_t::rowStart(x0, y0, x1 - x0, y1 - y0);
+    int row1 = Geometry102_t::rowEnd(x0, y0, x1 - x0, y1 - y0);
+    bit0 = max(bit0, view.bitOrigin) - view.bitOrigin;
+    bit1 = min(bit1, view.bitOrigin + view.stride * 8) - view.bitOrigin;
+    row0 = max(row0, view.firstRow);
+    row1 = min(row1, view.firstRow + view.rows);
+    if (bit0 >= bit1 || row0 >= row1) return;
+    
+    // Pattern byte of every grey level for both row parities
+    uint8_t patterns[2][16];
+    for (int level = 0; level < 16; level++) {
+        patterns[0][level] = DITHER_PATTERNS[GREY_TONES[level]][0];
+        patterns[1][level] = DITHER_PATTERNS[GREY_TONES[level]][1];
+    }
+    
+    // Image pixel (i, j) is the nibble at j * stride + i / 2, even i in the
+    // low nibble. A frame buffer row is an image row in the portrait-native
+    // layout (consecutive nibbles), an image column otherwise (one per row).
+    int stride = w / 2;
+    int lineOrigin = Geometry102_t::line(x, y);
+    int bitOrigin = Geometry102_t::bit(x, y) - view.bitOrigin;
+    
+    for (int r = row0; r < row1; r++) {
+        const uint8_t *rowPatterns = patterns[Geometry102_t::rowParity(r)];
+        uint8_t *dst = frameBuffer + (r - view.firstRow) * view.stride;
+        int across = Geometry102_t::lineOf(r) - lineOrigin;
+        
+        for (int d = bit0 >> 3; d <= (bit1 - 1) >> 3; d++) {
+            int b0 = max(d * 8, bit0);
+            int b1 = min(d * 8 + 8, bit1);
+            uint8_t range = (0xFF >> (b0 & 7)) & (0xFF << (8 - (b1 - d * 8)));
+            uint8_t out = 0;
+            for (int b = b0; b < b1; b++) {
+                int along = b - bitOrigin;
+                int i = Geometry102_t::BITS_ALONG_X ? along : across;
+                int j = Geometry102_t::BITS_ALONG_X ? across : along;
+                uint8_t level = (data[j * stride + (i >> 1)] >> ((i & 1) * 4)) & 0x0F;
+                out |= rowPatterns[level] & (0x80 >> (b & 7));
+            }
+            dst[d] = (dst[d] & ~range) | (out & range);
         }
     }
 }
@@ -651,6 +1965,31 @@ void Display102::updateWindow(int x, int y, int w, int h)
         return;
     }
     
+    // Panel content of the window no longer matches the stored tile hashes
+    invalidateTiles(x, y, w, h);
+    
+    beginWindowSession();
+    writeWindow(x, y, w, h, false);
+    logUploadRate();
+    refreshWindows((uint32_t)w * h);
+}
+
+void Display102::beginWindowSession()
+{
+    // Hardware reset before partial refresh
+    digitalWrite(PIN_RST, LOW);
+    delay(10);
+    digitalWrite(PIN_RST, HIGH);
+    delay(10);
+    waitBusy();
+    
+    // BorderWaveform for partial refresh
+    writeCommand(0x3C);
+    writeData(0x80);
+}
+
+void Display102::writeWindow(int x, int y, int w, int h, bool blank)
+{
     // Convert virtual (portrait) coordinates to physical (landscape) coordinates
     // Portrait rotation: physX = y, physY = HEIGHT-1-x
     // Window: phys_x = y, phys_y = EPD102_HEIGHT - x - w, phys_w = h, phys_h = w
@@ -673,20 +2012,9 @@ void Display102::updateWindow(int x, int y, int w, int h)
     int bytes_per_row = (phys_x_end - phys_x_start + 1) / 8;
     int window_rows = phys_y_end - phys_y_start + 1;
     
-    LOGD("Display102::updateWindow - phys window: x=" + String(phys_x_start) + "-" + String(phys_x_end) + 
+    LOGD("Display102::writeWindow - phys window: x=" + String(phys_x_start) + "-" + String(phys_x_end) + 
          " y=" + String(phys_y_start) + "-" + String(phys_y_end) + 
-         " (" + String(bytes_per_row) + " bytes/row x " + String(window_rows) + " rows)");
-    
-    // Hardware reset before partial refresh
-    digitalWrite(PIN_RST, LOW);
-    delay(10);
-    digitalWrite(PIN_RST, HIGH);
-    delay(10);
-    waitBusy();
-    
-    // BorderWaveform for partial refresh
-    writeCommand(0x3C);
-    writeData(0x80);
+         " (" + String(bytes_per_row) + " bytes/row x " + String(window_rows) + " rows)" + (blank ? ", blank" : ""));
     
     // Set RAM window to popup area only
     writeCommand(0x44);  // Set RAM X address
@@ -709,36 +2037,16 @@ void Display102::updateWindow(int x, int y, int w, int h)
     writeData(phys_y_start % 256);
     writeData(phys_y_start / 256);
     
-    LOGD("Display102::updateWindow - Writing to RAM 0x24, popupMode=" + String(_popupMode));
+    LOGD("Display102::writeWindow - Writing to RAM 0x24, popupMode=" + String(_popupMode));
     
     // Write to RAM 0x24 (new data)
     writeCommand(0x24);
     
-    if (_popupMode) {
-        // In popup mode, buffer is organized as:
-        // [row0_byte0, row0_byte1, ..., row1_byte0, ...]
-        // where each row has bytes_per_row bytes
-        for (int i = 0; i < bytes_per_row * window_rows; i++) {
-            if (i < EPD102_ARRAY) {
-                writeData(frameBuffer[i]);
-            } else {
-                writeData(0xFF);
-            }
-        }
+    if (blank) {
+        writeFill(0xFF, bytes_per_row * window_rows);
+        _uploadBytes += bytes_per_row * window_rows;
     } else {
-        // Normal paging mode - read from current page buffer
-        int pageYStart = currentPage * (EPD102_HEIGHT / EPD102_PAGES);
-        for (int row = phys_y_start; row <= phys_y_end; row++) {
-            for (int col_byte = phys_x_start / 8; col_byte <= phys_x_end / 8; col_byte++) {
-                int bufferIndex = col_byte + (row - pageYStart) * (EPD102_WIDTH / 8);
-                if (row >= pageYStart && row < pageYStart + (EPD102_HEIGHT / EPD102_PAGES) && 
-                    bufferIndex >= 0 && bufferIndex < EPD102_ARRAY) {
-                    writeData(frameBuffer[bufferIndex]);
-                } else {
-                    writeData(0xFF);
-                }
-            }
-        }
+        writeWindowPlane(phys_x_start, phys_y_start, phys_y_end, bytes_per_row, false);
     }
     
     // Reset RAM counters for 0x26
@@ -749,40 +2057,131 @@ void Display102::updateWindow(int x, int y, int w, int h)
     writeData(phys_y_start % 256);
     writeData(phys_y_start / 256);
     
-    LOGD("Display102::updateWindow - Writing to RAM 0x26");
+    LOGD("Display102::writeWindow - Writing to RAM 0x26");
     writeCommand(0x26);
     
-    if (_popupMode) {
-        for (int i = 0; i < bytes_per_row * window_rows; i++) {
-            if (i < EPD102_ARRAY) {
-                writeData(~frameBuffer[i]);
-            } else {
-                writeData(0x00);
-            }
-        }
+    if (blank) {
+        writeFill(0x00, bytes_per_row * window_rows);
+        _uploadBytes += bytes_per_row * window_rows;
     } else {
-        int pageYStart = currentPage * (EPD102_HEIGHT / EPD102_PAGES);
-        for (int row = phys_y_start; row <= phys_y_end; row++) {
-            for (int col_byte = phys_x_start / 8; col_byte <= phys_x_end / 8; col_byte++) {
-                int bufferIndex = col_byte + (row - pageYStart) * (EPD102_WIDTH / 8);
-                if (row >= pageYStart && row < pageYStart + (EPD102_HEIGHT / EPD102_PAGES) && 
-                    bufferIndex >= 0 && bufferIndex < EPD102_ARRAY) {
-                    writeData(~frameBuffer[bufferIndex]);
-                } else {
-                    writeData(0x00);
-                }
-            }
-        }
+        writeWindowPlane(phys_x_start, phys_y_start, phys_y_end, bytes_per_row, true);
     }
-    
-    LOGD("Display102::updateWindow - Triggering partial update 0xFF");
+}
+
+void Display102::refreshWindows(uint32_t changedPixels)
+{
+    LOGD("Display102::refreshWindows - Triggering partial update 0xFF");
     writeCommand(0x22);
     writeData(0xFF);
     writeCommand(0x20);
     waitBusy();
-    LOGD("Display102::updateWindow - Partial refresh complete");
+    LOGD("Display102::refreshWindows - Partial refresh complete");
+    
+    // Windows ghost like any fast frame. A promotion can't apply to a window
+    // refresh - the policy has reset its history, so make the next frame full.
+    if (_refreshPolicy.endFrame(REFRESH_FAST, changedPixels) == REFRESH_FULL) {
+        invalidateTiles();
+    }
+}
+
+void Display102::writeWindowPlane(int phys_x_start, int phys_y_start, int phys_y_end, int bytes_per_row, bool invert)
+{
+    int window_rows = phys_y_end - phys_y_start + 1;
+    uint8_t outside = invert ? 0x00 : 0xFF;
+    
+#if EPD102_PORTRAIT_NATIVE
+    // Rows outside the buffered page/popup come out blank from the transpose
+    writeNativeRows(frameBuffer, currentPage, phys_y_start, phys_y_end, phys_x_start / 8, bytes_per_row,
+        invert ? PLANE_INVERTED : PLANE_NEW);
+    _uploadBytes += bytes_per_row * window_rows;
+    return;
+#endif
+    
+    if (_popupMode) {
+        // In popup mode, buffer is organized as:
+        // [row0_byte0, row0_byte1, ..., row1_byte0, ...]
+        // where each row has bytes_per_row bytes
+        int total = bytes_per_row * window_rows;
+        int stored = total < (int)_bufferSize ? total : _bufferSize;
+        writeBuffer(frameBuffer, stored, invert);
+        if (total > stored) {
+            writeFill(outside, total - stored);
+        }
+        _uploadBytes += total;
+        return;
+    }
+    
+    // Normal paging mode - rows of the current page come from the buffer,
+    // everything else is sent as blank
+    int pageYStart = currentPage * _pageRows;
+    int colStart = phys_x_start / 8;
+    for (int row = phys_y_start; row <= phys_y_end; row++) {
+        if (row >= pageYStart && row < pageYStart + _pageRows) {
+            writeBuffer(&frameBuffer[colStart + (row - pageYStart) * EPD102_ROW_BYTES], bytes_per_row, invert);
+        } else {
+            writeFill(outside, bytes_per_row);
+        }
+    }
+    _uploadBytes += bytes_per_row * window_rows;
 }
 
+#if EPD102_PORTRAIT_NATIVE
+// 8x8 bit-matrix transpose, MSB = leftmost pixel on both sides:
+// out[j] bit (7 - i) = in[i] bit (7 - j)
+static inline void transpose8(const uint8_t *in, int stride, uint8_t *out)
+{
+    uint32_t hi = (in[0] << 24) | (in[stride] << 16) | (in[2 * stride] << 8) | in[3 * stride];
+    uint32_t lo = (in[4 * stride] << 24) | (in[5 * stride] << 16) | (in[6 * stride] << 8) | in[7 * stride];
+    uint32_t t;
+    
+    // Swap 1x1 blocks inside 2x2, then 2x2 inside 4x4
+    t = (hi ^ (hi >> 7)) & 0x00AA00AA; hi = hi ^ t ^ (t << 7);
+    t = (lo ^ (lo >> 7)) & 0x00AA00AA; lo = lo ^ t ^ (t << 7);
+    t = (hi ^ (hi >> 14)) & 0x0000CCCC; hi = hi ^ t ^ (t << 14);
+    t = (lo ^ (lo >> 14)) & 0x0000CCCC; lo = lo ^ t ^ (t << 14);
+    
+    // Swap 4x4 blocks between the halves
+    t = (hi & 0xF0F0F0F0) | ((lo >> 4) & 0x0F0F0F0F);
+    lo = ((hi << 4) & 0xF0F0F0F0) | (lo & 0x0F0F0F0F);
+    hi = t;
+    
+    out[0] = hi >> 24; out[1] = hi >> 16; out[2] = hi >> 8; out[3] = hi;
+    out[4] = lo >> 24; out[5] = lo >> 16; out[6] = lo >> 8; out[7] = lo;
+}
+
+void Display102::writeNativeRows(const uint8_t *buffer, int page, int physYStart, int physYEnd,
+    int colStart, int bytesPerRow, UploadPlane_t plane)
+{
+    BufferView_t view = bufferView(page);
+    uint8_t block[8];
+    
+    for (int group = physYStart & ~7; group <= physYEnd; group += 8) {
+        // Physical rows group..group+7 are portrait columns xBlock+7..xBlock
+        int bit = EPD102_HEIGHT - 8 - group - view.bitOrigin;
+        bool columnBuffered = bit >= 0 && bit < view.stride * 8;
+        
+        for (int col = 0; col < bytesPerRow; col++) {
+            // Physical byte column = 8 portrait rows
+            int row = (colStart + col) * 8 - view.firstRow;
+            if (columnBuffered && row >= 0 && row + 8 <= view.rows) {
+                transpose8(&buffer[row * view.stride + bit / 8], view.stride, block);
+            } else {
+                memset(block, 0xFF, sizeof(block));
+            }
+            // Portrait x runs opposite to physical Y; tile rows are 8-row aligned
+            uint8_t flip = planeFlip(plane, group, colStart + col);
+            for (int r = 0; r < 8; r++) {
+                _spiChunk[r * bytesPerRow + col] = block[7 - r] ^ flip;
+            }
+        }
+        
+        int first = max(group, physYStart) - group;
+        int last = min(group + 7, physYEnd) - group;
+        writeBuffer(&_spiChunk[first * bytesPerRow], (last - first + 1) * bytesPerRow);
+    }
+}
+#endif
+
 // ============================================================================
 // Font Management
 // ============================================================================
@@ -837,37 +2236,34 @@ const GFXfont* Display102::getFont(Font font)
 // Text Rendering
 // ============================================================================
 
-Rectangle_t Display102::drawText(Font font, String text, int x, int y,
+Rectangle_t Display102::drawText(Font font, const char *text, size_t length, int x, int y,
     Alignment horizontal, Alignment vertical,
     int margin_horizontal, int margin_vertical,
     int foregroundColor, int backgroundColor)
 {
-    String textCP = utf8tocp(text);
-    const GFXfont *f = getFont(font);
+    return drawTextWithFont(getFont(font), text, length, x, y, horizontal, vertical,
+        margin_horizontal, margin_vertical, foregroundColor, backgroundColor);
+}
+
+Rectangle_t Display102::drawTextScaled(Font font, const char *text, size_t length, int x, int y,
+    Alignment horizontal, Alignment vertical,
+    int margin_horizontal, int margin_vertical,
+    int foregroundColor, int backgroundColor)
+{
+    return drawTextWithFont(getScaledFont(font), text, length, x, y, horizontal, vertical,
+        margin_horizontal, margin_vertical, foregroundColor, backgroundColor);
+}
+
+Rectangle_t Display102::drawTextWithFont(const GFXfont *f, const char *text, size_t length, int x, int y,
+    Alignment horizontal, Alignment vertical,
+    int margin_horizontal, int margin_vertical,
+    int foregroundColor, int backgroundColor)
+{
+    char textCP[EPD102_TEXT_BUFFER];
+    size_t lengthCP = utf8tocp(text, length, textCP, sizeof(textCP));
     int16_t x1, y1;
     uint16_t w, h;
-    
-    cp437(true);
-    setFont(f);
-    setTextWrap(false);
-    getTextBounds(textCP, 0, 0, &x1, &y1, &w, &h);
-    
-    switch (horizontal) {
-        case LEADING: x = x + margin_horizontal - x1; break;
-        case CENTER: x = x - w / 2 - x1; break;
-        case TRAILING: x = x - w - margin_horizontal - x1; break;
-    }
-    
-    switch (vertical) {
-        case LEADING: y = y + h + margin_vertical - (y1 + h); break;
-        case CENTER: {
-            int16_t refX, refY;
-            uint16_t refW, refH;
-            getTextBounds("X", 0, 0, &refX, &refY, &refW, &refH);
-            y = y + refH / 2;
-        } break;
-        case TRAILING: y = y - margin_vertical - (y1 + h); break;
-    }
+    alignText(f, textCP, lengthCP, x, y, horizontal, vertical, margin_horizontal, margin_vertical, &x1, &y1, &w, &h);
     
     if (backgroundColor >= 0) {
         fillRectRounded(x, y - h + 1, w, h - 1, 2, backgroundColor);
@@ -879,62 +2275,121 @@ Rectangle_t Display102::drawText(Font font, String text, int x, int y,
     rect.w = w;
     rect.h = h - 1;
     
-    setTextColor(mapColor(foregroundColor));
-    setCursor(x, y);
-    print(textCP);
+    printText(f, textCP, x, y, x1, y1, w, h, mapColor(foregroundColor));
     
     return rect;
 }
 
-Rectangle_t Display102::drawTextScaled(Font font, String text, int x, int y,
-    Alignment horizontal, Alignment vertical,
-    int margin_horizontal, int margin_vertical,
-    int foregroundColor, int backgroundColor)
+void Display102::alignText(const GFXfont *f, const char *textCP, size_t lengthCP, int &x, int &y,
+    Alignment horizontal, Alignment vertical, int margin_horizontal, int margin_vertical,
+    int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
 {
-    String textCP = utf8tocp(text);
-    const GFXfont *f = getScaledFont(font);
-    int16_t x1, y1;
-    uint16_t w, h;
-    
     cp437(true);
     setFont(f);
     setTextWrap(false);
-    getTextBounds(textCP, 0, 0, &x1, &y1, &w, &h);
+    textBounds(f, textCP, lengthCP, x1, y1, w, h);
     
     switch (horizontal) {
-        case LEADING: x = x + margin_horizontal - x1; break;
-        case CENTER: x = x - w / 2 - x1; break;
-        case TRAILING: x = x - w - margin_horizontal - x1; break;
+        case LEADING: x = x + margin_horizontal - *x1; break;
+        case CENTER: x = x - *w / 2 - *x1; break;
+        case TRAILING: x = x - *w - margin_horizontal - *x1; break;
     }
     
     switch (vertical) {
-        case LEADING: y = y + margin_vertical - y1; break;
-        case CENTER: {
-            int16_t refX, refY;
-            uint16_t refW, refH;
-            getTextBounds("X", 0, 0, &refX, &refY, &refW, &refH);
-            y = y + refH / 2;
-        } break;
-        case TRAILING: y = y - margin_vertical - (y1 + h); break;
-    }
-    
-    if (backgroundColor >= 0) {
-        fillRectRounded(x, y - h + 1, w, h - 1, 2, backgroundColor);
+        case LEADING: y = y + margin_vertical - *y1; break;
+        case CENTER: y = y + capHeight(f) / 2; break;
+        case TRAILING: y = y - margin_vertical - (*y1 + *h); break;
     }
+}
+
+Rectangle_t Display102::textInkBounds(Font font, const char *text, size_t length, int x, int y,
+    Alignment horizontal, Alignment vertical,
+    int margin_horizontal, int margin_vertical)
+{
+    char textCP[EPD102_TEXT_BUFFER];
+    size_t lengthCP = utf8tocp(text, length, textCP, sizeof(textCP));
+    int16_t x1, y1;
+    uint16_t w, h;
+    alignText(getFont(font), textCP, lengthCP, x, y, horizontal, vertical, margin_horizontal, margin_vertical, &x1, &y1, &w, &h);
     
     Rectangle_t rect;
-    rect.x = x;
-    rect.y = y - h + 1;
+    rect.x = x + x1;
+    rect.y = y + y1;
     rect.w = w;
-    rect.h = h - 1;
+    rect.h = h;
+    return rect;
+}
+
+void Display102::printText(const GFXfont *font, const char *textCP, int x, int y,
+    int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t color)
+{
+    // Glyph box relative to the cursor, as measured by getTextBounds()
+    if (_recording) {
+        DrawCommand_t *cmd = _list.add(CMD_TEXT, x + x1, y + y1, w, h);
+        if (cmd) {
+            cmd->data = font;
+            cmd->pooled = _list.storeText(textCP, strlen(textCP));
+            cmd->x = x;
+            cmd->y = y;
+            cmd->color = color;
+        }
+        return;
+    }
+    if (cullPrimitive(x + x1, y + y1, w, h)) return;
+    
+#if EPD102_GLYPH_ATLAS
+    const FontAtlas_t *atlas = findAtlas(font);
+    if (atlas != nullptr) {
+        blitText(atlas, textCP, x, y, color);
+        return;
+    }
+#endif
     
-    setTextColor(mapColor(foregroundColor));
+    cp437(true);
+    setFont(font);
+    setTextWrap(false);
+    setTextColor(color);
     setCursor(x, y);
     print(textCP);
-    
-    return rect;
 }
 
+#if EPD102_GLYPH_ATLAS
+const FontAtlas_t *Display102::findAtlas(const GFXfont *font)
+{
+    for (size_t i = 0; i < sizeof(FONT_ATLASES) / sizeof(FONT_ATLASES[0]); i++) {
+        if (FONT_ATLASES[i].font == font) {
+            return &FONT_ATLASES[i];
+        }
+    }
+    return nullptr;
+}
+
+void Display102::blitText(const FontAtlas_t *atlas, const char *textCP, int x, int y, uint16_t color)
+{
+    // Same cursor walk as Adafruit_GFX::write() with wrapping off
+    const GFXfont *font = atlas->font;
+    int cursorX = x;
+    int cursorY = y;
+    for (const uint8_t *c = (const uint8_t *)textCP; *c; c++) {
+        if (*c == '\n') {
+            cursorX = 0;
+            cursorY += font->yAdvance;
+            continue;
+        }
+        if (*c == '\r' || *c < font->first || *c > font->last) continue;
+        
+        int index = *c - font->first;
+        const GFXglyph *glyph = &font->glyph[index];
+        if (glyph->width > 0 && glyph->height > 0) {
+            // Glyph columns are frame buffer rows - merged a byte at a time
+            Bitmap_t columns = { glyph->width, glyph->height, 1, BITMAP_COLUMNS, atlas->columns + atlas->offsets[index] };
+            blitSpans(&columns, cursorX + glyph->xOffset, cursorY + glyph->yOffset, 1, BLIT_TRANSPARENT, color);
+        }
+        cursorX += glyph->xAdvance;
+    }
+}
+#endif
+
 Rectangle_t Display102::drawTextMultiline(Font font, const char* lines[], int lineCount,
     int x, int y, int width, int height,
     Alignment horizontal, Alignment vertical, int foregroundColor)
@@ -989,56 +2444,35 @@ Rectangle_t Display102::drawTextMultiline(Font font, const char* lines[], int li
     return bounds;
 }
 
-Rectangle_t Display102::measureText(Font font, String text, int x, int y,
+Rectangle_t Display102::measureText(Font font, const char *text, size_t length, int x, int y,
     Alignment horizontal, Alignment vertical,
     int margin_horizontal, int margin_vertical)
 {
-    String textCP = utf8tocp(text);
-    const GFXfont *f = getFont(font);
-    int16_t x1, y1;
-    uint16_t w, h;
-    
-    cp437(true);
-    setFont(f);
-    setTextWrap(false);
-    getTextBounds(textCP, 0, 0, &x1, &y1, &w, &h);
-    
-    uint16_t lineHeight = f->yAdvance;
-    
-    switch (horizontal) {
-        case LEADING: x = x + margin_horizontal - x1; break;
-        case CENTER: x = x - w / 2 - x1; break;
-        case TRAILING: x = x - w - margin_horizontal - x1; break;
-    }
-    
-    switch (vertical) {
-        case LEADING: y = y + lineHeight + margin_vertical - (y1 + lineHeight); break;
-        case CENTER: y = y + lineHeight / 2 - (y1 + lineHeight); break;
-        case TRAILING: y = y - margin_vertical - (y1 + lineHeight); break;
-    }
-    
-    Rectangle_t rect;
-    rect.x = x;
-    rect.y = y - lineHeight + 1;
-    rect.w = w;
-    rect.h = lineHeight - 1;
-    
-    return rect;
+    return measureTextWithFont(getFont(font), text, length, x, y, horizontal, vertical,
+        margin_horizontal, margin_vertical);
 }
 
-Rectangle_t Display102::measureTextScaled(Font font, String text, int x, int y,
+Rectangle_t Display102::measureTextScaled(Font font, const char *text, size_t length, int x, int y,
     Alignment horizontal, Alignment vertical,
     int margin_horizontal, int margin_vertical)
 {
-    String textCP = utf8tocp(text);
-    const GFXfont *f = getScaledFont(font);
+    return measureTextWithFont(getScaledFont(font), text, length, x, y, horizontal, vertical,
+        margin_horizontal, margin_vertical);
+}
+
+Rectangle_t Display102::measureTextWithFont(const GFXfont *f, const char *text, size_t length, int x, int y,
+    Alignment horizontal, Alignment vertical,
+    int margin_horizontal, int margin_vertical)
+{
+    char textCP[EPD102_TEXT_BUFFER];
+    size_t lengthCP = utf8tocp(text, length, textCP, sizeof(textCP));
     int16_t x1, y1;
     uint16_t w, h;
     
     cp437(true);
     setFont(f);
     setTextWrap(false);
-    getTextBounds(textCP, 0, 0, &x1, &y1, &w, &h);
+    textBounds(f, textCP, lengthCP, &x1, &y1, &w, &h);
     
     uint16_t lineHeight = f->yAdvance;
     
@@ -1075,26 +2509,86 @@ int Display102::getLineHeightScaled(Font font)
     return f->yAdvance;
 }
 
-int Display102::getTextHeight(Font font, String text)
+int Display102::getTextHeight(Font font, const char *text, size_t length)
 {
-    String textCP = utf8tocp(text);
-    const GFXfont *f = getFont(font);
-    int16_t x1, y1;
-    uint16_t w, h;
-    cp437(true);
-    setFont(f);
-    getTextBounds(textCP, 0, 0, &x1, &y1, &w, &h);
-    return h;
+    return textHeightWithFont(getFont(font), text, length);
 }
 
-int Display102::getTextHeightScaled(Font font, String text)
+int Display102::getTextHeightScaled(Font font, const char *text, size_t length)
 {
-    String textCP = utf8tocp(text);
-    const GFXfont *f = getScaledFont(font);
+    return textHeightWithFont(getScaledFont(font), text, length);
+}
+
+int Display102::textHeightWithFont(const GFXfont *f, const char *text, size_t length)
+{
+    char textCP[EPD102_TEXT_BUFFER];
+    size_t lengthCP = utf8tocp(text, length, textCP, sizeof(textCP));
     int16_t x1, y1;
     uint16_t w, h;
     cp437(true);
     setFont(f);
-    getTextBounds(textCP, 0, 0, &x1, &y1, &w, &h);
+    setTextWrap(false);
+    textBounds(f, textCP, lengthCP, &x1, &y1, &w, &h);
     return h;
 }
+
+void Display102::textBounds(const GFXfont *font, const char *textCP, size_t length,
+    int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+    // 64-bit FNV-1a over the font and the code page bytes. A hit trusts the
+    // hash - with a few hundred strings a collision is around 1e-15.
+    uint64_t hash = (14695981039346656037ull ^ (uint64_t)(uintptr_t)font) * 1099511628211ull;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)textCP[i]) * 1099511628211ull;
+    }
+    
+    // FNV's low bits only see the inputs' low bits - fold the high halves in.
+    // Within a set the most recently added entry comes first.
+    uint32_t fold = (uint32_t)(hash ^ (hash >> 32));
+    TextBounds_t *set = &_textCache[((fold ^ (fold >> 16)) % EPD102_TEXT_CACHE_SETS) * EPD102_TEXT_CACHE_WAYS];
+    int way = 0;
+    while (way < EPD102_TEXT_CACHE_WAYS &&
+           !(set[way].font == font && set[way].hash == hash && set[way].length == length)) {
+        way++;
+    }
+    
+    TextBounds_t *entry;
+    if (way < EPD102_TEXT_CACHE_WAYS) {
+        _textCacheHits++;
+        entry = &set[way];
+    } else {
+        _textCacheMisses++;
+        memmove(&set[1], &set[0], (EPD102_TEXT_CACHE_WAYS - 1) * sizeof(TextBounds_t));
+        entry = &set[0];
+        getTextBounds(textCP, 0, 0, &entry->x1, &entry->y1, &entry->w, &entry->h);
+        entry->font = font;
+        entry->hash = hash;
+        entry->length = length;
+    }
+    *x1 = entry->x1;
+    *y1 = entry->y1;
+    *w = entry->w;
+    *h = entry->h;
+}
+
+uint16_t Display102::capHeight(const GFXfont *font)
+{
+    for (int i = 0; i < EPD102_FONT_SLOTS; i++) {
+        FontMetrics_t &metrics = _fontMetrics[i];
+        if (metrics.font == font) return metrics.capHeight;
+        if (metrics.font == nullptr) {
+            int16_t refX, refY;
+            uint16_t refW, refH;
+            getTextBounds("X", 0, 0, &refX, &refY, &refW, &refH);
+            metrics.font = font;
+            metrics.capHeight = refH;
+            return refH;
+        }
+    }
+    
+    // More fonts than slots - measure every time
+    int16_t refX, refY;
+    uint16_t refW, refH;
+    getTextBounds("X", 0, 0, &refX, &refY, &refW, &refH);
+    return refH;
+}
@@ -3,9 +3,15 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
 #include "../Adafruit_GFX/Adafruit_GFX.h"
 #include "../DisplayTypes.hpp"
 #include "../../Logging/Logging.hpp"
+#include "DisplayList.hpp"
+#include "RefreshPolicy.hpp"
+#include "EpdGeometry.hpp"
 
 // Pin definitions - same as 7.5" display
 #define PIN_PWR_EN 2
@@ -18,12 +24,55 @@
 #define EPD102_WIDTH 960
 #define EPD102_HEIGHT 640
 #define EPD102_PIXEL_PER_BYTE 8
-#define EPD102_PAGES 2
-#define EPD102_ARRAY (EPD102_WIDTH * EPD102_HEIGHT / EPD102_PIXEL_PER_BYTE / EPD102_PAGES)
+#define EPD102_ROW_BYTES (EPD102_WIDTH / EPD102_PIXEL_PER_BYTE)
+#define EPD102_FRAME_BYTES (EPD102_ROW_BYTES * EPD102_HEIGHT)
+
+// Paging - page count (1, 2, 4 or 8 horizontal bands) is chosen in beginDraw()
+// from the largest free heap block, keeping EPD102_HEAP_RESERVE for everything else
+#define EPD102_MAX_PAGES 8
+#ifndef EPD102_HEAP_RESERVE
+#define EPD102_HEAP_RESERVE (8 * 1024)
+#endif
+
+// SPI clock for RAM uploads (controller accepts up to 20 MHz on writes)
+#ifndef EPD102_SPI_FREQUENCY
+#define EPD102_SPI_FREQUENCY 20000000
+#endif
+
+// Staging chunk for inverted/filled bursts - 8 physical rows. One member buffer
+// shared by every upload path (only one of them drives SPI at a time), so it
+// stays off the upload task's stack.
+#define EPD102_SPI_CHUNK (EPD102_ROW_BYTES * 8)
+
+// Double-buffered paging - when a second band fits next to the first (and the
+// reserve), page N streams to the panel from a task on the other core while
+// page N+1 is drawn on the loop task
+#ifndef EPD102_DOUBLE_BUFFER
+#define EPD102_DOUBLE_BUFFER 1
+#endif
+#define EPD102_UPLOAD_CORE 0
+#define EPD102_UPLOAD_STACK 4096
+
+// Differential refresh - each frame is hashed in tiles of EPD102_TILE_ROWS physical
+// rows by EPD102_TILE_COL_BYTES bytes; the hashes live in RTC memory across deep
+// sleep and only changed tiles are driven by the next partial refresh
+#define EPD102_TILE_ROWS 80       // Smallest page band (8 pages)
+#define EPD102_TILE_COL_BYTES 12  // 96 physical columns
+#define EPD102_TILE_GRID_ROWS (EPD102_HEIGHT / EPD102_TILE_ROWS)
+#define EPD102_TILE_GRID_COLS (EPD102_ROW_BYTES / EPD102_TILE_COL_BYTES)
+#define EPD102_TILE_COUNT (EPD102_TILE_GRID_ROWS * EPD102_TILE_GRID_COLS)
+#define EPD102_TILE_PIXELS (EPD102_TILE_ROWS * EPD102_TILE_COL_BYTES * 8)
 
 // Portrait mode - rotate 90 degrees (same as 7.5")
 #define PORTRAIT_MODE_102 1
 
+// Framebuffer layout. 0 = controller layout (physical rows contiguous, rotation
+// per pixel while drawing). 1 = portrait rows contiguous, rotated by 8x8 bit
+// transposes while streaming to the controller in nextPage()/updateWindow().
+#ifndef EPD102_PORTRAIT_NATIVE
+#define EPD102_PORTRAIT_NATIVE 0
+#endif
+
 #if PORTRAIT_MODE_102
     #define EPD102_VIRTUAL_WIDTH EPD102_HEIGHT
     #define EPD102_VIRTUAL_HEIGHT EPD102_WIDTH
@@ -32,6 +81,93 @@
     #define EPD102_VIRTUAL_HEIGHT EPD102_HEIGHT
 #endif
 
+// The one geometry this driver is built for
+typedef EpdGeometry<EPD102_WIDTH, EPD102_HEIGHT, PORTRAIT_MODE_102, EPD102_PORTRAIT_NATIVE> Geometry102_t;
+
+// Text from the pre-rotated glyph atlases (FontAtlases102.h, generated by
+// fontAtlas_script.py) - they match the rotated controller layout only
+#ifndef EPD102_GLYPH_ATLAS
+#if PORTRAIT_MODE_102 && !EPD102_PORTRAIT_NATIVE
+#define EPD102_GLYPH_ATLAS 1
+#else
+#define EPD102_GLYPH_ATLAS 0
+#endif
+#endif
+
+// Windows of one popup surface
+#ifndef EPD102_POPUP_WINDOWS
+#define EPD102_POPUP_WINDOWS 4
+#endif
+
+// Stack buffer for text transcoded to the font code page; longer text is cut
+#ifndef EPD102_TEXT_BUFFER
+#define EPD102_TEXT_BUFFER 128
+#endif
+
+// Stack buffer for a flattened curve, in points; longer curves are rasterized
+// in parts (the shared end point is then written twice)
+#ifndef EPD102_CURVE_POINTS
+#define EPD102_CURVE_POINTS 128
+#endif
+
+// Text bounds memo - (font, transcoded text) -> getTextBounds() result, in sets
+// of EPD102_TEXT_CACHE_WAYS picked by a hash of both. The text is not stored -
+// a hit means same font, length and 64-bit hash. Sized for the distinct
+// labels of one dashboard frame, so paged layout measures each label once.
+#ifndef EPD102_TEXT_CACHE_SIZE
+#define EPD102_TEXT_CACHE_SIZE 128
+#endif
+#define EPD102_TEXT_CACHE_WAYS 4
+#define EPD102_TEXT_CACHE_SETS (EPD102_TEXT_CACHE_SIZE / EPD102_TEXT_CACHE_WAYS)
+#define EPD102_FONT_SLOTS 16  // Per-font constants, more than getFont()/getScaledFont() return
+
+typedef struct {
+    uint64_t hash;
+    const GFXfont *font;  // nullptr = empty slot
+    uint16_t length;
+    int16_t x1, y1;
+    uint16_t w, h;
+} TextBounds_t;
+
+typedef struct {
+    const GFXfont *font;
+    uint16_t capHeight;  // Height of "X", the CENTER reference
+} FontMetrics_t;
+
+// One font's atlas: per glyph, its columns left to right, each ceil(height / 8)
+// bytes with the top pixel in the MSB - one frame buffer row per column
+typedef struct {
+    const GFXfont *font;
+    const uint8_t *columns;
+    const uint32_t *offsets;  // Per glyph from font->first
+} FontAtlas_t;
+
+// Bitmaps for blit(). Lines (rows, or columns as in the glyph atlases) are
+// padded to whole bytes, first pixel in the MSB. A bitmap whose lines run
+// along the frame buffer rows (columns for the rotated portrait layout) is
+// merged a source byte at a time; the other layout is read per pixel.
+typedef enum : uint8_t {
+    BITMAP_ROWS,     // Left to right within a row, rows top to bottom
+    BITMAP_COLUMNS   // Top to bottom within a column, columns left to right
+} BitmapLayout_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t bpp;     // 1 (ink) or 2 (level 0 = none ... 3 = full ink)
+    BitmapLayout_t layout;
+    const uint8_t *data;
+} Bitmap_t;
+
+// What blit() does with a pixel. Ink = any non-zero source pixel.
+typedef enum : uint8_t {
+    BLIT_SET,          // Ink in the color, the rest of the rectangle white
+    BLIT_CLEAR,        // Ink becomes white, the rest untouched
+    BLIT_INVERT,       // Ink flips, the rest untouched
+    BLIT_TRANSPARENT,  // Ink in the color, the rest untouched
+    BLIT_TONE          // 2bpp levels 1, 2, 3 as light grey, dark grey, the color; 0 untouched
+} BlitOp_t;
+
 // Color definitions for 4-level greyscale
 #define GxEPD_BLACK     0x0000
 #define GxEPD_VERYDARK  0x39E7  // 64,64,64 - very dark grey for RED mapping
@@ -44,7 +180,7 @@
  * Features:
  * - 960x640 resolution
  * - 4-level greyscale (with dithering)
- * - Paging (2 pages due to memory constraints)
+ * - Paging (1-8 pages depending on free heap)
  * - SPI interface (same pins as 7.5")
  * 
  * Interface matches Display (7.5") for interchangeability via typedef.
@@ -73,41 +209,131 @@ public:
     int getDisplayWidth();
     int getDisplayHeight();
     
-    Rectangle_t drawText(Font font, String text, int x, int y,
+    // Text - UTF-8 in, transcoded into a stack buffer, no heap allocation.
+    // The (text, length) forms do the work; the others forward to them.
+    Rectangle_t drawText(Font font, const char *text, size_t length, int x, int y,
         Alignment horizontal, Alignment vertical,
         int margin_horizontal, int margin_vertical,
         int foregroundColor, int backgroundColor = -1);
+    Rectangle_t drawText(Font font, const char *text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical,
+        int foregroundColor, int backgroundColor = -1)
+    {
+        return drawText(font, text, strlen(text), x, y, horizontal, vertical,
+            margin_horizontal, margin_vertical, foregroundColor, backgroundColor);
+    }
+    Rectangle_t drawText(Font font, const String &text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical,
+        int foregroundColor, int backgroundColor = -1)
+    {
+        return drawText(font, text.c_str(), text.length(), x, y, horizontal, vertical,
+            margin_horizontal, margin_vertical, foregroundColor, backgroundColor);
+    }
     
-    Rectangle_t drawTextScaled(Font font, String text, int x, int y,
+    Rectangle_t drawTextScaled(Font font, const char *text, size_t length, int x, int y,
         Alignment horizontal, Alignment vertical,
         int margin_horizontal, int margin_vertical,
         int foregroundColor, int backgroundColor = -1);
+    Rectangle_t drawTextScaled(Font font, const char *text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical,
+        int foregroundColor, int backgroundColor = -1)
+    {
+        return drawTextScaled(font, text, strlen(text), x, y, horizontal, vertical,
+            margin_horizontal, margin_vertical, foregroundColor, backgroundColor);
+    }
+    Rectangle_t drawTextScaled(Font font, const String &text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical,
+        int foregroundColor, int backgroundColor = -1)
+    {
+        return drawTextScaled(font, text.c_str(), text.length(), x, y, horizontal, vertical,
+            margin_horizontal, margin_vertical, foregroundColor, backgroundColor);
+    }
     
     Rectangle_t drawTextMultiline(Font font, const char* lines[], int lineCount,
         int x, int y, int width, int height,
         Alignment horizontal, Alignment vertical, int foregroundColor);
     
-    Rectangle_t measureText(Font font, String text, int x, int y,
+    Rectangle_t measureText(Font font, const char *text, size_t length, int x, int y,
         Alignment horizontal, Alignment vertical,
         int margin_horizontal, int margin_vertical);
+    Rectangle_t measureText(Font font, const char *text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical)
+    {
+        return measureText(font, text, strlen(text), x, y, horizontal, vertical, margin_horizontal, margin_vertical);
+    }
+    Rectangle_t measureText(Font font, const String &text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical)
+    {
+        return measureText(font, text.c_str(), text.length(), x, y, horizontal, vertical, margin_horizontal, margin_vertical);
+    }
     
-    Rectangle_t measureTextScaled(Font font, String text, int x, int y,
+    Rectangle_t measureTextScaled(Font font, const char *text, size_t length, int x, int y,
         Alignment horizontal, Alignment vertical,
         int margin_horizontal, int margin_vertical);
+    Rectangle_t measureTextScaled(Font font, const char *text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical)
+    {
+        return measureTextScaled(font, text, strlen(text), x, y, horizontal, vertical, margin_horizontal, margin_vertical);
+    }
+    Rectangle_t measureTextScaled(Font font, const String &text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical)
+    {
+        return measureTextScaled(font, text.c_str(), text.length(), x, y, horizontal, vertical, margin_horizontal, margin_vertical);
+    }
+    
+    // Box of the pixels drawText() inks for the same arguments
+    Rectangle_t textInkBounds(Font font, const char *text, size_t length, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical);
+    Rectangle_t textInkBounds(Font font, const char *text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical)
+    {
+        return textInkBounds(font, text, strlen(text), x, y, horizontal, vertical, margin_horizontal, margin_vertical);
+    }
+    Rectangle_t textInkBounds(Font font, const String &text, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical)
+    {
+        return textInkBounds(font, text.c_str(), text.length(), x, y, horizontal, vertical, margin_horizontal, margin_vertical);
+    }
     
     int getLineHeight(Font font);
     int getLineHeightScaled(Font font);
-    int getTextHeight(Font font, String text);
-    int getTextHeightScaled(Font font, String text);
+    int getTextHeight(Font font, const char *text, size_t length);
+    int getTextHeight(Font font, const char *text) { return getTextHeight(font, text, strlen(text)); }
+    int getTextHeight(Font font, const String &text) { return getTextHeight(font, text.c_str(), text.length()); }
+    int getTextHeightScaled(Font font, const char *text, size_t length);
+    int getTextHeightScaled(Font font, const char *text) { return getTextHeightScaled(font, text, strlen(text)); }
+    int getTextHeightScaled(Font font, const String &text) { return getTextHeightScaled(font, text.c_str(), text.length()); }
     
     void drawPixel(int16_t x, int16_t y, uint16_t color) override;
     void drawImage(const uint8_t *data, int x, int y, int w, int h,
         Alignment horizontal, Alignment vertical, int margin);
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
     void fillRectRounded(int x, int y, int w, int h, int cornerRadius, int color);
     void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
     void drawCatmullRomCurve(int x[], int y[], int n, int thickness, int color);
     void invertRect(int x, int y, int w, int h);
+    void clearRect(int x, int y, int w, int h) { fillRect(x, y, w, h, GxEPD_WHITE); }
+    // Copies w x h pixels from (x, y) to (toX, toY). Only pixels whose source is
+    // buffered with the destination are copied - one-page frames, the popup
+    // window, or a move within the page rows (along y in the rotated layout).
+    void copyRect(int x, int y, int w, int h, int toX, int toY);
+    // Bitmap at (x, y), every pixel drawn as a scale x scale block. Recorded by
+    // pointer - the bitmap and its data must outlive the frame.
+    void blit(const Bitmap_t *bitmap, int x, int y, int scale, BlitOp_t op, uint16_t color);
     
     void updateFullscreen();
     void clearWindow(int x, int y, int w, int h);
@@ -117,22 +343,118 @@ public:
     bool needsPaging() { return !_popupMode; }  // No paging in popup mode
     void firstPage();
     bool nextPage();
+    int getPageCount() { return _pages; }
+    
+    // Physical row range [start, end) held by the current page
+    int getPageRowStart() { return _popupMode ? 0 : currentPage * _pageRows; }
+    int getPageRowEnd() { return _popupMode ? EPD102_HEIGHT : (currentPage + 1) * _pageRows; }
+    
+    // Primitives drawn / rejected by page culling since firstPage()
+    uint32_t getPrimitivesDrawn() { return _primitivesDrawn; }
+    uint32_t getPrimitivesCulled() { return _primitivesCulled; }
+    
+    // Text bounds lookups answered from / added to the memo since boot
+    uint32_t getTextCacheHits() { return _textCacheHits; }
+    uint32_t getTextCacheMisses() { return _textCacheMisses; }
+    
+    // Display list - record the layout once, replay it for every page.
+    // beginRecording() declines when the list's heap would split the frame
+    // buffer into more pages; endRecording() returns false if the list
+    // overflowed. Either way the caller draws inside the paging loop.
+    bool beginRecording();
+    bool endRecording();
+    bool hasRecording() { return _list.isActive() && !_recording; }
+    void replay();
     
     bool canLightSleep();
     
+    // Asynchronous refresh - the last nextPage() triggers the refresh and returns,
+    // the BUSY falling edge signals completion. endDraw() then defers powerOff()
+    // to waitRefresh(), which has to run before deep sleep. With the radio off
+    // waitRefresh() light-sleeps until BUSY drops.
+    void setAsyncRefresh(bool async) { _asyncRefresh = async; }
+    bool isRefreshing() { return _refreshing && !_refreshComplete; }
+    bool waitRefresh(uint32_t timeoutMs = 30000);
+    
     // Fast update mode
     void setFastUpdate(bool fast) { _fastUpdate = fast; }
     
+    // Differential refresh - partial refresh of the tiles that changed since the
+    // last frame; the refresh policy decides when a full refresh is due instead
+    void setDifferentialRefresh(bool enabled) { _diffRefresh = enabled; }
+    RefreshPolicy &getRefreshPolicy() { return _refreshPolicy; }
+    // Panel no longer matches the stored tile hashes - everywhere, or just
+    // inside a virtual rectangle (e.g. after a popup or clock repaint)
+    void invalidateTiles();
+    void invalidateTiles(int x, int y, int w, int h);
+    
+    // SPI clock used for the next powerOn()
+    void setSPIFrequency(uint32_t frequency) { _spiFrequency = frequency; }
+    
     // Popup mode - disables paging, stores only popup window in buffer
     void setPopupMode(bool enabled, int x = 0, int y = 0, int w = 0, int h = 0);
+    
+    // Popup surface - independent windows (status line, QR block, ...) over a
+    // popup area that is otherwise blanked. Windows are drawn like pages, each
+    // into a buffer of its own size that is written to panel RAM when done, and
+    // the whole area is refreshed once after the last one:
+    //   beginPopupSurface(area); addPopupWindow(...); ...
+    //   firstPopupWindow(); do { draw } while (nextPopupWindow()); endDraw();
+    //   setPopupMode(false);
+    void beginPopupSurface(int x, int y, int w, int h);
+    bool addPopupWindow(int x, int y, int w, int h);  // false when outside or full
+    bool firstPopupWindow();  // beginDraw() for the first window; false, panel untouched, without a buffer
+    bool nextPopupWindow();
 
 private:
     uint8_t *frameBuffer = nullptr;
+    uint32_t _bufferSize = 0;  // Bytes allocated for frameBuffer
+    uint8_t *_backBuffer = nullptr;  // Second band in double-buffered mode
+    TaskHandle_t _uploadTask = nullptr;
+    SemaphoreHandle_t _uploadStart = nullptr;
+    SemaphoreHandle_t _uploadDone = nullptr;
+    uint8_t *_uploadBuffer = nullptr;  // Band handed to the upload task
+    int _uploadPage = 0;
+    bool _uploadPending = false;
+    uint8_t _spiChunk[EPD102_SPI_CHUNK];
     int currentPage = 0;
+    int _pages = 1;            // Horizontal bands per frame
+    int _pageRows = EPD102_HEIGHT;  // Physical rows per band
+    uint32_t _pageBytes = EPD102_FRAME_BYTES;
+    unsigned long _frameStart = 0;  // millis() at firstPage()
+    uint32_t _minFreeHeap = 0;      // Lowest free heap seen during the frame
+    DisplayList _list;
+    bool _recording = false;
+    uint32_t _primitivesDrawn = 0;
+    uint32_t _primitivesCulled = 0;
+    TextBounds_t _textCache[EPD102_TEXT_CACHE_SIZE] = {};
+    FontMetrics_t _fontMetrics[EPD102_FONT_SLOTS] = {};
+    uint32_t _textCacheHits = 0;
+    uint32_t _textCacheMisses = 0;
+    int _nestedDraw = 0;  // >0 while a composite primitive draws its parts
     bool _fastUpdate = false;  // Default to FULL refresh for proper contrast
+    bool _diffRefresh = false;
+    bool _diffFrame = false;   // Current frame is a differential one
+    RefreshPolicy _refreshPolicy = RefreshPolicy(EPD102_WIDTH * EPD102_HEIGHT);
+    RefreshMode_t _refreshMode = REFRESH_FULL;  // Refresh the current frame ends with
+    uint16_t _changedTiles[EPD102_TILE_GRID_ROWS];  // Bit per tile column
+    int _changedTileCount = 0;
+    bool _asyncRefresh = false;
+    bool _refreshing = false;               // Refresh triggered, not yet waited for
+    volatile bool _refreshComplete = false; // Set from the BUSY interrupt
+    bool _powerOffPending = false;
+    unsigned long _refreshStart = 0;
+    SemaphoreHandle_t _refreshDone = nullptr;
+    uint32_t _spiFrequency = EPD102_SPI_FREQUENCY;
+    uint32_t _uploadBytes = 0;   // RAM bytes streamed in the current frame
+    uint32_t _uploadMicros = 0;  // Time spent streaming them
     bool _mirror = false;
     bool _popupMode = false;   // Popup mode - no paging, windowed buffer
     int _popupX = 0, _popupY = 0, _popupW = 0, _popupH = 0;  // Popup virtual coords
+    Rectangle_t _surfaceArea = {0, 0, 0, 0};  // Popup surface, blank outside its windows
+    Rectangle_t _surfaceWindows[EPD102_POPUP_WINDOWS];
+    int _surfaceWindowCount = 0;
+    int _surfaceWindow = -1;  // Window being drawn, -1 outside a surface pass
     static FontScale_t currentFontScale;
     
     // Font helpers
@@ -142,11 +464,129 @@ private:
     // Color mapping - maps unified colors to greyscale
     uint16_t mapColor(uint16_t color);
     
+    // Text layout shared by the Font and scaled-Font entry points
+    Rectangle_t drawTextWithFont(const GFXfont *font, const char *text, size_t length, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical,
+        int foregroundColor, int backgroundColor);
+    Rectangle_t measureTextWithFont(const GFXfont *font, const char *text, size_t length, int x, int y,
+        Alignment horizontal, Alignment vertical,
+        int margin_horizontal, int margin_vertical);
+    int textHeightWithFont(const GFXfont *font, const char *text, size_t length);
+    // Cursor of aligned code page text, with its glyph box relative to it
+    void alignText(const GFXfont *font, const char *textCP, size_t lengthCP, int &x, int &y,
+        Alignment horizontal, Alignment vertical, int margin_horizontal, int margin_vertical,
+        int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+    
+    // getTextBounds() at the origin and the "X" height through the memos;
+    // font must already be set, as a miss measures with it
+    void textBounds(const GFXfont *font, const char *textCP, size_t length,
+        int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+    uint16_t capHeight(const GFXfont *font);
+    
+    // Text output shared by drawText()/drawTextScaled() and replay - prints or records
+    void printText(const GFXfont *font, const char *textCP, int x, int y,
+        int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t color);
+    void fillCircleMapped(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    
+    // blit() without recording, culling or counting: clipped to the screen and
+    // the current page (or popup window), written a frame buffer byte at a time
+    void blitSpans(const Bitmap_t *bitmap, int x, int y, int scale, BlitOp_t op, uint16_t color);
+    // 4-bit greyscale image (w / 2 bytes per row), one write per frame buffer
+    // byte; only the rows of the current page are decoded
+    void greySpans(const uint8_t *data, int x, int y, int w, int h);
+    
+#if EPD102_GLYPH_ATLAS
+    // Atlas text: each glyph blitted as a column bitmap
+    const FontAtlas_t *findAtlas(const GFXfont *font);
+    void blitText(const FontAtlas_t *atlas, const char *textCP, int x, int y, uint16_t color);
+#endif
+    
+    // Where the frame buffer sits: bit 7 of byte 0 in each row is coordinate
+    // bitOrigin along the bit axis, rows are stride bytes apart and start at
+    // coordinate firstRow. Controller layout: bits = physical X, rows = physical Y.
+    // Portrait-native layout: bits = virtual x, rows = virtual y.
+    typedef struct {
+        int bitOrigin;
+        int stride;
+        int firstRow;
+        int rows;
+    } BufferView_t;
+    BufferView_t _view = {0, 0, 0, 0};  // Current page or popup window, drawn into
+    BufferView_t bufferView() { return _view; }
+    BufferView_t bufferView(int page);
+    void updateView() { _view = bufferView(currentPage); }
+    
+    // Frame buffer byte holding virtual pixel (x, y), nullptr when not buffered
+    uint8_t *pixelByte(int x, int y, uint8_t &mask);
+    
+    // Region operation on the frame buffer rows covered by a virtual rectangle,
+    // clipped to the screen and the current page (or popup window): 32-bit
+    // words between byte edge masks. No recording, culling or counting.
+    typedef enum : uint8_t {
+        REGION_FILL,    // Dithered tone of color (white clears)
+        REGION_INVERT,
+        REGION_COPY     // From the rectangle at (fromX, fromY)
+    } RegionOp_t;
+    void regionSpans(int x, int y, int w, int h, RegionOp_t op, uint16_t color, int fromX = 0, int fromY = 0);
+    
+    // Virtual-coordinate bounds check against the current page band (or popup window)
+    bool intersectsPage(int x, int y, int w, int h);
+    // Same check for a whole primitive; updates the drawn/culled counters
+    bool cullPrimitive(int x, int y, int w, int h);
+    void curveBounds(int x[], int y[], int n, int thickness, Rectangle_t &bounds);
+    // Thick polyline (1/16 px points, round joins and caps) as merged spans per
+    // frame buffer row, each covered pixel written once. No recording or culling.
+    void fillPolyline(const int16_t *points, int count, int radius, uint16_t color);
+    
     // SPI communication
     void writeSPI(unsigned char value);
     void writeData(unsigned char data);
     void writeCommand(unsigned char command);
+    void writeBuffer(const uint8_t *data, size_t length, bool invert = false);
+    void writeFill(uint8_t value, size_t length);
+    // RAM plane content: frame, inverted frame (drive every pixel), or
+    // frame with only the changed tiles inverted (drive just those)
+    typedef enum {
+        PLANE_NEW,
+        PLANE_INVERTED,
+        PLANE_DIFF
+    } UploadPlane_t;
+    
+    void writePage(const uint8_t *buffer, int page, UploadPlane_t plane);
+    uint8_t planeFlip(UploadPlane_t plane, int physY, int col);
+    void hashPageTiles(const uint8_t *buffer, int page);
+    void finishDiffFrame();
+    void uploadPage(const uint8_t *buffer, int page);
+    
+    // Double-buffered paging
+    void allocateBackBuffer();
+    void freeBackBuffer();
+    static void uploadTaskMain(void *arg);
+    void waitUpload();
+    // Partial refresh session: reset, RAM planes of each window, one refresh.
+    // refreshWindows() charges the changed area to the ghosting budget.
+    void beginWindowSession();
+    void writeWindow(int x, int y, int w, int h, bool blank);
+    void refreshWindows(uint32_t changedPixels);
+    void writeWindowPlane(int phys_x_start, int phys_y_start, int phys_y_end, int bytes_per_row, bool invert);
+#if EPD102_PORTRAIT_NATIVE
+    // Stream physical rows [physYStart, physYEnd] of a portrait-native buffer
+    // holding the given page, bytesPerRow bytes from physical byte column colStart
+    void writeNativeRows(const uint8_t *buffer, int page, int physYStart, int physYEnd,
+        int colStart, int bytesPerRow, UploadPlane_t plane);
+#endif
+    void logUploadRate();
+    void logFrameStats();
     void waitBusy();
+    void startRefresh();
+    static void busyISR(void *arg);
+    
+    // Paging
+    bool allocateFrameBuffer();
+    static int pagesFor(uint32_t maxAlloc);
+    void setPageCount(int pages);
+    uint32_t popupBufferSize();
     
     // Power management
     void powerOn();
@@ -0,0 +1,81 @@
+#include "DisplayList.hpp"
+#include "../../Logging/Logging.hpp"
+
+bool DisplayList::begin()
+{
+    end();
+    commands = (DrawCommand_t *)malloc(DISPLAY_LIST_MAX_COMMANDS * sizeof(DrawCommand_t));
+    pool = (uint8_t *)malloc(DISPLAY_LIST_POOL_BYTES);
+    if (commands == nullptr || pool == nullptr) {
+        LOGD("DisplayList: Failed to allocate command buffer");
+        end();
+        return false;
+    }
+    return true;
+}
+
+void DisplayList::end()
+{
+    if (commands != nullptr) {
+        free(commands);
+        commands = nullptr;
+    }
+    if (pool != nullptr) {
+        free(pool);
+        pool = nullptr;
+    }
+    commandCount = 0;
+    poolUsed = 0;
+    overflowed = false;
+}
+
+DrawCommand_t *DisplayList::add(DrawCommandType_t type, int boundsX, int boundsY, int boundsW, int boundsH)
+{
+    if (commands == nullptr || commandCount >= DISPLAY_LIST_MAX_COMMANDS) {
+        overflowed = true;
+        return nullptr;
+    }
+    DrawCommand_t *cmd = &commands[commandCount++];
+    memset(cmd, 0, sizeof(DrawCommand_t));
+    cmd->type = type;
+    cmd->boundsX = boundsX;
+    cmd->boundsY = boundsY;
+    cmd->boundsW = boundsW;
+    cmd->boundsH = boundsH;
+#if PROFILING
+    cmd->section = Profiler::getSection();
+#endif
+    return cmd;
+}
+
+const char *DisplayList::storeText(const char *text, int length)
+{
+    if (pool == nullptr || poolUsed + length + 1 > DISPLAY_LIST_POOL_BYTES) {
+        overflowed = true;
+        return nullptr;
+    }
+    char *dst = (char *)&pool[poolUsed];
+    memcpy(dst, text, length);
+    dst[length] = 0;
+    poolUsed += length + 1;
+    return dst;
+}
+
+const int16_t *DisplayList::storePoints(const int x[], const int y[], int n)
+{
+    // Keep int16_t alignment
+    int start = (poolUsed + 1) & ~1;
+    int bytes = n * 2 * sizeof(int16_t);
+    if (pool == nullptr || start + bytes > DISPLAY_LIST_POOL_BYTES ||
+        n > DISPLAY_LIST_MAX_CURVE_POINTS) {
+        overflowed = true;
+        return nullptr;
+    }
+    int16_t *dst = (int16_t *)&pool[start];
+    for (int i = 0; i < n; i++) {
+        dst[2 * i] = x[i];
+        dst[2 * i + 1] = y[i];
+    }
+    poolUsed = start + bytes;
+    return dst;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../../Logging/Profiler.hpp"
+
+// Capacity of one recorded frame - the dashboard records 181 commands and about
+// 550 pool bytes; the rest is headroom for longer localized text. The list is
+// allocated before the frame buffer, so every byte here is heap the paging
+// heuristic can't use (about 8 KB on the ESP32).
+#ifndef DISPLAY_LIST_MAX_COMMANDS
+#define DISPLAY_LIST_MAX_COMMANDS 224
+#endif
+#ifndef DISPLAY_LIST_POOL_BYTES
+#define DISPLAY_LIST_POOL_BYTES 1024
+#endif
+// Longest curve that can be recorded - replay unpacks it into a stack buffer
+#ifndef DISPLAY_LIST_MAX_CURVE_POINTS
+#define DISPLAY_LIST_MAX_CURVE_POINTS 48
+#endif
+
+typedef enum : uint8_t {
+    CMD_PIXEL,
+    CMD_FILL_RECT,
+    CMD_FILL_CIRCLE,
+    CMD_INVERT_RECT,
+    CMD_COPY_RECT,
+    CMD_TEXT,
+    CMD_BLIT,
+    CMD_IMAGE,
+    CMD_CURVE
+} DrawCommandType_t;
+
+/**
+ * One recorded primitive. Geometry is already resolved (alignment, margins,
+ * text cursor), so replay never measures or formats anything again.
+ */
+typedef struct {
+    DrawCommandType_t type;
+    uint8_t arg;          // Blit scale / curve thickness
+    uint16_t color;       // Already mapped for text and circles
+    int16_t x, y, w, h;   // Primitive geometry (w = radius for circles, point count for curves, op for blits)
+    int16_t boundsX, boundsY, boundsW, boundsH;  // Virtual bounding box used for page culling
+    const void *data;     // Font, bitmap or image
+    const void *pooled;   // Text or curve points copied into the pool
+#if PROFILING
+    ProfileSection_t section;  // Dashboard section the replay time is charged to
+#endif
+} DrawCommand_t;
+
+/**
+ * Flat command buffer filled by one layout pass and replayed for every page.
+ * Strings and point arrays are copied into a fixed pool so the recorded frame
+ * does not depend on the caller's temporaries.
+ */
+class DisplayList
+{
+public:
+    ~DisplayList() { end(); }
+
+    // Heap taken by begin()
+    static constexpr size_t HEAP_BYTES = DISPLAY_LIST_MAX_COMMANDS * sizeof(DrawCommand_t) + DISPLAY_LIST_POOL_BYTES;
+
+    bool begin();
+    void end();
+
+    bool isActive() { return commands != nullptr; }
+    bool hasOverflowed() { return overflowed; }
+    int size() { return commandCount; }
+    const DrawCommand_t &at(int index) { return commands[index]; }
+
+    // Append a command with its bounding box; returns nullptr once the list is full
+    DrawCommand_t *add(DrawCommandType_t type, int boundsX, int boundsY, int boundsW, int boundsH);
+
+    // Copy data into the pool; returns nullptr once the pool is full or the
+    // curve is longer than DISPLAY_LIST_MAX_CURVE_POINTS
+    const char *storeText(const char *text, int length);
+    const int16_t *storePoints(const int x[], const int y[], int n);
+
+private:
+    DrawCommand_t *commands = nullptr;
+    uint8_t *pool = nullptr;
+    int commandCount = 0;
+    int poolUsed = 0;
+    bool overflowed = false;
+};
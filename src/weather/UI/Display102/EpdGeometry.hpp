@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Compile-time panel geometry. Maps virtual (drawing) coordinates to the two
+ * frame buffer axes - the bit axis (8 pixels per byte, MSB first) and the row
+ * axis - for a WIDTH x HEIGHT controller. PORTRAIT rotates 90 degrees CCW
+ * (physX = y, physY = HEIGHT - 1 - x). NATIVE keeps portrait rows contiguous
+ * in the buffer and leaves the rotation to the upload.
+ *
+ * Everything is constexpr, so with the constants of one instantiation the
+ * rotation folds into the address arithmetic and byte/bit selection become
+ * shifts and masks.
+ */
+template <int WIDTH, int HEIGHT, bool PORTRAIT, bool NATIVE>
+struct EpdGeometry
+{
+    static_assert(WIDTH % 8 == 0 && HEIGHT % 8 == 0, "Panel sides must be whole bytes");
+    static_assert(PORTRAIT || !NATIVE, "Native layout only exists for portrait");
+
+    static constexpr int ROW_BYTES = WIDTH / 8;
+    static constexpr uint32_t FRAME_BYTES = (uint32_t)ROW_BYTES * HEIGHT;
+    static constexpr int VIRTUAL_WIDTH = PORTRAIT ? HEIGHT : WIDTH;
+    static constexpr int VIRTUAL_HEIGHT = PORTRAIT ? WIDTH : HEIGHT;
+
+    // Buffer coordinates of a virtual pixel, before the page/popup offsets
+    static constexpr int bit(int x, int y) { return NATIVE || !PORTRAIT ? x : y; }
+    static constexpr int row(int x, int y) { return NATIVE || !PORTRAIT ? y : HEIGHT - 1 - x; }
+
+    // A buffer row is one virtual line - a column (x) in the rotated portrait
+    // layout, a row (y) otherwise - with the bit axis running along the other
+    // virtual axis in increasing order
+    static constexpr bool BITS_ALONG_X = NATIVE || !PORTRAIT;
+    static constexpr int line(int x, int y) { return BITS_ALONG_X ? y : x; }
+    static constexpr int lineOf(int row) { return BITS_ALONG_X ? row : HEIGHT - 1 - row; }
+
+    // Half-open buffer ranges covered by a virtual rectangle
+    static constexpr int bitStart(int x, int y, int /*w*/, int /*h*/) { return NATIVE || !PORTRAIT ? x : y; }
+    static constexpr int bitEnd(int x, int y, int w, int h) { return NATIVE || !PORTRAIT ? x + w : y + h; }
+    static constexpr int rowStart(int x, int y, int w, int /*h*/) { return NATIVE || !PORTRAIT ? y : HEIGHT - x - w; }
+    static constexpr int rowEnd(int x, int y, int /*w*/, int h) { return NATIVE || !PORTRAIT ? y + h : HEIGHT - x; }
+
+    // Dither row parity of a buffer row - the patterns are symmetric, so only
+    // the parity of the virtual coordinate along the row axis matters
+    static constexpr int rowParity(int row) { return NATIVE || !PORTRAIT ? row & 1 : (HEIGHT - 1 - row) & 1; }
+
+    // Byte and bit mask of a non-negative bit offset
+    static constexpr int byteOf(int bit) { return bit >> 3; }
+    static constexpr uint8_t maskOf(int bit) { return 0x80 >> (bit & 7); }
+};
@@ -0,0 +1,52 @@
+#include "RefreshPolicy.hpp"
+#include "../../Logging/Logging.hpp"
+
+// Refresh history - survives deep sleep
+RTC_DATA_ATTR static uint16_t rtcFastFrames = 0;     // Since the last full refresh
+RTC_DATA_ATTR static uint32_t rtcGhostingPixels = 0;  // Changed pixels since the last full refresh
+
+RefreshMode_t RefreshPolicy::beginFrame(bool panelKnown)
+{
+    if (!panelKnown) {
+        return REFRESH_FULL;
+    }
+    if (rtcFastFrames >= EPD102_FULL_REFRESH_EVERY) {
+        LOGD("RefreshPolicy: " + String(rtcFastFrames) + " fast frames, full refresh");
+        return REFRESH_FULL;
+    }
+    if (rtcGhostingPixels >= (uint64_t)panelPixels * EPD102_GHOSTING_BUDGET_PERCENT / 100) {
+        LOGD("RefreshPolicy: Ghosting budget spent (" + String(rtcGhostingPixels) + " px), full refresh");
+        return REFRESH_FULL;
+    }
+    return REFRESH_FAST;
+}
+
+RefreshMode_t RefreshPolicy::endFrame(RefreshMode_t mode, uint32_t changedPixels)
+{
+    if (mode == REFRESH_FAST && changedPixels > (uint64_t)panelPixels * EPD102_LARGE_CHANGE_PERCENT / 100) {
+        LOGD("RefreshPolicy: Large change (" + String(changedPixels) + " px), promoted to full refresh");
+        mode = REFRESH_FULL;
+    }
+
+    if (mode == REFRESH_FULL) {
+        rtcFastFrames = 0;
+        rtcGhostingPixels = 0;
+    } else if (changedPixels > 0) {
+        // Frames skipped as unchanged add no ghosting
+        rtcFastFrames++;
+        rtcGhostingPixels += changedPixels;
+        LOGD("RefreshPolicy: Fast frame " + String(rtcFastFrames) + "/" + String(EPD102_FULL_REFRESH_EVERY) +
+             ", ghosting " + String(rtcGhostingPixels) + " px");
+    }
+    return mode;
+}
+
+uint16_t RefreshPolicy::getFastFrames()
+{
+    return rtcFastFrames;
+}
+
+uint32_t RefreshPolicy::getGhostingPixels()
+{
+    return rtcGhostingPixels;
+}
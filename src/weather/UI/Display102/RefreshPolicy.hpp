@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Fast (partial) refreshes between forced full ones
+#ifndef EPD102_FULL_REFRESH_EVERY
+#define EPD102_FULL_REFRESH_EVERY 10
+#endif
+// A single frame changing more than this share of the panel gets a full refresh
+#ifndef EPD102_LARGE_CHANGE_PERCENT
+#define EPD102_LARGE_CHANGE_PERCENT 50
+#endif
+// Ghosting budget - changed area accumulated over fast refreshes, in percent of
+// the panel, after which the next frame is a full refresh
+#ifndef EPD102_GHOSTING_BUDGET_PERCENT
+#define EPD102_GHOSTING_BUDGET_PERCENT 200
+#endif
+
+typedef enum {
+    REFRESH_FULL,  // 0xF7 greyscale waveform, restores contrast
+    REFRESH_FAST   // 0xFF partial waveform, driven from the 0x26 plane
+} RefreshMode_t;
+
+/**
+ * Chooses between fast and full refreshes across deep sleep cycles. Fast
+ * refreshes are the default; a full one is forced after EPD102_FULL_REFRESH_EVERY
+ * fast frames, once the ghosting budget is spent, or when a single frame
+ * changes a large part of the panel. The counters live in RTC memory.
+ */
+class RefreshPolicy
+{
+public:
+    RefreshPolicy(uint32_t panelPixels) : panelPixels(panelPixels) {}
+
+    // Mode to upload the next frame with; fast only when the panel content is known
+    RefreshMode_t beginFrame(bool panelKnown);
+    // Refresh to run for a finished frame, given an estimate of the pixels that
+    // changed - a fast frame can still be promoted to a full refresh here
+    RefreshMode_t endFrame(RefreshMode_t mode, uint32_t changedPixels);
+
+    uint16_t getFastFrames();
+    uint32_t getGhostingPixels();
+
+private:
+    uint32_t panelPixels;
+};
@@ -0,0 +1,8841 @@
+#pragma once
+
+// Pre-rotated glyph atlases for Display102 - generated by fontAtlas_script.py, do not edit.
+// Glyph columns left to right, ceil(height / 8) bytes each, top pixel in the MSB.
+
+// InterTightSemiBold6pt8bfr.h
+static const uint8_t InterTight_SemiBold6pt8b_Atlas[] PROGMEM = {
+    0x00, 0xFD, 0x80, 0xFD, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0x04, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x24,
+    0x00, 0x2F, 0x80, 0xFC, 0x00, 0x24, 0x00, 0x39, 0x80, 0x7D, 0xC0, 0x4C, 0x40, 0xFF, 0xE0, 0x46,
+    0x40, 0x67, 0xC0, 0x23, 0x80, 0x60, 0x00, 0x91, 0x80, 0x93, 0x00, 0x6C, 0x00, 0x1B, 0x00, 0x64,
+    0x80, 0xC4, 0x80, 0x03, 0x00, 0x77, 0x00, 0xFF, 0x80, 0x9C, 0x80, 0x9E, 0x80, 0xF6, 0x80, 0x61,
+    0x00, 0x06, 0x80, 0x00, 0x00, 0xE0, 0xE0, 0x1F, 0x00, 0x7F, 0xC0, 0xC0, 0x60, 0xC0, 0x60, 0x7F,
+    0xC0, 0x1F, 0x00, 0x50, 0x50, 0xF8, 0x50, 0x50, 0x10, 0x10, 0xFC, 0xFC, 0x10, 0x10, 0x00, 0xF0,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x00, 0x60, 0x07, 0xC0, 0x7C, 0x00, 0xC0, 0x00, 0x3E,
+    0x00, 0x7F, 0x00, 0xC1, 0x80, 0x80, 0x80, 0xC1, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0x60, 0x00, 0xC0,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0x60, 0x80, 0xC3, 0x80, 0x87, 0x80, 0x8E, 0x80, 0xF8, 0x80, 0x70,
+    0x80, 0x00, 0x00, 0x41, 0x00, 0x80, 0x80, 0x88, 0x80, 0x88, 0x80, 0xF7, 0x80, 0x77, 0x00, 0x06,
+    0x00, 0x1E, 0x00, 0x32, 0x00, 0xE2, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x02, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x90, 0x80, 0x90, 0x80, 0x99, 0x80, 0x9F, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0xC9,
+    0x80, 0x90, 0x80, 0x99, 0x80, 0xDF, 0x80, 0x4F, 0x00, 0x80, 0x00, 0x81, 0x80, 0x87, 0x00, 0x9C,
+    0x00, 0xF0, 0x00, 0xC0, 0x00, 0x77, 0x00, 0xF7, 0x80, 0x88, 0x80, 0x88, 0x80, 0xF7, 0x80, 0x77,
+    0x00, 0x79, 0x00, 0xFD, 0x80, 0xC4, 0x80, 0x84, 0x80, 0xC9, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0xC6,
+    0xC6, 0xC7, 0x80, 0xC4, 0x00, 0x30, 0x38, 0x68, 0x6C, 0x44, 0xC6, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0xC6, 0x44, 0x6C, 0x68, 0x38, 0x30, 0x40, 0x00, 0xC0, 0x00, 0x8D, 0x80, 0x9D, 0x80, 0xF0,
+    0x00, 0x70, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x6F, 0x60, 0xDF, 0xB0, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0xDF, 0x90, 0x60, 0x80, 0x7F, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x07, 0x80, 0x1E, 0x00, 0xFA,
+    0x00, 0xC2, 0x00, 0xFA, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x88,
+    0x80, 0x88, 0x80, 0xF8, 0x80, 0x77, 0x80, 0x07, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0xC1, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x63, 0x00, 0x22, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xC1, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88,
+    0x80, 0x88, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x3E,
+    0x00, 0x7F, 0x00, 0xC1, 0x80, 0x80, 0x80, 0x88, 0x80, 0xC9, 0x80, 0x6F, 0x00, 0x2E, 0x00, 0xFF,
+    0x80, 0xFF, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF,
+    0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF,
+    0x80, 0x0C, 0x00, 0x3C, 0x00, 0x66, 0x00, 0xC3, 0x80, 0x80, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x70, 0x00, 0x0E, 0x00, 0x01,
+    0x80, 0x1E, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x70, 0x00, 0x1C,
+    0x00, 0x07, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3E, 0x00, 0x7F, 0x00, 0xC1, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xC1, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x84, 0x00, 0x84, 0x00, 0xFC,
+    0x00, 0x78, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0xC1, 0x80, 0x80, 0x80, 0x83, 0x80, 0xC1, 0x80, 0x7F,
+    0xC0, 0x3E, 0x40, 0xFF, 0x80, 0xFF, 0x80, 0x88, 0x00, 0x8E, 0x00, 0xFB, 0x80, 0x70, 0x80, 0x73,
+    0x00, 0xFB, 0x80, 0x98, 0x80, 0x98, 0x80, 0x8C, 0x80, 0xCF, 0x80, 0x47, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0x80, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x07,
+    0x80, 0x03, 0x80, 0x1F, 0x00, 0xF8, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
+    0x80, 0x3E, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x7E, 0x00, 0xF0, 0x00, 0x80,
+    0x80, 0xC1, 0x80, 0x77, 0x00, 0x1C, 0x00, 0x3E, 0x00, 0xF7, 0x00, 0xC1, 0x80, 0x00, 0x00, 0x80,
+    0x00, 0xE0, 0x00, 0x78, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x78, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x81,
+    0x80, 0x83, 0x80, 0x8E, 0x80, 0xB8, 0x80, 0xE0, 0x80, 0xC0, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0x80,
+    0x20, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x60, 0x80, 0x20, 0xFF, 0xE0, 0xFF, 0xE0, 0x08,
+    0x78, 0xC0, 0x70, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xC0, 0x00, 0x4C, 0xDE, 0x92,
+    0x92, 0xFE, 0x7E, 0xFF, 0x80, 0xFF, 0x80, 0x20, 0x80, 0x20, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x3C,
+    0xFE, 0xC6, 0x82, 0xC2, 0x44, 0x1F, 0x00, 0x3F, 0x80, 0x20, 0x80, 0x20, 0x80, 0xFF, 0x80, 0xFF,
+    0x80, 0x7C, 0xFE, 0x92, 0x92, 0xF6, 0x74, 0x20, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0xA0, 0x00, 0x80,
+    0x00, 0x7C, 0x80, 0xFE, 0xC0, 0x82, 0x40, 0x82, 0x40, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xFF,
+    0x80, 0x20, 0x00, 0x20, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0xDF, 0xC0, 0xDF, 0xC0, 0x00, 0x08, 0xDF,
+    0xF8, 0xDF, 0xF0, 0xFF, 0x80, 0xFF, 0x80, 0x0C, 0x00, 0x1F, 0x00, 0x33, 0x80, 0x20, 0x80, 0xFF,
+    0x80, 0xFF, 0x80, 0xFE, 0xFE, 0x80, 0x80, 0xFE, 0x7E, 0x80, 0x80, 0xFE, 0x7E, 0xFE, 0xFE, 0x80,
+    0x80, 0xFE, 0x7E, 0x7C, 0xFE, 0x82, 0x82, 0xFE, 0x7C, 0xFF, 0xC0, 0xFF, 0xC0, 0x82, 0x00, 0x82,
+    0x00, 0xFE, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xFE, 0x00, 0x82, 0x00, 0x82, 0x00, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xFE, 0xFE, 0x80, 0x80, 0x64, 0xF6, 0xB2, 0x9A, 0xDE, 0x0C, 0x20, 0x00, 0xFF, 0x00, 0xFF,
+    0x80, 0x20, 0x80, 0xFC, 0xFE, 0x02, 0x02, 0xFE, 0xFE, 0x80, 0xF0, 0x1E, 0x0E, 0x7C, 0xE0, 0xC0,
+    0xFC, 0x0E, 0x3E, 0xE0, 0xF8, 0x0E, 0x7E, 0xE0, 0x82, 0xC6, 0x7C, 0x38, 0xEE, 0x82, 0x80, 0x00,
+    0xF8, 0x40, 0x1F, 0xC0, 0x0F, 0x80, 0x7C, 0x00, 0xE0, 0x00, 0x86, 0x8E, 0xBA, 0xE2, 0xC2, 0x04,
+    0x00, 0x7F, 0xC0, 0xFB, 0xE0, 0x80, 0x20, 0xFF, 0xFE, 0xFF, 0xFE, 0x80, 0x20, 0x80, 0x20, 0xFB,
+    0xE0, 0x7F, 0xC0, 0x04, 0x00, 0xC0, 0x80, 0x80, 0x40, 0x40, 0xC0, 0x00, 0x00, 0x80, 0x07, 0x80,
+    0x1E, 0x00, 0xFA, 0x00, 0xC2, 0x00, 0xFA, 0x00, 0x1E, 0x00, 0x03, 0xF0, 0x00, 0x90, 0x80, 0x40,
+    0x40, 0x80, 0x08, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x08, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0xBF, 0x42, 0x81, 0x81, 0x81, 0x42, 0xBF, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x40, 0xC0, 0x40, 0x00,
+    0x40, 0x0E, 0x60, 0x1F, 0x70, 0x13, 0x10, 0xD3, 0x10, 0x91, 0x90, 0x19, 0xF0, 0x08, 0xE0, 0x00,
+    0x00, 0x6E, 0x40, 0x93, 0x20, 0x9B, 0x20, 0xC9, 0xE0, 0x46, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x0E,
+    0x60, 0x1F, 0x70, 0xD3, 0x10, 0x53, 0x10, 0x91, 0x90, 0x19, 0xF0, 0x08, 0xE0, 0x73, 0x00, 0xFB,
+    0x80, 0x98, 0x80, 0x98, 0xD0, 0x8C, 0xA0, 0xCF, 0x80, 0x47, 0x00, 0x10, 0x00, 0x90, 0x00, 0x5F,
+    0xF0, 0x5F, 0xF0, 0x90, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x30, 0x10, 0x70, 0x11, 0xD0, 0xD7,
+    0x10, 0x1C, 0x10, 0x18, 0x10, 0x80, 0x80, 0x80, 0x80, 0x10, 0x30, 0x90, 0x70, 0xD1, 0xD0, 0xD7,
+    0x10, 0x9C, 0x10, 0x18, 0x10, 0x10, 0x30, 0x10, 0x70, 0xD1, 0xD0, 0xD7, 0x10, 0x1C, 0x10, 0x18,
+    0x10, 0x60, 0x90, 0x90, 0x60, 0x4C, 0x00, 0xDE, 0x00, 0x92, 0x00, 0x92, 0x00, 0xFF, 0x80, 0x7E,
+    0x80, 0x40, 0xE0, 0x20, 0x08, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x10, 0x00, 0x40, 0xC0, 0x00, 0x7F,
+    0xC0, 0x7F, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0x0C, 0x80, 0x1E, 0xC0, 0x16, 0x40, 0xD3, 0x40, 0x1B,
+    0xC0, 0x01, 0x80, 0x80, 0x40, 0xC0, 0x80, 0xA0, 0x60, 0x0C, 0x80, 0x9E, 0xC0, 0xD6, 0x40, 0xD3,
+    0x40, 0x9B, 0xC0, 0x01, 0x80, 0x64, 0x00, 0xF6, 0x00, 0xB3, 0x40, 0x9B, 0xC0, 0xDE, 0x00, 0x0C,
+    0x00, 0x10, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0xD0, 0x40, 0xC0, 0x00, 0x10, 0xC0, 0x11, 0xC0, 0x57,
+    0x40, 0x9C, 0x40, 0x18, 0x40, 0x40, 0xC0, 0x00, 0xC0, 0x80, 0x88, 0x60, 0xC8, 0xE0, 0x2B, 0xA0,
+    0xCE, 0x20, 0x8C, 0x20, 0x10, 0x40, 0x11, 0xC0, 0xD3, 0xC0, 0xDE, 0x40, 0x18, 0x40, 0x1F, 0xF0,
+    0x1F, 0xF0, 0x51, 0x00, 0x91, 0xC0, 0x1F, 0x70, 0x0E, 0x10, 0x00, 0x10, 0x00, 0xF0, 0x03, 0xC0,
+    0x1F, 0x40, 0xD8, 0x40, 0x9F, 0x40, 0x03, 0xC0, 0x00, 0x70, 0x00, 0x10, 0x00, 0x10, 0x00, 0xF0,
+    0x43, 0xC0, 0xDF, 0x40, 0x98, 0x40, 0xDF, 0x40, 0x03, 0xC0, 0x00, 0x70, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0xF0, 0x83, 0xC0, 0xDF, 0x40, 0x58, 0x40, 0xDF, 0x40, 0x83, 0xC0, 0x00, 0x70, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0xF0, 0x83, 0xC0, 0x9F, 0x40, 0x18, 0x40, 0x9F, 0x40, 0x83, 0xC0, 0x00, 0x70,
+    0x00, 0x10, 0x5F, 0xF0, 0xDF, 0xF0, 0x80, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x07, 0xC0,
+    0x0F, 0xE0, 0x18, 0x30, 0x10, 0x10, 0xD0, 0x10, 0x90, 0x10, 0x0C, 0x60, 0x04, 0x40, 0x3E, 0x00,
+    0x7F, 0x00, 0xC1, 0x80, 0x80, 0xD0, 0x80, 0xF0, 0xC1, 0x80, 0x63, 0x00, 0x07, 0xC0, 0x0F, 0xE0,
+    0x18, 0x30, 0xD0, 0x10, 0x50, 0x10, 0x90, 0x10, 0x0C, 0x60, 0x04, 0x40, 0x1F, 0xF0, 0x1F, 0xF0,
+    0x11, 0x10, 0xD1, 0x10, 0x91, 0x10, 0x11, 0x10, 0xFF, 0x80, 0xFF, 0x80, 0x88, 0x80, 0x88, 0x80,
+    0x88, 0xF0, 0x88, 0xD0, 0x1F, 0xF0, 0x9F, 0xF0, 0x91, 0x10, 0x91, 0x10, 0x91, 0x10, 0x10, 0x10,
+    0x1F, 0xF0, 0x9F, 0xF0, 0xD1, 0x10, 0x51, 0x10, 0x91, 0x10, 0x11, 0x10, 0x5F, 0xF0, 0xDF, 0xF0,
+    0x80, 0x00, 0x40, 0x00, 0x9F, 0xF0, 0x9F, 0xF0, 0x40, 0x00, 0x1F, 0xF0, 0x9F, 0xF0, 0x50, 0x10,
+    0xD0, 0x10, 0x18, 0x30, 0x0F, 0xE0, 0x07, 0xC0, 0x08, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x88, 0x80,
+    0x80, 0x80, 0xC1, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x0E, 0x00, 0xC3, 0x80,
+    0x80, 0xE0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x8E, 0x00, 0x43, 0x80, 0x80, 0xE0,
+    0x1F, 0xF0, 0x1F, 0xF0, 0x07, 0xC0, 0x0F, 0xE0, 0x18, 0x30, 0x10, 0x10, 0xD0, 0x10, 0x18, 0x30,
+    0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xE0, 0x58, 0x30, 0xD0, 0x10, 0xD0, 0x10, 0x58, 0x30,
+    0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xE0, 0x18, 0x30, 0xD0, 0x10, 0x10, 0x10, 0xD8, 0x30,
+    0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xE0, 0x98, 0x30, 0x90, 0x10, 0x90, 0x10, 0x98, 0x30,
+    0x0F, 0xE0, 0x07, 0xC0, 0xC4, 0x6C, 0x38, 0x38, 0xEC, 0x04, 0x1F, 0xF0, 0x9F, 0xF0, 0xD1, 0x00,
+    0xD1, 0xC0, 0x1F, 0x70, 0x0E, 0x10, 0x0F, 0xF0, 0x0F, 0xF8, 0x40, 0x08, 0xE0, 0x08, 0x00, 0x08,
+    0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x1F, 0xF0, 0x00, 0x10, 0xC0, 0x10, 0x80, 0x10, 0x1F, 0xE0,
+    0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0x40, 0x10, 0x80, 0x10, 0xC0, 0x10, 0x9F, 0xE0, 0x1F, 0xE0,
+    0x1F, 0xE0, 0x9F, 0xF0, 0x80, 0x10, 0x00, 0x10, 0x80, 0x10, 0x9F, 0xE0, 0x1F, 0xE0, 0x10, 0x00,
+    0x1C, 0x00, 0x0F, 0x00, 0x43, 0xF0, 0xC3, 0xF0, 0x8F, 0x00, 0x1C, 0x00, 0x10, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xFF, 0xD0, 0xFF, 0xF0, 0x80, 0x20, 0x80, 0x00, 0x80, 0x00, 0x7F, 0x80, 0xFF, 0x80,
+    0x80, 0x00, 0x88, 0x80, 0xFF, 0x80, 0x77, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0xD0, 0x00, 0x10, 0x00,
+    0x09, 0x80, 0x1B, 0xC0, 0x12, 0x40, 0xD2, 0x40, 0x9F, 0xC0, 0x0F, 0xC0, 0x09, 0x80, 0x5B, 0xC0,
+    0xD2, 0x40, 0x92, 0x40, 0x5F, 0xC0, 0x0F, 0xC0, 0x13, 0x00, 0x37, 0x80, 0xA4, 0x80, 0xA4, 0x80,
+    0xBF, 0x80, 0x1F, 0x80, 0x13, 0x00, 0xB7, 0x80, 0xA4, 0x80, 0xA4, 0x80, 0xBF, 0x80, 0x1F, 0x80,
+    0x5F, 0xF0, 0xDF, 0xF0, 0x80, 0x00, 0x07, 0x80, 0x1F, 0xC0, 0x18, 0xC0, 0x50, 0x40, 0x98, 0x40,
+    0x08, 0x80, 0x7C, 0x00, 0xFE, 0x00, 0x86, 0x00, 0x83, 0xC0, 0xC6, 0x00, 0x44, 0x00, 0x07, 0x80,
+    0x1F, 0xC0, 0x98, 0xC0, 0x50, 0x40, 0xD0, 0xC0, 0x08, 0x80, 0x0F, 0x80, 0x1F, 0xC0, 0x12, 0x40,
+    0xD2, 0x40, 0x1E, 0xC0, 0x0E, 0x80, 0x7C, 0x00, 0xFE, 0x00, 0x93, 0x80, 0x92, 0x80, 0xF6, 0x00,
+    0x74, 0x00, 0x1F, 0x00, 0xBF, 0x80, 0xA4, 0x80, 0xA4, 0x80, 0xBD, 0x80, 0x1D, 0x00, 0x0F, 0x80,
+    0x9F, 0xC0, 0xD2, 0x40, 0xD2, 0x40, 0x9E, 0xC0, 0x0E, 0x80, 0x5F, 0xC0, 0xDF, 0xC0, 0x80, 0x00,
+    0x20, 0x00, 0xCF, 0xE0, 0xCF, 0xE0, 0x20, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x10, 0x40, 0x10, 0x40,
+    0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x20, 0x80, 0xA0, 0x80,
+    0xFF, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x10, 0x00, 0xD0, 0x00, 0x1F, 0xC0,
+    0x0F, 0xC0, 0x1F, 0xC0, 0x9F, 0xC0, 0xD0, 0x00, 0xD0, 0x00, 0x9F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80,
+    0x1F, 0xC0, 0x10, 0x40, 0xD0, 0x40, 0x1F, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x5F, 0xC0, 0xD0, 0x40,
+    0xD0, 0x40, 0x1F, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0xC0, 0xD0, 0x40, 0x50, 0x40, 0x9F, 0xC0,
+    0x0F, 0x80, 0x1F, 0x00, 0xBF, 0x80, 0xA0, 0x80, 0xA0, 0x80, 0xBF, 0x80, 0x1F, 0x00, 0x10, 0x10,
+    0xD6, 0xD6, 0x10, 0x10, 0xCF, 0xE0, 0x6F, 0xE0, 0x68, 0x00, 0x88, 0x00, 0x0F, 0xC0, 0xEF, 0xE0,
+    0xA0, 0x20, 0xE0, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x1F, 0x80, 0x1F, 0xC0, 0x00, 0x40, 0xC0, 0x40,
+    0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0x80, 0x1F, 0xC0, 0xC0, 0x40, 0x00, 0x40, 0xDF, 0xC0, 0x9F, 0xC0,
+    0x3F, 0x00, 0xBF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xBF, 0x80, 0x3F, 0x80, 0x10, 0x00, 0x1F, 0x08,
+    0x03, 0xF8, 0xC1, 0xF0, 0x8F, 0x80, 0x1C, 0x00, 0x20, 0x00, 0xFF, 0x80, 0xFF, 0x90, 0x21, 0xF0,
+    0xC0, 0xC0,
+};
+static const uint32_t InterTight_SemiBold6pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 5, 9, 23, 37, 53, 69, 71, 77, 83, 88,
+    94, 97, 101, 103, 111, 125, 133, 145, 159, 173, 187, 201,
+    213, 225, 239, 241, 245, 251, 257, 263, 275, 297, 315, 329,
+    345, 359, 371, 383, 399, 413, 417, 429, 443, 455, 473, 487,
+    503, 515, 531, 543, 557, 571, 585, 601, 623, 639, 655, 667,
+    673, 681, 687, 692, 698, 701, 707, 719, 725, 737, 743, 753,
+    765, 777, 781, 787, 799, 803, 813, 819, 825, 837, 849, 853,
+    859, 867, 873, 879, 888, 894, 906, 911, 919, 923, 933, 939,
+    939, 940, 958, 962, 976, 983, 993, 1007, 1019, 1023, 1037, 1051,
+    1065, 1077, 1081, 1093, 1105, 1109, 1121, 1124, 1132, 1135, 1143, 1155,
+    1159, 1161, 1173, 1185, 1195, 1205, 1210, 1220, 1230, 1242, 1260, 1278,
+    1296, 1314, 1326, 1342, 1356, 1372, 1384, 1396, 1408, 1420, 1426, 1434,
+    1448, 1464, 1478, 1492, 1508, 1524, 1540, 1556, 1562, 1574, 1588, 1602,
+    1616, 1630, 1646, 1660, 1672, 1680, 1692, 1704, 1716, 1728, 1734, 1746,
+    1758, 1770, 1782, 1794, 1806, 1818, 1824, 1832, 1848, 1862, 1874, 1886,
+    1898, 1910, 1922, 1934, 1940, 1948, 1960, 1972, 1984, 1996, 2008, 2016,
+};
+
+// InterTightBold8pt8bfr.h
+static const uint8_t InterTight_Bold8pt8b_Atlas[] PROGMEM = {
+    0x00, 0xFF, 0x30, 0xFF, 0x30, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x01, 0x80, 0x19, 0xF0, 0x3F, 0xF0,
+    0xFF, 0x80, 0x99, 0x80, 0x19, 0xF0, 0x1F, 0xF0, 0xFF, 0x80, 0x99, 0x80, 0x18, 0x00, 0x00, 0x20,
+    0x0E, 0x38, 0x1F, 0x3C, 0x33, 0x8C, 0x31, 0x8C, 0xFF, 0xFF, 0x39, 0xCC, 0x18, 0xF8, 0x08, 0x70,
+    0x70, 0x00, 0xF8, 0x10, 0xD8, 0x70, 0xF8, 0xC0, 0x73, 0x80, 0x06, 0x00, 0x19, 0xE0, 0x33, 0xF0,
+    0xC3, 0x30, 0x83, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x7B, 0xE0, 0xFF, 0x30, 0xCF, 0x30, 0xCF, 0xB0,
+    0xF9, 0xF0, 0x70, 0xE0, 0x03, 0xF0, 0x03, 0x90, 0x00, 0x00, 0xF8, 0xF8, 0x1F, 0xF0, 0xFF, 0xFE,
+    0xF0, 0x1E, 0x80, 0x02, 0x80, 0x02, 0xF0, 0x1E, 0xFF, 0xFE, 0x1F, 0xF0, 0x00, 0x78, 0x30, 0xFC,
+    0xFC, 0x30, 0x78, 0x00, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0x80, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0x00, 0x0C, 0x00, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xF8, 0x00,
+    0x80, 0x00, 0x1F, 0x80, 0x7F, 0xE0, 0xE0, 0x70, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xE0, 0x70,
+    0x7F, 0xE0, 0x1F, 0x80, 0x30, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x30, 0x30,
+    0x70, 0x70, 0xE0, 0xF0, 0xC1, 0xF0, 0xC3, 0xB0, 0xE7, 0x30, 0x7E, 0x30, 0x38, 0x30, 0x20, 0x40,
+    0x60, 0x60, 0xE0, 0x70, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0x7F, 0xE0, 0x39, 0xC0, 0x00, 0xC0,
+    0x03, 0xC0, 0x07, 0xC0, 0x1E, 0xC0, 0x78, 0xC0, 0xF0, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0xC0,
+    0x00, 0xC0, 0x3C, 0x40, 0xFE, 0x60, 0xC4, 0x30, 0xCC, 0x30, 0xCC, 0x30, 0xCE, 0x70, 0xC7, 0xE0,
+    0x03, 0xC0, 0x1F, 0x80, 0x7F, 0xE0, 0x66, 0x70, 0xCC, 0x30, 0xCC, 0x30, 0xCC, 0x30, 0xEE, 0x70,
+    0x67, 0xE0, 0x23, 0xC0, 0xC0, 0x00, 0xC0, 0x30, 0xC0, 0xF0, 0xC3, 0xF0, 0xCF, 0x80, 0xFE, 0x00,
+    0xF8, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x7B, 0xE0, 0x7F, 0x70, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30,
+    0x7F, 0x70, 0x7B, 0xE0, 0x01, 0xC0, 0x3C, 0x40, 0x7E, 0x60, 0xE7, 0x70, 0xC3, 0x30, 0xC3, 0x30,
+    0xC3, 0x30, 0xE6, 0x60, 0x7F, 0xE0, 0x1F, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0x00, 0x00, 0xE1, 0xF0,
+    0xE1, 0x80, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x36, 0x00, 0x66, 0x00, 0x67, 0x00, 0xE3, 0x00,
+    0xC3, 0x80, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC3, 0x80, 0xE3, 0x00, 0x63, 0x00,
+    0x66, 0x00, 0x36, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x70, 0x00, 0xC3, 0xB0,
+    0xC7, 0xB0, 0xC6, 0x30, 0x7C, 0x00, 0x78, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x38, 0x3C, 0x77, 0xCC,
+    0x6F, 0xEE, 0xDC, 0x76, 0xD8, 0x36, 0xD8, 0x36, 0xDC, 0x66, 0xDF, 0xE6, 0xFF, 0xF6, 0x60, 0x30,
+    0x78, 0x70, 0x3F, 0xE0, 0x0F, 0xC0, 0x00, 0x70, 0x03, 0xF0, 0x1F, 0xE0, 0xFF, 0x80, 0xF1, 0x80,
+    0xF1, 0x80, 0xFF, 0x80, 0x1F, 0xE0, 0x03, 0xF0, 0x00, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xC6, 0x30,
+    0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xFF, 0x30, 0x7B, 0xE0, 0x01, 0xC0, 0x1F, 0x80, 0x3F, 0xC0,
+    0x70, 0xE0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0xE0, 0x10, 0x80,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0x60, 0x60, 0x7F, 0xE0,
+    0x1F, 0x80, 0xFF, 0xF0, 0xFF, 0xF0, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30,
+    0xC6, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00,
+    0xC0, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x70, 0xE0, 0xC0, 0x30, 0xC0, 0x30, 0xC6, 0x30, 0xC6, 0x30,
+    0xE6, 0x60, 0x77, 0xE0, 0x37, 0x80, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0xC0,
+    0x00, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x07, 0x00, 0x0F, 0x00, 0x3F, 0x80, 0x7B, 0xE0, 0xE0, 0xF0, 0xC0, 0x70, 0x80, 0x10, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
+    0xF8, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+    0x07, 0x80, 0x01, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0x1F, 0x80, 0x3F, 0xC0, 0x70, 0xE0, 0xE0, 0x70,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xE0, 0x70, 0x70, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xE7, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x1F, 0x80,
+    0x3F, 0xC0, 0x70, 0xE0, 0xE0, 0x70, 0xC0, 0x30, 0xC0, 0xB0, 0xC0, 0xF0, 0xE0, 0x70, 0x70, 0xF0,
+    0x3F, 0xD8, 0x1F, 0x80, 0xFF, 0xF0, 0xFF, 0xF0, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x80, 0xE7, 0xE0,
+    0x7E, 0xF0, 0x3C, 0x30, 0x00, 0x80, 0x38, 0xE0, 0x7C, 0xF0, 0xCE, 0x30, 0xC6, 0x30, 0xC6, 0x30,
+    0xE7, 0x30, 0x63, 0xE0, 0x21, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x70, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0xFF, 0xE0, 0xFF, 0xC0, 0x80, 0x00, 0xF0, 0x00, 0xFE, 0x00,
+    0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x70, 0x03, 0xF0, 0x1F, 0xE0, 0xFF, 0x00, 0xF8, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xF0, 0x07, 0xF0, 0x7F, 0x80, 0xFC, 0x00,
+    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x01, 0xF0, 0x1F, 0xF0, 0xFF, 0x00, 0xF8, 0x00, 0x80, 0x00,
+    0x00, 0x10, 0xC0, 0x30, 0xF0, 0xF0, 0x7F, 0xE0, 0x1F, 0x80, 0x0F, 0x00, 0x3F, 0xC0, 0xF9, 0xF0,
+    0xE0, 0x70, 0xC0, 0x30, 0x00, 0x00, 0x80, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xF0,
+    0x0F, 0xF0, 0x3E, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x80, 0x00, 0xC0, 0x30, 0xC0, 0xF0, 0xC1, 0xF0,
+    0xC7, 0xB0, 0xCF, 0x30, 0xDE, 0x30, 0xF8, 0x30, 0xF0, 0x30, 0xC0, 0x30, 0xFF, 0xFE, 0xFF, 0xFE,
+    0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7C, 0x00, 0x04,
+    0xC0, 0x06, 0xC0, 0x06, 0xFF, 0xFE, 0xFF, 0xFE, 0x04, 0x1C, 0xF0, 0xC0, 0xF0, 0x3C, 0x04, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0x40, 0x27, 0x00, 0x6F, 0x80, 0xE9, 0x80,
+    0xC9, 0x80, 0xC9, 0x80, 0xFB, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0xF0, 0xFF, 0xF0, 0x0C, 0x60,
+    0x18, 0x30, 0x18, 0x30, 0x1C, 0x70, 0x0F, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x7F, 0x00, 0xE3, 0x80,
+    0xC1, 0x80, 0xC1, 0x80, 0xE3, 0x80, 0x63, 0x00, 0x22, 0x00, 0x07, 0xC0, 0x0F, 0xE0, 0x1C, 0x70,
+    0x18, 0x30, 0x18, 0x30, 0x0C, 0x60, 0xFF, 0xF0, 0xFF, 0xF0, 0x3E, 0x00, 0x7F, 0x00, 0xFB, 0x80,
+    0xD9, 0x80, 0xD9, 0x80, 0xD9, 0x80, 0x7B, 0x00, 0x3A, 0x00, 0x0C, 0x00, 0x3F, 0xF8, 0x7F, 0xF8,
+    0x6C, 0x00, 0x6C, 0x00, 0x3E, 0x00, 0x7F, 0x60, 0xE3, 0xF0, 0xC1, 0xB0, 0xC1, 0xB0, 0x63, 0x30,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1C, 0x00,
+    0x1F, 0xF0, 0x0F, 0xF0, 0x4F, 0xF8, 0x4F, 0xF8, 0x00, 0x03, 0x00, 0x03, 0x4F, 0xFF, 0x4F, 0xFE,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x03, 0x80, 0x07, 0xC0, 0x0F, 0xE0, 0x1C, 0x70, 0x18, 0x30, 0x00, 0x00,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0x80, 0xFF, 0x80, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0x80,
+    0x7F, 0x80, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0x80, 0x7F, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0x7F, 0x80, 0x3E, 0x00, 0x7F, 0x00,
+    0xE3, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xE3, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x63, 0x00, 0xC1, 0x80, 0xC1, 0x80, 0xE3, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7F, 0x00,
+    0xE3, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0x63, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0x80, 0xFF, 0x80,
+    0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x73, 0x00, 0xFB, 0x80, 0xD9, 0x80, 0xC9, 0x80, 0xCD, 0x80,
+    0x6F, 0x80, 0x27, 0x00, 0x30, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x30, 0x60, 0x30, 0x60, 0xFF, 0x00,
+    0xFF, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x00,
+    0xF0, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x03, 0x80, 0x1F, 0x80, 0xFE, 0x00, 0xF0, 0x00, 0x80, 0x00,
+    0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0x80, 0x1F, 0x80, 0xFE, 0x00, 0xE0, 0x00, 0xFE, 0x00,
+    0x0F, 0x80, 0x0F, 0x80, 0xFF, 0x80, 0xF8, 0x00, 0x80, 0x00, 0x80, 0x80, 0xC1, 0x80, 0xF7, 0x80,
+    0x3E, 0x00, 0x1C, 0x00, 0x7F, 0x00, 0xE3, 0x80, 0xC1, 0x80, 0x80, 0x00, 0xF0, 0x30, 0xFE, 0x30,
+    0x0F, 0xF0, 0x03, 0xE0, 0x3F, 0x80, 0xFC, 0x00, 0xF0, 0x00, 0x80, 0x00, 0xC1, 0x80, 0xC3, 0x80,
+    0xCF, 0x80, 0xDD, 0x80, 0xF9, 0x80, 0xF1, 0x80, 0xC1, 0x80, 0x01, 0x80, 0x01, 0x80, 0x3F, 0xFE,
+    0x7F, 0x7F, 0x60, 0x03, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xE0, 0x03, 0x60, 0x03,
+    0x7F, 0x7F, 0x3F, 0xFE, 0x01, 0x80, 0x01, 0x80, 0x70, 0xF0, 0xC0, 0x40, 0x20, 0x30, 0xF0, 0xE0,
+    0x00, 0x00, 0x70, 0x03, 0xF0, 0x1F, 0xE0, 0xFF, 0x80, 0xF1, 0x80, 0xF1, 0x80, 0xFF, 0x80, 0x1F,
+    0xE0, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x13, 0xC0, 0xE0, 0x60, 0x60, 0xC0, 0x00, 0x02, 0x00, 0xFF,
+    0xF0, 0xFF, 0xF0, 0x04, 0x30, 0x0C, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xDE,
+    0x80, 0xFF, 0x80, 0x61, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x61, 0x80, 0xFF,
+    0x80, 0xDE, 0x80, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x10, 0x07, 0x1C, 0x0F, 0x9E, 0x19, 0xC6, 0x58, 0xC6, 0xD8, 0xC6, 0x9C,
+    0xE6, 0x0C, 0x7C, 0x04, 0x38, 0x03, 0x00, 0x7F, 0x98, 0xFC, 0x9C, 0xCC, 0xCC, 0xCE, 0xCC, 0xE7,
+    0xFC, 0x67, 0xB8, 0x01, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x08, 0x03, 0x8E, 0x87,
+    0xCF, 0xCC, 0xE3, 0x6C, 0x63, 0x6C, 0x63, 0xCC, 0x73, 0x86, 0x3E, 0x06, 0x1C, 0x00, 0x80, 0x38,
+    0xE0, 0x7C, 0xF0, 0xCE, 0x30, 0xC6, 0x39, 0xC6, 0x3F, 0xE7, 0x36, 0x63, 0xE0, 0x21, 0xC0, 0x0C,
+    0x00, 0x0C, 0x00, 0x8C, 0x00, 0xCC, 0x00, 0x6F, 0xFF, 0x6F, 0xFF, 0xCC, 0x00, 0x8C, 0x00, 0x0C,
+    0x00, 0x18, 0x06, 0x18, 0x1E, 0x18, 0x3E, 0x18, 0xF6, 0xD9, 0xE6, 0xDB, 0xC6, 0x9F, 0x06, 0x1E,
+    0x06, 0x18, 0x06, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x0C, 0x03, 0x8C, 0x0F, 0xCC, 0x1F, 0x6C, 0x7B,
+    0x2C, 0xF3, 0x6D, 0xE3, 0xCF, 0x83, 0x8F, 0x03, 0x0C, 0x03, 0x18, 0x06, 0x18, 0x1E, 0x18, 0x7E,
+    0xD8, 0xF6, 0xDB, 0xE6, 0x1F, 0x86, 0x1F, 0x06, 0x1E, 0x06, 0x18, 0x06, 0x78, 0xFC, 0xCC, 0xCC,
+    0xFC, 0x78, 0x27, 0x00, 0x6F, 0x80, 0xE9, 0x80, 0xC9, 0x80, 0xC9, 0x80, 0xFB, 0x60, 0x7F, 0xF0,
+    0x7F, 0xB0, 0x70, 0xF8, 0x58, 0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x0C, 0x00, 0x40, 0xC0, 0x80,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0E, 0x60, 0x1F, 0x70, 0x1B, 0x30,
+    0xD9, 0x30, 0xD9, 0xB0, 0x0D, 0xF0, 0x04, 0xE0, 0x80, 0xC0, 0x60, 0x60, 0xE0, 0x80, 0x10, 0xD0,
+    0x70, 0x60, 0x07, 0x30, 0xCF, 0xB8, 0xED, 0x98, 0x2C, 0x98, 0xEC, 0xD8, 0x86, 0xF8, 0x02, 0x70,
+    0x73, 0x00, 0xFB, 0x80, 0xD9, 0x88, 0xC9, 0xC8, 0xCD, 0xF8, 0x6F, 0xB0, 0x27, 0x00, 0x0C, 0x00,
+    0x3F, 0xF0, 0x3F, 0xF8, 0x0C, 0x18, 0xEC, 0x18, 0xE0, 0x00, 0x18, 0x30, 0x18, 0x70, 0x19, 0xF0,
+    0xDB, 0xB0, 0xDF, 0x30, 0x9E, 0x30, 0x18, 0x30, 0x00, 0xC0, 0x80, 0x40, 0xC0, 0x80, 0x00, 0x8C,
+    0x18, 0xCC, 0x38, 0x6C, 0xF8, 0x2D, 0xD8, 0x6F, 0x98, 0xCF, 0x18, 0x8C, 0x18, 0x0C, 0x18, 0x0C,
+    0x38, 0x0C, 0xF8, 0x4D, 0xF8, 0x4F, 0xD8, 0x0F, 0x18, 0x0C, 0x18, 0x1F, 0xFE, 0x1F, 0xFE, 0x18,
+    0x60, 0x58, 0x60, 0xD8, 0x70, 0x9C, 0xFC, 0x0F, 0xDE, 0x07, 0x86, 0x00, 0x0E, 0x00, 0x7E, 0x03,
+    0xFC, 0x1F, 0xF0, 0x5E, 0x30, 0xDE, 0x30, 0x9F, 0xF0, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x0E, 0x00,
+    0x07, 0x00, 0x3F, 0x21, 0xFE, 0x6F, 0xF8, 0xCF, 0x18, 0xCF, 0x18, 0x6F, 0xF8, 0x21, 0xFE, 0x00,
+    0x3F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3F, 0x81, 0xFE, 0xEF, 0xF8, 0x6F, 0x18, 0x6F, 0x18, 0xEF,
+    0xF8, 0x81, 0xFE, 0x00, 0x3F, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x7E, 0xC7, 0xFC, 0xDF, 0xF0, 0x1E,
+    0x30, 0x1E, 0x30, 0xDF, 0xF0, 0xC7, 0xFC, 0x00, 0x7E, 0x00, 0x0E, 0x5F, 0xFE, 0xDF, 0xFE, 0x80,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x03, 0xF0, 0x07, 0xF8, 0x0E,
+    0x1C, 0x18, 0x06, 0x58, 0x06, 0xD8, 0x06, 0x9C, 0x0E, 0x0E, 0x1C, 0x0E, 0x1C, 0x02, 0x10, 0x1F,
+    0x80, 0x3F, 0xC0, 0x70, 0xE0, 0xC0, 0x30, 0xC0, 0x39, 0xC0, 0x3F, 0xC0, 0x36, 0xE0, 0x70, 0x70,
+    0xE0, 0x30, 0xC0, 0x01, 0xF8, 0x03, 0xFC, 0x87, 0x0E, 0xCC, 0x03, 0x6C, 0x03, 0x6C, 0x03, 0xCC,
+    0x07, 0x87, 0x0E, 0x07, 0x0E, 0x01, 0x08, 0x1F, 0xFE, 0x1F, 0xFE, 0x18, 0xC6, 0x58, 0xC6, 0xD8,
+    0xC6, 0x98, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0xFF, 0xF0, 0xFF, 0xF0, 0xC6, 0x30, 0xC6, 0x30, 0xC6,
+    0x30, 0xC6, 0x3F, 0xC6, 0x3F, 0xC6, 0x33, 0x1F, 0xFE, 0xDF, 0xFE, 0xD8, 0xC6, 0x18, 0xC6, 0x18,
+    0xC6, 0xD8, 0xC6, 0xD8, 0xC6, 0x18, 0xC6, 0x0F, 0xFF, 0xCF, 0xFF, 0x6C, 0x63, 0x2C, 0x63, 0x6C,
+    0x63, 0xCC, 0x63, 0x8C, 0x63, 0x0C, 0x63, 0x5F, 0xFE, 0xDF, 0xFE, 0x80, 0x00, 0x20, 0x00, 0x60,
+    0x00, 0xCF, 0xFF, 0xCF, 0xFF, 0x60, 0x00, 0x20, 0x00, 0x8F, 0xFF, 0xCF, 0xFF, 0x6C, 0x03, 0x2C,
+    0x03, 0xEC, 0x03, 0xCC, 0x03, 0x86, 0x06, 0x07, 0xFE, 0x01, 0xF8, 0x06, 0x00, 0x06, 0x00, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xC6, 0x30, 0xC6, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0x60, 0x60, 0x7F, 0xE0, 0x1F,
+    0x80, 0x1F, 0xFE, 0x1F, 0xFE, 0x0F, 0x00, 0x03, 0xC0, 0xC1, 0xE0, 0xC0, 0xF0, 0x80, 0x3C, 0x1F,
+    0xFE, 0x1F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0xC7, 0x80, 0x61, 0xE0, 0x20, 0xF0, 0x60, 0x78, 0xC0,
+    0x1E, 0x8F, 0xFF, 0x0F, 0xFF, 0x03, 0xF0, 0x07, 0xF8, 0x0E, 0x1C, 0x1C, 0x0E, 0x18, 0x06, 0xD8,
+    0x06, 0xD8, 0x06, 0x9C, 0x0E, 0x0E, 0x1C, 0x07, 0xF8, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xFC, 0x27,
+    0x0E, 0x6E, 0x07, 0xEC, 0x03, 0xCC, 0x03, 0xEC, 0x03, 0x6E, 0x07, 0x27, 0x0E, 0x03, 0xFC, 0x01,
+    0xF8, 0x03, 0xF0, 0x07, 0xF8, 0x0E, 0x1C, 0x5C, 0x0E, 0xD8, 0x06, 0x98, 0x06, 0x18, 0x06, 0x5C,
+    0x0E, 0xCE, 0x1C, 0x87, 0xF8, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF8, 0x0E, 0x1C, 0xDC, 0x0E, 0xD8,
+    0x06, 0x18, 0x06, 0xD8, 0x06, 0xDC, 0x0E, 0x0E, 0x1C, 0x07, 0xF8, 0x03, 0xF0, 0x42, 0xE7, 0x7E,
+    0x3C, 0x3C, 0x7E, 0xE7, 0x43, 0x0F, 0xFF, 0x8F, 0xFF, 0xEC, 0x30, 0x6C, 0x30, 0x6C, 0x38, 0xCE,
+    0x7E, 0x87, 0xEF, 0x03, 0xC3, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x07, 0x40, 0x03, 0xA0, 0x03, 0xA0,
+    0x03, 0x40, 0x07, 0x0F, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x1F, 0xFC, 0x00, 0x0E, 0x00, 0x06, 0xC0,
+    0x06, 0xC0, 0x06, 0x80, 0x0E, 0x1F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x40, 0x0E, 0xC0,
+    0x06, 0x80, 0x06, 0x40, 0x06, 0xC0, 0x0E, 0x9F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0xC0,
+    0x0E, 0xC0, 0x06, 0x00, 0x06, 0xC0, 0x06, 0xC0, 0x0E, 0x1F, 0xFC, 0x1F, 0xF8, 0x10, 0x00, 0x1C,
+    0x00, 0x1F, 0x00, 0x07, 0xC0, 0x41, 0xFE, 0xC1, 0xFE, 0x87, 0xC0, 0x1F, 0x00, 0x1C, 0x00, 0x10,
+    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF9, 0xFF, 0xF7, 0xC0, 0x06, 0xC0,
+    0x00, 0xC0, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0xE0, 0x00, 0xC0, 0x00, 0xC6, 0x30, 0xC6, 0x30, 0x7F,
+    0x30, 0x3B, 0xE0, 0x01, 0xE0, 0x1F, 0xF0, 0x1F, 0xF0, 0xCC, 0x00, 0x98, 0x00, 0x18, 0x00, 0x04,
+    0xE0, 0x0D, 0xF0, 0x1D, 0x30, 0x19, 0x30, 0xD9, 0x30, 0xDF, 0x60, 0x8F, 0xF0, 0x0F, 0xF0, 0x02,
+    0x70, 0x26, 0xF8, 0x6E, 0x98, 0xCC, 0x98, 0x8C, 0x98, 0xEF, 0xB0, 0x67, 0xF8, 0x07, 0xF8, 0x02,
+    0x70, 0x86, 0xF8, 0xEE, 0x98, 0x6C, 0x98, 0x6C, 0x98, 0x6F, 0xB0, 0xC7, 0xF8, 0x07, 0xF8, 0x02,
+    0x70, 0x46, 0xF8, 0x4E, 0x98, 0x0C, 0x98, 0x0C, 0x98, 0x4F, 0xB0, 0x47, 0xF8, 0x07, 0xF8, 0x5F,
+    0xFE, 0xDF, 0xFE, 0x80, 0x00, 0x07, 0xC0, 0x0F, 0xE0, 0x1C, 0x70, 0x58, 0x30, 0xD8, 0x30, 0x9C,
+    0x70, 0x0C, 0x60, 0x04, 0x40, 0x3E, 0x00, 0x7F, 0x00, 0xE3, 0x80, 0xC1, 0xC8, 0xC1, 0xF8, 0xE3,
+    0xB0, 0x63, 0x00, 0x22, 0x00, 0x03, 0xE0, 0x87, 0xF0, 0xCE, 0x38, 0x6C, 0x18, 0x6C, 0x18, 0xCE,
+    0x38, 0x86, 0x70, 0x06, 0x60, 0x07, 0xC0, 0x0F, 0xE0, 0x1F, 0x70, 0x5B, 0x30, 0xDB, 0x30, 0x9B,
+    0x30, 0x0F, 0x60, 0x07, 0x40, 0x3E, 0x00, 0x7F, 0x00, 0xFB, 0x80, 0xD9, 0xE0, 0xD9, 0xF0, 0xD9,
+    0xB0, 0x7B, 0x00, 0x3A, 0x00, 0x03, 0xE0, 0x47, 0xF0, 0x4F, 0xB8, 0x0D, 0x98, 0x0D, 0x98, 0x4D,
+    0x98, 0x47, 0xB0, 0x03, 0xA0, 0x03, 0xE0, 0x87, 0xF0, 0xCF, 0xB8, 0x6D, 0x98, 0x6D, 0x98, 0xCD,
+    0x98, 0x87, 0xB0, 0x03, 0xA0, 0x5F, 0xF0, 0xDF, 0xF0, 0x80, 0x00, 0x20, 0x00, 0x60, 0x00, 0xCF,
+    0xF8, 0xCF, 0xF8, 0x60, 0x00, 0x20, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x0E, 0x38, 0x0C, 0x18, 0x0C,
+    0x18, 0x06, 0x30, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07, 0xC0, 0x0F,
+    0xE0, 0x1C, 0x70, 0x18, 0x30, 0x78, 0x30, 0x6C, 0x60, 0xFF, 0xF0, 0xFF, 0xF0, 0x60, 0x00, 0x1F,
+    0xF0, 0x1F, 0xF0, 0x0C, 0x00, 0x58, 0x00, 0xD8, 0x00, 0x9C, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F,
+    0xF8, 0x8F, 0xF8, 0xE6, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0xEE, 0x00, 0x8F, 0xF8, 0x07, 0xF8, 0x07,
+    0xC0, 0x0F, 0xE0, 0x1C, 0x70, 0x58, 0x30, 0xD8, 0x30, 0x9C, 0x70, 0x0F, 0xE0, 0x07, 0xC0, 0x03,
+    0xE0, 0x27, 0xF0, 0x6E, 0x38, 0xCC, 0x18, 0xCC, 0x18, 0x6E, 0x38, 0x27, 0xF0, 0x03, 0xE0, 0x07,
+    0xC0, 0x0F, 0xE0, 0x5C, 0x70, 0xD8, 0x30, 0x98, 0x30, 0x5C, 0x70, 0xCF, 0xE0, 0x87, 0xC0, 0x03,
+    0xE0, 0x07, 0xF0, 0x4E, 0x38, 0x4C, 0x18, 0x0C, 0x18, 0x4E, 0x38, 0x47, 0xF0, 0x03, 0xE0, 0x18,
+    0x00, 0x18, 0x00, 0x18, 0x00, 0xFB, 0x80, 0xFB, 0x80, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x80,
+    0x00, 0xCF, 0xF8, 0x6F, 0xF8, 0x26, 0x00, 0xEC, 0x00, 0xCC, 0x00, 0x80, 0x00, 0x07, 0xF8, 0x07,
+    0xFC, 0x60, 0x1C, 0x90, 0x0C, 0x90, 0x0C, 0x60, 0x18, 0x07, 0xFC, 0x07, 0xFC, 0x1F, 0xE0, 0x1F,
+    0xF0, 0x00, 0x70, 0x40, 0x30, 0xC0, 0x30, 0x80, 0x60, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xE0, 0x1F,
+    0xF0, 0xC0, 0x70, 0xC0, 0x30, 0x80, 0x30, 0x40, 0x60, 0xDF, 0xF0, 0x9F, 0xF0, 0x0F, 0xF0, 0x4F,
+    0xF8, 0x40, 0x38, 0x00, 0x18, 0x00, 0x18, 0x40, 0x30, 0x4F, 0xF8, 0x0F, 0xF8, 0x08, 0x00, 0x0F,
+    0x03, 0x0F, 0xE3, 0x00, 0xFF, 0xC0, 0x3E, 0xC3, 0xF8, 0x0F, 0xC0, 0x0F, 0x00, 0x08, 0x00, 0x30,
+    0x00, 0xFF, 0xC0, 0xFF, 0xE2, 0x30, 0xF2, 0x30, 0xFE, 0x00, 0x0C, 0xC0, 0xC0,
+};
+static const uint32_t InterTight_Bold8pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 5, 10, 30, 48, 70, 90, 92, 100, 108, 116,
+    124, 127, 132, 134, 146, 164, 174, 190, 206, 226, 242, 260,
+    276, 294, 312, 316, 322, 338, 346, 362, 376, 406, 426, 444,
+    464, 482, 498, 514, 534, 554, 558, 572, 590, 606, 630, 648,
+    670, 686, 708, 724, 742, 760, 778, 800, 832, 854, 874, 892,
+    900, 912, 920, 927, 935, 938, 954, 970, 986, 1002, 1018, 1028,
+    1044, 1060, 1064, 1072, 1088, 1092, 1116, 1132, 1148, 1164, 1180, 1190,
+    1204, 1214, 1230, 1248, 1274, 1290, 1308, 1322, 1334, 1340, 1352, 1360,
+    1360, 1361, 1383, 1389, 1407, 1427, 1443, 1461, 1477, 1483, 1501, 1519,
+    1537, 1555, 1560, 1578, 1596, 1602, 1618, 1621, 1629, 1632, 1642, 1656,
+    1662, 1666, 1680, 1694, 1706, 1720, 1727, 1741, 1755, 1771, 1791, 1811,
+    1831, 1851, 1867, 1887, 1907, 1927, 1943, 1959, 1975, 1991, 1997, 2009,
+    2027, 2049, 2067, 2085, 2107, 2129, 2151, 2173, 2181, 2197, 2215, 2233,
+    2251, 2269, 2289, 2307, 2325, 2335, 2351, 2367, 2383, 2399, 2405, 2421,
+    2437, 2453, 2469, 2485, 2501, 2517, 2523, 2535, 2557, 2575, 2591, 2607,
+    2623, 2639, 2655, 2671, 2687, 2701, 2717, 2733, 2749, 2765, 2783, 2795,
+};
+
+// InterTightSemiBold10pt8bfr.h
+static const uint8_t InterTight_SemiBold10pt8b_Atlas[] PROGMEM = {
+    0x00, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xDC, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0xC0, 0x18,
+    0xC4, 0x19, 0xFC, 0x7F, 0xF8, 0xFE, 0xC0, 0x98, 0xC0, 0x18, 0xC4, 0x19, 0xFC, 0x7F, 0xF8, 0xFE,
+    0xC0, 0x98, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x07, 0x86, 0x00, 0x0F, 0xC7, 0x00, 0x0F, 0xC7,
+    0x80, 0x1C, 0xE1, 0x80, 0x18, 0xE1, 0x80, 0xFF, 0xFF, 0xE0, 0x18, 0x61, 0x80, 0x1C, 0x73, 0x80,
+    0x0E, 0x3F, 0x00, 0x0E, 0x3F, 0x00, 0x06, 0x1E, 0x00, 0x78, 0x00, 0xFC, 0x04, 0xCC, 0x0C, 0xCC,
+    0x38, 0xFC, 0x60, 0x79, 0xC0, 0x03, 0x00, 0x0E, 0xF8, 0x19, 0xFC, 0x71, 0x8C, 0xC1, 0x8C, 0x81,
+    0xFC, 0x00, 0xF8, 0x00, 0x70, 0x38, 0xF8, 0x7F, 0xFC, 0xFF, 0x9C, 0xC7, 0x8C, 0xC7, 0xCC, 0xCF,
+    0xEC, 0x7C, 0x78, 0x38, 0x78, 0x01, 0xFC, 0x01, 0xCC, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0xF8, 0x00,
+    0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0xF8, 0x07, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xF8,
+    0x07, 0xC0, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x24, 0x3C, 0x3C, 0xFF, 0xFF,
+    0x3C, 0x3C, 0x24, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0C,
+    0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7C, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x7F,
+    0x80, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x7F, 0xF8, 0xF0, 0x3C,
+    0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xF0, 0x3C, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x38, 0x00,
+    0x30, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x30, 0x0C, 0x70, 0x1C,
+    0xF0, 0x3C, 0xE0, 0x7C, 0xC0, 0xFC, 0xC1, 0xEC, 0xE3, 0xCC, 0xFF, 0x8C, 0x7E, 0x0C, 0x3C, 0x0C,
+    0x20, 0x30, 0x60, 0x38, 0xE0, 0x38, 0xE0, 0x1C, 0xC6, 0x0C, 0xC6, 0x0C, 0xC6, 0x0C, 0xFF, 0x1C,
+    0x7B, 0xF8, 0x39, 0xF8, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x07, 0xE0, 0x0F, 0x60, 0x3C, 0x60,
+    0x78, 0x60, 0xF0, 0x60, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x60, 0x00, 0x60, 0x06, 0x30,
+    0xFE, 0x38, 0xFE, 0x3C, 0xC4, 0x1C, 0xCC, 0x0C, 0xCC, 0x0C, 0xCE, 0x1C, 0xCF, 0xF8, 0xC7, 0xF8,
+    0x03, 0xE0, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0xE7, 0x3C, 0xC4, 0x0C, 0xCC, 0x0C, 0xCC, 0x0C,
+    0xEE, 0x1C, 0x6F, 0xF8, 0x67, 0xF8, 0x23, 0xE0, 0xC0, 0x00, 0xC0, 0x04, 0xC0, 0x1C, 0xC0, 0x7C,
+    0xC1, 0xF8, 0xC7, 0xE0, 0xDF, 0x80, 0xFE, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x38, 0xF0, 0x79, 0xF8,
+    0xFF, 0xF8, 0xCF, 0x1C, 0xC6, 0x0C, 0xC6, 0x0C, 0xE6, 0x0C, 0xFF, 0x1C, 0x7B, 0xF8, 0x39, 0xF8,
+    0x00, 0xF0, 0x1E, 0x20, 0x7F, 0x38, 0x7F, 0xB8, 0xE3, 0x9C, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x0C,
+    0xF7, 0x3C, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x00, 0x04,
+    0xE0, 0xFC, 0xE0, 0xF8, 0xE0, 0x80, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1B, 0x00, 0x33, 0x00,
+    0x33, 0x80, 0x71, 0x80, 0x61, 0xC0, 0xE0, 0xC0, 0xC0, 0xE0, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0xC6, 0xC6, 0xC6, 0xE0, 0xE0, 0xE0, 0xC0, 0x61, 0xC0, 0x71, 0x80, 0x33, 0x80, 0x3B, 0x00, 0x1F,
+    0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xC1, 0xDC, 0xC3,
+    0xDC, 0xC7, 0xDC, 0xFF, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x3C,
+    0x0F, 0x00, 0x30, 0x03, 0x80, 0x63, 0xF1, 0x80, 0x67, 0xF9, 0x80, 0xCE, 0x1C, 0xC0, 0xCC, 0x0C,
+    0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xC6, 0x18, 0xC0, 0xCF, 0xF8, 0xC0, 0xEF, 0xFD, 0xC0,
+    0x60, 0x0C, 0x80, 0x70, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x00,
+    0x04, 0x00, 0x3C, 0x00, 0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0xFE, 0xC0, 0xF0, 0xC0, 0xF0, 0xC0, 0xFE,
+    0xC0, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x04, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xC3, 0x0C, 0xC3, 0x0C, 0xC3, 0x0C, 0xE7, 0x0C, 0xFF, 0x9C, 0x7D, 0xFC, 0x38, 0xF8, 0x00,
+    0x70, 0x0F, 0xC0, 0x3F, 0xF0, 0x7F, 0xF8, 0x70, 0x38, 0xE0, 0x1C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0,
+    0x0C, 0xC0, 0x0C, 0xE0, 0x1C, 0x78, 0x78, 0x38, 0x70, 0x18, 0x60, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xE0, 0x1C, 0x70, 0x38, 0x7F, 0xF8, 0x3F,
+    0xF0, 0x0F, 0xC0, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xC3, 0x0C, 0xC3, 0x0C, 0xC3, 0x0C, 0xC3,
+    0x0C, 0xC3, 0x0C, 0xC3, 0x0C, 0xC0, 0x0C, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xC3, 0x00, 0xC3,
+    0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x7F, 0xF8, 0x70,
+    0x38, 0xE0, 0x1C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC3, 0x0C, 0xC3, 0x1C, 0xF3, 0x3C, 0x73, 0xF8, 0x33,
+    0xF0, 0x13, 0xC0, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0x00, 0x30, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0xFF, 0xFC, 0xFF,
+    0xF8, 0xFF, 0xF0, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x03, 0x80, 0x07, 0x00, 0x0F, 0x80, 0x1F,
+    0xE0, 0x78, 0xF0, 0xF0, 0x7C, 0xE0, 0x1C, 0xC0, 0x0C, 0x80, 0x04, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xF8, 0x07,
+    0xE0, 0x3F, 0x00, 0xF8, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0x0F, 0xC0, 0x3F, 0xF0, 0x7F, 0xF8, 0x70, 0x38, 0xE0, 0x1C, 0xC0, 0x0C, 0xC0,
+    0x0C, 0xC0, 0x0C, 0xE0, 0x1C, 0x70, 0x38, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xE3, 0x80, 0x7F, 0x80, 0x7F,
+    0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x7F, 0xF8, 0x70, 0x38, 0xE0, 0x1C, 0xC0, 0x0C, 0xC0,
+    0x4C, 0xC0, 0x7C, 0xE0, 0x3C, 0x70, 0x3E, 0x7F, 0xFE, 0x3F, 0xF2, 0x0F, 0xC0, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0xE0, 0xE3, 0xF8, 0x7F, 0x7C, 0x7F,
+    0x1C, 0x3E, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x30, 0x7E, 0x38, 0x7E, 0x3C, 0xE7, 0x0C, 0xC7,
+    0x0C, 0xC3, 0x0C, 0xC3, 0x0C, 0xE3, 0x9C, 0x71, 0xF8, 0x71, 0xF8, 0x30, 0xF0, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0x0C, 0x00, 0x0C, 0x00, 0x1C, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xE0, 0x80, 0x00, 0xF0, 0x00, 0xFE,
+    0x00, 0x3F, 0x80, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x3C, 0x00, 0x7C, 0x03, 0xFC, 0x1F, 0xE0, 0xFF,
+    0x00, 0xF8, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x01, 0xFC, 0x00,
+    0x3C, 0x01, 0xFC, 0x1F, 0xE0, 0xFF, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00,
+    0x3C, 0x01, 0xFC, 0x1F, 0xF8, 0xFF, 0x80, 0xFC, 0x00, 0xC0, 0x00, 0x00, 0x04, 0xC0, 0x0C, 0xF0,
+    0x3C, 0xF8, 0x7C, 0x3F, 0xF0, 0x0F, 0xC0, 0x07, 0x80, 0x1F, 0xE0, 0x3F, 0xF0, 0xF8, 0x7C, 0xE0,
+    0x1C, 0xC0, 0x0C, 0x00, 0x00, 0x80, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07,
+    0xFC, 0x03, 0xFC, 0x07, 0xFC, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x80, 0x00, 0xC0,
+    0x0C, 0xC0, 0x3C, 0xC0, 0x7C, 0xC0, 0xFC, 0xC3, 0xCC, 0xC7, 0x8C, 0xCF, 0x0C, 0xFC, 0x0C, 0xF8,
+    0x0C, 0xF0, 0x0C, 0xC0, 0x0C, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x00,
+    0xC0, 0xC0, 0x00, 0xC0, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x7F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x40, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x02, 0x0E, 0x3C, 0xF0, 0xC0, 0xF0, 0x3E, 0x0E,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0xE0, 0x20, 0x03, 0xC0, 0x67,
+    0xE0, 0xE7, 0xE0, 0xE6, 0x60, 0xC4, 0x60, 0xCC, 0xC0, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x0C, 0x18, 0x18, 0x0C, 0x18, 0x0C, 0x1C, 0x1C, 0x1F, 0xFC, 0x0F,
+    0xF8, 0x03, 0xE0, 0x1F, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0xE0, 0xE0, 0xC0, 0x60, 0xC0, 0x60, 0xC0,
+    0x60, 0xE0, 0xE0, 0x71, 0xC0, 0x31, 0x80, 0x03, 0xE0, 0x0F, 0xF8, 0x1F, 0xFC, 0x1C, 0x1C, 0x18,
+    0x0C, 0x18, 0x0C, 0x0C, 0x18, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x1F, 0x00, 0x7F, 0xC0, 0x7F,
+    0xC0, 0xEC, 0xE0, 0xCC, 0x60, 0xCC, 0x60, 0xEC, 0x60, 0x7C, 0xE0, 0x7C, 0xC0, 0x1C, 0x80, 0x0C,
+    0x00, 0x0C, 0x00, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0xEC, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x1F,
+    0x88, 0x7F, 0xCC, 0xFF, 0xEE, 0xE0, 0xEE, 0xC0, 0x66, 0xC0, 0x66, 0x60, 0xCE, 0xFF, 0xFE, 0xFF,
+    0xFC, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1C,
+    0x00, 0x1F, 0xFC, 0x0F, 0xFC, 0x07, 0xFC, 0xEF, 0xFE, 0xEF, 0xFE, 0xEF, 0xFE, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0x60, 0xEF, 0xFF, 0xE0, 0xEF, 0xFF, 0xE0, 0xEF, 0xFF, 0xC0, 0xFF, 0xFC, 0xFF, 0xFC,
+    0xFF, 0xFC, 0x00, 0xC0, 0x03, 0xC0, 0x07, 0xF0, 0x0E, 0x78, 0x1C, 0x3C, 0x18, 0x0C, 0x10, 0x04,
+    0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x60, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x3F, 0xE0, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x7F, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xE0, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0xE0, 0xE0,
+    0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xE0, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x1F, 0x00, 0xFF, 0xFE,
+    0xFF, 0xFE, 0xFF, 0xFE, 0x60, 0xC0, 0xC0, 0x60, 0xC0, 0x60, 0xE0, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0,
+    0x1F, 0x00, 0x1F, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0x60, 0xC0, 0x60, 0x60, 0xC0,
+    0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x60, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0x38, 0xC0, 0x7C, 0xC0, 0xFC, 0xE0, 0xCC, 0x60, 0xCE, 0x60, 0xC6, 0x60, 0xE7, 0xE0,
+    0x67, 0xC0, 0x03, 0x80, 0x18, 0x00, 0x18, 0x00, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0x18, 0x0C,
+    0x18, 0x04, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x80, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xE0,
+    0x00, 0xE0, 0x0F, 0xE0, 0x7F, 0x80, 0xFC, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x00, 0xF8, 0x00,
+    0xFF, 0x80, 0x1F, 0xE0, 0x01, 0xE0, 0x0F, 0xE0, 0xFF, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x80,
+    0x07, 0xE0, 0x03, 0xE0, 0x3F, 0xE0, 0xFF, 0x00, 0xF0, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x60,
+    0xF1, 0xE0, 0x7F, 0xC0, 0x1F, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0xF1, 0xE0, 0xE0, 0xE0, 0x80, 0x20,
+    0x80, 0x00, 0xF0, 0x06, 0xFE, 0x06, 0x3F, 0xCE, 0x03, 0xFE, 0x00, 0xFC, 0x0F, 0xF0, 0x7F, 0x80,
+    0xFC, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x60, 0xC0, 0xE0, 0xC3, 0xE0, 0xC7, 0xE0, 0xCF, 0x60,
+    0xFC, 0x60, 0xF8, 0x60, 0xF0, 0x60, 0xC0, 0x60, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x3F, 0xFF,
+    0x80, 0x7F, 0xFF, 0xC0, 0x7F, 0xBF, 0xE0, 0x60, 0x00, 0x60, 0xE0, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x60, 0x60, 0x00, 0xE0, 0x7F, 0xBF, 0xE0, 0x7F,
+    0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x70, 0xF0, 0xC0, 0xC0, 0xE0,
+    0x70, 0x30, 0x30, 0xF0, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x07,
+    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0xC0, 0x00, 0xF0, 0xC0, 0x00, 0xF0, 0xC0, 0x00, 0xFE, 0xC0,
+    0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF3, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0xC0,
+    0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0x02, 0x0C, 0x06, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0xCF, 0x20, 0xFF,
+    0xE0, 0x70, 0xE0, 0x60, 0x60, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0x60, 0x60, 0x70,
+    0xE0, 0xFF, 0xE0, 0xCF, 0x20, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x06, 0x00, 0x06, 0xE0,
+    0x06, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0xE1, 0x80, 0x03, 0xF1, 0xC0,
+    0x03, 0xF1, 0xE0, 0x07, 0x38, 0x60, 0x06, 0x38, 0x60, 0xE6, 0x18, 0x60, 0xC6, 0x18, 0x60, 0x87,
+    0x1C, 0xE0, 0x03, 0x8F, 0xC0, 0x03, 0x8F, 0xC0, 0x01, 0x87, 0x80, 0x3B, 0xC6, 0x00, 0x7F, 0xE7,
+    0x00, 0xFE, 0x67, 0x80, 0xCE, 0x71, 0x80, 0xC6, 0x31, 0x80, 0xC7, 0x39, 0x80, 0xF3, 0x3F, 0x80,
+    0x73, 0xFF, 0x00, 0x31, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0xC0,
+    0x00, 0x00, 0x00, 0x01, 0xE1, 0x80, 0x03, 0xF1, 0xC0, 0x83, 0xF1, 0xE0, 0xE7, 0x38, 0xE0, 0x76,
+    0x38, 0x60, 0x36, 0x18, 0x60, 0xE6, 0x18, 0x60, 0xC6, 0x1C, 0xE0, 0x87, 0x0F, 0xC0, 0x03, 0x0F,
+    0xC0, 0x01, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x30, 0x00, 0x7E, 0x38, 0x00, 0x7E, 0x3C, 0x00,
+    0xE7, 0x0C, 0x00, 0xC7, 0x0E, 0x60, 0xC3, 0x0F, 0xE0, 0xC3, 0x0D, 0xC0, 0xE3, 0x9C, 0x00, 0x71,
+    0xF8, 0x00, 0x71, 0xF8, 0x00, 0x30, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x86, 0x00,
+    0x00, 0xC6, 0x00, 0x00, 0x67, 0xFF, 0xE0, 0x27, 0xFF, 0xE0, 0x67, 0xFF, 0xE0, 0xC6, 0x00, 0x00,
+    0x86, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x60, 0x06, 0x01, 0xE0, 0x06,
+    0x03, 0xE0, 0x06, 0x07, 0xE0, 0x06, 0x1E, 0x60, 0x66, 0x3C, 0x60, 0xE6, 0x78, 0x60, 0x87, 0xE0,
+    0x60, 0x07, 0xC0, 0x60, 0x07, 0x80, 0x60, 0x06, 0x00, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0x06, 0x00, 0x60, 0x06, 0x01, 0xE0, 0x86, 0x03, 0xE0, 0xC6, 0x07, 0xE0, 0x66, 0x1E, 0x60, 0x26,
+    0x3C, 0x60, 0x66, 0x78, 0x60, 0xC7, 0xE0, 0x60, 0x87, 0xC0, 0x60, 0x07, 0x80, 0x60, 0x06, 0x00,
+    0x60, 0x06, 0x00, 0x60, 0x06, 0x01, 0xE0, 0x06, 0x03, 0xE0, 0x06, 0x07, 0xE0, 0xE6, 0x1E, 0x60,
+    0xE6, 0x3C, 0x60, 0xE6, 0x78, 0x60, 0x07, 0xE0, 0x60, 0x07, 0xC0, 0x60, 0x07, 0x80, 0x60, 0x06,
+    0x00, 0x60, 0x38, 0x7C, 0xC6, 0xC6, 0xC6, 0x7C, 0x38, 0x03, 0xC0, 0x67, 0xE0, 0xE7, 0xE0, 0xE6,
+    0x60, 0xC4, 0x60, 0xCC, 0xDC, 0xFF, 0xFE, 0x7F, 0xF6, 0x3F, 0xE6, 0x70, 0xF8, 0x98, 0x18, 0x01,
+    0x00, 0x03, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x06, 0x00, 0x20, 0xE0, 0xC0, 0x80, 0x7F,
+    0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x03, 0x8C, 0x07, 0xCC, 0x0F,
+    0xCE, 0x0C, 0xC6, 0x6C, 0xE6, 0xCC, 0x66, 0x8E, 0x7E, 0x06, 0x7C, 0x00, 0x38, 0x00, 0xC0, 0xE0,
+    0x60, 0x60, 0xC0, 0x80, 0x18, 0xD8, 0x78, 0x30, 0x01, 0xC6, 0x83, 0xE6, 0xC7, 0xE7, 0x66, 0x63,
+    0x36, 0x73, 0x66, 0x33, 0xC7, 0x3F, 0x83, 0x3E, 0x00, 0x1C, 0x38, 0xC0, 0x7C, 0xC0, 0xFC, 0xE0,
+    0xCC, 0x63, 0xCE, 0x73, 0xC6, 0x7F, 0xE7, 0xEE, 0x67, 0xC0, 0x03, 0x80, 0x06, 0x00, 0x06, 0x00,
+    0x3F, 0xFE, 0x3F, 0xFF, 0x3F, 0xFF, 0x06, 0x03, 0xE6, 0x01, 0x80, 0x00, 0x0C, 0x06, 0x0C, 0x0E,
+    0x0C, 0x3E, 0x0C, 0x7E, 0x6C, 0xF6, 0xEF, 0xC6, 0x8F, 0x86, 0x0F, 0x06, 0x0C, 0x06, 0x00, 0x60,
+    0xE0, 0x80, 0x20, 0xE0, 0xC0, 0x80, 0x06, 0x03, 0x86, 0x07, 0xE6, 0x1F, 0x76, 0x3F, 0x36, 0x7B,
+    0x77, 0xE3, 0xE7, 0xC3, 0xC7, 0x83, 0x06, 0x03, 0x0C, 0x06, 0x0C, 0x0E, 0x0C, 0x3E, 0xEC, 0x7E,
+    0xEC, 0xF6, 0xEF, 0xC6, 0x0F, 0x86, 0x0F, 0x06, 0x0C, 0x06, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0,
+    0x07, 0xFF, 0xE0, 0x06, 0x0C, 0x00, 0x26, 0x0C, 0x00, 0xE6, 0x0C, 0x00, 0xC6, 0x0F, 0x00, 0x87,
+    0x1F, 0xC0, 0x03, 0xFB, 0xE0, 0x03, 0xF8, 0xE0, 0x01, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF6, 0x00,
+    0x27, 0x86, 0x00, 0xE7, 0x86, 0x00, 0xC7, 0xF6, 0x00, 0x81, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x07, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x01, 0xE0, 0x00, 0x07,
+    0xE0, 0x20, 0x3F, 0x80, 0x61, 0xFE, 0x00, 0xE7, 0xF6, 0x00, 0xC7, 0x86, 0x00, 0xC7, 0x86, 0x00,
+    0xE7, 0xF6, 0x00, 0x21, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0xE1, 0xFE,
+    0x00, 0xF7, 0xF6, 0x00, 0x37, 0x86, 0x00, 0x37, 0x86, 0x00, 0xF7, 0xF6, 0x00, 0xE1, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00,
+    0x03, 0xC0, 0x00, 0x1F, 0xC0, 0xC0, 0xFF, 0x00, 0xC3, 0xFC, 0x00, 0xCF, 0xCC, 0x00, 0x0E, 0x0C,
+    0x00, 0xCF, 0x8C, 0x00, 0xC7, 0xFC, 0x00, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0,
+    0x00, 0x01, 0xC0, 0x00, 0x00, 0x40, 0x07, 0xFF, 0xE0, 0x67, 0xFF, 0xE0, 0xE7, 0xFF, 0xE0, 0x80,
+    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x60, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0x81, 0xC0, 0x07, 0x00, 0xE0,
+    0x06, 0x00, 0x60, 0x26, 0x00, 0x60, 0xE6, 0x00, 0x60, 0xC6, 0x00, 0x60, 0x07, 0x00, 0xE0, 0x03,
+    0xC3, 0xC0, 0x01, 0xC3, 0x80, 0x00, 0xC3, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF8,
+    0x00, 0x70, 0x38, 0x00, 0xE0, 0x1C, 0x00, 0xC0, 0x0C, 0x60, 0xC0, 0x0E, 0x60, 0xC0, 0x0F, 0xE0,
+    0xC0, 0x0D, 0xC0, 0xE0, 0x1C, 0x00, 0x78, 0x78, 0x00, 0x38, 0x70, 0x00, 0x18, 0x60, 0x00, 0x00,
+    0x7E, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0x81, 0xC0, 0xC7, 0x00, 0xE0, 0xE6, 0x00,
+    0x60, 0x76, 0x00, 0x60, 0x76, 0x00, 0x60, 0xE6, 0x00, 0x60, 0xC7, 0x00, 0xC0, 0x03, 0x83, 0xC0,
+    0x03, 0x83, 0x80, 0x00, 0x83, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x06,
+    0x18, 0x60, 0x26, 0x18, 0x60, 0xE6, 0x18, 0x60, 0xC6, 0x18, 0x60, 0x06, 0x18, 0x60, 0x06, 0x18,
+    0x60, 0x06, 0x00, 0x60, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0xC3, 0x0C, 0x00,
+    0xC3, 0x0C, 0x00, 0xC3, 0x0C, 0x00, 0xC3, 0x0F, 0x80, 0xC3, 0x0F, 0xC0, 0xC3, 0x0E, 0xC0, 0xC0,
+    0x0C, 0xC0, 0x0F, 0xFF, 0xC0, 0xCF, 0xFF, 0xC0, 0xCF, 0xFF, 0xC0, 0xCC, 0x30, 0xC0, 0x0C, 0x30,
+    0xC0, 0xCC, 0x30, 0xC0, 0xCC, 0x30, 0xC0, 0xCC, 0x30, 0xC0, 0x0C, 0x30, 0xC0, 0x0C, 0x00, 0xC0,
+    0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x87, 0xFF, 0xE0, 0xC6, 0x18, 0x60, 0x66, 0x18, 0x60, 0x66,
+    0x18, 0x60, 0xC6, 0x18, 0x60, 0x86, 0x18, 0x60, 0x06, 0x18, 0x60, 0x06, 0x00, 0x60, 0x07, 0xFF,
+    0xE0, 0x67, 0xFF, 0xE0, 0xE7, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0xC7, 0xFF, 0xE0, 0x87, 0xFF, 0xE0, 0xC7, 0xFF, 0xE0, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07,
+    0xFF, 0xE0, 0x87, 0xFF, 0xE0, 0xC7, 0xFF, 0xE0, 0xE6, 0x00, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00,
+    0x60, 0xC6, 0x00, 0x60, 0x87, 0x00, 0xE0, 0x03, 0x81, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
+    0x00, 0x7E, 0x00, 0x06, 0x00, 0x06, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xC6, 0x0C, 0xC6,
+    0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xE0, 0x1C, 0x70, 0x38, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x07,
+    0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x20, 0x78,
+    0x00, 0xE0, 0x1E, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0,
+    0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x83, 0xC0, 0x00, 0xC0,
+    0xF0, 0x00, 0x60, 0x78, 0x00, 0x60, 0x1E, 0x00, 0xC0, 0x0F, 0x00, 0x80, 0x03, 0xC0, 0x07, 0xFF,
+    0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0,
+    0x03, 0x81, 0xC0, 0x07, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x66, 0x00, 0x60, 0xE6, 0x00, 0x60, 0x87,
+    0x00, 0xE0, 0x03, 0x81, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+    0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0x81, 0xC0, 0x67, 0x00, 0xE0, 0xE6, 0x00, 0x60,
+    0x86, 0x00, 0x60, 0xE6, 0x00, 0x60, 0x67, 0x00, 0xE0, 0x03, 0x81, 0xC0, 0x03, 0xFF, 0xC0, 0x01,
+    0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0x81,
+    0xC0, 0x27, 0x00, 0xE0, 0xE6, 0x00, 0x60, 0xC6, 0x00, 0x60, 0x26, 0x00, 0x60, 0x67, 0x00, 0xE0,
+    0xC3, 0x81, 0xC0, 0x83, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x01,
+    0xFF, 0x80, 0x03, 0xFF, 0xC0, 0xC3, 0x81, 0xC0, 0xC7, 0x00, 0xE0, 0xC6, 0x00, 0x60, 0x06, 0x00,
+    0x60, 0xC6, 0x00, 0x60, 0xC7, 0x00, 0xE0, 0xC3, 0x81, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
+    0x00, 0x7E, 0x00, 0x00, 0x80, 0x61, 0xC0, 0x73, 0xC0, 0x3F, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x3F,
+    0x00, 0x7B, 0x80, 0xF1, 0xC0, 0x60, 0x80, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x87, 0xFF, 0xE0,
+    0xC6, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0xE6, 0x0F, 0x00, 0xC7, 0x1F, 0xC0, 0x83,
+    0xFB, 0xE0, 0x03, 0xF8, 0xE0, 0x01, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF,
+    0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x70, 0x60, 0x00, 0x30, 0x90, 0x00, 0x30, 0x90, 0x00, 0x30,
+    0x60, 0x00, 0x30, 0x00, 0x00, 0x70, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x60, 0x20, 0x00,
+    0x60, 0xE0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0,
+    0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xE0, 0x60,
+    0x00, 0x60, 0xC0, 0x00, 0x60, 0x80, 0x00, 0x60, 0x60, 0x00, 0x60, 0xE0, 0x00, 0xE0, 0xC7, 0xFF,
+    0xC0, 0x87, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0xC7, 0xFF, 0xC0,
+    0xC0, 0x00, 0xE0, 0xC0, 0x00, 0x60, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0,
+    0x00, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x60, 0x1F, 0xE0,
+    0xE0, 0x3F, 0xE0, 0x80, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFF, 0xFC,
+    0x60, 0xFF, 0xFF, 0x60, 0xFF, 0xFD, 0xE0, 0xC0, 0x01, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0xFC, 0xFF, 0xFC, 0xE0, 0x00, 0xC3, 0x0C, 0xC3, 0x0C, 0xE7,
+    0x0C, 0xFF, 0x9C, 0x7D, 0xFC, 0x39, 0xF8, 0x00, 0xF0, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0xE6,
+    0x00, 0xCC, 0x00, 0x0C, 0x00, 0x00, 0x3C, 0x06, 0x7E, 0x0E, 0x7E, 0x0E, 0x66, 0x2C, 0x46, 0xEC,
+    0xCC, 0x8F, 0xFE, 0x07, 0xFE, 0x03, 0xFE, 0x00, 0x1E, 0x03, 0x3F, 0x37, 0x3F, 0x77, 0x33, 0xC6,
+    0x23, 0x66, 0x66, 0x37, 0xFF, 0x13, 0xFF, 0x01, 0xFF, 0x00, 0x78, 0x0C, 0xFC, 0x9C, 0xFC, 0xDC,
+    0xCC, 0xD8, 0x8C, 0xD9, 0x98, 0xDF, 0xFC, 0x8F, 0xFC, 0x07, 0xFC, 0x02, 0x3C, 0x46, 0x7E, 0xCE,
+    0x7E, 0x4E, 0x66, 0x0C, 0x46, 0x0C, 0xCC, 0x4F, 0xFE, 0x67, 0xFE, 0x43, 0xFE, 0x07, 0xFF, 0xE0,
+    0x67, 0xFF, 0xE0, 0xE7, 0xFF, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xFC,
+    0x07, 0xFC, 0x0E, 0x0E, 0x0C, 0x06, 0x6C, 0x06, 0xEC, 0x06, 0x8E, 0x0E, 0x07, 0x1C, 0x03, 0x18,
+    0x1F, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0xE0, 0xE0, 0xC0, 0x73, 0xC0, 0x7F, 0xE0, 0xEE, 0x71, 0xC0,
+    0x71, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xFC, 0x87, 0xFC, 0xCE, 0x0E, 0xEC, 0x06, 0x2C, 0x06,
+    0x6C, 0x06, 0xCE, 0x0E, 0x87, 0x1C, 0x03, 0x18, 0x01, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x0E, 0xCE,
+    0x2C, 0xC6, 0xEC, 0xC6, 0x8E, 0xC6, 0x07, 0xCE, 0x07, 0xCC, 0x01, 0xC8, 0x1F, 0x00, 0x7F, 0xC0,
+    0x7F, 0xC0, 0xEC, 0xE0, 0xCC, 0x7E, 0xCC, 0x7E, 0xEC, 0x66, 0x7C, 0xE0, 0x7C, 0xC0, 0x1C, 0x80,
+    0x01, 0xF0, 0x07, 0xFC, 0x47, 0xFC, 0x4E, 0xCE, 0x0C, 0xC6, 0x0C, 0xC6, 0x4E, 0xC6, 0xC7, 0xCE,
+    0x47, 0xCC, 0x01, 0xC8, 0x00, 0xF8, 0x83, 0xFE, 0xC3, 0xFE, 0xE7, 0x67, 0x76, 0x63, 0x76, 0x63,
+    0xE7, 0x63, 0xC3, 0xE7, 0x03, 0xE6, 0x00, 0xE4, 0x0F, 0xFE, 0x6F, 0xFE, 0xEF, 0xFE, 0xC0, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x30, 0x00, 0xE7, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0x30, 0x00, 0x10, 0x00,
+    0x01, 0xF0, 0x07, 0xFC, 0x0F, 0xFE, 0x0E, 0x0E, 0x0C, 0x06, 0x0C, 0x06, 0x06, 0x0C, 0x7F, 0xFE,
+    0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xF8,
+    0x1F, 0xFC, 0x1C, 0x1C, 0x18, 0x0C, 0xD8, 0x0C, 0xCC, 0x18, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC,
+    0xC0, 0x00, 0xC0, 0x00, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x06, 0x00, 0x2C, 0x00, 0xEC, 0x00,
+    0xCE, 0x00, 0x0F, 0xFE, 0x07, 0xFE, 0x03, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x8F, 0xFE, 0xC6, 0x00,
+    0x6C, 0x00, 0x6C, 0x00, 0xCE, 0x00, 0x8F, 0xFE, 0x07, 0xFE, 0x03, 0xFE, 0x01, 0xF0, 0x07, 0xFC,
+    0x07, 0xFC, 0x0E, 0x0E, 0x0C, 0x06, 0x6C, 0x06, 0xEC, 0x06, 0x8E, 0x0E, 0x07, 0xFC, 0x07, 0xF8,
+    0x01, 0xF0, 0x00, 0xF8, 0x03, 0xFE, 0x13, 0xFE, 0x37, 0x07, 0x66, 0x03, 0xC6, 0x03, 0x66, 0x03,
+    0x37, 0x07, 0x13, 0xFE, 0x03, 0xFC, 0x00, 0xF8, 0x01, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x2E, 0x0E,
+    0xEC, 0x06, 0xCC, 0x06, 0x2C, 0x06, 0x6E, 0x0E, 0xC7, 0xFC, 0x87, 0xF8, 0x01, 0xF0, 0x01, 0xF0,
+    0x07, 0xFC, 0x47, 0xFC, 0xCE, 0x0E, 0x4C, 0x06, 0x0C, 0x06, 0x4C, 0x06, 0xCE, 0x0E, 0x47, 0xFC,
+    0x07, 0xF8, 0x01, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xE6, 0xE0, 0xE6, 0xE0, 0xE6, 0xE0,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x80, 0x00, 0xC7, 0xFF, 0xE7, 0xFF, 0x77, 0xFF,
+    0x33, 0x00, 0x76, 0x00, 0xC6, 0x00, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x73, 0xFF,
+    0x80, 0x88, 0x03, 0x80, 0x88, 0x01, 0x80, 0x88, 0x01, 0x80, 0x70, 0x03, 0x00, 0x03, 0xFF, 0x80,
+    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x0E, 0x20, 0x06,
+    0xE0, 0x06, 0xC0, 0x0C, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0xF8, 0x0F, 0xFC, 0x2F, 0xFE,
+    0x60, 0x0E, 0xC0, 0x06, 0x80, 0x06, 0x20, 0x0C, 0xEF, 0xFE, 0xCF, 0xFE, 0x8F, 0xFE, 0x0F, 0xF8,
+    0x4F, 0xFC, 0xCF, 0xFE, 0x40, 0x0E, 0x00, 0x06, 0x40, 0x06, 0xC0, 0x0C, 0x4F, 0xFE, 0x0F, 0xFE,
+    0x0F, 0xFE, 0x08, 0x00, 0x00, 0x0F, 0x00, 0x60, 0x0F, 0xE0, 0x60, 0x03, 0xFC, 0xE0, 0x00, 0x3F,
+    0xE0, 0xE0, 0x0F, 0xC0, 0xC0, 0xFF, 0x00, 0x87, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFC, 0x60, 0x18, 0x1F, 0xE0, 0x00, 0x01, 0xC0, 0xE0, 0xE0, 0xE0,
+};
+static const uint32_t InterTight_SemiBold10pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 7, 13, 37, 73, 99, 123, 125, 140, 155, 163,
+    183, 186, 192, 195, 216, 238, 252, 272, 294, 318, 338, 360,
+    380, 402, 424, 430, 438, 458, 467, 487, 505, 559, 587, 609,
+    635, 659, 679, 697, 723, 747, 753, 771, 795, 813, 843, 867,
+    893, 915, 941, 965, 989, 1011, 1035, 1061, 1099, 1125, 1151, 1173,
+    1188, 1209, 1224, 1232, 1241, 1245, 1263, 1283, 1303, 1323, 1343, 1359,
+    1379, 1399, 1405, 1420, 1440, 1446, 1476, 1496, 1518, 1538, 1558, 1570,
+    1588, 1602, 1622, 1644, 1676, 1696, 1718, 1736, 1757, 1766, 1787, 1797,
+    1797, 1798, 1840, 1847, 1869, 1893, 1911, 1947, 1977, 1984, 2020, 2056,
+    2089, 2122, 2128, 2161, 2194, 2201, 2219, 2223, 2235, 2239, 2251, 2269,
+    2276, 2280, 2298, 2316, 2332, 2350, 2358, 2376, 2394, 2430, 2472, 2514,
+    2556, 2598, 2625, 2664, 2703, 2742, 2772, 2802, 2832, 2862, 2874, 2895,
+    2931, 2959, 2995, 3031, 3070, 3109, 3148, 3187, 3207, 3243, 3279, 3315,
+    3351, 3387, 3426, 3459, 3481, 3493, 3511, 3529, 3547, 3565, 3580, 3600,
+    3620, 3640, 3660, 3680, 3700, 3720, 3730, 3744, 3772, 3796, 3816, 3836,
+    3858, 3880, 3902, 3924, 3944, 3960, 3990, 4010, 4030, 4050, 4083, 4104,
+};
+
+// InterTightSemiBold12pt8bfr.h
+static const uint8_t InterTight_SemiBold12pt8b_Atlas[] PROGMEM = {
+    0x00, 0xFF, 0xE3, 0x80, 0xFF, 0xE3, 0x80, 0xFF, 0xE3, 0x80, 0x00, 0x03, 0x80, 0xFE, 0xFE, 0xFE,
+    0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x30, 0x00, 0x0C, 0x30, 0x00, 0x0C, 0x3F, 0x80, 0x0F, 0xFF,
+    0x80, 0xFF, 0xFC, 0x00, 0xFF, 0x30, 0x00, 0xCC, 0x30, 0x00, 0x0C, 0x30, 0x00, 0x0C, 0x3F, 0x80,
+    0x0F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0xFF, 0x30, 0x00, 0xCC, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x03, 0xC1, 0xC0, 0x07, 0xE1, 0xE0, 0x0F, 0xF1, 0xE0, 0x1C, 0xF0, 0x70, 0x18, 0x78,
+    0x30, 0x18, 0x78, 0x30, 0xFF, 0xFF, 0xFC, 0x18, 0x38, 0x30, 0x18, 0x3C, 0x30, 0x1C, 0x1C, 0x70,
+    0x0E, 0x1F, 0xE0, 0x06, 0x0F, 0xC0, 0x02, 0x07, 0x80, 0x7C, 0x00, 0x00, 0xFE, 0x00, 0x80, 0xC6,
+    0x01, 0x80, 0xC6, 0x07, 0x00, 0xC6, 0x0E, 0x00, 0xFE, 0x38, 0x00, 0x7C, 0x70, 0x00, 0x00, 0xE0,
+    0x00, 0x03, 0x80, 0x00, 0x07, 0x1E, 0x00, 0x1C, 0x3F, 0x00, 0x38, 0x61, 0x80, 0x70, 0x61, 0x80,
+    0xC0, 0x61, 0x80, 0x80, 0x3F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x7F, 0x00, 0x7F,
+    0xFF, 0x00, 0xFF, 0xE3, 0x80, 0xE7, 0xC1, 0x80, 0xC3, 0xE1, 0x80, 0xC3, 0xF1, 0x80, 0xE7, 0x79,
+    0x80, 0xFF, 0x3F, 0x80, 0x7E, 0x1F, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80,
+    0x00, 0x71, 0x80, 0x00, 0x00, 0x80, 0xFE, 0xFE, 0xFE, 0x03, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xF0, 0xFE, 0x01, 0xF8, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x08, 0x80, 0x00, 0x08, 0xE0, 0x00,
+    0x38, 0xFE, 0x01, 0xF8, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x36,
+    0x00, 0x36, 0x00, 0x1C, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x1C, 0x00, 0x36, 0x00, 0x36, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1E, 0xFE, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x01, 0xF8, 0x00, 0x1F,
+    0xF8, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x07, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x78, 0x0F, 0x00, 0xE0, 0x03, 0x80, 0xC0,
+    0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xE0, 0x03, 0x80, 0x78, 0x0F, 0x00, 0x7F, 0xFF,
+    0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x38,
+    0x03, 0x80, 0x78, 0x07, 0x80, 0xE0, 0x0F, 0x80, 0xC0, 0x1F, 0x80, 0xC0, 0x3D, 0x80, 0xC0, 0x79,
+    0x80, 0xC0, 0xF1, 0x80, 0xE1, 0xE1, 0x80, 0x7F, 0xC1, 0x80, 0x3F, 0x81, 0x80, 0x1E, 0x01, 0x80,
+    0x10, 0x0C, 0x00, 0x70, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xE0, 0x03, 0x80, 0xC1, 0x81, 0x80, 0xC1,
+    0x81, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xE3, 0xC3, 0x80, 0x7F, 0xC3, 0x00, 0x7E, 0xFF,
+    0x00, 0x1C, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00,
+    0x03, 0xEC, 0x00, 0x0F, 0x8C, 0x00, 0x1F, 0x0C, 0x00, 0x7C, 0x0C, 0x00, 0xF0, 0x0C, 0x00, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x8C,
+    0x00, 0xFF, 0x8F, 0x00, 0xFF, 0x8F, 0x00, 0xF9, 0x83, 0x80, 0xC3, 0x01, 0x80, 0xC3, 0x01, 0x80,
+    0xC3, 0x01, 0x80, 0xC3, 0x81, 0x80, 0xC3, 0xC7, 0x80, 0xC1, 0xFF, 0x00, 0xC0, 0xFE, 0x00, 0x00,
+    0x7C, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x78, 0xC7, 0x00, 0xE1, 0x83,
+    0x80, 0xC3, 0x01, 0x80, 0xC3, 0x01, 0x80, 0xC3, 0x01, 0x80, 0xC3, 0x83, 0x80, 0xF3, 0xC7, 0x00,
+    0x79, 0xFF, 0x00, 0x38, 0xFE, 0x00, 0x18, 0x7C, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x80, 0xC0,
+    0x03, 0x80, 0xC0, 0x0F, 0x80, 0xC0, 0x3F, 0x80, 0xC0, 0xFE, 0x00, 0xC3, 0xF8, 0x00, 0xCF, 0xE0,
+    0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00,
+    0x3C, 0x7E, 0x00, 0x7E, 0xFF, 0x00, 0x7F, 0xC3, 0x80, 0xE3, 0xC1, 0x80, 0xC1, 0x81, 0x80, 0xC1,
+    0x81, 0x80, 0xC1, 0x81, 0x80, 0xE3, 0xC1, 0x80, 0x7F, 0xC3, 0x80, 0x7E, 0xFF, 0x00, 0x3C, 0x7E,
+    0x00, 0x00, 0x3C, 0x00, 0x1F, 0x0C, 0x00, 0x3F, 0x8E, 0x00, 0x7F, 0xCF, 0x00, 0x71, 0xE7, 0x80,
+    0xE0, 0xE1, 0x80, 0xC0, 0x61, 0x80, 0xC0, 0x61, 0x80, 0xC0, 0x61, 0x80, 0xE0, 0xC3, 0x80, 0x79,
+    0x8F, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0x00, 0x03, 0xE0, 0x7F, 0xE0, 0x7C, 0xE0, 0x40, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x1F,
+    0x80, 0x1D, 0x80, 0x39, 0xC0, 0x38, 0xC0, 0x30, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0xE0,
+    0x38, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE0, 0x70, 0xE0, 0x70,
+    0x70, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x19, 0xC0, 0x1D, 0x80, 0x0F, 0x80, 0x0F, 0x00,
+    0x07, 0x00, 0x06, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x73, 0x80,
+    0xC0, 0xF3, 0x80, 0xC1, 0xF3, 0x80, 0xC1, 0xC3, 0x80, 0xE3, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x1F, 0x01,
+    0xF0, 0x38, 0x00, 0x70, 0x70, 0x7C, 0x38, 0x61, 0xFF, 0x18, 0xE1, 0xFF, 0x1C, 0xC3, 0x83, 0x8C,
+    0xC3, 0x01, 0x8C, 0xC3, 0x01, 0x8C, 0xC3, 0x01, 0x8C, 0xC1, 0x83, 0x0C, 0xC3, 0xFF, 0x0C, 0xE3,
+    0xFF, 0x8C, 0x63, 0xFF, 0x98, 0x70, 0x01, 0x88, 0x78, 0x01, 0x80, 0x3E, 0x03, 0x80, 0x1F, 0xFF,
+    0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x80,
+    0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0x98, 0x00, 0xFC, 0x18, 0x00, 0xF0, 0x18, 0x00, 0xFC,
+    0x18, 0x00, 0xFF, 0x98, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC1, 0x81, 0x80,
+    0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xE3, 0x81, 0x80, 0x7F,
+    0xC3, 0x80, 0x7E, 0xFF, 0x00, 0x3C, 0x7F, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFC,
+    0x00, 0x3F, 0xFE, 0x00, 0x7C, 0x1F, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x07, 0x80, 0xE0, 0x03, 0x80,
+    0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x7C,
+    0x1E, 0x00, 0x3C, 0x1E, 0x00, 0x0C, 0x18, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80,
+    0xE0, 0x03, 0x80, 0x60, 0x03, 0x00, 0x78, 0x0F, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x07,
+    0xF0, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81,
+    0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80,
+    0xC1, 0x81, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0x00, 0xC0,
+    0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0,
+    0x00, 0xC0, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7C, 0x1F, 0x00,
+    0x70, 0x07, 0x00, 0xE0, 0x07, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0xC3, 0x80, 0xE0,
+    0xC3, 0x80, 0xF0, 0xC7, 0x80, 0x78, 0xCF, 0x00, 0x3C, 0xFF, 0x00, 0x1C, 0xFE, 0x00, 0x0C, 0xF8,
+    0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+    0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80,
+    0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x01, 0xE0,
+    0x00, 0x03, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1E, 0xF8, 0x00, 0x3C, 0x3E, 0x00,
+    0xF8, 0x1F, 0x00, 0xF0, 0x0F, 0x80, 0xE0, 0x03, 0x80, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F,
+    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x7F,
+    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x7C,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+    0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7C, 0x1F, 0x00, 0x70, 0x07, 0x00, 0xF0,
+    0x07, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x07,
+    0x80, 0x70, 0x07, 0x00, 0x7C, 0x1F, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF0, 0x00,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0,
+    0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xE0, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80,
+    0x00, 0x1F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7C, 0x1F, 0x00,
+    0x70, 0x07, 0x00, 0xF0, 0x07, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x13, 0x80, 0xE0, 0x1B, 0x80, 0xE0,
+    0x1F, 0x80, 0xF0, 0x0F, 0x80, 0x70, 0x07, 0x80, 0x7C, 0x1F, 0xC0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFC,
+    0x40, 0x07, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0x00,
+    0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xE0, 0x00, 0xC0, 0xF8, 0x00, 0xE1, 0xFE, 0x00, 0x7F,
+    0x9F, 0x80, 0x7F, 0x87, 0x80, 0x1E, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1E, 0x0E,
+    0x00, 0x3F, 0x0F, 0x00, 0x7F, 0x8F, 0x00, 0xE7, 0x83, 0x80, 0xC3, 0xC1, 0x80, 0xC3, 0xC1, 0x80,
+    0xC1, 0xC1, 0x80, 0xC1, 0xC1, 0x80, 0xC1, 0xE1, 0x80, 0xE0, 0xE3, 0x80, 0x70, 0xFF, 0x00, 0x30,
+    0x7E, 0x00, 0x10, 0x3C, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC0, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFF,
+    0xF8, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00,
+    0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7F,
+    0x80, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x80, 0x0F,
+    0xFF, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x01, 0x80, 0xF0, 0x07, 0x80, 0xF8, 0x0F, 0x80, 0x7E, 0x3F, 0x00, 0x1F, 0x7C, 0x00,
+    0x0F, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3E, 0x3E, 0x00, 0xFC,
+    0x1F, 0x80, 0xF0, 0x07, 0x80, 0xE0, 0x03, 0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00, 0xE0, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0x80,
+    0x00, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x01, 0x80, 0xC0, 0x07, 0x80, 0xC0, 0x0F,
+    0x80, 0xC0, 0x3F, 0x80, 0xC0, 0x7D, 0x80, 0xC1, 0xF9, 0x80, 0xC3, 0xE1, 0x80, 0xCF, 0xC1, 0x80,
+    0xDF, 0x01, 0x80, 0xFE, 0x01, 0x80, 0xF8, 0x01, 0x80, 0xF0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xC0, 0x00,
+    0x18, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x1F, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xC0,
+    0x00, 0x18, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0x1E, 0x7C, 0xE0,
+    0xC0, 0xF8, 0x3E, 0x0E, 0x02, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0x80, 0xC0, 0xE0, 0x20, 0x01, 0xE0, 0x63, 0xF0, 0x73, 0xF8, 0xE7, 0x38, 0xC7, 0x18, 0xC6, 0x18,
+    0xC6, 0x18, 0xE6, 0x30, 0xFF, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0x80, 0x07, 0x07, 0x00, 0x04, 0x01, 0x00, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C,
+    0x01, 0x80, 0x0F, 0x07, 0x80, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0x80,
+    0x3F, 0xE0, 0x7F, 0xF0, 0x70, 0x78, 0xE0, 0x38, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xF0, 0x78,
+    0x70, 0x70, 0x30, 0x60, 0x00, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x0F,
+    0x07, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x00, 0x07, 0x07,
+    0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x0F, 0x80, 0x3F, 0xE0, 0x7F, 0xF0,
+    0xE6, 0x78, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xE6, 0x38, 0x7E, 0x70, 0x3E, 0x70,
+    0x1E, 0x40, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xC0, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xE1, 0x80,
+    0x7F, 0xF1, 0x80, 0xF0, 0x79, 0xC0, 0xC0, 0x18, 0xC0, 0xC0, 0x18, 0xC0, 0xC0, 0x18, 0xC0, 0x40,
+    0x10, 0xC0, 0x70, 0x71, 0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0xE7,
+    0xFF, 0xC0, 0xE7, 0xFF, 0xC0, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0xE7, 0xFF,
+    0xFE, 0xE7, 0xFF, 0xFC, 0xE7, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+    0x00, 0x38, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0x8F, 0x00, 0x0F,
+    0x07, 0x80, 0x0C, 0x03, 0x80, 0x08, 0x01, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xE0, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xE0, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,
+    0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8,
+    0x0F, 0x80, 0x3F, 0xE0, 0x7F, 0xF0, 0xF0, 0x78, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18,
+    0xF0, 0x78, 0x7F, 0xF0, 0x3F, 0xE0, 0x0F, 0x80, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xC0, 0x70, 0x70, 0x00, 0x40, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00,
+    0xF0, 0x78, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
+    0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xF0, 0x78, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18,
+    0x00, 0x40, 0x18, 0x00, 0x70, 0x70, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x3C, 0x60, 0x7E, 0x70, 0x7E, 0x78, 0xEE, 0x18, 0xC7, 0x18, 0xC7, 0x18, 0xC7, 0x18, 0xE7, 0xB8,
+    0x73, 0xF0, 0x73, 0xF0, 0x21, 0xE0, 0x18, 0x00, 0x18, 0x00, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF,
+    0x18, 0x03, 0x18, 0x03, 0x18, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x38, 0x00, 0x18,
+    0x00, 0x18, 0x00, 0x10, 0x00, 0x30, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x80, 0x00, 0xF0, 0x00,
+    0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x38, 0x03, 0xF8, 0x1F, 0xF0, 0xFF, 0x80,
+    0xFC, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0xF0, 0x07, 0xF8,
+    0x00, 0x78, 0x03, 0xF8, 0x3F, 0xE0, 0xFE, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xF8,
+    0x00, 0x78, 0x07, 0xF8, 0x7F, 0xF0, 0xFF, 0x00, 0xF8, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x18,
+    0xF0, 0x78, 0xF8, 0xF8, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x3F, 0xE0, 0x7D, 0xF0, 0xF0, 0x78,
+    0xE0, 0x38, 0x80, 0x08, 0x80, 0x00, 0x00, 0xF0, 0x00, 0xC0, 0xFE, 0x01, 0xC0, 0x7F, 0xC1, 0xC0,
+    0x0F, 0xFB, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
+    0x80, 0x00, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0xC0, 0x78, 0xC0,
+    0xF8, 0xC3, 0xF8, 0xC7, 0xD8, 0xDF, 0x98, 0xFE, 0x18, 0xF8, 0x18, 0xF0, 0x18, 0xC0, 0x18, 0x00,
+    0x70, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x7F, 0xDF, 0xF0, 0xFF, 0xDF, 0xF8, 0xE0, 0x00,
+    0x38, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xE0, 0x00, 0x38, 0xFF, 0xCF, 0xF8, 0x7F,
+    0xDF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x70, 0x00, 0x30, 0x70, 0xF0, 0xE0, 0xC0,
+    0xE0, 0x70, 0x30, 0x38, 0x38, 0xF8, 0xF0, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x80, 0x00,
+    0x7F, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0x98, 0x00, 0xFC, 0x18, 0x00, 0xF0, 0x18,
+    0x00, 0xFC, 0x18, 0x00, 0xFF, 0x98, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFE, 0x38, 0x00, 0x7F, 0xFC,
+    0x00, 0x0F, 0xFC, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x04, 0xC0, 0xE0, 0xF0, 0x30, 0x30, 0xF0, 0xE0,
+    0xC0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+    0x01, 0x81, 0x80, 0x01, 0x81, 0x80, 0x03, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+    0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0xCF, 0xC8, 0xFF, 0xFC, 0x78, 0x78, 0x60, 0x18,
+    0xE0, 0x1C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xE0, 0x1C, 0x60, 0x18, 0x78, 0x78,
+    0xFF, 0xFC, 0xCF, 0xC8, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0xC0,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xF0, 0x00, 0xC0, 0xF0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x00, 0xF0, 0x70, 0x01, 0xF8, 0x78, 0x03, 0xFC,
+    0x78, 0x07, 0x3C, 0x1C, 0x06, 0x1E, 0x0C, 0x26, 0x1E, 0x0C, 0xE6, 0x0E, 0x0C, 0xE6, 0x0E, 0x0C,
+    0xC6, 0x0F, 0x0C, 0x07, 0x07, 0x1C, 0x03, 0x87, 0xF8, 0x01, 0x83, 0xF0, 0x00, 0x81, 0xE0, 0x00,
+    0xE0, 0xC0, 0x39, 0xF0, 0xE0, 0x7F, 0xF8, 0xF0, 0xFF, 0x3C, 0x70, 0xC7, 0x1C, 0x30, 0xC7, 0x1E,
+    0x30, 0xC3, 0x8E, 0x30, 0xF3, 0xCF, 0xF0, 0x71, 0xFF, 0xE0, 0x30, 0xFB, 0xC0, 0x00, 0x70, 0x00,
+    0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x78, 0x38, 0x00, 0xFC,
+    0x3C, 0x81, 0xFE, 0x3C, 0xC3, 0x9E, 0x0E, 0xF3, 0x0F, 0x06, 0x33, 0x0F, 0x06, 0x33, 0x07, 0x06,
+    0x73, 0x07, 0x06, 0xE3, 0x07, 0x86, 0xC3, 0x83, 0x8E, 0x81, 0xC3, 0xFC, 0x01, 0xC1, 0xF8, 0x00,
+    0x40, 0xF0, 0x00, 0x08, 0x00, 0x1E, 0x0E, 0x00, 0x3F, 0x0F, 0x00, 0x7F, 0x8F, 0x00, 0xE7, 0x83,
+    0x80, 0xC3, 0xC1, 0x80, 0xC3, 0xC1, 0xCC, 0xC1, 0xC1, 0xCC, 0xC1, 0xC1, 0xFC, 0xC1, 0xE1, 0xB8,
+    0xE0, 0xE3, 0x80, 0x70, 0xFF, 0x00, 0x30, 0x7E, 0x00, 0x10, 0x3C, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x7B, 0xFF, 0xFE, 0x1B, 0xFF,
+    0xFE, 0x7B, 0xFF, 0xFE, 0xF3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x7C, 0x06,
+    0x01, 0xFC, 0x06, 0x03, 0xEC, 0x06, 0x0F, 0xCC, 0x66, 0x1F, 0x0C, 0xE6, 0x7E, 0x0C, 0xC6, 0xF8,
+    0x0C, 0x87, 0xF0, 0x0C, 0x07, 0xC0, 0x0C, 0x07, 0x80, 0x0C, 0x06, 0x00, 0x0C, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x03, 0x00, 0x06, 0x03, 0x00, 0x1E, 0x83, 0x00, 0x3E, 0xC3, 0x00,
+    0xFE, 0xF3, 0x01, 0xF6, 0x7B, 0x07, 0xE6, 0x1B, 0x0F, 0x86, 0x7B, 0x3F, 0x06, 0xF3, 0x7C, 0x06,
+    0xC3, 0xF8, 0x06, 0x83, 0xE0, 0x06, 0x03, 0xC0, 0x06, 0x03, 0x00, 0x06, 0x06, 0x00, 0x0C, 0x06,
+    0x00, 0x3C, 0x06, 0x00, 0x7C, 0x06, 0x01, 0xFC, 0x06, 0x03, 0xFC, 0xE6, 0x0F, 0xCC, 0xE6, 0x3F,
+    0x0C, 0xE6, 0x7E, 0x0C, 0x07, 0xF8, 0x0C, 0x07, 0xF0, 0x0C, 0x07, 0xC0, 0x0C, 0x07, 0x80, 0x0C,
+    0x06, 0x00, 0x0C, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x01, 0xE0, 0x00, 0x63, 0xF0,
+    0x00, 0x73, 0xF8, 0x00, 0xE7, 0x38, 0x00, 0xC7, 0x18, 0x00, 0xC6, 0x18, 0x00, 0xC6, 0x10, 0x00,
+    0xE6, 0x37, 0x80, 0xFF, 0xFF, 0xC0, 0x7F, 0xFC, 0xC0, 0x3F, 0xF8, 0xC0, 0x00, 0x7C, 0xFC, 0x4C,
+    0x0C, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x60, 0xE0, 0xC0, 0x80, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0,
+    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01,
+    0xE3, 0x00, 0x03, 0xF3, 0x80, 0x03, 0xF3, 0xC0, 0x07, 0x70, 0xC0, 0x26, 0x38, 0xC0, 0x66, 0x38,
+    0xC0, 0xE6, 0x38, 0xC0, 0xC7, 0x3D, 0xC0, 0x83, 0x9F, 0x80, 0x03, 0x9F, 0x80, 0x01, 0x0F, 0x00,
+    0x00, 0x80, 0xE0, 0x70, 0x30, 0x70, 0xE0, 0xC0, 0x80, 0x4C, 0xCC, 0x7C, 0x38, 0x00, 0xF1, 0x80,
+    0x81, 0xF9, 0xC0, 0xE1, 0xF9, 0xE0, 0xF3, 0xB8, 0x60, 0x3B, 0x1C, 0x60, 0x1B, 0x1C, 0x60, 0x7B,
+    0x1C, 0x60, 0xF3, 0x9E, 0xE0, 0xC1, 0xCF, 0xC0, 0x81, 0xCF, 0xC0, 0x00, 0x87, 0x80, 0x3C, 0x60,
+    0x00, 0x7E, 0x70, 0x00, 0x7E, 0x78, 0x00, 0xEE, 0x18, 0x00, 0xC7, 0x1C, 0xC0, 0xC7, 0x1C, 0xC0,
+    0xC7, 0x1F, 0x80, 0xE7, 0xBB, 0x80, 0x73, 0xF0, 0x00, 0x73, 0xF0, 0x00, 0x21, 0xE0, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x03, 0x00,
+    0x60, 0xF3, 0x00, 0x60, 0xF3, 0x00, 0x20, 0xE0, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x06, 0x03, 0xC0,
+    0x06, 0x07, 0xC0, 0x06, 0x1F, 0xC0, 0x26, 0x3E, 0xC0, 0xE6, 0xFC, 0xC0, 0xC7, 0xF0, 0xC0, 0x87,
+    0xC0, 0xC0, 0x07, 0x80, 0xC0, 0x06, 0x00, 0xC0, 0x00, 0x60, 0xE0, 0xC0, 0x80, 0x20, 0x60, 0xC0,
+    0x80, 0x00, 0x06, 0x00, 0xC0, 0x86, 0x03, 0xC0, 0xC6, 0x07, 0xC0, 0xE6, 0x1F, 0xC0, 0x76, 0x3E,
+    0xC0, 0x76, 0xFC, 0xC0, 0xE7, 0xF0, 0xC0, 0xC7, 0xC0, 0xC0, 0x87, 0x80, 0xC0, 0x06, 0x00, 0xC0,
+    0x06, 0x00, 0xC0, 0x06, 0x03, 0xC0, 0x06, 0x07, 0xC0, 0x06, 0x0F, 0xC0, 0xE6, 0x3F, 0xC0, 0xE6,
+    0x7C, 0xC0, 0xE7, 0xF8, 0xC0, 0x07, 0xE0, 0xC0, 0x07, 0x80, 0xC0, 0x07, 0x00, 0xC0, 0x07, 0xFF,
+    0xFC, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x66, 0x06, 0x00,
+    0xE6, 0x07, 0x00, 0xC6, 0x07, 0xC0, 0x87, 0x0F, 0xF0, 0x03, 0xFC, 0xFC, 0x03, 0xFC, 0x3C, 0x00,
+    0xF0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F,
+    0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0xC0, 0x07, 0xE0, 0xC0, 0x67, 0x80, 0xC0, 0xE7, 0xE0, 0xC0,
+    0xC7, 0xFC, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFE, 0x08, 0x0F, 0xF8, 0x18, 0x7F,
+    0xE0, 0x7B, 0xFE, 0x60, 0xF3, 0xF0, 0x60, 0xC3, 0xC0, 0x60, 0xF3, 0xF0, 0x60, 0x3B, 0xFE, 0x60,
+    0x18, 0x7F, 0xE0, 0x08, 0x0F, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xFC, 0xC0, 0x1F, 0xF0, 0xE0, 0xFF, 0xC0, 0xF7, 0xFC,
+    0xC0, 0x37, 0xE0, 0xC0, 0x37, 0x80, 0xC0, 0x37, 0xE0, 0xC0, 0xF7, 0xFC, 0xC0, 0xE0, 0xFF, 0xC0,
+    0xC0, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0x7C, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0xE0, 0x7F, 0xC0, 0xE3, 0xFE, 0xC0, 0xE7, 0xF8,
+    0xC0, 0x07, 0xC0, 0xC0, 0x07, 0xC0, 0xC0, 0xE7, 0xF8, 0xC0, 0xE1, 0xFF, 0xC0, 0xE0, 0x3F, 0xF0,
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1C, 0x07, 0xFF, 0xFC, 0x67, 0xFF, 0xFC, 0xE7,
+    0xFF, 0xFC, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xE0,
+    0x01, 0xFF, 0xF0, 0x03, 0xE0, 0xF8, 0x03, 0x80, 0x38, 0x07, 0x80, 0x3C, 0x07, 0x00, 0x1C, 0x67,
+    0x00, 0x1C, 0xE7, 0x00, 0x1C, 0xC7, 0x00, 0x1C, 0x87, 0x80, 0x3C, 0x03, 0xC0, 0x78, 0x03, 0xE0,
+    0xF0, 0x01, 0xE0, 0xF0, 0x00, 0x60, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00,
+    0x7C, 0x1F, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x8C, 0xE0, 0x03, 0xCC, 0xE0,
+    0x03, 0xFC, 0xE0, 0x03, 0xB8, 0xF0, 0x07, 0x00, 0x7C, 0x0F, 0x00, 0x3C, 0x1E, 0x00, 0x1C, 0x1C,
+    0x00, 0x04, 0x10, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF8, 0x01, 0xF0, 0x7C,
+    0xC1, 0xC0, 0x1C, 0xE3, 0xC0, 0x1E, 0x73, 0x80, 0x0E, 0x33, 0x80, 0x0E, 0x73, 0x80, 0x0E, 0xF3,
+    0x80, 0x0E, 0xC3, 0xC0, 0x1E, 0x81, 0xC0, 0x3C, 0x01, 0xE0, 0x78, 0x00, 0xE0, 0x70, 0x00, 0x60,
+    0x60, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x06, 0x0C, 0x0C, 0x06, 0x0C, 0x0C,
+    0x66, 0x0C, 0x0C, 0xE6, 0x0C, 0x0C, 0xC6, 0x0C, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x0C, 0x0C, 0x06,
+    0x0C, 0x0C, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81,
+    0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81, 0xB8, 0xC1, 0x81, 0xFC, 0xC1, 0x81, 0xFC,
+    0xC1, 0x81, 0x8C, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0xE7, 0xFF, 0xFC, 0xE6, 0x0C, 0x0C, 0xE6,
+    0x0C, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x0C, 0x0C, 0xE6, 0x0C, 0x0C, 0xE6, 0x0C, 0x0C, 0xE6, 0x0C,
+    0x0C, 0x06, 0x0C, 0x0C, 0x03, 0xFF, 0xFE, 0x83, 0xFF, 0xFE, 0xC3, 0xFF, 0xFE, 0xE3, 0x06, 0x06,
+    0x7B, 0x06, 0x06, 0x1B, 0x06, 0x06, 0x7B, 0x06, 0x06, 0xF3, 0x06, 0x06, 0xC3, 0x06, 0x06, 0x83,
+    0x06, 0x06, 0x03, 0x06, 0x06, 0x07, 0xFF, 0xFC, 0x67, 0xFF, 0xFC, 0xE7, 0xFF, 0xFC, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF3, 0xFF, 0xFE,
+    0xC3, 0xFF, 0xFE, 0xF3, 0xFF, 0xFE, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03,
+    0xFF, 0xFE, 0x83, 0xFF, 0xFE, 0xE3, 0xFF, 0xFE, 0xF3, 0x00, 0x06, 0x3B, 0x00, 0x06, 0x3B, 0x00,
+    0x06, 0x73, 0x00, 0x06, 0xE3, 0x00, 0x06, 0xC3, 0x80, 0x0E, 0x81, 0x80, 0x0C, 0x01, 0xE0, 0x3C,
+    0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xC0, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xC1, 0x81, 0x80, 0xC1, 0x81,
+    0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xE0, 0x03, 0x80, 0x60, 0x03, 0x00,
+    0x78, 0x0F, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x07,
+    0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x20, 0x3E,
+    0x00, 0xE0, 0x0F, 0x80, 0xC0, 0x07, 0xC0, 0x80, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x07, 0xFF, 0xFC,
+    0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0xC1,
+    0xF0, 0x00, 0xE0, 0x7C, 0x00, 0x70, 0x3E, 0x00, 0x38, 0x1F, 0x00, 0x38, 0x07, 0xC0, 0x70, 0x03,
+    0xE0, 0xE0, 0x01, 0xF0, 0xC0, 0x00, 0x7C, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE,
+    0x00, 0x3F, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x03, 0xE0, 0xF8, 0x03, 0x80, 0x38, 0x07,
+    0x80, 0x3C, 0x07, 0x00, 0x1C, 0x27, 0x00, 0x1C, 0xE7, 0x00, 0x1C, 0xC7, 0x00, 0x1C, 0x87, 0x80,
+    0x3C, 0x03, 0x80, 0x38, 0x03, 0xE0, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x80,
+    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF8, 0x01, 0xF0, 0x7C, 0x11, 0xC0, 0x1C, 0x33,
+    0xC0, 0x1E, 0x73, 0x80, 0x0E, 0xE3, 0x80, 0x0E, 0xE3, 0x80, 0x0E, 0x73, 0x80, 0x0E, 0x33, 0xC0,
+    0x1E, 0x11, 0xC0, 0x1C, 0x01, 0xF0, 0x7C, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xC0,
+    0x00, 0x3F, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x03, 0xE0, 0xF8, 0x03, 0x80, 0x38, 0x67,
+    0x80, 0x3C, 0xE7, 0x00, 0x1C, 0xC7, 0x00, 0x1C, 0x87, 0x00, 0x1C, 0x27, 0x00, 0x1C, 0x67, 0x80,
+    0x3C, 0xE3, 0x80, 0x38, 0xC3, 0xE0, 0xF8, 0x81, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x80,
+    0x00, 0x3F, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x03, 0xE0, 0xF8, 0xE3, 0x80, 0x38, 0xE7,
+    0x80, 0x3C, 0xE7, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0xE7, 0x00, 0x1C, 0xE7, 0x80,
+    0x3C, 0xE3, 0x80, 0x38, 0x03, 0xE0, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x80,
+    0x60, 0x60, 0xF0, 0xF0, 0x79, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x1F, 0x80, 0x3F, 0xC0,
+    0x79, 0xE0, 0xF0, 0xF0, 0x60, 0x60, 0x03, 0xFF, 0xFE, 0x83, 0xFF, 0xFE, 0xC3, 0xFF, 0xFE, 0xE3,
+    0x03, 0x00, 0x73, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x3B, 0x03, 0x80, 0xF3, 0x03, 0xE0, 0xC3, 0x87,
+    0xF8, 0x81, 0xFE, 0x7E, 0x01, 0xFE, 0x1E, 0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0,
+    0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x07, 0xCC,
+    0x00, 0x07, 0xCC, 0x00, 0x07, 0x78, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x01, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xF8,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x20, 0x00, 0x1C, 0xE0, 0x00, 0x1C, 0xC0,
+    0x00, 0x1C, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x07, 0xFF,
+    0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x78, 0x20, 0x00, 0x3C,
+    0xE0, 0x00, 0x1C, 0xC0, 0x00, 0x1C, 0x80, 0x00, 0x1C, 0x20, 0x00, 0x1C, 0x60, 0x00, 0x3C, 0xC0,
+    0x00, 0x78, 0xC7, 0xFF, 0xF8, 0x87, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF,
+    0xF0, 0x07, 0xFF, 0xF8, 0xE0, 0x00, 0x78, 0xE0, 0x00, 0x3C, 0xE0, 0x00, 0x1C, 0x00, 0x00, 0x1C,
+    0x00, 0x00, 0x1C, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x3C, 0xE0, 0x00, 0x78, 0x07, 0xFF, 0xF8, 0x07,
+    0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xE0,
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xFC, 0x60, 0x07, 0xFC, 0xE0, 0x1F, 0xFC,
+    0xC0, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+    0x00, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xE6, 0xC0, 0x00, 0x3C, 0xC0, 0x00, 0x38,
+    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x7F,
+    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC1, 0x81, 0x80, 0xC1, 0x81,
+    0x80, 0xE3, 0x81, 0x80, 0x7F, 0xC3, 0x80, 0x7E, 0xFF, 0x00, 0x3C, 0x7F, 0x00, 0x00, 0x3E, 0x00,
+    0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x63, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xC6,
+    0x00, 0x00, 0x86, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x1F, 0x80, 0x03, 0x9F,
+    0xC0, 0x07, 0x39, 0xC0, 0x06, 0x38, 0xC0, 0x26, 0x30, 0xC0, 0xE6, 0x30, 0xC0, 0xC7, 0x31, 0x80,
+    0x87, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0x80, 0x01, 0x8F, 0xC0, 0x19,
+    0xCF, 0xE0, 0x3B, 0x9C, 0xE0, 0x73, 0x1C, 0x60, 0xE3, 0x18, 0x60, 0xE3, 0x18, 0x60, 0x73, 0x98,
+    0xC0, 0x3B, 0xFF, 0xE0, 0x09, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0x00, 0x03, 0x1F, 0x80,
+    0xC3, 0x9F, 0xC0, 0xE7, 0xB9, 0xC0, 0xF6, 0x38, 0xC0, 0x36, 0x30, 0xC0, 0x36, 0x30, 0xC0, 0xF7,
+    0x31, 0x80, 0xE7, 0xFF, 0xC0, 0xC3, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0x00, 0x03, 0x1F,
+    0x80, 0xE3, 0x9F, 0xC0, 0xE7, 0x39, 0xC0, 0xE6, 0x38, 0xC0, 0x06, 0x30, 0xC0, 0x06, 0x30, 0xC0,
+    0xE7, 0x31, 0x80, 0xE7, 0xFF, 0xC0, 0xE3, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x67,
+    0xFF, 0xFC, 0xE7, 0xFF, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF,
+    0x00, 0x03, 0xFF, 0x80, 0x03, 0x83, 0xC0, 0x07, 0x01, 0xC0, 0x26, 0x00, 0xC0, 0xE6, 0x00, 0xC0,
+    0xC6, 0x00, 0xC0, 0x87, 0x83, 0xC0, 0x03, 0x83, 0x80, 0x01, 0x83, 0x00, 0x00, 0x02, 0x00, 0x0F,
+    0x80, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x70, 0x70, 0x00, 0xE0, 0x38, 0x00, 0xC0, 0x1C,
+    0xC0, 0xC0, 0x1C, 0xC0, 0xC0, 0x1F, 0x80, 0xE0, 0x3B, 0x80, 0x70, 0x70, 0x00, 0x70, 0x70, 0x00,
+    0x10, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x83, 0xFF, 0x80, 0xC3, 0x83, 0xC0, 0xE7,
+    0x01, 0xC0, 0x76, 0x00, 0xC0, 0x36, 0x00, 0xC0, 0xE6, 0x00, 0xC0, 0xC7, 0x03, 0xC0, 0x83, 0x83,
+    0x80, 0x01, 0x83, 0x00, 0x00, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x80,
+    0x07, 0x33, 0xC0, 0x06, 0x31, 0xC0, 0x26, 0x30, 0xC0, 0xE6, 0x30, 0xC0, 0xC6, 0x30, 0xC0, 0x87,
+    0x31, 0xC0, 0x03, 0xF3, 0x80, 0x01, 0xF3, 0x80, 0x00, 0xF2, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xE0,
+    0x00, 0x7F, 0xF0, 0x00, 0xE6, 0x78, 0x00, 0xC6, 0x3B, 0x00, 0xC6, 0x1F, 0x80, 0xC6, 0x1F, 0x80,
+    0xC6, 0x19, 0x80, 0xE6, 0x39, 0x80, 0x7E, 0x70, 0x00, 0x3E, 0x70, 0x00, 0x1E, 0x40, 0x00, 0x00,
+    0x7C, 0x00, 0x01, 0xFF, 0x00, 0xE3, 0xFF, 0x80, 0xE7, 0x33, 0xC0, 0xE6, 0x31, 0xC0, 0x06, 0x30,
+    0xC0, 0x06, 0x30, 0xC0, 0xE6, 0x30, 0xC0, 0xE7, 0x31, 0xC0, 0xE3, 0xF3, 0x80, 0x01, 0xF3, 0x80,
+    0x00, 0xF2, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0xC1, 0xFF, 0xC0, 0xE3, 0x99, 0xE0, 0x73,
+    0x18, 0xE0, 0x3B, 0x18, 0x60, 0x3B, 0x18, 0x60, 0x73, 0x18, 0x60, 0xE3, 0x98, 0xE0, 0xC1, 0xF9,
+    0xC0, 0x00, 0xF9, 0xC0, 0x00, 0x79, 0x00, 0x07, 0xFF, 0xC0, 0x67, 0xFF, 0xC0, 0xE7, 0xFF, 0xC0,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE7,
+    0xFF, 0xC0, 0xC7, 0xFF, 0xC0, 0xE7, 0xFF, 0xC0, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x07, 0x83, 0xC0, 0x06, 0x00, 0xC0,
+    0x06, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0x80, 0x03, 0x83, 0x80, 0x7F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00,
+    0x00, 0x01, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0x07, 0x80, 0x0C, 0x01, 0x80,
+    0x0C, 0x01, 0x80, 0x6C, 0x01, 0x80, 0x6C, 0x01, 0x00, 0x67, 0x07, 0x00, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF,
+    0xC0, 0x07, 0xFF, 0xC0, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x66, 0x00, 0x00, 0xE6, 0x00, 0x00,
+    0xC7, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07,
+    0xFF, 0xC0, 0x87, 0xFF, 0xC0, 0xE3, 0x00, 0x00, 0x76, 0x00, 0x00, 0x36, 0x00, 0x00, 0x76, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x87, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x7C, 0x00,
+    0x01, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x07, 0x83, 0xC0, 0x06, 0x00, 0xC0, 0x26, 0x00, 0xC0, 0xE6,
+    0x00, 0xC0, 0xC6, 0x00, 0xC0, 0x87, 0x83, 0xC0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x19, 0xFF, 0xC0, 0x3B, 0xC1, 0xE0, 0x73, 0x00, 0x60,
+    0xE3, 0x00, 0x60, 0xE3, 0x00, 0x60, 0x73, 0x00, 0x60, 0x3B, 0xC1, 0xE0, 0x09, 0xFF, 0xC0, 0x00,
+    0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x27, 0x83,
+    0xC0, 0xE6, 0x00, 0xC0, 0xC6, 0x00, 0xC0, 0x86, 0x00, 0xC0, 0x26, 0x00, 0xC0, 0x67, 0x83, 0xC0,
+    0xC3, 0xFF, 0x80, 0x81, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xE3,
+    0xFF, 0x80, 0xE7, 0x83, 0xC0, 0xE6, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0xE6, 0x00,
+    0xC0, 0xE7, 0x83, 0xC0, 0xE3, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0xE3, 0x38, 0xE3, 0x38, 0xE3, 0x38, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xC0, 0xC7, 0xFF, 0xC0, 0x77, 0xFF, 0xC0, 0x33,
+    0x00, 0x00, 0x76, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x86, 0x00, 0x00, 0x01, 0xFF,
+    0xC0, 0x01, 0xFF, 0xE0, 0x79, 0xFF, 0xF0, 0x7C, 0x00, 0x70, 0xCC, 0x00, 0x30, 0xCC, 0x00, 0x30,
+    0xCC, 0x00, 0x20, 0x7C, 0x00, 0x60, 0x79, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x07,
+    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x60, 0x00,
+    0xC0, 0xE0, 0x00, 0x80, 0xC0, 0x01, 0x80, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0,
+    0x07, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x60, 0x01, 0xC0, 0xE0, 0x00, 0xC0, 0xC0,
+    0x00, 0xC0, 0x20, 0x00, 0x80, 0x60, 0x01, 0x80, 0xE7, 0xFF, 0xC0, 0xC7, 0xFF, 0xC0, 0x87, 0xFF,
+    0xC0, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0xE7, 0xFF, 0xC0, 0xE0, 0x01, 0xC0, 0xE0, 0x00, 0xC0,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0xE0, 0x01, 0x80, 0xE7, 0xFF, 0xC0, 0xE7, 0xFF, 0xC0, 0x07,
+    0xFF, 0xC0, 0x08, 0x00, 0x00, 0x0F, 0x00, 0x0C, 0x0F, 0xE0, 0x1C, 0x07, 0xFC, 0x1C, 0x00, 0xFF,
+    0xBC, 0x20, 0x1F, 0xF8, 0xE0, 0x03, 0xF8, 0xE0, 0x3F, 0xE0, 0xC1, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
+    0x0F, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x18, 0x18, 0x07, 0x98, 0x18, 0x07, 0xF8, 0x00, 0x00,
+    0x70, 0xE0, 0xE0, 0xE0,
+};
+static const uint32_t InterTight_SemiBold12pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 13, 21, 63, 105, 153, 198, 201, 219, 237, 257,
+    281, 285, 293, 296, 320, 359, 380, 416, 455, 494, 530, 569,
+    605, 644, 683, 689, 697, 721, 732, 756, 789, 855, 900, 939,
+    984, 1026, 1059, 1092, 1137, 1179, 1188, 1221, 1263, 1296, 1350, 1392,
+    1440, 1476, 1524, 1563, 1605, 1647, 1689, 1737, 1806, 1851, 1896, 1935,
+    1953, 1977, 1995, 2005, 2016, 2020, 2042, 2078, 2102, 2138, 2162, 2186,
+    2222, 2255, 2264, 2279, 2315, 2324, 2362, 2384, 2408, 2444, 2480, 2496,
+    2518, 2534, 2556, 2582, 2620, 2644, 2683, 2703, 2727, 2739, 2763, 2776,
+    2776, 2777, 2825, 2833, 2872, 2900, 2933, 2975, 3008, 3016, 3058, 3100,
+    3142, 3181, 3189, 3228, 3267, 3275, 3308, 3313, 3334, 3338, 3359, 3392,
+    3401, 3405, 3438, 3471, 3498, 3528, 3538, 3568, 3598, 3637, 3682, 3727,
+    3772, 3817, 3850, 3895, 3940, 3985, 4018, 4051, 4084, 4117, 4132, 4159,
+    4201, 4252, 4294, 4336, 4384, 4432, 4480, 4528, 4550, 4589, 4631, 4673,
+    4715, 4757, 4802, 4844, 4880, 4904, 4937, 4970, 5003, 5036, 5051, 5087,
+    5123, 5159, 5195, 5231, 5267, 5303, 5318, 5345, 5393, 5435, 5468, 5501,
+    5537, 5573, 5609, 5645, 5667, 5694, 5727, 5760, 5793, 5826, 5865, 5889,
+};
+
+// InterTightSemiBold14pt8bfr.h
+static const uint8_t InterTight_SemiBold14pt8b_Atlas[] PROGMEM = {
+    0x00, 0xFF, 0xF8, 0x60, 0xFF, 0xF8, 0xF0, 0xFF, 0xF8, 0xF0, 0xFF, 0xF8, 0x60, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x07, 0x0E, 0xF0, 0x07,
+    0x3F, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFE, 0x00, 0xFF, 0x0E, 0x00, 0xC7, 0x0E, 0x00, 0x07, 0x0E,
+    0x00, 0x07, 0x0E, 0xF0, 0x07, 0x3F, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFE, 0x00, 0xFF, 0x8E, 0x00,
+    0xE7, 0x0E, 0x00, 0x07, 0x0C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x03, 0xE0, 0x70,
+    0x00, 0x07, 0xF0, 0x78, 0x00, 0x0F, 0xF8, 0x7C, 0x00, 0x0F, 0xF8, 0x3C, 0x00, 0x1E, 0x3C, 0x1E,
+    0x00, 0x1C, 0x1C, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x1C, 0x1E, 0x0E,
+    0x00, 0x1E, 0x0E, 0x1E, 0x00, 0x1F, 0x0F, 0x1E, 0x00, 0x0F, 0x8F, 0xFC, 0x00, 0x0F, 0x87, 0xFC,
+    0x00, 0x07, 0x83, 0xF8, 0x00, 0x01, 0x81, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF,
+    0x80, 0x30, 0xC1, 0x80, 0x70, 0xC1, 0x81, 0xE0, 0xC1, 0x83, 0xC0, 0xFF, 0x8F, 0x00, 0x7F, 0x1E,
+    0x00, 0x3E, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC7, 0xC0, 0x07, 0x8F, 0xE0, 0x0E, 0x1F, 0xF0,
+    0x3C, 0x18, 0x30, 0x70, 0x18, 0x30, 0xE0, 0x18, 0x30, 0x80, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
+    0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xC0, 0x1E, 0x3F, 0xE0, 0x7F, 0xBF, 0xE0, 0x7F, 0xF8,
+    0xF0, 0xF1, 0xF0, 0x70, 0xE0, 0xF0, 0x70, 0xE1, 0xF8, 0x70, 0xF3, 0xFE, 0x70, 0xFF, 0x9F, 0xF0,
+    0x7F, 0x0F, 0xE0, 0x3E, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0x70, 0x00,
+    0x1C, 0x30, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x00,
+    0xFF, 0x80, 0x31, 0x80, 0x3B, 0x80, 0x1B, 0x00, 0x0E, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x0E, 0x00,
+    0x1B, 0x00, 0x3B, 0x80, 0x31, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xFC,
+    0x01, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7C, 0x03,
+    0xE0, 0xF0, 0x00, 0xF0, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70,
+    0xF0, 0x00, 0xF0, 0x7C, 0x03, 0xE0, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x03,
+    0xFC, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x0C, 0x00, 0x70,
+    0x3C, 0x00, 0xF0, 0x7C, 0x01, 0xF0, 0x7C, 0x03, 0xF0, 0xF0, 0x07, 0xF0, 0xE0, 0x0F, 0xF0, 0xE0,
+    0x1F, 0x70, 0xE0, 0x3E, 0x70, 0xE0, 0x7C, 0x70, 0xF0, 0xF8, 0x70, 0x7F, 0xF0, 0x70, 0x7F, 0xE0,
+    0x70, 0x3F, 0xC0, 0x70, 0x1F, 0x00, 0x70, 0x00, 0x03, 0x80, 0x18, 0x03, 0xC0, 0x38, 0x03, 0xE0,
+    0x78, 0x03, 0xE0, 0x70, 0x00, 0xF0, 0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x70, 0xE0,
+    0xE0, 0x70, 0xF1, 0xF0, 0x70, 0xFF, 0xB0, 0xF0, 0x7F, 0xBF, 0xE0, 0x3F, 0x3F, 0xE0, 0x1E, 0x1F,
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00,
+    0x01, 0xFF, 0x00, 0x07, 0xE7, 0x00, 0x0F, 0x87, 0x00, 0x3F, 0x07, 0x00, 0x7C, 0x07, 0x00, 0xF8,
+    0x07, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x23, 0x80, 0x7F, 0xE3, 0xC0, 0xFF, 0xE3, 0xE0, 0xFF, 0xE3, 0xE0,
+    0xFC, 0xE0, 0xF0, 0xE0, 0xC0, 0x70, 0xE1, 0xC0, 0x70, 0xE1, 0xC0, 0x70, 0xE1, 0xE0, 0x70, 0xE1,
+    0xF1, 0xF0, 0xE0, 0xFF, 0xE0, 0xE0, 0xFF, 0xE0, 0xE0, 0x7F, 0xC0, 0x00, 0x1F, 0x00, 0x03, 0xFE,
+    0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7C, 0x7B, 0xE0, 0xF0, 0xE0, 0xF0,
+    0xE0, 0xC0, 0x70, 0xE1, 0xC0, 0x70, 0xE1, 0xC0, 0x70, 0xE1, 0xE0, 0xF0, 0xF9, 0xF1, 0xF0, 0x7C,
+    0xFF, 0xE0, 0x7C, 0xFF, 0xC0, 0x3C, 0x7F, 0xC0, 0x0C, 0x1F, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
+    0x00, 0xE0, 0x00, 0x30, 0xE0, 0x00, 0xF0, 0xE0, 0x03, 0xF0, 0xE0, 0x0F, 0xF0, 0xE0, 0x3F, 0xC0,
+    0xE0, 0xFF, 0x00, 0xE3, 0xFC, 0x00, 0xEF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFC,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x0F, 0x80, 0x3F, 0x1F, 0xC0, 0x7F, 0xBF, 0xE0, 0x7F, 0xBF,
+    0xE0, 0xF1, 0xF0, 0xF0, 0xE0, 0xF0, 0x70, 0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x70,
+    0xF1, 0xF0, 0x70, 0x7F, 0xF0, 0xF0, 0x7F, 0xBF, 0xE0, 0x3F, 0x3F, 0xE0, 0x1E, 0x1F, 0xC0, 0x00,
+    0x0F, 0x00, 0x0F, 0x83, 0x00, 0x3F, 0xE3, 0xC0, 0x3F, 0xF3, 0xE0, 0x7F, 0xF3, 0xE0, 0xF8, 0xF9,
+    0xF0, 0xF0, 0x78, 0xF0, 0xE0, 0x38, 0x70, 0xE0, 0x38, 0x70, 0xE0, 0x30, 0x70, 0xF0, 0x70, 0xF0,
+    0x7D, 0xE3, 0xE0, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x60,
+    0x18, 0xF0, 0x3C, 0xF0, 0x3C, 0x60, 0x18, 0x00, 0x00, 0xE0, 0x60, 0x1F, 0xE0, 0xF0, 0x1F, 0xE0,
+    0xF0, 0x1E, 0x00, 0x60, 0x10, 0x00, 0x03, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xF0, 0x3C, 0x70, 0x38, 0x70, 0x78, 0x38, 0x70, 0x38, 0x70, 0x3C, 0xF0, 0x1C,
+    0xE0, 0x1E, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80,
+    0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE0, 0x1C, 0xF0, 0x1C,
+    0x70, 0x3C, 0x78, 0x38, 0x38, 0x78, 0x38, 0x70, 0x1C, 0x70, 0x1C, 0xE0, 0x0E, 0xE0, 0x0F, 0xC0,
+    0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x03, 0x80, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0xF0, 0x1C, 0x60, 0xE0, 0x7C, 0xF0, 0xE0, 0x7C, 0xF0, 0xE0, 0xF0, 0x60,
+    0xF1, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x1E,
+    0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x78, 0x1F, 0x87, 0x80, 0x70, 0x7F, 0xC3, 0x80, 0x70,
+    0xFF, 0xE3, 0xC0, 0xE1, 0xE0, 0xF1, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0xE1,
+    0xC0, 0x71, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0xE0, 0xE0, 0xE1, 0xC0, 0xE1, 0xFF, 0xC1, 0xC0, 0xF1,
+    0xFF, 0xE3, 0xC0, 0x71, 0xFF, 0xF3, 0x80, 0x70, 0x00, 0x71, 0x80, 0x38, 0x00, 0x70, 0x00, 0x3C,
+    0x00, 0x70, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xF0, 0x01,
+    0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xCE, 0x00, 0xFE, 0x0E, 0x00, 0xF0, 0x0E,
+    0x00, 0xFE, 0x0E, 0x00, 0xFF, 0xCE, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0x3F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x70, 0xE0, 0xE0,
+    0x70, 0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x70, 0xF1, 0xE0, 0x70, 0xFF, 0xF0, 0xF0, 0x7F, 0xBF, 0xE0,
+    0x3F, 0x3F, 0xE0, 0x1E, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x1F,
+    0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7E, 0x07, 0xE0, 0x78, 0x01, 0xE0, 0xF0, 0x00, 0xF0, 0xE0, 0x00,
+    0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xF0, 0x00, 0xF0,
+    0x78, 0x01, 0xE0, 0x7E, 0x07, 0xE0, 0x3E, 0x07, 0xC0, 0x1E, 0x07, 0x80, 0x06, 0x06, 0x00, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x00, 0x70, 0xE0, 0x00,
+    0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xF0, 0x00, 0xF0,
+    0x78, 0x01, 0xE0, 0x7E, 0x07, 0xE0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x03,
+    0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x70,
+    0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70,
+    0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70,
+    0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7E, 0x07, 0xE0, 0x78,
+    0x01, 0xE0, 0xF0, 0x00, 0xF0, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x70,
+    0x70, 0xF0, 0x70, 0x70, 0xF0, 0x70, 0xF0, 0x7C, 0x73, 0xE0, 0x7C, 0x7F, 0xE0, 0x3C, 0x7F, 0xC0,
+    0x1C, 0x7F, 0x80, 0x04, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0,
+    0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0x3F, 0x00, 0x3E, 0x1F, 0xC0, 0x7C, 0x07, 0xE0,
+    0xF8, 0x03, 0xF0, 0xF0, 0x00, 0xF0, 0xC0, 0x00, 0x70, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
+    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFE, 0x00,
+    0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF0, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF,
+    0x80, 0x3F, 0xFF, 0xC0, 0x7E, 0x07, 0xE0, 0x78, 0x01, 0xE0, 0xF0, 0x00, 0xF0, 0xE0, 0x00, 0x70,
+    0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xF0, 0x00, 0xF0, 0x78,
+    0x01, 0xE0, 0x7E, 0x07, 0xE0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x03, 0xFC,
+    0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x38, 0x00,
+    0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xF0, 0x78, 0x00, 0xF8,
+    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFC,
+    0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7E, 0x07, 0xE0, 0x78, 0x01, 0xE0,
+    0xF0, 0x00, 0xF0, 0xE0, 0x00, 0x70, 0xE0, 0x04, 0x70, 0xE0, 0x06, 0x70, 0xE0, 0x07, 0x70, 0xE0,
+    0x07, 0xF0, 0xF0, 0x03, 0xF0, 0x78, 0x01, 0xF0, 0x7E, 0x07, 0xF8, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF,
+    0x9C, 0x0F, 0xFF, 0x0C, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xF0, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0,
+    0x3E, 0x00, 0xF0, 0x3F, 0x00, 0xF8, 0x7F, 0xC0, 0x7F, 0xF7, 0xF0, 0x7F, 0xF1, 0xF0, 0x3F, 0xE0,
+    0xF0, 0x0F, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1F, 0x03, 0x80, 0x3F, 0x83, 0xC0,
+    0x7F, 0xC3, 0xE0, 0x7F, 0xC1, 0xE0, 0xF1, 0xE0, 0xF0, 0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x70, 0xE0,
+    0xF0, 0x70, 0xE0, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0xF8, 0x78, 0xF0, 0x7C, 0x7F, 0xE0, 0x7C, 0x3F,
+    0xE0, 0x3C, 0x1F, 0xC0, 0x0C, 0x0F, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
+    0x07, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xFE,
+    0x00, 0x7F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x03,
+    0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xE0, 0x0F, 0xFF,
+    0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x00,
+    0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x07,
+    0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x30, 0xE0, 0x00, 0xF0, 0xF8, 0x01, 0xF0, 0xFE, 0x07, 0xF0,
+    0x3F, 0x0F, 0xC0, 0x1F, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x07,
+    0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0x0F, 0xC0, 0xFE, 0x07, 0xF0, 0xF8, 0x01, 0xF0, 0xF0, 0x00,
+    0xF0, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+    0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x70,
+    0xE0, 0x00, 0xF0, 0xE0, 0x03, 0xF0, 0xE0, 0x07, 0xF0, 0xE0, 0x1F, 0xF0, 0xE0, 0x3F, 0x70, 0xE0,
+    0x7C, 0x70, 0xE1, 0xF8, 0x70, 0xE3, 0xE0, 0x70, 0xEF, 0xC0, 0x70, 0xFF, 0x80, 0x70, 0xFE, 0x00,
+    0x70, 0xFC, 0x00, 0x70, 0xF0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x00, 0x03, 0x80, 0xE0, 0x00,
+    0x03, 0x80, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
+    0x80, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x80, 0x07, 0x80,
+    0x1F, 0x80, 0x7E, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0x80,
+    0x01, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+    0xC0, 0xE0, 0xF0, 0x30, 0x00, 0x00, 0x78, 0x30, 0xFC, 0x71, 0xFE, 0x79, 0xFE, 0xF1, 0x9E, 0xE3,
+    0x8E, 0xE3, 0x0E, 0xE3, 0x0C, 0xF3, 0x18, 0xFF, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x1F, 0xFE, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x01, 0xC1, 0xC0, 0x03, 0x00,
+    0x60, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0xC1, 0xF0, 0x07, 0xFF, 0xE0,
+    0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F,
+    0xFC, 0xF8, 0x3E, 0xF0, 0x1E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xF0, 0x1E, 0x78, 0x3C, 0x78,
+    0x3C, 0x38, 0x38, 0x18, 0x30, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF,
+    0xF0, 0x07, 0xC1, 0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x03, 0x00, 0x60,
+    0x01, 0xC1, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x0F,
+    0xE0, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F, 0xFC, 0xF3, 0xBE, 0xE3, 0x9E, 0xE3, 0x8E, 0xE3, 0x8E, 0xE3,
+    0x8E, 0xFB, 0x8E, 0x7F, 0x9C, 0x7F, 0x9C, 0x1F, 0x98, 0x0F, 0x90, 0x03, 0x80, 0x00, 0x03, 0x80,
+    0x00, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xE3, 0x80, 0x00,
+    0xE3, 0x80, 0x00, 0xE3, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF8, 0x60, 0x7F, 0xFC, 0x70, 0x7F,
+    0xFE, 0xF0, 0xF8, 0x3E, 0x78, 0xF0, 0x0E, 0x38, 0xE0, 0x0E, 0x38, 0xE0, 0x0E, 0x38, 0x60, 0x0C,
+    0x38, 0x38, 0x38, 0x78, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x01, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF,
+    0xF0, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x63, 0xFF, 0xF8, 0xF3, 0xFF, 0xF8,
+    0xF3, 0xFF, 0xF8, 0x63, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x67, 0xFF,
+    0xFF, 0xC0, 0xF7, 0xFF, 0xFF, 0xC0, 0xF7, 0xFF, 0xFF, 0x80, 0x67, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xEF, 0xC0, 0x07, 0xC3, 0xE0, 0x07, 0x81, 0xF0, 0x07,
+    0x00, 0xF0, 0x04, 0x00, 0x30, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x30, 0x00, 0x60, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0x7F, 0xFE, 0x1F, 0xFE, 0x70, 0x00,
+    0x60, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0x7F, 0xFE, 0x3F, 0xFE,
+    0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x30, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xF0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0x7F, 0xFE, 0x1F, 0xFE, 0x0F, 0xE0, 0x1F, 0xF0, 0x3F, 0xF8,
+    0x7F, 0xFC, 0xF8, 0x3E, 0xF0, 0x1E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xF0, 0x1E, 0xF8, 0x3C,
+    0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF0, 0x0F, 0xC0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xF8, 0x38, 0x38, 0x00, 0x60, 0x0C, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
+    0xE0, 0x0E, 0x00, 0xF8, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
+    0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0xF8, 0x3E,
+    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x60, 0x0C, 0x00, 0x38, 0x38, 0x00,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFE, 0xFF, 0xFE,
+    0xFF, 0xFE, 0xFF, 0xFE, 0x30, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x3C, 0x38,
+    0x7E, 0x3C, 0x7F, 0x3C, 0xFF, 0x3E, 0xF3, 0x0E, 0xE3, 0x0E, 0xE3, 0x8E, 0xE3, 0x8E, 0xF1, 0x9E,
+    0x79, 0xFE, 0x79, 0xFC, 0x30, 0xF8, 0x00, 0x70, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+    0x0E, 0x00, 0x60, 0xFF, 0xF0, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x1E, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0x0C, 0x00, 0x18, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x80, 0x00, 0xF0,
+    0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFE, 0x00, 0x1E, 0x00, 0xFE, 0x07,
+    0xFE, 0x3F, 0xF0, 0xFF, 0x80, 0xFC, 0x00, 0xF0, 0x00, 0x80, 0x00, 0x80, 0x00, 0xF8, 0x00, 0xFF,
+    0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x01, 0xFE, 0x00, 0x1E, 0x01, 0xFE, 0x1F, 0xFC, 0xFF, 0xC0, 0xFE,
+    0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x3E, 0x01, 0xFE, 0x1F, 0xFE, 0xFF,
+    0xF0, 0xFF, 0x80, 0xF8, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xE0, 0x1E, 0xF8, 0x3E, 0x7E,
+    0xFC, 0x3F, 0xF8, 0x0F, 0xE0, 0x07, 0xC0, 0x1F, 0xF0, 0x7F, 0xF8, 0xFC, 0x7E, 0xF0, 0x1E, 0xE0,
+    0x0E, 0x80, 0x02, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x08, 0xFE, 0x00, 0x38, 0xFF, 0xC0, 0x38, 0x3F,
+    0xF8, 0x38, 0x07, 0xFE, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFE,
+    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xE0, 0x0E, 0xE0, 0x1E, 0xE0, 0x3E, 0xE0, 0xFE, 0xE1, 0xFE, 0xE3, 0xEE, 0xEF, 0xCE, 0xFF, 0x0E,
+    0xFE, 0x0E, 0xFC, 0x0E, 0xF0, 0x0E, 0xE0, 0x0E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xF7, 0xFF, 0x00, 0x7F, 0xF7, 0xFF, 0x00,
+    0xFF, 0xE3, 0xFF, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xE0, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xE0, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xFF, 0xE3, 0xFF, 0x80,
+    0x7F, 0xF7, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x38, 0x78, 0xF8, 0xF0, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x1C, 0x3C, 0x7C,
+    0x78, 0x70, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+    0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF,
+    0xCE, 0x00, 0x00, 0xFE, 0x0E, 0x00, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0xFE, 0x0E, 0x00, 0x00, 0xFF,
+    0xCE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0x80, 0x00,
+    0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x79, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0xC0,
+    0xE0, 0xF0, 0x30, 0x30, 0x30, 0xF0, 0xE0, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0xC0, 0x70, 0x00, 0xC0, 0x70,
+    0x01, 0x80, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x70, 0x67, 0xF3, 0x00, 0xFF, 0xFF, 0x00, 0x7C, 0x1E, 0x00, 0x78, 0x0F,
+    0x00, 0x70, 0x07, 0x00, 0xE0, 0x07, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80,
+    0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x00, 0x78, 0x0F, 0x00, 0x7C, 0x1E, 0x00, 0xFF,
+    0xFF, 0x00, 0xE7, 0xE3, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0xF8, 0x00, 0x38, 0xF8, 0x00, 0x38,
+    0xC0, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x7C, 0x0E, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x01, 0xFF, 0x0F, 0x80, 0x01, 0xFF, 0x07, 0x80,
+    0x03, 0xC7, 0x83, 0xC0, 0x03, 0x83, 0x81, 0xC0, 0x13, 0x83, 0x81, 0xC0, 0xF3, 0x83, 0xC1, 0xC0,
+    0xF3, 0x83, 0xC1, 0xC0, 0xC3, 0xC1, 0xC3, 0xC0, 0x83, 0xE1, 0xE3, 0xC0, 0x01, 0xF1, 0xFF, 0x80,
+    0x01, 0xF0, 0xFF, 0x80, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x30, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x1E,
+    0x7E, 0x18, 0x7F, 0xFE, 0x1E, 0x7F, 0xCF, 0x1E, 0xF3, 0x87, 0x0F, 0xE3, 0xC7, 0x87, 0xE1, 0xC3,
+    0x87, 0xF1, 0xE3, 0xC7, 0xF8, 0xE1, 0xFF, 0x78, 0xF3, 0xFE, 0x78, 0x7F, 0xFE, 0x18, 0x3E, 0x7C,
+    0x00, 0x1E, 0x00, 0x40, 0xE0, 0xE0, 0x40, 0x00, 0x00, 0x40, 0xE0, 0xE0, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x0E, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x01, 0xFF, 0x0F, 0x80, 0xC1, 0xFF, 0x07,
+    0x80, 0xE3, 0xC7, 0x83, 0xC0, 0xF3, 0x83, 0x81, 0xC0, 0x33, 0x83, 0x81, 0xC0, 0x33, 0x83, 0xC1,
+    0xC0, 0x73, 0x83, 0xC1, 0xC0, 0xE3, 0x81, 0xC3, 0xC0, 0xC3, 0xC1, 0xE3, 0xC0, 0x81, 0xE1, 0xFF,
+    0x80, 0x01, 0xE0, 0xFF, 0x80, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x20, 0x3C, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x1F, 0x03, 0x80, 0x00, 0x3F, 0x83, 0xC0, 0x00, 0x7F, 0xC3, 0xE0, 0x00, 0x7F, 0xC1, 0xE0,
+    0x00, 0xF1, 0xE0, 0xF0, 0x00, 0xE0, 0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x7C, 0x80, 0xE0, 0xF0, 0x7C,
+    0x80, 0xE0, 0xF0, 0x77, 0x80, 0xF0, 0x70, 0xF7, 0x00, 0xF8, 0x78, 0xF0, 0x00, 0x7C, 0x7F, 0xE0,
+    0x00, 0x7C, 0x3F, 0xE0, 0x00, 0x3C, 0x1F, 0xC0, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x83, 0x80, 0x00, 0x00, 0xC3, 0x80, 0x00,
+    0x00, 0xE3, 0x80, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0xC0, 0x3B, 0xFF, 0xFF, 0xC0, 0x3B, 0xFF, 0xFF,
+    0xC0, 0x7B, 0xFF, 0xFF, 0xC0, 0xE3, 0x80, 0x00, 0x00, 0xC3, 0x80, 0x00, 0x00, 0x83, 0x80, 0x00,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x01,
+    0xC0, 0x03, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x0F, 0xC0, 0x03, 0x80, 0x1F, 0xC0, 0x03, 0x80, 0x7F,
+    0xC0, 0x03, 0x80, 0xFD, 0xC0, 0x13, 0x81, 0xF1, 0xC0, 0x73, 0x87, 0xE1, 0xC0, 0xF3, 0x8F, 0x81,
+    0xC0, 0xE3, 0xBF, 0x01, 0xC0, 0x83, 0xFE, 0x01, 0xC0, 0x03, 0xF8, 0x01, 0xC0, 0x03, 0xF0, 0x01,
+    0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x01, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0x03, 0x80, 0x01, 0xC0, 0x03, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x0F, 0xC0, 0x83, 0x80,
+    0x1F, 0xC0, 0xE3, 0x80, 0x7F, 0xC0, 0xF3, 0x80, 0xFD, 0xC0, 0x7B, 0x81, 0xF1, 0xC0, 0x1B, 0x87,
+    0xE1, 0xC0, 0x7B, 0x8F, 0x81, 0xC0, 0xF3, 0xBF, 0x01, 0xC0, 0xE3, 0xFE, 0x01, 0xC0, 0xC3, 0xF8,
+    0x01, 0xC0, 0x03, 0xF0, 0x01, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x01, 0xC0, 0x03, 0x80,
+    0x01, 0xC0, 0x03, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x0F, 0xC0, 0x03, 0x80, 0x1F, 0xC0, 0x03, 0x80,
+    0x7F, 0xC0, 0x63, 0x80, 0xF9, 0xC0, 0xF3, 0x83, 0xF1, 0xC0, 0xF3, 0x87, 0xE1, 0xC0, 0x63, 0x9F,
+    0x81, 0xC0, 0x03, 0xBF, 0x01, 0xC0, 0x03, 0xFC, 0x01, 0xC0, 0x03, 0xF8, 0x01, 0xC0, 0x03, 0xF0,
+    0x01, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x01, 0xC0, 0x1E, 0x00, 0x7F, 0x80, 0x7F, 0x80,
+    0xF3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x7F, 0x80, 0x1E, 0x00, 0x00, 0x78,
+    0x00, 0x30, 0xFC, 0x00, 0x71, 0xFE, 0x00, 0x79, 0xFE, 0x00, 0xF1, 0x9E, 0x00, 0xE3, 0x8E, 0x00,
+    0xE3, 0x0E, 0x00, 0xE3, 0x0C, 0x00, 0xF3, 0x19, 0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0x38, 0x1F, 0xFE, 0x38, 0x38, 0xFE, 0xFE, 0xCE, 0x8E, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0xC0, 0x00, 0x01,
+    0x80, 0x00, 0x10, 0x70, 0xF0, 0xE0, 0x80, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF0, 0xE0, 0x01, 0xF8, 0xF0, 0x01, 0xFC, 0xF0, 0x03, 0xFC, 0xF8, 0x03, 0xCC, 0x38, 0x13, 0x8C,
+    0x38, 0x73, 0x8E, 0x38, 0xF3, 0x8E, 0x38, 0xE3, 0xC6, 0x78, 0x81, 0xE7, 0xF8, 0x01, 0xE7, 0xF0,
+    0x00, 0xC3, 0xE0, 0x00, 0x01, 0xC0, 0xC0, 0xE0, 0xF0, 0x78, 0x18, 0x38, 0x78, 0xE0, 0xC0, 0x80,
+    0x04, 0xC4, 0xE4, 0x78, 0x38, 0x00, 0xF0, 0xE0, 0x01, 0xF8, 0xF0, 0x81, 0xFC, 0xF0, 0xC3, 0xFC,
+    0xF8, 0xE3, 0xCC, 0x38, 0x73, 0x8C, 0x38, 0x33, 0x8E, 0x38, 0x73, 0x8E, 0x38, 0xE3, 0xC6, 0x78,
+    0xC1, 0xE7, 0xF8, 0x81, 0xE7, 0xF0, 0x00, 0xC3, 0xE0, 0x00, 0x01, 0xC0, 0x3C, 0x38, 0x00, 0x7E,
+    0x3C, 0x00, 0x7F, 0x3C, 0x00, 0xFF, 0x3E, 0x00, 0xF3, 0x0E, 0x00, 0xE3, 0x0F, 0x90, 0xE3, 0x8F,
+    0x90, 0xE3, 0x8E, 0xE0, 0xF1, 0x9E, 0xE0, 0x79, 0xFE, 0x00, 0x71, 0xFC, 0x00, 0x30, 0xF8, 0x00,
+    0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x01, 0xC0, 0x1C, 0xF9, 0xC0, 0x1C, 0xF9, 0xC0, 0x0C, 0xF8, 0x00,
+    0x00, 0x03, 0x80, 0x38, 0x03, 0x80, 0x78, 0x03, 0x80, 0xF8, 0x03, 0x83, 0xF8, 0x03, 0x87, 0xF8,
+    0x33, 0x8F, 0xB8, 0xF3, 0xBF, 0x38, 0xF3, 0xFC, 0x38, 0xC3, 0xF8, 0x38, 0x83, 0xF0, 0x38, 0x03,
+    0xC0, 0x38, 0x03, 0x80, 0x38, 0x00, 0x30, 0x70, 0xE0, 0xC0, 0x90, 0x30, 0x70, 0xE0, 0xC0, 0x80,
+    0x03, 0x80, 0x38, 0x83, 0x80, 0x78, 0xC3, 0x80, 0xF8, 0xE3, 0x83, 0xF8, 0x73, 0x87, 0xF8, 0x3B,
+    0x8F, 0xB8, 0x3B, 0xBF, 0x38, 0x73, 0xFC, 0x38, 0xE3, 0xF8, 0x38, 0xC3, 0xF0, 0x38, 0x83, 0xC0,
+    0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x78, 0x03, 0x80, 0xF8, 0x03, 0x83, 0xF8,
+    0x63, 0x87, 0xF8, 0xF3, 0x8F, 0xB8, 0xF3, 0xBF, 0x38, 0x63, 0xFC, 0x38, 0x03, 0xF8, 0x38, 0x03,
+    0xF0, 0x38, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0,
+    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0x80, 0xE0, 0x00, 0x03, 0x80, 0xE0, 0x00,
+    0x33, 0x80, 0xE0, 0x00, 0xF3, 0x80, 0xE0, 0x00, 0xF3, 0x80, 0xF8, 0x00, 0xC3, 0xC0, 0xFC, 0x00,
+    0x83, 0xE1, 0xFF, 0x00, 0x01, 0xFF, 0xDF, 0xC0, 0x01, 0xFF, 0xC7, 0xC0, 0x00, 0xFF, 0x83, 0xC0,
+    0x00, 0x3E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x38, 0x00, 0x13, 0xF8, 0x38, 0x00, 0x73, 0xC0, 0x38, 0x00,
+    0xF3, 0xF8, 0x38, 0x00, 0xE3, 0xFF, 0x38, 0x00, 0xC0, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
+    0x00, 0x00, 0xFF, 0xC0, 0x08, 0x07, 0xFF, 0x00, 0x18, 0x1F, 0xF8, 0x00, 0x38, 0xFF, 0xF8, 0x00,
+    0x73, 0xFF, 0x38, 0x00, 0xE3, 0xF8, 0x38, 0x00, 0xC3, 0xC0, 0x38, 0x00, 0xE3, 0xF8, 0x38, 0x00,
+    0x73, 0xFF, 0x38, 0x00, 0x38, 0xFF, 0xF8, 0x00, 0x18, 0x1F, 0xF8, 0x00, 0x08, 0x07, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
+    0x00, 0x03, 0xFF, 0x00, 0xE0, 0x0F, 0xF8, 0x00, 0xF0, 0x7F, 0xF8, 0x00, 0xFB, 0xFF, 0x38, 0x00,
+    0x3B, 0xF8, 0x38, 0x00, 0x1B, 0xC0, 0x38, 0x00, 0x3B, 0xF8, 0x38, 0x00, 0xFB, 0xFF, 0x38, 0x00,
+    0xF0, 0x7F, 0xF8, 0x00, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0,
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x40, 0x0F, 0xFE, 0x00,
+    0xE0, 0x7F, 0xF0, 0x00, 0xE3, 0xFF, 0xF0, 0x00, 0x47, 0xFC, 0x70, 0x00, 0x07, 0xE0, 0x70, 0x00,
+    0x07, 0xC0, 0x70, 0x00, 0x47, 0xF8, 0x70, 0x00, 0xE3, 0xFE, 0x70, 0x00, 0xE0, 0xFF, 0xF0, 0x00,
+    0x40, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x33, 0xFF, 0xFF, 0xC0,
+    0xF3, 0xFF, 0xFF, 0xC0, 0xF3, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x01, 0xC0, 0x80, 0x00, 0x01, 0xC0,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xF8, 0x1F, 0x80,
+    0x01, 0xE0, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x01, 0xC0, 0x13, 0x80, 0x01, 0xC0,
+    0x73, 0x80, 0x01, 0xC0, 0xF3, 0x80, 0x01, 0xC0, 0xE3, 0x80, 0x01, 0xC0, 0x83, 0xC0, 0x03, 0xC0,
+    0x01, 0xE0, 0x07, 0x80, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x78, 0x1E, 0x00,
+    0x00, 0x18, 0x18, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+    0x3F, 0xFF, 0xC0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x78, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xE0, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x7C, 0x40, 0xE0, 0x00, 0x7C, 0xC0, 0xE0, 0x00, 0x77, 0x80,
+    0xE0, 0x00, 0x77, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x7C, 0x01, 0xE0, 0x00, 0x3E, 0x07, 0xC0, 0x00,
+    0x3E, 0x07, 0x80, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xF8, 0x1F, 0x80,
+    0x81, 0xE0, 0x07, 0x80, 0xC3, 0xC0, 0x03, 0xC0, 0xF3, 0x80, 0x01, 0xC0, 0x73, 0x80, 0x01, 0xC0,
+    0x33, 0x80, 0x01, 0xC0, 0x73, 0x80, 0x01, 0xC0, 0xF3, 0x80, 0x01, 0xC0, 0xE3, 0xC0, 0x03, 0xC0,
+    0x81, 0xC0, 0x07, 0x80, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x70, 0x1E, 0x00,
+    0x00, 0x30, 0x18, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0,
+    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0x81, 0xC1, 0xC0, 0x03, 0x81, 0xC1, 0xC0, 0x33, 0x81, 0xC1, 0xC0,
+    0xF3, 0x81, 0xC1, 0xC0, 0xE3, 0x81, 0xC1, 0xC0, 0xC3, 0x81, 0xC1, 0xC0, 0x03, 0x81, 0xC1, 0xC0,
+    0x03, 0x81, 0xC1, 0xC0, 0x03, 0x81, 0xC1, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xE0, 0x70, 0x70, 0x00, 0xE0, 0x70, 0x70, 0x00,
+    0xE0, 0x70, 0x70, 0x00, 0xE0, 0x70, 0x70, 0x00, 0xE0, 0x70, 0x77, 0x80, 0xE0, 0x70, 0x7F, 0xC0,
+    0xE0, 0x70, 0x7F, 0xC0, 0xE0, 0x70, 0x79, 0xC0, 0xE0, 0x70, 0x71, 0xC0, 0x07, 0xFF, 0xFF, 0x80,
+    0x07, 0xFF, 0xFF, 0x80, 0x47, 0xFF, 0xFF, 0x80, 0xE7, 0xFF, 0xFF, 0x80, 0xE7, 0x03, 0x83, 0x80,
+    0x47, 0x03, 0x83, 0x80, 0x07, 0x03, 0x83, 0x80, 0x47, 0x03, 0x83, 0x80, 0xE7, 0x03, 0x83, 0x80,
+    0xE7, 0x03, 0x83, 0x80, 0x47, 0x03, 0x83, 0x80, 0x07, 0x03, 0x83, 0x80, 0x07, 0x03, 0x83, 0x80,
+    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x83, 0xFF, 0xFF, 0xC0, 0xC3, 0xFF, 0xFF, 0xC0,
+    0xE3, 0x81, 0xC1, 0xC0, 0x7B, 0x81, 0xC1, 0xC0, 0x3B, 0x81, 0xC1, 0xC0, 0x3B, 0x81, 0xC1, 0xC0,
+    0xF3, 0x81, 0xC1, 0xC0, 0xE3, 0x81, 0xC1, 0xC0, 0xC3, 0x81, 0xC1, 0xC0, 0x83, 0x81, 0xC1, 0xC0,
+    0x03, 0x81, 0xC1, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x33, 0xFF, 0xFF, 0xC0, 0xF3, 0xFF, 0xFF, 0xC0,
+    0xF3, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xC0, 0xE3, 0xFF, 0xFF, 0xC0,
+    0xE3, 0xFF, 0xFF, 0xC0, 0xF3, 0xFF, 0xFF, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x83, 0xFF, 0xFF, 0xC0,
+    0xE3, 0xFF, 0xFF, 0xC0, 0xF3, 0x80, 0x01, 0xC0, 0x7B, 0x80, 0x01, 0xC0, 0x1B, 0x80, 0x01, 0xC0,
+    0x7B, 0x80, 0x01, 0xC0, 0xF3, 0x80, 0x01, 0xC0, 0xC3, 0x80, 0x01, 0xC0, 0x83, 0xC0, 0x03, 0xC0,
+    0x01, 0xE0, 0x07, 0x80, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
+    0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x60, 0x70,
+    0xE0, 0x60, 0x70, 0xE0, 0x60, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xF0,
+    0x00, 0xF0, 0x78, 0x01, 0xE0, 0x7E, 0x07, 0xE0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF,
+    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0,
+    0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
+    0x10, 0x0F, 0x80, 0x00, 0x70, 0x07, 0xE0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0xE0, 0x00, 0xFC, 0x00,
+    0x80, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0,
+    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0,
+    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x81, 0xF8, 0x00, 0x00, 0xE0, 0x7E, 0x00, 0x00,
+    0xF0, 0x3F, 0x00, 0x00, 0x78, 0x0F, 0x80, 0x00, 0x18, 0x07, 0xE0, 0x00, 0x78, 0x01, 0xF0, 0x00,
+    0xF0, 0x00, 0xFC, 0x00, 0xE0, 0x00, 0x7E, 0x00, 0x80, 0x00, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0xC0,
+    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xF8, 0x1F, 0x80,
+    0x01, 0xE0, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x01, 0xC0, 0x13, 0x80, 0x01, 0xC0,
+    0x73, 0x80, 0x01, 0xC0, 0xF3, 0x80, 0x01, 0xC0, 0xE3, 0x80, 0x01, 0xC0, 0x83, 0xC0, 0x03, 0xC0,
+    0x01, 0xE0, 0x07, 0x80, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x11, 0xE0, 0x07, 0x80,
+    0x33, 0xC0, 0x03, 0xC0, 0x73, 0x80, 0x01, 0xC0, 0xE3, 0x80, 0x01, 0xC0, 0xC3, 0x80, 0x01, 0xC0,
+    0xE3, 0x80, 0x01, 0xC0, 0x73, 0x80, 0x01, 0xC0, 0x33, 0xC0, 0x03, 0xC0, 0x11, 0xE0, 0x07, 0x80,
+    0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x01, 0xE0, 0x07, 0x80, 0x33, 0xC0, 0x03, 0xC0,
+    0x73, 0x80, 0x01, 0xC0, 0xE3, 0x80, 0x01, 0xC0, 0xC3, 0x80, 0x01, 0xC0, 0x83, 0x80, 0x01, 0xC0,
+    0x33, 0x80, 0x01, 0xC0, 0x73, 0xC0, 0x03, 0xC0, 0xE1, 0xE0, 0x07, 0x80, 0xC1, 0xF8, 0x1F, 0x80,
+    0x80, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+    0x43, 0xF0, 0x3F, 0x00, 0xE3, 0xC0, 0x0F, 0x00, 0xE7, 0x80, 0x07, 0x80, 0x47, 0x00, 0x03, 0x80,
+    0x07, 0x00, 0x03, 0x80, 0x07, 0x00, 0x03, 0x80, 0x47, 0x00, 0x03, 0x80, 0xE7, 0x00, 0x03, 0x80,
+    0xE7, 0x80, 0x07, 0x80, 0x43, 0xC0, 0x0F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x20, 0x10, 0x70, 0x38,
+    0x78, 0x7C, 0x3C, 0xF8, 0x1F, 0xF0, 0x0F, 0xE0, 0x07, 0xC0, 0x0F, 0xC0, 0x1F, 0xE0, 0x3E, 0xF0,
+    0x7C, 0x78, 0x78, 0x3C, 0x30, 0x18, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0,
+    0x83, 0xFF, 0xFF, 0xC0, 0xC3, 0xFF, 0xFF, 0xC0, 0xE3, 0x80, 0xE0, 0x00, 0xF3, 0x80, 0xE0, 0x00,
+    0x3B, 0x80, 0xE0, 0x00, 0x3B, 0x80, 0xE0, 0x00, 0x73, 0x80, 0xF8, 0x00, 0xE3, 0xC0, 0xFC, 0x00,
+    0xC3, 0xE1, 0xFF, 0x00, 0x81, 0xFF, 0xDF, 0xC0, 0x01, 0xFF, 0xC7, 0xC0, 0x00, 0xFF, 0x83, 0xC0,
+    0x00, 0x3E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,
+    0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x70, 0x00, 0x01, 0xE0,
+    0xF8, 0x00, 0x00, 0xE0, 0x88, 0x00, 0x00, 0xE0, 0x88, 0x00, 0x00, 0xE0, 0xF8, 0x00, 0x00, 0xE0,
+    0x70, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80,
+    0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x00,
+    0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x01, 0xC0, 0x30, 0x00, 0x01, 0xC0, 0xF0, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0xC0,
+    0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00,
+    0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x00,
+    0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x80, 0x30, 0x00, 0x03, 0xC0,
+    0xF0, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0xC0, 0x80, 0x00, 0x01, 0xC0, 0x10, 0x00, 0x01, 0xC0,
+    0x70, 0x00, 0x03, 0xC0, 0xE0, 0x00, 0x07, 0x80, 0xC3, 0xFF, 0xFF, 0x80, 0x83, 0xFF, 0xFF, 0x00,
+    0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x00,
+    0x03, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xFF, 0x80, 0xE0, 0x00, 0x07, 0x80, 0xE0, 0x00, 0x03, 0xC0,
+    0x40, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x40, 0x00, 0x01, 0xC0,
+    0xE0, 0x00, 0x03, 0xC0, 0xE0, 0x00, 0x07, 0x80, 0x43, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00,
+    0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+    0x03, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x30, 0x03, 0xFF, 0xC0, 0xF0, 0x03, 0xFF, 0xC0,
+    0xF0, 0x0F, 0xFF, 0xC0, 0xC0, 0x1F, 0xC0, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+    0x03, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x40, 0xFF, 0xFF, 0xFC, 0x40,
+    0xFF, 0xFF, 0xFE, 0xC0, 0xFF, 0xFF, 0xF7, 0x80, 0xE0, 0x00, 0x03, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0xE0,
+    0x00, 0x00, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xF0, 0xF0, 0x70, 0x7F, 0xF0, 0x70, 0x7F, 0xF8,
+    0xF0, 0x3F, 0xBF, 0xF0, 0x1F, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0x80, 0x03, 0xFF, 0xF8,
+    0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x13, 0xFF, 0xF8, 0x70, 0xC0, 0x00, 0xF1, 0x80, 0x00, 0xE3,
+    0x80, 0x00, 0x83, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xC3, 0xF0, 0x01, 0xC7,
+    0xF8, 0x01, 0xE7, 0xF8, 0x03, 0xC6, 0x78, 0x03, 0x8E, 0x38, 0x33, 0x8C, 0x38, 0xF3, 0x8C, 0x30,
+    0xE3, 0xCC, 0x60, 0xC3, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00,
+    0x01, 0xE0, 0x00, 0xC3, 0xF0, 0x01, 0xC7, 0xF8, 0x31, 0xE7, 0xF8, 0x73, 0xC6, 0x78, 0xF3, 0x8E,
+    0x38, 0xC3, 0x8C, 0x38, 0xC3, 0x8C, 0x30, 0xF3, 0xCC, 0x60, 0x73, 0xFF, 0xF8, 0x31, 0xFF, 0xF8,
+    0x11, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0xC3, 0xF0, 0xC1, 0xC7, 0xF8, 0xE1,
+    0xE7, 0xF8, 0xF3, 0xC6, 0x78, 0x33, 0x8E, 0x38, 0x33, 0x8C, 0x38, 0x33, 0x8C, 0x30, 0x33, 0xCC,
+    0x60, 0xF3, 0xFF, 0xF8, 0xE1, 0xFF, 0xF8, 0xC1, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xE0,
+    0x00, 0xC3, 0xF0, 0x41, 0xC7, 0xF8, 0xE1, 0xE7, 0xF8, 0xE3, 0xC6, 0x78, 0x43, 0x8E, 0x38, 0x03,
+    0x8C, 0x38, 0x03, 0x8C, 0x30, 0x43, 0xCC, 0x60, 0xE3, 0xFF, 0xF8, 0xE1, 0xFF, 0xF8, 0x41, 0xFF,
+    0xF8, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x33, 0xFF, 0xFF, 0xC0, 0xF3, 0xFF, 0xFF, 0xC0,
+    0xF3, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x03, 0xE0, 0xF8, 0x03, 0xC0, 0x78, 0x13, 0x80,
+    0x38, 0x73, 0x80, 0x38, 0xF3, 0x80, 0x38, 0xE3, 0xC0, 0x78, 0x81, 0xE0, 0xF0, 0x01, 0xE0, 0xF0,
+    0x00, 0xE0, 0xE0, 0x00, 0x60, 0xC0, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x7F,
+    0xFC, 0x00, 0xF8, 0x3E, 0x00, 0xF0, 0x1E, 0x00, 0xE0, 0x0F, 0x90, 0xE0, 0x0F, 0x90, 0xE0, 0x0E,
+    0xE0, 0xF0, 0x1E, 0xE0, 0x78, 0x3C, 0x00, 0x78, 0x3C, 0x00, 0x38, 0x38, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x81, 0xFF, 0xF0, 0xE3, 0xE0, 0xF8, 0xF3, 0xC0, 0x78, 0x73,
+    0x80, 0x38, 0x33, 0x80, 0x38, 0x73, 0x80, 0x38, 0xF3, 0x80, 0x78, 0xE1, 0xE0, 0xF0, 0xC1, 0xE0,
+    0xF0, 0x00, 0xE0, 0xE0, 0x00, 0x60, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0,
+    0x01, 0xFF, 0xF0, 0x03, 0xCE, 0xF8, 0x03, 0x8E, 0x78, 0x33, 0x8E, 0x38, 0xF3, 0x8E, 0x38, 0xE3,
+    0x8E, 0x38, 0xC3, 0xEE, 0x38, 0x01, 0xFE, 0x70, 0x01, 0xFE, 0x70, 0x00, 0x7E, 0x60, 0x00, 0x3E,
+    0x40, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0xF3, 0xBE, 0x00,
+    0xE3, 0x9F, 0xE0, 0xE3, 0x8F, 0xF0, 0xE3, 0x8F, 0xF0, 0xE3, 0x8E, 0x70, 0xFB, 0x8E, 0x70, 0x7F,
+    0x9C, 0x00, 0x7F, 0x9C, 0x00, 0x1F, 0x98, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+    0xC0, 0x40, 0xFF, 0xE0, 0xE1, 0xFF, 0xF0, 0xE3, 0xCE, 0xF8, 0x43, 0x8E, 0x78, 0x03, 0x8E, 0x38,
+    0x03, 0x8E, 0x38, 0x43, 0x8E, 0x38, 0xE3, 0xEE, 0x38, 0xE1, 0xFE, 0x70, 0x41, 0xFE, 0x70, 0x00,
+    0x7E, 0x60, 0x00, 0x3E, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x81, 0xFF,
+    0xF0, 0xE3, 0xCE, 0xF8, 0xF3, 0x8E, 0x78, 0x33, 0x8E, 0x38, 0x33, 0x8E, 0x38, 0xF3, 0x8E, 0x38,
+    0xE3, 0xEE, 0x38, 0xC1, 0xFE, 0x70, 0x01, 0xFE, 0x70, 0x00, 0x7E, 0x60, 0x00, 0x3E, 0x40, 0x03,
+    0xFF, 0xF8, 0x33, 0xFF, 0xF8, 0xF3, 0xFF, 0xF8, 0xF3, 0xFF, 0xF8, 0xC0, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF3, 0xFF, 0xF8, 0xE3, 0xFF, 0xF8,
+    0xE3, 0xFF, 0xF8, 0xF3, 0xFF, 0xF8, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x03, 0xE0, 0xF8, 0x03, 0x80,
+    0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x01, 0x80, 0x30, 0x00, 0xE0, 0xE0, 0x7F, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF,
+    0xE0, 0x03, 0xFF, 0xF0, 0x07, 0xC1, 0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x37, 0x00, 0x70,
+    0x33, 0x00, 0x60, 0x31, 0xC1, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x03, 0xFF,
+    0xF8, 0x03, 0xFF, 0xF8, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x73, 0x80, 0x00, 0xF3, 0x80, 0x00,
+    0xC3, 0xC0, 0x00, 0x83, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x03,
+    0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x83, 0xFF, 0xF8, 0xC3, 0xFF, 0xF8, 0xE0, 0xC0, 0x00, 0x71, 0x80,
+    0x00, 0x33, 0x80, 0x00, 0x73, 0x80, 0x00, 0xE3, 0xC0, 0x00, 0xC3, 0xFF, 0xF8, 0x83, 0xFF, 0xF8,
+    0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x01,
+    0xFF, 0xF0, 0x03, 0xE0, 0xF8, 0x03, 0xC0, 0x78, 0x13, 0x80, 0x38, 0x73, 0x80, 0x38, 0xF3, 0x80,
+    0x38, 0xE3, 0xC0, 0x78, 0x83, 0xE0, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xC0,
+    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x11, 0xFF, 0xF0, 0x33,
+    0xE0, 0xF8, 0x73, 0xC0, 0x78, 0xE3, 0x80, 0x38, 0xC3, 0x80, 0x38, 0xE3, 0x80, 0x38, 0x73, 0xC0,
+    0x78, 0x33, 0xE0, 0xF0, 0x11, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x33, 0xE0, 0xF8, 0x73,
+    0xC0, 0x78, 0xE3, 0x80, 0x38, 0xC3, 0x80, 0x38, 0x83, 0x80, 0x38, 0x33, 0xC0, 0x78, 0x73, 0xE0,
+    0xF0, 0xE1, 0xFF, 0xF0, 0xC0, 0xFF, 0xE0, 0x80, 0x7F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x7F, 0xC0, 0x40, 0xFF, 0xE0, 0xE1, 0xFF, 0xF0, 0xE3, 0xE0, 0xF8, 0x43, 0xC0, 0x78, 0x03,
+    0x80, 0x38, 0x03, 0x80, 0x38, 0x43, 0x80, 0x38, 0xE3, 0xC0, 0x78, 0xE3, 0xE0, 0xF0, 0x41, 0xFF,
+    0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x63, 0x8C, 0xF3, 0x9E, 0xF3, 0x9E, 0x63, 0x8C, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xF8, 0xE3, 0xFF, 0xF8, 0xF3, 0xFF, 0xF8,
+    0x7B, 0xFF, 0xF8, 0x38, 0xC0, 0x00, 0x79, 0x80, 0x00, 0xF3, 0x80, 0x00, 0xC3, 0x80, 0x00, 0x83,
+    0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x78, 0xFF, 0xFE, 0x78, 0x00,
+    0x1E, 0xCC, 0x00, 0x0E, 0x84, 0x00, 0x0E, 0xCC, 0x00, 0x0C, 0x7C, 0x00, 0x18, 0x78, 0xFF, 0xFE,
+    0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x03,
+    0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x70, 0x00, 0x38, 0xF0, 0x00,
+    0x30, 0xC0, 0x00, 0x60, 0x83, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8,
+    0x07, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x17, 0xFF, 0xF0, 0x70, 0x00, 0xF0, 0xF0,
+    0x00, 0x70, 0xC0, 0x00, 0x70, 0x90, 0x00, 0x60, 0x30, 0x00, 0xC0, 0xF7, 0xFF, 0xF0, 0xE7, 0xFF,
+    0xF0, 0xC7, 0xFF, 0xF0, 0x87, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x47, 0xFF, 0xF0,
+    0xE7, 0xFF, 0xF0, 0xE0, 0x00, 0xF0, 0x40, 0x00, 0x70, 0x00, 0x00, 0x70, 0x40, 0x00, 0x60, 0xE0,
+    0x00, 0xC0, 0xE7, 0xFF, 0xF0, 0x47, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x04, 0x00,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x40, 0x07, 0xF0, 0x01, 0xC0, 0x07, 0xFE, 0x01, 0xC0, 0x01, 0xFF,
+    0xC1, 0xC0, 0x00, 0x3F, 0xF7, 0xC0, 0x10, 0x03, 0xFF, 0x80, 0x70, 0x00, 0xFF, 0x00, 0xF0, 0x07,
+    0xFE, 0x00, 0xE0, 0x3F, 0xF0, 0x00, 0x81, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xE0,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+    0xF8, 0x80, 0x0E, 0x01, 0xF8, 0x80, 0x0E, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x60, 0xF0,
+    0xF0, 0x60,
+};
+static const uint32_t InterTight_SemiBold14pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 13, 22, 73, 137, 194, 245, 248, 269, 290, 310,
+    338, 343, 352, 356, 386, 434, 461, 503, 548, 596, 638, 683,
+    725, 770, 815, 823, 838, 866, 892, 920, 959, 1059, 1116, 1161,
+    1215, 1266, 1305, 1344, 1398, 1449, 1461, 1500, 1551, 1590, 1653, 1704,
+    1761, 1806, 1863, 1911, 1959, 2007, 2055, 2112, 2193, 2247, 2301, 2346,
+    2370, 2400, 2428, 2450, 2463, 2469, 2495, 2537, 2565, 2607, 2635, 2662,
+    2704, 2746, 2758, 2782, 2824, 2836, 2880, 2906, 2936, 2978, 3020, 3038,
+    3064, 3091, 3117, 3147, 3191, 3219, 3264, 3288, 3324, 3344, 3380, 3394,
+    3394, 3395, 3471, 3480, 3525, 3573, 3612, 3676, 3715, 3725, 3789, 3853,
+    3917, 3977, 3986, 4046, 4106, 4126, 4165, 4170, 4194, 4199, 4223, 4262,
+    4272, 4277, 4316, 4355, 4385, 4421, 4432, 4468, 4504, 4568, 4644, 4720,
+    4796, 4872, 4924, 4996, 5068, 5140, 5192, 5244, 5296, 5348, 5372, 5412,
+    5480, 5540, 5608, 5676, 5752, 5828, 5904, 5980, 6008, 6072, 6136, 6200,
+    6264, 6328, 6400, 6464, 6509, 6536, 6575, 6614, 6653, 6692, 6716, 6758,
+    6797, 6839, 6881, 6923, 6965, 7007, 7025, 7055, 7112, 7160, 7199, 7238,
+    7283, 7328, 7373, 7418, 7444, 7474, 7513, 7552, 7591, 7630, 7690, 7726,
+};
+
+// InterTightBold16pt8bfr.h
+static const uint8_t InterTight_Bold16pt8b_Atlas[] PROGMEM = {
+    0x00, 0xFF, 0xFF, 0x0E, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0E,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xC0, 0x01, 0xC3, 0xC0, 0x03, 0xC3, 0xC7, 0x03,
+    0xC3, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF3, 0xC0, 0xFF, 0xC3,
+    0xC0, 0x03, 0xC3, 0xC0, 0x03, 0xC3, 0xC7, 0x03, 0xC3, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xF3, 0xC0, 0xFF, 0xC3, 0xC0, 0x03, 0xC3, 0xC0, 0x03, 0xC0, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF8, 0x1E, 0x00, 0x03, 0xFC, 0x1F, 0x80, 0x07, 0xFE,
+    0x1F, 0x80, 0x0F, 0xFF, 0x1F, 0xC0, 0x0F, 0xFF, 0x07, 0xC0, 0x1F, 0x1F, 0x03, 0xE0, 0x1E, 0x0F,
+    0x81, 0xE0, 0x1E, 0x0F, 0x81, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0x07,
+    0xC1, 0xE0, 0x1F, 0x07, 0xC3, 0xE0, 0x1F, 0x87, 0xE3, 0xE0, 0x0F, 0xC3, 0xFF, 0xC0, 0x0F, 0xC3,
+    0xFF, 0xC0, 0x07, 0xC1, 0xFF, 0x80, 0x03, 0xC0, 0xFF, 0x00, 0x00, 0xC0, 0x7E, 0x00, 0x1F, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0x80, 0xF1, 0xE0, 0x03, 0x80, 0xE0, 0xE0,
+    0x0F, 0x80, 0xE0, 0xE0, 0x1E, 0x00, 0xF1, 0xE0, 0x7C, 0x00, 0x7F, 0xE0, 0xF0, 0x00, 0x7F, 0xC3,
+    0xE0, 0x00, 0x1F, 0x07, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8,
+    0xFC, 0x00, 0x01, 0xE3, 0xFF, 0x00, 0x07, 0xC3, 0xFF, 0x00, 0x0F, 0x07, 0x87, 0x80, 0x3E, 0x07,
+    0x03, 0x80, 0x78, 0x07, 0x03, 0x80, 0x70, 0x07, 0x87, 0x80, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x03,
+    0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0x87, 0xFC, 0x3F,
+    0xEF, 0xFE, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0x1F, 0xF8, 0xFE, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0xFF,
+    0x0F, 0xF9, 0xFF, 0xCF, 0xFF, 0xE7, 0xEF, 0x7F, 0xE3, 0xFE, 0x3F, 0xC1, 0xFE, 0x1F, 0x00, 0xFE,
+    0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xE7, 0x00, 0x07, 0x83, 0x00,
+    0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
+    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0,
+    0x0F, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0xFC, 0x00, 0x00, 0xF8, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
+    0xF0, 0x00, 0x08, 0x80, 0x38, 0xE0, 0x1D, 0xC0, 0x1D, 0xC0, 0x0F, 0x80, 0xFF, 0xF8, 0xFF, 0xF8,
+    0xFF, 0xF8, 0x0F, 0x80, 0x1D, 0xC0, 0x1D, 0xC0, 0x38, 0xE0, 0x08, 0x80, 0x03, 0xC0, 0x00, 0x03,
+    0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00,
+    0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x7F, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFE, 0x00, 0xE0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x70, 0xF8, 0xF8, 0xF8, 0x70, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x01, 0xF8, 0x00,
+    0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFE, 0x7F, 0x00, 0xFE, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7F, 0x00, 0xFE, 0x7F, 0xFF, 0xFE,
+    0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x0F,
+    0x1F, 0x00, 0x1F, 0x3F, 0x00, 0x3F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xF0,
+    0x03, 0xFF, 0xF0, 0x07, 0xEF, 0xF0, 0x0F, 0xCF, 0xF0, 0x1F, 0x8F, 0xF8, 0x7F, 0x0F, 0x7F, 0xFE,
+    0x0F, 0x7F, 0xFC, 0x0F, 0x3F, 0xF8, 0x0F, 0x1F, 0xF0, 0x0F, 0x0F, 0xC0, 0x0F, 0x0E, 0x00, 0x70,
+    0x1E, 0x00, 0x78, 0x3E, 0x00, 0x7C, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0x7E, 0xF8, 0x00, 0x1F, 0xF8,
+    0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x7E, 0x0F, 0xF8, 0x7E,
+    0x1F, 0x7F, 0xFF, 0xFE, 0x7F, 0xEF, 0xFE, 0x3F, 0xE7, 0xFC, 0x1F, 0xC7, 0xF8, 0x0F, 0x81, 0xF0,
+    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x01,
+    0xFE, 0xF0, 0x07, 0xF8, 0xF0, 0x1F, 0xE0, 0xF0, 0x3F, 0x80, 0xF0, 0xFF, 0x00, 0xF0, 0xFC, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x70, 0x7F, 0xF8, 0x78, 0xFF,
+    0xF8, 0x7C, 0xFF, 0xF8, 0x7E, 0xFF, 0xF8, 0x7E, 0xFE, 0x38, 0x1F, 0xF0, 0x70, 0x0F, 0xF0, 0xF0,
+    0x0F, 0xF0, 0xF0, 0x0F, 0xF0, 0xF0, 0x0F, 0xF0, 0xF8, 0x1F, 0xF0, 0xFC, 0x3F, 0xF0, 0xFF, 0xFE,
+    0xF0, 0x7F, 0xFE, 0xF0, 0x3F, 0xFC, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0x80, 0x07,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7F, 0x1E, 0xFE, 0xF8, 0x38,
+    0x1F, 0xF8, 0x70, 0x0F, 0xF0, 0xF0, 0x0F, 0xF0, 0xF0, 0x0F, 0xF0, 0xF0, 0x0F, 0xF8, 0xF8, 0x1F,
+    0xFC, 0xFC, 0x3F, 0x7E, 0xFF, 0xFE, 0x7E, 0x7F, 0xFE, 0x3E, 0x3F, 0xFC, 0x1E, 0x1F, 0xF8, 0x06,
+    0x07, 0xE0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0x3F, 0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x1F, 0xFC, 0xF0, 0x7F, 0xF0, 0xF1, 0xFF, 0xC0,
+    0xF7, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x83, 0xF8, 0x1F, 0xC7, 0xFC, 0x3F, 0xEF, 0xFE, 0x7F, 0xFF,
+    0xFE, 0x7F, 0xFF, 0x1F, 0xF8, 0x7E, 0x1F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F,
+    0xF0, 0x3C, 0x0F, 0xF8, 0x7E, 0x1F, 0x7F, 0xFF, 0x1F, 0x7F, 0xFF, 0xFE, 0x3F, 0xEF, 0xFE, 0x1F,
+    0xC7, 0xFC, 0x0F, 0x83, 0xF8, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x60, 0x1F, 0xF8, 0x78, 0x3F, 0xFC,
+    0x7C, 0x7F, 0xFE, 0x7E, 0x7F, 0xFF, 0x7E, 0xFC, 0x3F, 0x3F, 0xF8, 0x1F, 0x1F, 0xF0, 0x0F, 0x0F,
+    0xF0, 0x0F, 0x0F, 0xF0, 0x0F, 0x0F, 0xF0, 0x0E, 0x1F, 0xF8, 0x1C, 0x1F, 0x7F, 0xF8, 0xFE, 0x7F,
+    0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x70, 0x07,
+    0x00, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0x70, 0x07, 0x00, 0x00, 0x00, 0x1E,
+    0x70, 0x07, 0xFE, 0xF8, 0x07, 0xFE, 0xF8, 0x07, 0xF8, 0xF8, 0x07, 0x80, 0x70, 0x04, 0x00, 0x01,
+    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xBC,
+    0x00, 0x07, 0xBC, 0x00, 0x0F, 0x9E, 0x00, 0x0F, 0x1E, 0x00, 0x1F, 0x1F, 0x00, 0x1E, 0x0F, 0x00,
+    0x3E, 0x0F, 0x80, 0x3C, 0x07, 0x80, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x78, 0x03, 0xE0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x03, 0xE0,
+    0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x3C, 0x07, 0x80, 0x3E, 0x0F, 0x80, 0x1E, 0x0F, 0x00, 0x1F,
+    0x1F, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x9E, 0x00, 0x07, 0xBC, 0x00, 0x07, 0xBC, 0x00, 0x07, 0xFC,
+    0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x0E, 0x00, 0x00,
+    0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFE, 0x00, 0x0E, 0xF8, 0x07, 0x9F, 0xF0,
+    0x1F, 0x9F, 0xF0, 0x3F, 0x9F, 0xF0, 0x7F, 0x8E, 0xF8, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xF0,
+    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0x80,
+    0x03, 0xF0, 0x3F, 0x00, 0x00, 0xF8, 0x3C, 0x0F, 0xE0, 0x7C, 0x7C, 0x3F, 0xF8, 0x7C, 0x78, 0x7F,
+    0xFC, 0x3C, 0x78, 0xFF, 0xFE, 0x3E, 0xF1, 0xF8, 0x3F, 0x1E, 0xF1, 0xF0, 0x1F, 0x1E, 0xF1, 0xE0,
+    0x0F, 0x1E, 0xF1, 0xE0, 0x0F, 0x1E, 0xF1, 0xE0, 0x0F, 0x1E, 0xF1, 0xE0, 0x0E, 0x1E, 0xF0, 0xF8,
+    0x3E, 0x1E, 0xF9, 0xFF, 0xF8, 0x1E, 0x79, 0xFF, 0xFE, 0x3E, 0x79, 0xFF, 0xFF, 0x3C, 0x7D, 0xFF,
+    0xFF, 0x3C, 0x3E, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x0F, 0xFF,
+    0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFE,
+    0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0xFF, 0xFD, 0xE0, 0xFF, 0xC1, 0xE0, 0xFE, 0x01, 0xE0, 0xFE,
+    0x01, 0xE0, 0xFF, 0xC1, 0xE0, 0xFF, 0xF9, 0xE0, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x01, 0xFF,
+    0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C,
+    0x0F, 0xF8, 0x7E, 0x0F, 0xFF, 0xFF, 0x1F, 0x7F, 0xEF, 0xFE, 0x7F, 0xEF, 0xFE, 0x3F, 0xC7, 0xFC,
+    0x0F, 0x87, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0x00, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+    0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F,
+    0x78, 0x00, 0x1E, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x1F, 0x00, 0xF8, 0x07,
+    0x00, 0xE0, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0x00, 0xFE, 0x3F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3C, 0x0F,
+    0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0,
+    0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x00,
+    0xF0, 0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xF0,
+    0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF,
+    0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0x00, 0xFE, 0x7C, 0x00, 0x3E,
+    0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x1E, 0x0F, 0xF0,
+    0x1E, 0x0F, 0xF8, 0x1E, 0x1F, 0x7C, 0x1E, 0x1E, 0x7F, 0x1E, 0x7E, 0x7F, 0x1F, 0xFE, 0x3F, 0x1F,
+    0xFC, 0x1F, 0x1F, 0xF8, 0x0F, 0x1F, 0xF0, 0x03, 0x1F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x80,
+    0x0F, 0xFF, 0xE0, 0x1F, 0xCF, 0xF8, 0x7F, 0x87, 0xFC, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xF8,
+    0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
+    0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x1F, 0xFE,
+    0x00, 0x7F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0x00,
+    0xFE, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x7F,
+    0x00, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF8,
+    0x1F, 0x00, 0xFC, 0x3F, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF8,
+    0x00, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x7C, 0x00, 0x3E, 0x00,
+    0x78, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x8F, 0x00,
+    0xF0, 0x00, 0xEF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0x7E, 0x00,
+    0x7C, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFB, 0xC0,
+    0x0F, 0xFF, 0xF1, 0xC0, 0x07, 0xFF, 0xE0, 0xC0, 0x00, 0xFF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+    0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xC0, 0xF8, 0x1F, 0xF0, 0xFC, 0x3F, 0xFC,
+    0x7F, 0xFF, 0xFF, 0x7F, 0xFE, 0xFF, 0x3F, 0xFC, 0x3F, 0x1F, 0xF8, 0x0F, 0x07, 0xE0, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x80, 0x07, 0xC0, 0xF0, 0x1F, 0xE0, 0xFC, 0x3F, 0xF0, 0xFC, 0x7F, 0xF8,
+    0xFE, 0x7F, 0xF8, 0x3E, 0xF8, 0xF8, 0x1F, 0xF0, 0x7C, 0x0F, 0xF0, 0x7C, 0x0F, 0xF0, 0x7C, 0x0F,
+    0xF0, 0x3C, 0x0F, 0xF0, 0x3E, 0x0F, 0xF8, 0x3E, 0x1F, 0xFC, 0x3F, 0x1F, 0x7E, 0x1F, 0xFE, 0x7E,
+    0x1F, 0xFE, 0x3E, 0x0F, 0xFC, 0x1E, 0x07, 0xF8, 0x06, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x3F, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0xC0,
+    0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+    0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF,
+    0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x01,
+    0xFF, 0x7F, 0xC3, 0xFE, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
+    0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0xE7, 0xFC, 0xFF, 0x81, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x01, 0xC0, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00,
+    0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
+    0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80,
+    0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xF0,
+    0x0F, 0xFF, 0xF0, 0x3F, 0xCF, 0xF0, 0x7F, 0x8F, 0xF1, 0xFE, 0x0F, 0xF3, 0xFC, 0x0F, 0xFF, 0xF0,
+    0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
+    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0,
+    0x00, 0x00, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x38, 0xF0,
+    0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x60, 0x01, 0xE0, 0x07, 0xE0, 0x1F, 0xE0, 0xFF, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xFF,
+    0x00, 0x1F, 0xE0, 0x07, 0xE0, 0x01, 0xE0, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80, 0xE0, 0xF8, 0xF8, 0x78, 0x18, 0x00, 0x1E,
+    0x00, 0x1C, 0x7F, 0x80, 0x3C, 0x7F, 0x80, 0x7C, 0xFF, 0xC0, 0x7C, 0xFF, 0xC0, 0xF8, 0xE7, 0xC0,
+    0xF0, 0xC3, 0xC0, 0xF0, 0xC3, 0xC0, 0xF0, 0xC3, 0x80, 0xF1, 0xC3, 0x80, 0xF9, 0xC6, 0x00, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x3C,
+    0x01, 0xE0, 0x1E, 0x01, 0xC0, 0x0E, 0x03, 0xC0, 0x0F, 0x03, 0xC0, 0x0F, 0x03, 0xE0, 0x1F, 0x03,
+    0xF0, 0x3F, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x1F,
+    0xE0, 0x03, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+    0xFC, 0x0F, 0xC0, 0xF8, 0x07, 0xC0, 0xF0, 0x03, 0xC0, 0xF0, 0x03, 0xC0, 0xF0, 0x03, 0xC0, 0xF8,
+    0x07, 0xC0, 0xFC, 0x0F, 0xC0, 0x7E, 0x1F, 0x80, 0x3E, 0x1F, 0x80, 0x1E, 0x1E, 0x00, 0x0E, 0x1C,
+    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
+    0x03, 0xF0, 0x3F, 0x03, 0xE0, 0x1F, 0x03, 0xC0, 0x0F, 0x03, 0xC0, 0x0F, 0x01, 0xC0, 0x0E, 0x01,
+    0xE0, 0x1E, 0x00, 0xF0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x80,
+    0x7F, 0xFF, 0x80, 0xFD, 0xCF, 0xC0, 0xF9, 0xC7, 0xC0, 0xF1, 0xC3, 0xC0, 0xF1, 0xC3, 0xC0, 0xF1,
+    0xC3, 0xC0, 0xF9, 0xC3, 0xC0, 0xFD, 0xC7, 0xC0, 0x7F, 0xCF, 0x80, 0x7F, 0xCF, 0x80, 0x3F, 0xCF,
+    0x00, 0x1F, 0xCE, 0x00, 0x07, 0xC8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01,
+    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xF1, 0xE0, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x00, 0xF1,
+    0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x0C, 0x00, 0x3F,
+    0xFF, 0x0E, 0x00, 0x7F, 0xFF, 0x9F, 0x00, 0x7F, 0xFF, 0xDF, 0x00, 0xFC, 0x0F, 0xCF, 0x80, 0xF8,
+    0x07, 0xC7, 0x80, 0xF0, 0x03, 0xC7, 0x80, 0xF0, 0x03, 0xC7, 0x80, 0x70, 0x03, 0x87, 0x80, 0x78,
+    0x07, 0x87, 0x80, 0x3C, 0x0F, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00,
+    0x01, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x71, 0xFF, 0xFF, 0x80, 0xF9,
+    0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0xFF, 0x80, 0x71, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x71, 0xFF, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xFC, 0x71, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+    0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xFC, 0x03, 0xF9, 0xFE,
+    0x03, 0xF0, 0xFF, 0x03, 0xE0, 0x3F, 0x03, 0x80, 0x1F, 0x03, 0x00, 0x07, 0x02, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
+    0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x38, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x18, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x1F,
+    0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0xFC, 0x0F, 0xC0, 0xF8, 0x07,
+    0xC0, 0xF0, 0x03, 0xC0, 0xF0, 0x03, 0xC0, 0xF0, 0x03, 0xC0, 0xF8, 0x07, 0xC0, 0xFC, 0x0F, 0xC0,
+    0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0x80, 0x1C, 0x0F, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x70, 0x03, 0x80, 0x00, 0xF0,
+    0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07,
+    0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF0,
+    0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x70, 0x03, 0x80, 0x00, 0x78, 0x07, 0x80, 0x00, 0x1C,
+    0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x0E, 0x00, 0x3F, 0x8F, 0x00, 0x7F, 0x8F,
+    0x80, 0x7F, 0xCF, 0x80, 0xFF, 0xCF, 0xC0, 0xF9, 0xC3, 0xC0, 0xF1, 0xC3, 0xC0, 0xF1, 0xE3, 0xC0,
+    0xF0, 0xE3, 0xC0, 0xF8, 0xE7, 0xC0, 0xFC, 0xFF, 0xC0, 0x7C, 0xFF, 0x80, 0x3C, 0x7F, 0x80, 0x1C,
+    0x7F, 0x00, 0x04, 0x3E, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x07, 0x80, 0x1E,
+    0x07, 0x80, 0x1E, 0x07, 0x80, 0x1E, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x0F,
+    0xC0, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00,
+    0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
+    0xC0, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
+    0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0xF0, 0x03, 0xC0,
+    0xFC, 0x0F, 0xC0, 0xFE, 0x1F, 0xC0, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03,
+    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0x3F, 0xC0, 0xFC, 0x0F,
+    0xC0, 0xF0, 0x03, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0x80, 0xFE, 0x00, 0x07, 0x80, 0xFF, 0xE0, 0x07, 0x80, 0xFF, 0xFC, 0x07, 0x80, 0x3F, 0xFF,
+    0x8F, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF0,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x03,
+    0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x0F, 0xC0, 0xF0, 0x3F, 0xC0, 0xF0, 0x7F, 0xC0, 0xF0, 0xFF, 0xC0,
+    0xF3, 0xFB, 0xC0, 0xF7, 0xF3, 0xC0, 0xFF, 0xE3, 0xC0, 0xFF, 0x83, 0xC0, 0xFF, 0x03, 0xC0, 0xFE,
+    0x03, 0xC0, 0xF8, 0x03, 0xC0, 0xF0, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0xFF, 0xF8,
+    0x7F, 0xFE, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F, 0xFC, 0xF8, 0x00, 0x00, 0x7C, 0xF0, 0x00, 0x00, 0x3C,
+    0xF0, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00,
+    0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF8, 0x00, 0x00, 0x7C, 0xFF, 0xF8, 0x7F,
+    0xFC, 0x7F, 0xFE, 0xFF, 0xF8, 0x7F, 0xFE, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x7E, 0x7E,
+    0xFE, 0xF8, 0xF0, 0xF0, 0x78, 0x7C, 0x3C, 0x1E, 0x1E, 0x3E, 0xFE, 0xFC, 0xFC, 0xF0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFD, 0xE0, 0x00, 0xFF, 0xC1, 0xE0, 0x00, 0xFE, 0x01, 0xE0, 0x00, 0xFE, 0x01, 0xE0, 0x00, 0xFF,
+    0xC1, 0xE0, 0x00, 0xFF, 0xF9, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01,
+    0xFF, 0xFE, 0x78, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0x00, 0x1F, 0x8E, 0x00, 0x00, 0x07, 0x8E, 0x00, 0x00, 0x00, 0x04, 0xC0, 0xF0, 0xF0, 0x38, 0x18,
+    0x18, 0x18, 0x38, 0xF0, 0xF0, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x70,
+    0x0F, 0x00, 0x70, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x30,
+    0xFC, 0x30, 0x7B, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0x3F, 0x03, 0xE0, 0x3C, 0x00, 0xF0, 0x38, 0x00,
+    0x70, 0x78, 0x00, 0x78, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38,
+    0x70, 0x00, 0x38, 0x78, 0x00, 0x78, 0x3C, 0x00, 0x70, 0x3E, 0x01, 0xF0, 0x3F, 0x03, 0xE0, 0x7F,
+    0xFF, 0xF0, 0x7B, 0xFF, 0x78, 0x30, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0xFC, 0x00, 0x07, 0x80, 0xFC,
+    0x00, 0x07, 0x80, 0xFC, 0x00, 0x07, 0x80, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x81, 0xE0, 0x00,
+    0x3F, 0xC1, 0xF8, 0x00, 0x7F, 0xE1, 0xF8, 0x00, 0xFF, 0xF1, 0xFC, 0x00, 0xFF, 0xF0, 0x7C, 0x01,
+    0xF1, 0xF0, 0x3E, 0x01, 0xE0, 0xF8, 0x1E, 0x19, 0xE0, 0xF8, 0x1E, 0x79, 0xE0, 0xF8, 0x1E, 0xF9,
+    0xE0, 0x78, 0x1E, 0xF9, 0xE0, 0x7C, 0x1E, 0xE1, 0xF0, 0x7C, 0x3E, 0xC1, 0xF8, 0x7E, 0x3E, 0x00,
+    0xFC, 0x3F, 0xFC, 0x00, 0xFC, 0x3F, 0xFC, 0x00, 0x7C, 0x1F, 0xF8, 0x00, 0x3C, 0x0F, 0xF0, 0x00,
+    0x0C, 0x07, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x81, 0x80, 0x3F, 0xFF, 0xC1, 0xE0, 0x7F,
+    0xFF, 0xE1, 0xF0, 0x7F, 0xF3, 0xE1, 0xF0, 0xF9, 0xF1, 0xF0, 0xF8, 0xF0, 0xF1, 0xF0, 0x78, 0xF0,
+    0xF8, 0xF8, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0xF8, 0x7C, 0x7C, 0xF8, 0xFC, 0x7C, 0x7F, 0xF8, 0x7C,
+    0x3F, 0xFF, 0xF0, 0x7C, 0x3F, 0xFF, 0xF0, 0x3C, 0x1F, 0xFF, 0xE0, 0x0C, 0x0F, 0xC7, 0xC0, 0x00,
+    0x07, 0x80, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0x60, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x0F, 0x81, 0xE0, 0x00, 0x3F, 0xC1, 0xF8, 0x00, 0x7F, 0xE1, 0xF8, 0xC0,
+    0xFF, 0xF1, 0xFC, 0xE0, 0xFF, 0xF0, 0x7C, 0xF1, 0xF1, 0xF0, 0x3E, 0xF9, 0xE0, 0xF8, 0x1E, 0x79,
+    0xE0, 0xF8, 0x1E, 0x19, 0xE0, 0xF8, 0x1E, 0x39, 0xE0, 0x78, 0x1E, 0x79, 0xE0, 0x7C, 0x1E, 0xF1,
+    0xF0, 0x7C, 0x3E, 0xE1, 0xF8, 0x7E, 0x3E, 0xC0, 0xFC, 0x3F, 0xFC, 0x80, 0xFC, 0x3F, 0xFC, 0x00,
+    0x7C, 0x1F, 0xF8, 0x00, 0x3C, 0x0F, 0xF0, 0x00, 0x0C, 0x07, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x07,
+    0xC0, 0xF0, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x3F, 0xF0, 0xFC, 0x00, 0x7F, 0xF8, 0xFE, 0x00, 0x7F,
+    0xF8, 0x3E, 0x00, 0xF8, 0xF8, 0x1F, 0x00, 0xF0, 0x7C, 0x0F, 0x06, 0xF0, 0x7C, 0x0F, 0xC6, 0xF0,
+    0x7C, 0x0F, 0xEE, 0xF0, 0x3C, 0x0F, 0x7E, 0xF0, 0x3E, 0x0F, 0x7C, 0xF8, 0x3E, 0x1F, 0x38, 0xFC,
+    0x3F, 0x1F, 0x00, 0x7E, 0x1F, 0xFE, 0x00, 0x7E, 0x1F, 0xFE, 0x00, 0x3E, 0x0F, 0xFC, 0x00, 0x1E,
+    0x07, 0xF8, 0x00, 0x06, 0x03, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01,
+    0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xC1, 0xE0, 0x00, 0x00, 0xE1, 0xE0, 0x00, 0x00, 0xF1,
+    0xE0, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFE, 0x39, 0xFF, 0xFF, 0xFE, 0x19, 0xFF, 0xFF, 0xFE, 0x39,
+    0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xFE, 0xF1, 0xE0, 0x00, 0x00, 0xE1, 0xE0, 0x00, 0x00, 0xC1,
+    0xE0, 0x00, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01,
+    0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xE0, 0x00, 0xFE, 0x01,
+    0xE0, 0x01, 0xFE, 0x01, 0xE0, 0x03, 0xFE, 0x01, 0xE0, 0x0F, 0xFE, 0x01, 0xE0, 0x1F, 0xFE, 0x09,
+    0xE0, 0x7F, 0x9E, 0x39, 0xE0, 0xFF, 0x1E, 0xF9, 0xE3, 0xFC, 0x1E, 0xF9, 0xE7, 0xF8, 0x1E, 0xF1,
+    0xFF, 0xE0, 0x1E, 0xC1, 0xFF, 0xC0, 0x1E, 0x81, 0xFF, 0x00, 0x1E, 0x01, 0xFE, 0x00, 0x1E, 0x01,
+    0xFC, 0x00, 0x1E, 0x01, 0xF0, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x1E, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x01, 0xE0, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xE0, 0x00,
+    0xFE, 0x81, 0xE0, 0x01, 0xFE, 0xC1, 0xE0, 0x03, 0xFE, 0xE1, 0xE0, 0x0F, 0xFE, 0xF1, 0xE0, 0x1F,
+    0xFE, 0x79, 0xE0, 0x7F, 0x9E, 0x39, 0xE0, 0xFF, 0x1E, 0x39, 0xE3, 0xFC, 0x1E, 0x79, 0xE7, 0xF8,
+    0x1E, 0xF1, 0xFF, 0xE0, 0x1E, 0xE1, 0xFF, 0xC0, 0x1E, 0xC1, 0xFF, 0x00, 0x1E, 0x81, 0xFE, 0x00,
+    0x1E, 0x01, 0xFC, 0x00, 0x1E, 0x01, 0xF0, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x1E, 0x01, 0xE0, 0x00,
+    0x1E, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xE0, 0x00, 0xFE, 0x01, 0xE0, 0x01, 0xFE, 0x01, 0xE0, 0x07,
+    0xFE, 0x01, 0xE0, 0x0F, 0xFE, 0x71, 0xE0, 0x3F, 0xDE, 0xF9, 0xE0, 0x7F, 0x9E, 0xF9, 0xE1, 0xFE,
+    0x1E, 0xF9, 0xE7, 0xFC, 0x1E, 0x71, 0xEF, 0xF0, 0x1E, 0x01, 0xFF, 0xE0, 0x1E, 0x01, 0xFF, 0xC0,
+    0x1E, 0x01, 0xFF, 0x00, 0x1E, 0x01, 0xFE, 0x00, 0x1E, 0x01, 0xF8, 0x00, 0x1E, 0x01, 0xF0, 0x00,
+    0x1E, 0x01, 0xE0, 0x00, 0x1E, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0xF9, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF9, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x00, 0x1E, 0x00, 0x1C, 0x7F,
+    0x80, 0x3C, 0x7F, 0x80, 0x7C, 0xFF, 0xC0, 0x7C, 0xFF, 0xC0, 0xF8, 0xE7, 0xC0, 0xF0, 0xC3, 0xC0,
+    0xF0, 0xC3, 0xC0, 0xF0, 0xC3, 0x80, 0xF1, 0xC3, 0x80, 0xF9, 0xC6, 0x3E, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xE7, 0x0F, 0xFF, 0xC7, 0x18, 0x7E, 0xFF, 0xFF, 0x67,
+    0x47, 0x02, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x18, 0xF8,
+    0xF8, 0xF0, 0xC0, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80,
+    0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1C, 0x00,
+    0x00, 0x7F, 0x1E, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x9F, 0x00, 0x01, 0xFF, 0x9F, 0x80,
+    0x01, 0xF3, 0x87, 0x80, 0x19, 0xE3, 0x87, 0x80, 0x79, 0xE3, 0xC7, 0x80, 0xF9, 0xE1, 0xC7, 0x80,
+    0xF1, 0xF1, 0xCF, 0x80, 0xC1, 0xF9, 0xFF, 0x80, 0x80, 0xF9, 0xFF, 0x00, 0x00, 0x78, 0xFF, 0x00,
+    0x00, 0x38, 0xFE, 0x00, 0x00, 0x08, 0x7C, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0x7C, 0x3C, 0x1C, 0x3C,
+    0x7C, 0xF0, 0xE0, 0xC0, 0x80, 0x03, 0xE3, 0xE7, 0x3E, 0x3E, 0x1C, 0x00, 0x1E, 0x0E, 0x00, 0x80,
+    0x3F, 0x8F, 0x00, 0xC0, 0x7F, 0x8F, 0x80, 0xE0, 0x7F, 0xCF, 0x80, 0xF8, 0xFF, 0xCF, 0xC0, 0x7C,
+    0xF9, 0xC3, 0xC0, 0x3C, 0xF1, 0xC3, 0xC0, 0x1C, 0xF1, 0xE3, 0xC0, 0x3C, 0xF0, 0xE3, 0xC0, 0xFC,
+    0xF8, 0xE7, 0xC0, 0xF0, 0xFC, 0xFF, 0xC0, 0xE0, 0x7C, 0xFF, 0x80, 0xC0, 0x3C, 0x7F, 0x80, 0x80,
+    0x1C, 0x7F, 0x00, 0x00, 0x04, 0x3E, 0x00, 0x1E, 0x0E, 0x00, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x7F,
+    0x8F, 0x80, 0x00, 0x7F, 0xCF, 0x80, 0x00, 0xFF, 0xCF, 0xC0, 0x00, 0xF9, 0xC3, 0xC1, 0x80, 0xF1,
+    0xC3, 0xF1, 0x80, 0xF1, 0xE3, 0xF3, 0x80, 0xF0, 0xE3, 0xDF, 0x00, 0xF8, 0xE7, 0xDF, 0x00, 0xFC,
+    0xFF, 0xCE, 0x00, 0x7C, 0xFF, 0x80, 0x00, 0x3C, 0x7F, 0x80, 0x00, 0x1C, 0x7F, 0x00, 0x00, 0x04,
+    0x3E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0xFC, 0xF0, 0x03, 0xC0, 0xFC, 0xF0, 0x03, 0xC0, 0xFC,
+    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x07, 0x80, 0x01, 0xE0, 0x0F, 0x80, 0x01,
+    0xE0, 0x1F, 0x80, 0x01, 0xE0, 0x7F, 0x80, 0x01, 0xE0, 0xFF, 0x80, 0x09, 0xE1, 0xFF, 0x80, 0x39,
+    0xE7, 0xF7, 0x80, 0xF9, 0xEF, 0xE7, 0x80, 0xF9, 0xFF, 0xC7, 0x80, 0xF1, 0xFF, 0x07, 0x80, 0xC1,
+    0xFE, 0x07, 0x80, 0x01, 0xFC, 0x07, 0x80, 0x01, 0xF0, 0x07, 0x80, 0x01, 0xE0, 0x07, 0x80, 0x00,
+    0x18, 0x78, 0xF8, 0xF0, 0xE0, 0x88, 0x18, 0x38, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0x01, 0xE0, 0x07,
+    0x80, 0x81, 0xE0, 0x0F, 0x80, 0xC1, 0xE0, 0x1F, 0x80, 0xE1, 0xE0, 0x7F, 0x80, 0xF1, 0xE0, 0xFF,
+    0x80, 0x79, 0xE1, 0xFF, 0x80, 0x39, 0xE7, 0xF7, 0x80, 0x39, 0xEF, 0xE7, 0x80, 0x79, 0xFF, 0xC7,
+    0x80, 0xF1, 0xFF, 0x07, 0x80, 0xE1, 0xFE, 0x07, 0x80, 0xC1, 0xFC, 0x07, 0x80, 0x81, 0xF0, 0x07,
+    0x80, 0x01, 0xE0, 0x07, 0x80, 0x01, 0xE0, 0x07, 0x80, 0x01, 0xE0, 0x0F, 0x80, 0x01, 0xE0, 0x1F,
+    0x80, 0x01, 0xE0, 0x3F, 0x80, 0x01, 0xE0, 0xFF, 0x80, 0x71, 0xE1, 0xFF, 0x80, 0xF9, 0xE3, 0xFF,
+    0x80, 0xF9, 0xE7, 0xF7, 0x80, 0xF9, 0xFF, 0xC7, 0x80, 0x71, 0xFF, 0x87, 0x80, 0x01, 0xFE, 0x07,
+    0x80, 0x01, 0xFC, 0x07, 0x80, 0x01, 0xF0, 0x07, 0x80, 0x01, 0xE0, 0x07, 0x80, 0x01, 0xFF, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+    0xFE, 0x01, 0xE0, 0x1E, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x19, 0xE0, 0x1E, 0x00, 0xF9, 0xE0, 0x1E,
+    0x00, 0xF9, 0xE0, 0x1F, 0x80, 0xF1, 0xF0, 0x3F, 0xE0, 0xC1, 0xF8, 0x7F, 0xF8, 0x00, 0xFF, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFD, 0xFE, 0x00, 0x7F, 0xF8, 0x7E, 0x00, 0x3F, 0xF0, 0x1E, 0x00, 0x0F, 0xC0,
+    0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFB, 0xC0, 0x09, 0xFF, 0x83, 0xC0, 0x39, 0xFC, 0x03,
+    0xC0, 0xF9, 0xFC, 0x03, 0xC0, 0xF9, 0xFF, 0x83, 0xC0, 0xE1, 0xFF, 0xF3, 0xC0, 0xC0, 0xFF, 0xFF,
+    0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07,
+    0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F,
+    0xFE, 0x08, 0x01, 0xFF, 0xFC, 0x18, 0x1F, 0xFF, 0xE0, 0x38, 0xFF, 0xFF, 0xC0, 0x79, 0xFF, 0xFB,
+    0xC0, 0xF1, 0xFF, 0x83, 0xC0, 0xE1, 0xFC, 0x03, 0xC0, 0xE1, 0xFC, 0x03, 0xC0, 0xF1, 0xFF, 0x83,
+    0xC0, 0x79, 0xFF, 0xF3, 0xC0, 0x38, 0xFF, 0xFF, 0xC0, 0x18, 0x1F, 0xFF, 0xE0, 0x08, 0x03, 0xFF,
+    0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xE0, 0x0F, 0xFF,
+    0xF0, 0xF0, 0x7F, 0xFF, 0xC0, 0xF1, 0xFF, 0xFF, 0xC0, 0x39, 0xFF, 0xE3, 0xC0, 0x19, 0xFF, 0x03,
+    0xC0, 0x19, 0xF8, 0x03, 0xC0, 0x19, 0xFF, 0x03, 0xC0, 0x39, 0xFF, 0xE3, 0xC0, 0xF1, 0xFF, 0xFF,
+    0xC0, 0xF0, 0x7F, 0xFF, 0xC0, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
+    0xFC, 0x60, 0x07, 0xFF, 0xF0, 0xF0, 0x3F, 0xFF, 0x80, 0xF1, 0xFF, 0xFF, 0x80, 0xF3, 0xFF, 0xE7,
+    0x80, 0x63, 0xFF, 0x07, 0x80, 0x03, 0xF8, 0x07, 0x80, 0x03, 0xF8, 0x07, 0x80, 0x63, 0xFF, 0x07,
+    0x80, 0xF3, 0xFF, 0xE7, 0x80, 0xF1, 0xFF, 0xFF, 0x80, 0xF0, 0x3F, 0xFF, 0x80, 0x60, 0x07, 0xFF,
+    0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0x00, 0x04, 0x01, 0xFF, 0xFF, 0xFE, 0x19, 0xFF, 0xFF, 0xFE, 0x79, 0xFF, 0xFF,
+    0xFE, 0xF9, 0xFF, 0xFF, 0xFE, 0xF1, 0xFF, 0xFF, 0xFE, 0xE0, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
+    0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x7C, 0x01, 0xF0, 0x00,
+    0x3E, 0x01, 0xF0, 0x00, 0x3E, 0x09, 0xE0, 0x00, 0x1E, 0x79, 0xE0, 0x00, 0x1E, 0xF9, 0xE0, 0x00,
+    0x1E, 0xF9, 0xE0, 0x00, 0x1E, 0xE1, 0xF0, 0x00, 0x3E, 0xC0, 0xF0, 0x00, 0x3C, 0x00, 0xFC, 0x00,
+    0xFC, 0x00, 0xFE, 0x01, 0xF8, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x0E, 0x01,
+    0xC0, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x7C, 0x00, 0x3E,
+    0x00, 0xF8, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x0F, 0x06, 0xF0, 0x00, 0x0F, 0xC6, 0xF0, 0x00, 0x0F,
+    0xEE, 0xF0, 0x00, 0x0F, 0x7E, 0xF0, 0x00, 0x0F, 0x7C, 0xF8, 0x00, 0x1F, 0x38, 0x7C, 0x00, 0x3E,
+    0x00, 0x7F, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0xF8,
+    0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+    0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x80, 0xFE, 0x01,
+    0xFC, 0xC0, 0xF8, 0x00, 0x7C, 0xF1, 0xF0, 0x00, 0x3E, 0xF9, 0xF0, 0x00, 0x3E, 0x79, 0xE0, 0x00,
+    0x1E, 0x39, 0xE0, 0x00, 0x1E, 0x39, 0xE0, 0x00, 0x1E, 0x79, 0xE0, 0x00, 0x1E, 0xF1, 0xF0, 0x00,
+    0x3E, 0xE0, 0xF0, 0x00, 0x3C, 0xC0, 0xFC, 0x00, 0xFC, 0x80, 0xFE, 0x01, 0xF8, 0x00, 0x7E, 0x01,
+    0xF8, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x1E, 0x01, 0xC0, 0x00, 0x02, 0x01, 0x00, 0x01, 0xFF, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+    0xFE, 0x01, 0xE0, 0x78, 0x1E, 0x09, 0xE0, 0x78, 0x1E, 0x39, 0xE0, 0x78, 0x1E, 0xF9, 0xE0, 0x78,
+    0x1E, 0xF9, 0xE0, 0x78, 0x1E, 0xE1, 0xE0, 0x78, 0x1E, 0xC1, 0xE0, 0x78, 0x1E, 0x01, 0xE0, 0x78,
+    0x1E, 0x01, 0xE0, 0x78, 0x1E, 0x01, 0xE0, 0x78, 0x1E, 0x01, 0xE0, 0x00, 0x1E, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0xF0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x0F,
+    0x00, 0xF0, 0x3C, 0x0F, 0x30, 0xF0, 0x3C, 0x0F, 0xFC, 0xF0, 0x3C, 0x0F, 0xFE, 0xF0, 0x3C, 0x0F,
+    0xFE, 0xF0, 0x3C, 0x0F, 0x8E, 0xF0, 0x3C, 0x0F, 0x8E, 0xF0, 0x00, 0x0F, 0x0C, 0x03, 0xFF, 0xFF,
+    0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x63, 0xFF, 0xFF, 0xFC, 0xF3, 0xFF, 0xFF, 0xFC, 0xF3, 0xFF, 0xFF,
+    0xFC, 0xF3, 0xC0, 0xF0, 0x3C, 0x63, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0,
+    0x3C, 0x63, 0xC0, 0xF0, 0x3C, 0xF3, 0xC0, 0xF0, 0x3C, 0xF3, 0xC0, 0xF0, 0x3C, 0xF3, 0xC0, 0xF0,
+    0x3C, 0x63, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xFF, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x81, 0xFF, 0xFF, 0xFE, 0xC1, 0xFF, 0xFF, 0xFE, 0xE1, 0xFF, 0xFF,
+    0xFE, 0xF1, 0xE0, 0x78, 0x1E, 0x79, 0xE0, 0x78, 0x1E, 0x39, 0xE0, 0x78, 0x1E, 0x39, 0xE0, 0x78,
+    0x1E, 0x79, 0xE0, 0x78, 0x1E, 0xF1, 0xE0, 0x78, 0x1E, 0xE1, 0xE0, 0x78, 0x1E, 0xC1, 0xE0, 0x78,
+    0x1E, 0x81, 0xE0, 0x78, 0x1E, 0x01, 0xE0, 0x78, 0x1E, 0x01, 0xE0, 0x00, 0x1E, 0x01, 0xFF, 0xFF,
+    0xFE, 0x19, 0xFF, 0xFF, 0xFE, 0x79, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xFE, 0xF1, 0xFF, 0xFF,
+    0xFE, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFE, 0xF1, 0xFF, 0xFF,
+    0xFE, 0xC1, 0xFF, 0xFF, 0xFE, 0xE1, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xFE, 0x78, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFE, 0x81, 0xFF, 0xFF, 0xFE, 0xC1, 0xFF, 0xFF, 0xFE, 0xE1, 0xFF, 0xFF, 0xFE, 0xF1, 0xFF, 0xFF,
+    0xFE, 0xF9, 0xE0, 0x00, 0x1E, 0x39, 0xE0, 0x00, 0x1E, 0x39, 0xE0, 0x00, 0x1E, 0x79, 0xE0, 0x00,
+    0x1E, 0xF1, 0xE0, 0x00, 0x1E, 0xE1, 0xF0, 0x00, 0x3E, 0xC1, 0xF0, 0x00, 0x3E, 0x80, 0xF8, 0x00,
+    0x7C, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
+    0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x38, 0x0F, 0xF0, 0x38, 0x0F, 0xF0, 0x38, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0x00, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x01,
+    0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
+    0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x18, 0x03, 0xF8, 0x00, 0x78,
+    0x01, 0xFE, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0xE0, 0x00, 0x0F, 0xF0, 0x80,
+    0x00, 0x07, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01,
+    0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01,
+    0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x81, 0xFF, 0xFF, 0xFE, 0xC0, 0x7F, 0x80, 0x00, 0xF0,
+    0x3F, 0xC0, 0x00, 0xF8, 0x0F, 0xF0, 0x00, 0x78, 0x03, 0xF8, 0x00, 0x18, 0x01, 0xFE, 0x00, 0x78,
+    0x00, 0x7F, 0x00, 0xF8, 0x00, 0x3F, 0xC0, 0xF0, 0x00, 0x0F, 0xF0, 0xE0, 0x00, 0x07, 0xF8, 0x81,
+    0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01,
+    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
+    0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x7C, 0x00,
+    0xF0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x3E, 0x09, 0xE0, 0x00, 0x1E, 0x39, 0xE0, 0x00, 0x1E, 0xF9,
+    0xE0, 0x00, 0x1E, 0xF9, 0xE0, 0x00, 0x1E, 0xF1, 0xF0, 0x00, 0x3E, 0xC1, 0xF0, 0x00, 0x3C, 0x80,
+    0xF8, 0x00, 0x7C, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
+    0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x04,
+    0x7F, 0x00, 0xFE, 0x0C, 0x7C, 0x00, 0x3E, 0x3C, 0x78, 0x00, 0x1F, 0x7C, 0xF8, 0x00, 0x1F, 0xF8,
+    0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0xF8, 0xF0, 0x00, 0x0F, 0x7C,
+    0xF8, 0x00, 0x1F, 0x3C, 0xF8, 0x00, 0x1E, 0x0C, 0x7C, 0x00, 0x3E, 0x04, 0x7F, 0x00, 0xFE, 0x00,
+    0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
+    0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x08, 0xF8, 0x00, 0x7C, 0x38,
+    0xF0, 0x00, 0x3E, 0x79, 0xF0, 0x00, 0x3E, 0xF9, 0xE0, 0x00, 0x1E, 0xF1, 0xE0, 0x00, 0x1E, 0xC1,
+    0xE0, 0x00, 0x1E, 0x89, 0xE0, 0x00, 0x1E, 0x19, 0xF0, 0x00, 0x3E, 0x79, 0xF0, 0x00, 0x3C, 0xF8,
+    0xF8, 0x00, 0x7C, 0xF0, 0xFE, 0x01, 0xFC, 0xE0, 0x7F, 0xFF, 0xF8, 0x80, 0x3F, 0xFF, 0xF0, 0x00,
+    0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
+    0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x60,
+    0xFE, 0x01, 0xFC, 0xF0, 0xF8, 0x00, 0x7C, 0xF0, 0xF0, 0x00, 0x3E, 0xF1, 0xF0, 0x00, 0x3E, 0x61,
+    0xE0, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x1E, 0x61, 0xE0, 0x00, 0x1E, 0xF1,
+    0xF0, 0x00, 0x3E, 0xF1, 0xF0, 0x00, 0x3C, 0xF0, 0xF8, 0x00, 0x7C, 0x60, 0xFE, 0x01, 0xFC, 0x00,
+    0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+    0x01, 0xFE, 0x00, 0x10, 0x04, 0x00, 0x38, 0x0E, 0x00, 0x7C, 0x1F, 0x00, 0x7E, 0x3F, 0x00, 0x3F,
+    0x7E, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF8,
+    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x80, 0x78, 0x0F, 0x00,
+    0x30, 0x06, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x81, 0xFF, 0xFF, 0xFE, 0xC1,
+    0xFF, 0xFF, 0xFE, 0xE1, 0xFF, 0xFF, 0xFE, 0xF1, 0xE0, 0x1E, 0x00, 0x79, 0xE0, 0x1E, 0x00, 0x39,
+    0xE0, 0x1E, 0x00, 0x39, 0xE0, 0x1E, 0x00, 0x79, 0xE0, 0x1F, 0x80, 0xF1, 0xF0, 0x3F, 0xE0, 0xE1,
+    0xF8, 0x7F, 0xF8, 0xC0, 0xFF, 0xFF, 0xFE, 0x80, 0xFF, 0xFD, 0xFE, 0x00, 0x7F, 0xF8, 0x7E, 0x00,
+    0x3F, 0xF0, 0x1E, 0x00, 0x0F, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x3E, 0x38, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0F, 0xC6, 0x00, 0x00, 0x0F, 0xC6,
+    0x00, 0x00, 0x0F, 0xC6, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x0F, 0x38, 0x00, 0x00, 0x1F, 0x00,
+    0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x01,
+    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1E, 0x18, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0x1E, 0xF8,
+    0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x00, 0x7C, 0x01,
+    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x01,
+    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x01,
+    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x08, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0x3E, 0xF8,
+    0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00, 0x1E, 0x18,
+    0x00, 0x00, 0x1E, 0x38, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x7C, 0xF1, 0xFF, 0xFF, 0xFC, 0xE1,
+    0xFF, 0xFF, 0xF8, 0xC1, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x01,
+    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x61,
+    0xFF, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0x7C, 0xF0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1E, 0x60,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x60, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x1E, 0xF0,
+    0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x7C, 0x61, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x01,
+    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x18,
+    0x00, 0xFF, 0xFE, 0x78, 0x00, 0x7F, 0xFE, 0xF8, 0x00, 0xFF, 0xFE, 0xF0, 0x03, 0xFF, 0xFE, 0xE0,
+    0x0F, 0xFC, 0x00, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
+    0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x06, 0xFF,
+    0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF, 0x7C, 0xF0,
+    0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF,
+    0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF8, 0x7C, 0x0F, 0x7F, 0xFE, 0x0F, 0x7F,
+    0xFE, 0x1F, 0x3F, 0xEF, 0xFF, 0x3F, 0xCF, 0xFE, 0x0F, 0x8F, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x01,
+    0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+    0x80, 0x19, 0xFF, 0xFF, 0x80, 0x78, 0x78, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0xF1, 0xE0, 0x00,
+    0x00, 0xC1, 0xE0, 0x00, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x38, 0xFF, 0x00, 0x00, 0x78, 0xFF, 0x00, 0x00, 0xF9, 0xFF, 0x80, 0x00, 0xF9, 0xFF,
+    0x80, 0x01, 0xF1, 0xCF, 0x80, 0x01, 0xE1, 0x87, 0x80, 0x09, 0xE1, 0x87, 0x80, 0x79, 0xE1, 0x87,
+    0x00, 0xF9, 0xE3, 0x87, 0x00, 0xF9, 0xF3, 0x8C, 0x00, 0xE1, 0xFF, 0xFF, 0x80, 0xC0, 0xFF, 0xFF,
+    0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1E,
+    0x00, 0x00, 0x1C, 0x7F, 0x80, 0x04, 0x3C, 0x7F, 0x80, 0x0C, 0x7C, 0xFF, 0xC0, 0x1C, 0x7C, 0xFF,
+    0xC0, 0x3C, 0xF8, 0xE7, 0xC0, 0x7C, 0xF0, 0xC3, 0xC0, 0xF8, 0xF0, 0xC3, 0xC0, 0xE0, 0xF0, 0xC3,
+    0x80, 0xF0, 0xF1, 0xC3, 0x80, 0x7C, 0xF9, 0xC6, 0x00, 0x3C, 0xFF, 0xFF, 0xC0, 0x1C, 0x7F, 0xFF,
+    0xC0, 0x0C, 0x7F, 0xFF, 0xC0, 0x04, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x38, 0xFF, 0x00, 0x00, 0x78, 0xFF, 0x00, 0xC0, 0xF9, 0xFF, 0x80, 0xF0, 0xF9, 0xFF,
+    0x80, 0xF1, 0xF1, 0xCF, 0x80, 0x39, 0xE1, 0x87, 0x80, 0x19, 0xE1, 0x87, 0x80, 0x19, 0xE1, 0x87,
+    0x00, 0x19, 0xE3, 0x87, 0x00, 0x39, 0xF3, 0x8C, 0x00, 0xF1, 0xFF, 0xFF, 0x80, 0xF0, 0xFF, 0xFF,
+    0x80, 0xC0, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x08, 0x3C,
+    0x00, 0x00, 0x38, 0xFF, 0x00, 0x60, 0x78, 0xFF, 0x00, 0xF0, 0xF9, 0xFF, 0x80, 0xF0, 0xF9, 0xFF,
+    0x80, 0xF1, 0xF1, 0xCF, 0x80, 0x61, 0xE1, 0x87, 0x80, 0x01, 0xE1, 0x87, 0x80, 0x01, 0xE1, 0x87,
+    0x00, 0x61, 0xE3, 0x87, 0x00, 0xF1, 0xF3, 0x8C, 0x00, 0xF1, 0xFF, 0xFF, 0x80, 0xF0, 0xFF, 0xFF,
+    0x80, 0x60, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+    0xFE, 0x19, 0xFF, 0xFF, 0xFE, 0x79, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xFE, 0xF1, 0xFF, 0xFF,
+    0xFE, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xF8, 0x1F,
+    0x80, 0x01, 0xF0, 0x0F, 0x80, 0x19, 0xE0, 0x07, 0x80, 0x79, 0xE0, 0x07, 0x80, 0xF9, 0xE0, 0x07,
+    0x80, 0xF1, 0xF0, 0x0F, 0x80, 0xE1, 0xF8, 0x1F, 0x80, 0x80, 0xFC, 0x3F, 0x00, 0x00, 0x7C, 0x3F,
+    0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFC, 0x0F, 0xC0,
+    0x00, 0xF8, 0x07, 0xC1, 0x80, 0xF0, 0x03, 0xF1, 0x80, 0xF0, 0x03, 0xFF, 0x80, 0xF0, 0x03, 0xDF,
+    0x00, 0xF8, 0x07, 0xDF, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x3E, 0x1F, 0x80,
+    0x00, 0x1E, 0x1E, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0xF1, 0xF8, 0x1F,
+    0x80, 0xF9, 0xF0, 0x0F, 0x80, 0x79, 0xE0, 0x07, 0x80, 0x19, 0xE0, 0x07, 0x80, 0x39, 0xE0, 0x07,
+    0x80, 0xF9, 0xF0, 0x0F, 0x80, 0xF1, 0xF8, 0x1F, 0x80, 0xE0, 0xFC, 0x3F, 0x00, 0xC0, 0x7C, 0x3E,
+    0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFB, 0x9F,
+    0x80, 0x01, 0xF3, 0x8F, 0x80, 0x19, 0xE3, 0x87, 0x80, 0x79, 0xE3, 0x87, 0x80, 0xF9, 0xE3, 0x87,
+    0x80, 0xF1, 0xF3, 0x87, 0x80, 0xE1, 0xFB, 0x8F, 0x80, 0x80, 0xFF, 0x9F, 0x00, 0x00, 0xFF, 0x9F,
+    0x00, 0x00, 0x7F, 0x9E, 0x00, 0x00, 0x3F, 0x9C, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x03, 0xF8, 0x00,
+    0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0xFD, 0xCF, 0xC0, 0xF9,
+    0xC7, 0xC0, 0xF1, 0xC3, 0xFE, 0xF1, 0xC3, 0xFF, 0xF1, 0xC3, 0xFF, 0xF9, 0xC3, 0xE7, 0xFD, 0xC7,
+    0xC7, 0x7F, 0xCF, 0x86, 0x7F, 0xCF, 0x80, 0x3F, 0xCF, 0x00, 0x1F, 0xCE, 0x00, 0x07, 0xC8, 0x00,
+    0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x60, 0x7F, 0xFE, 0x00, 0xF0, 0xFF, 0xFF, 0x00,
+    0xF0, 0xFF, 0xFF, 0x00, 0xF1, 0xFB, 0x9F, 0x80, 0x61, 0xF3, 0x8F, 0x80, 0x01, 0xE3, 0x87, 0x80,
+    0x01, 0xE3, 0x87, 0x80, 0x61, 0xE3, 0x87, 0x80, 0xF1, 0xF3, 0x87, 0x80, 0xF1, 0xFB, 0x8F, 0x80,
+    0xF0, 0xFF, 0x9F, 0x00, 0x60, 0xFF, 0x9F, 0x00, 0x00, 0x7F, 0x9E, 0x00, 0x00, 0x3F, 0x9C, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x80, 0x3F, 0xFF, 0x00,
+    0xC0, 0x7F, 0xFF, 0x80, 0xE0, 0x7F, 0xFF, 0x80, 0xF8, 0xFD, 0xCF, 0xC0, 0x7C, 0xF9, 0xC7, 0xC0,
+    0x3C, 0xF1, 0xC3, 0xC0, 0x1C, 0xF1, 0xC3, 0xC0, 0x3C, 0xF1, 0xC3, 0xC0, 0x7C, 0xF9, 0xC3, 0xC0,
+    0xF8, 0xFD, 0xC7, 0xC0, 0xE0, 0x7F, 0xCF, 0x80, 0xC0, 0x7F, 0xCF, 0x80, 0x80, 0x3F, 0xCF, 0x00,
+    0x00, 0x1F, 0xCE, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x19, 0xFF, 0xFF, 0x80,
+    0x79, 0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0xFF, 0x80, 0xF1, 0xFF, 0xFF, 0x80, 0xE0, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x80, 0xE1, 0xFF, 0xFF, 0x80, 0xC1, 0xFF, 0xFF, 0x80,
+    0xE1, 0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0xFF, 0x80, 0x78, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xF8, 0x1F, 0x80,
+    0x01, 0xF0, 0x0F, 0x80, 0x01, 0xE0, 0x07, 0x80, 0x01, 0xE0, 0x07, 0x80, 0x00, 0xE0, 0x07, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x78, 0x1C, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80,
+    0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFE,
+    0x03, 0xFF, 0xFF, 0x03, 0xF0, 0x3F, 0x03, 0xE0, 0x1F, 0x03, 0xC0, 0x0F, 0x3B, 0xC0, 0x0F, 0x39,
+    0xC0, 0x0E, 0x39, 0xE0, 0x1E, 0x38, 0xF0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+    0x80, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x00, 0xF9, 0xE0, 0x00,
+    0x00, 0xF9, 0xE0, 0x00, 0x00, 0xE1, 0xF0, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+    0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+    0x80, 0x01, 0xFF, 0xFF, 0x80, 0x81, 0xFF, 0xFF, 0x80, 0xC1, 0xFF, 0xFF, 0x80, 0xE1, 0xFF, 0xFF,
+    0x80, 0xF0, 0x30, 0x00, 0x00, 0x78, 0xE0, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x39, 0xE0, 0x00,
+    0x00, 0x79, 0xE0, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x80, 0xC1, 0xFF, 0xFF,
+    0x80, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xF0,
+    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x01, 0xF8, 0x1F, 0x80, 0x01, 0xF0, 0x0F, 0x80, 0x19, 0xE0, 0x07, 0x80, 0x79, 0xE0, 0x07,
+    0x80, 0xF9, 0xE0, 0x07, 0x80, 0xF1, 0xF0, 0x0F, 0x80, 0xE1, 0xF8, 0x1F, 0x80, 0x80, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xF0,
+    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0x00, 0x0C, 0x7F, 0xFF,
+    0x80, 0x1C, 0x7F, 0xFF, 0x80, 0x3C, 0xFC, 0x0F, 0xC0, 0x7C, 0xF8, 0x07, 0xC0, 0xF0, 0xF0, 0x03,
+    0xC0, 0xE0, 0xF0, 0x03, 0xC0, 0xF0, 0xF0, 0x03, 0xC0, 0x7C, 0xF8, 0x07, 0xC0, 0x3C, 0xFC, 0x0F,
+    0xC0, 0x1C, 0x7F, 0xFF, 0x80, 0x0C, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFE,
+    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x39, 0xF8, 0x1F, 0x80, 0xF9, 0xF0, 0x0F,
+    0x80, 0xF1, 0xE0, 0x07, 0x80, 0xE1, 0xE0, 0x07, 0x80, 0x81, 0xE0, 0x07, 0x80, 0x19, 0xF0, 0x0F,
+    0x80, 0x39, 0xF8, 0x1F, 0x80, 0xF8, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xE0, 0x7F, 0xFE,
+    0x00, 0xC0, 0x3F, 0xFC, 0x00, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x60, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xF1, 0xF8, 0x1F,
+    0x80, 0xF1, 0xF0, 0x0F, 0x80, 0x61, 0xE0, 0x07, 0x80, 0x01, 0xE0, 0x07, 0x80, 0x61, 0xE0, 0x07,
+    0x80, 0xF1, 0xF0, 0x0F, 0x80, 0xF1, 0xF8, 0x1F, 0x80, 0xF0, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xFF,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xE0, 0x00,
+    0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x71, 0xE3, 0x80, 0xF9,
+    0xE7, 0xC0, 0xF9, 0xE7, 0xC0, 0xF9, 0xE7, 0xC0, 0x71, 0xE3, 0x80, 0x01, 0xE0, 0x00, 0x01, 0xE0,
+    0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0xC1, 0xFF, 0xFF, 0x80, 0xE1, 0xFF, 0xFF, 0x80, 0xF1, 0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0xFF,
+    0x80, 0x39, 0xFF, 0xFF, 0x80, 0x18, 0x78, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0xF9, 0xE0, 0x00,
+    0x00, 0xF1, 0xE0, 0x00, 0x00, 0xC1, 0xE0, 0x00, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
+    0xE0, 0x38, 0x7F, 0xFF, 0xE0, 0x7C, 0x00, 0x03, 0xE0, 0xEE, 0x00, 0x01, 0xE0, 0xC6, 0x00, 0x01,
+    0xE0, 0xC6, 0x00, 0x01, 0xC0, 0xEE, 0x00, 0x01, 0xC0, 0x7C, 0x00, 0x07, 0x00, 0x38, 0x7F, 0xFF,
+    0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
+    0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0x80, 0x38, 0x00, 0x07,
+    0x80, 0xF8, 0x00, 0x07, 0x00, 0xF8, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0xC1, 0xFF, 0xFF,
+    0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+    0x80, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x09, 0xFF, 0xFF,
+    0x80, 0x19, 0xFF, 0xFF, 0x80, 0x78, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07,
+    0x80, 0xC0, 0x00, 0x07, 0x00, 0x88, 0x00, 0x07, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x79, 0xFF, 0xFF,
+    0x80, 0xF9, 0xFF, 0xFF, 0x80, 0xE1, 0xFF, 0xFF, 0x80, 0xC1, 0xFF, 0xFF, 0x80, 0x81, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x61, 0xFF, 0xFF,
+    0x00, 0xF1, 0xFF, 0xFF, 0x80, 0xF1, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x0F, 0x80, 0x60, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x00, 0x60, 0x00, 0x07, 0x00, 0xF0, 0x00, 0x1C,
+    0x00, 0xF1, 0xFF, 0xFF, 0x80, 0xF1, 0xFF, 0xFF, 0x80, 0x61, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+    0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x01, 0x01, 0xFC, 0x00,
+    0x0F, 0x01, 0xFF, 0xC0, 0x0F, 0x01, 0xFF, 0xF8, 0x0F, 0x00, 0x7F, 0xFF, 0x1F, 0x00, 0x0F, 0xFF,
+    0xFF, 0x08, 0x00, 0xFF, 0xFE, 0x78, 0x00, 0x0F, 0xFE, 0xF8, 0x00, 0x3F, 0xFC, 0xF8, 0x03, 0xFF,
+    0xF0, 0xE0, 0x3F, 0xFF, 0x80, 0xC1, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x00, 0x07, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC,
+    0x00, 0xFF, 0xFF, 0xFE, 0x0C, 0xFF, 0xFF, 0xFF, 0x8C, 0x07, 0x80, 0x3F, 0xDC, 0x07, 0x80, 0x1E,
+    0xF8, 0x07, 0x80, 0x3C, 0xF8, 0x00, 0x00, 0x00, 0x70, 0x70, 0xF8, 0xF8, 0xF8, 0x70,
+};
+static const uint32_t InterTight_Bold16pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 16, 38, 98, 174, 262, 322, 330, 366, 402, 428,
+    476, 488, 498, 503, 547, 604, 637, 685, 736, 793, 844, 898,
+    946, 1000, 1054, 1069, 1087, 1135, 1165, 1213, 1258, 1374, 1440, 1494,
+    1557, 1614, 1662, 1707, 1770, 1830, 1845, 1890, 1950, 1995, 2070, 2127,
+    2193, 2244, 2332, 2386, 2443, 2500, 2557, 2623, 2719, 2782, 2845, 2899,
+    2931, 2975, 3007, 3033, 3048, 3054, 3102, 3153, 3201, 3252, 3303, 3351,
+    3419, 3467, 3487, 3519, 3570, 3585, 3660, 3708, 3759, 3827, 3895, 3928,
+    3973, 4006, 4054, 4105, 4183, 4234, 4302, 4344, 4388, 4413, 4461, 4478,
+    4478, 4479, 4571, 4582, 4636, 4699, 4759, 4835, 4899, 4911, 4987, 5063,
+    5139, 5211, 5221, 5293, 5365, 5387, 5435, 5442, 5469, 5476, 5516, 5576,
+    5589, 5595, 5655, 5715, 5767, 5823, 5837, 5893, 5949, 6021, 6109, 6197,
+    6285, 6373, 6433, 6517, 6601, 6685, 6749, 6813, 6877, 6941, 6969, 7021,
+    7097, 7163, 7239, 7315, 7403, 7491, 7579, 7667, 7715, 7787, 7863, 7939,
+    8015, 8091, 8175, 8251, 8305, 8349, 8413, 8477, 8541, 8605, 8633, 8697,
+    8761, 8825, 8893, 8944, 9012, 9080, 9108, 9160, 9252, 9309, 9373, 9437,
+    9505, 9573, 9641, 9709, 9757, 9809, 9873, 9937, 10005, 10069, 10137, 10185,
+};
+
+// InterTightBold18pt8bfr.h
+static const uint8_t InterTight_Bold18pt8b_Atlas[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xCF, 0xC0, 0xFF, 0xFF, 0xCF, 0xC0, 0xFF, 0xFF, 0xCF,
+    0xC0, 0xFF, 0xFF, 0xCF, 0xC0, 0xFF, 0xFF, 0xC7, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x41, 0xE0, 0x00, 0x03, 0xC1, 0xE0, 0xC0, 0x03,
+    0xC1, 0xFF, 0xC0, 0x03, 0xCF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xE0, 0x00, 0xFF, 0xF9, 0xE0, 0x00, 0xFF, 0xC1, 0xE0, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x03,
+    0xC1, 0xE0, 0x40, 0x03, 0xC1, 0xFF, 0xC0, 0x03, 0xC7, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF9, 0xE0, 0x00, 0xFF, 0xC1, 0xE0, 0x00, 0x83,
+    0xC1, 0xE0, 0x00, 0x03, 0xC1, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x7E, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0x03, 0xE0, 0x00, 0x03, 0xFF, 0x83, 0xF0, 0x00, 0x03,
+    0xFF, 0xC3, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0xF8, 0x00, 0x07, 0x8F, 0xE0, 0x7C, 0x00, 0x0F, 0x87,
+    0xE0, 0x7C, 0x00, 0x0F, 0x03, 0xE0, 0x3C, 0x00, 0x0F, 0x03, 0xE0, 0x3C, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0x01, 0xF0, 0x3C, 0x00, 0x0F, 0x81, 0xF8, 0x7C,
+    0x00, 0x07, 0xC1, 0xF8, 0xF8, 0x00, 0x07, 0xE0, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0xFF, 0xF8, 0x00,
+    0x03, 0xE0, 0x7F, 0xF0, 0x00, 0x01, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x20, 0x0F, 0x80, 0x00, 0x1F,
+    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x10, 0xFF, 0xFC, 0x00, 0x70, 0xF0,
+    0x3C, 0x00, 0xF0, 0xF0, 0x3C, 0x01, 0xE0, 0xF0, 0x3C, 0x07, 0xC0, 0xFF, 0xFC, 0x0F, 0x00, 0x7F,
+    0xF8, 0x3E, 0x00, 0x3F, 0xF0, 0x78, 0x00, 0x1F, 0xE1, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+    0x0F, 0x80, 0x00, 0x00, 0x1F, 0x1F, 0xC0, 0x00, 0x7C, 0x7F, 0xE0, 0x00, 0xF8, 0xFF, 0xF0, 0x03,
+    0xE1, 0xFF, 0xF8, 0x07, 0xC1, 0xF0, 0xF8, 0x1F, 0x01, 0xE0, 0x78, 0x3E, 0x01, 0xE0, 0x78, 0x3C,
+    0x01, 0xF0, 0xF8, 0x30, 0x01, 0xFF, 0xF8, 0x20, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+    0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x83, 0xFF, 0x00, 0x3F,
+    0xE7, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x8F, 0xC0, 0xFF, 0xFF, 0x07, 0xC0, 0xF8,
+    0xFF, 0x03, 0xC0, 0xF0, 0x7F, 0x83, 0xC0, 0xF0, 0x7F, 0xC3, 0xC0, 0xF8, 0xFF, 0xE3, 0xC0, 0xFF,
+    0xFF, 0xF7, 0xC0, 0x7F, 0xF3, 0xFF, 0x80, 0x7F, 0xE0, 0xFF, 0x80, 0x3F, 0xC0, 0x7F, 0x00, 0x0F,
+    0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
+    0x07, 0xF3, 0xC0, 0x00, 0x07, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xF0, 0x00, 0x00, 0x07,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x70, 0x3C, 0x70, 0x1E, 0xF0, 0x0E, 0xE0, 0x07, 0xC0, 0xFF,
+    0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x07, 0xC0, 0x0E, 0xE0, 0x1E, 0xF0, 0x1C, 0x70, 0x1C, 0x70, 0x00,
+    0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+    0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
+    0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xC0, 0xFC, 0x00, 0xE0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0x78, 0xFC, 0xFC, 0xFC, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07,
+    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F,
+    0x00, 0x7F, 0x80, 0x7C, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0,
+    0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF8,
+    0x00, 0x07, 0xC0, 0x7C, 0x00, 0x0F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0x00, 0x03, 0xC0, 0x1F,
+    0x00, 0x07, 0xC0, 0x3F, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0xC0, 0x7C,
+    0x00, 0x7F, 0xC0, 0xF8, 0x00, 0xFF, 0xC0, 0xF0, 0x01, 0xFF, 0xC0, 0xF0, 0x03, 0xFB, 0xC0, 0xF0,
+    0x03, 0xF3, 0xC0, 0xF0, 0x07, 0xE3, 0xC0, 0xF8, 0x1F, 0xC3, 0xC0, 0x7C, 0x3F, 0x83, 0xC0, 0x7F,
+    0xFF, 0x03, 0xC0, 0x7F, 0xFE, 0x03, 0xC0, 0x3F, 0xFC, 0x03, 0xC0, 0x1F, 0xF8, 0x03, 0xC0, 0x07,
+    0xE0, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x3E,
+    0x00, 0x3F, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0F, 0x80, 0x78, 0x00, 0x07, 0xC0, 0xF8,
+    0x3C, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0,
+    0x3C, 0x03, 0xC0, 0xF8, 0x7E, 0x07, 0xC0, 0xF8, 0xFF, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F,
+    0xEF, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x1F, 0xC3, 0xFE, 0x00, 0x0F, 0x81, 0xF8, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+    0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0x78, 0x00, 0x03, 0xFE, 0x78, 0x00, 0x0F,
+    0xF8, 0x78, 0x00, 0x1F, 0xE0, 0x78, 0x00, 0x7F, 0xC0, 0x78, 0x00, 0xFF, 0x00, 0x78, 0x00, 0xFE,
+    0x00, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x38, 0x00, 0x7F, 0xF8, 0x3E, 0x00, 0xFF,
+    0xF8, 0x3F, 0x00, 0xFF, 0xFC, 0x3F, 0x00, 0xFF, 0xFC, 0x3F, 0x80, 0xFF, 0xB8, 0x0F, 0x80, 0xF0,
+    0x78, 0x07, 0xC0, 0xF0, 0x70, 0x03, 0xC0, 0xF0, 0xF0, 0x03, 0xC0, 0xF0, 0xF0, 0x03, 0xC0, 0xF0,
+    0xF0, 0x03, 0xC0, 0xF0, 0xF8, 0x07, 0xC0, 0xF0, 0xF8, 0x07, 0xC0, 0xF0, 0xFE, 0x1F, 0x80, 0xF0,
+    0x7F, 0xFF, 0x80, 0xF0, 0x7F, 0xFF, 0x00, 0xF0, 0x3F, 0xFE, 0x00, 0xF0, 0x0F, 0xFC, 0x00, 0x00,
+    0x03, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
+    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0x1F, 0xFF, 0x80, 0x7E, 0x3C, 0x0F, 0x80, 0xFC,
+    0x78, 0x07, 0xC0, 0xF8, 0x70, 0x03, 0xC0, 0xF8, 0xF0, 0x03, 0xC0, 0xF8, 0xF0, 0x03, 0xC0, 0xF8,
+    0xF0, 0x03, 0xC0, 0xF8, 0xF8, 0x07, 0xC0, 0xFC, 0xF8, 0x07, 0xC0, 0x7E, 0xFE, 0x1F, 0x80, 0x7E,
+    0x7F, 0xFF, 0x80, 0x3E, 0x7F, 0xFF, 0x00, 0x1E, 0x3F, 0xFE, 0x00, 0x0E, 0x1F, 0xFC, 0x00, 0x02,
+    0x07, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xC0, 0xF0,
+    0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x3F, 0xC0, 0xF0, 0x00, 0xFF, 0xC0, 0xF0,
+    0x03, 0xFF, 0xC0, 0xF0, 0x0F, 0xFF, 0x00, 0xF0, 0x3F, 0xFC, 0x00, 0xF0, 0xFF, 0xF0, 0x00, 0xF3,
+    0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F,
+    0x83, 0xFE, 0x00, 0x1F, 0xC7, 0xFF, 0x00, 0x3F, 0xEF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0x0F, 0x80, 0xF8, 0xFE, 0x07, 0xC0, 0xF8, 0x7E, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0,
+    0x3C, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0xF8, 0x7E, 0x03, 0xC0, 0xF8,
+    0x7E, 0x07, 0xC0, 0x7F, 0xFF, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xEF, 0xFF, 0x00, 0x1F,
+    0xC7, 0xFF, 0x00, 0x0F, 0x83, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x30, 0x00, 0x0F,
+    0xFC, 0x3C, 0x00, 0x1F, 0xFE, 0x3E, 0x00, 0x3F, 0xFF, 0x3F, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x7C,
+    0x1F, 0x9F, 0x80, 0xF8, 0x0F, 0x8F, 0xC0, 0xF0, 0x07, 0x87, 0xC0, 0xF0, 0x07, 0x87, 0xC0, 0xF0,
+    0x07, 0x87, 0xC0, 0xF0, 0x07, 0x87, 0xC0, 0xF0, 0x07, 0x07, 0xC0, 0xF8, 0x0F, 0x0F, 0xC0, 0x7C,
+    0x1E, 0x1F, 0x80, 0x7F, 0xFC, 0x7F, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F,
+    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x78, 0x03, 0xC0, 0xFC, 0x07,
+    0xE0, 0xFC, 0x07, 0xE0, 0xFC, 0x07, 0xE0, 0xFC, 0x07, 0xE0, 0x78, 0x03, 0xC0, 0x00, 0x00, 0x07,
+    0xC0, 0x78, 0x01, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0xFC, 0x01, 0xFC,
+    0x00, 0xFC, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x01,
+    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xDF, 0x00, 0x07, 0xDF,
+    0x00, 0x0F, 0x8F, 0x80, 0x0F, 0x8F, 0x80, 0x0F, 0x0F, 0x80, 0x1F, 0x07, 0xC0, 0x1F, 0x07, 0xC0,
+    0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x7C, 0x01, 0xF0, 0xFC, 0x01, 0xF0, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xFC, 0x01, 0xF0, 0x7C, 0x01, 0xF0, 0x7C, 0x03, 0xF0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0,
+    0x1F, 0x07, 0xC0, 0x1F, 0x07, 0xC0, 0x0F, 0x0F, 0x80, 0x0F, 0x8F, 0x80, 0x0F, 0x8F, 0x80, 0x07,
+    0xDF, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xC7, 0x80, 0xF8,
+    0x0F, 0xCF, 0xC0, 0xF0, 0x1F, 0xCF, 0xC0, 0xF0, 0x1F, 0xCF, 0xC0, 0xF0, 0x3F, 0xCF, 0xC0, 0xF0,
+    0x7E, 0x07, 0x80, 0xF8, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F,
+    0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
+    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x07,
+    0xF0, 0x7E, 0x00, 0x3E, 0x1F, 0xFC, 0x3E, 0x00, 0x7C, 0x3F, 0xFF, 0x1F, 0x00, 0x7C, 0x7F, 0xFF,
+    0x1F, 0x00, 0x78, 0xFF, 0xFF, 0x8F, 0x00, 0xF8, 0xFC, 0x1F, 0xCF, 0x80, 0xF1, 0xF0, 0x07, 0xC7,
+    0x80, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x03, 0xC7, 0x80,
+    0xF1, 0xE0, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0xF0, 0xF0, 0x07, 0x87, 0x80, 0xF0,
+    0xF8, 0x0F, 0x07, 0x80, 0xF9, 0xFF, 0xFE, 0x07, 0x80, 0x79, 0xFF, 0xFF, 0x8F, 0x00, 0x7D, 0xFF,
+    0xFF, 0xCF, 0x00, 0x7D, 0xFF, 0xFF, 0xCF, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x03,
+    0xC0, 0x00, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80,
+    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
+    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0xF0, 0x00, 0xFF, 0xC0, 0xF0, 0x00, 0xFE, 0x00, 0xF0, 0x00,
+    0xFE, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xF0, 0x00, 0xFF, 0xF8, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0,
+    0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0,
+    0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0x3E, 0x03, 0xC0, 0xFC, 0x7F, 0x07, 0xC0, 0x7F, 0xFF, 0x8F, 0xC0,
+    0x7F, 0xF7, 0xFF, 0x80, 0x3F, 0xF7, 0xFF, 0x80, 0x1F, 0xE3, 0xFF, 0x00, 0x0F, 0x81, 0xFE, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
+    0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+    0x7C, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x0F, 0xC0,
+    0x7C, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x1F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x7F, 0x00,
+    0x1F, 0x80, 0x7E, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x07, 0x80, 0x78, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x3F, 0x80,
+    0x3F, 0x80, 0x7F, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x1E, 0x03, 0xC0,
+    0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0,
+    0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0,
+    0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
+    0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
+    0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
+    0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0x80,
+    0x7C, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x0F, 0x07, 0xC0, 0xF8, 0x0F, 0x07, 0xC0, 0xF8, 0x0F, 0x07, 0xC0,
+    0xFC, 0x0F, 0x0F, 0xC0, 0x7E, 0x0F, 0x1F, 0x80, 0x7F, 0x8F, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0x00,
+    0x1F, 0x8F, 0xFE, 0x00, 0x0F, 0x8F, 0xFC, 0x00, 0x07, 0x8F, 0xF8, 0x00, 0x01, 0x8F, 0xE0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+    0x1F, 0xE7, 0xFE, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x7F, 0xC0,
+    0xFC, 0x00, 0x1F, 0xC0, 0xF0, 0x00, 0x0F, 0xC0, 0xE0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x01, 0xC0,
+    0x80, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+    0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
+    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00,
+    0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+    0x3F, 0xC0, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x7C, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x0F, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x0F, 0x80,
+    0x7F, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
+    0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xF0, 0x07, 0x80, 0x00, 0xF0, 0x07, 0x80, 0x00, 0xF0, 0x07, 0x80, 0x00, 0xF0, 0x07, 0x80, 0x00,
+    0xF0, 0x07, 0x80, 0x00, 0xF0, 0x07, 0x80, 0x00, 0xF0, 0x07, 0x80, 0x00, 0xF8, 0x0F, 0x80, 0x00,
+    0x7C, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+    0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x00,
+    0x7F, 0x00, 0x3F, 0x80, 0x7C, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x47, 0xC0, 0xF8, 0x00, 0x67, 0xC0, 0xF8, 0x00, 0x77, 0xC0, 0xF8, 0x00, 0x7F, 0xC0,
+    0xF8, 0x00, 0x7F, 0xC0, 0xFC, 0x00, 0x7F, 0xC0, 0x7E, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x3F, 0xC0,
+    0x3F, 0xC0, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0xF0, 0x0F, 0xFF, 0xF8, 0x70,
+    0x03, 0xFF, 0xF0, 0x30, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x0F, 0x00, 0x00,
+    0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00,
+    0xF0, 0x0F, 0xE0, 0x00, 0xF0, 0x0F, 0xF8, 0x00, 0xF8, 0x1F, 0xFC, 0x00, 0xFC, 0x3F, 0xFF, 0x00,
+    0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0x7F, 0xC0, 0x3F, 0xFC, 0x1F, 0xC0, 0x1F, 0xF8, 0x07, 0xC0,
+    0x07, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x07, 0xE0, 0x3C, 0x00,
+    0x1F, 0xF0, 0x3E, 0x00, 0x3F, 0xF8, 0x3F, 0x00, 0x3F, 0xFC, 0x3F, 0x80, 0x7F, 0xFC, 0x0F, 0x80,
+    0x78, 0xFE, 0x07, 0xC0, 0xF8, 0x7E, 0x07, 0xC0, 0xF0, 0x3E, 0x03, 0xC0, 0xF0, 0x3E, 0x03, 0xC0,
+    0xF0, 0x3F, 0x03, 0xC0, 0xF0, 0x3F, 0x03, 0xC0, 0xF0, 0x1F, 0x03, 0xC0, 0xF8, 0x1F, 0x87, 0xC0,
+    0x7C, 0x1F, 0x8F, 0x80, 0x7E, 0x0F, 0xFF, 0x80, 0x3E, 0x0F, 0xFF, 0x80, 0x3E, 0x07, 0xFF, 0x00,
+    0x1E, 0x03, 0xFE, 0x00, 0x02, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0,
+    0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
+    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
+    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0xC0,
+    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xE0, 0x00, 0x01, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x1F, 0xC0, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x7F, 0xE1, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00,
+    0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0x7F, 0xC0,
+    0xFE, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xE0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x00, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0,
+    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x1F, 0xC0, 0xF0, 0x00, 0x3F, 0xC0,
+    0xF0, 0x00, 0x7F, 0xC0, 0xF0, 0x01, 0xFF, 0xC0, 0xF0, 0x03, 0xFF, 0xC0, 0xF0, 0x0F, 0xFB, 0xC0,
+    0xF0, 0x1F, 0xF3, 0xC0, 0xF0, 0x7F, 0xC3, 0xC0, 0xF0, 0xFF, 0x83, 0xC0, 0xF3, 0xFE, 0x03, 0xC0,
+    0xF7, 0xFC, 0x03, 0xC0, 0xFF, 0xF0, 0x03, 0xC0, 0xFF, 0xE0, 0x03, 0xC0, 0xFF, 0x80, 0x03, 0xC0,
+    0xFF, 0x00, 0x03, 0xC0, 0xFE, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00,
+    0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xE0, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
+    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x01, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80,
+    0xF0, 0x00, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x30,
+    0x00, 0xF0, 0x03, 0xF0, 0x0F, 0xF0, 0x3F, 0xE0, 0xFF, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0xFC, 0x00,
+    0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x30, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80, 0xC0, 0xE0,
+    0xF8, 0xF8, 0x78, 0x18, 0x00, 0x0F, 0x80, 0x0C, 0x3F, 0xC0, 0x3C, 0x3F, 0xE0, 0x7C, 0x7F, 0xF0,
+    0x7C, 0x7F, 0xF0, 0x7C, 0x79, 0xF0, 0xF8, 0xF0, 0xF0, 0xF0, 0xE0, 0xF0, 0xF0, 0xE0, 0xF0, 0xF0,
+    0xE0, 0xE0, 0xF0, 0xE1, 0xE0, 0xF8, 0xE3, 0xC0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x78, 0x1E, 0x00, 0x00,
+    0xE0, 0x07, 0x80, 0x01, 0xC0, 0x03, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x01,
+    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xE0, 0x7E, 0x07, 0xE0, 0xF8, 0x01, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00,
+    0xF0, 0xF0, 0x00, 0xF0, 0xF8, 0x01, 0xF0, 0xFC, 0x03, 0xF0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+    0x3E, 0x07, 0xC0, 0x1E, 0x07, 0x80, 0x06, 0x06, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xF8, 0x1F,
+    0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x01, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1E,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xE0, 0x7D, 0xE3, 0xE0, 0xF9, 0xE1, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0,
+    0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF9, 0xE1, 0xF0, 0x7D, 0xE1, 0xF0, 0x7F, 0xE3, 0xE0, 0x3F,
+    0xE3, 0xE0, 0x3F, 0xE3, 0xC0, 0x0F, 0xE3, 0x80, 0x03, 0xE2, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01,
+    0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF9, 0xE0, 0x00, 0x00, 0xF1,
+    0xE0, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x83, 0x00, 0x3F, 0xFF, 0xC3, 0x80, 0x3F, 0xFF, 0xE7, 0xC0, 0x7F,
+    0xFF, 0xE7, 0xC0, 0xFE, 0x07, 0xF7, 0xE0, 0xF8, 0x01, 0xF3, 0xE0, 0xF8, 0x00, 0xF1, 0xE0, 0xF0,
+    0x00, 0xF1, 0xE0, 0xF0, 0x00, 0xF1, 0xE0, 0xF0, 0x00, 0xF1, 0xE0, 0x70, 0x00, 0xE1, 0xE0, 0x78,
+    0x01, 0xE3, 0xE0, 0x3E, 0x07, 0x83, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
+    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0x3F, 0xFF, 0xC0, 0x70, 0xFF, 0xFF, 0xF0, 0xF8, 0xFF, 0xFF, 0xF0, 0xF8, 0xFF, 0xFF, 0xF0, 0xF8,
+    0xFF, 0xFF, 0xF0, 0x70, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01,
+    0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x70, 0xFF, 0xFF, 0xFF, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+    0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0xC0, 0x03,
+    0xF0, 0x3F, 0xC0, 0x03, 0xE0, 0x1F, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0xC0, 0x02,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x38, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x1C, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xE0, 0x7E, 0x07, 0xE0, 0xF8, 0x01, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0,
+    0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF8, 0x01, 0xF0, 0x7E, 0x07, 0xE0, 0x7F,
+    0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x1E, 0x07, 0xC0, 0x00, 0x38, 0x01, 0xE0, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x01,
+    0xF0, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFE, 0x07,
+    0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x38, 0x01, 0xE0, 0x00, 0x1E, 0x07,
+    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0x80,
+    0x3F, 0xC3, 0xC0, 0x7F, 0xC3, 0xE0, 0x7F, 0xE3, 0xE0, 0x7F, 0xE3, 0xF0, 0xF9, 0xE1, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x79,
+    0xF0, 0x7C, 0x7F, 0xE0, 0x7C, 0x7F, 0xE0, 0x3C, 0x3F, 0xC0, 0x1C, 0x3F, 0x80, 0x04, 0x0F, 0x00,
+    0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
+    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x00,
+    0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x3F,
+    0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0,
+    0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xF0,
+    0x03, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x07,
+    0xF0, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0x00,
+    0xFF, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x30, 0xF0,
+    0x00, 0xF0, 0xF8, 0x03, 0xF0, 0xFE, 0x07, 0xF0, 0xFF, 0x9F, 0xF0, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF,
+    0x80, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xC0,
+    0xFF, 0x9F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFC, 0x03, 0xF0, 0xF0, 0x00, 0xF0, 0xC0, 0x00, 0x30, 0x80,
+    0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xE0, 0xFF, 0xC0,
+    0x01, 0xE0, 0xFF, 0xF8, 0x01, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0x1F, 0xFF, 0xE7, 0xE0, 0x01, 0xFF,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF0,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x00, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x03, 0xF0, 0xF0, 0x0F, 0xF0, 0xF0, 0x1F,
+    0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0xFF, 0xF0, 0xF1, 0xFE, 0xF0, 0xF7, 0xFC, 0xF0, 0xFF, 0xF0, 0xF0,
+    0xFF, 0xE0, 0xF0, 0xFF, 0xC0, 0xF0, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0xF0, 0xF8, 0x00, 0xF0, 0xF0,
+    0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
+    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00,
+    0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x1F, 0xFF, 0x80, 0xF8,
+    0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00,
+    0x00, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80,
+    0xF8, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0xFC, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x3F, 0xFF, 0x00, 0x7F,
+    0xFF, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07,
+    0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0x0E, 0x3E, 0x7E, 0xFE, 0xF8, 0xF0, 0xF0, 0xF8, 0x7C, 0x3C, 0x1E, 0x1F, 0x0F, 0x0F,
+    0x1F, 0x7F, 0x7E, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
+    0x7F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0xFF, 0xF8, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0xF0,
+    0x00, 0x00, 0xFE, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0xF0, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0xC3, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C, 0x3C, 0xF8, 0xF8, 0xF0, 0xE0,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x3C, 0x03, 0xC0, 0x00, 0x38, 0x03, 0xC0, 0x00, 0x38, 0x03, 0xC0, 0x00, 0x38, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x10, 0x00, 0x00, 0x38, 0x7F, 0x18, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1F, 0x81, 0xF8, 0x1F,
+    0x00, 0xF8, 0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x1E, 0x78, 0x00,
+    0x1E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3C, 0x00, 0x3C,
+    0x3E, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x1F, 0xC1, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x38,
+    0x7E, 0x18, 0x10, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0xF0, 0xFE, 0x00, 0x00,
+    0xF0, 0xFE, 0x00, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07,
+    0xE0, 0x3C, 0x00, 0x00, 0x1F, 0xF0, 0x3E, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0xFC,
+    0x3F, 0x80, 0x00, 0x7F, 0xFC, 0x0F, 0x80, 0x00, 0x78, 0xFE, 0x07, 0xC0, 0x00, 0xF8, 0x7E, 0x07,
+    0xC0, 0x08, 0xF0, 0x3E, 0x03, 0xC0, 0x38, 0xF0, 0x3E, 0x03, 0xC0, 0xF8, 0xF0, 0x3F, 0x03, 0xC0,
+    0xF8, 0xF0, 0x3F, 0x03, 0xC0, 0xF0, 0xF0, 0x1F, 0x03, 0xC0, 0xE0, 0xF8, 0x1F, 0x87, 0xC0, 0x80,
+    0x7C, 0x1F, 0x8F, 0x80, 0x00, 0x7E, 0x0F, 0xFF, 0x80, 0x00, 0x3E, 0x0F, 0xFF, 0x80, 0x00, 0x3E,
+    0x07, 0xFF, 0x00, 0x00, 0x1E, 0x03, 0xFE, 0x00, 0x00, 0x02, 0x00, 0xF8, 0x00, 0x00, 0x07, 0x80,
+    0x00, 0x0F, 0x0F, 0xC0, 0x60, 0x3F, 0xDF, 0xE0, 0x78, 0x7F, 0xFF, 0xF0, 0x7C, 0x7F, 0xFF, 0xF0,
+    0x7C, 0xFF, 0xF9, 0xF8, 0x7E, 0xF9, 0xF0, 0xF8, 0x3E, 0xF0, 0xF8, 0xFC, 0x1E, 0xF0, 0xF8, 0x7C,
+    0x1E, 0xF0, 0x7C, 0x7E, 0x1E, 0xF8, 0x7C, 0x3F, 0x3E, 0xFC, 0x3E, 0x3F, 0xFE, 0x7C, 0x3E, 0x3F,
+    0xFC, 0x7C, 0x1F, 0xFF, 0xFC, 0x3C, 0x1F, 0xF7, 0xF8, 0x0C, 0x0F, 0xF3, 0xE0, 0x00, 0x07, 0xE0,
+    0x00, 0x70, 0xF8, 0xF8, 0xF8, 0x70, 0x00, 0x00, 0x00, 0x70, 0xF8, 0xF8, 0xF8, 0x70, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0x00, 0x00, 0x1F, 0xFC,
+    0x1F, 0x80, 0xC0, 0x1F, 0xFE, 0x1F, 0xC0, 0xE0, 0x3F, 0xFE, 0x07, 0xC0, 0xF8, 0x3C, 0x7F, 0x03,
+    0xE0, 0xFC, 0x7C, 0x3F, 0x03, 0xE0, 0x7E, 0x78, 0x1F, 0x01, 0xE0, 0x1E, 0x78, 0x1F, 0x01, 0xE0,
+    0x1E, 0x78, 0x1F, 0x81, 0xE0, 0x3E, 0x78, 0x1F, 0x81, 0xE0, 0xFC, 0x78, 0x0F, 0x81, 0xE0, 0xF8,
+    0x7C, 0x0F, 0xC3, 0xE0, 0xF0, 0x3E, 0x0F, 0xC7, 0xC0, 0xC0, 0x3F, 0x07, 0xFF, 0xC0, 0x80, 0x1F,
+    0x07, 0xFF, 0xC0, 0x00, 0x1F, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0x01, 0xFF, 0x00, 0x00, 0x03, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x00, 0x1F, 0xF0, 0x3E, 0x00,
+    0x00, 0x3F, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0x80, 0x00, 0x7F, 0xFC, 0x0F, 0x80, 0x00,
+    0x78, 0xFE, 0x07, 0xC0, 0x00, 0xF8, 0x7E, 0x07, 0xC0, 0xC0, 0xF0, 0x3E, 0x03, 0xD0, 0xC0, 0xF0,
+    0x3E, 0x03, 0xF8, 0xC0, 0xF0, 0x3F, 0x03, 0xF9, 0xC0, 0xF0, 0x3F, 0x03, 0xDF, 0x80, 0xF0, 0x1F,
+    0x03, 0xDF, 0x80, 0xF8, 0x1F, 0x87, 0xCF, 0x00, 0x7C, 0x1F, 0x8F, 0x80, 0x00, 0x7E, 0x0F, 0xFF,
+    0x80, 0x00, 0x3E, 0x0F, 0xFF, 0x80, 0x00, 0x3E, 0x07, 0xFF, 0x00, 0x00, 0x1E, 0x03, 0xFE, 0x00,
+    0x00, 0x02, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xC0, 0x78, 0x00, 0x00, 0x00, 0xE0,
+    0x78, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x7C, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x3E, 0x7F, 0xFF, 0xFF, 0xE0, 0x0E, 0x7F, 0xFF, 0xFF, 0xE0, 0x3E, 0x7F, 0xFF,
+    0xFF, 0xE0, 0x7C, 0x7F, 0xFF, 0xFF, 0xE0, 0xF8, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00,
+    0x00, 0xE0, 0x78, 0x00, 0x00, 0x00, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xF0,
+    0x00, 0x3F, 0xC0, 0x00, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xF0, 0x03,
+    0xFF, 0xC0, 0x00, 0xF0, 0x0F, 0xFB, 0xC0, 0x08, 0xF0, 0x1F, 0xF3, 0xC0, 0x38, 0xF0, 0x7F, 0xC3,
+    0xC0, 0xF8, 0xF0, 0xFF, 0x83, 0xC0, 0xF8, 0xF3, 0xFE, 0x03, 0xC0, 0xF0, 0xF7, 0xFC, 0x03, 0xC0,
+    0xE0, 0xFF, 0xF0, 0x03, 0xC0, 0x80, 0xFF, 0xE0, 0x03, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xC0, 0x00,
+    0xFF, 0x00, 0x03, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+    0x00, 0x03, 0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00,
+    0x78, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0xE0, 0x80, 0x78,
+    0x00, 0x1F, 0xE0, 0xC0, 0x78, 0x00, 0x3F, 0xE0, 0xF0, 0x78, 0x00, 0xFF, 0xE0, 0xF8, 0x78, 0x01,
+    0xFF, 0xE0, 0x7C, 0x78, 0x07, 0xFD, 0xE0, 0x3E, 0x78, 0x0F, 0xF9, 0xE0, 0x1E, 0x78, 0x3F, 0xE1,
+    0xE0, 0x1E, 0x78, 0x7F, 0xC1, 0xE0, 0x3E, 0x79, 0xFF, 0x01, 0xE0, 0x7C, 0x7B, 0xFE, 0x01, 0xE0,
+    0xF8, 0x7F, 0xF8, 0x01, 0xE0, 0xF0, 0x7F, 0xF0, 0x01, 0xE0, 0xE0, 0x7F, 0xC0, 0x01, 0xE0, 0xC0,
+    0x7F, 0x80, 0x01, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x78,
+    0x00, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00,
+    0x1F, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xF0, 0x01, 0xFF,
+    0xC0, 0x00, 0xF0, 0x03, 0xFF, 0xC0, 0x70, 0xF0, 0x0F, 0xFB, 0xC0, 0xF8, 0xF0, 0x1F, 0xF3, 0xC0,
+    0xF8, 0xF0, 0x7F, 0xC3, 0xC0, 0xF8, 0xF0, 0xFF, 0x83, 0xC0, 0xF8, 0xF3, 0xFE, 0x03, 0xC0, 0x70,
+    0xF7, 0xFC, 0x03, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xC0, 0x00, 0xFF,
+    0x80, 0x03, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00,
+    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x3F, 0xE0, 0x7F, 0xF0, 0x7F, 0xF0, 0xF8,
+    0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0C, 0x3F, 0xC0, 0x00, 0x3C, 0x3F, 0xE0, 0x00, 0x7C, 0x7F, 0xF0,
+    0x00, 0x7C, 0x7F, 0xF0, 0x00, 0x7C, 0x79, 0xF0, 0x00, 0xF8, 0xF0, 0xF0, 0x00, 0xF0, 0xE0, 0xF0,
+    0x00, 0xF0, 0xE0, 0xF0, 0x00, 0xF0, 0xE0, 0xE0, 0x00, 0xF0, 0xE1, 0xE0, 0x00, 0xF8, 0xE3, 0xCF,
+    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF9,
+    0xE0, 0x0F, 0xFF, 0xF1, 0xE0, 0x1F, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7F, 0xC0, 0x63, 0xC0, 0x63,
+    0xC0, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x08,
+    0x38, 0xF8, 0xF8, 0xF0, 0xC0, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0x80, 0x00, 0x3F,
+    0xC3, 0xC0, 0x00, 0x7F, 0xC3, 0xE0, 0x00, 0x7F, 0xE3, 0xE0, 0x00, 0x7F, 0xE3, 0xF0, 0x00, 0xF9,
+    0xE1, 0xF0, 0x08, 0xF0, 0xF0, 0xF0, 0x38, 0xF0, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0xF0, 0xF8, 0xF0,
+    0xF0, 0xF0, 0xF8, 0xF0, 0xF0, 0xF0, 0xE0, 0xF8, 0x79, 0xF0, 0xC0, 0x7C, 0x7F, 0xE0, 0x80, 0x7C,
+    0x7F, 0xE0, 0x00, 0x3C, 0x3F, 0xC0, 0x00, 0x1C, 0x3F, 0x80, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x80,
+    0xE0, 0xF0, 0xF8, 0x7C, 0x3C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0xC0, 0x80, 0x01, 0x80, 0x01, 0x80,
+    0xF1, 0x80, 0xF3, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x81, 0xC0, 0x80, 0x1F, 0xE1, 0xE0, 0xC0, 0x3F, 0xE1, 0xF0, 0xE0, 0x3F, 0xF1, 0xF0, 0xF8, 0x3F,
+    0xF1, 0xF8, 0x7C, 0x7C, 0xF0, 0xF8, 0x3E, 0x78, 0x78, 0x78, 0x1E, 0x78, 0x78, 0x78, 0x0E, 0x78,
+    0x78, 0x78, 0x3E, 0x78, 0x78, 0x78, 0x7E, 0x78, 0x78, 0x78, 0xFC, 0x7C, 0x3C, 0xF8, 0xF0, 0x3E,
+    0x3F, 0xF0, 0xE0, 0x3E, 0x3F, 0xF0, 0xC0, 0x1E, 0x1F, 0xE0, 0x80, 0x0E, 0x1F, 0xC0, 0x00, 0x02,
+    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0x80, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x7F, 0xC3,
+    0xE0, 0x00, 0x7F, 0xE3, 0xE0, 0x00, 0xFF, 0xE3, 0xF0, 0x00, 0xF9, 0xE1, 0xF0, 0x30, 0xF0, 0xF0,
+    0xF4, 0x30, 0xF0, 0xF0, 0xFE, 0x30, 0xF0, 0xF0, 0xFE, 0x70, 0xF0, 0xF0, 0xF7, 0xE0, 0xF0, 0xF0,
+    0xF7, 0xE0, 0xF8, 0x79, 0xF3, 0xC0, 0x7C, 0x7F, 0xE0, 0x00, 0x7C, 0x7F, 0xE0, 0x00, 0x3C, 0x3F,
+    0xC0, 0x00, 0x1C, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
+    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0xFE, 0x78, 0x00, 0x78, 0xFE, 0x78, 0x00, 0x78, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x01, 0xE0,
+    0x07, 0xE0, 0x01, 0xE0, 0x1F, 0xE0, 0x01, 0xE0, 0x3F, 0xE0, 0x01, 0xE0, 0xFF, 0xE0, 0x09, 0xE1,
+    0xFF, 0xE0, 0x39, 0xE3, 0xFD, 0xE0, 0xF9, 0xEF, 0xF9, 0xE0, 0xF9, 0xFF, 0xE1, 0xE0, 0xF1, 0xFF,
+    0xC1, 0xE0, 0xE1, 0xFF, 0x81, 0xE0, 0x81, 0xFE, 0x01, 0xE0, 0x01, 0xFC, 0x01, 0xE0, 0x01, 0xF0,
+    0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x18, 0x38, 0xF8, 0xF8, 0xE0, 0xC0, 0x88, 0x18, 0x38,
+    0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0xF0, 0x00, 0xF0, 0x80, 0xF0, 0x01, 0xF0, 0xC0, 0xF0, 0x03,
+    0xF0, 0xE0, 0xF0, 0x0F, 0xF0, 0xF0, 0xF0, 0x1F, 0xF0, 0xFC, 0xF0, 0x7F, 0xF0, 0x7C, 0xF0, 0xFF,
+    0xF0, 0x1C, 0xF1, 0xFE, 0xF0, 0x1C, 0xF7, 0xFC, 0xF0, 0x7C, 0xFF, 0xF0, 0xF0, 0xF8, 0xFF, 0xE0,
+    0xF0, 0xF0, 0xFF, 0xC0, 0xF0, 0xE0, 0xFF, 0x00, 0xF0, 0xC0, 0xFE, 0x00, 0xF0, 0x80, 0xF8, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x03,
+    0xF0, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xF0, 0x1F, 0xF0, 0x70, 0xF0, 0x7F, 0xF0, 0xF8, 0xF0, 0xFF,
+    0xF0, 0xF8, 0xF1, 0xFE, 0xF0, 0xF8, 0xF7, 0xFC, 0xF0, 0xF8, 0xFF, 0xF0, 0xF0, 0x70, 0xFF, 0xE0,
+    0xF0, 0x00, 0xFF, 0xC0, 0xF0, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0xF0, 0x00, 0xF8, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0,
+    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x08, 0xF0, 0x0F, 0x00, 0x00, 0x38, 0xF0, 0x0F,
+    0x00, 0x00, 0xF8, 0xF0, 0x0F, 0x80, 0x00, 0xF8, 0xF0, 0x0F, 0xE0, 0x00, 0xF0, 0xF0, 0x0F, 0xF8,
+    0x00, 0xE0, 0xF8, 0x1F, 0xFC, 0x00, 0xC0, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
+    0x00, 0x7F, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xFC, 0x1F, 0xC0, 0x00, 0x1F, 0xF8, 0x07, 0xC0, 0x00,
+    0x07, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
+    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
+    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0xF0, 0x00, 0x08, 0xFF, 0xC0, 0xF0, 0x00,
+    0x38, 0xFE, 0x00, 0xF0, 0x00, 0xF8, 0xFE, 0x00, 0xF0, 0x00, 0xF8, 0xFF, 0xC0, 0xF0, 0x00, 0xF0,
+    0xFF, 0xF8, 0xF0, 0x00, 0xE0, 0xFF, 0xFF, 0xF0, 0x00, 0x80, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0,
+    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x02,
+    0x00, 0x3F, 0xFF, 0xE0, 0x0E, 0x01, 0xFF, 0xFF, 0x00, 0x1E, 0x0F, 0xFF, 0xF8, 0x00, 0x3E, 0x7F,
+    0xFF, 0xF8, 0x00, 0x7C, 0x7F, 0xFC, 0x78, 0x00, 0xF8, 0x7F, 0xE0, 0x78, 0x00, 0xF0, 0x7F, 0x00,
+    0x78, 0x00, 0xF0, 0x7F, 0x00, 0x78, 0x00, 0xF8, 0x7F, 0xE0, 0x78, 0x00, 0x7C, 0x7F, 0xFC, 0x78,
+    0x00, 0x3E, 0x7F, 0xFF, 0xF8, 0x00, 0x1E, 0x0F, 0xFF, 0xF8, 0x00, 0x0E, 0x01, 0xFF, 0xFE, 0x00,
+    0x02, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
+    0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
+    0xC0, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0xE0, 0x0F, 0xFF, 0xF0, 0x00, 0xF0, 0x7F, 0xFF, 0xF0, 0x00,
+    0xF8, 0xFF, 0xFC, 0xF0, 0x00, 0x78, 0xFF, 0xC0, 0xF0, 0x00, 0x38, 0xFE, 0x00, 0xF0, 0x00, 0x38,
+    0xFE, 0x00, 0xF0, 0x00, 0x78, 0xFF, 0xC0, 0xF0, 0x00, 0xF8, 0xFF, 0xF8, 0xF0, 0x00, 0xF0, 0x7F,
+    0xFF, 0xF0, 0x00, 0xE0, 0x0F, 0xFF, 0xF0, 0x00, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
+    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x70, 0x03,
+    0xFF, 0xFF, 0x00, 0xF8, 0x0F, 0xFF, 0xF8, 0x00, 0xF8, 0x7F, 0xFF, 0xF0, 0x00, 0xF8, 0xFF, 0xFC,
+    0xF0, 0x00, 0x70, 0xFF, 0xE0, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0xF0,
+    0x00, 0x70, 0xFF, 0xE0, 0xF0, 0x00, 0xF8, 0xFF, 0xFC, 0xF0, 0x00, 0xF8, 0x7F, 0xFF, 0xF0, 0x00,
+    0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x70, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
+    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x18, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
+    0x03, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00,
+    0x00, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
+    0xF8, 0x00, 0x07, 0xC0, 0x18, 0xF8, 0x00, 0x07, 0xC0, 0x78, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0xF8,
+    0x00, 0x07, 0xC0, 0xF8, 0xF8, 0x00, 0x07, 0xC0, 0xE0, 0xFC, 0x00, 0x0F, 0xC0, 0xC0, 0x7C, 0x00,
+    0x0F, 0x80, 0x80, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x3F, 0x80, 0x7F,
+    0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x78, 0x00,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07,
+    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
+    0xFF, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F,
+    0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0xC0, 0xF8, 0x00, 0x07, 0xD0, 0xC0, 0xF8, 0x00, 0x07, 0xF8,
+    0xC0, 0xF8, 0x00, 0x07, 0xF9, 0xC0, 0xF8, 0x00, 0x07, 0xDF, 0x80, 0xF8, 0x00, 0x07, 0xDF, 0x80,
+    0xFC, 0x00, 0x0F, 0xCF, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0x80, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0F, 0x80,
+    0x78, 0x00, 0x00, 0x03, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF,
+    0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0x80, 0x80, 0x1F, 0xC0, 0x3F, 0x80, 0xE0, 0x3F, 0x00, 0x0F, 0xC0, 0xF0, 0x3E, 0x00, 0x07, 0xC0,
+    0xF8, 0x7E, 0x00, 0x07, 0xE0, 0x7E, 0x7C, 0x00, 0x03, 0xE0, 0x3E, 0x7C, 0x00, 0x03, 0xE0, 0x0E,
+    0x7C, 0x00, 0x03, 0xE0, 0x3E, 0x7C, 0x00, 0x03, 0xE0, 0x7E, 0x7C, 0x00, 0x03, 0xE0, 0xF8, 0x7C,
+    0x00, 0x07, 0xE0, 0xF0, 0x7E, 0x00, 0x07, 0xC0, 0xE0, 0x3F, 0x00, 0x1F, 0xC0, 0xC0, 0x3F, 0x80,
+    0x7F, 0x80, 0x00, 0x1F, 0x80, 0x7F, 0x80, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x00, 0x0F, 0x80, 0x7E,
+    0x00, 0x00, 0x03, 0x80, 0x78, 0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x18, 0xF0,
+    0x1E, 0x03, 0xC0, 0x78, 0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0xF0, 0x1E,
+    0x03, 0xC0, 0xE0, 0xF0, 0x1E, 0x03, 0xC0, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x80, 0xF0, 0x1E, 0x03,
+    0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0,
+    0x00, 0xF0, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x1E,
+    0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03,
+    0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xDF,
+    0x00, 0xF0, 0x1E, 0x03, 0xFF, 0x80, 0xF0, 0x1E, 0x03, 0xFF, 0xC0, 0xF0, 0x1E, 0x03, 0xFF, 0xC0,
+    0xF0, 0x1E, 0x03, 0xE3, 0xC0, 0xF0, 0x1E, 0x03, 0xE3, 0xC0, 0xF0, 0x00, 0x03, 0xC3, 0x80, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x70, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0xF0, 0x1E, 0x03, 0xC0, 0x70, 0xF0, 0x1E,
+    0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03,
+    0xC0, 0x70, 0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0xF0, 0x1E, 0x03, 0xC0,
+    0xF8, 0xF0, 0x1E, 0x03, 0xC0, 0x70, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00,
+    0xF0, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x80, 0x7F,
+    0xFF, 0xFF, 0xE0, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF0, 0x7F, 0xFF,
+    0xFF, 0xE0, 0xF8, 0x78, 0x0F, 0x01, 0xE0, 0x7E, 0x78, 0x0F, 0x01, 0xE0, 0x1E, 0x78, 0x0F, 0x01,
+    0xE0, 0x0E, 0x78, 0x0F, 0x01, 0xE0, 0x3E, 0x78, 0x0F, 0x01, 0xE0, 0x7E, 0x78, 0x0F, 0x01, 0xE0,
+    0xF8, 0x78, 0x0F, 0x01, 0xE0, 0xF0, 0x78, 0x0F, 0x01, 0xE0, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0xC0,
+    0x78, 0x0F, 0x01, 0xE0, 0x80, 0x78, 0x0F, 0x01, 0xE0, 0x00, 0x78, 0x0F, 0x01, 0xE0, 0x00, 0x78,
+    0x00, 0x01, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x18, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x7F, 0xFF, 0xFF, 0xE0, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7C, 0x7F, 0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xE0, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0,
+    0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0x7C, 0x7C, 0x00, 0x03, 0xE0, 0x3E, 0x7C, 0x00, 0x03, 0xE0, 0x1E,
+    0x7C, 0x00, 0x03, 0xE0, 0x1E, 0x7C, 0x00, 0x03, 0xE0, 0x3E, 0x7C, 0x00, 0x03, 0xE0, 0x7C, 0x7C,
+    0x00, 0x03, 0xE0, 0xF8, 0x7C, 0x00, 0x03, 0xE0, 0xF0, 0x7C, 0x00, 0x03, 0xE0, 0xE0, 0x3E, 0x00,
+    0x07, 0xC0, 0xC0, 0x3F, 0x00, 0x07, 0xC0, 0x80, 0x3F, 0x80, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F,
+    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
+    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C,
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x1C,
+    0x07, 0xC0, 0xF8, 0x1C, 0x07, 0xC0, 0xF8, 0x1C, 0x07, 0xC0, 0xF8, 0x1C, 0x07, 0xC0, 0xF8, 0x00,
+    0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0x7C, 0x00,
+    0x0F, 0x80, 0x7E, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x00, 0x3F, 0xFF,
+    0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x18,
+    0x01, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x7F, 0x80, 0x00, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00,
+    0x1F, 0xF0, 0x00, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0xC0,
+    0x7F, 0xFF, 0xFF, 0xE0, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0xF8, 0x07,
+    0xFC, 0x00, 0x00, 0x7E, 0x01, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0x00, 0x0E, 0x00, 0x3F,
+    0xC0, 0x00, 0x3E, 0x00, 0x1F, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xFC,
+    0x00, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0,
+    0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
+    0xFF, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0F,
+    0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x08, 0xF8, 0x00, 0x07, 0xC0, 0x38, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0xF8, 0x00, 0x07, 0xC0, 0xF0, 0xF8, 0x00, 0x07, 0xC0, 0xE0,
+    0xFC, 0x00, 0x0F, 0xC0, 0xC0, 0x7E, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0xC0, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0,
+    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x04, 0x1F, 0xE0, 0x7F, 0x80, 0x0C, 0x3F, 0x80, 0x1F, 0xC0, 0x1C,
+    0x3E, 0x00, 0x0F, 0xC0, 0x7C, 0x7E, 0x00, 0x07, 0xE0, 0xFC, 0x7C, 0x00, 0x03, 0xE0, 0xF8, 0x7C,
+    0x00, 0x03, 0xE0, 0xE0, 0x7C, 0x00, 0x03, 0xE0, 0xE0, 0x7C, 0x00, 0x03, 0xE0, 0xF8, 0x7C, 0x00,
+    0x03, 0xE0, 0xFC, 0x7C, 0x00, 0x03, 0xE0, 0x3C, 0x7E, 0x00, 0x07, 0xE0, 0x1C, 0x3F, 0x00, 0x07,
+    0xC0, 0x0C, 0x3F, 0x80, 0x1F, 0xC0, 0x04, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
+    0xFF, 0x00, 0x08, 0x7F, 0x00, 0x3F, 0x80, 0x18, 0x7C, 0x00, 0x1F, 0x80, 0x38, 0xFC, 0x00, 0x0F,
+    0xC0, 0xF8, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0xF8, 0x00, 0x07, 0xC0, 0xE0, 0xF8, 0x00, 0x07, 0xC0,
+    0xC0, 0xF8, 0x00, 0x07, 0xC0, 0x88, 0xF8, 0x00, 0x07, 0xC0, 0x18, 0xF8, 0x00, 0x07, 0xC0, 0x38,
+    0xFC, 0x00, 0x0F, 0xC0, 0x78, 0x7E, 0x00, 0x0F, 0x80, 0xF8, 0x7F, 0x00, 0x3F, 0x80, 0xE0, 0x3F,
+    0xC0, 0xFF, 0x00, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x70, 0x7F, 0x00, 0x3F, 0x80, 0xF8,
+    0x7C, 0x00, 0x1F, 0x80, 0xF8, 0xFC, 0x00, 0x0F, 0xC0, 0xF8, 0xF8, 0x00, 0x07, 0xC0, 0x70, 0xF8,
+    0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x70, 0xF8, 0x00,
+    0x07, 0xC0, 0xF8, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0xFC, 0x00, 0x0F, 0xC0, 0xF8, 0x7E, 0x00, 0x0F,
+    0x80, 0x70, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x10, 0x01, 0x00, 0x38, 0x03, 0x80, 0x7C, 0x07, 0xC0, 0xFE, 0x0F, 0xE0,
+    0x7F, 0x1F, 0xC0, 0x3F, 0xBF, 0x80, 0x1F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x03,
+    0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xBF, 0x80, 0x7F, 0x1F,
+    0xC0, 0xFE, 0x0F, 0xE0, 0x7C, 0x07, 0xC0, 0x38, 0x03, 0x80, 0x10, 0x01, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0xC0, 0x7F, 0xFF, 0xFF,
+    0xE0, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF8, 0x78, 0x07, 0x80, 0x00, 0x7C, 0x78, 0x07, 0x80, 0x00,
+    0x3E, 0x78, 0x07, 0x80, 0x00, 0x1E, 0x78, 0x07, 0x80, 0x00, 0x1E, 0x78, 0x07, 0xC0, 0x00, 0x3E,
+    0x78, 0x07, 0xF0, 0x00, 0x7C, 0x78, 0x07, 0xFC, 0x00, 0xF8, 0x7C, 0x0F, 0xFE, 0x00, 0xF0, 0x7E,
+    0x1F, 0xFF, 0x80, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0xC0, 0x3F, 0xFF, 0x3F, 0xE0, 0x00, 0x1F, 0xFE,
+    0x0F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
+    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
+    0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0xE7, 0x00,
+    0x00, 0x01, 0xF0, 0xC3, 0x00, 0x00, 0x01, 0xF0, 0xE7, 0x00, 0x00, 0x01, 0xF0, 0x7E, 0x00, 0x00,
+    0x01, 0xF0, 0x3C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F,
+    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x18, 0x00, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x00, 0x07,
+    0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
+    0xC0, 0x00, 0x00, 0x0F, 0x80, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x08, 0x00, 0x00, 0x3F,
+    0x80, 0x38, 0x00, 0x00, 0x0F, 0x80, 0x78, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0,
+    0xF0, 0x00, 0x00, 0x07, 0xC0, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x88,
+    0x00, 0x00, 0x07, 0xC0, 0x18, 0x00, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00,
+    0x00, 0x3F, 0x80, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0xF8,
+    0x00, 0x00, 0x0F, 0xC0, 0x70, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x70, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
+    0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x70, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x18, 0x00, 0x7F, 0xFF, 0xC0, 0x78, 0x00, 0x1F, 0xFF,
+    0xC0, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0xE0, 0x07, 0xFF, 0x00, 0x00,
+    0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xF9, 0xC0, 0xFF, 0xFF, 0xFF, 0xDF, 0x80, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x00,
+    0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0x3E, 0x03,
+    0xC0, 0xFC, 0x7E, 0x03, 0xC0, 0x7F, 0xFF, 0x07, 0xC0, 0x7F, 0xFF, 0x8F, 0xC0, 0x3F, 0xF7, 0xFF,
+    0x80, 0x1F, 0xE7, 0xFF, 0x80, 0x0F, 0xC7, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFC,
+    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
+    0xE0, 0x19, 0xFF, 0xFF, 0xE0, 0x78, 0x3C, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF0, 0x00,
+    0x00, 0xE1, 0xF0, 0x00, 0x00, 0xC1, 0xF0, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0C, 0x3F, 0xC0, 0x00, 0x3C, 0x3F, 0xE0, 0x00, 0x7C, 0x7F,
+    0xF0, 0x00, 0x7C, 0x7F, 0xF0, 0x00, 0x7C, 0x79, 0xF0, 0x00, 0xF8, 0xF0, 0xF0, 0x08, 0xF0, 0xE0,
+    0xF0, 0x38, 0xF0, 0xE0, 0xF0, 0xF8, 0xF0, 0xE0, 0xE0, 0xF8, 0xF0, 0xE1, 0xE0, 0xF0, 0xF8, 0xE3,
+    0xC0, 0xE0, 0x7F, 0xFF, 0xF0, 0x80, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+    0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x06, 0x1F, 0xE0, 0x02, 0x1E, 0x1F,
+    0xF0, 0x06, 0x3E, 0x3F, 0xF8, 0x0E, 0x3E, 0x3F, 0xF8, 0x3E, 0x3E, 0x3C, 0xF8, 0x7E, 0x7C, 0x78,
+    0x78, 0xF8, 0x78, 0x70, 0x78, 0xF0, 0x78, 0x70, 0x78, 0xF0, 0x78, 0x70, 0x70, 0xF8, 0x78, 0x70,
+    0xF0, 0x7C, 0x7C, 0x71, 0xE0, 0x3E, 0x3F, 0xFF, 0xF8, 0x1E, 0x3F, 0xFF, 0xF8, 0x0E, 0x1F, 0xFF,
+    0xF8, 0x02, 0x1F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0C, 0x3F,
+    0xC0, 0x00, 0x3C, 0x3F, 0xE0, 0xE0, 0x7C, 0x7F, 0xF0, 0xF0, 0x7C, 0x7F, 0xF0, 0xF8, 0x7C, 0x79,
+    0xF0, 0xFC, 0xF8, 0xF0, 0xF0, 0x3C, 0xF0, 0xE0, 0xF0, 0x1C, 0xF0, 0xE0, 0xF0, 0x1C, 0xF0, 0xE0,
+    0xE0, 0x1C, 0xF0, 0xE1, 0xE0, 0x3C, 0xF8, 0xE3, 0xC0, 0xF8, 0x7F, 0xFF, 0xF0, 0xF8, 0x7F, 0xFF,
+    0xF0, 0xF0, 0x3F, 0xFF, 0xF0, 0xE0, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x0C, 0x3F, 0xC0, 0x00, 0x3C, 0x3F, 0xE0, 0x70, 0x3C, 0x7F, 0xF0, 0xF8, 0x7C, 0x7F,
+    0xF0, 0xF8, 0x7C, 0x79, 0xF0, 0xF8, 0xF8, 0xF0, 0xF0, 0x70, 0xF0, 0xE0, 0xF0, 0x00, 0xF0, 0xE0,
+    0xF0, 0x00, 0xF0, 0xE0, 0xE0, 0x00, 0xF0, 0xE1, 0xE0, 0x70, 0xF8, 0xE3, 0xC0, 0xF8, 0x7F, 0xFF,
+    0xF0, 0xF8, 0x7F, 0xFF, 0xF0, 0xF8, 0x3F, 0xFF, 0xF0, 0x70, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x18, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7E, 0x07,
+    0xE0, 0x00, 0xF8, 0x01, 0xF0, 0x08, 0xF0, 0x00, 0xF0, 0x38, 0xF0, 0x00, 0xF0, 0xF8, 0xF0, 0x00,
+    0xF0, 0xF8, 0xF0, 0x00, 0xF0, 0xF0, 0xF8, 0x01, 0xF0, 0xE0, 0xFC, 0x03, 0xF0, 0xC0, 0x7E, 0x07,
+    0xE0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x06, 0x06,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0,
+    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xF8, 0x01, 0xF0, 0x30, 0xF0, 0x00, 0xF0,
+    0x30, 0xF0, 0x00, 0xFE, 0x30, 0xF0, 0x00, 0xFE, 0x70, 0xF0, 0x00, 0xF7, 0xE0, 0xF8, 0x01, 0xF7,
+    0xE0, 0xFC, 0x03, 0xF3, 0xC0, 0x7E, 0x07, 0xE0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x3E, 0x07, 0xC0,
+    0x00, 0x1E, 0x07, 0x80, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x1F, 0xFF, 0x80, 0xC0, 0x3F, 0xFF, 0xC0, 0xE0, 0x7F, 0xFF, 0xE0, 0xF0, 0x7E, 0x07,
+    0xE0, 0xF8, 0xF8, 0x01, 0xF0, 0x7C, 0xF0, 0x00, 0xF0, 0x3C, 0xF0, 0x00, 0xF0, 0x1C, 0xF0, 0x00,
+    0xF0, 0x3C, 0xF0, 0x00, 0xF0, 0xFC, 0xF8, 0x01, 0xF0, 0xF8, 0xFC, 0x03, 0xF0, 0xE0, 0x7E, 0x0F,
+    0xE0, 0xC0, 0x7E, 0x0F, 0xE0, 0x80, 0x3E, 0x0F, 0xC0, 0x00, 0x1E, 0x0F, 0x80, 0x00, 0x0E, 0x0E,
+    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7D, 0xE3, 0xE0, 0x00, 0xF9, 0xE1, 0xF0, 0x08, 0xF1, 0xE0,
+    0xF0, 0x38, 0xF1, 0xE0, 0xF0, 0xF8, 0xF1, 0xE0, 0xF0, 0xF8, 0xF1, 0xE0, 0xF0, 0xF0, 0xF9, 0xE1,
+    0xF0, 0xC0, 0x7D, 0xE1, 0xF0, 0x80, 0x7F, 0xE3, 0xE0, 0x00, 0x3F, 0xE3, 0xE0, 0x00, 0x3F, 0xE3,
+    0xC0, 0x00, 0x0F, 0xE3, 0x80, 0x00, 0x03, 0xE2, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7D, 0xE3, 0xE0,
+    0x00, 0xF9, 0xE1, 0xF0, 0x00, 0xF1, 0xE0, 0xFF, 0x80, 0xF1, 0xE0, 0xFF, 0xC0, 0xF1, 0xE0, 0xFF,
+    0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0xF9, 0xE1, 0xF1, 0xE0, 0x7D, 0xE1, 0xF1, 0xE0, 0x7F, 0xE3, 0xE1,
+    0xC0, 0x3F, 0xE3, 0xE0, 0x00, 0x3F, 0xE3, 0xC0, 0x00, 0x0F, 0xE3, 0x80, 0x00, 0x03, 0xE2, 0x00,
+    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x70, 0x3F, 0xFF,
+    0xC0, 0xF8, 0x7F, 0xFF, 0xE0, 0xF8, 0x7D, 0xE3, 0xE0, 0xF8, 0xF9, 0xE1, 0xF0, 0x70, 0xF1, 0xE0,
+    0xF0, 0x00, 0xF1, 0xE0, 0xF0, 0x00, 0xF1, 0xE0, 0xF0, 0x00, 0xF1, 0xE0, 0xF0, 0x70, 0xF9, 0xE1,
+    0xF0, 0xF8, 0x7D, 0xE1, 0xF0, 0xF8, 0x7F, 0xE3, 0xE0, 0xF8, 0x3F, 0xE3, 0xE0, 0x70, 0x3F, 0xE3,
+    0xC0, 0x00, 0x0F, 0xE3, 0x80, 0x00, 0x03, 0xE2, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF,
+    0x80, 0x80, 0x0F, 0xFF, 0xC0, 0xC0, 0x1F, 0xFF, 0xE0, 0xF0, 0x3F, 0xFF, 0xF0, 0xF8, 0x3E, 0xF1,
+    0xF0, 0x7C, 0x7C, 0xF0, 0xF8, 0x3E, 0x78, 0xF0, 0x78, 0x1E, 0x78, 0xF0, 0x78, 0x1E, 0x78, 0xF0,
+    0x78, 0x3E, 0x78, 0xF0, 0x78, 0xFC, 0x7C, 0xF0, 0xF8, 0xF8, 0x3E, 0xF0, 0xF8, 0xF0, 0x3F, 0xF1,
+    0xF0, 0xC0, 0x1F, 0xF1, 0xF0, 0x80, 0x1F, 0xF1, 0xE0, 0x00, 0x07, 0xF1, 0xC0, 0x00, 0x01, 0xF1,
+    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x19, 0xFF, 0xFF, 0xE0, 0x79, 0xFF, 0xFF, 0xE0, 0xF9, 0xFF, 0xFF,
+    0xE0, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xFC, 0xFF, 0xFF, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0xF8, 0x01,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x78, 0x01, 0xC0, 0x00, 0x3E, 0x07, 0x80, 0x3F, 0xFF, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xF8, 0x1F,
+    0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x73, 0xC0, 0x03, 0xC0, 0x73, 0xC0, 0x03,
+    0xC0, 0x73, 0xC0, 0x03, 0xC0, 0x71, 0xC0, 0x03, 0x80, 0x71, 0xE0, 0x07, 0x00, 0x70, 0xF8, 0x1E,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
+    0xE0, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x39, 0xE0, 0x00,
+    0x00, 0xF9, 0xE0, 0x00, 0x00, 0xF9, 0xE0, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0xE1, 0xF8, 0x00,
+    0x00, 0xC1, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x80, 0xFF, 0xFF,
+    0xF0, 0xC0, 0xFF, 0xFF, 0xF0, 0xE0, 0xFF, 0xFF, 0xF0, 0xF8, 0x1C, 0x00, 0x00, 0xFC, 0x78, 0x00,
+    0x00, 0x3C, 0x70, 0x00, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x7C, 0xF0, 0x00,
+    0x00, 0xFC, 0xF8, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xF0, 0xC0, 0x7F, 0xFF,
+    0xF0, 0x80, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
+    0xE0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x18, 0xF0, 0x00,
+    0xF0, 0x78, 0xF0, 0x00, 0xF0, 0xF8, 0xF0, 0x00, 0xF0, 0xF8, 0xF0, 0x00, 0xF0, 0xF0, 0xF8, 0x01,
+    0xF0, 0xC0, 0x7E, 0x07, 0xE0, 0x80, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF,
+    0x80, 0x02, 0x0F, 0xFF, 0xC0, 0x06, 0x1F, 0xFF, 0xE0, 0x0E, 0x3F, 0xFF, 0xF0, 0x1E, 0x3F, 0x03,
+    0xF0, 0x7E, 0x7C, 0x00, 0xF8, 0xFC, 0x78, 0x00, 0x78, 0xF0, 0x78, 0x00, 0x78, 0xE0, 0x78, 0x00,
+    0x78, 0xF0, 0x78, 0x00, 0x78, 0xFC, 0x78, 0x00, 0x78, 0x7E, 0x7C, 0x00, 0xF8, 0x1E, 0x3F, 0x03,
+    0xF0, 0x0E, 0x3F, 0xFF, 0xF0, 0x06, 0x1F, 0xFF, 0xE0, 0x02, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+    0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x08, 0x7F, 0xFF, 0xE0, 0x38, 0x7E, 0x07, 0xE0, 0x78, 0xF8, 0x01,
+    0xF0, 0xF8, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xE0, 0xF0, 0x00, 0xF0, 0xC0, 0xF0, 0x00,
+    0xF0, 0x88, 0xF0, 0x00, 0xF0, 0x18, 0xF8, 0x01, 0xF0, 0x78, 0x7E, 0x07, 0xE0, 0xF8, 0x7F, 0xFF,
+    0xE0, 0xF0, 0x3F, 0xFF, 0xC0, 0xE0, 0x1F, 0xFF, 0x80, 0xC0, 0x0F, 0xFF, 0x00, 0x80, 0x03, 0xFC,
+    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x70, 0x3F, 0xFF,
+    0xC0, 0xF8, 0x7F, 0xFF, 0xE0, 0xF8, 0x7E, 0x07, 0xE0, 0xF8, 0xF8, 0x01, 0xF0, 0x70, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x70, 0xF0, 0x00,
+    0xF0, 0xF8, 0xF8, 0x01, 0xF0, 0xF8, 0x7E, 0x07, 0xE0, 0xF8, 0x7F, 0xFF, 0xE0, 0x70, 0x3F, 0xFF,
+    0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x78,
+    0xF1, 0xE0, 0xFC, 0xF3, 0xF0, 0xFC, 0xF3, 0xF0, 0xFC, 0xF3, 0xF0, 0xFC, 0xF3, 0xF0, 0x78, 0xF1,
+    0xE0, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0xF0, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xF0, 0xE0, 0xFF, 0xFF, 0xF0, 0xF8,
+    0xFF, 0xFF, 0xF0, 0xFC, 0xFF, 0xFF, 0xF0, 0x3C, 0xFF, 0xFF, 0xF0, 0x1C, 0x1E, 0x00, 0x00, 0x3C,
+    0x7C, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0xE0,
+    0xF8, 0x00, 0x00, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+    0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x3C,
+    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x7C, 0xE7, 0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00, 0x3C, 0xC3,
+    0x00, 0x00, 0x3C, 0xE7, 0x00, 0x00, 0x38, 0x7E, 0x00, 0x00, 0x70, 0x3C, 0x00, 0x00, 0xE0, 0x00,
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
+    0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
+    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x08,
+    0x00, 0x00, 0xF0, 0x38, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0xE0, 0xF0,
+    0x00, 0x01, 0xC0, 0xE0, 0x00, 0x03, 0x80, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x01,
+    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x09, 0xFF, 0xFF, 0xC0, 0x19, 0xFF, 0xFF, 0xE0, 0x38,
+    0x00, 0x07, 0xE0, 0xF8, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xE0, 0x00, 0x01, 0xE0, 0xC0,
+    0x00, 0x01, 0xE0, 0x88, 0x00, 0x01, 0xC0, 0x18, 0x00, 0x03, 0x80, 0x38, 0x00, 0x07, 0x00, 0x79,
+    0xFF, 0xFF, 0xE0, 0xF9, 0xFF, 0xFF, 0xE0, 0xE1, 0xFF, 0xFF, 0xE0, 0xC1, 0xFF, 0xFF, 0xE0, 0x81,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFF, 0xFF, 0xE0, 0x70, 0xFF, 0xFF, 0xE0, 0xF8, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0x03, 0xF0, 0xF8,
+    0x00, 0x01, 0xF0, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x70,
+    0x00, 0x00, 0xE0, 0xF8, 0x00, 0x01, 0xC0, 0xF8, 0x00, 0x03, 0x80, 0xF8, 0xFF, 0xFF, 0xF0, 0x70,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xE0, 0x00, 0xFF,
+    0xC0, 0x01, 0xE0, 0x00, 0xFF, 0xF8, 0x01, 0xE0, 0x00, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x1F, 0xFF,
+    0xE7, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x08, 0x00, 0x3F, 0xFF, 0xC0, 0x78, 0x00, 0x03, 0xFF,
+    0xC0, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0xF0, 0x07, 0xFF, 0xF8, 0x00,
+    0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x80, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x81, 0x80, 0xFF, 0xFF, 0xFF, 0xE1, 0x80, 0x07, 0x80, 0x0F, 0xF1, 0x80,
+    0x07, 0x80, 0x0F, 0xF3, 0x80, 0x07, 0x80, 0x0F, 0xBF, 0x00, 0x07, 0x80, 0x0F, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0x00, 0x70, 0xF8, 0xF8, 0xF8, 0xF8, 0x70,
+};
+static const uint32_t InterTight_Bold18pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 25, 51, 139, 239, 339, 431, 441, 486, 531, 561,
+    615, 629, 641, 647, 699, 783, 827, 899, 975, 1063, 1139, 1219,
+    1291, 1371, 1451, 1469, 1497, 1551, 1585, 1639, 1707, 1872, 1972, 2052,
+    2144, 2232, 2304, 2372, 2464, 2552, 2572, 2640, 2724, 2792, 2904, 2988,
+    3084, 3160, 3256, 3336, 3416, 3500, 3584, 3684, 3828, 3924, 4016, 4096,
+    4141, 4193, 4238, 4268, 4285, 4292, 4343, 4419, 4473, 4549, 4603, 4655,
+    4731, 4803, 4823, 4863, 4935, 4955, 5039, 5093, 5150, 5226, 5302, 5338,
+    5392, 5440, 5494, 5554, 5641, 5698, 5778, 5826, 5891, 5921, 5986, 6005,
+    6005, 6006, 6131, 6144, 6224, 6293, 6361, 6461, 6529, 6542, 6642, 6742,
+    6847, 6947, 6959, 7059, 7159, 7185, 7253, 7267, 7311, 7318, 7366, 7438,
+    7452, 7466, 7538, 7610, 7670, 7734, 7749, 7813, 7877, 7977, 8102, 8227,
+    8352, 8477, 8562, 8677, 8792, 8907, 8997, 9087, 9177, 9267, 9307, 9372,
+    9482, 9586, 9691, 9796, 9916, 10036, 10156, 10276, 10333, 10433, 10538, 10643,
+    10748, 10853, 10968, 11073, 11153, 11201, 11269, 11337, 11405, 11473, 11513, 11585,
+    11657, 11729, 11801, 11873, 11945, 12017, 12049, 12101, 12201, 12285, 12357, 12429,
+    12505, 12581, 12657, 12733, 12787, 12843, 12915, 12987, 13063, 13135, 13235, 13300,
+};
+
+// InterTightBold22pt8bfr.h
+static const uint8_t InterTight_Bold22pt8b_Atlas[] PROGMEM = {
+    0x00, 0xFF, 0xFF, 0xF8, 0x1C, 0xFF, 0xFF, 0xF8, 0x3E, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x3E, 0xFF, 0xFF, 0xF8, 0x1C, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x1F, 0x00, 0xF8, 0x1F, 0xFF, 0x00,
+    0xF9, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x1F, 0x00, 0xFF, 0xF8, 0x1F, 0x00, 0xC0, 0xF8, 0x1F, 0x00, 0x00,
+    0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x0F, 0x00, 0xF8, 0x1F, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFE, 0x1F, 0x00, 0xFF, 0xF8, 0x1F, 0x00, 0xE0, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x1E, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x80, 0x3E,
+    0x00, 0x00, 0x7F, 0xC0, 0x3F, 0x80, 0x01, 0xFF, 0xE0, 0x3F, 0xC0, 0x01, 0xFF, 0xF0, 0x3F, 0xC0,
+    0x03, 0xFF, 0xF8, 0x3F, 0xE0, 0x07, 0xFF, 0xF8, 0x3F, 0xE0, 0x07, 0xFF, 0xFC, 0x07, 0xE0, 0x07,
+    0xE3, 0xFC, 0x03, 0xF0, 0x0F, 0xC1, 0xFC, 0x03, 0xF0, 0x0F, 0x80, 0xFE, 0x01, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0x7F,
+    0x01, 0xF0, 0x0F, 0xC0, 0x7F, 0x03, 0xF0, 0x0F, 0xC0, 0x7F, 0x83, 0xF0, 0x07, 0xF0, 0x3F, 0x87,
+    0xE0, 0x07, 0xF8, 0x3F, 0xFF, 0xE0, 0x07, 0xF8, 0x3F, 0xFF, 0xE0, 0x03, 0xF8, 0x1F, 0xFF, 0xC0,
+    0x01, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0xF8, 0x0F, 0xFF, 0x80, 0x00, 0x78, 0x03, 0xFF, 0x00, 0x00,
+    0x08, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFE,
+    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x00, 0x03, 0x80, 0xF8, 0x1F, 0x00,
+    0x0F, 0x80, 0xF0, 0x0F, 0x00, 0x3F, 0x80, 0xF0, 0x0F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x01, 0xFC,
+    0x00, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x7F, 0xFE, 0x0F, 0xE0, 0x00, 0x7F, 0xFE, 0x1F, 0x80, 0x00,
+    0x3F, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
+    0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0x3F, 0x0F, 0xFF, 0x00, 0x00, 0xFE,
+    0x1F, 0xFF, 0x80, 0x01, 0xF8, 0x1F, 0xFF, 0x80, 0x07, 0xF0, 0x3E, 0x07, 0xC0, 0x1F, 0xC0, 0x3C,
+    0x03, 0xC0, 0x3F, 0x00, 0x3C, 0x03, 0xC0, 0x7E, 0x00, 0x3C, 0x03, 0xC0, 0x78, 0x00, 0x3E, 0x07,
+    0xC0, 0x70, 0x00, 0x3F, 0xFF, 0xC0, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+    0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x07, 0xE0, 0x7F, 0xFC, 0x1F, 0xF8, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x3F,
+    0xF0, 0x1F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x1F, 0xF8, 0x3F, 0xFE, 0x1F, 0xFC, 0x7F,
+    0xFF, 0x1F, 0x7F, 0xFE, 0x7F, 0xBE, 0x7F, 0xFC, 0x3F, 0xFE, 0x3F, 0xF8, 0x1F, 0xFE, 0x1F, 0xF0,
+    0x0F, 0xFC, 0x07, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
+    0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xDF, 0x00, 0x00, 0x7F, 0x0F, 0x00, 0x00, 0x7C, 0x07, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,
+    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0xFC,
+    0x00, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00,
+    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC0, 0x00,
+    0x03, 0xFE, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0x00, 0x00, 0x0E, 0x1C, 0x00,
+    0x1F, 0x1E, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0xBC, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x07, 0xF8,
+    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x0E, 0x1C, 0x00, 0x02, 0x10, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0xF8, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0x80, 0xFC, 0x00,
+    0xC0, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0x38, 0x7C, 0xFE, 0xFE, 0xFE, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x03,
+    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xE0, 0x07, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
+    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0xFE, 0x7F,
+    0xE0, 0x07, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x07,
+    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0x00, 0x1F, 0x07,
+    0xC0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x7F, 0x3F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0x7F,
+    0xC0, 0x01, 0xFF, 0x7F, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8,
+    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xDF, 0xF8, 0x00, 0xFF, 0x9F, 0xF8,
+    0x01, 0xFF, 0x1F, 0xFC, 0x03, 0xFE, 0x1F, 0xFE, 0x0F, 0xFC, 0x1F, 0x7F, 0xFF, 0xF8, 0x1F, 0x7F,
+    0xFF, 0xF0, 0x1F, 0x3F, 0xFF, 0xE0, 0x1F, 0x3F, 0xFF, 0x80, 0x1F, 0x1F, 0xFF, 0x00, 0x1F, 0x07,
+    0xFE, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0x1F, 0x03, 0x80, 0x01, 0xC0, 0x0F, 0x80, 0x01, 0xF0, 0x1F,
+    0x80, 0x01, 0xF8, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x7F, 0x80, 0x01, 0xFE, 0x7F,
+    0x80, 0x01, 0xFE, 0x7E, 0x00, 0x00, 0x7E, 0xFC, 0x07, 0xC0, 0x3F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8,
+    0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xFC,
+    0x0F, 0xE0, 0x3F, 0xFE, 0x1F, 0xE0, 0x3F, 0x7F, 0xFF, 0xF8, 0x7E, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFE, 0xFF, 0xFE, 0x3F, 0xFC, 0xFF, 0xFC, 0x1F, 0xFC, 0x7F, 0xF8, 0x0F, 0xF8, 0x7F, 0xF8, 0x03,
+    0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+    0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xF7, 0xC0, 0x01, 0xFF, 0xC7, 0xC0, 0x03, 0xFF, 0x07, 0xC0, 0x0F,
+    0xFC, 0x07, 0xC0, 0x3F, 0xF8, 0x07, 0xC0, 0x7F, 0xE0, 0x07, 0xC0, 0xFF, 0x80, 0x07, 0xC0, 0xFF,
+    0x00, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x01, 0xC0, 0x00, 0xFF, 0x81, 0xF0, 0xFF, 0xFF, 0x81, 0xF8, 0xFF, 0xFF, 0xC1, 0xFC, 0xFF,
+    0xFF, 0xC1, 0xFC, 0xFF, 0xFF, 0xC1, 0xFE, 0xFF, 0xFF, 0xC1, 0xFE, 0xFF, 0xF3, 0xC0, 0x7F, 0xF8,
+    0x07, 0x80, 0x3F, 0xF8, 0x0F, 0x00, 0x1F, 0xF8, 0x0F, 0x00, 0x1F, 0xF8, 0x1F, 0x00, 0x1F, 0xF8,
+    0x1F, 0x00, 0x1F, 0xF8, 0x1F, 0x80, 0x3F, 0xF8, 0x1F, 0x80, 0x3F, 0xF8, 0x1F, 0xE0, 0xFE, 0xF8,
+    0x1F, 0xFF, 0xFE, 0xF8, 0x0F, 0xFF, 0xFE, 0xF8, 0x0F, 0xFF, 0xFC, 0xF8, 0x07, 0xFF, 0xF8, 0xF8,
+    0x03, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xE1, 0xFF, 0xFE, 0x7F, 0x03, 0xC0, 0x7E, 0xFC,
+    0x07, 0x80, 0x3F, 0xFC, 0x0F, 0x80, 0x3F, 0xF8, 0x0F, 0x00, 0x1F, 0xF8, 0x1F, 0x00, 0x1F, 0xF8,
+    0x1F, 0x00, 0x1F, 0xF8, 0x1F, 0x00, 0x1F, 0xFC, 0x1F, 0x80, 0x3F, 0xFE, 0x1F, 0xC0, 0x7F, 0x7F,
+    0x9F, 0xE0, 0xFE, 0x7F, 0x8F, 0xFF, 0xFE, 0x3F, 0x8F, 0xFF, 0xFC, 0x3F, 0x8F, 0xFF, 0xFC, 0x1F,
+    0x87, 0xFF, 0xF8, 0x0F, 0x83, 0xFF, 0xF0, 0x07, 0x81, 0xFF, 0xE0, 0x00, 0x80, 0x3F, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF8,
+    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0xF8, 0x01, 0xFF, 0xF8, 0xF8, 0x07, 0xFF, 0xE0, 0xF8,
+    0x3F, 0xFF, 0x80, 0xF8, 0xFF, 0xFE, 0x00, 0xFB, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x1F, 0xF0, 0x0F,
+    0xF8, 0x7F, 0xF8, 0x1F, 0xFC, 0x7F, 0xFC, 0x3F, 0xFC, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF0, 0x7E, 0xFE, 0x1F, 0xE0, 0x3F, 0xFC, 0x0F, 0xE0, 0x3F, 0xF8,
+    0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8,
+    0x07, 0xE0, 0x3F, 0xFC, 0x0F, 0xE0, 0x3F, 0xFE, 0x1F, 0xF8, 0x7E, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFE, 0xFF, 0xFE, 0x3F, 0xFC, 0xFF, 0xFC, 0x3F, 0xFC, 0x7F, 0xFC, 0x1F, 0xF8, 0x7F, 0xF8, 0x0F,
+    0xF0, 0x1F, 0xF0, 0x03, 0xE0, 0x0F, 0xC0, 0x01, 0xFC, 0x01, 0x00, 0x07, 0xFF, 0x81, 0xE0, 0x0F,
+    0xFF, 0xC1, 0xF0, 0x1F, 0xFF, 0xE1, 0xF8, 0x3F, 0xFF, 0xF1, 0xFC, 0x3F, 0xFF, 0xF1, 0xFE, 0x7F,
+    0xFF, 0xF9, 0xFE, 0x7F, 0x07, 0xF9, 0xFE, 0xFE, 0x03, 0xF8, 0x7F, 0xFC, 0x01, 0xF8, 0x3F, 0xF8,
+    0x00, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x1F, 0xF8, 0x00, 0xF0, 0x1F, 0xFC,
+    0x01, 0xF0, 0x3F, 0xFC, 0x01, 0xE0, 0x7E, 0x7E, 0x03, 0xC0, 0xFE, 0x7F, 0xFF, 0x87, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x07,
+    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x7C, 0x00,
+    0x7C, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0x7C, 0x00, 0x7C, 0x38, 0x00, 0x38,
+    0x00, 0x00, 0x00, 0xFE, 0x38, 0x00, 0x3F, 0xFE, 0x7C, 0x00, 0x3F, 0xFE, 0xFE, 0x00, 0x3F, 0xFE,
+    0xFE, 0x00, 0x3F, 0xF8, 0xFE, 0x00, 0x3F, 0x80, 0x7C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xF7, 0xC0, 0x00,
+    0x03, 0xF7, 0xE0, 0x00, 0x07, 0xE3, 0xE0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x07, 0xC3, 0xF0, 0x00,
+    0x0F, 0xC1, 0xF8, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00,
+    0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x3F, 0x00,
+    0x7E, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E,
+    0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E,
+    0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E,
+    0xF8, 0x3E, 0xFE, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x3F, 0x00,
+    0x7E, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1F, 0x81,
+    0xF8, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x07, 0xE3,
+    0xF0, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x01, 0xFF,
+    0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x1C, 0xFE, 0x00, 0x7C, 0x3E, 0xFC, 0x01, 0xFC, 0x7F, 0xF8, 0x03,
+    0xFC, 0x7F, 0xF8, 0x07, 0xFC, 0x7F, 0xF8, 0x07, 0xFC, 0x3E, 0xFC, 0x0F, 0xE0, 0x1C, 0xFE, 0x1F,
+    0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0,
+    0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0xFE, 0x00, 0x3F, 0x81, 0xFF, 0xE0, 0x7E, 0x00,
+    0x3F, 0x07, 0xFF, 0xF8, 0x7F, 0x00, 0x7E, 0x0F, 0xFF, 0xFC, 0x3F, 0x00, 0x7E, 0x0F, 0xFF, 0xFE,
+    0x1F, 0x00, 0x7C, 0x1F, 0xC0, 0xFE, 0x1F, 0x00, 0xFC, 0x1F, 0x80, 0x7F, 0x1F, 0x80, 0xF8, 0x3F,
+    0x00, 0x3F, 0x0F, 0x80, 0xF8, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0xF8, 0x3E, 0x00, 0x1F, 0x0F, 0x80,
+    0xF8, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0xF8, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0xF8, 0x3E, 0x00, 0x1F,
+    0x0F, 0x80, 0xF8, 0x3F, 0x00, 0x3E, 0x0F, 0x80, 0xF8, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0xF8, 0x0F,
+    0xC0, 0xFC, 0x0F, 0x80, 0xFC, 0x3F, 0xFF, 0xF8, 0x0F, 0x80, 0x7C, 0x3F, 0xFF, 0xFC, 0x1F, 0x00,
+    0x7C, 0x3F, 0xFF, 0xFE, 0x1F, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x3E, 0x3F, 0xFF, 0xFF,
+    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x06, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xC0,
+    0x00, 0x1F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0x0F, 0x80, 0xFF, 0xF8, 0x0F, 0x80, 0xFF, 0xC0, 0x0F, 0x80, 0xFF, 0x00, 0x0F, 0x80, 0xFF, 0xC0,
+    0x0F, 0x80, 0xFF, 0xF8, 0x0F, 0x80, 0xFF, 0xFF, 0x0F, 0x80, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0xFF,
+    0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x03,
+    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07,
+    0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07, 0xC0, 0x1F, 0xF8, 0x07,
+    0xC0, 0x1F, 0xFC, 0x0F, 0xE0, 0x1F, 0xFE, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xFD, 0xFF, 0xFE, 0x3F, 0xFC, 0xFF, 0xFE, 0x3F, 0xF8, 0xFF, 0xFC, 0x1F, 0xF0,
+    0x7F, 0xF8, 0x07, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x0F, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x00,
+    0x00, 0xFE, 0x7E, 0x00, 0x00, 0x7E, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0xC0,
+    0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xE0, 0x07, 0xF8, 0x1F, 0xE0, 0x07, 0xF8, 0x0F, 0xE0,
+    0x07, 0xF0, 0x07, 0xE0, 0x07, 0xC0, 0x01, 0xE0, 0x07, 0x80, 0x00, 0x00, 0x04, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0x7E, 0x00,
+    0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7F, 0x80, 0x01, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xFF,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03,
+    0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03,
+    0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03,
+    0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01,
+    0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01,
+    0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01,
+    0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01,
+    0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xFF, 0xFC, 0x3F, 0xF0, 0x0F, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7E, 0x00,
+    0x00, 0x7E, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x3F, 0xFC, 0x01, 0xF0, 0x3F, 0xFC, 0x01, 0xF0, 0x3F, 0xFC, 0x01, 0xF0, 0x3F, 0xFE, 0x01,
+    0xF0, 0x7F, 0x7F, 0x01, 0xF0, 0x7F, 0x7F, 0x81, 0xF0, 0xFE, 0x7F, 0xE1, 0xF3, 0xFE, 0x3F, 0xE1,
+    0xFF, 0xFC, 0x3F, 0xE1, 0xFF, 0xFC, 0x1F, 0xE1, 0xFF, 0xF8, 0x0F, 0xE1, 0xFF, 0xF0, 0x07, 0xE1,
+    0xFF, 0xE0, 0x01, 0xE1, 0xFF, 0x80, 0x00, 0x21, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
+    0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
+    0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFD, 0xFF, 0xE0, 0x1F, 0xF8, 0xFF, 0xF0, 0x3F, 0xE0, 0x3F, 0xFC, 0xFF, 0xC0,
+    0x1F, 0xFE, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+    0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01,
+    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
+    0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0,
+    0x0F, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x00, 0x7E, 0xFE, 0x00,
+    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0x7E, 0x00,
+    0x00, 0x7E, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xF0, 0x0F, 0xFC, 0x3F, 0xFF,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0xF8, 0x00,
+    0x7C, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0xF8, 0x00,
+    0x7C, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xFF,
+    0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+    0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x0F,
+    0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+    0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x04, 0x3F, 0x00,
+    0xFC, 0x00, 0x06, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0xFC,
+    0x00, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x7E, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0x00,
+    0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF7, 0xC0, 0x07, 0xFF, 0xFF, 0xE3,
+    0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xF0,
+    0xFF, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF,
+    0x3F, 0xFF, 0xE0, 0xFF, 0x1F, 0xFF, 0xC0, 0x3F, 0x07, 0xFF, 0x00, 0x1F, 0x01, 0xFC, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xF8, 0x03, 0xE0, 0x07, 0xFC, 0x03, 0xF8,
+    0x1F, 0xFE, 0x03, 0xFC, 0x1F, 0xFF, 0x03, 0xFC, 0x3F, 0xFF, 0x83, 0xFE, 0x7F, 0xFF, 0x83, 0xFE,
+    0x7F, 0xFF, 0xC0, 0x7E, 0x7E, 0x3F, 0xC0, 0x3F, 0xFC, 0x1F, 0xC0, 0x3F, 0xF8, 0x0F, 0xE0, 0x1F,
+    0xF8, 0x0F, 0xE0, 0x1F, 0xF8, 0x0F, 0xE0, 0x1F, 0xF8, 0x07, 0xE0, 0x1F, 0xF8, 0x07, 0xF0, 0x1F,
+    0xFC, 0x07, 0xF0, 0x3F, 0xFC, 0x07, 0xF8, 0x3F, 0x7F, 0x03, 0xF8, 0x7E, 0x7F, 0x83, 0xFF, 0xFE,
+    0x7F, 0x83, 0xFF, 0xFE, 0x3F, 0x81, 0xFF, 0xFC, 0x1F, 0x80, 0xFF, 0xFC, 0x0F, 0x80, 0xFF, 0xF8,
+    0x07, 0x80, 0x3F, 0xF0, 0x00, 0x80, 0x1F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFE,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
+    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
+    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0,
+    0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
+    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x00,
+    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
+    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE,
+    0x3F, 0xFE, 0x7F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80,
+    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x03, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x7F, 0xF8, 0x7F, 0xFC, 0x3F, 0xFE,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+    0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xF0, 0x00,
+    0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
+    0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+    0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
+    0xF8, 0x03, 0xFF, 0x9F, 0xF8, 0x07, 0xFF, 0x1F, 0xF8, 0x1F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF8, 0x1F,
+    0xF8, 0xFF, 0xE0, 0x1F, 0xF9, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x1F,
+    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8,
+    0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00,
+    0x00, 0x00, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00,
+    0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x3C,
+    0x00, 0xFC, 0x07, 0xFC, 0x1F, 0xFC, 0x7F, 0xF0, 0xFF, 0x80, 0xFE, 0x00, 0xF8, 0x00, 0xFE, 0x00,
+    0xFF, 0x80, 0x7F, 0xF0, 0x1F, 0xFC, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x0C, 0x00, 0x00,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0xFC, 0x7C, 0x1C, 0x04, 0x00, 0x03,
+    0xF0, 0x06, 0x07, 0xFC, 0x0E, 0x0F, 0xFE, 0x3E, 0x1F, 0xFE, 0x3E, 0x1F, 0xFF, 0x7E, 0x1F, 0xFF,
+    0x7F, 0x3F, 0xFF, 0xFC, 0x3E, 0x3F, 0xF8, 0x3C, 0x1F, 0xF8, 0x3C, 0x1F, 0xF8, 0x3C, 0x1E, 0xF8,
+    0x38, 0x1E, 0xF8, 0x38, 0x3C, 0xFC, 0x78, 0x78, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0xF8, 0x00, 0x3C, 0x00,
+    0x7C, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x1E, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0xF8, 0x00,
+    0x1F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0x01,
+    0xFE, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+    0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7F, 0x7F, 0x81, 0xFE, 0x7F, 0x81, 0xFE, 0x3F,
+    0x81, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0x81, 0xF0, 0x03, 0x81, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00,
+    0x07, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
+    0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x7F, 0x00,
+    0xFC, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x78, 0x00, 0x1E, 0x00,
+    0x78, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0,
+    0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0x78, 0xFE, 0xFC,
+    0x78, 0x3F, 0xF8, 0x78, 0x3F, 0xF8, 0x78, 0x1F, 0xF8, 0x78, 0x1F, 0xF8, 0x78, 0x1F, 0xF8, 0x78,
+    0x1F, 0xFC, 0x78, 0x3F, 0x7E, 0x78, 0x7E, 0x7F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFC,
+    0x1F, 0xF8, 0xF8, 0x07, 0xF8, 0xF0, 0x01, 0xF8, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFC, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0xF8,
+    0x7C, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x30, 0x00, 0x1F, 0xFF, 0xF8, 0x3C, 0x00, 0x3F, 0xFF, 0xFC,
+    0x3E, 0x00, 0x3F, 0xFF, 0xFE, 0x3E, 0x00, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0xFF, 0x80, 0xFF, 0x1F, 0x80, 0xFE, 0x00, 0x3F, 0x0F, 0x80, 0xFC, 0x00, 0x3F, 0x0F, 0x80,
+    0xF8, 0x00, 0x1F, 0x0F, 0x80, 0xF8, 0x00, 0x1F, 0x0F, 0x80, 0x78, 0x00, 0x1E, 0x0F, 0x80, 0x7C,
+    0x00, 0x3E, 0x0F, 0x80, 0x3E, 0x00, 0x3C, 0x1F, 0x80, 0x1F, 0x80, 0xF8, 0x3F, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x78, 0x7F, 0xFF, 0xFF, 0x80, 0x78, 0x7F,
+    0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF,
+    0xFF, 0x80, 0x78, 0x7F, 0xFF, 0xFF, 0x80, 0x70, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xC0, 0x78, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x78, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x70, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x1F,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xCF, 0xFE, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0xFF,
+    0x01, 0xFF, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0xC0,
+    0x00, 0x07, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF,
+    0xFF, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
+    0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0x00, 0xFE, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8,
+    0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x7F, 0x00,
+    0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0,
+    0x07, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00,
+    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x1F,
+    0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
+    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x07,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
+    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
+    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00,
+    0xF8, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x3C,
+    0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0xC0, 0xF0, 0x1F,
+    0xE0, 0xF8, 0x3F, 0xF0, 0xFC, 0x7F, 0xF8, 0xFE, 0x7F, 0xF8, 0xFE, 0x7F, 0xF8, 0xFE, 0xFF, 0xFC,
+    0x7F, 0xFC, 0xFC, 0x3F, 0xF8, 0x7C, 0x1F, 0xF8, 0x7C, 0x1F, 0xF8, 0x3C, 0x1F, 0xF8, 0x3E, 0x1F,
+    0xF8, 0x3E, 0x1F, 0xFC, 0x3F, 0x3F, 0x7E, 0x3F, 0xFE, 0x7E, 0x1F, 0xFE, 0x7E, 0x1F, 0xFE, 0x3E,
+    0x1F, 0xFC, 0x1E, 0x0F, 0xFC, 0x0E, 0x07, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x03, 0xE0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0x7C, 0x03,
+    0xE0, 0x00, 0x7C, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF,
+    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
+    0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00,
+    0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0xF8,
+    0x00, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0x00,
+    0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x03,
+    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0x07, 0xFF,
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x00,
+    0xFE, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xF8,
+    0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE0,
+    0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0xFF, 0xE7, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0xFF, 0xFC,
+    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0x80, 0xFF, 0xC0, 0x00, 0x1F, 0x80, 0xFF,
+    0xF8, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0xE0, 0x0F, 0x80, 0x3F, 0xFF,
+    0xFC, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF8,
+    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xF8,
+    0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF9, 0xFF,
+    0x9F, 0xFB, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x1F,
+    0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xEF,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xEF, 0xFF, 0xF8, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 0xFF, 0xC7, 0xFF,
+    0xFC, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7E,
+    0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00,
+    0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0xFE, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 0xFF, 0xC7, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xEF, 0xFF, 0xF8, 0x1F, 0xFF, 0xEF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x1F, 0x80, 0x3F, 0x80, 0x7F,
+    0x80, 0xFF, 0x80, 0xFC, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x3F,
+    0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x7F, 0xC0, 0x7F,
+    0x80, 0x7F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0xFF, 0xFF, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0x80,
+    0x00, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xF8,
+    0x0F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0x80, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x7F, 0x87, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x87, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0x07, 0x00, 0xE0, 0xF8, 0xFC, 0xFC, 0xFE, 0x1E, 0x0E, 0x0E, 0x0E, 0x1E, 0xFE, 0xFC, 0xFC, 0xF8,
+    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0x00,
+    0x1F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x1F, 0x10, 0x00, 0x00, 0x00, 0x38, 0x1F, 0xC0, 0xC0, 0x7C, 0xFF, 0xF9, 0xE0, 0x7F, 0xFF, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x0F, 0xC0, 0x1F, 0x00, 0x07,
+    0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x01, 0xE0, 0x7C, 0x00, 0x01, 0xF0, 0x78, 0x00, 0x00,
+    0xF0, 0x78, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00,
+    0xF0, 0x78, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x01, 0xE0, 0x3E, 0x00, 0x03,
+    0xE0, 0x1F, 0x00, 0x07, 0xC0, 0x1F, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF,
+    0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7C, 0xFF, 0xF9, 0xE0, 0x38, 0x1F, 0xC0, 0xC0, 0x10, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x00, 0x00,
+    0x0F, 0x80, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF0,
+    0x00, 0x00, 0x03, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+    0x81, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC1, 0xFF, 0x00, 0x00,
+    0x3F, 0xFF, 0xE0, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0xE0, 0x1F, 0x80, 0x00, 0x7E, 0x0F, 0xE0, 0x1F,
+    0x80, 0x04, 0x7C, 0x07, 0xF0, 0x0F, 0x80, 0x1C, 0x7C, 0x07, 0xF0, 0x0F, 0x80, 0x7C, 0x7C, 0x07,
+    0xF0, 0x0F, 0x80, 0xFC, 0x7C, 0x03, 0xF0, 0x0F, 0x80, 0xFC, 0x7C, 0x03, 0xF8, 0x0F, 0x80, 0xF8,
+    0x7E, 0x03, 0xF8, 0x1F, 0x80, 0xE0, 0x7E, 0x03, 0xFC, 0x1F, 0x80, 0xC0, 0x3F, 0x81, 0xFC, 0x3F,
+    0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xC0,
+    0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xC0, 0x7F, 0xFC, 0x00, 0x00,
+    0x03, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x07, 0xC1, 0xFC, 0x03, 0x80, 0x1F, 0xF3, 0xFE, 0x03, 0xE0, 0x3F, 0xFF, 0xFF, 0x03, 0xF0, 0x7F,
+    0xFF, 0xFF, 0x83, 0xF0, 0x7F, 0xFF, 0x1F, 0x83, 0xF8, 0xFF, 0xFF, 0x0F, 0xC3, 0xF8, 0xFC, 0x7F,
+    0x0F, 0xC0, 0xFC, 0xF8, 0x3F, 0x07, 0xC0, 0xFC, 0xF8, 0x3F, 0x87, 0xE0, 0x7C, 0xF8, 0x1F, 0x87,
+    0xE0, 0x7C, 0xF8, 0x1F, 0xC3, 0xF0, 0x7C, 0xFC, 0x0F, 0xC3, 0xF0, 0x7C, 0x7F, 0x0F, 0xE1, 0xF8,
+    0xFC, 0x7F, 0x0F, 0xE3, 0xFF, 0xF8, 0x7F, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0x07, 0xFF, 0xFF, 0xF8,
+    0x1F, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0xFE, 0x0F, 0x80, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0x78, 0x78, 0xFC, 0xFC, 0xFC, 0x78, 0x70, 0x00, 0x00, 0x78, 0x78, 0xFC,
+    0xFC, 0xFC, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0x00, 0x80, 0x07, 0xFF, 0xC0,
+    0xFF, 0x00, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF, 0x80, 0xE0, 0x1F, 0xFF, 0xE0, 0xFF, 0x80, 0xF0, 0x1F,
+    0xFF, 0xF0, 0x1F, 0x80, 0xF8, 0x1F, 0x8F, 0xF0, 0x0F, 0xC0, 0xFE, 0x3F, 0x07, 0xF0, 0x0F, 0xC0,
+    0x7E, 0x3E, 0x03, 0xF8, 0x07, 0xC0, 0x1E, 0x3E, 0x03, 0xF8, 0x07, 0xC0, 0x0E, 0x3E, 0x03, 0xF8,
+    0x07, 0xC0, 0x1E, 0x3E, 0x01, 0xF8, 0x07, 0xC0, 0x7E, 0x3E, 0x01, 0xFC, 0x07, 0xC0, 0xFE, 0x3F,
+    0x01, 0xFC, 0x0F, 0xC0, 0xFC, 0x3F, 0x01, 0xFE, 0x0F, 0xC0, 0xF0, 0x1F, 0xC0, 0xFE, 0x1F, 0x80,
+    0xE0, 0x1F, 0xE0, 0xFF, 0xFF, 0x80, 0xC0, 0x1F, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x0F, 0xE0, 0x7F,
+    0xFF, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xFE, 0x00, 0x00, 0x01,
+    0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x20, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+    0x01, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFC,
+    0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
+    0x83, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0xC0, 0x3F, 0x00, 0x00,
+    0xFC, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0xE0, 0x1F, 0x01, 0xC0, 0xF8, 0x0F, 0xE0, 0x1F,
+    0xE1, 0xC0, 0xF8, 0x0F, 0xE0, 0x1F, 0xE1, 0xC0, 0xF8, 0x07, 0xE0, 0x1F, 0xF3, 0xC0, 0xF8, 0x07,
+    0xF0, 0x1F, 0x7F, 0x80, 0xFC, 0x07, 0xF0, 0x3F, 0x7F, 0x80, 0xFC, 0x07, 0xF8, 0x3F, 0x3F, 0x00,
+    0x7E, 0x03, 0xF8, 0x7E, 0x1E, 0x00, 0x7F, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0xFE,
+    0x00, 0x00, 0x3F, 0x81, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80,
+    0xFF, 0xF8, 0x00, 0x00, 0x07, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x1F, 0xC0, 0x00, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7E, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x07, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7C,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xFF, 0x80,
+    0x00, 0x7C, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFF, 0xCF, 0x80, 0x0C, 0x7C, 0x03, 0xFF, 0x8F, 0x80, 0x3C, 0x7C,
+    0x0F, 0xFE, 0x0F, 0x80, 0xFC, 0x7C, 0x1F, 0xFC, 0x0F, 0x80, 0xFC, 0x7C, 0x7F, 0xF0, 0x0F, 0x80,
+    0xFC, 0x7C, 0xFF, 0xE0, 0x0F, 0x80, 0xF0, 0x7F, 0xFF, 0x80, 0x0F, 0x80, 0xE0, 0x7F, 0xFF, 0x00,
+    0x0F, 0x80, 0x80, 0x7F, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x7F,
+    0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xC0, 0x80, 0x3E, 0x00, 0x00,
+    0x7F, 0xC0, 0xC0, 0x3E, 0x00, 0x00, 0xFF, 0xC0, 0xE0, 0x3E, 0x00, 0x03, 0xFF, 0xC0, 0xF0, 0x3E,
+    0x00, 0x07, 0xFF, 0xC0, 0xF8, 0x3E, 0x00, 0x1F, 0xFF, 0xC0, 0xFC, 0x3E, 0x00, 0x3F, 0xFF, 0xC0,
+    0x7E, 0x3E, 0x00, 0xFF, 0xE7, 0xC0, 0x3F, 0x3E, 0x01, 0xFF, 0xC7, 0xC0, 0x0F, 0x3E, 0x07, 0xFF,
+    0x07, 0xC0, 0x0F, 0x3E, 0x0F, 0xFE, 0x07, 0xC0, 0x3F, 0x3E, 0x3F, 0xF8, 0x07, 0xC0, 0x7F, 0x3E,
+    0x7F, 0xF0, 0x07, 0xC0, 0xFC, 0x3F, 0xFF, 0xC0, 0x07, 0xC0, 0xF8, 0x3F, 0xFF, 0x80, 0x07, 0xC0,
+    0xF0, 0x3F, 0xFE, 0x00, 0x07, 0xC0, 0xE0, 0x3F, 0xFC, 0x00, 0x07, 0xC0, 0xC0, 0x3F, 0xF0, 0x00,
+    0x07, 0xC0, 0x80, 0x3F, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x3F,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80,
+    0x00, 0x7C, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7C, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7C,
+    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0x80,
+    0x78, 0x7C, 0x00, 0xFF, 0xEF, 0x80, 0x78, 0x7C, 0x03, 0xFF, 0x8F, 0x80, 0xFC, 0x7C, 0x07, 0xFF,
+    0x0F, 0x80, 0xFC, 0x7C, 0x1F, 0xFC, 0x0F, 0x80, 0xFC, 0x7C, 0x3F, 0xF8, 0x0F, 0x80, 0x78, 0x7C,
+    0xFF, 0xE0, 0x0F, 0x80, 0x70, 0x7D, 0xFF, 0xC0, 0x0F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0x80,
+    0x00, 0x7F, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xF0, 0x00,
+    0x0F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7E,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x1F, 0xF0, 0x3F, 0xF8,
+    0x7F, 0xFC, 0x7C, 0x7C, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0x7C, 0x7C,
+    0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x06, 0x07, 0xFC, 0x00,
+    0x0E, 0x0F, 0xFE, 0x00, 0x3E, 0x1F, 0xFE, 0x00, 0x3E, 0x1F, 0xFF, 0x00, 0x7E, 0x1F, 0xFF, 0x00,
+    0x7F, 0x3F, 0xFF, 0x00, 0xFC, 0x3E, 0x3F, 0x00, 0xF8, 0x3C, 0x1F, 0x00, 0xF8, 0x3C, 0x1F, 0x00,
+    0xF8, 0x3C, 0x1E, 0x00, 0xF8, 0x38, 0x1E, 0x00, 0xF8, 0x38, 0x3C, 0x30, 0xFC, 0x78, 0x78, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0x8F, 0x07, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0xE0, 0x7F, 0xE0, 0x71, 0xE0, 0x61, 0xE0, 0x21, 0xE0,
+    0x00, 0x40, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x04, 0x1C, 0xFC, 0xFC, 0xFC, 0xF0, 0xE0, 0xC0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x78, 0x00, 0x00,
+    0x0F, 0xF0, 0x7C, 0x00, 0x00, 0x1F, 0xF8, 0x7E, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0x00, 0x00, 0x3F,
+    0xFC, 0x7F, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0x00, 0x00, 0x7F, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x7E,
+    0x1F, 0x80, 0x04, 0x7C, 0x3E, 0x0F, 0x80, 0x1C, 0x7C, 0x3E, 0x0F, 0x80, 0x7C, 0x7C, 0x1E, 0x0F,
+    0x80, 0xFC, 0x7C, 0x1F, 0x0F, 0x80, 0xFC, 0x7C, 0x1F, 0x0F, 0x80, 0xF8, 0x7E, 0x1F, 0x9F, 0x80,
+    0xE0, 0x3F, 0x1F, 0xFF, 0x00, 0xC0, 0x3F, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x0F, 0xFF, 0x00, 0x00,
+    0x1F, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0x07, 0xFE, 0x00, 0x00, 0x07, 0x03, 0xFC, 0x00, 0x00, 0x00,
+    0x01, 0xF0, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7E, 0x1E, 0x0E, 0x3E, 0x7E, 0xFC, 0xF8,
+    0xF0, 0xE0, 0xC0, 0x80, 0x01, 0xC0, 0x61, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0xFF, 0x80, 0x3F, 0x80,
+    0x3F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x07,
+    0xF8, 0x3E, 0x00, 0x80, 0x0F, 0xFC, 0x3F, 0x00, 0xC0, 0x1F, 0xFE, 0x3F, 0x80, 0xE0, 0x1F, 0xFE,
+    0x3F, 0x80, 0xF0, 0x1F, 0xFE, 0x3F, 0x80, 0xF8, 0x3F, 0xFF, 0x1F, 0xC0, 0xFC, 0x3F, 0x3F, 0x0F,
+    0xC0, 0x7E, 0x3E, 0x1F, 0x07, 0xC0, 0x1E, 0x3E, 0x1F, 0x07, 0xC0, 0x0E, 0x3E, 0x0F, 0x07, 0xC0,
+    0x3E, 0x3E, 0x0F, 0x87, 0xC0, 0x7E, 0x3E, 0x0F, 0x87, 0xC0, 0xFC, 0x3F, 0x0F, 0xCF, 0xC0, 0xF8,
+    0x1F, 0x8F, 0xFF, 0x80, 0xF0, 0x1F, 0x87, 0xFF, 0x80, 0xE0, 0x1F, 0x87, 0xFF, 0x80, 0xC0, 0x0F,
+    0x87, 0xFF, 0x00, 0x80, 0x07, 0x83, 0xFF, 0x00, 0x00, 0x03, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0xF8, 0x00,
+    0x00, 0x3F, 0xF0, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0xFE, 0x00, 0x00,
+    0x7F, 0xF8, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0x00, 0x00, 0xFC, 0xFC, 0x3F, 0x01, 0xC0, 0xF8,
+    0x7C, 0x1F, 0x61, 0xC0, 0xF8, 0x7C, 0x1F, 0xE1, 0xC0, 0xF8, 0x3C, 0x1F, 0xF3, 0xC0, 0xF8, 0x3E,
+    0x1F, 0x7F, 0x80, 0xF8, 0x3E, 0x1F, 0x7F, 0x80, 0xFC, 0x3F, 0x3F, 0x3F, 0x00, 0x7E, 0x3F, 0xFE,
+    0x1E, 0x00, 0x7E, 0x1F, 0xFE, 0x00, 0x00, 0x7E, 0x1F, 0xFE, 0x00, 0x00, 0x3E, 0x1F, 0xFC, 0x00,
+    0x00, 0x1E, 0x0F, 0xFC, 0x00, 0x00, 0x0E, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0xFF, 0x1F, 0x00, 0x03,
+    0xE0, 0xFF, 0x1F, 0x00, 0x03, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x00,
+    0x7C, 0x00, 0x3F, 0x80, 0x00, 0x7C, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFF, 0x80, 0x00, 0x7C,
+    0x03, 0xFF, 0x80, 0x00, 0x7C, 0x0F, 0xFF, 0x80, 0x04, 0x7C, 0x1F, 0xFF, 0x80, 0x1C, 0x7C, 0x3F,
+    0xFF, 0x80, 0x7C, 0x7C, 0xFF, 0xCF, 0x80, 0xFC, 0x7D, 0xFF, 0x8F, 0x80, 0xFC, 0x7F, 0xFE, 0x0F,
+    0x80, 0xF8, 0x7F, 0xFC, 0x0F, 0x80, 0xE0, 0x7F, 0xF8, 0x0F, 0x80, 0xC0, 0x7F, 0xE0, 0x0F, 0x80,
+    0x80, 0x7F, 0xC0, 0x0F, 0x80, 0x00, 0x7F, 0x80, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x00,
+    0x7C, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0,
+    0xE0, 0xC0, 0x84, 0x1C, 0x3C, 0x7C, 0xFC, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x03,
+    0xC0, 0x80, 0x3E, 0x00, 0x0F, 0xC0, 0xC0, 0x3E, 0x00, 0x1F, 0xC0, 0xF0, 0x3E, 0x00, 0x7F, 0xC0,
+    0xF8, 0x3E, 0x00, 0xFF, 0xC0, 0xFC, 0x3E, 0x01, 0xFF, 0xC0, 0x7E, 0x3E, 0x07, 0xFF, 0xC0, 0x3F,
+    0x3E, 0x0F, 0xFF, 0xC0, 0x1F, 0x3E, 0x1F, 0xFF, 0xC0, 0x0F, 0x3E, 0x7F, 0xE7, 0xC0, 0x1F, 0x3E,
+    0xFF, 0xC7, 0xC0, 0x3F, 0x3F, 0xFF, 0x07, 0xC0, 0xFE, 0x3F, 0xFE, 0x07, 0xC0, 0xFC, 0x3F, 0xFC,
+    0x07, 0xC0, 0xF8, 0x3F, 0xF0, 0x07, 0xC0, 0xF0, 0x3F, 0xE0, 0x07, 0xC0, 0xC0, 0x3F, 0xC0, 0x07,
+    0xC0, 0x80, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x00,
+    0x7C, 0x00, 0x7F, 0x80, 0x00, 0x7C, 0x01, 0xFF, 0x80, 0x00, 0x7C, 0x03, 0xFF, 0x80, 0x78, 0x7C,
+    0x0F, 0xFF, 0x80, 0x78, 0x7C, 0x1F, 0xFF, 0x80, 0xFC, 0x7C, 0x3F, 0xFF, 0x80, 0xFC, 0x7C, 0xFF,
+    0xCF, 0x80, 0xFC, 0x7D, 0xFF, 0x8F, 0x80, 0x78, 0x7F, 0xFE, 0x0F, 0x80, 0x70, 0x7F, 0xFC, 0x0F,
+    0x80, 0x00, 0x7F, 0xF8, 0x0F, 0x80, 0x00, 0x7F, 0xE0, 0x0F, 0x80, 0x00, 0x7F, 0xC0, 0x0F, 0x80,
+    0x00, 0x7F, 0x80, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7C,
+    0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0x04, 0x7C, 0x00, 0x7C, 0x00, 0x00,
+    0x1C, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x7C, 0x00, 0x7E,
+    0x00, 0x00, 0xFC, 0x7C, 0x00, 0x7F, 0x80, 0x00, 0xF8, 0x7E, 0x00, 0xFF, 0xE0, 0x00, 0xE0, 0x7E,
+    0x00, 0xFF, 0xF8, 0x00, 0xC0, 0x7F, 0x83, 0xFF, 0xFE, 0x00, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF1, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0,
+    0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x1F, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0x00,
+    0xFE, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x87, 0xC0, 0x00, 0x04, 0x7F, 0xFC, 0x07, 0xC0, 0x00, 0x1C, 0x7F,
+    0xE0, 0x07, 0xC0, 0x00, 0x7C, 0x7F, 0x80, 0x07, 0xC0, 0x00, 0xFC, 0x7F, 0xE0, 0x07, 0xC0, 0x00,
+    0xFC, 0x7F, 0xFC, 0x07, 0xC0, 0x00, 0xF8, 0x7F, 0xFF, 0x87, 0xC0, 0x00, 0xF0, 0x7F, 0xFF, 0xF7,
+    0xC0, 0x00, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0x00,
+    0x07, 0xFF, 0xFF, 0xC0, 0x07, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
+    0x1F, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7E, 0x3F, 0xFF, 0xC3,
+    0xE0, 0x00, 0xFC, 0x3F, 0xFE, 0x03, 0xE0, 0x00, 0xF8, 0x3F, 0xF0, 0x03, 0xE0, 0x00, 0xF0, 0x3F,
+    0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x3F, 0xF0, 0x03, 0xE0, 0x00, 0xFC, 0x3F, 0xFE, 0x03, 0xE0, 0x00,
+    0x7E, 0x3F, 0xFF, 0xC3, 0xE0, 0x00, 0x3F, 0x3F, 0xFF, 0xFB, 0xE0, 0x00, 0x1F, 0x0F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x0F, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0x00,
+    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0xE0, 0x00,
+    0x3F, 0xFF, 0xFC, 0x00, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
+    0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x7F, 0xFF, 0x87, 0xC0, 0x00, 0x3C, 0x7F, 0xFC, 0x07,
+    0xC0, 0x00, 0x1C, 0x7F, 0xE0, 0x07, 0xC0, 0x00, 0x1C, 0x7F, 0x80, 0x07, 0xC0, 0x00, 0x1C, 0x7F,
+    0xE0, 0x07, 0xC0, 0x00, 0x3C, 0x7F, 0xFC, 0x07, 0xC0, 0x00, 0xFC, 0x7F, 0xFF, 0x87, 0xC0, 0x00,
+    0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x01, 0xFF, 0xFF,
+    0xE0, 0x00, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x78, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x78, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x07,
+    0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x7F, 0xFF, 0xF7, 0xC0, 0x00,
+    0xFC, 0x7F, 0xFF, 0x87, 0xC0, 0x00, 0x78, 0x7F, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x07,
+    0xC0, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xC0, 0x00, 0x78, 0x7F,
+    0xFC, 0x07, 0xC0, 0x00, 0x78, 0x7F, 0xFF, 0x87, 0xC0, 0x00, 0xFC, 0x7F, 0xFF, 0xF7, 0xC0, 0x00,
+    0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0xFF,
+    0xF8, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x1C, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x7C, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x00, 0x00,
+    0x0F, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0C, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x3C, 0x7E,
+    0x00, 0x00, 0x1F, 0x80, 0xFC, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x7E, 0x00, 0x00, 0x1F, 0x80,
+    0xF8, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0xE0, 0x3F, 0x00, 0x00,
+    0x3F, 0x00, 0x80, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x1F,
+    0xF0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
+    0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x03,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x01, 0xC0,
+    0xFC, 0x00, 0x00, 0x3F, 0x61, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0xE1, 0xC0, 0xFC, 0x00, 0x00, 0x3F,
+    0xF3, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0xFE, 0x00,
+    0x00, 0x7F, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x1E, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x7F, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFC,
+    0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xE0,
+    0x07, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0x00,
+    0xE0, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0xF0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0xF8, 0x1F, 0x80, 0x00,
+    0x1F, 0x80, 0xFC, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x3F,
+    0x00, 0x00, 0x0F, 0xC0, 0x1E, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x1E, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
+    0x3E, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x3F, 0x80, 0x00,
+    0x1F, 0xC0, 0xF8, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0xF0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0xE0, 0x1F,
+    0xF0, 0x00, 0xFF, 0x80, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xFE, 0x00,
+    0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0x78, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C,
+    0x01, 0xF0, 0x0F, 0x80, 0x0C, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x3C, 0x7C, 0x01, 0xF0, 0x0F, 0x80,
+    0xFC, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0xFC, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0xF8, 0x7C, 0x01, 0xF0,
+    0x0F, 0x80, 0xF0, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0xC0, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x80, 0x7C,
+    0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x80,
+    0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x00,
+    0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x1F,
+    0x00, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x03,
+    0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0x00,
+    0xF8, 0x03, 0xE0, 0x1F, 0x7C, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0xFF, 0x00, 0xF8, 0x03, 0xE0, 0x1F,
+    0xFF, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0xFF, 0x80, 0xF8, 0x03, 0xE0, 0x1F, 0xFF, 0x80, 0xF8, 0x03,
+    0xE0, 0x1F, 0xC7, 0x80, 0xF8, 0x03, 0xE0, 0x1F, 0x87, 0x80, 0xF8, 0x00, 0x00, 0x1F, 0x07, 0x80,
+    0xF8, 0x00, 0x00, 0x1F, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x78, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x78, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x78, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x70, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x01, 0xF0,
+    0x0F, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x78, 0x7C,
+    0x01, 0xF0, 0x0F, 0x80, 0x78, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0xFC, 0x7C, 0x01, 0xF0, 0x0F, 0x80,
+    0xFC, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0xFC, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0xFC, 0x7C, 0x01, 0xF0,
+    0x0F, 0x80, 0x78, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7C,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x7E, 0x3E, 0x00, 0xF8, 0x07, 0xC0,
+    0x1F, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x0F, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x3E, 0x00, 0xF8,
+    0x07, 0xC0, 0x3F, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x7E, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0xFC, 0x3E,
+    0x00, 0xF8, 0x07, 0xC0, 0xF8, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0xF0, 0x3E, 0x00, 0xF8, 0x07, 0xC0,
+    0xE0, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0xC0, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8,
+    0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x1C, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x7C, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7E, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7E, 0x3E, 0x00, 0x00, 0x07, 0xC0,
+    0x3F, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x3E, 0x00, 0x00,
+    0x07, 0xC0, 0x1F, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x7F, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0xFE, 0x3E,
+    0x00, 0x00, 0x07, 0xC0, 0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
+    0xE0, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0xC0, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x80, 0x1F, 0xE0, 0x00,
+    0x7F, 0x80, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x07, 0x80, 0x1F, 0xF8, 0x07, 0x80, 0x1F, 0xF8, 0x07, 0x80, 0x1F, 0xF8, 0x07,
+    0x80, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7F, 0x80,
+    0x01, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
+    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+    0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x80, 0x00,
+    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x03,
+    0xFF, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+    0x3F, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xFF,
+    0x00, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFC, 0x00,
+    0x00, 0x3F, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00,
+    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0C, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x3C, 0x7E,
+    0x00, 0x00, 0x1F, 0x80, 0xFC, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x7E, 0x00, 0x00, 0x1F, 0x80,
+    0xFC, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0xE0, 0x3F, 0x00, 0x00,
+    0x3F, 0x00, 0x80, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x1F,
+    0xF8, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0E, 0x1F,
+    0xF0, 0x00, 0xFF, 0x80, 0x1E, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x3E, 0x1F, 0x80, 0x00, 0x1F, 0x80,
+    0x7E, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x3F, 0x00, 0x00,
+    0x0F, 0xC0, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x3F,
+    0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x3F, 0x80, 0x00, 0x1F, 0xC0,
+    0x3E, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x1E, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x06, 0x1F, 0xF0, 0x00,
+    0xFF, 0x80, 0x02, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x07,
+    0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0C, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x1C, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x7E, 0x00, 0x00, 0x1F, 0x80,
+    0xF8, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0xE0, 0x7E, 0x00, 0x00,
+    0x1F, 0x80, 0xC0, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0C, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x1C, 0x7F,
+    0x00, 0x00, 0x3F, 0x80, 0x3C, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7F, 0x00,
+    0xF8, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0xF0, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0xE0, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x80, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00,
+    0x78, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x78, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0xFC, 0x3F, 0x80, 0x00,
+    0x7F, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x78, 0x7E,
+    0x00, 0x00, 0x1F, 0x80, 0x70, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
+    0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x78, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x78, 0x7E, 0x00, 0x00,
+    0x1F, 0x80, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x3F,
+    0x80, 0x00, 0x7F, 0x00, 0xF8, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x78, 0x1F, 0xF8, 0x07, 0xFE, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x08, 0x00, 0x20, 0x3C, 0x00, 0x70,
+    0x7E, 0x00, 0xF8, 0xFF, 0x01, 0xFC, 0x7F, 0x83, 0xFC, 0x3F, 0xC7, 0xF8, 0x1F, 0xEF, 0xF0, 0x0F,
+    0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF,
+    0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xEF, 0xF0, 0x3F, 0xC7, 0xF8, 0x7F, 0x83, 0xFC,
+    0xFF, 0x01, 0xFC, 0x7E, 0x00, 0xF8, 0x3C, 0x00, 0x70, 0x18, 0x00, 0x20, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x3E,
+    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x3E,
+    0x00, 0x3E, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0xC0, 0x00,
+    0x7E, 0x3F, 0x00, 0x7F, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x7F, 0xFC, 0x00, 0xF8, 0x3F, 0xC1, 0xFF,
+    0xFF, 0x00, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x0F,
+    0xFF, 0xF8, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xC0,
+    0x00, 0x01, 0xFF, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00,
+    0x00, 0x00, 0x07, 0xE0, 0xE3, 0x80, 0x00, 0x00, 0x07, 0xE0, 0xC1, 0x80, 0x00, 0x00, 0x07, 0xE0,
+    0xC1, 0x80, 0x00, 0x00, 0x07, 0xE0, 0xE3, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x00,
+    0x07, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
+    0x0C, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00,
+    0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x7F, 0x00,
+    0x3C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x00,
+    0x1F, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xC4, 0x00,
+    0x00, 0x00, 0x1F, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x7C, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xF8, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xC0, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x00, 0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x70, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x80,
+    0x78, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00,
+    0x7F, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
+    0x04, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x1C, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x7C, 0x00, 0x01, 0xFF,
+    0xFF, 0x80, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0xF8, 0x00,
+    0x7F, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00,
+    0x80, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE1, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0xF8, 0x00, 0x00, 0x00,
+    0x3F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xF8, 0x03, 0xE0, 0x1F, 0xFC, 0x07, 0xE0, 0x1F,
+    0xFE, 0x0F, 0xE0, 0x1F, 0x7F, 0xFF, 0xF0, 0x3F, 0x7F, 0xFF, 0xF8, 0x7F, 0x7F, 0xFE, 0xFF, 0xFF,
+    0x3F, 0xFE, 0xFF, 0xFE, 0x1F, 0xFC, 0xFF, 0xFE, 0x0F, 0xF8, 0x7F, 0xFC, 0x03, 0xF0, 0x3F, 0xFC,
+    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
+    0x80, 0x04, 0x7F, 0xFF, 0xFF, 0x80, 0x1C, 0x7F, 0xFF, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x00, 0x00,
+    0xFC, 0x1E, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0xE0,
+    0x7C, 0x00, 0x00, 0x00, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0x03, 0xFE, 0x00, 0x00, 0x07, 0x07,
+    0xFF, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0x0F, 0xFF,
+    0x80, 0x00, 0x3F, 0x9F, 0xFF, 0x80, 0x00, 0x7E, 0x1F, 0x1F, 0x80, 0x00, 0x7C, 0x1E, 0x0F, 0x80,
+    0x04, 0x7C, 0x1E, 0x0F, 0x80, 0x1C, 0x7C, 0x1E, 0x0F, 0x00, 0xFC, 0x7C, 0x1C, 0x0F, 0x00, 0xFC,
+    0x7C, 0x1C, 0x1E, 0x00, 0xF8, 0x7E, 0x3C, 0x3C, 0x00, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0xE0, 0x3F,
+    0xFF, 0xFF, 0x80, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFC,
+    0x00, 0x00, 0x01, 0x81, 0xFF, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x80, 0x02, 0x0F, 0x87, 0xFF, 0x80,
+    0x06, 0x0F, 0x87, 0xFF, 0xC0, 0x0E, 0x1F, 0x87, 0xFF, 0xC0, 0x1E, 0x1F, 0xCF, 0xFF, 0xC0, 0x3E,
+    0x3F, 0x0F, 0x8F, 0xC0, 0x7E, 0x3E, 0x0F, 0x07, 0xC0, 0xFC, 0x3E, 0x0F, 0x07, 0xC0, 0xF0, 0x3E,
+    0x0F, 0x07, 0x80, 0xF0, 0x3E, 0x0E, 0x07, 0x80, 0xF8, 0x3E, 0x0E, 0x0F, 0x00, 0xFC, 0x3F, 0x1E,
+    0x1E, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0xC0, 0x3E, 0x1F, 0xFF, 0xFF, 0xC0, 0x1E, 0x1F, 0xFF, 0xFF,
+    0xC0, 0x06, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
+    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0x03, 0xFE, 0x00, 0x00,
+    0x0F, 0x07, 0xFE, 0x00, 0xC0, 0x1F, 0x0F, 0xFF, 0x00, 0xF0, 0x1F, 0x0F, 0xFF, 0x00, 0xF8, 0x3F,
+    0x0F, 0xFF, 0x80, 0xF8, 0x3F, 0x9F, 0xFF, 0x80, 0xFC, 0x7F, 0x1F, 0x1F, 0x80, 0x3C, 0x7E, 0x1E,
+    0x0F, 0x80, 0x1C, 0x7C, 0x1E, 0x0F, 0x80, 0x1C, 0x7C, 0x1E, 0x0F, 0x80, 0x1C, 0x7C, 0x1E, 0x0F,
+    0x00, 0x1C, 0x7C, 0x1C, 0x0F, 0x00, 0x1C, 0x7C, 0x1C, 0x1E, 0x00, 0x38, 0x7E, 0x3C, 0x3C, 0x00,
+    0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xC0,
+    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x03,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x07,
+    0xFF, 0x00, 0x78, 0x1F, 0x0F, 0xFF, 0x00, 0x78, 0x1F, 0x0F, 0xFF, 0x80, 0xFC, 0x3F, 0x0F, 0xFF,
+    0x80, 0xFC, 0x3F, 0x9F, 0xFF, 0x80, 0xFC, 0x7E, 0x1F, 0x1F, 0x80, 0xFC, 0x7C, 0x1E, 0x0F, 0x80,
+    0x78, 0x7C, 0x1E, 0x0F, 0x80, 0x00, 0x7C, 0x1E, 0x0F, 0x00, 0x00, 0x7C, 0x1C, 0x0F, 0x00, 0x00,
+    0x7C, 0x1C, 0x1E, 0x00, 0x78, 0x7E, 0x3C, 0x3C, 0x00, 0x78, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x3F,
+    0xFF, 0xFF, 0x80, 0xFC, 0x3F, 0xFF, 0xFF, 0x80, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFC, 0x1F, 0xFF,
+    0xFF, 0x80, 0x78, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x1C, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7C, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF,
+    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00,
+    0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0C, 0x7C, 0x00, 0x0F, 0x80, 0x3C,
+    0x7C, 0x00, 0x0F, 0x80, 0xFC, 0x7C, 0x00, 0x0F, 0x80, 0xFC, 0x7C, 0x00, 0x0F, 0x80, 0xF8, 0x7E,
+    0x00, 0x1F, 0x80, 0xF0, 0x3F, 0x00, 0x3F, 0x80, 0xC0, 0x3F, 0xC0, 0xFF, 0x00, 0x80, 0x3F, 0xC0,
+    0xFF, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0xF8,
+    0x00, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00,
+    0x7F, 0x01, 0xC0, 0xFC, 0x00, 0x3F, 0x21, 0xC0, 0xF8, 0x00, 0x1F, 0xE1, 0xC0, 0xF8, 0x00, 0x1F,
+    0xF3, 0xC0, 0xF8, 0x00, 0x1F, 0x7F, 0x80, 0xF8, 0x00, 0x3F, 0x7F, 0x80, 0xFC, 0x00, 0x3F, 0x3F,
+    0x00, 0x7F, 0x81, 0xFF, 0x1E, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00,
+    0x3F, 0x81, 0xFC, 0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x03,
+    0x81, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03,
+    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0xE0, 0x1F, 0xFF,
+    0xFF, 0x80, 0xF0, 0x1F, 0xFF, 0xFF, 0x80, 0xF8, 0x1F, 0xC0, 0x7F, 0x80, 0xFC, 0x3F, 0x80, 0x1F,
+    0xC0, 0x7E, 0x3F, 0x00, 0x0F, 0xC0, 0x3E, 0x3E, 0x00, 0x07, 0xC0, 0x0E, 0x3E, 0x00, 0x07, 0xC0,
+    0x1E, 0x3E, 0x00, 0x07, 0xC0, 0x3E, 0x3E, 0x00, 0x07, 0xC0, 0xFE, 0x3F, 0x00, 0x0F, 0xC0, 0xFC,
+    0x3F, 0x80, 0x1F, 0xC0, 0xF8, 0x1F, 0xC0, 0x7F, 0x80, 0xE0, 0x1F, 0xC0, 0x7F, 0x80, 0xC0, 0x0F,
+    0xC0, 0x7F, 0x00, 0x80, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x01, 0xC0,
+    0x70, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF8,
+    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xBC, 0x7F, 0x00, 0x00, 0x7E, 0x3C, 0x1F, 0x80, 0x04,
+    0x7C, 0x3C, 0x1F, 0x80, 0x1C, 0x7C, 0x3C, 0x0F, 0x80, 0x7C, 0x7C, 0x3C, 0x0F, 0x80, 0xFC, 0x7C,
+    0x3C, 0x0F, 0x80, 0xFC, 0x7C, 0x3C, 0x0F, 0x80, 0xF0, 0x7E, 0x3C, 0x1F, 0x80, 0xE0, 0x3F, 0x3C,
+    0x3F, 0x00, 0x80, 0x3F, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xFC, 0x7E,
+    0x00, 0x00, 0x0F, 0xFC, 0x7C, 0x00, 0x00, 0x03, 0xFC, 0x78, 0x00, 0x00, 0x00, 0xFC, 0x60, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+    0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0x78, 0xFE, 0x00,
+    0xFC, 0x78, 0x3F, 0x00, 0xF8, 0x78, 0x3F, 0xFC, 0xF8, 0x78, 0x1F, 0xFE, 0xF8, 0x78, 0x1F, 0xFE,
+    0xF8, 0x78, 0x1F, 0xFF, 0xF8, 0x78, 0x1F, 0xFF, 0xFC, 0x78, 0x3F, 0x0F, 0x7E, 0x78, 0x7F, 0x0F,
+    0x7F, 0xF8, 0xFE, 0x0E, 0x3F, 0xF8, 0xFE, 0x00, 0x3F, 0xF8, 0xFC, 0x00, 0x1F, 0xF8, 0xF8, 0x00,
+    0x07, 0xF8, 0xF0, 0x00, 0x01, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF,
+    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x78, 0x07, 0xFF, 0xFE, 0x00, 0x78, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFC, 0x1F, 0xDE, 0x3F, 0x80,
+    0xFC, 0x3F, 0x1E, 0x0F, 0xC0, 0x78, 0x3E, 0x1E, 0x0F, 0xC0, 0x00, 0x3E, 0x1E, 0x07, 0xC0, 0x00,
+    0x3E, 0x1E, 0x07, 0xC0, 0x00, 0x3E, 0x1E, 0x07, 0xC0, 0x78, 0x3E, 0x1E, 0x07, 0xC0, 0x78, 0x3F,
+    0x1E, 0x0F, 0xC0, 0xFC, 0x1F, 0x9E, 0x1F, 0x80, 0xFC, 0x1F, 0xFE, 0x3F, 0x80, 0xFC, 0x0F, 0xFE,
+    0x3F, 0x80, 0xFC, 0x0F, 0xFE, 0x3F, 0x00, 0x78, 0x07, 0xFE, 0x3E, 0x00, 0x00, 0x01, 0xFE, 0x3C,
+    0x00, 0x00, 0x00, 0x7E, 0x30, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
+    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0xE0,
+    0x1F, 0xFF, 0xFF, 0x80, 0xF0, 0x1F, 0xFF, 0xFF, 0x80, 0xF8, 0x1F, 0xDE, 0x3F, 0x80, 0xFC, 0x3F,
+    0x1E, 0x0F, 0xC0, 0x7E, 0x3E, 0x1E, 0x0F, 0xC0, 0x1E, 0x3E, 0x1E, 0x07, 0xC0, 0x0E, 0x3E, 0x1E,
+    0x07, 0xC0, 0x3E, 0x3E, 0x1E, 0x07, 0xC0, 0x7E, 0x3E, 0x1E, 0x07, 0xC0, 0xFC, 0x3F, 0x1E, 0x0F,
+    0xC0, 0xF8, 0x1F, 0x9E, 0x1F, 0x80, 0xF0, 0x1F, 0xFE, 0x3F, 0x80, 0xE0, 0x0F, 0xFE, 0x3F, 0x80,
+    0x80, 0x0F, 0xFE, 0x3F, 0x00, 0x00, 0x07, 0xFE, 0x3E, 0x00, 0x00, 0x01, 0xFE, 0x3C, 0x00, 0x00,
+    0x00, 0x7E, 0x30, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0x80, 0x1C, 0x7F,
+    0xFF, 0xFF, 0x80, 0x7C, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF,
+    0xFF, 0x80, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E,
+    0x3F, 0xFF, 0xFF, 0xC0, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xC0, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x7E, 0x3F, 0xFF,
+    0xFF, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
+    0xC0, 0x7F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00,
+    0x07, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x07,
+    0x80, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x1F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x3F, 0x3C, 0xF8,
+    0x00, 0x1F, 0x3C, 0xF8, 0x00, 0x1F, 0x3C, 0x78, 0x00, 0x1E, 0x3C, 0x78, 0x00, 0x1E, 0x3C, 0x3C,
+    0x00, 0x3C, 0x3C, 0x1F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x00,
+    0x3C, 0x3C, 0x00, 0x00, 0x00, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0xF8,
+    0x7E, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x80, 0x7F,
+    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF,
+    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0,
+    0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0xFC,
+    0x03, 0x80, 0x00, 0x00, 0x7E, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x1E,
+    0x00, 0x00, 0x00, 0x0F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00,
+    0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF,
+    0xC0, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x80, 0x0F, 0xFF, 0xFF, 0xC0,
+    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x80,
+    0x7F, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x1C, 0x7C, 0x00, 0x0F,
+    0x80, 0x7C, 0x7C, 0x00, 0x0F, 0x80, 0xFC, 0x7C, 0x00, 0x0F, 0x80, 0xFC, 0x7E, 0x00, 0x1F, 0x80,
+    0xF0, 0x7E, 0x00, 0x1F, 0x80, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x07,
+    0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x02, 0x07, 0xFF, 0xFE,
+    0x00, 0x06, 0x0F, 0xFF, 0xFF, 0x00, 0x0E, 0x1F, 0xFF, 0xFF, 0x80, 0x1E, 0x1F, 0xFF, 0xFF, 0x80,
+    0x3E, 0x1F, 0xC0, 0x3F, 0x80, 0x7E, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x3F, 0x00, 0x0F, 0xC0, 0xF8,
+    0x3E, 0x00, 0x07, 0xC0, 0xE0, 0x3E, 0x00, 0x07, 0xC0, 0xF8, 0x3E, 0x00, 0x07, 0xC0, 0xFC, 0x3F,
+    0x00, 0x0F, 0xC0, 0x7E, 0x3F, 0x00, 0x0F, 0xC0, 0x3E, 0x1F, 0xC0, 0x3F, 0x80, 0x1E, 0x1F, 0xFF,
+    0xFF, 0x80, 0x0E, 0x1F, 0xFF, 0xFF, 0x80, 0x06, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE,
+    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
+    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0x00, 0x0C, 0x3F,
+    0xFF, 0xFF, 0x00, 0x3C, 0x3F, 0x80, 0x7F, 0x00, 0x7C, 0x7E, 0x00, 0x1F, 0x80, 0xFC, 0x7E, 0x00,
+    0x1F, 0x80, 0xF8, 0x7C, 0x00, 0x0F, 0x80, 0xE0, 0x7C, 0x00, 0x0F, 0x80, 0xC0, 0x7C, 0x00, 0x0F,
+    0x80, 0x84, 0x7E, 0x00, 0x1F, 0x80, 0x1C, 0x7E, 0x00, 0x1F, 0x80, 0x3C, 0x3F, 0x80, 0x7F, 0x00,
+    0x7C, 0x3F, 0xFF, 0xFF, 0x00, 0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0xF0, 0x1F, 0xFF, 0xFE, 0x00, 0xE0,
+    0x0F, 0xFF, 0xFC, 0x00, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF,
+    0xFC, 0x00, 0x78, 0x07, 0xFF, 0xFE, 0x00, 0x78, 0x0F, 0xFF, 0xFF, 0x00, 0xFC, 0x1F, 0xFF, 0xFF,
+    0x80, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFC, 0x1F, 0xC0, 0x3F, 0x80, 0x78, 0x3F, 0x00, 0x0F, 0xC0,
+    0x70, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
+    0x3E, 0x00, 0x07, 0xC0, 0x78, 0x3F, 0x00, 0x0F, 0xC0, 0x78, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x1F,
+    0xC0, 0x3F, 0x80, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFC, 0x0F, 0xFF,
+    0xFF, 0x00, 0x78, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x38, 0x7C, 0x1C, 0x7C, 0x7C,
+    0x3E, 0xFE, 0x7C, 0x7F, 0xFE, 0x7C, 0x7F, 0xFE, 0x7C, 0x7F, 0x7C, 0x7C, 0x3E, 0x38, 0x7C, 0x1C,
+    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xF8, 0x3F, 0xFF, 0xFF,
+    0xC0, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x7E, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0x3F, 0xFF, 0xFF, 0xC0,
+    0x1F, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x3F,
+    0x1F, 0x00, 0x00, 0x00, 0x7E, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x3E,
+    0x00, 0x00, 0x00, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
+    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
+    0x1E, 0x07, 0xFF, 0xFF, 0xF8, 0x7F, 0x80, 0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0x01, 0xF8, 0xF1,
+    0xC0, 0x00, 0x00, 0xF8, 0xE0, 0xC0, 0x00, 0x00, 0xF8, 0xE0, 0xC0, 0x00, 0x00, 0xF0, 0xF1, 0xC0,
+    0x00, 0x00, 0xF0, 0x7F, 0x80, 0x00, 0x01, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xC0, 0x1E, 0x07, 0xFF,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
+    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
+    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0C, 0x00, 0x00,
+    0x0F, 0x80, 0x3C, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x0F,
+    0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0xE0, 0x7F, 0xFF, 0xFF, 0x80,
+    0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0C, 0x7F, 0xFF, 0xFF, 0x80, 0x1C, 0x7F, 0xFF, 0xFF,
+    0x80, 0x3C, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0x80,
+    0xF0, 0x00, 0x00, 0x0F, 0x80, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0xC4, 0x00, 0x00, 0x0F, 0x00, 0x0C,
+    0x00, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x7F,
+    0xFF, 0xFF, 0x80, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0xE0, 0x7F, 0xFF,
+    0xFF, 0x80, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
+    0x78, 0x7F, 0xFF, 0xFF, 0x00, 0x78, 0x7F, 0xFF, 0xFF, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0xFC,
+    0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x78, 0x00, 0x00, 0x1F, 0x80, 0x70, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x00,
+    0x0F, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0xFC, 0x7F, 0xFF, 0xFF,
+    0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0x78, 0x7F, 0xFF, 0xFF, 0x80,
+    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF,
+    0x80, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xC0, 0x00, 0x1F, 0xFF, 0xFE, 0x0F, 0xC0, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0C, 0x00, 0x03, 0xFF, 0xFF,
+    0x80, 0x3C, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0xFC, 0x00, 0x03,
+    0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xE0,
+    0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x80, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x87, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x87, 0x03, 0xE0, 0x00, 0xFF, 0xCF, 0x03, 0xE0, 0x00, 0xFD, 0xFE, 0x03, 0xE0, 0x00, 0xFD, 0xFE,
+    0x03, 0xE0, 0x00, 0x78, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0xFC, 0xFC, 0xFC, 0x78,
+    0x70,
+};
+static const uint32_t InterTight_Bold22pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 29, 59, 167, 292, 442, 550, 562, 622, 682, 736,
+    802, 818, 832, 839, 919, 1023, 1083, 1175, 1271, 1375, 1467, 1567,
+    1655, 1751, 1851, 1872, 1904, 1992, 2034, 2122, 2206, 2446, 2570, 2666,
+    2782, 2890, 2978, 3062, 3178, 3286, 3314, 3398, 3506, 3586, 3722, 3826,
+    3946, 4042, 4192, 4292, 4392, 4496, 4600, 4724, 4896, 5008, 5132, 5228,
+    5283, 5363, 5418, 5456, 5477, 5486, 5549, 5641, 5707, 5799, 5865, 5950,
+    6065, 6153, 6188, 6254, 6346, 6374, 6479, 6545, 6614, 6729, 6844, 6889,
+    6955, 7011, 7077, 7149, 7254, 7323, 7443, 7503, 7583, 7625, 7705, 7751,
+    7751, 7752, 7938, 7953, 8049, 8161, 8261, 8411, 8516, 8532, 8682, 8832,
+    8988, 9132, 9146, 9290, 9434, 9464, 9552, 9570, 9622, 9631, 9701, 9811,
+    9828, 9844, 9954, 10064, 10149, 10249, 10268, 10368, 10468, 10618, 10804, 10990,
+    11176, 11362, 11482, 11656, 11824, 11998, 12130, 12262, 12394, 12526, 12586, 12688,
+    12850, 12978, 13134, 13290, 13470, 13650, 13830, 14010, 14076, 14226, 14382, 14538,
+    14694, 14850, 15036, 15192, 15288, 15363, 15468, 15573, 15683, 15788, 15848, 15958,
+    16068, 16178, 16288, 16376, 16486, 16596, 16646, 16731, 16886, 16990, 17100, 17210,
+    17325, 17440, 17555, 17670, 17736, 17826, 17936, 18046, 18161, 18271, 18415, 18490,
+};
+
+// InterTightBold24pt8bfr.h
+static const uint8_t InterTight_Bold24pt8b_Atlas[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0xFF, 0xFE, 0x1F, 0x80, 0xFF, 0xFF, 0xFE, 0x3F, 0xC0,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xC0, 0xFF, 0xFF, 0xFE, 0x3F, 0xC0, 0xFF, 0xFF, 0xFE, 0x3F, 0xC0, 0xFF,
+    0xFF, 0xFE, 0x1F, 0x80, 0xFF, 0xFF, 0xFE, 0x0F, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
+    0x0F, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0x81, 0xC0, 0x00, 0xF8, 0x0F,
+    0xFF, 0xC0, 0x00, 0xF8, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0xFF, 0xFE, 0x0F, 0x80, 0x00, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0xE0, 0xF8, 0x0F, 0x80, 0x00, 0x00,
+    0xF8, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0xC0, 0x00, 0xF8, 0x0F, 0xBF, 0xC0, 0x00, 0xF8,
+    0x0F, 0xFF, 0xC0, 0x00, 0xFB, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x0F, 0x80,
+    0x00, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0xF0, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x07,
+    0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x07, 0xF8, 0x00, 0x01, 0xFF,
+    0xFE, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x01, 0xFC, 0x00, 0x03, 0xF1, 0xFF, 0x00, 0xFC, 0x00,
+    0x03, 0xE0, 0xFF, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x7F, 0x80, 0x7E, 0x00, 0x07, 0xC0, 0x7F, 0x80,
+    0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xC0, 0x1F, 0xC0, 0x3E, 0x00, 0x07, 0xC0, 0x1F, 0xC0, 0x3E, 0x00,
+    0x07, 0xE0, 0x1F, 0xE0, 0x7E, 0x00, 0x03, 0xF0, 0x1F, 0xE0, 0x7C, 0x00, 0x03, 0xF8, 0x0F, 0xF0,
+    0xFC, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFC,
+    0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7C, 0x01, 0xFF, 0xE0, 0x00,
+    0x00, 0x3C, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x00, 0x00, 0xE0, 0xF8, 0x1F, 0x00, 0x03, 0xE0, 0xF0, 0x0F, 0x00, 0x07, 0xE0, 0xF0,
+    0x0F, 0x00, 0x1F, 0xC0, 0xF0, 0x0F, 0x00, 0x3F, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xFF, 0xFF,
+    0x01, 0xF8, 0x00, 0x7F, 0xFE, 0x03, 0xF0, 0x00, 0x3F, 0xFC, 0x0F, 0xE0, 0x00, 0x1F, 0xF8, 0x1F,
+    0x80, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
+    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x80,
+    0x00, 0x7E, 0x07, 0xFF, 0xC0, 0x00, 0xFC, 0x0F, 0xFF, 0xE0, 0x03, 0xF0, 0x1F, 0xFF, 0xF0, 0x07,
+    0xE0, 0x1F, 0x01, 0xF0, 0x1F, 0x80, 0x1E, 0x00, 0xF0, 0x3F, 0x00, 0x1E, 0x00, 0xF0, 0x7E, 0x00,
+    0x1E, 0x00, 0xF0, 0x78, 0x00, 0x1F, 0x01, 0xF0, 0x70, 0x00, 0x1F, 0xFF, 0xE0, 0x40, 0x00, 0x0F,
+    0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+    0x03, 0xF0, 0x3F, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xFF, 0x80, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x1F, 0xC0, 0x7F, 0xFF, 0xFC, 0x0F, 0xC0, 0xFC, 0x3F,
+    0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0xFC, 0x07, 0xE0, 0xF8, 0x0F, 0xFE,
+    0x07, 0xC0, 0xF8, 0x1F, 0xFF, 0x07, 0xC0, 0xFC, 0x3F, 0xFF, 0x87, 0xC0, 0xFF, 0xFF, 0xBF, 0xC7,
+    0xC0, 0x7F, 0xFF, 0x1F, 0xFF, 0xC0, 0x7F, 0xFE, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x07, 0xFF, 0x80,
+    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x07, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
+    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
+    0x3F, 0xE7, 0xC0, 0x00, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x00, 0x3E, 0x01, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x00,
+    0x0F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xF0,
+    0x00, 0x00, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0xE0, 0x00,
+    0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x0F, 0xBE, 0x00, 0x07,
+    0xBC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xE0, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xBC, 0x00, 0x0F, 0xBE, 0x00,
+    0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x3C, 0x1F, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xF0, 0xFF, 0x00, 0xF8,
+    0x00, 0xC0, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
+    0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x7E, 0x00,
+    0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00,
+    0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07,
+    0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x1F, 0x80,
+    0x7F, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
+    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x07, 0xE0, 0x00,
+    0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x7F,
+    0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x7F, 0x00, 0x03, 0xFF, 0xC0,
+    0xFC, 0x00, 0x07, 0xFF, 0xC0, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0xF8,
+    0x00, 0x1F, 0xF7, 0xC0, 0xF8, 0x00, 0x3F, 0xE7, 0xC0, 0xF8, 0x00, 0x7F, 0xC7, 0xC0, 0xFC, 0x00,
+    0xFF, 0x87, 0xC0, 0xFC, 0x03, 0xFF, 0x07, 0xC0, 0x7F, 0x07, 0xFE, 0x07, 0xC0, 0x7F, 0xFF, 0xFC,
+    0x07, 0xC0, 0x7F, 0xFF, 0xF8, 0x07, 0xC0, 0x3F, 0xFF, 0xF0, 0x07, 0xC0, 0x1F, 0xFF, 0xE0, 0x07,
+    0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xC0, 0x07, 0xFF, 0x00, 0x07, 0xC0, 0x01, 0xF8, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0xF8, 0x00, 0x07,
+    0x80, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0x00, 0x3F, 0x80,
+    0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x7F, 0x80, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00,
+    0x0F, 0xC0, 0xFC, 0x03, 0xE0, 0x0F, 0xC0, 0xFC, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07,
+    0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0,
+    0xF8, 0x07, 0xE0, 0x07, 0xC0, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x7E, 0x1F, 0xF8, 0x1F, 0x80, 0x7F,
+    0xFF, 0xFC, 0x3F, 0x80, 0x7F, 0xFF, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x7F, 0xFF, 0x00, 0x3F, 0xFE,
+    0x7F, 0xFF, 0x00, 0x1F, 0xFC, 0x3F, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xF0, 0x1F,
+    0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x3F, 0xFD, 0xF0, 0x00, 0x00, 0x7F, 0xF1, 0xF0, 0x00, 0x01, 0xFF, 0xC1, 0xF0, 0x00, 0x07, 0xFF,
+    0x81, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xF0, 0x00, 0x3F, 0xFC, 0x01, 0xF0, 0x00, 0xFF, 0xF0, 0x01,
+    0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0xFF, 0x80, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
+    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0xF8, 0x00, 0xFF, 0xFF, 0xC0,
+    0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xFF,
+    0x80, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xFB, 0xC0, 0x3F, 0x80, 0xF8, 0x07, 0x80, 0x0F, 0xC0,
+    0xF8, 0x0F, 0x80, 0x0F, 0xC0, 0xF8, 0x0F, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0xF8,
+    0x1F, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0xF8, 0x1F,
+    0x80, 0x0F, 0xC0, 0xF8, 0x1F, 0xC0, 0x1F, 0x80, 0xF8, 0x1F, 0xF0, 0x7F, 0x80, 0xF8, 0x0F, 0xFF,
+    0xFF, 0x80, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0xF8, 0x07, 0xFF, 0xFE, 0x00, 0xF8, 0x03, 0xFF, 0xFE,
+    0x00, 0xF8, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
+    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0xFF, 0x80, 0x7F, 0x03, 0xE0, 0x3F, 0x80, 0x7E, 0x07, 0xC0,
+    0x1F, 0x80, 0xFC, 0x0F, 0x80, 0x0F, 0xC0, 0xF8, 0x0F, 0x00, 0x07, 0xC0, 0xF8, 0x0F, 0x00, 0x07,
+    0xC0, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x00, 0x07, 0xC0,
+    0xF8, 0x1F, 0x80, 0x0F, 0xC0, 0xFC, 0x1F, 0x80, 0x0F, 0xC0, 0x7E, 0x1F, 0xC0, 0x1F, 0x80, 0x7F,
+    0x9F, 0xF0, 0x7F, 0x80, 0x7F, 0x8F, 0xFF, 0xFF, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0x00, 0x3F, 0x87,
+    0xFF, 0xFE, 0x00, 0x1F, 0x83, 0xFF, 0xFE, 0x00, 0x0F, 0x81, 0xFF, 0xF8, 0x00, 0x03, 0x80, 0xFF,
+    0xF0, 0x00, 0x00, 0x80, 0x1F, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x00, 0x00, 0x03, 0xC0,
+    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0xF8,
+    0x00, 0x07, 0xFF, 0xC0, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0xF8, 0x01,
+    0xFF, 0xFE, 0x00, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0xF8, 0x1F, 0xFF, 0xC0, 0x00, 0xF8, 0x7F, 0xFF,
+    0x00, 0x00, 0xF9, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x1F, 0xFC, 0x00, 0x1F, 0xFC,
+    0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x3F, 0x80, 0x7E, 0x0F, 0xF8, 0x1F, 0xC0, 0xFC, 0x07, 0xF0, 0x0F,
+    0xC0, 0xFC, 0x07, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0,
+    0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xFC, 0x07, 0xE0, 0x07, 0xC0, 0xFC,
+    0x07, 0xF0, 0x0F, 0xC0, 0x7E, 0x0F, 0xF8, 0x1F, 0x80, 0x7F, 0xFF, 0xFC, 0x3F, 0x80, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x7F, 0xFF, 0x00, 0x3F, 0xFE, 0x7F, 0xFF, 0x00, 0x1F, 0xFC, 0x3F,
+    0xFE, 0x00, 0x0F, 0xF8, 0x1F, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0xFE, 0x00, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x70, 0x00, 0x0F, 0xFF, 0xC0, 0x7C, 0x00,
+    0x1F, 0xFF, 0xE0, 0x7E, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0x00, 0x3F, 0xFF, 0xF8, 0x7F, 0x80, 0x7F,
+    0xFF, 0xF8, 0x7F, 0x80, 0x7F, 0x07, 0xFC, 0x7F, 0xC0, 0x7E, 0x01, 0xFC, 0x1F, 0xC0, 0xFC, 0x00,
+    0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0xFC, 0x07, 0xC0, 0xF8, 0x00, 0x7C, 0x07, 0xC0, 0xF8, 0x00, 0x7C,
+    0x07, 0xE0, 0xF8, 0x00, 0x7C, 0x07, 0xE0, 0xF8, 0x00, 0x78, 0x07, 0xC0, 0xF8, 0x00, 0x78, 0x07,
+    0xC0, 0xFC, 0x00, 0xF8, 0x0F, 0xC0, 0x7E, 0x01, 0xF0, 0x1F, 0xC0, 0x7F, 0x03, 0xE0, 0x3F, 0x80,
+    0x7F, 0xFF, 0xC1, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x7E, 0x00, 0x3F, 0x00,
+    0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x7F, 0x80,
+    0x7E, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x3F, 0xC0, 0x3C, 0x00, 0x0F, 0xFF, 0xC0, 0x7E, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0x00, 0x0F, 0xFF,
+    0xC0, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
+    0x7E, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x03, 0xF3,
+    0xF0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x07, 0xF1, 0xF8, 0x00, 0x07, 0xE1, 0xFC, 0x00, 0x0F, 0xE0,
+    0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x1F, 0x80,
+    0x7F, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x1F, 0x80, 0x7F, 0x00,
+    0x1F, 0xC0, 0xFE, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x0F, 0xE0, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
+    0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
+    0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F,
+    0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
+    0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xFE,
+    0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x3F, 0x80, 0x3F,
+    0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x0F,
+    0xC0, 0xFE, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x07, 0xE1, 0xFC, 0x00, 0x07,
+    0xF1, 0xF8, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x01,
+    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x0F, 0x00, 0xFE, 0x00, 0x3E, 0x1F, 0x80, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0xF8, 0x01, 0xFE, 0x3F,
+    0xC0, 0xF8, 0x03, 0xFE, 0x3F, 0xC0, 0xF8, 0x07, 0xFE, 0x3F, 0xC0, 0xF8, 0x07, 0xFE, 0x1F, 0x80,
+    0xFC, 0x0F, 0xFE, 0x0F, 0x00, 0xFE, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFE,
+    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0x1F, 0xC0, 0x3F,
+    0x81, 0xFF, 0xF8, 0x0F, 0xC0, 0x3F, 0x03, 0xFF, 0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xFF, 0xFE, 0x07,
+    0xE0, 0x7E, 0x0F, 0xFF, 0xFF, 0x07, 0xE0, 0x7C, 0x1F, 0xFF, 0xFF, 0x83, 0xE0, 0x7C, 0x1F, 0xC0,
+    0x7F, 0x83, 0xE0, 0xFC, 0x1F, 0x80, 0x1F, 0xC3, 0xF0, 0xF8, 0x3F, 0x00, 0x0F, 0xC1, 0xF0, 0xF8,
+    0x3E, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x00, 0x07, 0xC1,
+    0xF0, 0xF8, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x1F, 0x00,
+    0x0F, 0x81, 0xF0, 0xF8, 0x1F, 0x00, 0x1F, 0x81, 0xF0, 0xF8, 0x0F, 0xC0, 0x3F, 0x01, 0xF0, 0xFC,
+    0x3F, 0xFF, 0xFE, 0x03, 0xF0, 0x7C, 0x3F, 0xFF, 0xFF, 0x03, 0xE0, 0x7C, 0x3F, 0xFF, 0xFF, 0x83,
+    0xE0, 0x7E, 0x3F, 0xFF, 0xFF, 0xC3, 0xE0, 0x7E, 0x3F, 0xFF, 0xFF, 0xC7, 0xE0, 0x3F, 0x3F, 0xFF,
+    0xFF, 0xC7, 0xE0, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0xC0, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x1F,
+    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0x80,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
+    0x7F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
+    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0xFF, 0xFF, 0xC7, 0xC0, 0x00, 0xFF, 0xFE, 0x07, 0xC0, 0x00, 0xFF, 0xF0, 0x07, 0xC0, 0x00,
+    0xFF, 0x80, 0x07, 0xC0, 0x00, 0xFF, 0x80, 0x07, 0xC0, 0x00, 0xFF, 0xF0, 0x07, 0xC0, 0x00, 0xFF,
+    0xFE, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xC7, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
+    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0,
+    0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07,
+    0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0,
+    0xFC, 0x07, 0xE0, 0x07, 0xC0, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0xFE, 0x1F, 0xF8, 0x0F, 0xC0, 0x7F,
+    0xFF, 0xFC, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0xFF, 0xFF, 0x80, 0x3F, 0xFE,
+    0x7F, 0xFF, 0x00, 0x1F, 0xFC, 0x7F, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xFE, 0x00, 0x03, 0xE0, 0x1F,
+    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
+    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
+    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F,
+    0xC0, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x7C, 0x00,
+    0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
+    0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07,
+    0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x0F, 0x80,
+    0x7E, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x3F,
+    0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x07, 0xF0,
+    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x01, 0xC0, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8,
+    0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00,
+    0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
+    0x07, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x1F,
+    0x80, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
+    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x0F,
+    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0,
+    0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8,
+    0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03,
+    0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0,
+    0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07,
+    0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
+    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
+    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 0x80,
+    0x7C, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8,
+    0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x01,
+    0xF0, 0x07, 0xC0, 0xF8, 0x01, 0xF0, 0x07, 0xC0, 0xFC, 0x01, 0xF0, 0x0F, 0xC0, 0xFC, 0x01, 0xF0,
+    0x0F, 0x80, 0x7E, 0x01, 0xF0, 0x1F, 0x80, 0x7F, 0x01, 0xF0, 0x3F, 0x80, 0x7F, 0xC1, 0xF1, 0xFF,
+    0x00, 0x3F, 0xC1, 0xFF, 0xFF, 0x00, 0x1F, 0xC1, 0xFF, 0xFE, 0x00, 0x1F, 0xC1, 0xFF, 0xFC, 0x00,
+    0x0F, 0xC1, 0xFF, 0xF8, 0x00, 0x07, 0xC1, 0xFF, 0xF0, 0x00, 0x01, 0xC1, 0xFF, 0xE0, 0x00, 0x00,
+    0x41, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
+    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
+    0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0xFF, 0xF8, 0x00,
+    0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0xFC, 0x00,
+    0x00, 0x3F, 0xC0, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0xC0, 0x00, 0x00,
+    0x01, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
+    0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
+    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
+    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
+    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
+    0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
+    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xFF,
+    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
+    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x7C, 0x00, 0x00, 0x0F, 0x80,
+    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8,
+    0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00,
+    0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00,
+    0x1F, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xF8, 0x03, 0xFF,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
+    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00,
+    0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00,
+    0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xFC,
+    0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x83,
+    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
+    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
+    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xC0,
+    0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x7C, 0x00, 0x00,
+    0x0F, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x01, 0x07,
+    0xC0, 0xF8, 0x00, 0x01, 0x87, 0xC0, 0xF8, 0x00, 0x01, 0xC7, 0xC0, 0xF8, 0x00, 0x01, 0xF7, 0xC0,
+    0xF8, 0x00, 0x01, 0xFF, 0xC0, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x7C, 0x00, 0x01, 0xFF, 0x80, 0x7E,
+    0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0xE0, 0x3F, 0xF8,
+    0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
+    0xF8, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x78, 0x01, 0xFF, 0xFF, 0xE0, 0x38, 0x00, 0x7F, 0xFF, 0x80,
+    0x18, 0x00, 0x0F, 0xFC, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x80,
+    0x00, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xFC, 0x01, 0xFF, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0xFC, 0x00,
+    0x7F, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF7, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xE1, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7F, 0xC0, 0x0F, 0xFF, 0x80, 0x1F, 0xC0, 0x07, 0xFF,
+    0x00, 0x07, 0xC0, 0x01, 0xFC, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0xFE,
+    0x00, 0x1F, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x80,
+    0x7F, 0xFF, 0xE0, 0x3F, 0x80, 0x7E, 0x3F, 0xE0, 0x1F, 0x80, 0x7C, 0x1F, 0xE0, 0x0F, 0xC0, 0xFC,
+    0x0F, 0xF0, 0x0F, 0xC0, 0xF8, 0x0F, 0xF0, 0x07, 0xC0, 0xF8, 0x07, 0xF0, 0x07, 0xC0, 0xF8, 0x07,
+    0xF0, 0x07, 0xC0, 0xF8, 0x07, 0xF8, 0x07, 0xC0, 0xF8, 0x03, 0xF8, 0x07, 0xC0, 0xF8, 0x03, 0xF8,
+    0x07, 0xC0, 0xFC, 0x03, 0xFC, 0x0F, 0xC0, 0x7E, 0x03, 0xFC, 0x0F, 0x80, 0x7F, 0x01, 0xFE, 0x1F,
+    0x80, 0x7F, 0x81, 0xFF, 0xFF, 0x80, 0x3F, 0x81, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0xFF, 0xFF, 0x00,
+    0x1F, 0x80, 0x7F, 0xFE, 0x00, 0x0F, 0x80, 0x3F, 0xFC, 0x00, 0x07, 0x80, 0x1F, 0xF8, 0x00, 0x00,
+    0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
+    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
+    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x03,
+    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
+    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
+    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x40, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
+    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0xFF,
+    0xF0, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x3F, 0xFE, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
+    0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
+    0x1F, 0xFF, 0x3F, 0xFE, 0x00, 0x7F, 0xFE, 0x1F, 0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0xFF,
+    0xE0, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0xFC, 0x00,
+    0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
+    0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
+    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x00,
+    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
+    0xC0, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
+    0xF8, 0x00, 0x00, 0xFF, 0xC0, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0xF8,
+    0x00, 0x1F, 0xFF, 0xC0, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0xF8, 0x00, 0xFF, 0xF7, 0xC0, 0xF8, 0x01,
+    0xFF, 0xE7, 0xC0, 0xF8, 0x07, 0xFF, 0x87, 0xC0, 0xF8, 0x0F, 0xFF, 0x07, 0xC0, 0xF8, 0x3F, 0xFC,
+    0x07, 0xC0, 0xF8, 0x7F, 0xF8, 0x07, 0xC0, 0xF9, 0xFF, 0xE0, 0x07, 0xC0, 0xFB, 0xFF, 0xC0, 0x07,
+    0xC0, 0xFF, 0xFF, 0x00, 0x07, 0xC0, 0xFF, 0xFE, 0x00, 0x07, 0xC0, 0xFF, 0xF8, 0x00, 0x07, 0xC0,
+    0xFF, 0xF0, 0x00, 0x07, 0xC0, 0xFF, 0xC0, 0x00, 0x07, 0xC0, 0xFF, 0x80, 0x00, 0x07, 0xC0, 0xFE,
+    0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00,
+    0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0,
+    0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xF8, 0x00, 0x00, 0x00,
+    0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00,
+    0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0x00, 0x1E, 0x00, 0x7E, 0x01, 0xFE, 0x07, 0xFE, 0x1F, 0xFC,
+    0xFF, 0xF0, 0xFF, 0x80, 0xFE, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFC,
+    0x07, 0xFE, 0x01, 0xFE, 0x00, 0x7E, 0x00, 0x1E, 0x00, 0x06, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0x00, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0xFE, 0x7E, 0x1E, 0x06, 0x00, 0x00, 0xFC, 0x00, 0x02,
+    0x03, 0xFE, 0x00, 0x0F, 0x07, 0xFF, 0x00, 0x1F, 0x0F, 0xFF, 0x80, 0x3F, 0x0F, 0xFF, 0x80, 0x7F,
+    0x1F, 0xFF, 0xC0, 0x7F, 0x1F, 0xFF, 0xC0, 0x7F, 0x1F, 0x8F, 0xC0, 0xFC, 0x1F, 0x07, 0xC0, 0xFC,
+    0x1E, 0x07, 0xC0, 0xF8, 0x1E, 0x07, 0xC0, 0xF8, 0x3E, 0x07, 0xC0, 0xF8, 0x3E, 0x07, 0x80, 0xF8,
+    0x3C, 0x0F, 0x80, 0xFC, 0x3C, 0x0F, 0x00, 0xFC, 0x7C, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00,
+    0x3E, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0xF8,
+    0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
+    0x07, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x80, 0x7F,
+    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
+    0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80,
+    0x7F, 0x80, 0x7F, 0xC0, 0x7E, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x07, 0xC0,
+    0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x1F, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x80,
+    0x3F, 0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0x7F, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x0F, 0xC0, 0x7C, 0x00,
+    0x03, 0xC0, 0x70, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x1F,
+    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+    0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
+    0x7C, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x80, 0x7C, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE,
+    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0x1E, 0x3F,
+    0xC0, 0x7E, 0x1E, 0x1F, 0xC0, 0xFC, 0x1E, 0x0F, 0xC0, 0xF8, 0x1E, 0x07, 0xC0, 0xF8, 0x1E, 0x07,
+    0xC0, 0xF8, 0x1E, 0x07, 0xC0, 0xF8, 0x1E, 0x07, 0xE0, 0xF8, 0x1E, 0x07, 0xC0, 0xFC, 0x1E, 0x07,
+    0xC0, 0xFE, 0x1E, 0x0F, 0xC0, 0x7F, 0x9E, 0x1F, 0xC0, 0x7F, 0xFE, 0x1F, 0xC0, 0x3F, 0xFE, 0x1F,
+    0x80, 0x3F, 0xFE, 0x1F, 0x80, 0x1F, 0xFE, 0x1F, 0x00, 0x0F, 0xFE, 0x1E, 0x00, 0x03, 0xFE, 0x1C,
+    0x00, 0x00, 0x7E, 0x10, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC, 0x7C, 0x00, 0x00,
+    0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00,
+    0xF8, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x06, 0x00, 0x0F, 0xFF, 0xFC, 0x07, 0x00, 0x1F, 0xFF,
+    0xFE, 0x07, 0x80, 0x3F, 0xFF, 0xFF, 0x07, 0xC0, 0x7F, 0xFF, 0xFF, 0x8F, 0xE0, 0x7F, 0xFF, 0xFF,
+    0x8F, 0xE0, 0xFF, 0x80, 0x7F, 0xC7, 0xE0, 0xFE, 0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x00, 0x0F, 0xC3,
+    0xF0, 0xF8, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x00, 0x07, 0xC1, 0xF0,
+    0xF8, 0x00, 0x07, 0xC1, 0xF0, 0x78, 0x00, 0x07, 0x81, 0xF0, 0x7C, 0x00, 0x0F, 0x83, 0xF0, 0x3E,
+    0x00, 0x1F, 0x03, 0xF0, 0x1F, 0x80, 0x7E, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
+    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
+    0x03, 0xFF, 0xFF, 0xC0, 0x38, 0x3F, 0xFF, 0xFF, 0xF0, 0x7C, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF,
+    0xFF, 0xF0, 0x7C, 0x3F, 0xFF, 0xFF, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7C, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x7C, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xEF, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x80, 0x00, 0xFF,
+    0x81, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0xF8, 0x00,
+    0x1F, 0xC0, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0x01,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
+    0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
+    0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xC0,
+    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
+    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x7E, 0x00, 0x1F,
+    0xC0, 0xFC, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07,
+    0xE0, 0xF8, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x1F,
+    0xC0, 0x7F, 0x80, 0x7F, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00,
+    0x0F, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07,
+    0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
+    0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
+    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
+    0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
+    0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8,
+    0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
+    0x1F, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x07,
+    0xE0, 0x3C, 0x00, 0x0F, 0xF0, 0x3E, 0x00, 0x3F, 0xF8, 0x3F, 0x00, 0x3F, 0xFC, 0x3F, 0x80, 0x7F,
+    0xFE, 0x3F, 0x80, 0x7F, 0xFE, 0x3F, 0xC0, 0xFF, 0xFE, 0x1F, 0xC0, 0xFC, 0x7E, 0x07, 0xC0, 0xF8,
+    0x3F, 0x07, 0xC0, 0xF8, 0x3F, 0x07, 0xC0, 0xF8, 0x3F, 0x07, 0xE0, 0xF8, 0x3F, 0x07, 0xE0, 0xF8,
+    0x1F, 0x87, 0xC0, 0xFC, 0x1F, 0x87, 0xC0, 0xFE, 0x1F, 0xCF, 0xC0, 0x7F, 0x1F, 0xFF, 0xC0, 0x7F,
+    0x0F, 0xFF, 0x80, 0x3F, 0x0F, 0xFF, 0x80, 0x3F, 0x0F, 0xFF, 0x00, 0x1F, 0x07, 0xFF, 0x00, 0x07,
+    0x03, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x1F, 0x03,
+    0xE0, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
+    0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
+    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x01,
+    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+    0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xC0, 0xE0, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFE, 0x00, 0x1F, 0xC0, 0xFF,
+    0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xF3, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x1F,
+    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xE1, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0x3F, 0xC0, 0xFC,
+    0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x07, 0xC0, 0xE0, 0x00, 0x01, 0xC0, 0x80, 0x00, 0x00, 0x40, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xC0,
+    0x00, 0x03, 0xF0, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xE0,
+    0x03, 0xF0, 0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0xFF, 0xFF, 0x87, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
+    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01,
+    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x7F,
+    0xC0, 0xF8, 0x00, 0xFF, 0xC0, 0xF8, 0x01, 0xFF, 0xC0, 0xF8, 0x07, 0xFF, 0xC0, 0xF8, 0x0F, 0xFF,
+    0xC0, 0xF8, 0x3F, 0xFF, 0xC0, 0xF8, 0x7F, 0xF7, 0xC0, 0xF8, 0xFF, 0xE7, 0xC0, 0xFB, 0xFF, 0xC7,
+    0xC0, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0xFE, 0x07, 0xC0, 0xFF, 0xF8, 0x07, 0xC0, 0xFF, 0xF0, 0x07,
+    0xC0, 0xFF, 0xC0, 0x07, 0xC0, 0xFF, 0x80, 0x07, 0xC0, 0xFF, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x07,
+    0xC0, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xE0, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x00,
+    0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00,
+    0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0,
+    0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0x80, 0x1F, 0x80, 0x3F, 0x80, 0x7F, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0xFC, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3F, 0x00,
+    0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0,
+    0x7F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0xFF, 0xFF, 0xC7, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x07, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x07,
+    0xC0, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xC0, 0x00, 0x00, 0xFF,
+    0xF0, 0x07, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x07, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xC0, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x04, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0xE0, 0x00, 0x00, 0x00,
+    0x0F, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xE0,
+    0xF0, 0xF8, 0xFC, 0xFC, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x07,
+    0xC0, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
+    0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x38, 0x1F, 0xF0, 0x30, 0x7C, 0x7F, 0xFC, 0x7C, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xC0, 0x07, 0xE0, 0x1F, 0x00,
+    0x01, 0xF0, 0x1E, 0x00, 0x00, 0xF0, 0x3E, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0x78, 0x7C, 0x00,
+    0x00, 0x7C, 0x78, 0x00, 0x00, 0x3C, 0x78, 0x00, 0x00, 0x3C, 0x78, 0x00, 0x00, 0x3C, 0x78, 0x00,
+    0x00, 0x3C, 0x78, 0x00, 0x00, 0x3C, 0x78, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C, 0x3C, 0x00,
+    0x00, 0x78, 0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x01, 0xF0, 0x1F, 0x80, 0x03, 0xF0, 0x1F, 0xC0,
+    0x07, 0xE0, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0x7C, 0x7F,
+    0xFC, 0x7C, 0x38, 0x0F, 0xE0, 0x38, 0x10, 0x00, 0x00, 0x10, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xF0,
+    0xFF, 0x80, 0x00, 0x01, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xF0, 0xE0,
+    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
+    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x3F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xC0,
+    0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xF8,
+    0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x0F, 0xC7, 0xFC, 0x03, 0xF0, 0x00, 0x0F,
+    0x83, 0xFC, 0x01, 0xF8, 0x00, 0x1F, 0x81, 0xFE, 0x01, 0xF8, 0x06, 0x1F, 0x01, 0xFE, 0x00, 0xF8,
+    0x1E, 0x1F, 0x00, 0xFE, 0x00, 0xF8, 0x7E, 0x1F, 0x00, 0xFE, 0x00, 0xF8, 0xFE, 0x1F, 0x00, 0xFF,
+    0x00, 0xF8, 0xFE, 0x1F, 0x00, 0x7F, 0x00, 0xF8, 0xFC, 0x1F, 0x00, 0x7F, 0x00, 0xF8, 0xF8, 0x1F,
+    0x80, 0x7F, 0x81, 0xF8, 0xE0, 0x0F, 0xC0, 0x7F, 0x81, 0xF0, 0xC0, 0x0F, 0xE0, 0x3F, 0xC3, 0xF0,
+    0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x1F,
+    0xFF, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00,
+    0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
+    0xC1, 0xFE, 0x00, 0xE0, 0x1F, 0xF1, 0xFF, 0x00, 0xF0, 0x3F, 0xFB, 0xFF, 0x80, 0xF8, 0x3F, 0xFF,
+    0xFF, 0xC0, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0xFE, 0x7F, 0xFF, 0x8F, 0xE0, 0xFE, 0xFF, 0xFF, 0x07,
+    0xE0, 0xFE, 0xFC, 0x7F, 0x87, 0xF0, 0x3F, 0xF8, 0x3F, 0x83, 0xF0, 0x3F, 0xF8, 0x3F, 0x83, 0xF8,
+    0x1F, 0xF8, 0x1F, 0xC1, 0xF8, 0x1F, 0xF8, 0x1F, 0xC1, 0xFC, 0x1F, 0xFC, 0x0F, 0xE1, 0xFC, 0x1F,
+    0xFF, 0x0F, 0xE0, 0xFE, 0x3F, 0x7F, 0x07, 0xF0, 0xFF, 0xFF, 0x7F, 0x07, 0xF9, 0xFF, 0xFE, 0x3F,
+    0x03, 0xFF, 0xFF, 0xFE, 0x1F, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0x01, 0xFF, 0xDF, 0xFC, 0x07, 0x00,
+    0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x7C, 0xFE,
+    0xFE, 0xFE, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x38, 0x7C, 0xFE, 0xFE, 0xFE, 0x7C, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80,
+    0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xC0, 0x80, 0x03, 0xFF, 0xF0, 0x3F, 0xE0, 0xC0, 0x07, 0xFF, 0xF8,
+    0x3F, 0xE0, 0xE0, 0x07, 0xFF, 0xF8, 0x3F, 0xF0, 0xF0, 0x0F, 0xFF, 0xFC, 0x07, 0xF0, 0xFC, 0x0F,
+    0xC7, 0xFC, 0x03, 0xF0, 0xFE, 0x0F, 0x83, 0xFC, 0x01, 0xF8, 0x7F, 0x1F, 0x81, 0xFE, 0x01, 0xF8,
+    0x3F, 0x1F, 0x01, 0xFE, 0x00, 0xF8, 0x1F, 0x1F, 0x00, 0xFE, 0x00, 0xF8, 0x0F, 0x1F, 0x00, 0xFE,
+    0x00, 0xF8, 0x1F, 0x1F, 0x00, 0xFF, 0x00, 0xF8, 0x3F, 0x1F, 0x00, 0x7F, 0x00, 0xF8, 0x7F, 0x1F,
+    0x00, 0x7F, 0x00, 0xF8, 0xFE, 0x1F, 0x80, 0x7F, 0x81, 0xF8, 0xFC, 0x1F, 0x80, 0x7F, 0x81, 0xF0,
+    0xF0, 0x0F, 0xE0, 0x3F, 0xC3, 0xF0, 0xE0, 0x0F, 0xF0, 0x3F, 0xFF, 0xF0, 0xC0, 0x07, 0xF0, 0x3F,
+    0xFF, 0xF0, 0x80, 0x07, 0xF0, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xFF, 0xC0, 0x00, 0x01,
+    0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xFC,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
+    0xC0, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0x80, 0x00,
+    0x7E, 0x3F, 0xE0, 0x1F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xF0, 0x0F,
+    0xC0, 0x70, 0xF8, 0x0F, 0xF0, 0x07, 0xC8, 0x70, 0xF8, 0x07, 0xF0, 0x07, 0xF8, 0x70, 0xF8, 0x07,
+    0xF0, 0x07, 0xF8, 0x70, 0xF8, 0x07, 0xF8, 0x07, 0xFC, 0xE0, 0xF8, 0x03, 0xF8, 0x07, 0xDF, 0xE0,
+    0xF8, 0x03, 0xF8, 0x07, 0xDF, 0xE0, 0xFC, 0x03, 0xFC, 0x0F, 0xCF, 0xC0, 0x7E, 0x03, 0xFC, 0x0F,
+    0x87, 0x80, 0x7F, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0x7F, 0x81, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x81,
+    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0xFE, 0x00, 0x00,
+    0x0F, 0x80, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x3F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0,
+    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x00,
+    0x1F, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3E,
+    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x3E, 0x00, 0x3F, 0xFD, 0xF0, 0x00, 0x3E, 0x00, 0x7F, 0xF9, 0xF0, 0x06, 0x3E, 0x01, 0xFF,
+    0xE1, 0xF0, 0x3E, 0x3E, 0x03, 0xFF, 0xC1, 0xF0, 0xFE, 0x3E, 0x0F, 0xFF, 0x01, 0xF0, 0xFE, 0x3E,
+    0x1F, 0xFE, 0x01, 0xF0, 0xFE, 0x3E, 0x7F, 0xF8, 0x01, 0xF0, 0xF8, 0x3E, 0xFF, 0xF0, 0x01, 0xF0,
+    0xF0, 0x3F, 0xFF, 0xC0, 0x01, 0xF0, 0xC0, 0x3F, 0xFF, 0x80, 0x01, 0xF0, 0x80, 0x3F, 0xFE, 0x00,
+    0x01, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F,
+    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0,
+    0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x00,
+    0x01, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xF8, 0x80, 0x1F,
+    0x00, 0x00, 0x1F, 0xF8, 0xC0, 0x1F, 0x00, 0x00, 0x7F, 0xF8, 0xE0, 0x1F, 0x00, 0x00, 0xFF, 0xF8,
+    0xF0, 0x1F, 0x00, 0x03, 0xFF, 0xF8, 0xF8, 0x1F, 0x00, 0x07, 0xFF, 0xF8, 0xFC, 0x1F, 0x00, 0x1F,
+    0xFE, 0xF8, 0x7F, 0x1F, 0x00, 0x3F, 0xFC, 0xF8, 0x3F, 0x1F, 0x00, 0xFF, 0xF0, 0xF8, 0x1F, 0x1F,
+    0x01, 0xFF, 0xE0, 0xF8, 0x1F, 0x1F, 0x07, 0xFF, 0x80, 0xF8, 0x3F, 0x1F, 0x0F, 0xFF, 0x00, 0xF8,
+    0x7F, 0x1F, 0x3F, 0xFC, 0x00, 0xF8, 0xFE, 0x1F, 0x7F, 0xF8, 0x00, 0xF8, 0xFC, 0x1F, 0xFF, 0xE0,
+    0x00, 0xF8, 0xF8, 0x1F, 0xFF, 0xC0, 0x00, 0xF8, 0xE0, 0x1F, 0xFF, 0x00, 0x00, 0xF8, 0xC0, 0x1F,
+    0xFE, 0x00, 0x00, 0xF8, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF8,
+    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xF8,
+    0x00, 0x1F, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x03,
+    0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x07, 0xFF, 0xF8, 0x38, 0x1F, 0x00, 0x1F, 0xFE, 0xF8, 0x7C, 0x1F,
+    0x00, 0x3F, 0xF8, 0xF8, 0xFE, 0x1F, 0x00, 0xFF, 0xF0, 0xF8, 0xFE, 0x1F, 0x01, 0xFF, 0xC0, 0xF8,
+    0xFE, 0x1F, 0x07, 0xFF, 0x80, 0xF8, 0xFE, 0x1F, 0x0F, 0xFF, 0x00, 0xF8, 0x7C, 0x1F, 0x3F, 0xFC,
+    0x00, 0xF8, 0x38, 0x1F, 0x7F, 0xF8, 0x00, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xF8,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xF0,
+    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x7E, 0x1F, 0x80,
+    0xFC, 0x0F, 0x80, 0xF8, 0x07, 0x80, 0xF8, 0x07, 0x80, 0xF8, 0x07, 0x80, 0xFC, 0x0F, 0x80, 0x7E,
+    0x1F, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0x00, 0x00,
+    0x1F, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0x1F, 0xFF, 0xC0, 0x00, 0x7F,
+    0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0x1F, 0x8F, 0xC0, 0x00, 0xFC, 0x1F, 0x07, 0xC0, 0x00, 0xFC, 0x1E,
+    0x07, 0xC0, 0x00, 0xF8, 0x1E, 0x07, 0xC0, 0x00, 0xF8, 0x3E, 0x07, 0xC0, 0x00, 0xF8, 0x3E, 0x07,
+    0x80, 0x00, 0xF8, 0x3C, 0x0F, 0x80, 0x00, 0xFC, 0x3C, 0x0F, 0x1F, 0x00, 0xFC, 0x7C, 0x3E, 0x3F,
+    0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE1, 0xE0, 0x0F, 0xFF, 0xFF, 0xE1, 0xE0, 0x03,
+    0xFF, 0xFF, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0xFF,
+    0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0x71, 0xE0, 0x61, 0xE0, 0x41, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x07, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x02, 0x0E, 0x3E, 0xFE, 0xFE, 0xFE, 0xF8, 0xF0, 0xC0, 0x80, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x01, 0xF8,
+    0x0F, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0x80, 0x00, 0x0F, 0xFE, 0x0F, 0xC0, 0x00, 0x0F, 0xFF, 0x0F,
+    0xE0, 0x00, 0x1F, 0xFF, 0x8F, 0xE0, 0x00, 0x1F, 0xFF, 0x8F, 0xF0, 0x00, 0x3F, 0xFF, 0x87, 0xF0,
+    0x00, 0x3F, 0x1F, 0x81, 0xF0, 0x02, 0x3E, 0x0F, 0xC1, 0xF0, 0x0E, 0x3E, 0x0F, 0xC1, 0xF0, 0x3E,
+    0x3E, 0x0F, 0xC1, 0xF8, 0xFE, 0x3E, 0x0F, 0xC1, 0xF8, 0xFE, 0x3E, 0x07, 0xE1, 0xF0, 0xFE, 0x3F,
+    0x07, 0xE1, 0xF0, 0xF8, 0x3F, 0x87, 0xF3, 0xF0, 0xF0, 0x1F, 0xC7, 0xFF, 0xF0, 0xC0, 0x1F, 0xC3,
+    0xFF, 0xE0, 0x80, 0x0F, 0xC3, 0xFF, 0xE0, 0x00, 0x0F, 0xC3, 0xFF, 0xC0, 0x00, 0x07, 0xC1, 0xFF,
+    0xC0, 0x00, 0x01, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8,
+    0xFE, 0x7F, 0x3F, 0x1F, 0x0F, 0x1F, 0x3F, 0x7F, 0xFE, 0xFC, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0xE0,
+    0x00, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF9, 0xE0, 0xBF, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x80, 0x00, 0x01, 0xFE, 0x07, 0xC0, 0xC0,
+    0x07, 0xFF, 0x07, 0xE0, 0xE0, 0x07, 0xFF, 0x87, 0xF0, 0xF0, 0x0F, 0xFF, 0xC7, 0xF0, 0xF8, 0x0F,
+    0xFF, 0xC7, 0xF8, 0xFC, 0x1F, 0xFF, 0xC3, 0xF8, 0xFF, 0x1F, 0x8F, 0xC0, 0xF8, 0x3F, 0x9F, 0x07,
+    0xE0, 0xF8, 0x1F, 0x9F, 0x07, 0xE0, 0xF8, 0x0F, 0x9F, 0x07, 0xE0, 0xFC, 0x0F, 0x9F, 0x07, 0xE0,
+    0xFC, 0x1F, 0x9F, 0x03, 0xF0, 0xF8, 0x7F, 0x9F, 0x83, 0xF0, 0xF8, 0xFE, 0x1F, 0xC3, 0xF9, 0xF8,
+    0xFC, 0x0F, 0xE3, 0xFF, 0xF8, 0xF8, 0x0F, 0xE1, 0xFF, 0xF0, 0xF0, 0x07, 0xE1, 0xFF, 0xF0, 0xE0,
+    0x07, 0xE1, 0xFF, 0xE0, 0x80, 0x03, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0xE0, 0x7F, 0xC0, 0x00, 0x00,
+    0x00, 0x3F, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x00, 0x0F, 0xF0, 0x3E,
+    0x00, 0x00, 0x3F, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0x80, 0x00, 0x7F, 0xFE, 0x3F, 0x80,
+    0x00, 0x7F, 0xFE, 0x3F, 0xC0, 0x00, 0xFF, 0xFE, 0x1F, 0xC0, 0x00, 0xFC, 0x7E, 0x07, 0xC0, 0x38,
+    0xF8, 0x3F, 0x07, 0xC0, 0x38, 0xF8, 0x3F, 0x07, 0xFC, 0x38, 0xF8, 0x3F, 0x07, 0xFC, 0x38, 0xF8,
+    0x3F, 0x07, 0xFC, 0x70, 0xF8, 0x1F, 0x87, 0xFF, 0xF0, 0xFC, 0x1F, 0x87, 0xCF, 0xF0, 0xFE, 0x1F,
+    0xCF, 0xCF, 0xE0, 0x7F, 0x1F, 0xFF, 0xC7, 0xC0, 0x7F, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0x0F, 0xFF,
+    0x80, 0x00, 0x3F, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0x07, 0xFF, 0x00, 0x00, 0x07, 0x03, 0xFE, 0x00,
+    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x80,
+    0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0xFF, 0x8F, 0x80, 0x00,
+    0x7C, 0xFF, 0x8F, 0x80, 0x00, 0x7C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00,
+    0x3E, 0x00, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0x00, 0x3F, 0xF0, 0x00, 0x3E,
+    0x00, 0x7F, 0xF0, 0x00, 0x3E, 0x01, 0xFF, 0xF0, 0x00, 0x3E, 0x03, 0xFF, 0xF0, 0x06, 0x3E, 0x0F,
+    0xFF, 0xF0, 0x1E, 0x3E, 0x1F, 0xFD, 0xF0, 0x7E, 0x3E, 0x3F, 0xF9, 0xF0, 0xFE, 0x3E, 0xFF, 0xF1,
+    0xF0, 0xFE, 0x3F, 0xFF, 0xC1, 0xF0, 0xFC, 0x3F, 0xFF, 0x81, 0xF0, 0xF8, 0x3F, 0xFE, 0x01, 0xF0,
+    0xE0, 0x3F, 0xFC, 0x01, 0xF0, 0xC0, 0x3F, 0xF0, 0x01, 0xF0, 0x00, 0x3F, 0xE0, 0x01, 0xF0, 0x00,
+    0x3F, 0xC0, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x00,
+    0x00, 0x01, 0xF0, 0x06, 0x0E, 0x3E, 0x7E, 0xFE, 0xFC, 0xF0, 0xE0, 0xC2, 0x86, 0x0E, 0x1E, 0x7E,
+    0xFE, 0xFC, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x80, 0x1F, 0x00, 0x01,
+    0xF8, 0xC0, 0x1F, 0x00, 0x03, 0xF8, 0xF0, 0x1F, 0x00, 0x0F, 0xF8, 0xF8, 0x1F, 0x00, 0x1F, 0xF8,
+    0xFC, 0x1F, 0x00, 0x3F, 0xF8, 0xFE, 0x1F, 0x00, 0xFF, 0xF8, 0x7F, 0x1F, 0x01, 0xFF, 0xF8, 0x3F,
+    0x9F, 0x07, 0xFF, 0xF8, 0x0F, 0x9F, 0x0F, 0xFE, 0xF8, 0x07, 0x9F, 0x1F, 0xFC, 0xF8, 0x1F, 0x9F,
+    0x7F, 0xF8, 0xF8, 0x3F, 0x9F, 0xFF, 0xE0, 0xF8, 0x7F, 0x1F, 0xFF, 0xC0, 0xF8, 0xFE, 0x1F, 0xFF,
+    0x00, 0xF8, 0xFC, 0x1F, 0xFE, 0x00, 0xF8, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0xF0, 0x1F, 0xF0, 0x00,
+    0xF8, 0xC0, 0x1F, 0xE0, 0x00, 0xF8, 0x80, 0x1F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00,
+    0x3E, 0x00, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x3E, 0x00, 0x3F, 0xF0, 0x00, 0x3E,
+    0x00, 0x7F, 0xF0, 0x00, 0x3E, 0x00, 0xFF, 0xF0, 0x38, 0x3E, 0x03, 0xFF, 0xF0, 0x7C, 0x3E, 0x07,
+    0xFF, 0xF0, 0xFE, 0x3E, 0x0F, 0xFF, 0xF0, 0xFE, 0x3E, 0x3F, 0xFD, 0xF0, 0xFE, 0x3E, 0x7F, 0xF1,
+    0xF0, 0xFE, 0x3E, 0xFF, 0xE1, 0xF0, 0x7C, 0x3F, 0xFF, 0x81, 0xF0, 0x38, 0x3F, 0xFF, 0x01, 0xF0,
+    0x00, 0x3F, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0xF8, 0x01, 0xF0, 0x00, 0x3F, 0xE0, 0x01, 0xF0, 0x00,
+    0x3F, 0xC0, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x00,
+    0x00, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x06,
+    0x3E, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x3E, 0x00, 0x3E, 0x00,
+    0x00, 0xFE, 0x3E, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x3E, 0x00, 0x3F, 0xE0, 0x00, 0xFC, 0x3E, 0x00,
+    0x3F, 0xF8, 0x00, 0xF8, 0x3F, 0x00, 0x7F, 0xFC, 0x00, 0xE0, 0x3F, 0x80, 0xFF, 0xFF, 0x00, 0xC0,
+    0x1F, 0xC1, 0xFF, 0xFF, 0xC0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFD, 0xFF,
+    0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xFF,
+    0xE0, 0x07, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
+    0xF1, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xF0, 0x00, 0x06, 0x3F, 0xFC, 0x01, 0xF0, 0x00, 0x3E,
+    0x3F, 0xE0, 0x01, 0xF0, 0x00, 0xFE, 0x3F, 0xE0, 0x01, 0xF0, 0x00, 0xFE, 0x3F, 0xFC, 0x01, 0xF0,
+    0x00, 0xFE, 0x3F, 0xFF, 0x81, 0xF0, 0x00, 0xF8, 0x3F, 0xFF, 0xF1, 0xF0, 0x00, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xF0, 0x00, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x80, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x03,
+    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0x7F, 0xFF, 0xFE,
+    0x00, 0x1F, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0x1F, 0xFF,
+    0xF8, 0xF8, 0x00, 0xFE, 0x1F, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x1F, 0xFE, 0x00, 0xF8, 0x00, 0xF0,
+    0x1F, 0xF0, 0x00, 0xF8, 0x00, 0xF0, 0x1F, 0xF0, 0x00, 0xF8, 0x00, 0xF8, 0x1F, 0xFE, 0x00, 0xF8,
+    0x00, 0xFE, 0x1F, 0xFF, 0xC0, 0xF8, 0x00, 0x7F, 0x1F, 0xFF, 0xF8, 0xF8, 0x00, 0x3F, 0x1F, 0xFF,
+    0xFF, 0xF8, 0x00, 0x1F, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
+    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0xFF, 0xFF, 0xFC,
+    0x00, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x3F, 0xFF,
+    0xF9, 0xF0, 0x00, 0x3E, 0x3F, 0xFF, 0xC1, 0xF0, 0x00, 0x1E, 0x3F, 0xFE, 0x01, 0xF0, 0x00, 0x1E,
+    0x3F, 0xF8, 0x01, 0xF0, 0x00, 0x1E, 0x3F, 0xC0, 0x01, 0xF0, 0x00, 0x1E, 0x3F, 0xF8, 0x01, 0xF0,
+    0x00, 0x1E, 0x3F, 0xFF, 0x01, 0xF0, 0x00, 0x3E, 0x3F, 0xFF, 0xE1, 0xF0, 0x00, 0xFC, 0x3F, 0xFF,
+    0xFD, 0xF0, 0x00, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xF0,
+    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x38, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x7C, 0x00, 0x3F, 0xFF, 0xFF,
+    0x00, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFE, 0x1F, 0xFF,
+    0xFE, 0xF8, 0x00, 0x7C, 0x1F, 0xFF, 0xF0, 0xF8, 0x00, 0x38, 0x1F, 0xFF, 0x80, 0xF8, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xF8,
+    0x00, 0x38, 0x1F, 0xFF, 0x80, 0xF8, 0x00, 0x7C, 0x1F, 0xFF, 0xF0, 0xF8, 0x00, 0xFE, 0x1F, 0xFF,
+    0xFE, 0xF8, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7C,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x38, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x1E, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0,
+    0x00, 0x00, 0x00, 0x01, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
+    0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x01,
+    0xF8, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x02, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0E, 0x1F, 0x00,
+    0x00, 0x00, 0xF8, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xFE,
+    0x1F, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x1F, 0x80, 0x00, 0x01,
+    0xF8, 0xE0, 0x0F, 0xC0, 0x00, 0x01, 0xF0, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x00,
+    0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x7E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x03,
+    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7E,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
+    0x70, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x70, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x70, 0xF8, 0x00, 0x00,
+    0x07, 0xF8, 0x70, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0xE0, 0xF8, 0x00, 0x00, 0x07, 0xDF, 0xE0, 0xF8,
+    0x00, 0x00, 0x07, 0xDF, 0xE0, 0xFC, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x7C, 0x00, 0x00, 0x0F, 0xC7,
+    0x80, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xF0, 0x01,
+    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x1F,
+    0xF0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00,
+    0x00, 0x01, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0xE0, 0x07, 0xF8,
+    0x00, 0x1F, 0xE0, 0xF0, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFC,
+    0x0F, 0x80, 0x00, 0x01, 0xF8, 0xFF, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x3F, 0x1F, 0x00, 0x00, 0x00,
+    0xF8, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x1F, 0x00,
+    0x00, 0x00, 0xF8, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xFE,
+    0x1F, 0x80, 0x00, 0x01, 0xF8, 0xFC, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0xF8, 0x0F, 0xC0, 0x00, 0x03,
+    0xF0, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x80, 0x07, 0xFC,
+    0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00,
+    0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x38,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x06, 0x3E, 0x00,
+    0xF8, 0x01, 0xF0, 0x1E, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x7E, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0xFE,
+    0x3E, 0x00, 0xF8, 0x01, 0xF0, 0xFE, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0xFC, 0x3E, 0x00, 0xF8, 0x01,
+    0xF0, 0xF8, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0xE0, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0xC0, 0x3E, 0x00,
+    0xF8, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x00,
+    0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x01,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0,
+    0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0xF8, 0x03, 0xE0,
+    0x07, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0xF8,
+    0x03, 0xE0, 0x07, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xDF, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xFF,
+    0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xFF, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xFF, 0xE0, 0xF8, 0x03, 0xE0,
+    0x07, 0xFF, 0xE0, 0xF8, 0x03, 0xE0, 0x07, 0xFF, 0xE0, 0xF8, 0x03, 0xE0, 0x07, 0xE1, 0xE0, 0xF8,
+    0x03, 0xE0, 0x07, 0xE1, 0xE0, 0xF8, 0x00, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x38, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7C, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x1F, 0x00, 0x7C, 0x00,
+    0xF8, 0x7C, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x38, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+    0x7C, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x38,
+    0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x7C, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0xFE, 0x1F, 0x00, 0x7C, 0x00,
+    0xF8, 0xFE, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0xFE, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x7C, 0x1F, 0x00,
+    0x7C, 0x00, 0xF8, 0x38, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00,
+    0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x7E, 0x1F, 0x00, 0x7C, 0x00,
+    0xF8, 0x3F, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x1F, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x0F, 0x1F, 0x00,
+    0x7C, 0x00, 0xF8, 0x1F, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x3F, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0xFE,
+    0x1F, 0x00, 0x7C, 0x00, 0xF8, 0xFC, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0xF8, 0x1F, 0x00, 0x7C, 0x00,
+    0xF8, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0xE0, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0xC0, 0x1F, 0x00,
+    0x7C, 0x00, 0xF8, 0x80, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x0E, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+    0xF8, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x1F, 0x00,
+    0x00, 0x00, 0xF8, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xF0, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0xE0,
+    0x0F, 0x80, 0x00, 0x01, 0xF0, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x80, 0x0F, 0xE0, 0x00, 0x07,
+    0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xF8, 0x03, 0xC0, 0x07, 0xC0, 0xF8, 0x03, 0xC0, 0x07, 0xC0, 0xF8, 0x03, 0xC0,
+    0x07, 0xC0, 0xF8, 0x03, 0xC0, 0x07, 0xC0, 0xF8, 0x03, 0xC0, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07,
+    0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x07, 0xC0,
+    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x7F,
+    0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
+    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x06, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1E,
+    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xF8, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xF0,
+    0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x00,
+    0x00, 0x7E, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
+    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFE,
+    0x00, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xE0, 0x00, 0x00,
+    0x00, 0xFF, 0xE0, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xF8,
+    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
+    0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0xF8, 0x0E, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x1F, 0x00,
+    0x00, 0x00, 0xF8, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0x1F, 0x80, 0x00, 0x01, 0xF8, 0xF0, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0xE0, 0x0F, 0xC0, 0x00, 0x03,
+    0xF0, 0x80, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF,
+    0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x83, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0x83, 0xFC,
+    0x00, 0x0F, 0xF0, 0x07, 0x87, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0x87, 0xE0, 0x00, 0x01, 0xF8, 0x3F,
+    0x87, 0xC0, 0x00, 0x00, 0xF8, 0x7F, 0x8F, 0xC0, 0x00, 0x00, 0xFC, 0xFE, 0x0F, 0x80, 0x00, 0x00,
+    0x7C, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0xF8, 0x0F, 0x80,
+    0x00, 0x00, 0x7C, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x7F,
+    0x8F, 0xC0, 0x00, 0x00, 0xFC, 0x1F, 0x87, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0x87, 0xE0, 0x00, 0x01,
+    0xF8, 0x07, 0x87, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0x83, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0x83, 0xFF,
+    0x80, 0x3F, 0xF0, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xF8,
+    0x00, 0x1F, 0xE0, 0x06, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x0E, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3E,
+    0x0F, 0x80, 0x00, 0x01, 0xF0, 0x7E, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0xFE, 0x1F, 0x00, 0x00, 0x00,
+    0xF8, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xE0, 0x1F, 0x00,
+    0x00, 0x00, 0xF8, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x86, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0E,
+    0x1F, 0x80, 0x00, 0x01, 0xF8, 0x1E, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x3E, 0x0F, 0xC0, 0x00, 0x03,
+    0xF0, 0xFE, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0xFC, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0xF8, 0x07, 0xFF,
+    0x00, 0x7F, 0xE0, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x80,
+    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x38, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x7C, 0x07, 0xF8,
+    0x00, 0x1F, 0xE0, 0xFE, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0xFE, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFE,
+    0x0F, 0x80, 0x00, 0x01, 0xF0, 0x7C, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x38, 0x1F, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x38, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x7C,
+    0x1F, 0x80, 0x00, 0x01, 0xF8, 0xFE, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0xFE, 0x0F, 0xC0, 0x00, 0x03,
+    0xF0, 0xFE, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x7C, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x38, 0x07, 0xFF,
+    0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x08, 0x00, 0x08,
+    0x1C, 0x00, 0x1C, 0x3E, 0x00, 0x3E, 0x7F, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0x7F, 0xC1, 0xFE, 0x3F,
+    0xE3, 0xFE, 0x1F, 0xF7, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF,
+    0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8,
+    0x1F, 0xF7, 0xFC, 0x3F, 0xE3, 0xFE, 0x7F, 0xC1, 0xFF, 0x7F, 0x80, 0xFF, 0x3F, 0x00, 0x7E, 0x1E,
+    0x00, 0x3C, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xF8, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x1F,
+    0x00, 0x1F, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x00,
+    0x0F, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x1F, 0x00, 0x1F,
+    0xF0, 0x00, 0x7E, 0x1F, 0x00, 0x1F, 0xFC, 0x00, 0xFC, 0x1F, 0x80, 0x3F, 0xFE, 0x00, 0xF8, 0x1F,
+    0xC0, 0x7F, 0xFF, 0x80, 0xF0, 0x0F, 0xE0, 0xFF, 0xFF, 0xE0, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xC0, 0x0F, 0xFF, 0xFE, 0xFF, 0xF8, 0x80, 0x07, 0xFF, 0xFC, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8,
+    0x0F, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0x1E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x7F, 0x80, 0x00, 0x00,
+    0x00, 0x3E, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0xE1, 0xC0,
+    0x00, 0x00, 0x00, 0x3E, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3E,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xF0, 0x00,
+    0x00, 0x00, 0x01, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xF0,
+    0x1E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x86, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x0E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7E, 0x00, 0x00, 0x00,
+    0x03, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x38, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7C, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xFE, 0x00,
+    0x00, 0x00, 0x01, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xFE, 0x00,
+    0x00, 0x00, 0x01, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x7C, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x38, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x02, 0x00,
+    0x07, 0xFF, 0xFF, 0xF0, 0x1E, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x7E, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
+    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xF0, 0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x80, 0x03,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x38, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE0, 0xF8, 0x00, 0x00, 0x00,
+    0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x03,
+    0xE0, 0x07, 0xC0, 0xFC, 0x07, 0xE0, 0x07, 0xC0, 0x7E, 0x0F, 0xF0, 0x0F, 0xC0, 0x7F, 0xFF, 0xF0,
+    0x0F, 0xC0, 0x7F, 0xFF, 0xFC, 0x3F, 0xC0, 0x3F, 0xFE, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xFF,
+    0x80, 0x1F, 0xFC, 0x7F, 0xFF, 0x80, 0x0F, 0xF8, 0x7F, 0xFF, 0x00, 0x03, 0xF0, 0x3F, 0xFE, 0x00,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x02, 0x3F, 0xFF, 0xFF, 0xF0, 0x0E, 0x3F, 0xFF, 0xFF, 0xF0, 0x3E, 0x07, 0xC0,
+    0x00, 0x00, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x1E, 0x00, 0x00,
+    0x00, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0xC0, 0x3E, 0x00, 0x00, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0x80, 0x00, 0x03, 0xC1, 0xFF, 0xC0, 0x00, 0x07, 0xC3, 0xFF, 0xE0, 0x00, 0x0F,
+    0xC3, 0xFF, 0xE0, 0x00, 0x1F, 0xC7, 0xFF, 0xF0, 0x00, 0x1F, 0xC7, 0xFF, 0xF0, 0x00, 0x1F, 0xC7,
+    0xE3, 0xF0, 0x00, 0x3F, 0x07, 0xC1, 0xF0, 0x00, 0x3F, 0x07, 0x81, 0xF0, 0x02, 0x3E, 0x07, 0x81,
+    0xF0, 0x1E, 0x3E, 0x0F, 0x81, 0xF0, 0x7E, 0x3E, 0x0F, 0x81, 0xE0, 0xFE, 0x3E, 0x0F, 0x03, 0xE0,
+    0xFE, 0x3F, 0x0F, 0x03, 0xC0, 0xFC, 0x3F, 0x1F, 0x0F, 0x80, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0xE0,
+    0x1F, 0xFF, 0xFF, 0xF0, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
+    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x1F, 0x80, 0x00, 0x00, 0x40, 0x7F, 0xC0, 0x00, 0x01, 0xE0, 0xFF, 0xE0, 0x01, 0x03, 0xE1, 0xFF,
+    0xF0, 0x03, 0x07, 0xE1, 0xFF, 0xF0, 0x07, 0x0F, 0xE3, 0xFF, 0xF8, 0x0F, 0x0F, 0xE3, 0xFF, 0xF8,
+    0x1F, 0x0F, 0xE3, 0xF1, 0xF8, 0x7F, 0x1F, 0x83, 0xE0, 0xF8, 0xFF, 0x1F, 0x83, 0xC0, 0xF8, 0xFC,
+    0x1F, 0x03, 0xC0, 0xF8, 0xF8, 0x1F, 0x07, 0xC0, 0xF8, 0xF0, 0x1F, 0x07, 0xC0, 0xF0, 0xF8, 0x1F,
+    0x07, 0x81, 0xF0, 0xFC, 0x1F, 0x87, 0x81, 0xE0, 0xFF, 0x1F, 0x8F, 0x87, 0xC0, 0x3F, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x1F, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x0F, 0xFF, 0xFF, 0xF8, 0x07, 0x07, 0xFF, 0xFF,
+    0xF8, 0x03, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x03, 0xC1, 0xFF, 0xC0, 0x00,
+    0x07, 0xC3, 0xFF, 0xE0, 0xE0, 0x0F, 0xC3, 0xFF, 0xE0, 0xF0, 0x1F, 0xC7, 0xFF, 0xF0, 0xF8, 0x1F,
+    0xC7, 0xFF, 0xF0, 0xFC, 0x1F, 0xC7, 0xE3, 0xF0, 0xFC, 0x3F, 0x07, 0xC1, 0xF0, 0x3E, 0x3F, 0x07,
+    0x81, 0xF0, 0x1E, 0x3E, 0x07, 0x81, 0xF0, 0x1E, 0x3E, 0x0F, 0x81, 0xF0, 0x1E, 0x3E, 0x0F, 0x81,
+    0xE0, 0x1E, 0x3E, 0x0F, 0x03, 0xE0, 0x1E, 0x3F, 0x0F, 0x03, 0xC0, 0x3E, 0x3F, 0x1F, 0x0F, 0x80,
+    0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0,
+    0x0F, 0xFF, 0xFF, 0xF0, 0xE0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x40, 0x7F, 0xC0, 0x00, 0x01, 0xE0,
+    0xFF, 0xE0, 0x00, 0x03, 0xE1, 0xFF, 0xF0, 0x38, 0x07, 0xE1, 0xFF, 0xF0, 0x7C, 0x0F, 0xE3, 0xFF,
+    0xF8, 0xFE, 0x0F, 0xE3, 0xFF, 0xF8, 0xFE, 0x0F, 0xE3, 0xF1, 0xF8, 0xFE, 0x1F, 0x83, 0xE0, 0xF8,
+    0x7C, 0x1F, 0x83, 0xC0, 0xF8, 0x38, 0x1F, 0x03, 0xC0, 0xF8, 0x00, 0x1F, 0x07, 0xC0, 0xF8, 0x00,
+    0x1F, 0x07, 0xC0, 0xF0, 0x00, 0x1F, 0x07, 0x81, 0xF0, 0x38, 0x1F, 0x87, 0x81, 0xE0, 0x7C, 0x1F,
+    0x8F, 0x87, 0xC0, 0xFE, 0x0F, 0xFF, 0xFF, 0xF8, 0xFE, 0x0F, 0xFF, 0xFF, 0xF8, 0xFE, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x7C, 0x07, 0xFF, 0xFF, 0xF8, 0x38, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x1E, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
+    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xE0, 0x1F, 0xF0,
+    0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x06, 0x3E, 0x00, 0x01, 0xF0, 0x1E,
+    0x3E, 0x00, 0x01, 0xF0, 0x7E, 0x3E, 0x00, 0x01, 0xF8, 0xFE, 0x3E, 0x00, 0x01, 0xF8, 0xFE, 0x3E,
+    0x00, 0x01, 0xF0, 0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xF8, 0x3F, 0x80, 0x07, 0xF0, 0xE0, 0x1F, 0xF0,
+    0x1F, 0xF0, 0xC0, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x1F,
+    0xC0, 0x00, 0x07, 0xF0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x1C, 0x00,
+    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
+    0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
+    0xC0, 0x38, 0xF8, 0x00, 0x07, 0xC0, 0x38, 0xF8, 0x00, 0x07, 0xFC, 0x38, 0xF8, 0x00, 0x07, 0xFC,
+    0x38, 0xF8, 0x00, 0x07, 0xFC, 0x78, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0xFC, 0x00, 0x07, 0xCF, 0xF0,
+    0xFE, 0x00, 0x0F, 0xCF, 0xE0, 0x7F, 0x80, 0x3F, 0xC7, 0xC0, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0x3F,
+    0xC0, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x00, 0x0F, 0xC0,
+    0x7C, 0x00, 0x00, 0x03, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0xC0, 0x07, 0xFF, 0xFF,
+    0xC0, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0xF8, 0x1F, 0xE0, 0x1F, 0xF0,
+    0xFC, 0x1F, 0x80, 0x07, 0xF0, 0x7E, 0x3F, 0x00, 0x03, 0xF0, 0x3E, 0x3E, 0x00, 0x01, 0xF0, 0x1E,
+    0x3E, 0x00, 0x01, 0xF0, 0x0E, 0x3E, 0x00, 0x01, 0xF8, 0x1E, 0x3E, 0x00, 0x01, 0xF8, 0x3E, 0x3E,
+    0x00, 0x01, 0xF0, 0xFE, 0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x3F, 0x80, 0x07, 0xF0, 0xF8, 0x1F, 0xF0,
+    0x1F, 0xF0, 0xF0, 0x1F, 0xF0, 0x1F, 0xE0, 0xE0, 0x0F, 0xF0, 0x1F, 0xE0, 0xC0, 0x0F, 0xF0, 0x1F,
+    0xC0, 0x80, 0x07, 0xF0, 0x1F, 0x80, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x70, 0x1C, 0x00,
+    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xC7, 0x8F, 0xF0, 0x00, 0x1F, 0x87, 0x87, 0xF0, 0x00, 0x3F, 0x07,
+    0x83, 0xF0, 0x06, 0x3E, 0x07, 0x81, 0xF0, 0x1E, 0x3E, 0x07, 0x81, 0xF0, 0x7E, 0x3E, 0x07, 0x81,
+    0xF0, 0xFE, 0x3E, 0x07, 0x81, 0xF8, 0xFE, 0x3E, 0x07, 0x81, 0xF0, 0xFC, 0x3F, 0x07, 0x81, 0xF0,
+    0xF8, 0x3F, 0x87, 0x83, 0xF0, 0xE0, 0x1F, 0xE7, 0x87, 0xF0, 0xC0, 0x1F, 0xFF, 0x87, 0xF0, 0x00,
+    0x0F, 0xFF, 0x87, 0xE0, 0x00, 0x0F, 0xFF, 0x87, 0xE0, 0x00, 0x07, 0xFF, 0x87, 0xC0, 0x00, 0x03,
+    0xFF, 0x87, 0x80, 0x00, 0x00, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x1F, 0x84, 0x00, 0x00, 0x7F, 0xC0,
+    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+    0x7F, 0x1E, 0x3F, 0xC0, 0x00, 0x7E, 0x1E, 0x1F, 0xC0, 0x00, 0xFC, 0x1E, 0x0F, 0xC0, 0x00, 0xF8,
+    0x1E, 0x07, 0xFF, 0x80, 0xF8, 0x1E, 0x07, 0xFF, 0xC0, 0xF8, 0x1E, 0x07, 0xFF, 0xC0, 0xF8, 0x1E,
+    0x07, 0xFF, 0xE0, 0xF8, 0x1E, 0x07, 0xFF, 0xE0, 0xFC, 0x1E, 0x07, 0xF1, 0xE0, 0xFE, 0x1E, 0x0F,
+    0xE1, 0xE0, 0x7F, 0x9E, 0x1F, 0xC1, 0xE0, 0x7F, 0xFE, 0x1F, 0xC1, 0xC0, 0x3F, 0xFE, 0x1F, 0x80,
+    0x00, 0x3F, 0xFE, 0x1F, 0x80, 0x00, 0x1F, 0xFE, 0x1F, 0x00, 0x00, 0x0F, 0xFE, 0x1E, 0x00, 0x00,
+    0x03, 0xFE, 0x1C, 0x00, 0x00, 0x00, 0x7E, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x38, 0x07,
+    0xFF, 0xFF, 0xC0, 0x7C, 0x0F, 0xFF, 0xFF, 0xE0, 0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0xFE, 0x1F, 0xC7,
+    0x8F, 0xF0, 0xFE, 0x1F, 0x87, 0x87, 0xF0, 0x7C, 0x3F, 0x07, 0x83, 0xF0, 0x38, 0x3E, 0x07, 0x81,
+    0xF0, 0x00, 0x3E, 0x07, 0x81, 0xF0, 0x00, 0x3E, 0x07, 0x81, 0xF8, 0x00, 0x3E, 0x07, 0x81, 0xF8,
+    0x38, 0x3E, 0x07, 0x81, 0xF0, 0x7C, 0x3F, 0x07, 0x81, 0xF0, 0xFE, 0x3F, 0x87, 0x83, 0xF0, 0xFE,
+    0x1F, 0xE7, 0x87, 0xF0, 0xFE, 0x1F, 0xFF, 0x87, 0xF0, 0x7C, 0x0F, 0xFF, 0x87, 0xE0, 0x38, 0x0F,
+    0xFF, 0x87, 0xE0, 0x00, 0x07, 0xFF, 0x87, 0xC0, 0x00, 0x03, 0xFF, 0x87, 0x80, 0x00, 0x00, 0xFF,
+    0x87, 0x00, 0x00, 0x00, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFE,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0xC0, 0x03, 0xFF, 0xFF, 0xE0,
+    0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0xFC, 0x0F, 0xE3, 0xC7, 0xF8, 0xFE,
+    0x0F, 0xC3, 0xC3, 0xF8, 0x7F, 0x1F, 0x83, 0xC1, 0xF8, 0x3F, 0x9F, 0x03, 0xC0, 0xF8, 0x0F, 0x9F,
+    0x03, 0xC0, 0xF8, 0x07, 0x9F, 0x03, 0xC0, 0xF8, 0x1F, 0x9F, 0x03, 0xC0, 0xFC, 0x3F, 0x9F, 0x03,
+    0xC0, 0xF8, 0x7F, 0x1F, 0x83, 0xC0, 0xF8, 0xFE, 0x1F, 0xC3, 0xC1, 0xF8, 0xFC, 0x0F, 0xF3, 0xC3,
+    0xF8, 0xF8, 0x0F, 0xFF, 0xC3, 0xF8, 0xF0, 0x07, 0xFF, 0xC3, 0xF0, 0xE0, 0x07, 0xFF, 0xC3, 0xF0,
+    0x80, 0x03, 0xFF, 0xC3, 0xE0, 0x00, 0x01, 0xFF, 0xC3, 0xC0, 0x00, 0x00, 0x7F, 0xC3, 0x80, 0x00,
+    0x00, 0x0F, 0xC2, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x02, 0x3F, 0xFF, 0xFF, 0xF0, 0x1E, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x7E, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF,
+    0xFF, 0xF0, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFF, 0xF8, 0xFE, 0x1F,
+    0xFF, 0xFF, 0xF8, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0xFC, 0x1F, 0xFF,
+    0xFF, 0xF8, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
+    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE0,
+    0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x01,
+    0xF0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
+    0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00,
+    0x07, 0xE0, 0x1F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
+    0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x3C, 0xF8, 0x00, 0x07, 0xC0, 0x3C, 0xF8, 0x00, 0x07, 0xC0,
+    0x3C, 0xF8, 0x00, 0x07, 0xC0, 0x3C, 0x78, 0x00, 0x07, 0x80, 0x3C, 0x7C, 0x00, 0x0F, 0x80, 0x3C,
+    0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x1F, 0x80, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3C, 0x00, 0x00, 0x00,
+    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
+    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
+    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x0E, 0x1E, 0x00,
+    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x00,
+    0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x00, 0x00,
+    0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
+    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x80, 0x1F, 0xFF,
+    0xFF, 0xF8, 0xC0, 0x1F, 0xFF, 0xFF, 0xF8, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0xF0, 0x1F, 0xFF, 0xFF,
+    0xF8, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0xFE, 0x01, 0xE0, 0x00, 0x00, 0x7F, 0x07, 0x80, 0x00, 0x00,
+    0x3F, 0x8F, 0x80, 0x00, 0x00, 0x1F, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x00, 0x0F,
+    0x9F, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0x80, 0x00, 0x00, 0x7F, 0x1F,
+    0x80, 0x00, 0x00, 0xFE, 0x1F, 0xE0, 0x00, 0x00, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0xF0, 0x0F, 0xFF,
+    0xFF, 0xF8, 0xE0, 0x0F, 0xFF, 0xFF, 0xF8, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x80, 0x03, 0xFF, 0xFF,
+    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
+    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
+    0xE0, 0x1F, 0xF0, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x06, 0x3E, 0x00,
+    0x01, 0xF0, 0x1E, 0x3E, 0x00, 0x01, 0xF0, 0x7E, 0x3E, 0x00, 0x01, 0xF8, 0xFE, 0x3E, 0x00, 0x01,
+    0xF0, 0xFE, 0x3E, 0x00, 0x01, 0xF0, 0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xF8, 0x3F, 0x80, 0x07, 0xF0,
+    0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x83, 0xFF, 0xFF, 0xC0, 0x01, 0x83, 0xFF, 0xFF,
+    0xE0, 0x07, 0x87, 0xFF, 0xFF, 0xF0, 0x0F, 0x8F, 0xFF, 0xFF, 0xF0, 0x1F, 0x8F, 0xF0, 0x0F, 0xF8,
+    0x3F, 0x8F, 0xC0, 0x03, 0xF8, 0x7F, 0x1F, 0x80, 0x01, 0xF8, 0xFE, 0x1F, 0x00, 0x00, 0xF8, 0xF8,
+    0x1F, 0x00, 0x00, 0xF8, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0xFE, 0x1F,
+    0x00, 0x00, 0xF8, 0x7F, 0x1F, 0x80, 0x01, 0xF8, 0x3F, 0x9F, 0xC0, 0x03, 0xF8, 0x1F, 0x8F, 0xF0,
+    0x0F, 0xF8, 0x0F, 0x8F, 0xFF, 0xFF, 0xF0, 0x03, 0x87, 0xFF, 0xFF, 0xF0, 0x01, 0x83, 0xFF, 0xFF,
+    0xE0, 0x00, 0x81, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x06, 0x1F, 0xFF, 0xFF, 0xE0, 0x1E, 0x1F, 0xE0, 0x1F, 0xF0, 0x3E, 0x1F, 0x80,
+    0x07, 0xF0, 0xFE, 0x3F, 0x00, 0x03, 0xF0, 0xFE, 0x3E, 0x00, 0x01, 0xF0, 0xF8, 0x3E, 0x00, 0x01,
+    0xF0, 0xF0, 0x3E, 0x00, 0x01, 0xF8, 0xE0, 0x3E, 0x00, 0x01, 0xF0, 0x82, 0x3E, 0x00, 0x01, 0xF0,
+    0x06, 0x3F, 0x00, 0x03, 0xF0, 0x1E, 0x3F, 0x80, 0x07, 0xF0, 0x3E, 0x1F, 0xE0, 0x1F, 0xF0, 0x7E,
+    0x1F, 0xFF, 0xFF, 0xE0, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0xF0, 0x03,
+    0xFF, 0xFF, 0x80, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x80, 0x00, 0x1F,
+    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x38, 0x07, 0xFF, 0xFF, 0xC0, 0x7C, 0x0F, 0xFF, 0xFF, 0xE0,
+    0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0xFE, 0x1F, 0xE0, 0x1F, 0xF0, 0xFE, 0x1F, 0x80, 0x07, 0xF0, 0x7C,
+    0x3F, 0x00, 0x03, 0xF0, 0x38, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x3E,
+    0x00, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x38, 0x3E, 0x00, 0x01, 0xF0, 0x7C, 0x3F, 0x00,
+    0x03, 0xF0, 0xFE, 0x3F, 0x80, 0x07, 0xF0, 0xFE, 0x1F, 0xE0, 0x1F, 0xF0, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x7C, 0x0F, 0xFF, 0xFF, 0xE0, 0x38, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x80,
+    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3C,
+    0x1F, 0x07, 0x80, 0x7E, 0x1F, 0x0F, 0xC0, 0xFF, 0x1F, 0x1F, 0xE0, 0xFF, 0x1F, 0x1F, 0xE0, 0xFF,
+    0x1F, 0x1F, 0xE0, 0xFF, 0x1F, 0x1F, 0xE0, 0x7E, 0x1F, 0x0F, 0xC0, 0x3C, 0x1F, 0x07, 0x80, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0xF0, 0x1F,
+    0xFF, 0xFF, 0xF8, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0x1F, 0xFF,
+    0xFF, 0xF8, 0x3F, 0x9F, 0xFF, 0xFF, 0xF8, 0x1F, 0x9F, 0xFF, 0xFF, 0xF8, 0x0F, 0x83, 0xE0, 0x00,
+    0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x00, 0x7F, 0x0F, 0x00, 0x00, 0x00,
+    0xFE, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF0,
+    0x1F, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x1F, 0x03, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF1, 0xE0, 0x00, 0x00, 0x1F,
+    0xE0, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0xE0, 0x00, 0x00, 0x1E, 0xE0,
+    0xE0, 0x00, 0x00, 0x1E, 0x71, 0xC0, 0x00, 0x00, 0x3E, 0x7F, 0xC0, 0x00, 0x00, 0x7C, 0x3F, 0x80,
+    0x00, 0x00, 0xF8, 0x1F, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x03, 0xF0, 0x02, 0x00, 0x00, 0x01, 0xF0, 0x0E, 0x00, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00,
+    0x01, 0xF0, 0xFE, 0x00, 0x00, 0x01, 0xE0, 0xFE, 0x00, 0x00, 0x01, 0xE0, 0xFE, 0x00, 0x00, 0x03,
+    0xE0, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0,
+    0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x06, 0x3F, 0xFF, 0xFF, 0xE0, 0x0E, 0x3F, 0xFF, 0xFF,
+    0xF0, 0x3E, 0x00, 0x00, 0x0F, 0xF0, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x00, 0x00, 0x01, 0xF0,
+    0xFC, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0xC0,
+    0x00, 0x00, 0x01, 0xE0, 0x82, 0x00, 0x00, 0x03, 0xE0, 0x0E, 0x00, 0x00, 0x07, 0xC0, 0x1E, 0x00,
+    0x00, 0x0F, 0x80, 0x3E, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0xFC, 0x3F, 0xFF,
+    0xFF, 0xF0, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0xE0, 0x3F, 0xFF, 0xFF,
+    0xF0, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x38, 0x3F, 0xFF, 0xFF, 0xC0, 0x7C,
+    0x3F, 0xFF, 0xFF, 0xE0, 0xFE, 0x3F, 0xFF, 0xFF, 0xE0, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE, 0x00,
+    0x00, 0x0F, 0xF0, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x38, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
+    0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x38, 0x00, 0x00, 0x01,
+    0xE0, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0xFE, 0x00, 0x00, 0x07, 0xC0, 0xFE, 0x00, 0x00, 0x0F, 0x80,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0x7C, 0x3F, 0xFF, 0xFF, 0xF0, 0x38, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x18, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+    0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xFF,
+    0xFF, 0x00, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x06, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFE, 0x00, 0x07,
+    0xFF, 0xFF, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xC0,
+    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1,
+    0xC0, 0x03, 0xE0, 0x00, 0x7F, 0xE1, 0xC0, 0x03, 0xE0, 0x00, 0x3F, 0xF3, 0x80, 0x03, 0xE0, 0x00,
+    0x3F, 0x7F, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0x7F, 0x80, 0x03, 0xE0, 0x00, 0x1E, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0x00, 0x38, 0x7C, 0xFE, 0xFE, 0xFE, 0xFE, 0x7C, 0x38,
+};
+static const uint32_t InterTight_Bold24pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 41, 73, 218, 380, 545, 695, 707, 779, 851, 905,
+    977, 995, 1011, 1019, 1121, 1261, 1336, 1461, 1591, 1731, 1856, 1991,
+    2111, 2241, 2376, 2408, 2458, 2554, 2623, 2719, 2829, 3093, 3253, 3383,
+    3538, 3683, 3798, 3913, 4068, 4213, 4248, 4363, 4508, 4618, 4803, 4948,
+    5108, 5238, 5398, 5533, 5668, 5808, 5948, 6113, 6348, 6503, 6668, 6798,
+    6870, 6972, 7044, 7082, 7105, 7115, 7207, 7332, 7428, 7553, 7653, 7743,
+    7868, 7988, 8028, 8094, 8214, 8249, 8397, 8493, 8593, 8718, 8843, 8907,
+    8999, 9063, 9159, 9263, 9419, 9519, 9649, 9737, 9839, 9888, 9990, 10040,
+    10040, 10041, 10239, 10256, 10386, 10506, 10616, 10778, 10893, 10910, 11072, 11234,
+    11402, 11558, 11574, 11730, 11886, 11937, 12057, 12077, 12147, 12157, 12232, 12347,
+    12366, 12384, 12499, 12614, 12709, 12819, 12839, 12949, 13059, 13221, 13413, 13605,
+    13797, 13989, 14121, 14307, 14493, 14679, 14817, 14961, 15099, 15237, 15303, 15417,
+    15591, 15761, 15935, 16109, 16301, 16493, 16685, 16877, 16952, 17114, 17282, 17450,
+    17618, 17786, 17984, 18152, 18282, 18362, 18477, 18592, 18707, 18822, 18888, 19008,
+    19128, 19248, 19373, 19498, 19623, 19748, 19803, 19898, 20063, 20203, 20323, 20443,
+    20568, 20693, 20818, 20943, 21039, 21134, 21254, 21374, 21499, 21619, 21775, 21877,
+};
+
+// InterTightBold34pt8bfr.h
+static const uint8_t InterTight_Bold34pt8b_Atlas[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0xF8, 0x00, 0x00, 0x00,
+    0x07, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x80, 0x00, 0x0F, 0xF0,
+    0x07, 0xF8, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x07, 0xFF,
+    0xFF, 0x80, 0x00, 0x0F, 0xF1, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE7, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xF8, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0xE0,
+    0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x07, 0xF8, 0x00, 0x80, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x07, 0xFF,
+    0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xF8, 0x00,
+    0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0xFF,
+    0xCF, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0xF0, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
+    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00,
+    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x87, 0xFF, 0x80, 0x07, 0xFE, 0x00,
+    0x03, 0xFF, 0x03, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
+    0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00,
+    0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFE, 0x00,
+    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFE, 0x00,
+    0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x03, 0xFE, 0x00,
+    0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x0F, 0xFC, 0x00,
+    0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x40, 0x3F, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07,
+    0xC0, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0xFC,
+    0x00, 0x3F, 0x00, 0x00, 0x7F, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x3F,
+    0x00, 0x03, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x1F,
+    0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x00,
+    0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
+    0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x03, 0xFF,
+    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0,
+    0x01, 0xFF, 0x80, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xFC,
+    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xE0, 0x00, 0x0F,
+    0xC0, 0x03, 0xF0, 0x7F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x07,
+    0xF0, 0x7E, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x78, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x70,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xE1, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x7F, 0xFE, 0x00,
+    0x3F, 0xC0, 0x7F, 0x80, 0x1F, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x1F, 0xFF, 0x80, 0x3F, 0xE0,
+    0x7F, 0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x3F, 0xFF, 0xE0, 0x3F, 0xC0, 0x7F, 0x80,
+    0x7F, 0xFF, 0xF8, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0x7F, 0xE1, 0xFF, 0xBF,
+    0xFE, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0x7F, 0xC0, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
+    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
+    0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xF8, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xC0,
+    0x60, 0x00, 0x03, 0xE0, 0x78, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x07, 0xF1,
+    0xFC, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x03, 0xF1,
+    0xF8, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x03, 0xE0,
+    0xF8, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07,
+    0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0xFF,
+    0xE0, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xF0, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xF8, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00,
+    0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
+    0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F,
+    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xE0,
+    0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00,
+    0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF,
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x00,
+    0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
+    0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
+    0x80, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0x80, 0x00,
+    0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xBF, 0xC0, 0x7F, 0x80, 0x00, 0x1F, 0xFF,
+    0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x3F, 0xFE, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x3F, 0xC0,
+    0x7F, 0x80, 0x00, 0xFF, 0xF8, 0x3F, 0xC0, 0x7F, 0x80, 0x01, 0xFF, 0xF0, 0x3F, 0xC0, 0x7F, 0xC0,
+    0x03, 0xFF, 0xE0, 0x3F, 0xC0, 0x7F, 0xE0, 0x0F, 0xFF, 0xC0, 0x3F, 0xC0, 0x3F, 0xF8, 0x3F, 0xFF,
+    0x80, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
+    0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x0F,
+    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF,
+    0x80, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00,
+    0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE,
+    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00,
+    0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x3F,
+    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xF8, 0x00,
+    0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0,
+    0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0x80,
+    0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x0F, 0xF8,
+    0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x1F, 0xFC, 0x00, 0x7F,
+    0xC0, 0x7F, 0xF0, 0x7F, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xFF, 0x7F, 0x83, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x00,
+    0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
+    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
+    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0x00, 0xFF, 0xE0, 0x0F, 0xC0, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0x80, 0xFF,
+    0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x7F, 0xC0, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
+    0xFF, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0xFF, 0x00,
+    0xFF, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0xF0,
+    0x03, 0xFF, 0x80, 0xFF, 0x00, 0x7F, 0xFC, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x0F,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x01,
+    0xFE, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xF0, 0x00,
+    0xFF, 0xC0, 0x7F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0,
+    0x7F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
+    0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x3F, 0xC0,
+    0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x3F,
+    0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F,
+    0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x3F, 0xFE, 0x1F,
+    0xFE, 0x07, 0xFF, 0x80, 0x3F, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x1F, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
+    0x07, 0xFE, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFE,
+    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x3F,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
+    0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x0F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
+    0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00,
+    0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
+    0xFF, 0xFF, 0x83, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x7F, 0xFE,
+    0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x1F, 0xFC, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F,
+    0xC0, 0x7F, 0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F,
+    0x80, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x07,
+    0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xF8, 0x00,
+    0x3F, 0xC0, 0x7F, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xC0,
+    0x7F, 0xE0, 0x1F, 0xFE, 0x00, 0x7F, 0xC0, 0x7F, 0xF0, 0x7F, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0x83, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x7F,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE,
+    0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x00, 0x03,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80,
+    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0, 0x00,
+    0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0x07, 0xFF,
+    0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
+    0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
+    0x80, 0x3F, 0xFC, 0x0F, 0xFF, 0x0F, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0xFF, 0x83, 0xFF, 0xC0, 0x7F,
+    0xE0, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0x80, 0x00,
+    0xFF, 0x80, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x80,
+    0x7F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0xE0,
+    0x7F, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x7F, 0x80,
+    0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x01, 0xFC,
+    0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x01, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xF8, 0x07, 0xFF,
+    0x80, 0x3F, 0xFC, 0x0F, 0xF0, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x7F,
+    0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0xFF, 0xE0,
+    0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00,
+    0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x1F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+    0xFC, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x00,
+    0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F,
+    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
+    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xDF, 0xF0,
+    0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00,
+    0x01, 0xFF, 0x87, 0xFC, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x03,
+    0xFE, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x07, 0xFC,
+    0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
+    0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x7F,
+    0xE0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0,
+    0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F,
+    0xF8, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0,
+    0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0F,
+    0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x07, 0xFC,
+    0x01, 0xFF, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x03,
+    0xFE, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x87, 0xFC,
+    0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00,
+    0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
+    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
+    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xE0, 0x7F, 0x80, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
+    0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x01, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x80,
+    0x03, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0x80, 0x07, 0xFF,
+    0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x0F, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x0F, 0xFF, 0xE0, 0xFF,
+    0xC0, 0x7F, 0x80, 0x1F, 0xFE, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x3F, 0xF8, 0x00, 0x1E, 0x00, 0x7F,
+    0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00,
+    0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x00,
+    0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x1F,
+    0xF8, 0x00, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xF0, 0x1F, 0xF8, 0x03, 0xFF,
+    0xFF, 0xE0, 0x3F, 0xF0, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0xF8, 0x3F, 0xF0, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x0F, 0xF8, 0x3F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x3F, 0xC0, 0x3F, 0xFF,
+    0xFF, 0xFE, 0x07, 0xFC, 0x7F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x7F, 0xC0, 0x7F, 0xF8,
+    0x0F, 0xFF, 0x07, 0xFC, 0x7F, 0x80, 0xFF, 0xC0, 0x03, 0xFF, 0x83, 0xFC, 0x7F, 0x80, 0xFF, 0x80,
+    0x01, 0xFF, 0x83, 0xFC, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0xFF, 0x01, 0xFF, 0x00,
+    0x00, 0x7F, 0x83, 0xFE, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0xFF, 0x01, 0xFE, 0x00,
+    0x00, 0x7F, 0x81, 0xFE, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC1, 0xFE, 0xFF, 0x01, 0xFE, 0x00,
+    0x00, 0x7F, 0x81, 0xFE, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0xFF, 0x01, 0xFE, 0x00,
+    0x00, 0x7F, 0x81, 0xFE, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0x7F, 0x81, 0xFE, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0xFF, 0x00, 0xFF, 0x80,
+    0x00, 0xFF, 0x01, 0xFE, 0xFF, 0x00, 0x7F, 0xC0, 0x01, 0xFE, 0x01, 0xFE, 0xFF, 0x80, 0x3F, 0xF0,
+    0x0F, 0xFC, 0x01, 0xFE, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFC, 0x7F, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFC, 0x3F, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x87, 0xF8, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF8, 0x1F, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x87, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xF0, 0x0F, 0xFC, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+    0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x83, 0xFC, 0x00,
+    0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFC,
+    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00,
+    0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80,
+    0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00,
+    0x07, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0,
+    0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F,
+    0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x7F, 0x80, 0xFF,
+    0x80, 0x1F, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x7F,
+    0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00,
+    0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
+    0xF8, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00,
+    0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
+    0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F,
+    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
+    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xE0,
+    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00,
+    0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+    0x80, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x0F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xC0,
+    0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F,
+    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
+    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F,
+    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
+    0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+    0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+    0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF,
+    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F,
+    0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80,
+    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00,
+    0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0,
+    0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+    0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF,
+    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xF8, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x00, 0x00,
+    0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
+    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0xFF,
+    0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x7F,
+    0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x7F,
+    0xE0, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
+    0xFF, 0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0xFF, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0xFF, 0x07,
+    0xFF, 0x80, 0x1F, 0xFF, 0x80, 0xFF, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00,
+    0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x07, 0x80, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC,
+    0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xFF,
+    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xE0, 0x00,
+    0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x03,
+    0xFF, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F,
+    0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80,
+    0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xE0,
+    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00,
+    0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
+    0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F,
+    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00,
+    0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFE,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x01,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF,
+    0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+    0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xF0,
+    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00,
+    0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x40, 0x7F,
+    0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x60, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x70, 0x7F, 0xC0, 0xFF,
+    0xC0, 0x00, 0x00, 0x7C, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x7E, 0x7F, 0xE0, 0x7F, 0xC0, 0x00,
+    0x00, 0x7F, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
+    0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
+    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFC,
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x00,
+    0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x7C, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
+    0x00, 0x0C, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80,
+    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
+    0xF8, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0x80,
+    0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
+    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x01,
+    0xFF, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
+    0x80, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F,
+    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x80,
+    0x3F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xE0,
+    0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x1F, 0xF8,
+    0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x1F, 0xF8, 0x00, 0x3F,
+    0xC0, 0x7F, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x7F,
+    0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x7F, 0x80, 0x07,
+    0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xFE, 0x00,
+    0x3F, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xC0,
+    0x7F, 0xE0, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0xC1, 0xFF, 0x80, 0x3F, 0xFE,
+    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFE,
+    0x00, 0x07, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
+    0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
+    0x80, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFE,
+    0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xF0,
+    0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0x80, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x7F,
+    0x80, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x7F, 0x80, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0x80, 0xFF,
+    0x00, 0x3F, 0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0x80, 0xFF, 0x01, 0xFF,
+    0xFE, 0x00, 0x7F, 0x80, 0xFF, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x0F, 0xFF, 0xF0, 0x00,
+    0x7F, 0x80, 0xFF, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0x80, 0xFF, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0x80,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x7F, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x18, 0x00, 0x00, 0x78, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF8, 0x00,
+    0x1F, 0xF8, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF,
+    0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x07,
+    0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x01,
+    0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xFE,
+    0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x1F, 0xC0, 0x03, 0xC0, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x20, 0x07, 0xFF, 0x80, 0x00, 0xE0, 0x0F,
+    0xFF, 0xC0, 0x03, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xF0, 0x1F, 0xFF, 0xF0, 0x0F, 0xF0, 0x3F, 0xFF,
+    0xF0, 0x1F, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 0xFF, 0xF8,
+    0x7F, 0xF0, 0x7F, 0xFF, 0xF8, 0x7F, 0xF0, 0xFF, 0x8F, 0xF8, 0x7F, 0xE0, 0xFE, 0x07, 0xF8, 0x7F,
+    0xC0, 0xFE, 0x03, 0xFC, 0xFF, 0x80, 0xFC, 0x03, 0xF8, 0xFF, 0x00, 0xFC, 0x03, 0xF8, 0xFF, 0x00,
+    0xFC, 0x03, 0xF8, 0xFF, 0x00, 0xFC, 0x03, 0xF8, 0xFF, 0x00, 0xFC, 0x03, 0xF8, 0xFF, 0x01, 0xF8,
+    0x03, 0xF0, 0xFF, 0x01, 0xF8, 0x03, 0xF0, 0xFF, 0x81, 0xF8, 0x07, 0xE0, 0xFF, 0x81, 0xF8, 0x0F,
+    0xC0, 0x7F, 0xC3, 0xF0, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00,
+    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x80,
+    0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
+    0xFC, 0x01, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80,
+    0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00,
+    0x07, 0xF8, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00, 0x07,
+    0xF8, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x0F, 0xF8,
+    0x7F, 0xE0, 0x00, 0x3F, 0xF8, 0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0x3F,
+    0xFC, 0x01, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x0F, 0xFC,
+    0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0xFC, 0x01,
+    0xFC, 0x00, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+    0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
+    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xF9, 0xF8, 0xFF, 0xF0, 0x7F, 0xE1, 0xF8, 0x3F, 0xF8, 0x7F,
+    0xC1, 0xF8, 0x1F, 0xF8, 0xFF, 0x81, 0xF8, 0x0F, 0xF8, 0xFF, 0x81, 0xF8, 0x07, 0xF8, 0xFF, 0x01,
+    0xF8, 0x07, 0xF8, 0xFF, 0x01, 0xF8, 0x07, 0xF8, 0xFF, 0x01, 0xF8, 0x07, 0xF8, 0xFF, 0x01, 0xF8,
+    0x07, 0xFC, 0xFF, 0x01, 0xF8, 0x07, 0xF8, 0xFF, 0x81, 0xF8, 0x07, 0xF8, 0xFF, 0x81, 0xF8, 0x07,
+    0xF8, 0x7F, 0xC1, 0xF8, 0x0F, 0xF8, 0x7F, 0xE1, 0xF8, 0x0F, 0xF8, 0x7F, 0xF9, 0xF8, 0x1F, 0xF8,
+    0x3F, 0xFF, 0xF8, 0x3F, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x1F,
+    0xFF, 0xF8, 0x3F, 0xE0, 0x0F, 0xFF, 0xF8, 0x3F, 0xC0, 0x07, 0xFF, 0xF8, 0x3F, 0x80, 0x03, 0xFF,
+    0xF8, 0x3F, 0x00, 0x00, 0xFF, 0xF8, 0x3E, 0x00, 0x00, 0x3F, 0xF8, 0x38, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x60, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x78, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0x00, 0x7C, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x7E, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x7F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0,
+    0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x3F, 0xE0, 0xFF, 0xC0,
+    0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x0F,
+    0xF8, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F,
+    0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x7F,
+    0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x3F, 0x80, 0x00,
+    0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x1F, 0xC0,
+    0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0x80, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x7F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x83, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x3F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x3F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
+    0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+    0xE3, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x7F,
+    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x80,
+    0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F,
+    0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x1F, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0x01, 0xFF, 0xF0, 0x7F,
+    0xF0, 0x00, 0x3F, 0xF8, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0xFF, 0x80,
+    0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00,
+    0x07, 0xFC, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x07,
+    0xF8, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x1F, 0xF8,
+    0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x7F, 0xFE, 0x01, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+    0x1F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
+    0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+    0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0,
+    0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
+    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0,
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x03, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0xFC, 0x00, 0x7C, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0x80, 0x0F,
+    0xFF, 0xC0, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xFF,
+    0xF0, 0x7F, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xF0, 0x7F, 0xFF, 0xF8, 0x7F, 0xF8, 0x7F, 0xFF, 0xF8,
+    0x1F, 0xF8, 0xFF, 0x8F, 0xF8, 0x0F, 0xF8, 0xFF, 0x07, 0xF8, 0x07, 0xF8, 0xFF, 0x03, 0xF8, 0x07,
+    0xF8, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0xFE, 0x03, 0xFC, 0x07, 0xFC,
+    0xFE, 0x01, 0xFC, 0x07, 0xFC, 0xFE, 0x01, 0xFC, 0x07, 0xF8, 0xFE, 0x01, 0xFE, 0x07, 0xF8, 0xFF,
+    0x01, 0xFE, 0x07, 0xF8, 0xFF, 0x01, 0xFF, 0x0F, 0xF8, 0x7F, 0x80, 0xFF, 0x1F, 0xF8, 0x7F, 0xE0,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xE0, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x7F,
+    0xFF, 0xE0, 0x1F, 0xE0, 0x7F, 0xFF, 0xE0, 0x0F, 0xE0, 0x3F, 0xFF, 0xC0, 0x07, 0xE0, 0x3F, 0xFF,
+    0x80, 0x03, 0xE0, 0x1F, 0xFF, 0x00, 0x00, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFC,
+    0x00, 0x7F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x00,
+    0x03, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
+    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8,
+    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x38, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xFC,
+    0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xF0,
+    0x00, 0x7F, 0xF8, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
+    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xF8, 0xFF, 0xFF, 0x07,
+    0xFF, 0xF8, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0xFF, 0xC0, 0x00, 0x3F,
+    0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8,
+    0xE0, 0x00, 0x00, 0x00, 0x78, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x0F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x3F, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x0F,
+    0xF8, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0x00, 0x00, 0xFF, 0xF8,
+    0xFF, 0x00, 0x01, 0xFF, 0xF8, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0xFF,
+    0x00, 0x1F, 0xFF, 0xF8, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0x01,
+    0xFF, 0xFF, 0xF8, 0xFF, 0x07, 0xFF, 0xF7, 0xF8, 0xFF, 0x0F, 0xFF, 0xE7, 0xF8, 0xFF, 0x1F, 0xFF,
+    0xC7, 0xF8, 0xFF, 0x7F, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0xFF, 0xFF, 0xFC, 0x07,
+    0xF8, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0xFF, 0xFF, 0xE0, 0x07, 0xF8, 0xFF, 0xFF, 0xC0, 0x07, 0xF8,
+    0xFF, 0xFF, 0x00, 0x07, 0xF8, 0xFF, 0xFE, 0x00, 0x07, 0xF8, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0xFF,
+    0xF0, 0x00, 0x07, 0xF8, 0xFF, 0xE0, 0x00, 0x07, 0xF8, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0xFF, 0x00,
+    0x00, 0x07, 0xF8, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
+    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
+    0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
+    0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
+    0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
+    0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x03, 0xFC, 0x0F, 0xFC, 0x1F, 0xFC, 0x3F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x7F,
+    0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFE, 0x01,
+    0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x03, 0xFE, 0x0F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
+    0xF8, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x83, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7C, 0xE0, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x80,
+    0x3F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xC0,
+    0x0F, 0xC0, 0x3F, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xF8, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0xFF, 0xC0, 0x0E,
+    0x00, 0x3E, 0x07, 0xFF, 0xF8, 0x1F, 0x00, 0x7F, 0x1F, 0xFF, 0xFE, 0x3F, 0x80, 0xFF, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC,
+    0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00,
+    0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7E,
+    0x00, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0F,
+    0xF0, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC,
+    0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x80, 0x3E,
+    0x07, 0xFF, 0xF8, 0x3F, 0x00, 0x1C, 0x00, 0x7F, 0xC0, 0x1E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x1F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
+    0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x87, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x80,
+    0x03, 0xFE, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xC0,
+    0x01, 0xFE, 0x00, 0x43, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x03, 0xC3, 0xFC, 0x00, 0xFF, 0xC0,
+    0x01, 0xFE, 0x0F, 0xC3, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFE, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0xE0,
+    0x01, 0xFF, 0xFF, 0xC3, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xE0,
+    0x01, 0xFF, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFE, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xF0,
+    0x01, 0xFE, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFE, 0xFE, 0x03, 0xFE, 0x00, 0x1F, 0xF8,
+    0x03, 0xFE, 0xF8, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x03, 0xFE, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xFC,
+    0x07, 0xFE, 0xC0, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x0F, 0xFC, 0x80, 0x01, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x3F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0x01, 0xFF, 0xE0, 0x03,
+    0xF8, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0xE7, 0xFF, 0xF8, 0x03,
+    0xFE, 0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0xFC, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
+    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC7, 0xFE, 0x03,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0x00,
+    0xFF, 0xC0, 0x7F, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xE0, 0x7F, 0x81, 0xFF, 0x80, 0xFF, 0x80,
+    0x3F, 0xE0, 0x7F, 0x80, 0xFF, 0xC0, 0x7F, 0x80, 0x1F, 0xE0, 0x7F, 0x80, 0xFF, 0xC0, 0x7F, 0xC0,
+    0x1F, 0xE0, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xE0, 0x7F, 0x80, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x7F, 0x80, 0x3F, 0xF0, 0x1F, 0xF0,
+    0x1F, 0xE0, 0x7F, 0xE0, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xE0, 0x7F, 0xF8, 0x1F, 0xF8, 0x0F, 0xFC,
+    0x7F, 0xC0, 0x3F, 0xF8, 0x0F, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x0F, 0xFC, 0x1F, 0xFF,
+    0xFF, 0xC0, 0x1F, 0xF8, 0x07, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xF8, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x0F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0xFD, 0xFF,
+    0xFE, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x00, 0xFF, 0xF8, 0x3F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00,
+    0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x80,
+    0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x7F,
+    0xF8, 0x00, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
+    0x00, 0x7F, 0xFC, 0x00, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0xF8, 0x00, 0x7F,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0xFE,
+    0x00, 0xFF, 0xC3, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x01, 0xFF,
+    0x00, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x7F, 0xE1, 0xFE, 0x00, 0x7F, 0xE0,
+    0x00, 0xFF, 0x00, 0x3F, 0xE1, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x00, 0x1F, 0xE1, 0xFE, 0x00,
+    0x7F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xE1,
+    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xE1, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80,
+    0x0F, 0xE1, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x1F, 0xE1, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
+    0xFF, 0x00, 0x7F, 0xE1, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0x00, 0xFF, 0xC1, 0xFE, 0x00, 0x1F,
+    0xF8, 0x00, 0xFF, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x01, 0xFF,
+    0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0xFE, 0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0xFC,
+    0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x07, 0xFE, 0x00, 0xF8, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFE,
+    0x00, 0xE0, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xC0, 0x00, 0x7F, 0xF8, 0x03, 0xFF,
+    0xFF, 0xFC, 0x00, 0x80, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8,
+    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0,
+    0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0x7F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0x80, 0x7F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0xC0,
+    0x07, 0x80, 0x7F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0xDE, 0x07, 0x80, 0x7F, 0x80, 0x0F, 0xFC, 0x00,
+    0x3F, 0xFE, 0x07, 0x80, 0x7F, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xFE, 0x0F, 0x80, 0x7F, 0x80, 0x0F,
+    0xFC, 0x00, 0x3F, 0xFF, 0x0F, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0x1F, 0x00, 0x7F,
+    0x80, 0x07, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x07, 0xFE, 0x00, 0x3F, 0xCF, 0xFE,
+    0x00, 0x7F, 0x80, 0x07, 0xFE, 0x00, 0x3F, 0xCF, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x7F,
+    0xC7, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
+    0x80, 0xFF, 0xC1, 0xF0, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE,
+    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFE,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xF9, 0xFE,
+    0x00, 0x43, 0xFC, 0x00, 0x1F, 0xFF, 0xE1, 0xFE, 0x03, 0xC3, 0xFC, 0x00, 0x7F, 0xFF, 0xC1, 0xFE,
+    0x0F, 0xC3, 0xFC, 0x00, 0xFF, 0xFF, 0x01, 0xFE, 0x3F, 0xC3, 0xFC, 0x03, 0xFF, 0xFE, 0x01, 0xFE,
+    0xFF, 0xC3, 0xFC, 0x07, 0xFF, 0xF8, 0x01, 0xFE, 0xFF, 0xC3, 0xFC, 0x1F, 0xFF, 0xF0, 0x01, 0xFE,
+    0xFF, 0xC3, 0xFC, 0x3F, 0xFF, 0xC0, 0x01, 0xFE, 0xFF, 0x83, 0xFC, 0xFF, 0xFF, 0x80, 0x01, 0xFE,
+    0xFF, 0x03, 0xFD, 0xFF, 0xFE, 0x00, 0x01, 0xFE, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFE,
+    0xF8, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFE, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFE,
+    0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x01,
+    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x01,
+    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x01,
+    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
+    0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0x7F, 0xE1, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0xFF, 0x3F, 0xE1,
+    0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0x1F, 0xE1, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0x07, 0xE1,
+    0xFE, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0x03, 0xE1, 0xFE, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0x07, 0xE1,
+    0xFE, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x0F, 0xE1, 0xFE, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0x3F, 0xE1,
+    0xFE, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0x7F, 0xE1, 0xFE, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC1,
+    0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x01,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x01,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x01,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x1E, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0x3F, 0x01,
+    0xFE, 0x00, 0x07, 0xFF, 0xF8, 0xFF, 0x7F, 0x81, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1,
+    0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xC1, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0xC1,
+    0xFE, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC1, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC1,
+    0xFE, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0x7F, 0x81, 0xFE, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0x3F, 0x01,
+    0xFE, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0x1E, 0x01, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0xC3, 0xFC, 0xFF, 0x00,
+    0xFE, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFF, 0x00, 0xFE,
+    0xFF, 0x00, 0xFE, 0x7F, 0xC3, 0xFC, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xF0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
+    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xFF,
+    0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xF8, 0x00,
+    0x00, 0x7F, 0xF0, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x7F,
+    0xC0, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0xFC,
+    0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x03, 0xF8,
+    0x00, 0x00, 0xFF, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00,
+    0xFF, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x81, 0xF8, 0x07, 0xE0, 0xF0, 0x00, 0xFF, 0x81,
+    0xF8, 0x0F, 0xC3, 0xFE, 0x00, 0x7F, 0xC3, 0xF0, 0x3F, 0x8F, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xC0, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xF8,
+    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0xC0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F,
+    0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x7F, 0x78, 0x3F, 0x70, 0x3F, 0x20,
+    0x3F, 0x20, 0x3E, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0xC0, 0x1F, 0xC0, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xFF, 0x80, 0xFE, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
+    0x03, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE,
+    0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x81, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xC1, 0xFF, 0xC0, 0x00,
+    0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
+    0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x1F, 0xE0,
+    0x1F, 0xE0, 0x00, 0x43, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0x01, 0xC3, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0,
+    0x0F, 0xC3, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC3, 0xF8, 0x0F, 0xF0, 0x1F, 0xF0, 0xFF, 0xC3,
+    0xF8, 0x07, 0xF0, 0x1F, 0xF0, 0xFF, 0xC3, 0xF8, 0x07, 0xF0, 0x1F, 0xE0, 0xFF, 0xC3, 0xF8, 0x07,
+    0xF8, 0x1F, 0xE0, 0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x1F, 0xE0, 0xFF, 0x03, 0xFC, 0x07, 0xFC, 0x3F,
+    0xE0, 0xFE, 0x01, 0xFE, 0x03, 0xFC, 0x7F, 0xE0, 0xF8, 0x01, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0xF0,
+    0x01, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0xFF,
+    0x81, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x80, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80,
+    0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x0F, 0xE0, 0x03, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xE0, 0x00,
+    0xC0, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x0C, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x1F,
+    0xFE, 0x3E, 0xFF, 0xFE, 0x1F, 0xFE, 0x1F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF8, 0x03, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0x00, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0xFF,
+    0x80, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0xFF, 0xC0, 0xF8,
+    0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0xE0, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xE0, 0xFE, 0x00, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0xFF, 0xC1, 0xFF, 0x1F, 0xF0,
+    0x1F, 0xF0, 0x7F, 0xE1, 0xFE, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xE1, 0xFE, 0x07, 0xF0, 0x0F, 0xF0,
+    0x1F, 0xE1, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x0F, 0xE1, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x03, 0xE1,
+    0xFC, 0x07, 0xF8, 0x0F, 0xF8, 0x07, 0xE1, 0xFC, 0x03, 0xF8, 0x0F, 0xF8, 0x0F, 0xE1, 0xFC, 0x03,
+    0xF8, 0x0F, 0xF0, 0x1F, 0xE1, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x7F, 0xE1, 0xFE, 0x03, 0xFC, 0x0F,
+    0xF0, 0xFF, 0xC1, 0xFE, 0x03, 0xFE, 0x1F, 0xF0, 0xFF, 0x80, 0xFF, 0x01, 0xFE, 0x3F, 0xF0, 0xFF,
+    0x00, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0xFE, 0x00, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0x7F,
+    0xC1, 0xFF, 0xFF, 0xE0, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xC0, 0xE0, 0x00, 0x3F, 0xC0, 0xFF,
+    0xFF, 0xC0, 0xC0, 0x00, 0x1F, 0xC0, 0x7F, 0xFF, 0x80, 0x80, 0x00, 0x0F, 0xC0, 0x7F, 0xFF, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0x80, 0x00,
+    0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
+    0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
+    0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x1F, 0xF8,
+    0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0xF0,
+    0xFF, 0x03, 0xF8, 0x07, 0xF8, 0xC0, 0xF0, 0xFE, 0x03, 0xFC, 0x07, 0xFF, 0xC0, 0xF0, 0xFE, 0x03,
+    0xFC, 0x07, 0xFF, 0xC0, 0xF0, 0xFE, 0x03, 0xFC, 0x07, 0xFF, 0xC1, 0xF0, 0xFE, 0x01, 0xFC, 0x07,
+    0xFF, 0xE3, 0xE0, 0xFE, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0xFE, 0x01, 0xFE, 0x07, 0xF9, 0xFF,
+    0xE0, 0xFF, 0x01, 0xFE, 0x07, 0xF9, 0xFF, 0xC0, 0xFF, 0x01, 0xFF, 0x0F, 0xF8, 0xFF, 0x80, 0x7F,
+    0xC0, 0xFF, 0x1F, 0xF8, 0x7F, 0x00, 0x7F, 0xE0, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x7F, 0xE0, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xFF, 0xE0,
+    0x00, 0x00, 0x1F, 0xE0, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
+    0x07, 0xE0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07,
+    0xF8, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFF,
+    0xF0, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00,
+    0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF,
+    0xE0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
+    0x03, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x43, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xC3, 0xFC,
+    0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xC3, 0xFC, 0x1F, 0xFF, 0xDF, 0xE0, 0x1F, 0xC3, 0xFC, 0x3F, 0xFF,
+    0x9F, 0xE0, 0x7F, 0xC3, 0xFC, 0x7F, 0xFF, 0x1F, 0xE0, 0xFF, 0xC3, 0xFD, 0xFF, 0xFC, 0x1F, 0xE0,
+    0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x1F, 0xE0, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xFF, 0x03,
+    0xFF, 0xFF, 0xC0, 0x1F, 0xE0, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xE0, 0xF8, 0x03, 0xFF, 0xFF,
+    0x00, 0x1F, 0xE0, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xE0, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x1F,
+    0xE0, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
+    0x03, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xE0, 0x00, 0x40, 0x01, 0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0xC0,
+    0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xE0, 0x40, 0x80, 0xC0, 0x01, 0xC0,
+    0x07, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0xF8, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07,
+    0xF0, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0xE0,
+    0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0xF8, 0x01, 0xFE,
+    0x00, 0x01, 0xFF, 0xF0, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0xFE, 0x01, 0xFE, 0x00, 0x0F,
+    0xFF, 0xF0, 0xFF, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0x81, 0xFE, 0x00, 0x3F, 0xFF, 0xF0,
+    0x7F, 0xC1, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xE1, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0xE1,
+    0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xE1, 0xFE, 0x0F, 0xFF, 0xEF, 0xF0, 0x03, 0xE1, 0xFE, 0x1F,
+    0xFF, 0xCF, 0xF0, 0x07, 0xE1, 0xFE, 0x3F, 0xFF, 0x8F, 0xF0, 0x0F, 0xE1, 0xFE, 0xFF, 0xFE, 0x0F,
+    0xF0, 0x1F, 0xE1, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x3F, 0xE1, 0xFF, 0xFF, 0xF8, 0x0F, 0xF0, 0x7F,
+    0xC1, 0xFF, 0xFF, 0xE0, 0x0F, 0xF0, 0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0x0F, 0xF0, 0xFF, 0x01, 0xFF,
+    0xFF, 0x80, 0x0F, 0xF0, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0xFC, 0x01, 0xFF, 0xFC, 0x00,
+    0x0F, 0xF0, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xF0,
+    0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x80, 0x01,
+    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F,
+    0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+    0x03, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFC,
+    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x1E, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xE0,
+    0x3F, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x7F, 0x83, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3,
+    0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3, 0xFC, 0x1F, 0xFF, 0xDF, 0xE0, 0xFF, 0xC3, 0xFC, 0x7F,
+    0xFF, 0x1F, 0xE0, 0xFF, 0xC3, 0xFC, 0xFF, 0xFE, 0x1F, 0xE0, 0xFF, 0xC3, 0xFD, 0xFF, 0xFC, 0x1F,
+    0xE0, 0x7F, 0x83, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x3F, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xE0, 0x1E,
+    0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF,
+    0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+    0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xE0,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03,
+    0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xC3, 0xFC, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x03, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFC, 0x00,
+    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFC, 0x00,
+    0x03, 0xFF, 0xE0, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0xFE, 0x03, 0xFE, 0x00,
+    0x07, 0xFF, 0xFE, 0x00, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xF0, 0x01, 0xFF, 0x80,
+    0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0x01, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x80, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+    0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x01, 0xC3, 0xFF, 0xFF,
+    0x80, 0x0F, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xC3, 0xFF, 0xC0,
+    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC3, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0xF8,
+    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0xFF,
+    0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0xFF,
+    0xFF, 0xCF, 0xF0, 0x00, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x80, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x60, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xE0, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xE0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xE1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE1, 0xFF, 0xFF, 0xFF, 0xE7, 0xF8, 0x00, 0x7F, 0xE1, 0xFF, 0xFF,
+    0xFF, 0x07, 0xF8, 0x00, 0xFF, 0xC1, 0xFF, 0xFF, 0xF8, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFF, 0xFF,
+    0xC0, 0x07, 0xF8, 0x00, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xFC, 0x01, 0xFF, 0xE0,
+    0x00, 0x07, 0xF8, 0x00, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0xFE, 0x01, 0xFF, 0xFC,
+    0x00, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0xFF, 0x81, 0xFF, 0xFF,
+    0xF0, 0x07, 0xF8, 0x00, 0x7F, 0xE1, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0x00, 0x3F, 0xE1, 0xFF, 0xFF,
+    0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xE0, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x60, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x20, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xCF, 0xF0, 0x00, 0x1F, 0x83, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xF0, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xFF,
+    0x00, 0x0F, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xC0,
+    0x00, 0x0F, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xF8,
+    0x00, 0x0F, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xC3, 0xFF, 0xFF,
+    0xE0, 0x0F, 0xF0, 0x00, 0x1F, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x3E, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xCF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x3C, 0x03, 0xFF, 0xFF,
+    0x80, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8,
+    0x00, 0x0F, 0xF0, 0x00, 0x3E, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xFF,
+    0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF,
+    0xFF, 0xCF, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x00, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3C, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xC3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC,
+    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xE0,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80,
+    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xC3, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0xFE, 0x03, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xC3, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0xFE, 0x7F, 0xC7, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC3, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC3, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0xFE, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFE, 0x03, 0xFF, 0x00,
+    0x00, 0x00, 0x07, 0xFE, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xF0, 0x03, 0xFF, 0x80,
+    0x00, 0x00, 0x0F, 0xFE, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x80, 0x01, 0xFF, 0xE0,
+    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE,
+    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE,
+    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFE,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0x80, 0x7F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC6, 0x07, 0x80,
+    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x07, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE,
+    0x0F, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0x1F, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xC0, 0x00,
+    0x00, 0x00, 0x7F, 0xCF, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xFE, 0x00, 0x7F,
+    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFC,
+    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xE0, 0x00, 0x7F, 0xFE, 0x00,
+    0x00, 0xFF, 0xFC, 0x00, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xF8, 0x00, 0xFF,
+    0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xFE,
+    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0xFF, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xE1, 0xFF, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xE1, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xE3,
+    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x1F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFE, 0x01, 0xFF,
+    0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xF8,
+    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFC,
+    0x00, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x01,
+    0xFF, 0xF8, 0x00, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0xC3, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x03, 0xC3, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x1F, 0xC3, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x7F, 0xC3, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0xFF, 0xC3, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0xFF, 0x83, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0xFE, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0xFC, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0xE0, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x8F, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0xBF, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0xFF, 0xFC, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xF0, 0xFE, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0x7F, 0xE0, 0x7E, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x7E, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xC0, 0x7E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x3E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x7F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xFF, 0x83, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x7F, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x7F, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x3C, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x3E, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x7F, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x7F, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0xFF, 0x83, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0xFF, 0x83, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0xFF, 0x83, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0xFF, 0x83, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x7F, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x7F, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x3C, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
+    0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0xFF, 0xC1, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x7F, 0xE1, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0x3F, 0xE1, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x0F, 0xE1, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0x07, 0xE1, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x03, 0xE1, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0x0F, 0xE1, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x1F, 0xE1, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0x3F, 0xE1, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x7F, 0xE1, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0xFF, 0x81, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0xFE, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xFC, 0x01, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x01, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xC3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x7F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE1, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x0F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xE1, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x03, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xE1, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x1F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE1, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x7F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xF8, 0x00, 0xFF, 0xC0, 0x00,
+    0x00, 0x07, 0xFE, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0xE0, 0x00, 0xFF, 0xE0, 0x00,
+    0x00, 0x0F, 0xFE, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x80, 0x00, 0x7F, 0xF8, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
+    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0xFF,
+    0x80, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0xFF,
+    0x80, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F,
+    0xC0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF,
+    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFF,
+    0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF,
+    0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF,
+    0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07,
+    0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xF8, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
+    0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00,
+    0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00,
+    0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xC3, 0xFE, 0x00, 0x00,
+    0x00, 0x03, 0xFE, 0x03, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xC3, 0xFE, 0x00, 0x00,
+    0x00, 0x03, 0xFE, 0x3F, 0xC7, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC3, 0xFE, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC3, 0xFE, 0x00, 0x00,
+    0x00, 0x03, 0xFE, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x03, 0xFE, 0x00, 0x00,
+    0x00, 0x03, 0xFE, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xF8, 0x03, 0xFF, 0x80, 0x00,
+    0x00, 0x0F, 0xFC, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xC0, 0x01, 0xFF, 0xE0, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00,
+    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x20, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x60, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xE0,
+    0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+    0x03, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x07,
+    0xFE, 0x00, 0x1F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC1, 0xFF,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x80, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x81, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xE1,
+    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x0F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x07,
+    0xFE, 0x00, 0x03, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xE0, 0x7F, 0xF8, 0x00,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xE0, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x60, 0x3F,
+    0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x20, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8,
+    0x00, 0x40, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC,
+    0x03, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE,
+    0x1F, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE,
+    0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xE0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xC0, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x81, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x0F, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC,
+    0x3F, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC,
+    0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8,
+    0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0,
+    0x3E, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x7F, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8,
+    0x7F, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC,
+    0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
+    0xFF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x7F, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3C, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x3E, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x7F, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
+    0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC,
+    0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8,
+    0x7F, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x3C, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x1F,
+    0xC0, 0x00, 0x7F, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0xFF, 0xF8,
+    0x03, 0xFF, 0xE0, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x3F, 0xFE, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x1F,
+    0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
+    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
+    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
+    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0x1F,
+    0xFF, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0x80, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0xFF, 0xF8, 0x03, 0xFF,
+    0xE0, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
+    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x81, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF,
+    0xC1, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xE1, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F,
+    0xE1, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07,
+    0xE1, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xE1, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F,
+    0xE1, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F,
+    0xE1, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xE1, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
+    0x81, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0xFE,
+    0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0xF8,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xC0, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xE0, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xF0, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xC0, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
+    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x01,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x1F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x01,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x80,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3C,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x07,
+    0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF,
+    0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xF8,
+    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xC0,
+    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80,
+    0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xF8,
+    0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x3F,
+    0xC0, 0x7F, 0xE0, 0x1F, 0xFC, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x7F, 0xFC, 0x00, 0x7F, 0xC0, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x83, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x00,
+    0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x01, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F,
+    0xFE, 0x00, 0x00, 0x00, 0x03, 0x80, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0xFF, 0x80,
+    0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x7F, 0xC0, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC1,
+    0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC3, 0xFE, 0x3F,
+    0xE0, 0x00, 0x01, 0xFF, 0x83, 0xF8, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0x03, 0xF8, 0x0F, 0xF0, 0x00,
+    0x03, 0xFE, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x43, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x01, 0xC3, 0xFC,
+    0x03, 0xF0, 0x0F, 0xE0, 0x07, 0xC3, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x1F, 0xC3, 0xFC, 0x03, 0xF0,
+    0x0F, 0xE0, 0x7F, 0xC3, 0xFC, 0x07, 0xE0, 0x0F, 0xC0, 0xFF, 0xC3, 0xFC, 0x07, 0xE0, 0x0F, 0xC0,
+    0xFF, 0xC3, 0xFE, 0x07, 0xE0, 0x1F, 0x80, 0xFF, 0xC3, 0xFE, 0x07, 0xE0, 0x3F, 0x00, 0xFF, 0x01,
+    0xFF, 0x0F, 0xC0, 0xFE, 0x00, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF8, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1F, 0xFF, 0x80,
+    0x00, 0x00, 0x07, 0xE0, 0x3F, 0xFF, 0xC0, 0x00, 0x20, 0x0F, 0xE0, 0x3F, 0xFF, 0xE0, 0x00, 0x60,
+    0x1F, 0xE0, 0x7F, 0xFF, 0xE0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F, 0xFF, 0xF0, 0x01, 0xE0, 0x7F, 0xE0,
+    0xFF, 0xFF, 0xF0, 0x03, 0xE0, 0x7F, 0xE0, 0xFF, 0xFF, 0xF0, 0x07, 0xE0, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xF0, 0x0F, 0xE0, 0xFF, 0xE1, 0xFF, 0x1F, 0xF0, 0x1F, 0xE0, 0xFF, 0xC1, 0xFC, 0x0F, 0xF0, 0x3F,
+    0xE0, 0xFF, 0x81, 0xFC, 0x07, 0xF8, 0x7F, 0xE1, 0xFF, 0x01, 0xF8, 0x07, 0xF0, 0xFF, 0x81, 0xFE,
+    0x01, 0xF8, 0x07, 0xF0, 0xFF, 0x01, 0xFE, 0x01, 0xF8, 0x07, 0xF0, 0xFE, 0x01, 0xFE, 0x01, 0xF8,
+    0x07, 0xF0, 0xFC, 0x01, 0xFE, 0x01, 0xF8, 0x07, 0xF0, 0xFC, 0x01, 0xFE, 0x03, 0xF0, 0x07, 0xE0,
+    0xFE, 0x01, 0xFE, 0x03, 0xF0, 0x07, 0xE0, 0xFF, 0x01, 0xFF, 0x03, 0xF0, 0x0F, 0xC0, 0xFF, 0xC1,
+    0xFF, 0x03, 0xF0, 0x1F, 0x80, 0x7F, 0xE0, 0xFF, 0x87, 0xE0, 0x7F, 0x00, 0x3F, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x60, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x20, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x7F, 0xC0,
+    0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0xFF, 0xC1, 0xFF, 0xFF,
+    0xE0, 0xFF, 0x01, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFF, 0x01, 0xFF, 0xC3, 0xFE, 0x3F, 0xE0, 0xFF,
+    0x81, 0xFF, 0x83, 0xF8, 0x1F, 0xE0, 0xFF, 0x81, 0xFF, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xC3, 0xFE,
+    0x03, 0xF0, 0x0F, 0xE0, 0x0F, 0xC3, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x07, 0xC3, 0xFC, 0x03, 0xF0,
+    0x0F, 0xE0, 0x07, 0xC3, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x07, 0xC3, 0xFC, 0x03, 0xF0, 0x0F, 0xE0,
+    0x07, 0xC3, 0xFC, 0x07, 0xE0, 0x0F, 0xC0, 0x07, 0xC3, 0xFC, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0xC3,
+    0xFE, 0x07, 0xE0, 0x1F, 0x80, 0x1F, 0xC3, 0xFE, 0x07, 0xE0, 0x3F, 0x00, 0xFF, 0x81, 0xFF, 0x0F,
+    0xC0, 0xFE, 0x00, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x80, 0x3F, 0xFF, 0x00, 0x00, 0x00,
+    0x0F, 0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xFF, 0xC0, 0x3E, 0x00, 0x3F, 0xC0,
+    0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0xFF, 0xC1, 0xFF, 0xFF,
+    0xE0, 0xFF, 0x80, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFF, 0x81, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFF,
+    0x81, 0xFF, 0xC3, 0xFE, 0x3F, 0xE0, 0xFF, 0x81, 0xFF, 0x83, 0xF8, 0x1F, 0xE0, 0x7F, 0x03, 0xFF,
+    0x03, 0xF8, 0x0F, 0xF0, 0x7F, 0x03, 0xFE, 0x03, 0xF0, 0x0F, 0xE0, 0x3E, 0x03, 0xFC, 0x03, 0xF0,
+    0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x03, 0xF0, 0x0F, 0xE0,
+    0x00, 0x03, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x03,
+    0xFC, 0x07, 0xE0, 0x0F, 0xC0, 0x3E, 0x03, 0xFE, 0x07, 0xE0, 0x1F, 0x80, 0x7F, 0x03, 0xFE, 0x07,
+    0xE0, 0x3F, 0x00, 0x7F, 0x01, 0xFF, 0x0F, 0xC0, 0xFE, 0x00, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x01, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
+    0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x43, 0xFE, 0x00, 0x00, 0x1F,
+    0xE0, 0x01, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x3F,
+    0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xC3, 0xFC,
+    0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x83, 0xFE, 0x00, 0x00,
+    0x3F, 0xE0, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xE0,
+    0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0xE0, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0xC0, 0x00,
+    0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x80, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0,
+    0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFE,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x01, 0xFF,
+    0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0xF0, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0xC0, 0xF0, 0xFF,
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xF0, 0xFF, 0x00, 0x00,
+    0x07, 0xFF, 0xC1, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE3, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x07, 0xF9, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x0F, 0xF9, 0xFF, 0xC0,
+    0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF8, 0x7F, 0x00, 0x7F, 0xFC,
+    0x01, 0xFF, 0xF0, 0x3E, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFF,
+    0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x00,
+    0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03,
+    0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x01,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
+    0xE0, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x7F,
+    0xE1, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE1, 0xFE,
+    0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xE1, 0xFE, 0x00, 0x00,
+    0x0F, 0xF8, 0x07, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
+    0x3F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xE1, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xC1,
+    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0xFF, 0x00, 0xFF, 0xF0,
+    0x03, 0xFF, 0xF0, 0xFE, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
+    0xE0, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xC0, 0xE0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0xC0,
+    0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x80, 0x80, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07,
+    0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xE7, 0xE3, 0xFF, 0xC0, 0x00,
+    0x01, 0xFF, 0x87, 0xE0, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x07, 0xE0, 0x7F, 0xE0, 0x00, 0x03, 0xFE,
+    0x07, 0xE0, 0x3F, 0xE0, 0x00, 0xC3, 0xFE, 0x07, 0xE0, 0x1F, 0xE0, 0x03, 0xC3, 0xFC, 0x07, 0xE0,
+    0x1F, 0xE0, 0x0F, 0xC3, 0xFC, 0x07, 0xE0, 0x1F, 0xE0, 0x7F, 0xC3, 0xFC, 0x07, 0xE0, 0x1F, 0xE0,
+    0xFF, 0xC3, 0xFC, 0x07, 0xE0, 0x1F, 0xF0, 0xFF, 0xC3, 0xFC, 0x07, 0xE0, 0x1F, 0xE0, 0xFF, 0xC3,
+    0xFE, 0x07, 0xE0, 0x1F, 0xE0, 0xFF, 0x83, 0xFE, 0x07, 0xE0, 0x1F, 0xE0, 0xFE, 0x01, 0xFF, 0x07,
+    0xE0, 0x3F, 0xE0, 0xFC, 0x01, 0xFF, 0x87, 0xE0, 0x3F, 0xE0, 0xF0, 0x01, 0xFF, 0xE7, 0xE0, 0x7F,
+    0xE0, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x00,
+    0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x3F,
+    0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
+    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF9, 0xF8,
+    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE1, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0xF8, 0x1F, 0xF8,
+    0x00, 0x00, 0xFF, 0x81, 0xF8, 0x0F, 0xF9, 0xE0, 0x00, 0xFF, 0x81, 0xF8, 0x07, 0xFF, 0xF8, 0x00,
+    0xFF, 0x01, 0xF8, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0x01, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0x01,
+    0xF8, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0x01, 0xF8, 0x07,
+    0xFF, 0xFF, 0x80, 0xFF, 0x81, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0x81, 0xF8, 0x07, 0xFE, 0x3F,
+    0x80, 0x7F, 0xC1, 0xF8, 0x0F, 0xFC, 0x1F, 0x80, 0x7F, 0xE1, 0xF8, 0x0F, 0xF8, 0x1F, 0x80, 0x7F,
+    0xF9, 0xF8, 0x1F, 0xF8, 0x1F, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xF0, 0x3F, 0x00, 0x3F, 0xFF, 0xF8,
+    0x3F, 0xF0, 0x03, 0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0,
+    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x3F, 0x80, 0x00, 0x00,
+    0x03, 0xFF, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xF8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3E,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0xE7, 0xE3, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0x87, 0xE0, 0xFF, 0xE0,
+    0x7F, 0x01, 0xFF, 0x07, 0xE0, 0x7F, 0xE0, 0x7F, 0x03, 0xFE, 0x07, 0xE0, 0x3F, 0xE0, 0x3C, 0x03,
+    0xFE, 0x07, 0xE0, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x07, 0xE0, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x07,
+    0xE0, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x07, 0xE0, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x07, 0xE0, 0x1F,
+    0xF0, 0x00, 0x03, 0xFC, 0x07, 0xE0, 0x1F, 0xE0, 0x3E, 0x03, 0xFE, 0x07, 0xE0, 0x1F, 0xE0, 0x7F,
+    0x03, 0xFE, 0x07, 0xE0, 0x1F, 0xE0, 0x7F, 0x01, 0xFF, 0x07, 0xE0, 0x3F, 0xE0, 0xFF, 0x81, 0xFF,
+    0x87, 0xE0, 0x3F, 0xE0, 0xFF, 0x81, 0xFF, 0xE7, 0xE0, 0x7F, 0xE0, 0xFF, 0x80, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0x80,
+    0x7F, 0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0x80, 0x3E, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x80, 0x00, 0x07,
+    0xFF, 0xFF, 0xFE, 0x00, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x80, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0xFF, 0xF3, 0xF1, 0xFF, 0xE0, 0xFF, 0x80,
+    0xFF, 0xC3, 0xF0, 0x7F, 0xF0, 0xFF, 0xC0, 0xFF, 0x83, 0xF0, 0x3F, 0xF0, 0x7F, 0xE1, 0xFF, 0x03,
+    0xF0, 0x1F, 0xF0, 0x3F, 0xE1, 0xFF, 0x03, 0xF0, 0x0F, 0xF0, 0x0F, 0xE1, 0xFE, 0x03, 0xF0, 0x0F,
+    0xF0, 0x07, 0xE1, 0xFE, 0x03, 0xF0, 0x0F, 0xF0, 0x03, 0xE1, 0xFE, 0x03, 0xF0, 0x0F, 0xF0, 0x0F,
+    0xE1, 0xFE, 0x03, 0xF0, 0x0F, 0xF8, 0x1F, 0xE1, 0xFE, 0x03, 0xF0, 0x0F, 0xF0, 0x3F, 0xE1, 0xFF,
+    0x03, 0xF0, 0x0F, 0xF0, 0x7F, 0xE1, 0xFF, 0x03, 0xF0, 0x0F, 0xF0, 0xFF, 0x80, 0xFF, 0x83, 0xF0,
+    0x1F, 0xF0, 0xFF, 0x00, 0xFF, 0xC3, 0xF0, 0x1F, 0xF0, 0xFE, 0x00, 0xFF, 0xF3, 0xF0, 0x3F, 0xF0,
+    0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x7F, 0xE0, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x7F, 0xE0, 0xF0, 0x00,
+    0x3F, 0xFF, 0xF0, 0x7F, 0xC0, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x7F, 0xC0, 0xC0, 0x00, 0x1F, 0xFF,
+    0xF0, 0x7F, 0x80, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x7E,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xC3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xC1,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x07,
+    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00,
+    0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
+    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x1F,
+    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xCF, 0xF0, 0x00,
+    0x00, 0x7F, 0x80, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F,
+    0x80, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x0F,
+    0xC3, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFE,
+    0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
+    0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7E,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xE1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xE1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC1,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x43, 0xFE, 0x00, 0x00,
+    0x1F, 0xE0, 0x01, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
+    0x1F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xC3,
+    0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xC3, 0xFE, 0x00,
+    0x00, 0x1F, 0xE0, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F,
+    0xE0, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xF0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0xE0,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x60, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xE0, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0, 0xFF, 0xFC, 0x03,
+    0xFF, 0xE0, 0x1F, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
+    0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x01,
+    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x01, 0xFE, 0x00,
+    0x00, 0x0F, 0xF8, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x0F,
+    0xF0, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x7F,
+    0xC1, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x1F, 0xE0, 0xFF,
+    0xE0, 0x00, 0x7F, 0xF0, 0x0F, 0xE0, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x07, 0xE0, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x03, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x60, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x20, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xC1, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x1F, 0xC1,
+    0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC3, 0xFE, 0x00,
+    0x00, 0x3F, 0xE0, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x83, 0xFC, 0x00, 0x00, 0x1F,
+    0xE0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xF8,
+    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xE0, 0x43, 0xFC,
+    0x00, 0x00, 0x1F, 0xE0, 0x80, 0xC3, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xC3, 0xFE, 0x00, 0x00,
+    0x3F, 0xE0, 0x07, 0xC1, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xC1, 0xFF, 0xC0, 0x00, 0xFF, 0xE0,
+    0x1F, 0xC1, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+    0x00, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xC0,
+    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3E, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0xFF,
+    0xE0, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x7F,
+    0x03, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x3E, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+    0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x3E, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
+    0x7F, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x81,
+    0xFF, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0x81, 0xFF, 0xF8,
+    0x07, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x7F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x3E, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
+    0x1F, 0x01, 0xFE, 0x03, 0xE0, 0x3F, 0x81, 0xFE, 0x07, 0xF0, 0x7F, 0xC1, 0xFE, 0x0F, 0xF8, 0xFF,
+    0xE1, 0xFE, 0x1F, 0xFC, 0xFF, 0xE1, 0xFE, 0x1F, 0xFC, 0xFF, 0xE1, 0xFE, 0x1F, 0xFC, 0xFF, 0xE1,
+    0xFE, 0x1F, 0xFC, 0xFF, 0xE1, 0xFE, 0x1F, 0xFC, 0x7F, 0xC1, 0xFE, 0x0F, 0xF8, 0x3F, 0x81, 0xFE,
+    0x07, 0xF0, 0x1F, 0x01, 0xFE, 0x03, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
+    0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x07, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x00,
+    0x07, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x80, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xF8, 0x3E, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+    0x03, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xC0, 0x00,
+    0x00, 0x00, 0x1F, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00,
+    0x1F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x01, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
+    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xE0, 0x40,
+    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xC0, 0x00, 0x00,
+    0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF8, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x3E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x7F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+    0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x3E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xC0, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xC0,
+    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xE0, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x78, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xF0,
+    0xF0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xF1, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0xFF,
+    0xF0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0xFF,
+    0xE0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x1E, 0x00,
+};
+static const uint32_t InterTight_Bold34pt8b_AtlasOffsets[] PROGMEM = {
+    0, 1, 85, 154, 448, 752, 1081, 1375, 1402, 1546, 1690, 1802,
+    1972, 2011, 2033, 2057, 2249, 2522, 2676, 2921, 3180, 3460, 3712, 3978,
+    4216, 4475, 4741, 4801, 4885, 5055, 5154, 5324, 5548, 6044, 6366, 6625,
+    6926, 7213, 7444, 7675, 7983, 8270, 8340, 8564, 8851, 9068, 9439, 9726,
+    10041, 10293, 10608, 10874, 11140, 11420, 11700, 12029, 12498, 12806, 13128, 13387,
+    13515, 13707, 13843, 13927, 13959, 13987, 14152, 14397, 14567, 14819, 14994, 15162,
+    15414, 15652, 15729, 15882, 16127, 16197, 16462, 16632, 16812, 17057, 17309, 17419,
+    17584, 17722, 17892, 18077, 18352, 18527, 18786, 18941, 19133, 19233, 19425, 19497,
+    19497, 19498, 19874, 19922, 20181, 20433, 20650, 20954, 21210, 21260, 21602, 21944,
+    22264, 22560, 22582, 22878, 23174, 23243, 23481, 23509, 23649, 23677, 23831, 24062,
+    24116, 24142, 24373, 24604, 24793, 25010, 25066, 25283, 25500, 25804, 26172, 26540,
+    26908, 27276, 27524, 27868, 28264, 28651, 28915, 29187, 29451, 29715, 29835, 30043,
+    30371, 30707, 31035, 31363, 31723, 32128, 32488, 32848, 33023, 33327, 33687, 34007,
+    34327, 34647, 35015, 35335, 35594, 35748, 35979, 36210, 36441, 36672, 36792, 37030,
+    37268, 37506, 37751, 37996, 38241, 38486, 38591, 38773, 39109, 39389, 39627, 39865,
+    40117, 40369, 40621, 40873, 41038, 41227, 41499, 41737, 41982, 42220, 42553, 42745,
+};
+
+// InterTightBold52pt8bfr.h
+static const uint8_t InterTightBold52pt8bfr_Atlas[] PROGMEM = {
+    0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
+    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
+    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xF0, 0x7F, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+    0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xF8, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xF0,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xC0, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xF0, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xF0,
+    0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
+    0x80, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xF8,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
+    0x3F, 0xF0, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x3F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
+    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x00,
+    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF8,
+    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0,
+    0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
+    0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
+    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0,
+    0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xC0,
+    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
+    0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x07,
+    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xE0,
+    0x3F, 0xFE, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xF3, 0xFE,
+    0x00, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07,
+    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x3F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
+    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
+    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF9, 0xFC, 0x00, 0x00, 0x07,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x07,
+    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80,
+    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x3F,
+    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
+    0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80,
+    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
+    0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x3F,
+    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0,
+    0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0x80,
+    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFF, 0x80, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00,
+    0x0F, 0xFF, 0xC3, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFF, 0x80,
+    0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
+    0x00, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xFC,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
+    0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0x00, 0x07,
+    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+    0x7F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x0F, 0xF8, 0x00,
+    0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0,
+    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
+    0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F,
+    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+    0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+    0x3F, 0xF0, 0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x0F,
+    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0x3F, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0,
+    0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xF8, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
+    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xE3, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x07,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F,
+    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xE0,
+    0x3F, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xF0,
+    0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0,
+    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+    0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
+    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0,
+    0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
+    0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xE0,
+    0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xF0,
+    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
+    0x7F, 0xF0, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0x80, 0x7F,
+    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0x01, 0xFF, 0xE0,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80,
+    0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE,
+    0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFE,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x01,
+    0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00,
+    0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF0,
+    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+    0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF8,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xE0, 0x00, 0x00,
+    0x01, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xE0,
+    0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
+    0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF,
+    0x80, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x03,
+    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x1F,
+    0xFE, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x3F,
+    0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x3F,
+    0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x3F,
+    0xC0, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0xFF,
+    0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
+    0x00, 0x01, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFE,
+    0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFC, 0x01, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFF, 0x03, 0xFC,
+    0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x7F, 0x87, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x7F,
+    0x80, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0x80, 0x1F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x7F,
+    0x80, 0x0F, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0x80, 0x07, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x7F,
+    0x80, 0x03, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x7F,
+    0x80, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F,
+    0x80, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x7F,
+    0x80, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x7F,
+    0x80, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x7F,
+    0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x7F, 0x80, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x80, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0x80, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
+    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
+    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0x80, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x01, 0xFF,
+    0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x7F, 0xE0,
+    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0xFF,
+    0x80, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
+    0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x01,
+    0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x3F, 0xFE, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
+    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
+    0x07, 0xFC, 0x00, 0x00,
+};
+static const uint32_t InterTightBold52pt8bfr_AtlasOffsets[] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 66, 66, 66, 616, 916, 1406, 1926, 2496, 2996, 3526,
+    4016, 4546, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076,
+    5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076,
+    5076, 5076, 5076, 5076, 5076, 5076, 5076, 5076, 6036, 6036, 6036, 6036,
+    6036, 6036, 6036, 6036, 6036, 6036, 6412, 6412, 6412, 6412, 6820, 6820,
+    6820, 7290, 7290, 7290, 7290, 7290, 7290, 7290, 7290, 7290, 7290, 7530,
+    7530, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818,
+    7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7818,
+    7818, 7818, 7818, 7818, 7818, 7988, 7988, 7988, 7988, 7988, 7988, 7988,
+    7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988,
+    7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988,
+    7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988,
+    7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988,
+    7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988,
+    7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988, 7988,
+};
+
+static const FontAtlas_t FONT_ATLASES[] = {
+    { &InterTight_SemiBold6pt8b, InterTight_SemiBold6pt8b_Atlas, InterTight_SemiBold6pt8b_AtlasOffsets },
+    { &InterTight_Bold8pt8b, InterTight_Bold8pt8b_Atlas, InterTight_Bold8pt8b_AtlasOffsets },
+    { &InterTight_SemiBold10pt8b, InterTight_SemiBold10pt8b_Atlas, InterTight_SemiBold10pt8b_AtlasOffsets },
+    { &InterTight_SemiBold12pt8b, InterTight_SemiBold12pt8b_Atlas, InterTight_SemiBold12pt8b_AtlasOffsets },
+    { &InterTight_SemiBold14pt8b, InterTight_SemiBold14pt8b_Atlas, InterTight_SemiBold14pt8b_AtlasOffsets },
+    { &InterTight_Bold16pt8b, InterTight_Bold16pt8b_Atlas, InterTight_Bold16pt8b_AtlasOffsets },
+    { &InterTight_Bold18pt8b, InterTight_Bold18pt8b_Atlas, InterTight_Bold18pt8b_AtlasOffsets },
+    { &InterTight_Bold22pt8b, InterTight_Bold22pt8b_Atlas, InterTight_Bold22pt8b_AtlasOffsets },
+    { &InterTight_Bold24pt8b, InterTight_Bold24pt8b_Atlas, InterTight_Bold24pt8b_AtlasOffsets },
+    { &InterTight_Bold34pt8b, InterTight_Bold34pt8b_Atlas, InterTight_Bold34pt8b_AtlasOffsets },
+    { &InterTightBold52pt8bfr, InterTightBold52pt8bfr_Atlas, InterTightBold52pt8bfr_AtlasOffsets },
+};
+
+// Approx. 145625 bytes
@@ -0,0 +1,975 @@
+// Subset of ../InterTightBold16pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_Bold16pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0xEF, 0xFF, 0xEE, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3,
+  0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3C, 0x03, 0x83, 0x80, 0x38, 0x38, 0x07,
+  0x87, 0x80, 0x78, 0x78, 0x07, 0x87, 0x80, 0x78, 0x78, 0x3F, 0xFF, 0xF7,
+  0xFF, 0xFE, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0x0F, 0x0F, 0x00, 0xF0, 0xF0,
+  0x0E, 0x0E, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xCF, 0xFF, 0xFC, 0x1C, 0x1E, 0x01, 0xC1, 0xC0, 0x1C, 0x1C, 0x03, 0xC3,
+  0xC0, 0x3C, 0x3C, 0x03, 0xC3, 0xC0, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x01,
+  0x80, 0x01, 0xFE, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xF1, 0xF3,
+  0x7E, 0x7C, 0x67, 0xEF, 0x8C, 0x7D, 0xF1, 0x80, 0x3F, 0x30, 0x07, 0xFE,
+  0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xC0, 0x0F,
+  0xFC, 0x01, 0x9F, 0xFC, 0x31, 0xF7, 0x86, 0x3E, 0xF8, 0xC7, 0xDF, 0x9B,
+  0xF9, 0xFF, 0xFE, 0x3F, 0xFF, 0x81, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x30,
+  0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xFE, 0x01, 0xC7,
+  0xF8, 0x0E, 0x3C, 0xF0, 0x38, 0xE1, 0xC1, 0xC3, 0x87, 0x0E, 0x0E, 0x1C,
+  0x38, 0x3C, 0xF1, 0xC0, 0x7F, 0x8E, 0x01, 0xFE, 0x38, 0x01, 0xF1, 0xC0,
+  0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC7, 0x80, 0x0E, 0x7F, 0x80,
+  0x39, 0xFE, 0x01, 0xCF, 0x3C, 0x0E, 0x38, 0x70, 0x38, 0xE1, 0xC1, 0xC3,
+  0x87, 0x0E, 0x0E, 0x1C, 0x38, 0x3C, 0xF1, 0xC0, 0x7F, 0x8E, 0x01, 0xFE,
+  0x38, 0x01, 0xE0, 0x03, 0xE0, 0x00, 0xFF, 0x00, 0x1F, 0xF8, 0x03, 0xFF,
+  0xC0, 0x3E, 0x7C, 0x03, 0xC3, 0xC0, 0x3C, 0x3C, 0x03, 0xC7, 0xC0, 0x3E,
+  0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x03,
+  0xFE, 0x1E, 0x7F, 0xF1, 0xEF, 0xCF, 0x9E, 0xF8, 0x7F, 0xEF, 0x87, 0xFC,
+  0xF8, 0x3F, 0xCF, 0xC1, 0xF8, 0x7F, 0xFF, 0x87, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xE0, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x87, 0x87,
+  0xC3, 0xE1, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x07, 0xC3, 0xE1, 0xF0, 0xF8, 0x3E,
+  0x1F, 0x07, 0xC3, 0xE0, 0xF0, 0x78, 0x3E, 0x1F, 0x07, 0xC3, 0xE1, 0xF0,
+  0x7C, 0x3E, 0x1F, 0x0F, 0x83, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F,
+  0x87, 0xC3, 0xE1, 0xF1, 0xF0, 0xF8, 0x7C, 0x3E, 0x3E, 0x1F, 0x1F, 0x0F,
+  0x87, 0x80, 0x07, 0x00, 0x38, 0x11, 0xC4, 0xEE, 0xEF, 0xFF, 0x9F, 0xF0,
+  0x3E, 0x07, 0xFC, 0xFF, 0xFB, 0xBB, 0x91, 0xC4, 0x0E, 0x00, 0x70, 0x00,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x3D, 0xF7,
+  0xDE, 0x79, 0xE7, 0x9C, 0xF3, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77,
+  0xFF, 0xF7, 0x00, 0x01, 0xE0, 0x3C, 0x07, 0x81, 0xF0, 0x3C, 0x07, 0x80,
+  0xF0, 0x3E, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0xC0, 0xF0, 0x1E, 0x03, 0xC0,
+  0xF8, 0x1E, 0x03, 0xC0, 0x78, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0xC0,
+  0x78, 0x0F, 0x01, 0xE0, 0x78, 0x0F, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0,
+  0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xF1, 0xF8, 0xFC, 0x1F, 0x9F, 0x01, 0xF7,
+  0xE0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF,
+  0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x07, 0xEF,
+  0x80, 0xF9, 0xF8, 0x3F, 0x1F, 0x8F, 0xC3, 0xFF, 0xF8, 0x3F, 0xFE, 0x03,
+  0xFF, 0x80, 0x1F, 0xC0, 0x03, 0xE1, 0xFC, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7,
+  0xF8, 0xFE, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
+  0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8,
+  0x1F, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7C, 0x3F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x3E, 0x00,
+  0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0xEF, 0xE1, 0xFF,
+  0xC0, 0x7F, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0xFF,
+  0x80, 0x7F, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0xFC, 0x00, 0x1F, 0x00,
+  0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x83, 0xF7, 0xFF, 0xF1, 0xFF, 0xF0,
+  0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00,
+  0xFF, 0x80, 0x1F, 0xF0, 0x07, 0xFE, 0x00, 0xF7, 0xC0, 0x3E, 0xF8, 0x07,
+  0x9F, 0x01, 0xE3, 0xE0, 0x7C, 0x7C, 0x0F, 0x0F, 0x83, 0xE1, 0xF0, 0x78,
+  0x3E, 0x1F, 0x07, 0xC7, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
+  0xF8, 0x3F, 0xFF, 0x3F, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0xE7, 0xC0, 0x03,
+  0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x79, 0xF8, 0x3D, 0xFE, 0x1F, 0xFF,
+  0x8F, 0xFF, 0xE7, 0xC3, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x0F, 0xFC, 0x07, 0xFE, 0x07, 0xFF, 0x87, 0xE7, 0xFF, 0xF1, 0xFF, 0xF0,
+  0x7F, 0xF0, 0x0F, 0xE0, 0x03, 0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0xFF,
+  0xFE, 0x3F, 0x1F, 0x9F, 0x03, 0xF7, 0xC0, 0x7D, 0xF0, 0x00, 0xF8, 0xFC,
+  0x3E, 0x7F, 0x8F, 0xBF, 0xF3, 0xFF, 0xFE, 0xFE, 0x1F, 0xBF, 0x03, 0xFF,
+  0xC0, 0x7F, 0xE0, 0x1F, 0xFC, 0x07, 0xDF, 0x01, 0xF7, 0xC0, 0xFD, 0xF8,
+  0x7E, 0x3F, 0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3E,
+  0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0xF0,
+  0x01, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x80,
+  0x0F, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x03, 0xF0,
+  0x03, 0xFF, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x7E, 0x1F, 0x9F, 0x03, 0xE7,
+  0xC0, 0xF9, 0xF0, 0x3E, 0x7C, 0x0F, 0x8F, 0x87, 0xC1, 0xFF, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC7, 0xE1, 0xFB, 0xF0, 0x3F, 0xF8, 0x07,
+  0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xF8, 0x7F, 0x7F, 0xFF, 0x8F, 0xFF, 0xC1,
+  0xFF, 0xE0, 0x1F, 0xE0, 0x07, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0xE1, 0xFF,
+  0xFC, 0x7E, 0x1F, 0xBF, 0x03, 0xEF, 0x80, 0xFB, 0xE0, 0x3F, 0xF8, 0x0F,
+  0xFE, 0x03, 0xFF, 0xC0, 0xFD, 0xF8, 0x7F, 0x7F, 0xFF, 0xCF, 0xFD, 0xF1,
+  0xFE, 0x7C, 0x3F, 0x1F, 0x00, 0x0F, 0xBE, 0x03, 0xEF, 0xC0, 0xF9, 0xF8,
+  0xFC, 0x7F, 0xFF, 0x0F, 0xFF, 0x81, 0xFF, 0xC0, 0x1F, 0xC0, 0x77, 0xFF,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7F, 0xFF, 0x70, 0x39, 0xF7, 0xDF,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x9E, 0x79, 0xC7, 0x3C,
+  0xF3, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x7F, 0x01,
+  0xFF, 0x0F, 0xFE, 0x3F, 0xF0, 0xFF, 0xC0, 0xFF, 0x00, 0xF8, 0x00, 0xFE,
+  0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFE, 0x01, 0xFF, 0x00, 0x7F, 0x00,
+  0x1F, 0x00, 0x07, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0xFE, 0x00,
+  0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x1F,
+  0x00, 0x7F, 0x03, 0xFF, 0x0F, 0xFC, 0x7F, 0xF0, 0xFF, 0x80, 0xFE, 0x00,
+  0xF8, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x0F, 0xE0, 0x7F, 0xF1, 0xFF, 0xF3,
+  0xFF, 0xEF, 0xC7, 0xFF, 0x07, 0xFE, 0x0F, 0x80, 0x1F, 0x00, 0x7E, 0x01,
+  0xF8, 0x07, 0xF0, 0x1F, 0xC0, 0x3E, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0,
+  0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0xF0, 0x03,
+  0xE0, 0x03, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0xFE, 0x03, 0xFC, 0x0F, 0xC0, 0x03,
+  0xF0, 0xF8, 0x00, 0x0F, 0x87, 0xC3, 0xF7, 0xBE, 0x7C, 0x3F, 0xFC, 0xF3,
+  0xC3, 0xFF, 0xE7, 0x9E, 0x3F, 0xFF, 0x1F, 0xF1, 0xF0, 0xF8, 0xFF, 0x1F,
+  0x07, 0xC7, 0xF8, 0xF0, 0x1E, 0x3F, 0xC7, 0x80, 0xF1, 0xFE, 0x3C, 0x07,
+  0x8F, 0xF1, 0xE0, 0x3C, 0x7F, 0x8F, 0x01, 0xE3, 0xFC, 0x7C, 0x1F, 0x3D,
+  0xE1, 0xF0, 0xF9, 0xEF, 0x8F, 0xFF, 0xFF, 0x3C, 0x3F, 0xEF, 0xF1, 0xF0,
+  0xFF, 0x7F, 0x0F, 0x83, 0xE1, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x07, 0xF8, 0x07, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0,
+  0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07,
+  0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
+  0x00, 0x3F, 0xF0, 0x00, 0xF3, 0xE0, 0x07, 0xCF, 0x80, 0x1F, 0x3E, 0x00,
+  0x78, 0x7C, 0x03, 0xE1, 0xF0, 0x0F, 0x87, 0xC0, 0x3E, 0x0F, 0x01, 0xF0,
+  0x3E, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0x0F, 0x80, 0x7C, 0x7C, 0x00, 0xF9, 0xF0, 0x03, 0xE7, 0xC0, 0x0F, 0xBE,
+  0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0xFC, 0xF8,
+  0x1F, 0xBE, 0x03, 0xEF, 0x80, 0xFB, 0xE0, 0x3E, 0xF8, 0x0F, 0xBE, 0x07,
+  0xCF, 0xFF, 0xE3, 0xFF, 0xE0, 0xFF, 0xFE, 0x3F, 0xFF, 0xEF, 0x81, 0xFB,
+  0xE0, 0x3F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x3F, 0xFF,
+  0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xE3, 0xFF, 0xE0, 0x01, 0xFC, 0x00, 0x3F,
+  0xFC, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0xC3, 0xF8, 0x7E, 0x3F, 0x00, 0xF9,
+  0xF0, 0x07, 0xCF, 0x80, 0x1F, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00,
+  0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
+  0x00, 0x00, 0x7C, 0x00, 0xFB, 0xE0, 0x0F, 0x9F, 0x80, 0x7C, 0x7F, 0x0F,
+  0xC1, 0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x3F, 0x80, 0xFF,
+  0xF0, 0x1F, 0xFF, 0x83, 0xFF, 0xF8, 0x7F, 0xFF, 0x8F, 0x83, 0xF9, 0xF0,
+  0x1F, 0xBE, 0x01, 0xF7, 0xC0, 0x3E, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0,
+  0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0,
+  0x1F, 0xF8, 0x07, 0xDF, 0x00, 0xFB, 0xE0, 0x3F, 0x7C, 0x1F, 0xCF, 0xFF,
+  0xF1, 0xFF, 0xFC, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
+  0x01, 0xF0, 0x03, 0xE0, 0x07, 0xFF, 0xEF, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF,
+  0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F,
+  0x00, 0x3E, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xFC, 0x03, 0xFF,
+  0xF0, 0x3F, 0xFF, 0xC3, 0xF0, 0x7F, 0x3F, 0x01, 0xF9, 0xF0, 0x07, 0xEF,
+  0x80, 0x3F, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x3F,
+  0xFF, 0x81, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x1F, 0x7C,
+  0x00, 0xFB, 0xE0, 0x0F, 0x9F, 0x80, 0x7C, 0x7F, 0x0F, 0xE1, 0xFF, 0xFE,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x3F, 0x80, 0xF8, 0x01, 0xFF, 0x80,
+  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8,
+  0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x80, 0x1F,
+  0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01,
+  0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F,
+  0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0,
+  0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xE3,
+  0xF7, 0xFF, 0xCF, 0xFF, 0x07, 0xFC, 0x07, 0xF0, 0xF8, 0x07, 0xEF, 0x80,
+  0xFC, 0xF8, 0x0F, 0x8F, 0x81, 0xF8, 0xF8, 0x3F, 0x0F, 0x87, 0xE0, 0xF8,
+  0xFC, 0x0F, 0x8F, 0x80, 0xF9, 0xF8, 0x0F, 0xBF, 0x00, 0xFF, 0xE0, 0x0F,
+  0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0xFE, 0xF8, 0x0F, 0xCF, 0xC0,
+  0xFC, 0x7E, 0x0F, 0x83, 0xE0, 0xF8, 0x3F, 0x0F, 0x81, 0xF8, 0xF8, 0x1F,
+  0x8F, 0x80, 0xFC, 0xF8, 0x07, 0xEF, 0x80, 0x7E, 0xF8, 0x01, 0xF0, 0x03,
+  0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
+  0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00,
+  0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFE, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0xF7,
+  0xFE, 0xF0, 0x7B, 0xFF, 0x7C, 0x7D, 0xFF, 0x9E, 0x3C, 0xFF, 0xCF, 0x1E,
+  0x7F, 0xE7, 0xDF, 0x3F, 0xF1, 0xEF, 0x1F, 0xF8, 0xFF, 0x8F, 0xFC, 0x7F,
+  0x87, 0xFE, 0x1F, 0xC3, 0xFF, 0x0F, 0xE1, 0xFF, 0x83, 0xE0, 0xFF, 0xC1,
+  0xF0, 0x7F, 0xE0, 0xF8, 0x3F, 0xF0, 0x38, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
+  0x7F, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0x07, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 0xEF, 0x8F, 0xFC, 0xF9,
+  0xFF, 0x9F, 0x3F, 0xF1, 0xF7, 0xFE, 0x1F, 0xFF, 0xC3, 0xFF, 0xF8, 0x3F,
+  0xFF, 0x03, 0xFF, 0xE0, 0x7F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x0F,
+  0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0x00, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF,
+  0xFC, 0x07, 0xFF, 0xF8, 0x3F, 0x87, 0xF1, 0xF8, 0x07, 0xE7, 0xC0, 0x0F,
+  0x9F, 0x00, 0x3E, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE,
+  0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00,
+  0x1F, 0x7C, 0x00, 0xF9, 0xF0, 0x03, 0xE7, 0xE0, 0x1F, 0x8F, 0xE1, 0xFC,
+  0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0x00, 0xFF,
+  0xF0, 0x7F, 0xFE, 0x3F, 0xFF, 0x9F, 0xFF, 0xEF, 0x83, 0xF7, 0xC0, 0xFF,
+  0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x07, 0xFF, 0x07,
+  0xEF, 0xFF, 0xF7, 0xFF, 0xF3, 0xFF, 0xF1, 0xFF, 0xE0, 0xF8, 0x00, 0x7C,
+  0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01,
+  0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xFF,
+  0xF8, 0x3F, 0x87, 0xF1, 0xF8, 0x07, 0xE7, 0xC0, 0x0F, 0x9F, 0x00, 0x3E,
+  0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8,
+  0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0x7C, 0x3C,
+  0xF9, 0xF0, 0x7B, 0xE7, 0xE1, 0xFF, 0x8F, 0xE3, 0xFC, 0x1F, 0xFF, 0xE0,
+  0x3F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0x7C, 0x00, 0x00, 0xF8, 0x00,
+  0x01, 0xF0, 0xFF, 0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xE3, 0xFF, 0xFC, 0xF8,
+  0x3F, 0x3E, 0x07, 0xEF, 0x80, 0xFB, 0xE0, 0x3E, 0xF8, 0x0F, 0xBE, 0x03,
+  0xEF, 0x81, 0xFB, 0xE0, 0xFC, 0xFF, 0xFF, 0x3F, 0xFF, 0x8F, 0xFF, 0xC3,
+  0xFF, 0xE0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x83, 0xE3, 0xE0, 0xF8, 0xF8,
+  0x1F, 0x3E, 0x07, 0xCF, 0x80, 0xFB, 0xE0, 0x3F, 0x03, 0xFC, 0x01, 0xFF,
+  0xE0, 0x7F, 0xFE, 0x1F, 0xFF, 0xE3, 0xE0, 0xFC, 0xF8, 0x0F, 0xDF, 0x00,
+  0xFB, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xF0, 0x0F, 0xFF,
+  0x80, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xF8, 0x03,
+  0xEF, 0x00, 0x7D, 0xF0, 0x0F, 0xBF, 0x07, 0xF3, 0xFF, 0xFC, 0x7F, 0xFF,
+  0x03, 0xFF, 0xC0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00,
+  0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00,
+  0x0F, 0x80, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF,
+  0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF,
+  0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE,
+  0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0x3F,
+  0x07, 0xE3, 0xFF, 0xF8, 0x7F, 0xFE, 0x03, 0xFF, 0x80, 0x1F, 0xC0, 0xFC,
+  0x00, 0x7D, 0xF0, 0x03, 0xF7, 0xC0, 0x0F, 0xDF, 0x80, 0x3E, 0x3E, 0x00,
+  0xF8, 0xF8, 0x07, 0xE3, 0xF0, 0x1F, 0x07, 0xC0, 0x7C, 0x1F, 0x03, 0xF0,
+  0x7E, 0x0F, 0x80, 0xF8, 0x3E, 0x03, 0xE1, 0xF8, 0x0F, 0x87, 0xC0, 0x1F,
+  0x1F, 0x00, 0x7C, 0x7C, 0x01, 0xF3, 0xE0, 0x03, 0xEF, 0x80, 0x0F, 0xBE,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0x80, 0xF8, 0x07, 0xC0, 0x3E, 0xFC, 0x07, 0xC0,
+  0x3E, 0x7C, 0x07, 0xE0, 0x3E, 0x7C, 0x07, 0xE0, 0x7E, 0x7C, 0x0F, 0xE0,
+  0x7C, 0x3E, 0x0F, 0xE0, 0x7C, 0x3E, 0x0F, 0xF0, 0x7C, 0x3E, 0x0F, 0xF0,
+  0x7C, 0x3E, 0x1F, 0xF0, 0xF8, 0x1F, 0x1E, 0xF0, 0xF8, 0x1F, 0x1E, 0x78,
+  0xF8, 0x1F, 0x1E, 0x78, 0xF0, 0x1F, 0x3E, 0x79, 0xF0, 0x0F, 0x3C, 0x79,
+  0xF0, 0x0F, 0xBC, 0x3D, 0xF0, 0x0F, 0xBC, 0x3D, 0xE0, 0x07, 0xF8, 0x3D,
+  0xE0, 0x07, 0xF8, 0x3F, 0xE0, 0x07, 0xF8, 0x1F, 0xE0, 0x07, 0xF8, 0x1F,
+  0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F,
+  0x80, 0x03, 0xF0, 0x0F, 0x80, 0x7C, 0x01, 0xFB, 0xF0, 0x0F, 0x8F, 0x80,
+  0xFC, 0x3E, 0x0F, 0xC1, 0xF8, 0x7C, 0x07, 0xC7, 0xE0, 0x3F, 0x3E, 0x00,
+  0xFB, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xF8,
+  0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xE0, 0x07,
+  0xDF, 0x80, 0x7E, 0x7C, 0x03, 0xE3, 0xF0, 0x3F, 0x0F, 0x83, 0xF0, 0x3E,
+  0x1F, 0x01, 0xF9, 0xF8, 0x07, 0xCF, 0x80, 0x3F, 0xF8, 0x00, 0xFF, 0xE0,
+  0x0F, 0xDF, 0x00, 0x7C, 0x7C, 0x07, 0xE3, 0xE0, 0x3E, 0x0F, 0x83, 0xE0,
+  0x7C, 0x1F, 0x01, 0xF1, 0xF0, 0x0F, 0x8F, 0x80, 0x3E, 0xF8, 0x01, 0xFF,
+  0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00,
+  0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07,
+  0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x80,
+  0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F,
+  0x80, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x1E, 0x03, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1F, 0x01, 0xE0, 0x3C, 0x07,
+  0x80, 0xF8, 0x0F, 0x01, 0xE0, 0x3C, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x07,
+  0x80, 0xF0, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0x7C,
+  0x03, 0xE0, 0x3F, 0x81, 0xDC, 0x1E, 0xF0, 0xE3, 0x8F, 0x1E, 0x70, 0x77,
+  0x83, 0xFC, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1,
+  0xE7, 0x8F, 0x3C, 0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFE, 0x7C,
+  0x3F, 0x78, 0x1F, 0x00, 0x1F, 0x00, 0x7F, 0x1F, 0xFF, 0x7F, 0xFF, 0x7C,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0x7F, 0xDF, 0x7F,
+  0xDF, 0x1F, 0x1F, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F,
+  0x80, 0x07, 0xC0, 0x03, 0xE3, 0xE1, 0xF7, 0xF8, 0xFB, 0xFE, 0x7F, 0xFF,
+  0xBF, 0x8F, 0xDF, 0x83, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFF, 0x07, 0xFF, 0xC7, 0xEF, 0xFF, 0xF7,
+  0xFF, 0xF3, 0xEF, 0xF1, 0xF1, 0xF0, 0x07, 0xF0, 0x1F, 0xF8, 0x3F, 0xFC,
+  0x7F, 0xFE, 0x7E, 0x3F, 0x7C, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x0F, 0xFC, 0x1F, 0x7E, 0x3F, 0x7F, 0xFE,
+  0x3F, 0xFC, 0x1F, 0xFC, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03,
+  0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x3E, 0x3E, 0x3F, 0xDF, 0x3F,
+  0xFF, 0xBF, 0xFF, 0xDF, 0x8F, 0xFF, 0x83, 0xFF, 0x80, 0xFF, 0xC0, 0x7F,
+  0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFF, 0x07, 0xEF, 0xC7,
+  0xF7, 0xFF, 0xF9, 0xFF, 0x7C, 0x7F, 0xBE, 0x1F, 0x1F, 0x07, 0xF0, 0x0F,
+  0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0xE7, 0xE3, 0xF3, 0xE0, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x0F, 0xC0,
+  0xFB, 0xF0, 0xF9, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00,
+  0x03, 0xF0, 0x7F, 0x0F, 0xE1, 0xFE, 0x1F, 0x01, 0xF0, 0x1F, 0x0F, 0xFE,
+  0xFF, 0xEF, 0xFE, 0xFF, 0xE1, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0,
+  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0,
+  0x1F, 0x00, 0x07, 0x8F, 0x8F, 0xF7, 0xCF, 0xFF, 0xEF, 0xFF, 0xF7, 0xE3,
+  0xFF, 0xE0, 0xFF, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE,
+  0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFB, 0xF1, 0xFD, 0xFF, 0xFE, 0x7F, 0xFF,
+  0x1F, 0xEF, 0x87, 0xC7, 0xC0, 0x03, 0xE3, 0x01, 0xF7, 0xC1, 0xFB, 0xFF,
+  0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF8, 0xFB, 0xFC,
+  0xFB, 0xFE, 0xFF, 0xFE, 0xFC, 0x3F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x77, 0xFF, 0xF7, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x0E, 0x1F, 0x1F, 0x1F, 0x0E, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0x00, 0x7C, 0x00,
+  0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0xFD, 0xF0,
+  0x7C, 0xF8, 0x7C, 0x7C, 0x7C, 0x3E, 0x7E, 0x1F, 0x7E, 0x0F, 0xBE, 0x07,
+  0xFE, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x7E, 0xF8, 0x3E, 0x7E,
+  0x1F, 0x1F, 0x8F, 0x87, 0xC7, 0xC3, 0xF3, 0xE0, 0xFD, 0xF0, 0x3E, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF9, 0xF0, 0x7C, 0x7D, 0xFC, 0x7F, 0x3F, 0xFF, 0x7F, 0xDF,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xF1, 0xFF, 0xC1, 0xF0, 0x7F, 0xE0, 0xF8, 0x3F,
+  0xF0, 0x7C, 0x1F, 0xF8, 0x3E, 0x0F, 0xFC, 0x1F, 0x07, 0xFE, 0x0F, 0x83,
+  0xFF, 0x07, 0xC1, 0xFF, 0x83, 0xE0, 0xFF, 0xC1, 0xF0, 0x7F, 0xE0, 0xF8,
+  0x3F, 0xF0, 0x7C, 0x1F, 0xF8, 0x3E, 0x0F, 0xFC, 0x1F, 0x07, 0xC0, 0xF8,
+  0xF8, 0xFB, 0xFC, 0xFB, 0xFE, 0xFF, 0xFE, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x07,
+  0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0xE7, 0xE3, 0xF3, 0xE0, 0xFB,
+  0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01,
+  0xFF, 0xC1, 0xFB, 0xF1, 0xF9, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03,
+  0xF8, 0x00, 0xF8, 0xF8, 0x7D, 0xFE, 0x3E, 0xFF, 0x9F, 0xFF, 0xEF, 0xE3,
+  0xF7, 0xE0, 0xFF, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE,
+  0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFF, 0xF1, 0xFB, 0xFF, 0xFD, 0xFF, 0xFC,
+  0xFB, 0xFC, 0x7C, 0x78, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0,
+  0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x8F, 0x8F, 0xF7,
+  0xCF, 0xFB, 0xEF, 0xFF, 0xF7, 0xE3, 0xFF, 0xE0, 0xFF, 0xE0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFB,
+  0xF1, 0xFD, 0xFF, 0xFE, 0x7F, 0xFF, 0x1F, 0xEF, 0x87, 0xC7, 0xC0, 0x03,
+  0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x0F, 0x80, 0xF9, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xF8, 0x3E, 0x07,
+  0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
+  0xF8, 0x1F, 0x00, 0x0F, 0xE0, 0x7F, 0xE1, 0xFF, 0xE7, 0xFF, 0xEF, 0xC7,
+  0xDF, 0x07, 0xFE, 0x00, 0x3F, 0x80, 0x7F, 0xF0, 0x3F, 0xF8, 0x07, 0xF8,
+  0x01, 0xFF, 0x83, 0xFF, 0x0F, 0xFF, 0xFF, 0xBF, 0xFE, 0x3F, 0xF8, 0x1F,
+  0xC0, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F,
+  0x03, 0xE0, 0x7C, 0x0F, 0xF0, 0xFE, 0x1F, 0xC0, 0xF8, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC,
+  0x3F, 0x7F, 0xFF, 0x7F, 0xDF, 0x3F, 0xDF, 0x1F, 0x1F, 0xF8, 0x0F, 0xBE,
+  0x07, 0xDF, 0x03, 0xEF, 0x83, 0xE3, 0xC1, 0xF1, 0xF0, 0xF8, 0xF8, 0x78,
+  0x3C, 0x7C, 0x1E, 0x3E, 0x0F, 0x9E, 0x03, 0xCF, 0x01, 0xEF, 0x80, 0xFF,
+  0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00,
+  0xF8, 0x3E, 0x07, 0xFE, 0x0F, 0xC1, 0xE7, 0x83, 0xF0, 0xF9, 0xF0, 0xFC,
+  0x3E, 0x7C, 0x7F, 0x0F, 0x8F, 0x1F, 0xE3, 0xC3, 0xC7, 0xF9, 0xF0, 0xF9,
+  0xFE, 0x7C, 0x3E, 0x77, 0x9E, 0x07, 0xBC, 0xF7, 0x81, 0xEF, 0x3D, 0xE0,
+  0x7B, 0xCF, 0xF8, 0x1F, 0xE1, 0xFC, 0x03, 0xF8, 0x7F, 0x00, 0xFE, 0x1F,
+  0xC0, 0x3F, 0x07, 0xF0, 0x0F, 0xC0, 0xF8, 0x01, 0xF0, 0x3E, 0x00, 0x7C,
+  0x0F, 0x3E, 0x0F, 0x8F, 0x8F, 0x87, 0xC7, 0xC1, 0xF7, 0xC0, 0xFB, 0xE0,
+  0x3F, 0xE0, 0x0F, 0xF0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFE, 0x01, 0xFF,
+  0x01, 0xF7, 0xC0, 0xFB, 0xE0, 0xF8, 0xF8, 0x7C, 0x3C, 0x7C, 0x1F, 0x3C,
+  0x07, 0xC0, 0xF8, 0x0F, 0xBC, 0x07, 0xDF, 0x03, 0xEF, 0x83, 0xE3, 0xC1,
+  0xF1, 0xF0, 0xF8, 0xF8, 0x78, 0x3C, 0x7C, 0x1E, 0x3E, 0x0F, 0x9E, 0x07,
+  0xCF, 0x01, 0xEF, 0x80, 0xF7, 0x80, 0x7F, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0,
+  0x07, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7E, 0x01, 0xFE,
+  0x00, 0xFF, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0x07, 0xC0, 0x3F, 0x00, 0xF8, 0x07, 0xC0,
+  0x3E, 0x01, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xE0, 0xFC, 0x3F, 0x8F, 0xF1, 0xF8, 0x3E,
+  0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x83, 0xF1, 0xFC, 0x3F,
+  0x87, 0xC0, 0xFE, 0x07, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
+  0xF8, 0x1F, 0x03, 0xF0, 0x7F, 0x87, 0xF0, 0x7E, 0x03, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF8,
+  0x0F, 0xE0, 0xFF, 0x0F, 0xF8, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F,
+  0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0xC0, 0x7F, 0x07, 0xF0, 0x1F, 0x07,
+  0xF0, 0xFC, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F,
+  0x81, 0xF8, 0xFF, 0x8F, 0xF0, 0xFE, 0x0F, 0x80, 0x1E, 0x07, 0xBF, 0xC3,
+  0xDF, 0xF3, 0xFF, 0xFF, 0xFF, 0x9F, 0xF7, 0x87, 0xFB, 0xC0, 0xF0, 0x00,
+  0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xE7, 0xC0, 0x07,
+  0xCF, 0x80, 0x0F, 0x9F, 0x00, 0x1E, 0x1F, 0x00, 0x7C, 0x3E, 0x00, 0xF8,
+  0x7C, 0x01, 0xF0, 0x7C, 0x07, 0xC0, 0xF8, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xF0, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC1, 0xF0, 0x0F, 0xC7, 0xC0, 0x0F,
+  0x8F, 0x80, 0x1F, 0x9F, 0x00, 0x3F, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x7C,
+  0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xC0,
+  0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0xE0, 0xFC, 0x1D, 0xC7, 0x3F, 0xE1,
+  0xF0, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00,
+  0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xF8, 0x01,
+  0xFE, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xC0, 0x01, 0xF0, 0x00, 0x7C,
+  0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0xFF,
+  0xC7, 0xFF, 0xF1, 0xFF, 0xFC, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0x8F, 0xE3,
+  0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE3, 0xF0, 0x7E, 0x0E, 0x01, 0xE0, 0xE0,
+  0x07, 0x87, 0x00, 0x1C, 0x70, 0x00, 0x73, 0x80, 0x03, 0x9C, 0x00, 0x1C,
+  0xE0, 0x00, 0xE7, 0x00, 0x07, 0x38, 0x00, 0x38, 0xE0, 0x03, 0x87, 0x00,
+  0x3C, 0x3C, 0x01, 0xC1, 0xF8, 0x3F, 0x1F, 0xFF, 0xFC, 0xEF, 0xFE, 0xE2,
+  0x1F, 0xC2, 0x00, 0x00, 0xF1, 0xF1, 0xE3, 0xE3, 0xC7, 0xC7, 0x0F, 0x8E,
+  0x1F, 0x1C, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+  0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0,
+  0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x0F, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xFF, 0x03,
+  0xFF, 0xF0, 0xFF, 0xFF, 0x1F, 0x07, 0xE7, 0xC0, 0x7E, 0xF8, 0x07, 0xDF,
+  0x00, 0x03, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x80, 0x7F, 0xFC, 0x07,
+  0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xC0, 0x1F, 0x78,
+  0x03, 0xEF, 0x80, 0x7D, 0xF8, 0x3F, 0x9F, 0xFF, 0xE3, 0xFF, 0xF8, 0x1F,
+  0xFE, 0x00, 0xFF, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC,
+  0x7C, 0x7E, 0x78, 0x3E, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x3F, 0xE0,
+  0x3F, 0xF8, 0x7F, 0xFC, 0xF1, 0xFE, 0xF0, 0x7F, 0xF8, 0x1F, 0xFE, 0x1F,
+  0x7F, 0x9F, 0x3F, 0xFE, 0x1F, 0xFC, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x7E,
+  0x00, 0x3E, 0x78, 0x3E, 0x7C, 0x7E, 0x3F, 0xFE, 0x3F, 0xFC, 0x1F, 0xF8,
+  0x07, 0xE0, 0x70, 0xEF, 0x9F, 0xF9, 0xF7, 0x0E, 0x0F, 0x0F, 0x01, 0xF3,
+  0xC0, 0x1E, 0xF0, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xE0, 0x0F, 0xFF, 0x03, 0xFF, 0xF0, 0xFF, 0xFF, 0x1F, 0x07,
+  0xE7, 0xC0, 0x7E, 0xF8, 0x07, 0xDF, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xC0,
+  0x07, 0xFF, 0x80, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x3F,
+  0xC0, 0x01, 0xFF, 0xC0, 0x1F, 0x78, 0x03, 0xEF, 0x80, 0x7D, 0xF8, 0x3F,
+  0x9F, 0xFF, 0xE3, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x01, 0xFF, 0xE0, 0x7F, 0xFE, 0x1F, 0xFF, 0xE3, 0xE0, 0xFC, 0xF8, 0x0F,
+  0xDF, 0x00, 0xFB, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xF0,
+  0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x3F,
+  0xF8, 0x03, 0xEF, 0x00, 0x7D, 0xF0, 0x0F, 0xBF, 0x07, 0xF3, 0xFF, 0xFC,
+  0x7F, 0xFF, 0x03, 0xFF, 0xC0, 0x1F, 0xE0, 0x00, 0xC0, 0x00, 0x1E, 0x00,
+  0x01, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x00, 0x78, 0x00,
+  0x0F, 0x1F, 0x01, 0xE3, 0xC0, 0x1E, 0xF0, 0x01, 0xFC, 0x00, 0x1F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00,
+  0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
+  0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00,
+  0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
+  0x7C, 0x00, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x07, 0xE0,
+  0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07,
+  0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0x80,
+  0x07, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x1E, 0x03, 0xCF, 0x00, 0x7F, 0x80,
+  0x0F, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F,
+  0xC0, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x00,
+  0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x3F,
+  0x00, 0x0F, 0x80, 0x07, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x01, 0xC0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x07,
+  0xE0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0x80,
+  0x07, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F,
+  0x80, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x1F, 0x07, 0xF1, 0xFF, 0x7F, 0xFF, 0x1F, 0xC1, 0xF8, 0x3F, 0x8F,
+  0xFF, 0xEF, 0xF8, 0xFE, 0x0F, 0x80, 0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE,
+  0x7F, 0xFE, 0x7C, 0x3F, 0x78, 0x1F, 0x00, 0x1F, 0x00, 0x7F, 0x1F, 0xFF,
+  0x7F, 0xFF, 0x7C, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF,
+  0x7F, 0xDF, 0x7F, 0xDF, 0x1F, 0x1F, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3C,
+  0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0x30, 0xF9, 0xE7, 0x8F, 0x0F, 0x9F,
+  0x9E, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F,
+  0xCF, 0xFF, 0xEF, 0xE7, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x78, 0xE3, 0xC7, 0x00, 0x03, 0xFE, 0xFF,
+  0xBF, 0xEF, 0xFB, 0xFE, 0xEF, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0,
+  0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E,
+  0x0F, 0x83, 0xE0, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x00, 0x1E,
+  0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xF0, 0xFF, 0xF3,
+  0xFF, 0xF7, 0xE3, 0xEF, 0x83, 0xFF, 0x00, 0x1F, 0xC0, 0x3F, 0xF8, 0x1F,
+  0xFC, 0x03, 0xFC, 0x00, 0xFF, 0xC1, 0xFF, 0x87, 0xFF, 0xFF, 0xDF, 0xFF,
+  0x1F, 0xFC, 0x0F, 0xE0, 0xF0, 0x7B, 0xC7, 0x8F, 0x78, 0x7F, 0x81, 0xF8,
+  0x07, 0xC0, 0x61, 0x87, 0x87, 0x1C, 0xFF, 0xB8, 0x78, 0x7C, 0x78, 0xF0,
+  0x7B, 0xC0, 0x7F, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xE0, 0x7F, 0xE1, 0xFF, 0xE7, 0xFF, 0xEF, 0xC7, 0xDF, 0x07, 0xFE, 0x00,
+  0x3F, 0x80, 0x7F, 0xF0, 0x3F, 0xF8, 0x07, 0xF8, 0x01, 0xFF, 0x83, 0xFF,
+  0x0F, 0xFF, 0xFF, 0xBF, 0xFE, 0x3F, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F,
+  0xE1, 0xFF, 0xE7, 0xFF, 0xEF, 0xC7, 0xDF, 0x07, 0xFE, 0x00, 0x3F, 0x80,
+  0x7F, 0xF0, 0x3F, 0xF8, 0x07, 0xF8, 0x01, 0xFF, 0x83, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xBF, 0xFE, 0x3F, 0xF8, 0x1F, 0xC0, 0x0C, 0x00, 0x1E, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x78, 0x03, 0xE0, 0x07, 0x00, 0x00, 0x78, 0x03, 0xC0,
+  0x1E, 0x00, 0xF1, 0xF7, 0x8F, 0xBC, 0x7C, 0x03, 0xE0, 0xFF, 0xE7, 0xFF,
+  0x3F, 0xF9, 0xFF, 0xC1, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00,
+  0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7F, 0x83, 0xFC, 0x0F,
+  0xE0, 0x1F, 0x00, 0x01, 0xE0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07, 0x80,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3E,
+  0x01, 0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7E, 0x01, 0xF0,
+  0x0F, 0x80, 0x7C, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E,
+  0x78, 0xF1, 0xC3, 0xCF, 0x1E, 0x78, 0x73, 0xC0, 0x78, 0x78, 0xF3, 0xC1,
+  0xFE, 0x03, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF0,
+  0x0F, 0x80, 0x7E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0x80, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x3E, 0x00, 0xF0, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0xC0, 0x3E, 0x01,
+  0xF0, 0x0F, 0xC0, 0x7E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF,
+  0xF3, 0xE0, 0xFC, 0xF8, 0x1F, 0xBE, 0x03, 0xEF, 0x80, 0xFB, 0xE0, 0x3E,
+  0xF8, 0x0F, 0xBE, 0x07, 0xEF, 0x83, 0xF3, 0xFF, 0xFC, 0xFF, 0xFE, 0x3F,
+  0xFF, 0x0F, 0xFF, 0x83, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x0F, 0x8F, 0x83,
+  0xE3, 0xE0, 0x7C, 0xF8, 0x1F, 0x3E, 0x03, 0xEF, 0x80, 0xFC, 0x00, 0x1E,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x07,
+  0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
+  0x00, 0x3C, 0xF8, 0x01, 0xF3, 0xE0, 0x07, 0xCF, 0x80, 0x1E, 0x1F, 0x00,
+  0xF8, 0x7C, 0x03, 0xE1, 0xF0, 0x0F, 0x83, 0xC0, 0x7C, 0x0F, 0x81, 0xFF,
+  0xFE, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xE0, 0x1F,
+  0x1F, 0x00, 0x3E, 0x7C, 0x00, 0xF9, 0xF0, 0x03, 0xEF, 0x80, 0x07, 0xC0,
+  0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xF3, 0xC0, 0x07,
+  0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFE,
+  0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
+  0x0F, 0xFC, 0x00, 0x3C, 0xF8, 0x01, 0xF3, 0xE0, 0x07, 0xCF, 0x80, 0x1E,
+  0x1F, 0x00, 0xF8, 0x7C, 0x03, 0xE1, 0xF0, 0x0F, 0x83, 0xC0, 0x7C, 0x0F,
+  0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3,
+  0xE0, 0x1F, 0x1F, 0x00, 0x3E, 0x7C, 0x00, 0xF9, 0xF0, 0x03, 0xEF, 0x80,
+  0x07, 0xC0, 0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0x3C, 0x78, 0x00, 0x7F,
+  0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x03,
+  0xFF, 0x00, 0x0F, 0xBE, 0x00, 0x3E, 0xF8, 0x01, 0xFB, 0xE0, 0x07, 0xC7,
+  0xC0, 0x1F, 0x1F, 0x00, 0xFC, 0x7C, 0x03, 0xE0, 0xF8, 0x0F, 0x83, 0xE0,
+  0x7E, 0x0F, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xC3, 0xE0, 0x0F, 0x9F, 0x80, 0x3E, 0x7C, 0x00, 0xF9, 0xF0, 0x01,
+  0xEF, 0xC0, 0x07, 0xC0, 0x03, 0x87, 0x00, 0x1F, 0x3E, 0x00, 0x7C, 0xF8,
+  0x00, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
+  0xC0, 0x03, 0xFF, 0x00, 0x1F, 0x3E, 0x00, 0x7C, 0xF8, 0x01, 0xF3, 0xE0,
+  0x0F, 0x87, 0xC0, 0x3E, 0x1F, 0x00, 0xF8, 0x7C, 0x07, 0xC0, 0xF8, 0x1F,
+  0x03, 0xE0, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF0, 0xF0, 0x03, 0xC7, 0xC0, 0x0F, 0x9F, 0x00, 0x3E, 0x78, 0x00, 0x7B,
+  0xE0, 0x01, 0xF0, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+  0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0,
+  0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00,
+  0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x70,
+  0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07,
+  0xFF, 0x80, 0x7F, 0xFE, 0x07, 0xFF, 0xF8, 0x7F, 0x0F, 0xC7, 0xE0, 0x1F,
+  0x3E, 0x00, 0xF9, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
+  0xE0, 0x00, 0x0F, 0x80, 0x1F, 0x7C, 0x01, 0xF3, 0xF0, 0x0F, 0x8F, 0xE1,
+  0xF8, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x07, 0xF0, 0x00,
+  0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0xC3, 0xF0,
+  0x7E, 0x3F, 0x01, 0xF9, 0xF0, 0x07, 0xCF, 0x80, 0x3E, 0xF8, 0x00, 0x07,
+  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
+  0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x01, 0xF3, 0xE0, 0x0F, 0x9F,
+  0x80, 0xFC, 0x7E, 0x0F, 0xC1, 0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xFC,
+  0x00, 0x3F, 0x80, 0x00, 0x60, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x38, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x87,
+  0x80, 0x1E, 0x78, 0x00, 0x7F, 0x80, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xFF, 0x80, 0x7F, 0xFE,
+  0x07, 0xFF, 0xF8, 0x7F, 0x0F, 0xE7, 0xE0, 0x1F, 0x3E, 0x00, 0xF9, 0xF0,
+  0x03, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80,
+  0x1F, 0x7C, 0x01, 0xF3, 0xF0, 0x0F, 0x8F, 0xE1, 0xF8, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x07, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xF0,
+  0x01, 0xE0, 0x01, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3E,
+  0x00, 0x38, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1E,
+  0x1C, 0x38, 0x3E, 0x7C, 0x3E, 0x7C, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xFF, 0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x3C, 0x3C, 0x1E, 0x78, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x1E, 0x78, 0xF3, 0xC7, 0x00, 0x00, 0x7C, 0xF9, 0xF3, 0xE7,
+  0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9,
+  0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x00, 0x0F, 0x80, 0xFE, 0x0F, 0x78, 0xF9,
+  0xEF, 0x8F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
+  0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03,
+  0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C,
+  0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x78, 0x07,
+  0x9E, 0x00, 0x7F, 0x80, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC, 0x7C,
+  0x1F, 0xCF, 0x80, 0xFD, 0xF0, 0x0F, 0xBE, 0x01, 0xF7, 0xC0, 0x1F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0,
+  0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x3E, 0xF8, 0x07, 0xDF, 0x01, 0xFB, 0xE0,
+  0xFE, 0x7F, 0xFF, 0x8F, 0xFF, 0xE1, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x1F,
+  0xFE, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x1F, 0x07,
+  0xF0, 0x7C, 0x07, 0xE1, 0xF0, 0x0F, 0x87, 0xC0, 0x3E, 0x1F, 0x00, 0x7C,
+  0x7C, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7C, 0x7C,
+  0x01, 0xF1, 0xF0, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0xF8, 0x7C, 0x03,
+  0xE1, 0xF0, 0x1F, 0x87, 0xC1, 0xFC, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0x01,
+  0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x01, 0xE0,
+  0x00, 0x78, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F,
+  0xF8, 0x03, 0xFF, 0x80, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x3F,
+  0xFE, 0x07, 0xFF, 0xE0, 0xFF, 0xFE, 0x1F, 0xFF, 0xC3, 0xFF, 0x7C, 0x7F,
+  0xE7, 0xCF, 0xFC, 0xF9, 0xFF, 0x8F, 0xBF, 0xF0, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xC1, 0xFF, 0xF8, 0x1F, 0xFF, 0x03, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF,
+  0x80, 0x7F, 0xF0, 0x07, 0xFE, 0x00, 0xF8, 0x0F, 0x1E, 0x00, 0xF7, 0x80,
+  0x0E, 0xF0, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF,
+  0xF0, 0x3F, 0xFE, 0x07, 0xFF, 0xE0, 0xFF, 0xFE, 0x1F, 0xFF, 0xC3, 0xFF,
+  0x7C, 0x7F, 0xE7, 0xCF, 0xFC, 0xF9, 0xFF, 0x8F, 0xBF, 0xF0, 0xFF, 0xFE,
+  0x1F, 0xFF, 0xC1, 0xFF, 0xF8, 0x1F, 0xFF, 0x03, 0xFF, 0xE0, 0x3F, 0xFC,
+  0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x07, 0xFE, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xFF, 0x80, 0x3F, 0xFF,
+  0x01, 0xFF, 0xFE, 0x0F, 0xE1, 0xFC, 0x7E, 0x01, 0xF9, 0xF0, 0x03, 0xE7,
+  0xC0, 0x0F, 0xBE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80,
+  0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07,
+  0xDF, 0x00, 0x3E, 0x7C, 0x00, 0xF9, 0xF8, 0x07, 0xE3, 0xF8, 0x7F, 0x07,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xCF,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+  0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x3F, 0x87, 0xF1, 0xF8,
+  0x07, 0xE7, 0xC0, 0x0F, 0x9F, 0x00, 0x3E, 0xF8, 0x00, 0x7F, 0xE0, 0x01,
+  0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF,
+  0x80, 0x07, 0xFE, 0x00, 0x1F, 0x7C, 0x00, 0xF9, 0xF0, 0x03, 0xE7, 0xE0,
+  0x1F, 0x8F, 0xE1, 0xFC, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x7F, 0xF8,
+  0x00, 0x7F, 0x00, 0x00, 0x79, 0xE0, 0x03, 0xCF, 0x00, 0x1E, 0x3C, 0x00,
+  0x79, 0xE0, 0x03, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x80, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xE1, 0xFC,
+  0x7E, 0x01, 0xF9, 0xF0, 0x03, 0xE7, 0xC0, 0x0F, 0xBE, 0x00, 0x1F, 0xF8,
+  0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xDF, 0x00, 0x3E, 0x7C, 0x00, 0xF9,
+  0xF8, 0x07, 0xE3, 0xF8, 0x7F, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x1F,
+  0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0x87, 0x00, 0x1F, 0x3E, 0x00, 0x7C,
+  0xF8, 0x00, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x80, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F,
+  0xE1, 0xFC, 0x7E, 0x01, 0xF9, 0xF0, 0x03, 0xE7, 0xC0, 0x0F, 0xBE, 0x00,
+  0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F,
+  0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xDF, 0x00, 0x3E, 0x7C,
+  0x00, 0xF9, 0xF8, 0x07, 0xE3, 0xF8, 0x7F, 0x07, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xC0, 0x1F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x04, 0x30, 0x0E, 0x78,
+  0x1F, 0xFC, 0x3F, 0x7E, 0x7E, 0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xF0, 0x07,
+  0xE0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7E, 0x7E, 0xFC, 0x3F, 0x78,
+  0x1F, 0x30, 0x0E, 0x00, 0x04, 0x3C, 0x3C, 0x07, 0x9E, 0x00, 0xFF, 0x00,
+  0x1F, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF,
+  0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0xE0, 0xFC, 0xF8, 0x1F, 0xBE, 0x03,
+  0xEF, 0x80, 0xFB, 0xE0, 0x3E, 0xF8, 0x0F, 0xBE, 0x07, 0xEF, 0x83, 0xF3,
+  0xFF, 0xFC, 0xFF, 0xFE, 0x3F, 0xFF, 0x0F, 0xFF, 0x83, 0xE1, 0xF0, 0xF8,
+  0x7C, 0x3E, 0x0F, 0x8F, 0x83, 0xE3, 0xE0, 0x7C, 0xF8, 0x1F, 0x3E, 0x03,
+  0xEF, 0x80, 0xFC, 0x00, 0xE0, 0x00, 0x3E, 0x00, 0x0C, 0x60, 0x01, 0x8C,
+  0x00, 0x31, 0x80, 0x03, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07,
+  0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F,
+  0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F,
+  0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0x3F, 0x07, 0xE3, 0xFF, 0xF8,
+  0x7F, 0xFE, 0x03, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x01, 0xE0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF,
+  0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF,
+  0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE,
+  0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0xF9, 0xF8, 0x3F, 0x1F,
+  0xFF, 0xC3, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0xFE, 0x00, 0x01, 0xE7, 0x80,
+  0x38, 0xF0, 0x0F, 0x3C, 0x01, 0xCF, 0x00, 0x71, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC,
+  0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0,
+  0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0xF9, 0xF8,
+  0x3F, 0x1F, 0xFF, 0xC3, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0xFE, 0x00, 0x07,
+  0x1C, 0x01, 0xF7, 0xC0, 0x3E, 0xF8, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0,
+  0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0,
+  0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80,
+  0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80,
+  0xF9, 0xF8, 0x3F, 0x1F, 0xFF, 0xC3, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0xFE,
+  0x00, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0xFC, 0x01,
+  0xFB, 0xE0, 0x0F, 0x8F, 0x80, 0xFC, 0x7C, 0x07, 0xC1, 0xF0, 0x7C, 0x0F,
+  0x83, 0xE0, 0x3E, 0x3E, 0x01, 0xF1, 0xF0, 0x07, 0xDF, 0x00, 0x3F, 0xF8,
+  0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x03,
+  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00,
+  0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x03,
+  0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07,
+  0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F,
+  0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F,
+  0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xC0, 0x00, 0x1E,
+  0x00, 0x01, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x00, 0x70,
+  0x00, 0x0F, 0xE0, 0x0F, 0xFE, 0x07, 0xFF, 0xE1, 0xFF, 0xF8, 0xFC, 0x3F,
+  0x3E, 0x07, 0xCF, 0x81, 0xF3, 0xE0, 0x7C, 0xF8, 0x1F, 0x3E, 0x0F, 0x8F,
+  0x9F, 0xC3, 0xE7, 0xE0, 0xF9, 0xFF, 0x3E, 0x7F, 0xEF, 0x81, 0xFB, 0xE0,
+  0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x3F, 0xF9, 0xFF,
+  0xBE, 0x7F, 0xEF, 0x9F, 0xF3, 0xE7, 0xF0, 0x03, 0xC0, 0xF0, 0x1C, 0x07,
+  0x80, 0xE0, 0x00, 0x00, 0x07, 0xCF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+  0xC1, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81,
+  0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0,
+  0x00, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFC,
+  0x3F, 0xFE, 0x7F, 0xFE, 0x7C, 0x3F, 0x78, 0x1F, 0x00, 0x1F, 0x00, 0x7F,
+  0x1F, 0xFF, 0x7F, 0xFF, 0x7C, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F,
+  0xFF, 0xFF, 0x7F, 0xDF, 0x7F, 0xDF, 0x1F, 0x1F, 0x01, 0xC0, 0x03, 0xE0,
+  0x07, 0xF0, 0x0F, 0x78, 0x1F, 0x3C, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFE, 0x7C, 0x3F, 0x78, 0x1F,
+  0x00, 0x1F, 0x00, 0x7F, 0x1F, 0xFF, 0x7F, 0xFF, 0x7C, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0x7F, 0xDF, 0x7F, 0xDF, 0x1F, 0x1F,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x0E, 0x38, 0x0F, 0xF8, 0x03, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFE, 0x7C, 0x3F,
+  0x78, 0x1F, 0x00, 0x1F, 0x00, 0x7F, 0x1F, 0xFF, 0x7F, 0xFF, 0x7C, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0x7F, 0xDF, 0x7F, 0xDF,
+  0x1F, 0x1F, 0x1C, 0x38, 0x3E, 0x7C, 0x3E, 0x7C, 0x1C, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFE,
+  0x7C, 0x3F, 0xF8, 0x1F, 0x00, 0x1F, 0x00, 0x7F, 0x1F, 0xFF, 0x7F, 0xFF,
+  0x7C, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0x7F, 0xDF,
+  0x7F, 0xDF, 0x1F, 0x1F, 0x1E, 0x78, 0xF3, 0xC7, 0x00, 0x00, 0x7C, 0xF9,
+  0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E,
+  0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x00, 0x00, 0x78, 0x00, 0xF0,
+  0x00, 0xF0, 0x01, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7E, 0x3F, 0x7C, 0x1F, 0xF8, 0x0F,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x0F, 0xFC, 0x1F,
+  0x7E, 0x3F, 0x7F, 0xFE, 0x3F, 0xFC, 0x1F, 0xFC, 0x07, 0xF0, 0x07, 0xF0,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7E, 0x3F, 0x7C, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1F, 0xFC, 0x1F,
+  0x7E, 0x3F, 0x7F, 0xFE, 0x3F, 0xFC, 0x1F, 0xFC, 0x07, 0xF0, 0x01, 0x80,
+  0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x03, 0xE0, 0x03, 0x80,
+  0x1E, 0x3C, 0x0F, 0x3C, 0x0F, 0x78, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xF0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7E, 0x3F,
+  0x7C, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x0F, 0xFC, 0x1F, 0x7E, 0x3F, 0x7F, 0xFE, 0x3F, 0xFE, 0x1F, 0xF8,
+  0x07, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xFF, 0x0F,
+  0xFF, 0xCF, 0xC7, 0xE7, 0xC1, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x81, 0xF7, 0xE1, 0xF3, 0xFF,
+  0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xFE,
+  0x0F, 0xFF, 0x87, 0xFF, 0xE7, 0xE3, 0xF3, 0xE0, 0xFF, 0xE0, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0xFB,
+  0xF0, 0xF9, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x78,
+  0x00, 0x38, 0x00, 0x1C, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xE0, 0x1C,
+  0x38, 0x1F, 0x3E, 0x0F, 0x9F, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xFF, 0x0F, 0xFF, 0xCF, 0xC7,
+  0xE7, 0xC1, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x3E, 0x00, 0x1F, 0x81, 0xF7, 0xE1, 0xF3, 0xFF, 0xF8, 0xFF, 0xF8,
+  0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x3C, 0x1E, 0x0F, 0x1E, 0x03, 0xDE, 0x00,
+  0xFE, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
+  0x0F, 0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0xE7, 0xE3, 0xF3, 0xE0, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x0F,
+  0xC0, 0xFB, 0xF0, 0xF9, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8,
+  0x00, 0x1E, 0x78, 0xF3, 0xC7, 0x00, 0x00, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF,
+  0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF8, 0x0F,
+  0x80, 0xFE, 0x0F, 0x78, 0xF1, 0xEF, 0x8F, 0x00, 0x00, 0x00, 0x01, 0xF0,
+  0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01,
+  0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E,
+  0x01, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x1F, 0x38, 0x00, 0x3E,
+  0x70, 0x00, 0x7C, 0xE0, 0x00, 0xF9, 0xC0, 0x01, 0xF3, 0x80, 0x03, 0xE0,
+  0x07, 0xC7, 0xC0, 0x1F, 0xEF, 0x80, 0x7F, 0xFF, 0x01, 0xFF, 0xFE, 0x03,
+  0xF1, 0xFC, 0x0F, 0xC1, 0xF8, 0x1F, 0x01, 0xF0, 0x3E, 0x03, 0xE0, 0x7C,
+  0x07, 0xC0, 0xF8, 0x0F, 0x81, 0xF0, 0x1F, 0x03, 0xE0, 0x3E, 0x07, 0xE0,
+  0xFC, 0x07, 0xE3, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFB, 0xE0, 0x0F, 0xF7,
+  0xC0, 0x0F, 0x8F, 0x80, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x03, 0xFF, 0x80,
+  0x7F, 0xF0, 0x0F, 0xFE, 0x00, 0x1F, 0x03, 0xE3, 0xE0, 0xFF, 0x7C, 0x3F,
+  0xFF, 0x8F, 0xFF, 0xF1, 0xF8, 0xFE, 0x7E, 0x0F, 0xCF, 0x80, 0xF9, 0xF0,
+  0x1F, 0x3E, 0x03, 0xE7, 0xC0, 0x7C, 0xF8, 0x0F, 0x9F, 0x01, 0xF3, 0xF0,
+  0x7E, 0x3F, 0x1F, 0xC7, 0xFF, 0xF8, 0x7F, 0xDF, 0x07, 0xFB, 0xE0, 0x7C,
+  0x7C, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFB, 0xFC, 0xFB, 0xFE, 0xFF, 0xFE, 0xFC,
+  0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0x3C, 0x3C, 0x1E, 0x78, 0x0F, 0xF0, 0x07, 0xE0, 0x03,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFB, 0xFC, 0xFB, 0xFE, 0xFF,
+  0xFE, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x3C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xFC,
+  0x1F, 0xFF, 0x1F, 0xFF, 0xCF, 0xC7, 0xE7, 0xC1, 0xF7, 0xC0, 0x7F, 0xE0,
+  0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x83, 0xF7,
+  0xE3, 0xF3, 0xFF, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x01,
+  0xC0, 0x01, 0xF0, 0x01, 0xFC, 0x01, 0xEF, 0x01, 0xE3, 0xC1, 0xF1, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF,
+  0xE7, 0xE3, 0xF3, 0xE0, 0xFB, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC,
+  0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFB, 0xF1, 0xF9, 0xFF, 0xFC,
+  0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x03, 0xCF, 0x81, 0xC7, 0x81,
+  0xE7, 0x80, 0xE7, 0x80, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
+  0x1F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFF, 0xCF, 0xC7, 0xE7, 0xC1, 0xF7, 0xC0,
+  0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF,
+  0x83, 0xF7, 0xE3, 0xF3, 0xFF, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0,
+  0x00, 0x0E, 0x38, 0x0F, 0xBE, 0x07, 0xDF, 0x01, 0xC7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFF,
+  0xCF, 0xC7, 0xE7, 0xC1, 0xF7, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8,
+  0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x83, 0xF7, 0xE3, 0xF3, 0xFF, 0xF8,
+  0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x07,
+  0xC0, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07,
+  0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0xF8, 0xF3, 0xCF, 0x0F, 0x70,
+  0x3F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x9E, 0x7D, 0xF3, 0xFF, 0x9F,
+  0xFC, 0xFE, 0x07, 0xE0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
+  0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x00,
+  0x03, 0xC0, 0x07, 0xE0, 0x0E, 0x70, 0x0C, 0x30, 0x0E, 0x70, 0x07, 0xE0,
+  0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x3F, 0x7F, 0xFF,
+  0x7F, 0xDF, 0x3F, 0xDF, 0x1F, 0x1F, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0,
+  0x01, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x3F,
+  0x7F, 0xFF, 0x7F, 0xDF, 0x3F, 0xDF, 0x1F, 0x1F, 0x03, 0xCF, 0x03, 0xCF,
+  0x01, 0xC7, 0x01, 0xE7, 0x01, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF0,
+  0x3E, 0xF8, 0x1F, 0x7C, 0x0F, 0xBE, 0x07, 0xDF, 0x03, 0xEF, 0x81, 0xF7,
+  0xC0, 0xFB, 0xE0, 0x7D, 0xF0, 0x3E, 0xF8, 0x1F, 0x7C, 0x0F, 0xBE, 0x07,
+  0xDF, 0x07, 0xEF, 0xC3, 0xF3, 0xFF, 0xF9, 0xFF, 0x7C, 0x7F, 0xBE, 0x1F,
+  0x1F, 0x00, 0x1C, 0x38, 0x3E, 0x7C, 0x3E, 0x7C, 0x1C, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x3F, 0x7F, 0xFF, 0x7F, 0xDF,
+  0x3F, 0xDF, 0x1F, 0x1F, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x1C,
+  0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0x78, 0x0F, 0xBE,
+  0x07, 0xDF, 0x07, 0xC7, 0x83, 0xE3, 0xE1, 0xF1, 0xF0, 0xF0, 0x78, 0xF8,
+  0x3C, 0x7C, 0x1F, 0x3C, 0x0F, 0x9E, 0x03, 0xDF, 0x01, 0xEF, 0x00, 0xFF,
+  0x80, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x00,
+  0xF8, 0x00, 0xFC, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE,
+  0xFF, 0xE1, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0,
+  0x1F, 0x01, 0xF0, 0x1F, 0xA1, 0xFE, 0x0F, 0xE0, 0xFE, 0x03, 0xC0, 0x18,
+  0x01, 0xE0, 0x0F, 0x00, 0x70, 0x0F, 0x03, 0xE0, 0x38, 0x77, 0xFF, 0xF7,
+  0x00 };
+
+const GFXglyph InterTight_Bold16pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   5,  24,   9,    2,  -23 },   // 0x21 '!' U+0021
+  {    16,  11,  10,  17,    3,  -23 },   // 0x22 '"' U+0022
+  {    30,  20,  24,  19,    0,  -23 },   // 0x23 '#' U+0023
+  {    90,  19,  30,  20,    0,  -26 },   // 0x24 '$' U+0024
+  {   162,  22,  25,  26,    2,  -24 },   // 0x25 '%' U+0025
+  {   231,  20,  24,  21,    1,  -23 },   // 0x26 '&' U+0026
+  {   291,   4,  10,  10,    3,  -23 },   // 0x27 ''' U+0027
+  {   296,   9,  29,  11,    2,  -24 },   // 0x28 '(' U+0028
+  {   329,   9,  29,  11,    0,  -24 },   // 0x29 ')' U+0029
+  {   362,  13,  13,  17,    2,  -23 },   // 0x2a '*' U+002A
+  {   384,  16,  17,  20,    2,  -17 },   // 0x2b '+' U+002B
+  {   418,   6,  10,  10,    1,   -2 },   // 0x2c ',' U+002C
+  {   426,  10,   4,  14,    2,  -11 },   // 0x2d '-' U+002D
+  {   431,   5,   5,   9,    2,   -4 },   // 0x2e '.' U+002E
+  {   435,  11,  29,  11,    0,  -24 },   // 0x2f '/' U+002F
+  {   475,  19,  24,  21,    1,  -23 },   // 0x30 '0' U+0030
+  {   532,  11,  24,  12,    0,  -23 },   // 0x31 '1' U+0031
+  {   565,  16,  24,  18,    1,  -23 },   // 0x32 '2' U+0032
+  {   613,  17,  24,  19,    1,  -23 },   // 0x33 '3' U+0033
+  {   664,  19,  24,  20,    1,  -23 },   // 0x34 '4' U+0034
+  {   721,  17,  24,  19,    1,  -23 },   // 0x35 '5' U+0035
+  {   772,  18,  24,  20,    1,  -23 },   // 0x36 '6' U+0036
+  {   826,  16,  24,  18,    1,  -23 },   // 0x37 '7' U+0037
+  {   874,  18,  24,  20,    1,  -23 },   // 0x38 '8' U+0038
+  {   928,  18,  24,  20,    1,  -23 },   // 0x39 '9' U+0039
+  {   982,   5,  17,   9,    2,  -16 },   // 0x3a ':' U+003A
+  {   993,   6,  23,   9,    1,  -15 },   // 0x3b ';' U+003B
+  {  1011,  16,  19,  20,    2,  -18 },   // 0x3c '<' U+003C
+  {  1049,  15,  12,  19,    2,  -15 },   // 0x3d '=' U+003D
+  {  1072,  16,  19,  20,    2,  -18 },   // 0x3e '>' U+003E
+  {  1110,  15,  24,  17,    1,  -23 },   // 0x3f '?' U+003F
+  {  1155,  29,  31,  31,    1,  -23 },   // 0x40 '@' U+0040
+  {  1268,  22,  24,  22,    0,  -23 },   // 0x41 'A' U+0041
+  {  1334,  18,  24,  20,    1,  -23 },   // 0x42 'B' U+0042
+  {  1388,  21,  24,  23,    1,  -23 },   // 0x43 'C' U+0043
+  {  1451,  19,  24,  21,    1,  -23 },   // 0x44 'D' U+0044
+  {  1508,  16,  24,  18,    1,  -23 },   // 0x45 'E' U+0045
+  {  1556,  15,  24,  17,    1,  -23 },   // 0x46 'F' U+0046
+  {  1601,  21,  24,  23,    1,  -23 },   // 0x47 'G' U+0047
+  {  1664,  20,  24,  22,    1,  -23 },   // 0x48 'H' U+0048
+  {  1724,   5,  24,   7,    1,  -23 },   // 0x49 'I' U+0049
+  {  1739,  15,  24,  17,    1,  -23 },   // 0x4a 'J' U+004A
+  {  1784,  20,  24,  20,    1,  -23 },   // 0x4b 'K' U+004B
+  {  1844,  15,  24,  16,    1,  -23 },   // 0x4c 'L' U+004C
+  {  1889,  25,  24,  27,    1,  -23 },   // 0x4d 'M' U+004D
+  {  1964,  19,  24,  21,    1,  -23 },   // 0x4e 'N' U+004E
+  {  2021,  22,  24,  24,    1,  -23 },   // 0x4f 'O' U+004F
+  {  2087,  17,  24,  19,    1,  -23 },   // 0x50 'P' U+0050
+  {  2138,  22,  26,  24,    1,  -23 },   // 0x51 'Q' U+0051
+  {  2210,  18,  24,  19,    1,  -23 },   // 0x52 'R' U+0052
+  {  2264,  19,  24,  20,    0,  -23 },   // 0x53 'S' U+0053
+  {  2321,  19,  24,  21,    1,  -23 },   // 0x54 'T' U+0054
+  {  2378,  19,  24,  21,    1,  -23 },   // 0x55 'U' U+0055
+  {  2435,  22,  24,  23,    0,  -23 },   // 0x56 'V' U+0056
+  {  2501,  32,  24,  32,    0,  -23 },   // 0x57 'W' U+0057
+  {  2597,  21,  24,  22,    0,  -23 },   // 0x58 'X' U+0058
+  {  2660,  21,  24,  22,    0,  -23 },   // 0x59 'Y' U+0059
+  {  2723,  18,  24,  20,    1,  -23 },   // 0x5a 'Z' U+005A
+  {  2777,   8,  30,  11,    2,  -25 },   // 0x5b '[' U+005B
+  {  2807,  11,  29,  11,    0,  -24 },   // 0x5c '\' U+005C
+  {  2847,   8,  30,  11,    1,  -25 },   // 0x5d ']' U+005D
+  {  2877,  13,  11,  15,    1,  -23 },   // 0x5e '^' U+005E
+  {  2895,  15,   4,  15,    0,    1 },   // 0x5f '_' U+005F
+  {  2903,   6,   5,  14,    4,  -24 },   // 0x60 '`' U+0060
+  {  2907,  16,  18,  18,    1,  -17 },   // 0x61 'a' U+0061
+  {  2943,  17,  24,  19,    1,  -23 },   // 0x62 'b' U+0062
+  {  2994,  16,  18,  18,    1,  -17 },   // 0x63 'c' U+0063
+  {  3030,  17,  24,  19,    1,  -23 },   // 0x64 'd' U+0064
+  {  3081,  17,  18,  19,    1,  -17 },   // 0x65 'e' U+0065
+  {  3120,  12,  25,  12,    0,  -24 },   // 0x66 'f' U+0066
+  {  3158,  17,  25,  19,    1,  -17 },   // 0x67 'g' U+0067
+  {  3212,  16,  24,  18,    1,  -23 },   // 0x68 'h' U+0068
+  {  3260,   5,  25,   7,    1,  -24 },   // 0x69 'i' U+0069
+  {  3276,   8,  32,   7,   -2,  -24 },   // 0x6a 'j' U+006A
+  {  3308,  17,  24,  17,    1,  -23 },   // 0x6b 'k' U+006B
+  {  3359,   5,  24,   7,    1,  -23 },   // 0x6c 'l' U+006C
+  {  3374,  25,  18,  27,    1,  -17 },   // 0x6d 'm' U+006D
+  {  3431,  16,  18,  18,    1,  -17 },   // 0x6e 'n' U+006E
+  {  3467,  17,  18,  19,    1,  -17 },   // 0x6f 'o' U+006F
+  {  3506,  17,  25,  19,    1,  -17 },   // 0x70 'p' U+0070
+  {  3560,  17,  25,  19,    1,  -17 },   // 0x71 'q' U+0071
+  {  3614,  11,  18,  12,    1,  -17 },   // 0x72 'r' U+0072
+  {  3639,  15,  18,  17,    1,  -17 },   // 0x73 's' U+0073
+  {  3673,  11,  23,  12,    0,  -22 },   // 0x74 't' U+0074
+  {  3705,  16,  18,  18,    1,  -17 },   // 0x75 'u' U+0075
+  {  3741,  17,  18,  17,    0,  -17 },   // 0x76 'v' U+0076
+  {  3780,  26,  18,  26,    0,  -17 },   // 0x77 'w' U+0077
+  {  3839,  17,  18,  17,    0,  -17 },   // 0x78 'x' U+0078
+  {  3878,  17,  25,  17,    0,  -17 },   // 0x79 'y' U+0079
+  {  3932,  14,  18,  16,    1,  -17 },   // 0x7a 'z' U+007A
+  {  3964,  11,  30,  14,    2,  -25 },   // 0x7b '{' U+007B
+  {  4006,   5,  39,  11,    3,  -30 },   // 0x7c '|' U+007C
+  {  4031,  12,  30,  15,    1,  -25 },   // 0x7d '}' U+007D
+  {  4076,  17,   7,  21,    2,  -12 },   // 0x7e '~' U+007E
+  {     0,   0,   0,  16,    1,  -29 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  4091,   1,   1,   6,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  4092,  23,  31,  23,    0,  -23 },   // 0x81 '0x0104' U+0104
+  {  4182,  11,   5,  14,    1,  -24 },   // 0x82 '0x02D8' U+02D8
+  {  4189,  18,  24,  18,    0,  -23 },   // 0x83 '0x0141' U+0141
+  {  4243,  21,  21,  23,    1,  -20 },   // 0x84 '0x00A4' U+00A4
+  {  4299,  15,  25,  16,    1,  -24 },   // 0x85 '0x013D' U+013D
+  {  4346,  19,  31,  20,    0,  -30 },   // 0x86 '0x015A' U+015A
+  {  4420,  16,  29,  18,    1,  -23 },   // 0x87 '0x00A7' U+00A7
+  {  4478,  12,   4,  16,    2,  -23 },   // 0x88 '0x00A8' U+00A8
+  {  4484,  19,  31,  20,    0,  -30 },   // 0x89 '0x0160' U+0160
+  {  4558,  19,  31,  20,    0,  -23 },   // 0x8a '0x015E' U+015E
+  {  4632,  19,  31,  21,    1,  -30 },   // 0x8b '0x0164' U+0164
+  {  4706,  18,  31,  20,    1,  -30 },   // 0x8c '0x0179' U+0179
+  {  4776,  10,   4,  14,    2,  -11 },   // 0x8d '0x00AD' U+00AD
+  {  4781,  18,  31,  20,    1,  -30 },   // 0x8e '0x017D' U+017D
+  {  4851,  18,  31,  20,    1,  -30 },   // 0x8f '0x017B' U+017B
+  {  4921,  11,  12,  13,    1,  -23 },   // 0x90 '0x00B0' U+00B0
+  {  4938,  16,  24,  18,    1,  -17 },   // 0x91 '0x0105' U+0105
+  {  4986,   7,   8,   8,    1,    0 },   // 0x92 '0x02DB' U+02DB
+  {  4993,   9,  24,   7,   -1,  -23 },   // 0x93 '0x0142' U+0142
+  {  5020,   7,   5,  14,    3,  -24 },   // 0x94 '0x00B4' U+00B4
+  {  5025,  10,  25,  10,    1,  -24 },   // 0x95 '0x013E' U+013E
+  {  5057,  15,  25,  17,    1,  -24 },   // 0x96 '0x015B' U+015B
+  {  5104,  13,   6,  17,    2,  -25 },   // 0x97 '0x02C7' U+02C7
+  {  5114,   6,   8,  11,    3,    0 },   // 0x98 '0x00B8' U+00B8
+  {  5120,  15,  26,  17,    1,  -25 },   // 0x99 '0x0161' U+0161
+  {  5169,  15,  25,  17,    1,  -17 },   // 0x9a '0x015F' U+015F
+  {  5216,  13,  26,  12,    0,  -25 },   // 0x9b '0x0165' U+0165
+  {  5259,  14,  25,  16,    1,  -24 },   // 0x9c '0x017A' U+017A
+  {  5303,  14,   5,  14,    0,  -24 },   // 0x9d '0x02DD' U+02DD
+  {  5312,  14,  25,  16,    1,  -24 },   // 0x9e '0x017E' U+017E
+  {  5356,  14,  25,  16,    1,  -24 },   // 0x9f '0x017C' U+017C
+  {  5400,  18,  31,  19,    1,  -30 },   // 0xa0 '0x0154' U+0154
+  {  5470,  22,  31,  22,    0,  -30 },   // 0xa1 '0x00C1' U+00C1
+  {  5556,  22,  31,  22,    0,  -30 },   // 0xa2 '0x00C2' U+00C2
+  {  5642,  22,  31,  22,    0,  -30 },   // 0xa3 '0x0102' U+0102
+  {  5728,  22,  30,  22,    0,  -29 },   // 0xa4 '0x00C4' U+00C4
+  {  5811,  15,  31,  16,    1,  -30 },   // 0xa5 '0x0139' U+0139
+  {  5870,  21,  31,  23,    1,  -30 },   // 0xa6 '0x0106' U+0106
+  {  5952,  21,  31,  22,    1,  -23 },   // 0xa7 '0x00C7' U+00C7
+  {  6034,  21,  31,  23,    1,  -30 },   // 0xa8 '0x010C' U+010C
+  {  6116,  16,  31,  18,    1,  -30 },   // 0xa9 '0x00C9' U+00C9
+  {  6178,  16,  31,  18,    1,  -23 },   // 0xaa '0x0118' U+0118
+  {  6240,  16,  30,  18,    1,  -29 },   // 0xab '0x00CB' U+00CB
+  {  6300,  16,  31,  18,    1,  -30 },   // 0xac '0x011A' U+011A
+  {  6362,   7,  31,   7,    1,  -30 },   // 0xad '0x00CD' U+00CD
+  {  6390,  13,  31,   7,   -3,  -30 },   // 0xae '0x00CE' U+00CE
+  {  6441,  19,  31,  21,    1,  -30 },   // 0xaf '0x010E' U+010E
+  {  6515,  22,  24,  21,   -2,  -23 },   // 0xb0 '0x0110' U+0110
+  {  6581,  19,  31,  21,    1,  -30 },   // 0xb1 '0x0143' U+0143
+  {  6655,  19,  31,  21,    1,  -30 },   // 0xb2 '0x0147' U+0147
+  {  6729,  22,  31,  24,    1,  -30 },   // 0xb3 '0x00D3' U+00D3
+  {  6815,  22,  32,  24,    1,  -31 },   // 0xb4 '0x00D4' U+00D4
+  {  6903,  22,  31,  24,    1,  -30 },   // 0xb5 '0x0150' U+0150
+  {  6989,  22,  31,  24,    1,  -30 },   // 0xb6 '0x00D6' U+00D6
+  {  7075,  16,  17,  20,    2,  -17 },   // 0xb7 '0x00D7' U+00D7
+  {  7109,  18,  31,  19,    1,  -30 },   // 0xb8 '0x0158' U+0158
+  {  7179,  19,  32,  21,    1,  -31 },   // 0xb9 '0x016E' U+016E
+  {  7255,  19,  31,  21,    1,  -30 },   // 0xba '0x00DA' U+00DA
+  {  7329,  19,  31,  21,    1,  -30 },   // 0xbb '0x0170' U+0170
+  {  7403,  19,  31,  21,    1,  -30 },   // 0xbc '0x00DC' U+00DC
+  {  7477,  21,  31,  22,    0,  -30 },   // 0xbd '0x00DD' U+00DD
+  {  7559,  19,  31,  21,    1,  -23 },   // 0xbe '0x0162' U+0162
+  {  7633,  18,  24,  20,    1,  -23 },   // 0xbf '0x00DF' U+00DF
+  {  7687,  11,  25,  12,    1,  -24 },   // 0xc0 '0x0155' U+0155
+  {  7722,  16,  25,  18,    1,  -24 },   // 0xc1 '0x00E1' U+00E1
+  {  7772,  16,  26,  18,    1,  -25 },   // 0xc2 '0x00E2' U+00E2
+  {  7824,  16,  25,  18,    1,  -24 },   // 0xc3 '0x0103' U+0103
+  {  7874,  16,  25,  18,    1,  -24 },   // 0xc4 '0x00E4' U+00E4
+  {  7924,   7,  31,   7,    1,  -30 },   // 0xc5 '0x013A' U+013A
+  {  7952,  16,  25,  18,    1,  -24 },   // 0xc6 '0x0107' U+0107
+  {  8002,  16,  25,  18,    1,  -17 },   // 0xc7 '0x00E7' U+00E7
+  {  8052,  16,  25,  18,    1,  -24 },   // 0xc8 '0x010D' U+010D
+  {  8102,  17,  25,  19,    1,  -24 },   // 0xc9 '0x00E9' U+00E9
+  {  8156,  17,  24,  19,    1,  -17 },   // 0xca '0x0119' U+0119
+  {  8207,  17,  25,  19,    1,  -24 },   // 0xcb '0x00EB' U+00EB
+  {  8261,  17,  26,  19,    1,  -25 },   // 0xcc '0x011B' U+011B
+  {  8317,   7,  25,   7,    1,  -24 },   // 0xcd '0x00ED' U+00ED
+  {  8339,  13,  25,   7,   -3,  -24 },   // 0xce '0x00EE' U+00EE
+  {  8380,  23,  25,  23,    1,  -24 },   // 0xcf '0x010F' U+010F
+  {  8452,  19,  24,  20,    1,  -23 },   // 0xd0 '0x0111' U+0111
+  {  8509,  16,  25,  18,    1,  -24 },   // 0xd1 '0x0144' U+0144
+  {  8559,  16,  25,  18,    1,  -24 },   // 0xd2 '0x0148' U+0148
+  {  8609,  17,  25,  19,    1,  -24 },   // 0xd3 '0x00F3' U+00F3
+  {  8663,  17,  26,  19,    1,  -25 },   // 0xd4 '0x00F4' U+00F4
+  {  8719,  17,  25,  19,    1,  -24 },   // 0xd5 '0x0151' U+0151
+  {  8773,  17,  25,  19,    1,  -24 },   // 0xd6 '0x00F6' U+00F6
+  {  8827,  16,  18,  20,    2,  -17 },   // 0xd7 '0x00F7' U+00F7
+  {  8863,  13,  25,  12,    0,  -24 },   // 0xd8 '0x0159' U+0159
+  {  8904,  16,  27,  18,    1,  -26 },   // 0xd9 '0x016F' U+016F
+  {  8958,  16,  25,  18,    1,  -24 },   // 0xda '0x00FA' U+00FA
+  {  9008,  17,  25,  18,    1,  -24 },   // 0xdb '0x0171' U+0171
+  {  9062,  16,  25,  18,    1,  -24 },   // 0xdc '0x00FC' U+00FC
+  {  9112,  17,  32,  17,    0,  -24 },   // 0xdd '0x00FD' U+00FD
+  {  9180,  12,  30,  12,    0,  -22 },   // 0xde '0x0163' U+0163
+  {  9225,   5,   5,   8,    1,  -24 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_Bold16pt8b PROGMEM = {
+  (uint8_t  *)InterTight_Bold16pt8bBitmaps,
+  (GFXglyph *)InterTight_Bold16pt8bGlyphs,
+  0x20, 0xDF, 38 };
+
+// Approx. 10580 bytes
@@ -0,0 +1,1146 @@
+// Subset of ../InterTightBold18pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_Bold18pt8bBitmaps[] PROGMEM = {
+  0x00, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7,
+  0xDF, 0x7D, 0xF0, 0x00, 0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0xF8, 0xFF, 0xC7,
+  0xFE, 0x3F, 0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 0xE3, 0xFF, 0x1F, 0xF8, 0xFF,
+  0xC7, 0xFE, 0x3E, 0x03, 0xC1, 0xF0, 0x0F, 0x07, 0x80, 0x3C, 0x1E, 0x00,
+  0xF0, 0x78, 0x03, 0xC1, 0xE0, 0x0F, 0x07, 0x83, 0xFF, 0xFF, 0xCF, 0xFF,
+  0xFF, 0x3F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF0, 0x78, 0x3C, 0x01, 0xE0, 0xF0,
+  0x0F, 0x83, 0xC0, 0x3C, 0x1E, 0x00, 0xF0, 0x78, 0x3F, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x07, 0x83, 0xC0, 0x1E, 0x0F,
+  0x00, 0x78, 0x3C, 0x01, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x3E, 0x0F, 0x00,
+  0xF0, 0x78, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03,
+  0x00, 0x01, 0xFC, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0xC3, 0xFF, 0xFE, 0x3F,
+  0x37, 0xE7, 0xC3, 0x3E, 0x7C, 0x31, 0xF7, 0xC3, 0x00, 0x7E, 0x30, 0x07,
+  0xF3, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC,
+  0x03, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x37, 0xF0, 0x03, 0x1F, 0xF8, 0x31,
+  0xF7, 0x83, 0x1F, 0x7C, 0x33, 0xF7, 0xF3, 0x7E, 0x3F, 0xFF, 0xE1, 0xFF,
+  0xFC, 0x0F, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00,
+  0x30, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xF0, 0x07, 0x9F,
+  0xFC, 0x07, 0x8F, 0x1E, 0x03, 0x87, 0x8F, 0x03, 0xC3, 0xC7, 0x83, 0xC1,
+  0xE3, 0xC1, 0xC0, 0xF1, 0xE1, 0xC0, 0x78, 0xF1, 0xE0, 0x3F, 0xF8, 0xE0,
+  0x0F, 0xF8, 0xE0, 0x03, 0xF8, 0xF0, 0x00, 0xF8, 0x70, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x79, 0xF8, 0x00, 0x39, 0xFE, 0x00, 0x39, 0xFF, 0x80, 0x3C,
+  0xFF, 0xC0, 0x1C, 0xF9, 0xF0, 0x1C, 0x78, 0x78, 0x1C, 0x3C, 0x3C, 0x0E,
+  0x1E, 0x1E, 0x0E, 0x0F, 0x0F, 0x0E, 0x07, 0xCF, 0x8F, 0x03, 0xFF, 0x87,
+  0x00, 0xFF, 0xC7, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
+  0x1F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x03, 0xF3, 0xF0, 0x07,
+  0xC3, 0xE0, 0x0F, 0x87, 0xC0, 0x1F, 0x0F, 0x80, 0x3F, 0x3E, 0x00, 0x3F,
+  0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFE,
+  0x1F, 0x0F, 0xFE, 0x3E, 0x3F, 0xFC, 0x7C, 0xFC, 0xFD, 0xF9, 0xF0, 0xFF,
+  0xE3, 0xE0, 0xFF, 0xC7, 0xC0, 0xFF, 0x8F, 0xC0, 0xFE, 0x0F, 0xC3, 0xFC,
+  0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFD, 0xF8, 0x0F, 0xE1, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x8F, 0x87, 0xC3, 0xE3,
+  0xE1, 0xF0, 0xF8, 0xF8, 0x7C, 0x3E, 0x1F, 0x1F, 0x0F, 0x87, 0xC3, 0xE1,
+  0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xF0, 0xF8, 0x7C, 0x3E,
+  0x1F, 0x87, 0xC3, 0xE1, 0xF8, 0x7C, 0x3E, 0x0F, 0x80, 0xF8, 0x3E, 0x1F,
+  0x0F, 0xC3, 0xE1, 0xF0, 0xF8, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xF0, 0xF8,
+  0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x7E, 0x3E,
+  0x1F, 0x0F, 0x8F, 0xC7, 0xC3, 0xE3, 0xF1, 0xF0, 0xF8, 0xF8, 0x00, 0x03,
+  0x80, 0x07, 0x00, 0x8E, 0x03, 0x9C, 0xE7, 0xBB, 0xCF, 0xFF, 0x87, 0xFC,
+  0x03, 0xE0, 0x1F, 0xF0, 0xFF, 0xF9, 0xEE, 0xF3, 0x9C, 0xE0, 0x38, 0x00,
+  0x70, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07,
+  0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
+  0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x7C, 0xFB,
+  0xE7, 0xCF, 0x9E, 0x3C, 0x78, 0xF1, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0x00, 0xF8, 0x07, 0xC0, 0x3C, 0x03,
+  0xE0, 0x1F, 0x00, 0xF8, 0x07, 0x80, 0x7C, 0x03, 0xE0, 0x1E, 0x00, 0xF0,
+  0x0F, 0x80, 0x7C, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x78, 0x07,
+  0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00, 0xF8, 0x07, 0xC0, 0x3C, 0x01, 0xE0,
+  0x1F, 0x00, 0xF8, 0x07, 0x80, 0x3C, 0x03, 0xE0, 0x1F, 0x00, 0x01, 0xFC,
+  0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x83, 0xF0, 0x7E, 0x3F,
+  0x01, 0xF9, 0xF0, 0x07, 0xCF, 0x80, 0x3E, 0xF8, 0x01, 0xFF, 0xC0, 0x07,
+  0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0,
+  0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xE0, 0x0F, 0xDF, 0x00, 0x7C,
+  0xF8, 0x03, 0xE7, 0xE0, 0x3F, 0x1F, 0x83, 0xF0, 0x7F, 0xFF, 0x01, 0xFF,
+  0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xE1, 0xFC, 0xFF, 0xBF,
+  0xFF, 0xFF, 0xF7, 0xFC, 0xFE, 0x1F, 0x83, 0xE0, 0x7C, 0x0F, 0x81, 0xF0,
+  0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E,
+  0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x07, 0xFF, 0x83,
+  0xFF, 0xF1, 0xFF, 0xFE, 0x7E, 0x1F, 0xBF, 0x03, 0xFF, 0x80, 0x7F, 0xE0,
+  0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F,
+  0x80, 0x0F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00,
+  0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFC, 0x01, 0xFF, 0xE0, 0x7F,
+  0xFE, 0x1F, 0xFF, 0xE7, 0xF0, 0xFE, 0xF8, 0x07, 0xDF, 0x00, 0xF8, 0x00,
+  0x1F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x1F,
+  0xF0, 0x03, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00,
+  0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x7E, 0xFC, 0x1F, 0x9F, 0xFF,
+  0xF1, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
+  0x00, 0x1F, 0xFC, 0x00, 0x7D, 0xF0, 0x03, 0xE7, 0xC0, 0x1F, 0x9F, 0x00,
+  0x7C, 0x7C, 0x03, 0xE1, 0xF0, 0x1F, 0x87, 0xC0, 0x7C, 0x1F, 0x03, 0xF0,
+  0x7C, 0x0F, 0x81, 0xF0, 0x7C, 0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00,
+  0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x3F, 0xFF, 0xCF, 0xFF,
+  0xF9, 0xFF, 0xFF, 0x3F, 0xFF, 0xE7, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0xFC, 0x0F, 0x7F, 0xE1, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xC7, 0xE1, 0xFC, 0x30, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x03,
+  0xE0, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7C, 0xFC, 0x3F,
+  0x9F, 0xFF, 0xE1, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0x01, 0xFC,
+  0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x81, 0xFF, 0xFC, 0x3F, 0xFF, 0xE3, 0xF0,
+  0x7E, 0x7E, 0x03, 0xF7, 0xC0, 0x00, 0x78, 0x7E, 0x0F, 0x9F, 0xF8, 0xFB,
+  0xFF, 0xCF, 0xFF, 0xFE, 0xFF, 0x0F, 0xEF, 0xE0, 0x3F, 0xFC, 0x03, 0xFF,
+  0xC0, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0x7C, 0x01, 0xF7, 0xC0, 0x3F,
+  0x7E, 0x03, 0xE3, 0xF0, 0xFE, 0x3F, 0xFF, 0xC1, 0xFF, 0xF8, 0x07, 0xFF,
+  0x00, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x3F, 0x00,
+  0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F,
+  0x80, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+  0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xFF, 0xFC,
+  0x7F, 0x0F, 0xE7, 0xC0, 0x3E, 0x7C, 0x03, 0xE7, 0xC0, 0x3E, 0x7E, 0x03,
+  0xE3, 0xF0, 0xFC, 0x1F, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xFF,
+  0xFC, 0x7F, 0x0F, 0xE7, 0xC0, 0x3E, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8,
+  0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xF7, 0xE0, 0x7E, 0x7F, 0xFF, 0xE3,
+  0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0xE0,
+  0x1F, 0xFF, 0x83, 0xFF, 0xF8, 0x7E, 0x0F, 0xC7, 0xC0, 0x7E, 0xF8, 0x03,
+  0xEF, 0x80, 0x3E, 0xF8, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x03, 0xFF, 0xC0,
+  0x7F, 0x7E, 0x0F, 0xF7, 0xFF, 0xFF, 0x3F, 0xFD, 0xF1, 0xFF, 0x9F, 0x07,
+  0xE1, 0xF0, 0x00, 0x3E, 0xF8, 0x03, 0xEF, 0xC0, 0x7E, 0x7E, 0x0F, 0xC7,
+  0xFF, 0xFC, 0x3F, 0xFF, 0x81, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x3F, 0x80,
+  0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
+  0xFF, 0xF7, 0x80, 0x3C, 0xFD, 0xFB, 0xF7, 0xE7, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3E, 0x7C, 0xF9, 0xF3, 0xC7, 0x9F, 0x3C, 0x78,
+  0xF1, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x7F, 0x00,
+  0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0x3F, 0xC0,
+  0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0xFF, 0xF0,
+  0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x38, 0x00, 0x0F, 0x80,
+  0x03, 0xF8, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xFC,
+  0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0xC1,
+  0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0xC0, 0xFF, 0xC0, 0x3F, 0x80, 0x0F, 0x80,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF,
+  0x8F, 0xFF, 0xEF, 0xE1, 0xFF, 0xC0, 0x7F, 0xE0, 0x3E, 0x00, 0x1F, 0x00,
+  0x1F, 0x80, 0x1F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80,
+  0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3C, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x01,
+  0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x00, 0x0F, 0xE0, 0x7E, 0x00, 0x01, 0xF8, 0x7E, 0x0F, 0xCF, 0x7C, 0x3E,
+  0x1F, 0xFF, 0xBF, 0x3F, 0x1F, 0xFF, 0xCF, 0x9F, 0x1F, 0xFF, 0xE7, 0xCF,
+  0x9F, 0x83, 0xF1, 0xFF, 0x8F, 0x80, 0xF8, 0xFF, 0xCF, 0xC0, 0x3C, 0x7F,
+  0xE7, 0xC0, 0x1E, 0x3F, 0xF3, 0xE0, 0x0F, 0x1F, 0xF9, 0xF0, 0x07, 0x8F,
+  0xFC, 0xF8, 0x03, 0xC7, 0xFE, 0x7C, 0x01, 0xE3, 0xFF, 0x3F, 0x00, 0xF1,
+  0xFF, 0x8F, 0x80, 0xF9, 0xF7, 0xE7, 0xE0, 0xFC, 0xF9, 0xF1, 0xFF, 0xFF,
+  0xF8, 0xFC, 0xFF, 0xF7, 0xFC, 0x7E, 0x1F, 0xF3, 0xFC, 0x1F, 0x87, 0xF0,
+  0xF8, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80,
+  0x38, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
+  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xCF, 0x80, 0x03, 0xE7, 0xE0, 0x03,
+  0xF3, 0xF0, 0x01, 0xF0, 0xF8, 0x01, 0xF8, 0x7E, 0x00, 0xFC, 0x3F, 0x00,
+  0x7C, 0x0F, 0x80, 0x7E, 0x07, 0xE0, 0x3F, 0x03, 0xF0, 0x1F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x87, 0xE0, 0x07,
+  0xE3, 0xF0, 0x03, 0xF1, 0xF8, 0x00, 0xF9, 0xF8, 0x00, 0x7E, 0xFC, 0x00,
+  0x3F, 0x7E, 0x00, 0x0F, 0x80, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFC, 0xF8, 0x0F, 0xEF, 0x80, 0x7E, 0xF8, 0x03, 0xEF, 0x80,
+  0x3E, 0xF8, 0x03, 0xEF, 0x80, 0x7C, 0xF8, 0x0F, 0xCF, 0xFF, 0xF8, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0x80, 0x7E, 0xF8, 0x03, 0xFF,
+  0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x7E,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xE0, 0x00, 0xFE,
+  0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+  0x87, 0xF0, 0x7F, 0x9F, 0x80, 0x3F, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x7F,
+  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0xFD, 0xF0, 0x01, 0xF3, 0xF0, 0x07, 0xE3, 0xF8, 0x3F, 0xC7, 0xFF,
+  0xFF, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFC,
+  0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xF3, 0xE0, 0x1F, 0xCF, 0x80, 0x3F, 0xBE, 0x00, 0x7E, 0xF8,
+  0x00, 0xFB, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
+  0xE0, 0x03, 0xEF, 0x80, 0x1F, 0xBE, 0x00, 0x7E, 0xF8, 0x07, 0xF3, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x03, 0xFF, 0xE0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
+  0x80, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xE0,
+  0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
+  0x3E, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xC0,
+  0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F,
+  0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0xF8, 0x00,
+  0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0,
+  0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x07,
+  0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xF0,
+  0x3F, 0x9F, 0x80, 0x3F, 0x3F, 0x00, 0x3F, 0x7C, 0x00, 0x7F, 0xF8, 0x00,
+  0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0x01, 0xFF,
+  0xFE, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0x3E, 0xF8, 0x00, 0x7D,
+  0xF8, 0x01, 0xFB, 0xF8, 0x07, 0xE3, 0xF8, 0x1F, 0xC7, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0xF8,
+  0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
+  0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01,
+  0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF,
+  0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01,
+  0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80,
+  0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E,
+  0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x81,
+  0xFF, 0xE1, 0xF9, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00,
+  0xF8, 0x03, 0xFF, 0xC0, 0x3F, 0xBE, 0x01, 0xF9, 0xF0, 0x1F, 0x8F, 0x81,
+  0xF8, 0x7C, 0x1F, 0xC3, 0xE1, 0xFC, 0x1F, 0x0F, 0xC0, 0xF8, 0xFC, 0x07,
+  0xCF, 0xC0, 0x3E, 0xFE, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xFC,
+  0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFE, 0xFE, 0x07, 0xE3, 0xF8, 0x3E,
+  0x0F, 0xC1, 0xF0, 0x7F, 0x0F, 0x81, 0xFC, 0x7C, 0x07, 0xE3, 0xE0, 0x3F,
+  0x9F, 0x00, 0xFE, 0xF8, 0x03, 0xF7, 0xC0, 0x1F, 0xC0, 0xF8, 0x00, 0x7C,
+  0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01,
+  0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80,
+  0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E,
+  0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF8,
+  0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x3F,
+  0xFF, 0xFC, 0x07, 0xFF, 0xFB, 0xE0, 0x7D, 0xFF, 0xBE, 0x07, 0xDF, 0xFB,
+  0xF0, 0xF9, 0xFF, 0x9F, 0x0F, 0x9F, 0xF9, 0xF9, 0xF9, 0xFF, 0x8F, 0x9F,
+  0x1F, 0xF8, 0xF9, 0xF1, 0xFF, 0x87, 0xFE, 0x1F, 0xF8, 0x7F, 0xE1, 0xFF,
+  0x87, 0xFC, 0x1F, 0xF8, 0x3F, 0xC1, 0xFF, 0x83, 0xFC, 0x1F, 0xF8, 0x1F,
+  0x81, 0xFF, 0x81, 0xF8, 0x1F, 0xF8, 0x1F, 0x01, 0xFF, 0x80, 0xF0, 0x1F,
+  0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF0,
+  0x0F, 0xFF, 0x80, 0x7F, 0xFE, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0xFF,
+  0xFF, 0x07, 0xFE, 0xFC, 0x3F, 0xF7, 0xF1, 0xFF, 0x9F, 0x8F, 0xFC, 0x7E,
+  0x7F, 0xE3, 0xFB, 0xFF, 0x0F, 0xDF, 0xF8, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F,
+  0xFF, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xC0, 0x00, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
+  0x3F, 0x81, 0xFC, 0x7E, 0x00, 0xFE, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E,
+  0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
+  0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0x7E, 0x3F, 0x81, 0xFC,
+  0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
+  0x00, 0xFF, 0x00, 0xFF, 0xF8, 0x1F, 0xFF, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF,
+  0xEF, 0x80, 0xFD, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x80, 0xFD, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xE7, 0xFF, 0xF0, 0xFF, 0xF8, 0x1F, 0x00, 0x03, 0xE0, 0x00,
+  0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
+  0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0x81, 0xFC, 0x7E,
+  0x00, 0xFE, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7C, 0x3F, 0x3E, 0x7E,
+  0x1F, 0x7E, 0x7F, 0x0F, 0xFE, 0x3F, 0x87, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0x7C, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x1E, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFC, 0xF8, 0x0F, 0xCF, 0x80, 0x7E, 0xF8, 0x03, 0xEF, 0x80,
+  0x3E, 0xF8, 0x03, 0xEF, 0x80, 0x3E, 0xF8, 0x07, 0xEF, 0x80, 0xFC, 0xFF,
+  0xFF, 0xCF, 0xFF, 0xF8, 0xFF, 0xFF, 0x0F, 0xFF, 0xE0, 0xF8, 0x7E, 0x0F,
+  0x83, 0xF0, 0xF8, 0x3F, 0x0F, 0x81, 0xF8, 0xF8, 0x1F, 0x8F, 0x80, 0xFC,
+  0xF8, 0x07, 0xCF, 0x80, 0x7E, 0xF8, 0x03, 0xEF, 0x80, 0x3F, 0x01, 0xFC,
+  0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0xC3, 0xFF, 0xFE, 0x3F, 0x07, 0xE7, 0xC0,
+  0x3E, 0x7C, 0x01, 0xF7, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x7F,
+  0xF0, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x03, 0xFF, 0xE0,
+  0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF8, 0x01, 0xF7, 0x80, 0x1F,
+  0x7C, 0x03, 0xF7, 0xF0, 0x7E, 0x3F, 0xFF, 0xE1, 0xFF, 0xFC, 0x0F, 0xFF,
+  0x80, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00,
+  0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00,
+  0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C,
+  0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00,
+  0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80,
+  0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF,
+  0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
+  0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFF,
+  0x00, 0x7F, 0xF8, 0x03, 0xF7, 0xF0, 0x7F, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF,
+  0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F,
+  0xBF, 0x00, 0x0F, 0xDF, 0x80, 0x0F, 0xCF, 0xC0, 0x07, 0xE3, 0xF0, 0x03,
+  0xF1, 0xF8, 0x03, 0xF0, 0xFC, 0x01, 0xF8, 0x3F, 0x00, 0xFC, 0x1F, 0x80,
+  0xFC, 0x07, 0xC0, 0x7E, 0x03, 0xF0, 0x3F, 0x01, 0xF8, 0x3F, 0x00, 0x7C,
+  0x1F, 0x80, 0x3F, 0x0F, 0x80, 0x1F, 0x8F, 0xC0, 0x07, 0xC7, 0xE0, 0x03,
+  0xF3, 0xE0, 0x01, 0xF9, 0xF0, 0x00, 0x7D, 0xF8, 0x00, 0x3E, 0xF8, 0x00,
+  0x1F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x01, 0xF8, 0x07, 0xE7,
+  0xC0, 0x1F, 0x80, 0x7E, 0x7E, 0x01, 0xF8, 0x07, 0xE7, 0xE0, 0x3F, 0x80,
+  0x7E, 0x7E, 0x03, 0xFC, 0x0F, 0xC3, 0xE0, 0x3F, 0xC0, 0xFC, 0x3F, 0x03,
+  0xFC, 0x0F, 0xC3, 0xF0, 0x7F, 0xC0, 0xF8, 0x1F, 0x07, 0xFE, 0x0F, 0x81,
+  0xF0, 0x7F, 0xE1, 0xF8, 0x1F, 0x87, 0xBE, 0x1F, 0x81, 0xF8, 0xF9, 0xE1,
+  0xF0, 0x0F, 0x8F, 0x9F, 0x1F, 0x00, 0xF8, 0xF1, 0xF3, 0xF0, 0x0F, 0x9F,
+  0x1F, 0x3E, 0x00, 0xFD, 0xF0, 0xF3, 0xE0, 0x07, 0xDF, 0x0F, 0xBE, 0x00,
+  0x7D, 0xE0, 0xFF, 0xE0, 0x07, 0xFE, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x7F,
+  0xC0, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xFC,
+  0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x01, 0xF8, 0x03, 0xF8, 0x00,
+  0x1F, 0x80, 0x1F, 0x00, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0x7E, 0x3F, 0x00,
+  0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0xC3, 0xF0, 0x07, 0xE3,
+  0xF0, 0x07, 0xE7, 0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x07, 0xE7,
+  0xE0, 0x0F, 0xE3, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0x81, 0xF8, 0x1F, 0x81,
+  0xFC, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0x7E, 0x7E, 0x00, 0x7E, 0xFC, 0x00,
+  0x7F, 0xF8, 0x00, 0xFD, 0xF8, 0x03, 0xF1, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F,
+  0x83, 0xE0, 0x7E, 0x07, 0xE0, 0xFC, 0x07, 0xE3, 0xF0, 0x0F, 0xC7, 0xE0,
+  0x0F, 0xDF, 0x80, 0x1F, 0xBF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF0, 0x00,
+  0x3F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
+  0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00,
+  0x07, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80,
+  0x03, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
+  0x03, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87,
+  0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0,
+  0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E,
+  0x1F, 0x0F, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x07, 0xC0, 0x3E,
+  0x00, 0xF0, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x07, 0x80, 0x3E, 0x01, 0xF0,
+  0x0F, 0x80, 0x3C, 0x01, 0xF0, 0x0F, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x80,
+  0x7C, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x0F, 0x00, 0x7C, 0x03,
+  0xE0, 0x1F, 0x00, 0x78, 0x03, 0xE0, 0x1F, 0x00, 0x78, 0x03, 0xC0, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8,
+  0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x07, 0xC0, 0x0F, 0x80, 0x3F, 0x80, 0x7F, 0x01, 0xEF, 0x03,
+  0xDE, 0x0F, 0x1E, 0x1E, 0x3C, 0x78, 0x3C, 0xF0, 0x7B, 0xE0, 0x7F, 0x80,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0xF8,
+  0xF0, 0xF1, 0xE0, 0x03, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xE7,
+  0xE1, 0xFB, 0xE0, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x03, 0xFF, 0x8F, 0xFF,
+  0xDF, 0xFF, 0xEF, 0xC1, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8,
+  0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0xFB, 0xE3, 0xF1, 0xF0, 0xF8, 0x00,
+  0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00,
+  0x3E, 0x3F, 0x07, 0xCF, 0xF8, 0xFB, 0xFF, 0x9F, 0xFF, 0xF3, 0xF8, 0x3F,
+  0x7E, 0x03, 0xEF, 0xC0, 0x7F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F,
+  0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0x7D,
+  0xFC, 0x1F, 0xBF, 0xFF, 0xE7, 0xDF, 0xFC, 0xFB, 0xFE, 0x1F, 0x1F, 0x80,
+  0x03, 0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0xFF, 0xFE, 0x7E, 0x1F, 0x9F,
+  0x03, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
+  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3F, 0x01, 0xF7, 0xC0, 0xFD, 0xF8, 0x7E,
+  0x3F, 0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x00, 0x03, 0xE0,
+  0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC1,
+  0xF8, 0xF8, 0x7F, 0xDF, 0x3F, 0xFF, 0xE7, 0xFF, 0xFD, 0xF8, 0x3F, 0xBE,
+  0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xC0, 0x7E, 0xFC,
+  0x1F, 0xCF, 0xFF, 0xF9, 0xFF, 0xDF, 0x1F, 0xF3, 0xE0, 0xFC, 0x7C, 0x03,
+  0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0xFF, 0xFC, 0x7E, 0x1F, 0x9F, 0x03,
+  0xEF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x7D, 0xF8, 0x7E, 0x3F,
+  0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x03, 0xF8, 0x3F, 0xC3,
+  0xFC, 0x3F, 0xE1, 0xF8, 0x0F, 0x80, 0x7C, 0x1F, 0xFE, 0xFF, 0xF7, 0xFF,
+  0xBF, 0xFC, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00,
+  0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F,
+  0x00, 0xF8, 0x07, 0xC0, 0x07, 0xE3, 0xE1, 0xFF, 0x7C, 0xFF, 0xFF, 0x9F,
+  0xFF, 0xF7, 0xF0, 0xFE, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF8,
+  0x0F, 0xDF, 0x01, 0xFB, 0xF0, 0x7F, 0x7F, 0xFF, 0xE7, 0xFF, 0x7C, 0x7F,
+  0xEF, 0x83, 0xF1, 0xF0, 0x00, 0x3E, 0x38, 0x07, 0xDF, 0x83, 0xF3, 0xFF,
+  0xFE, 0x3F, 0xFF, 0x83, 0xFF, 0xE0, 0x1F, 0xF0, 0x00, 0xF8, 0x00, 0x3E,
+  0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x8F,
+  0xC3, 0xE7, 0xFC, 0xFB, 0xFF, 0xBF, 0xFF, 0xEF, 0xE1, 0xFF, 0xF0, 0x3F,
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80,
+  0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xF0, 0x77, 0xFF, 0xF7, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0E, 0x1F, 0x1F, 0x1F, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFE, 0xFC,
+  0xF0, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
+  0x3E, 0x00, 0x0F, 0x81, 0xFB, 0xE0, 0xFC, 0xF8, 0x3F, 0x3E, 0x1F, 0x8F,
+  0x8F, 0xC3, 0xE7, 0xE0, 0xFB, 0xF0, 0x3E, 0xFC, 0x0F, 0xFE, 0x03, 0xFF,
+  0x80, 0xFF, 0xF0, 0x3F, 0xFC, 0x0F, 0xDF, 0x83, 0xE7, 0xF0, 0xF8, 0xFC,
+  0x3E, 0x1F, 0x8F, 0x87, 0xF3, 0xE0, 0xFC, 0xF8, 0x1F, 0xBE, 0x07, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0xFC, 0x1F, 0x8F, 0xBF, 0xE3, 0xFC,
+  0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFE, 0x1F, 0xC3, 0xFF, 0xC0,
+  0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81,
+  0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8,
+  0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8,
+  0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF,
+  0x80, 0xF8, 0x1F, 0xF8, 0xFC, 0x3E, 0xFF, 0xCF, 0xBF, 0xFB, 0xFF, 0xFE,
+  0xFE, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80,
+  0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
+  0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC7, 0xE0, 0xFC,
+  0xF8, 0x0F, 0xBF, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F,
+  0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xDF, 0x01, 0xF3,
+  0xF0, 0x7E, 0x3F, 0xFF, 0x83, 0xFF, 0xE0, 0x3F, 0xF8, 0x01, 0xFC, 0x00,
+  0xF8, 0xFC, 0x1F, 0x3F, 0xE3, 0xEF, 0xFE, 0x7F, 0xFF, 0xCF, 0xE0, 0xFD,
+  0xF8, 0x0F, 0xBF, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F,
+  0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xFF, 0x01, 0xF7,
+  0xF0, 0x7E, 0xFF, 0xFF, 0x9F, 0xFF, 0xF3, 0xEF, 0xFC, 0x7C, 0x7E, 0x0F,
+  0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE3, 0xE3, 0xFE, 0x7C, 0xFF, 0xEF,
+  0x9F, 0xFF, 0xF7, 0xE0, 0xFE, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xC0, 0x1F,
+  0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F,
+  0xF8, 0x0F, 0xDF, 0x01, 0xFB, 0xF0, 0x7F, 0x3F, 0xFF, 0xE7, 0xFF, 0x7C,
+  0x7F, 0xEF, 0x83, 0xF1, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8,
+  0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0xF8, 0xFF,
+  0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC, 0x0F, 0x80, 0xF8, 0x0F,
+  0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F,
+  0x80, 0xF8, 0x0F, 0x80, 0x03, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0, 0xFF,
+  0xFE, 0x7E, 0x0F, 0x9F, 0x01, 0xF7, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0xF0,
+  0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xF7,
+  0xC0, 0x7D, 0xF8, 0x3F, 0x7F, 0xFF, 0x8F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F,
+  0xE0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
+  0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xFF, 0x0F, 0xF0,
+  0x7F, 0x03, 0xF0, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF8, 0x7F, 0x7F, 0xFF, 0xDF, 0xFD, 0xF3, 0xFE, 0x7C, 0x3F, 0x1F,
+  0xFC, 0x03, 0xE7, 0xC0, 0x3E, 0x7C, 0x07, 0xE7, 0xE0, 0x7C, 0x3E, 0x07,
+  0xC3, 0xE0, 0xFC, 0x3F, 0x0F, 0x81, 0xF0, 0xF8, 0x1F, 0x0F, 0x81, 0xF1,
+  0xF0, 0x0F, 0x9F, 0x00, 0xF9, 0xF0, 0x0F, 0xBE, 0x00, 0x7F, 0xE0, 0x07,
+  0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00,
+  0x1F, 0x80, 0xFC, 0x0F, 0x81, 0xFB, 0xE0, 0xFE, 0x0F, 0xDF, 0x07, 0xF0,
+  0x7C, 0xF8, 0x3F, 0x83, 0xE7, 0xE1, 0xFC, 0x3F, 0x1F, 0x0F, 0xE1, 0xF0,
+  0xF8, 0xFF, 0x8F, 0x87, 0xC7, 0xBC, 0x7C, 0x3E, 0x3D, 0xE3, 0xE0, 0xF9,
+  0xEF, 0x3E, 0x07, 0xDF, 0x7D, 0xF0, 0x3E, 0xF1, 0xEF, 0x81, 0xF7, 0x8F,
+  0x7C, 0x07, 0xFC, 0x7F, 0xC0, 0x3F, 0xE3, 0xFE, 0x01, 0xFE, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x7F, 0x80, 0x3F, 0x83, 0xF8, 0x01, 0xF8, 0x0F, 0xC0, 0x0F,
+  0xC0, 0x7E, 0x00, 0x7C, 0x07, 0xEF, 0xC1, 0xF8, 0xF8, 0x3E, 0x1F, 0x8F,
+  0xC1, 0xF1, 0xF0, 0x1F, 0x7E, 0x03, 0xEF, 0x80, 0x3F, 0xF0, 0x07, 0xFC,
+  0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x1F, 0x7C,
+  0x07, 0xEF, 0xC0, 0xF8, 0xF8, 0x3F, 0x1F, 0x87, 0xC1, 0xF1, 0xF8, 0x1F,
+  0x3E, 0x03, 0xF0, 0xFC, 0x03, 0xE7, 0xC0, 0x7E, 0x7C, 0x07, 0xE7, 0xE0,
+  0x7C, 0x3E, 0x07, 0xC3, 0xE0, 0xFC, 0x3E, 0x0F, 0x81, 0xF0, 0xF8, 0x1F,
+  0x0F, 0x81, 0xF1, 0xF0, 0x0F, 0x9F, 0x00, 0xF9, 0xF0, 0x0F, 0xBE, 0x00,
+  0x7B, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
+  0x03, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xF0,
+  0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0xFC, 0x00,
+  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0x1F, 0xC1, 0xFE, 0x0F, 0xF0, 0xFC, 0x07,
+  0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8,
+  0x0F, 0xC3, 0xFC, 0x1F, 0xC0, 0xF8, 0x07, 0xF0, 0x3F, 0xC0, 0x3F, 0x00,
+  0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F,
+  0x00, 0xFC, 0x03, 0xFC, 0x1F, 0xE0, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0xF8, 0x07, 0xF0, 0x3F, 0xC1, 0xFE, 0x01, 0xF8, 0x07, 0xC0, 0x3E, 0x01,
+  0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xE0, 0x1F,
+  0xE0, 0x7F, 0x00, 0xF8, 0x1F, 0xC1, 0xFE, 0x1F, 0x80, 0xF8, 0x07, 0xC0,
+  0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x01, 0xF8, 0x7F,
+  0x83, 0xFC, 0x1F, 0xC0, 0xF8, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x3D, 0xFF,
+  0x07, 0xBF, 0xF9, 0xFF, 0x9F, 0xFD, 0xE1, 0xFF, 0xBC, 0x0F, 0xE0, 0x00,
+  0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00,
+  0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
+  0x07, 0xCF, 0x80, 0x03, 0xE7, 0xC0, 0x03, 0xF3, 0xF0, 0x01, 0xF0, 0xF8,
+  0x01, 0xF8, 0x7C, 0x00, 0xFC, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0x7E, 0x07,
+  0xC0, 0x3F, 0x03, 0xF0, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xFF, 0x07, 0xFF, 0xFF, 0x87, 0xE0, 0x07, 0xC3, 0xF0, 0x03, 0xF1, 0xF8,
+  0x00, 0xF9, 0xF8, 0x00, 0x7C, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x0F, 0x80,
+  0x00, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
+  0x80, 0xF0, 0x7F, 0x83, 0xFE, 0x3E, 0xFF, 0xE3, 0xFE, 0x0F, 0xC0, 0x1F,
+  0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01,
+  0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00,
+  0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0xFF, 0x00,
+  0x09, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0,
+  0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xFF, 0xF1, 0xFF, 0xFF, 0x1F,
+  0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x61, 0xFC, 0x31, 0xCF, 0xFE,
+  0x77, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xC7, 0xF0, 0x7F, 0x0F, 0x80, 0x3E,
+  0x1E, 0x00, 0x3C, 0x38, 0x00, 0x38, 0xE0, 0x00, 0x79, 0xC0, 0x00, 0x73,
+  0x80, 0x00, 0xE7, 0x00, 0x01, 0xCE, 0x00, 0x03, 0x9C, 0x00, 0x07, 0x3C,
+  0x00, 0x1C, 0x3C, 0x00, 0x78, 0x7C, 0x01, 0xF0, 0xFE, 0x0F, 0xE3, 0xFF,
+  0xFF, 0xE7, 0xFF, 0xFF, 0xC6, 0x7F, 0xF3, 0x00, 0x3F, 0x80, 0x00, 0x00,
+  0x78, 0x00, 0x3C, 0x3E, 0x1E, 0x1F, 0x0F, 0x0F, 0x87, 0x87, 0xC3, 0xC3,
+  0xE1, 0xE1, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C,
+  0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01,
+  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xF0,
+  0x1F, 0xFF, 0xC3, 0xFF, 0xFE, 0x3F, 0x07, 0xE7, 0xC0, 0x3E, 0x7C, 0x01,
+  0xF7, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
+  0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x03, 0xFE, 0x00,
+  0x07, 0xF0, 0x00, 0x1F, 0xF8, 0x01, 0xF7, 0x80, 0x1F, 0x7C, 0x03, 0xF7,
+  0xF0, 0x7E, 0x3F, 0xFF, 0xE1, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x3F, 0xC0,
+  0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0xC7, 0xE3, 0xF3, 0xE0,
+  0xF9, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x07, 0xFE, 0x07,
+  0xFF, 0xC7, 0xDF, 0xF7, 0xC3, 0xFF, 0xE0, 0x7F, 0xF8, 0x0F, 0xFF, 0x07,
+  0xBF, 0xE3, 0xCF, 0xFF, 0xE3, 0xFF, 0xE0, 0x7F, 0xC0, 0x0F, 0xF0, 0x01,
+  0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x3E, 0x0F, 0x9F, 0x8F, 0xC7, 0xFF, 0xC3,
+  0xFF, 0xE0, 0xFF, 0xE0, 0x1F, 0xC0, 0x70, 0x77, 0xC7, 0xFE, 0x3F, 0xF1,
+  0xF7, 0x07, 0x00, 0x0F, 0x0F, 0x80, 0xF8, 0xF0, 0x07, 0x9E, 0x00, 0x3F,
+  0xE0, 0x03, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0xE3,
+  0xF0, 0x7E, 0x7C, 0x03, 0xF7, 0xC0, 0x1F, 0x7C, 0x00, 0x07, 0xE0, 0x00,
+  0x7F, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFE, 0x01, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xC0, 0x3F, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x80,
+  0x1F, 0x78, 0x01, 0xF7, 0xC0, 0x3F, 0x7F, 0x07, 0xE3, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xC0, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xF0,
+  0x1F, 0xFF, 0xC3, 0xFF, 0xFE, 0x3F, 0x07, 0xE7, 0xC0, 0x3E, 0x7C, 0x01,
+  0xF7, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
+  0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x03, 0xFE, 0x00,
+  0x07, 0xF0, 0x00, 0x1F, 0xF8, 0x01, 0xF7, 0x80, 0x1F, 0x7C, 0x03, 0xF7,
+  0xF0, 0x7E, 0x3F, 0xFF, 0xE1, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x3F, 0xC0,
+  0x00, 0x60, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xC0, 0x00, 0x1C,
+  0x00, 0x03, 0xC0, 0x01, 0xF8, 0x00, 0x1E, 0x00, 0x0F, 0x07, 0x80, 0x7C,
+  0x7C, 0x01, 0xF7, 0xC0, 0x07, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x7C, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7C, 0x00, 0x03, 0xE0, 0x00,
+  0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
+  0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07,
+  0xC0, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00,
+  0x07, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+  0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07,
+  0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03,
+  0xF0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E,
+  0x07, 0x80, 0xF0, 0xF8, 0x07, 0x9F, 0x00, 0x7F, 0xE0, 0x03, 0xFC, 0x00,
+  0x1F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x0F,
+  0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x07,
+  0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07,
+  0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x03,
+  0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F,
+  0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xE0,
+  0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0,
+  0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xF0,
+  0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF8,
+  0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x81, 0xFF, 0x1F, 0xFC, 0xFF, 0xEF, 0x8F,
+  0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF8, 0xFB, 0xFF, 0x9F, 0xFC, 0x7F, 0xC0,
+  0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xE7, 0xE1,
+  0xFB, 0xE0, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x03, 0xFF, 0x8F, 0xFF, 0xDF,
+  0xFF, 0xEF, 0xC1, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8, 0x7F,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0xFB, 0xE3, 0xF1, 0xF0, 0x01, 0xF0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x01, 0xE0,
+  0x00, 0xF9, 0xF7, 0x8F, 0x1E, 0x3F, 0xFF, 0x7E, 0x78, 0x1F, 0x03, 0xE0,
+  0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE4, 0x7F,
+  0x8F, 0xFF, 0xFD, 0xFE, 0x3F, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F,
+  0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x3E, 0x79, 0xE3,
+  0xCF, 0x00, 0x01, 0xE0, 0x1E, 0xF9, 0xEF, 0x9E, 0xF9, 0xEF, 0x9E, 0xF9,
+  0xEF, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
+  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
+  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x1F,
+  0x00, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFE, 0x7E,
+  0x0F, 0x9F, 0x01, 0xF7, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF,
+  0x80, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xF7, 0xC0, 0x7D,
+  0xF8, 0x3F, 0x7F, 0xFF, 0x8F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0, 0x78,
+  0x7C, 0xF1, 0xE3, 0xEF, 0x07, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0x30, 0x60,
+  0xF1, 0xF0, 0xE1, 0xC7, 0xFE, 0xF0, 0x3C, 0x0F, 0x87, 0x87, 0xC0, 0xF3,
+  0xE0, 0x1E, 0xF0, 0x07, 0xF8, 0x00, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x3F, 0xFF, 0x9F,
+  0x83, 0xE7, 0xC0, 0x7D, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
+  0xE0, 0x3F, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x7D, 0xF0, 0x1F,
+  0x7E, 0x0F, 0xDF, 0xFF, 0xE3, 0xFF, 0xF0, 0x7F, 0xF8, 0x07, 0xF8, 0x00,
+  0x07, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFE, 0x7E, 0x0F, 0x9F,
+  0x01, 0xE7, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x80, 0xFF,
+  0xF8, 0x07, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xF7, 0xC0, 0x7D, 0xF8, 0x3F,
+  0x7F, 0xFF, 0x8F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0, 0x00, 0xC0, 0x00,
+  0x7C, 0x00, 0x0F, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x3F,
+  0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03,
+  0xC3, 0xE7, 0x87, 0xCF, 0x0F, 0x80, 0x1F, 0x01, 0xFF, 0xE3, 0xFF, 0xC7,
+  0xFF, 0x8F, 0xFF, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E,
+  0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
+  0x1F, 0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0xF8,
+  0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0xFC,
+  0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x3E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x87,
+  0x9E, 0x00, 0x7C, 0x3E, 0x3E, 0x7C, 0x1E, 0x78, 0x0F, 0xF0, 0x07, 0xE0,
+  0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0,
+  0x07, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x1F, 0x80, 0x3F, 0x00,
+  0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7E,
+  0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xE0,
+  0x0F, 0xC0, 0x1F, 0x80, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00,
+  0xF8, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC,
+  0xF8, 0x0F, 0xCF, 0x80, 0x7E, 0xF8, 0x03, 0xEF, 0x80, 0x3E, 0xF8, 0x03,
+  0xEF, 0x80, 0x3E, 0xF8, 0x07, 0xEF, 0x80, 0xFC, 0xFF, 0xFF, 0xCF, 0xFF,
+  0xF8, 0xFF, 0xFF, 0x0F, 0xFF, 0xE0, 0xF8, 0x7E, 0x0F, 0x83, 0xF0, 0xF8,
+  0x3F, 0x0F, 0x81, 0xF8, 0xF8, 0x1F, 0x8F, 0x80, 0xFC, 0xF8, 0x07, 0xCF,
+  0x80, 0x7E, 0xF8, 0x03, 0xEF, 0x80, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x07,
+  0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00,
+  0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xCF, 0x80, 0x03, 0xE7, 0xE0,
+  0x03, 0xF3, 0xF0, 0x01, 0xF0, 0xF8, 0x01, 0xF8, 0x7E, 0x00, 0xFC, 0x3F,
+  0x00, 0x7C, 0x0F, 0x80, 0x7E, 0x07, 0xE0, 0x3F, 0x03, 0xF0, 0x1F, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x87, 0xE0,
+  0x07, 0xE3, 0xF0, 0x03, 0xF1, 0xF8, 0x00, 0xF9, 0xF8, 0x00, 0x7E, 0xFC,
+  0x00, 0x3F, 0x7E, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3E, 0x7C, 0x00, 0x1E, 0x1E,
+  0x00, 0x1E, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
+  0xFC, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xE7, 0xC0, 0x01,
+  0xF3, 0xF0, 0x01, 0xF9, 0xF8, 0x00, 0xF8, 0x7C, 0x00, 0xFC, 0x3F, 0x00,
+  0x7E, 0x1F, 0x80, 0x3E, 0x07, 0xC0, 0x3F, 0x03, 0xF0, 0x1F, 0x81, 0xF8,
+  0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+  0xC3, 0xF0, 0x03, 0xF1, 0xF8, 0x01, 0xF8, 0xFC, 0x00, 0x7C, 0xFC, 0x00,
+  0x3F, 0x7E, 0x00, 0x1F, 0xBF, 0x00, 0x07, 0xC0, 0x03, 0xC3, 0xC0, 0x01,
+  0xF3, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF8,
+  0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xCF, 0x80, 0x03, 0xE7,
+  0xC0, 0x03, 0xF3, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0xF8, 0x7C, 0x00, 0xFC,
+  0x3F, 0x00, 0x7E, 0x0F, 0x80, 0x3E, 0x07, 0xC0, 0x3F, 0x03, 0xF0, 0x1F,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x87,
+  0xE0, 0x07, 0xE3, 0xF0, 0x03, 0xF1, 0xF8, 0x01, 0xF9, 0xF8, 0x00, 0x7E,
+  0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x1F, 0x80, 0x01, 0xC3, 0x80, 0x01, 0xF3,
+  0xE0, 0x00, 0xF9, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x1C, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF8, 0x00,
+  0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xCF, 0x80, 0x03, 0xE7, 0xC0,
+  0x03, 0xF3, 0xF0, 0x01, 0xF9, 0xF8, 0x00, 0xF8, 0x7C, 0x00, 0xFC, 0x3F,
+  0x00, 0x7E, 0x1F, 0x80, 0x3E, 0x07, 0xC0, 0x3F, 0x03, 0xF0, 0x1F, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x87, 0xF0,
+  0x07, 0xE3, 0xF0, 0x03, 0xF1, 0xF8, 0x01, 0xF9, 0xFC, 0x00, 0x7E, 0xFC,
+  0x00, 0x3F, 0x7E, 0x00, 0x1F, 0x80, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x00,
+  0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03,
+  0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C,
+  0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3E,
+  0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x80,
+  0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xF0, 0x7F, 0x9F,
+  0x80, 0x3F, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xE0,
+  0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFD, 0xF0, 0x01,
+  0xF3, 0xF0, 0x07, 0xE3, 0xF8, 0x3F, 0xC7, 0xFF, 0xFF, 0x07, 0xFF, 0xFC,
+  0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x00,
+  0x07, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC7,
+  0xF0, 0x3F, 0x9F, 0xC0, 0x3F, 0xBF, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0xF8,
+  0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
+  0x7D, 0xF8, 0x01, 0xFB, 0xF0, 0x07, 0xF3, 0xF8, 0x1F, 0xC7, 0xFF, 0xFF,
+  0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x01, 0xFE, 0x00,
+  0x00, 0x60, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00,
+  0x01, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x7E, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x83, 0xC0, 0x07, 0x8F, 0x80, 0x0F, 0xBE, 0x00, 0x0F, 0x78, 0x00, 0x0F,
+  0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x81, 0xFF, 0xFF,
+  0x87, 0xFF, 0xFF, 0x0F, 0xE0, 0x7F, 0x3F, 0x00, 0x7E, 0x7C, 0x00, 0x7E,
+  0xF8, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0,
+  0x00, 0xFD, 0xF0, 0x01, 0xFB, 0xE0, 0x07, 0xE7, 0xE0, 0x0F, 0xC7, 0xF0,
+  0x7F, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF,
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07,
+  0x80, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
+  0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xE0, 0x00, 0xF8, 0x00,
+  0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
+  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xE0, 0x00, 0xF8, 0x00, 0x3E,
+  0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x78,
+  0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xC0,
+  0x01, 0xE0, 0x1C, 0x1C, 0x0F, 0x8F, 0x83, 0xE3, 0xE0, 0xF8, 0xF8, 0x1C,
+  0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
+  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
+  0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x1F, 0x0F, 0x8F, 0x81,
+  0xE7, 0xC0, 0x3D, 0xE0, 0x07, 0xF0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
+  0x80, 0x03, 0xE0, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xFF,
+  0xFE, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
+  0x3E, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x1E, 0x3E, 0x3C, 0x78, 0x70, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0x07, 0x00, 0x7C, 0x07, 0xF0, 0x7B, 0xC7, 0xDF, 0x7C, 0x7F, 0xC1, 0xE0,
+  0x00, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E,
+  0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0,
+  0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07,
+  0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x78, 0x1F, 0x00,
+  0xF0, 0xF8, 0x01, 0xE7, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
+  0x80, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xCF,
+  0x80, 0x7F, 0x3E, 0x00, 0xFE, 0xF8, 0x01, 0xFB, 0xE0, 0x03, 0xEF, 0x80,
+  0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07,
+  0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xBE,
+  0x00, 0x7E, 0xF8, 0x01, 0xFB, 0xE0, 0x1F, 0xCF, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xF8, 0xFF, 0xFF, 0x83, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
+  0x80, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFF, 0x03, 0xE0, 0x1F, 0xC0, 0xF8, 0x03, 0xF8, 0x3E, 0x00, 0x7E,
+  0x0F, 0x80, 0x0F, 0x83, 0xE0, 0x01, 0xF0, 0xF8, 0x00, 0x7F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x01, 0xF0, 0xF8, 0x00, 0x7C, 0x3E,
+  0x00, 0x1F, 0x0F, 0x80, 0x07, 0xC3, 0xE0, 0x03, 0xE0, 0xF8, 0x01, 0xF8,
+  0x3E, 0x00, 0x7E, 0x0F, 0x80, 0x7F, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0xE0, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x00,
+  0x1F, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0xC0,
+  0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x7F,
+  0xFE, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0x07, 0xFE, 0xFC,
+  0x3F, 0xF7, 0xF1, 0xFF, 0x9F, 0x8F, 0xFC, 0x7E, 0x7F, 0xE3, 0xFB, 0xFF,
+  0x0F, 0xDF, 0xF8, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x1F,
+  0xFF, 0x80, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x3F, 0xF8,
+  0x00, 0xFF, 0xC0, 0x07, 0xC0, 0x1F, 0x07, 0xC0, 0x7C, 0x7C, 0x01, 0xF7,
+  0xC0, 0x07, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x01,
+  0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x7F, 0xFC, 0x03, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xC0, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x3F, 0xF7, 0xE1, 0xFF, 0xBF, 0x8F,
+  0xFC, 0xFC, 0x7F, 0xE3, 0xF3, 0xFF, 0x1F, 0xDF, 0xF8, 0x7E, 0xFF, 0xC1,
+  0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0xFF, 0xFC, 0x03, 0xFF,
+  0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
+  0x3E, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0x81, 0xFC, 0x7E, 0x00, 0xFE, 0x7E, 0x00,
+  0x7E, 0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xFC, 0x00, 0x3F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x7F, 0x00,
+  0x7E, 0x3F, 0x81, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFF, 0x00, 0x01, 0xE7, 0x80, 0x03, 0xE7, 0xC0, 0x07, 0xC3,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF,
+  0xFC, 0x3F, 0x81, 0xFC, 0x7E, 0x00, 0xFE, 0x7E, 0x00, 0x7E, 0x7C, 0x00,
+  0x3E, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
+  0x3F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0x7E, 0x3F, 0x81,
+  0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF1,
+  0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0x81, 0xFC, 0x7E, 0x00,
+  0xFE, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7C, 0x00, 0x3E, 0x7E, 0x00,
+  0x7E, 0x7F, 0x00, 0x7E, 0x3F, 0x81, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xC3,
+  0x80, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x01, 0xC3,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF,
+  0xFC, 0x3F, 0x81, 0xFC, 0x7E, 0x00, 0xFE, 0x7E, 0x00, 0x7E, 0x7C, 0x00,
+  0x3E, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
+  0x3F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0x7E, 0x3F, 0x81,
+  0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xC0, 0x00, 0xFF, 0x00, 0x10, 0x01, 0x07, 0x00, 0x71, 0xF0, 0x1F, 0x7F,
+  0x07, 0xF7, 0xF1, 0xFC, 0x7F, 0x7F, 0x07, 0xFF, 0xC0, 0x7F, 0xF0, 0x07,
+  0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x01, 0xFF, 0xF0, 0x7F,
+  0x7F, 0x1F, 0xC7, 0xF7, 0xF0, 0x7F, 0x7C, 0x07, 0xC7, 0x00, 0x70, 0x40,
+  0x04, 0x00, 0x3C, 0x0F, 0x01, 0xE1, 0xF0, 0x0F, 0x3E, 0x00, 0xFF, 0xC0,
+  0x07, 0xF8, 0x00, 0x3F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xC0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0x80,
+  0xFC, 0xF8, 0x07, 0xEF, 0x80, 0x3E, 0xF8, 0x03, 0xEF, 0x80, 0x3E, 0xF8,
+  0x03, 0xEF, 0x80, 0x7E, 0xF8, 0x0F, 0xCF, 0xFF, 0xFC, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xF0, 0xFF, 0xFE, 0x0F, 0x87, 0xE0, 0xF8, 0x3F, 0x0F, 0x83, 0xF0,
+  0xF8, 0x1F, 0x8F, 0x81, 0xF8, 0xF8, 0x0F, 0xCF, 0x80, 0x7C, 0xF8, 0x07,
+  0xEF, 0x80, 0x3E, 0xF8, 0x03, 0xF0, 0x00, 0x70, 0x00, 0x07, 0xC0, 0x00,
+  0x77, 0x00, 0x03, 0x18, 0x00, 0x18, 0xC0, 0x00, 0xEE, 0x00, 0x03, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0xF0,
+  0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F,
+  0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80,
+  0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF,
+  0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x00,
+  0xFD, 0xFC, 0x1F, 0xCF, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0xFF, 0xFE, 0x03,
+  0xFF, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01,
+  0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
+  0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F,
+  0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
+  0x07, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xF7, 0xF0, 0x7F, 0x3F, 0xFF, 0xF8,
+  0xFF, 0xFF, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00,
+  0xF9, 0xE0, 0x0F, 0x9F, 0x00, 0xF8, 0xF0, 0x07, 0x8F, 0x00, 0x78, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0xC0,
+  0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F,
+  0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
+  0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
+  0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x7F, 0xF8, 0x03,
+  0xF7, 0xF0, 0x7F, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0x83, 0xFF, 0xF8, 0x0F,
+  0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x07, 0x07, 0x00, 0x7C, 0x7C, 0x03, 0xE3,
+  0xE0, 0x1F, 0x1F, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01,
+  0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
+  0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F,
+  0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
+  0x07, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xF7, 0xF0, 0x7F, 0x3F, 0xFF, 0xF8,
+  0xFF, 0xFF, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x7F, 0xF8, 0x00, 0xFD, 0xF8, 0x03, 0xF1, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F,
+  0x83, 0xE0, 0x7E, 0x07, 0xE0, 0xFC, 0x07, 0xE3, 0xF0, 0x0F, 0xC7, 0xE0,
+  0x0F, 0xDF, 0x80, 0x1F, 0xBF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF0, 0x00,
+  0x3F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
+  0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8,
+  0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
+  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
+  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1C, 0x00,
+  0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03,
+  0xC0, 0x00, 0xFC, 0x00, 0x07, 0x80, 0x00, 0x07, 0xF8, 0x01, 0xFF, 0xE0,
+  0x3F, 0xFF, 0x07, 0xFF, 0xF8, 0xFE, 0x1F, 0xCF, 0xC0, 0xFC, 0xF8, 0x07,
+  0xCF, 0x80, 0x7C, 0xF8, 0x07, 0xCF, 0x80, 0xFC, 0xF8, 0x1F, 0x8F, 0x8F,
+  0xF0, 0xF8, 0xFE, 0x0F, 0x8F, 0xFC, 0xF8, 0xFF, 0xEF, 0x80, 0x7E, 0xF8,
+  0x03, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xFF,
+  0x80, 0x7F, 0xF8, 0xFF, 0xEF, 0x8F, 0xFC, 0xF8, 0xFF, 0x8F, 0x8F, 0xE0,
+  0x03, 0xE0, 0x7C, 0x07, 0x80, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x8F,
+  0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xC0, 0xF8, 0x0F, 0x80,
+  0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
+  0xF8, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00,
+  0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
+  0x0F, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xE7, 0xE1, 0xFB, 0xE0, 0x7C, 0x00,
+  0x3E, 0x00, 0x1F, 0x03, 0xFF, 0x8F, 0xFF, 0xDF, 0xFF, 0xEF, 0xC1, 0xFF,
+  0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xCF, 0xFB, 0xE3, 0xF1, 0xF0, 0x01, 0xE0, 0x01, 0xF8, 0x01, 0xFE, 0x00,
+  0xFF, 0x80, 0xF3, 0xE0, 0xF0, 0xF0, 0xF8, 0x3C, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xF8, 0x07, 0xFF, 0x07, 0xFF, 0xE3, 0xFF, 0xF3, 0xF0, 0xFD, 0xF0,
+  0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x81, 0xFF, 0xC7, 0xFF, 0xEF, 0xFF, 0xF7,
+  0xE0, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xF0, 0x3F, 0xFC, 0x3F, 0xFF, 0xFF,
+  0xDF, 0xFF, 0xE7, 0xFD, 0xF1, 0xF8, 0xF8, 0x1E, 0x0F, 0x0F, 0x07, 0x87,
+  0xC7, 0xC1, 0xFF, 0xC0, 0x7F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xE7, 0xE1, 0xFB, 0xE0,
+  0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x03, 0xFF, 0x8F, 0xFF, 0xDF, 0xFF, 0xEF,
+  0xC1, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8, 0x7F, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xCF, 0xFB, 0xE3, 0xF1, 0xF0, 0x0E, 0x0E, 0x0F, 0x8F, 0x87,
+  0xC7, 0xC3, 0xE3, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xE7, 0xE1, 0xFB, 0xE0,
+  0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x03, 0xFF, 0x8F, 0xFF, 0xDF, 0xFF, 0xEF,
+  0xC1, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8, 0x7F, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xCF, 0xFB, 0xE3, 0xF1, 0xF0, 0x1E, 0x3E, 0x3C, 0x78, 0x70,
+  0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0x80,
+  0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0xFF, 0xFE, 0x7E, 0x1F, 0x9F, 0x03,
+  0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
+  0xE0, 0x00, 0xF8, 0x00, 0x3F, 0x01, 0xF7, 0xC0, 0xFD, 0xF8, 0x7E, 0x3F,
+  0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x03, 0xF8, 0x03, 0xFF,
+  0x81, 0xFF, 0xF0, 0xFF, 0xFE, 0x7E, 0x1F, 0x9F, 0x03, 0xFF, 0xC0, 0x7F,
+  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
+  0x00, 0x3F, 0x01, 0xF7, 0xC0, 0xFD, 0xF8, 0x7E, 0x3F, 0xFF, 0x87, 0xFF,
+  0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x0F, 0x80,
+  0x00, 0xE0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x1E,
+  0x1F, 0x07, 0xC7, 0x80, 0xFB, 0xC0, 0x1F, 0xE0, 0x03, 0xF8, 0x00, 0x7C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xF0,
+  0xFF, 0xFE, 0x7E, 0x1F, 0xDF, 0x03, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0xF8,
+  0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xFF, 0x01,
+  0xF7, 0xC0, 0xFD, 0xF8, 0x7E, 0x3F, 0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0,
+  0x0F, 0xE0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xFF,
+  0x01, 0xFF, 0xF0, 0xFF, 0xFC, 0x7E, 0x1F, 0x9F, 0x03, 0xEF, 0x80, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xF8,
+  0x00, 0x3E, 0x00, 0x07, 0xC0, 0x7D, 0xF8, 0x7E, 0x3F, 0xFF, 0x87, 0xFF,
+  0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xF0,
+  0xFF, 0xFC, 0x7E, 0x1F, 0x9F, 0x03, 0xEF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
+  0x07, 0xC0, 0x7D, 0xF8, 0x7E, 0x3F, 0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0,
+  0x0F, 0xE0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0xF0, 0x01,
+  0xFC, 0x00, 0x3F, 0x00, 0x07, 0x80, 0x0E, 0x0E, 0x07, 0xC7, 0xC1, 0xF1,
+  0xF0, 0x7C, 0x7C, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0xFF, 0xFC, 0x7E, 0x1F, 0x9F,
+  0x03, 0xEF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x7D, 0xF8, 0x7E,
+  0x3F, 0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x3C, 0x1F, 0x07,
+  0x87, 0x80, 0xF3, 0xC0, 0x3F, 0xF0, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x1E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xFC,
+  0x3F, 0xFF, 0x1F, 0x87, 0xE7, 0xC0, 0xFB, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x1F, 0x7E, 0x1F, 0x8F, 0xFF, 0xE1, 0xFF, 0xF0, 0x3F, 0xF8,
+  0x03, 0xF8, 0x00, 0x1E, 0x3E, 0x3C, 0x78, 0x70, 0x00, 0x00, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x0F, 0x80, 0xFE, 0x0F, 0xF0, 0x7B,
+  0xC7, 0x8F, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
+  0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03,
+  0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C,
+  0x03, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00,
+  0xF9, 0xE0, 0x00, 0x7C, 0xF0, 0x00, 0x3E, 0x70, 0x00, 0x1F, 0x38, 0x00,
+  0x0F, 0x9C, 0x00, 0x07, 0xC0, 0x07, 0xE3, 0xE0, 0x07, 0xFD, 0xF0, 0x0F,
+  0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x07, 0xE0, 0xFE, 0x03, 0xE0, 0x3F, 0x03,
+  0xF0, 0x1F, 0x81, 0xF0, 0x07, 0xC0, 0xF8, 0x03, 0xE0, 0x7C, 0x01, 0xF0,
+  0x3E, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x0F, 0x80, 0x3E, 0x07, 0xE0, 0x3F,
+  0x01, 0xF0, 0x1F, 0x80, 0xFC, 0x1F, 0xC0, 0x3F, 0xFF, 0xE0, 0x1F, 0xFD,
+  0xF0, 0x07, 0xFC, 0xF8, 0x00, 0xFC, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x07,
+  0xFF, 0xC0, 0x3F, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
+  0x1F, 0x8F, 0x81, 0xFF, 0x7C, 0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0x1F, 0x83,
+  0xF8, 0xF8, 0x0F, 0xCF, 0xC0, 0x7E, 0x7C, 0x01, 0xF3, 0xE0, 0x0F, 0x9F,
+  0x00, 0x7C, 0xF8, 0x03, 0xE7, 0xC0, 0x1F, 0x3E, 0x00, 0xF9, 0xF8, 0x0F,
+  0xC7, 0xC0, 0x7E, 0x3F, 0x07, 0xF0, 0xFF, 0xFF, 0x87, 0xFF, 0x7C, 0x1F,
+  0xF3, 0xE0, 0x3F, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0x80,
+  0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xF0, 0xFB,
+  0xFF, 0x3E, 0xFF, 0xEF, 0xFF, 0xFB, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE, 0x01,
+  0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F,
+  0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8,
+  0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7C, 0x3E, 0x1F, 0x07, 0x8F, 0x80, 0xF3,
+  0xC0, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0xFC, 0x3E, 0xFF, 0xCF, 0xBF, 0xFB, 0xFF, 0xFE, 0xFE, 0x1F, 0xFF,
+  0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80,
+  0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0x00, 0x3E, 0x00,
+  0x0F, 0x80, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F,
+  0xFF, 0xC7, 0xE0, 0xFC, 0xF8, 0x0F, 0xBF, 0x01, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF8,
+  0x0F, 0xDF, 0x01, 0xF3, 0xF0, 0x7E, 0x3F, 0xFF, 0x83, 0xFF, 0xE0, 0x3F,
+  0xF8, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03,
+  0xDE, 0x00, 0xF1, 0xE0, 0x3E, 0x3E, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x83, 0xFF, 0xF8, 0xFC,
+  0x1F, 0x9F, 0x01, 0xF7, 0xE0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0,
+  0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFF, 0x01, 0xFB, 0xE0,
+  0x3E, 0x7E, 0x0F, 0xC7, 0xFF, 0xF0, 0x7F, 0xFC, 0x07, 0xFF, 0x00, 0x3F,
+  0x80, 0x01, 0xF3, 0xE0, 0x7C, 0xF8, 0x1F, 0x1E, 0x03, 0xC7, 0x80, 0xF1,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF,
+  0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC7, 0xE0, 0xFC, 0xF8, 0x0F, 0xBF, 0x01,
+  0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01,
+  0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xDF, 0x01, 0xF3, 0xF0, 0x7E, 0x3F, 0xFF,
+  0x83, 0xFF, 0xE0, 0x3F, 0xF8, 0x01, 0xFC, 0x00, 0x0E, 0x0E, 0x03, 0xE3,
+  0xE0, 0x7C, 0x7C, 0x0F, 0x8F, 0x80, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF,
+  0xC7, 0xE0, 0xFC, 0xF8, 0x0F, 0xBF, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x0F,
+  0xDF, 0x01, 0xF3, 0xF0, 0x7E, 0x3F, 0xFF, 0x83, 0xFF, 0xE0, 0x3F, 0xF8,
+  0x01, 0xFC, 0x00, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
+  0x03, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0x80,
+  0xF8, 0x79, 0xE3, 0xE3, 0xDF, 0x07, 0xF8, 0x1F, 0xC0, 0x3E, 0x00, 0x00,
+  0x00, 0x00, 0x7C, 0x79, 0xF7, 0xE7, 0xDF, 0x9F, 0xFE, 0x7F, 0xF9, 0xFC,
+  0x07, 0xE0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
+  0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
+  0x00, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x73, 0x80, 0x18, 0x60, 0x06, 0x18,
+  0x01, 0xCE, 0x00, 0x3F, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0,
+  0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07,
+  0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xFC, 0x0F, 0xFF, 0x87, 0xF7,
+  0xFF, 0xFD, 0xFF, 0xDF, 0x3F, 0xE7, 0xC3, 0xF1, 0xF0, 0x00, 0x7C, 0x00,
+  0x1F, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF8, 0x7F, 0x7F, 0xFF, 0xDF, 0xFD, 0xF3, 0xFE, 0x7C, 0x3F, 0x1F,
+  0x03, 0xE3, 0xC0, 0x78, 0xF0, 0x1E, 0x3C, 0x07, 0x8F, 0x01, 0xE3, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3E, 0xF8, 0x07, 0xDF, 0x00, 0xFB,
+  0xE0, 0x1F, 0x7C, 0x03, 0xEF, 0x80, 0x7D, 0xF0, 0x0F, 0xBE, 0x01, 0xF7,
+  0xC0, 0x3E, 0xF8, 0x07, 0xDF, 0x00, 0xFB, 0xE0, 0x1F, 0x7C, 0x03, 0xEF,
+  0x80, 0x7D, 0xF8, 0x1F, 0xBF, 0x87, 0xF3, 0xFF, 0xFE, 0x7F, 0xF7, 0xC7,
+  0xFC, 0xF8, 0x3F, 0x1F, 0x00, 0x0E, 0x1C, 0x07, 0xCF, 0x81, 0xF3, 0xE0,
+  0x7C, 0xF8, 0x0E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+  0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01,
+  0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F,
+  0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0xFF, 0xF8, 0x7F, 0x7F,
+  0xFF, 0xDF, 0xFD, 0xF3, 0xFE, 0x7C, 0x3F, 0x1F, 0x00, 0x3E, 0x00, 0x07,
+  0xC0, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE7, 0xC0, 0x7E, 0x7C, 0x07, 0xE7,
+  0xE0, 0x7C, 0x3E, 0x07, 0xC3, 0xE0, 0xFC, 0x3E, 0x0F, 0x81, 0xF0, 0xF8,
+  0x1F, 0x0F, 0x81, 0xF1, 0xF0, 0x0F, 0x9F, 0x00, 0xF9, 0xF0, 0x0F, 0xBE,
+  0x00, 0x7B, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
+  0xC0, 0x03, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07,
+  0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x00,
+  0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x7F, 0xFB, 0xFF, 0xDF,
+  0xFE, 0xFF, 0xF0, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C,
+  0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xFF, 0x0F, 0xF8,
+  0x3F, 0xC0, 0xFE, 0x03, 0xE0, 0x0E, 0x00, 0x7C, 0x01, 0xF0, 0x03, 0x80,
+  0x1C, 0x01, 0xE0, 0x7E, 0x03, 0xC0, 0x7B, 0xFF, 0xFF, 0x78 };
+
+const GFXglyph InterTight_Bold18pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   6,  26,  10,    2,  -25 },   // 0x21 '!' U+0021
+  {    21,  13,  11,  19,    3,  -25 },   // 0x22 '"' U+0022
+  {    39,  22,  26,  22,    0,  -25 },   // 0x23 '#' U+0023
+  {   111,  20,  33,  21,    0,  -29 },   // 0x24 '$' U+0024
+  {   194,  25,  29,  29,    2,  -27 },   // 0x25 '%' U+0025
+  {   285,  23,  26,  23,    1,  -25 },   // 0x26 '&' U+0026
+  {   360,   5,  11,  11,    3,  -25 },   // 0x27 ''' U+0027
+  {   367,   9,  33,  11,    2,  -27 },   // 0x28 '(' U+0028
+  {   405,   9,  33,  11,    0,  -27 },   // 0x29 ')' U+0029
+  {   443,  15,  15,  19,    2,  -25 },   // 0x2a '*' U+002A
+  {   472,  18,  18,  23,    2,  -19 },   // 0x2b '+' U+002B
+  {   513,   7,  11,  11,    1,   -3 },   // 0x2c ',' U+002C
+  {   523,  12,   4,  16,    2,  -12 },   // 0x2d '-' U+002D
+  {   529,   6,   6,  10,    2,   -5 },   // 0x2e '.' U+002E
+  {   534,  13,  32,  13,    0,  -27 },   // 0x2f '/' U+002F
+  {   586,  21,  26,  23,    1,  -25 },   // 0x30 '0' U+0030
+  {   655,  11,  26,  14,    1,  -25 },   // 0x31 '1' U+0031
+  {   691,  18,  26,  20,    1,  -25 },   // 0x32 '2' U+0032
+  {   750,  19,  26,  21,    1,  -25 },   // 0x33 '3' U+0033
+  {   812,  22,  26,  23,    1,  -25 },   // 0x34 '4' U+0034
+  {   884,  19,  26,  22,    2,  -25 },   // 0x35 '5' U+0035
+  {   946,  20,  26,  22,    1,  -25 },   // 0x36 '6' U+0036
+  {  1011,  18,  26,  20,    1,  -25 },   // 0x37 '7' U+0037
+  {  1070,  20,  26,  22,    1,  -25 },   // 0x38 '8' U+0038
+  {  1135,  20,  26,  22,    1,  -25 },   // 0x39 '9' U+0039
+  {  1200,   6,  19,  10,    2,  -18 },   // 0x3a ':' U+003A
+  {  1215,   7,  26,  11,    2,  -18 },   // 0x3b ';' U+003B
+  {  1238,  18,  21,  24,    3,  -20 },   // 0x3c '<' U+003C
+  {  1286,  17,  13,  23,    3,  -16 },   // 0x3d '=' U+003D
+  {  1314,  18,  21,  24,    3,  -20 },   // 0x3e '>' U+003E
+  {  1362,  17,  26,  19,    1,  -25 },   // 0x3f '?' U+003F
+  {  1418,  33,  33,  35,    1,  -25 },   // 0x40 '@' U+0040
+  {  1555,  25,  26,  26,    1,  -25 },   // 0x41 'A' U+0041
+  {  1637,  20,  26,  23,    2,  -25 },   // 0x42 'B' U+0042
+  {  1702,  23,  26,  25,    1,  -25 },   // 0x43 'C' U+0043
+  {  1777,  22,  26,  25,    2,  -25 },   // 0x44 'D' U+0044
+  {  1849,  18,  26,  21,    2,  -25 },   // 0x45 'E' U+0045
+  {  1908,  17,  26,  20,    2,  -25 },   // 0x46 'F' U+0046
+  {  1964,  23,  26,  25,    1,  -25 },   // 0x47 'G' U+0047
+  {  2039,  22,  26,  26,    2,  -25 },   // 0x48 'H' U+0048
+  {  2111,   5,  26,   9,    2,  -25 },   // 0x49 'I' U+0049
+  {  2128,  17,  26,  20,    1,  -25 },   // 0x4a 'J' U+004A
+  {  2184,  21,  26,  23,    2,  -25 },   // 0x4b 'K' U+004B
+  {  2253,  17,  26,  19,    2,  -25 },   // 0x4c 'L' U+004C
+  {  2309,  28,  26,  32,    2,  -25 },   // 0x4d 'M' U+004D
+  {  2400,  21,  26,  25,    2,  -25 },   // 0x4e 'N' U+004E
+  {  2469,  24,  26,  26,    1,  -25 },   // 0x4f 'O' U+004F
+  {  2547,  19,  26,  22,    2,  -25 },   // 0x50 'P' U+0050
+  {  2609,  24,  28,  26,    1,  -25 },   // 0x51 'Q' U+0051
+  {  2693,  20,  26,  22,    2,  -25 },   // 0x52 'R' U+0052
+  {  2758,  20,  26,  21,    0,  -25 },   // 0x53 'S' U+0053
+  {  2823,  21,  26,  23,    1,  -25 },   // 0x54 'T' U+0054
+  {  2892,  21,  26,  25,    2,  -25 },   // 0x55 'U' U+0055
+  {  2961,  25,  26,  25,    0,  -25 },   // 0x56 'V' U+0056
+  {  3043,  36,  26,  36,    0,  -25 },   // 0x57 'W' U+0057
+  {  3160,  24,  26,  24,    0,  -25 },   // 0x58 'X' U+0058
+  {  3238,  23,  26,  25,    1,  -25 },   // 0x59 'Y' U+0059
+  {  3313,  20,  26,  22,    1,  -25 },   // 0x5a 'Z' U+005A
+  {  3378,   9,  33,  12,    2,  -27 },   // 0x5b '[' U+005B
+  {  3416,  13,  32,  13,    0,  -27 },   // 0x5c '\' U+005C
+  {  3468,   9,  33,  12,    1,  -27 },   // 0x5d ']' U+005D
+  {  3506,  15,  12,  17,    1,  -25 },   // 0x5e '^' U+005E
+  {  3529,  17,   4,  17,    0,    1 },   // 0x5f '_' U+005F
+  {  3538,   7,   5,  15,    4,  -26 },   // 0x60 '`' U+0060
+  {  3543,  17,  20,  20,    1,  -19 },   // 0x61 'a' U+0061
+  {  3586,  19,  26,  22,    2,  -25 },   // 0x62 'b' U+0062
+  {  3648,  18,  20,  20,    1,  -19 },   // 0x63 'c' U+0063
+  {  3693,  19,  26,  22,    1,  -25 },   // 0x64 'd' U+0064
+  {  3755,  18,  20,  20,    1,  -19 },   // 0x65 'e' U+0065
+  {  3800,  13,  27,  13,    0,  -26 },   // 0x66 'f' U+0066
+  {  3844,  19,  27,  22,    1,  -19 },   // 0x67 'g' U+0067
+  {  3909,  18,  26,  22,    2,  -25 },   // 0x68 'h' U+0068
+  {  3968,   5,  28,   9,    2,  -27 },   // 0x69 'i' U+0069
+  {  3986,   8,  35,   9,   -1,  -27 },   // 0x6a 'j' U+006A
+  {  4021,  18,  26,  20,    2,  -25 },   // 0x6b 'k' U+006B
+  {  4080,   5,  26,   9,    2,  -25 },   // 0x6c 'l' U+006C
+  {  4097,  28,  20,  32,    2,  -19 },   // 0x6d 'm' U+006D
+  {  4167,  18,  20,  22,    2,  -19 },   // 0x6e 'n' U+006E
+  {  4212,  19,  20,  21,    1,  -19 },   // 0x6f 'o' U+006F
+  {  4260,  19,  27,  22,    2,  -19 },   // 0x70 'p' U+0070
+  {  4325,  19,  27,  22,    1,  -19 },   // 0x71 'q' U+0071
+  {  4390,  12,  20,  14,    2,  -19 },   // 0x72 'r' U+0072
+  {  4420,  18,  20,  19,    0,  -19 },   // 0x73 's' U+0073
+  {  4465,  12,  25,  13,    0,  -24 },   // 0x74 't' U+0074
+  {  4503,  18,  20,  22,    2,  -19 },   // 0x75 'u' U+0075
+  {  4548,  20,  20,  20,    0,  -19 },   // 0x76 'v' U+0076
+  {  4598,  29,  20,  29,    0,  -19 },   // 0x77 'w' U+0077
+  {  4671,  19,  20,  19,    0,  -19 },   // 0x78 'x' U+0078
+  {  4719,  20,  27,  20,    0,  -19 },   // 0x79 'y' U+0079
+  {  4787,  16,  20,  18,    1,  -19 },   // 0x7a 'z' U+007A
+  {  4827,  13,  33,  16,    2,  -27 },   // 0x7b '{' U+007B
+  {  4881,   5,  43,  12,    3,  -34 },   // 0x7c '|' U+007C
+  {  4908,  13,  33,  16,    1,  -27 },   // 0x7d '}' U+007D
+  {  4962,  19,   8,  23,    2,  -14 },   // 0x7e '~' U+007E
+  {     0,   0,   0,  18,    2,  -33 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  4981,   1,   1,   7,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  4982,  25,  34,  25,    1,  -25 },   // 0x81 '0x0104' U+0104
+  {  5089,  13,   6,  17,    2,  -27 },   // 0x82 '0x02D8' U+02D8
+  {  5099,  20,  26,  20,    0,  -25 },   // 0x83 '0x0141' U+0141
+  {  5164,  23,  23,  25,    1,  -22 },   // 0x84 '0x00A4' U+00A4
+  {  5231,  17,  28,  19,    2,  -27 },   // 0x85 '0x013D' U+013D
+  {  5291,  20,  34,  21,    0,  -33 },   // 0x86 '0x015A' U+015A
+  {  5376,  17,  31,  19,    1,  -25 },   // 0x87 '0x00A7' U+00A7
+  {  5442,  13,   5,  17,    2,  -26 },   // 0x88 '0x00A8' U+00A8
+  {  5451,  20,  35,  21,    0,  -34 },   // 0x89 '0x0160' U+0160
+  {  5539,  20,  34,  21,    0,  -25 },   // 0x8a '0x015E' U+015E
+  {  5624,  21,  35,  23,    1,  -34 },   // 0x8b '0x0164' U+0164
+  {  5716,  20,  34,  22,    1,  -33 },   // 0x8c '0x0179' U+0179
+  {  5801,  12,   4,  16,    2,  -12 },   // 0x8d '0x00AD' U+00AD
+  {  5807,  20,  35,  22,    1,  -34 },   // 0x8e '0x017D' U+017D
+  {  5895,  20,  34,  22,    1,  -33 },   // 0x8f '0x017B' U+017B
+  {  5980,  13,  13,  15,    1,  -26 },   // 0x90 '0x00B0' U+00B0
+  {  6002,  17,  27,  20,    1,  -19 },   // 0x91 '0x0105' U+0105
+  {  6060,   7,  10,   9,    1,   -2 },   // 0x92 '0x02DB' U+02DB
+  {  6069,  11,  26,   9,   -1,  -25 },   // 0x93 '0x0142' U+0142
+  {  6105,   7,   5,  15,    4,  -26 },   // 0x94 '0x00B4' U+00B4
+  {  6110,  12,  28,  13,    2,  -27 },   // 0x95 '0x013E' U+013E
+  {  6152,  18,  28,  19,    0,  -27 },   // 0x96 '0x015B' U+015B
+  {  6215,  14,   6,  19,    2,  -27 },   // 0x97 '0x02C7' U+02C7
+  {  6226,   7,   9,  12,    3,    0 },   // 0x98 '0x00B8' U+00B8
+  {  6234,  18,  29,  19,    0,  -28 },   // 0x99 '0x0161' U+0161
+  {  6300,  18,  28,  19,    0,  -19 },   // 0x9a '0x015F' U+015F
+  {  6363,  15,  29,  13,    0,  -28 },   // 0x9b '0x0165' U+0165
+  {  6418,  16,  27,  18,    1,  -26 },   // 0x9c '0x017A' U+017A
+  {  6472,  15,   5,  15,    0,  -26 },   // 0x9d '0x02DD' U+02DD
+  {  6482,  16,  28,  18,    1,  -27 },   // 0x9e '0x017E' U+017E
+  {  6538,  16,  28,  18,    1,  -27 },   // 0x9f '0x017C' U+017C
+  {  6594,  20,  34,  22,    2,  -33 },   // 0xa0 '0x0154' U+0154
+  {  6679,  25,  34,  26,    1,  -33 },   // 0xa1 '0x00C1' U+00C1
+  {  6786,  25,  35,  26,    1,  -34 },   // 0xa2 '0x00C2' U+00C2
+  {  6896,  25,  34,  26,    1,  -33 },   // 0xa3 '0x0102' U+0102
+  {  7003,  25,  34,  26,    1,  -33 },   // 0xa4 '0x00C4' U+00C4
+  {  7110,  17,  34,  19,    2,  -33 },   // 0xa5 '0x0139' U+0139
+  {  7183,  23,  34,  25,    1,  -33 },   // 0xa6 '0x0106' U+0106
+  {  7281,  23,  34,  25,    1,  -25 },   // 0xa7 '0x00C7' U+00C7
+  {  7379,  23,  35,  25,    1,  -34 },   // 0xa8 '0x010C' U+010C
+  {  7480,  18,  34,  21,    2,  -33 },   // 0xa9 '0x00C9' U+00C9
+  {  7557,  18,  34,  21,    2,  -25 },   // 0xaa '0x0118' U+0118
+  {  7634,  18,  34,  21,    2,  -33 },   // 0xab '0x00CB' U+00CB
+  {  7711,  18,  35,  21,    2,  -34 },   // 0xac '0x011A' U+011A
+  {  7790,   8,  34,   9,    2,  -33 },   // 0xad '0x00CD' U+00CD
+  {  7824,  13,  35,   9,   -2,  -34 },   // 0xae '0x00CE' U+00CE
+  {  7881,  22,  35,  25,    2,  -34 },   // 0xaf '0x010E' U+010E
+  {  7978,  26,  26,  25,   -2,  -25 },   // 0xb0 '0x0110' U+0110
+  {  8063,  21,  34,  25,    2,  -33 },   // 0xb1 '0x0143' U+0143
+  {  8153,  21,  35,  25,    2,  -34 },   // 0xb2 '0x0147' U+0147
+  {  8245,  24,  34,  26,    1,  -33 },   // 0xb3 '0x00D3' U+00D3
+  {  8347,  24,  35,  26,    1,  -34 },   // 0xb4 '0x00D4' U+00D4
+  {  8452,  24,  34,  26,    1,  -33 },   // 0xb5 '0x0150' U+0150
+  {  8554,  24,  34,  26,    1,  -33 },   // 0xb6 '0x00D6' U+00D6
+  {  8656,  19,  19,  23,    2,  -19 },   // 0xb7 '0x00D7' U+00D7
+  {  8702,  20,  35,  22,    2,  -34 },   // 0xb8 '0x0158' U+0158
+  {  8790,  21,  36,  25,    2,  -35 },   // 0xb9 '0x016E' U+016E
+  {  8885,  21,  34,  25,    2,  -33 },   // 0xba '0x00DA' U+00DA
+  {  8975,  21,  34,  25,    2,  -33 },   // 0xbb '0x0170' U+0170
+  {  9065,  21,  34,  25,    2,  -33 },   // 0xbc '0x00DC' U+00DC
+  {  9155,  23,  34,  25,    1,  -33 },   // 0xbd '0x00DD' U+00DD
+  {  9253,  21,  34,  23,    1,  -25 },   // 0xbe '0x0162' U+0162
+  {  9343,  20,  26,  23,    2,  -25 },   // 0xbf '0x00DF' U+00DF
+  {  9408,  12,  27,  14,    2,  -26 },   // 0xc0 '0x0155' U+0155
+  {  9449,  17,  28,  20,    1,  -27 },   // 0xc1 '0x00E1' U+00E1
+  {  9509,  17,  29,  20,    1,  -28 },   // 0xc2 '0x00E2' U+00E2
+  {  9571,  17,  28,  20,    1,  -27 },   // 0xc3 '0x0103' U+0103
+  {  9631,  17,  28,  20,    1,  -27 },   // 0xc4 '0x00E4' U+00E4
+  {  9691,   8,  34,   9,    2,  -33 },   // 0xc5 '0x013A' U+013A
+  {  9725,  18,  28,  20,    1,  -27 },   // 0xc6 '0x0107' U+0107
+  {  9788,  18,  28,  20,    1,  -19 },   // 0xc7 '0x00E7' U+00E7
+  {  9851,  18,  28,  20,    1,  -27 },   // 0xc8 '0x010D' U+010D
+  {  9914,  18,  28,  20,    1,  -27 },   // 0xc9 '0x00E9' U+00E9
+  {  9977,  18,  27,  20,    1,  -19 },   // 0xca '0x0119' U+0119
+  { 10038,  18,  28,  20,    1,  -27 },   // 0xcb '0x00EB' U+00EB
+  { 10101,  18,  29,  20,    1,  -28 },   // 0xcc '0x011B' U+011B
+  { 10167,   8,  27,   9,    2,  -26 },   // 0xcd '0x00ED' U+00ED
+  { 10194,  13,  28,   9,   -2,  -27 },   // 0xce '0x00EE' U+00EE
+  { 10240,  25,  28,  25,    1,  -27 },   // 0xcf '0x010F' U+010F
+  { 10328,  21,  26,  21,    1,  -25 },   // 0xd0 '0x0111' U+0111
+  { 10397,  18,  27,  22,    2,  -26 },   // 0xd1 '0x0144' U+0144
+  { 10458,  18,  28,  22,    2,  -27 },   // 0xd2 '0x0148' U+0148
+  { 10521,  19,  28,  21,    1,  -27 },   // 0xd3 '0x00F3' U+00F3
+  { 10588,  19,  29,  21,    1,  -28 },   // 0xd4 '0x00F4' U+00F4
+  { 10657,  19,  28,  21,    1,  -27 },   // 0xd5 '0x0151' U+0151
+  { 10724,  19,  28,  21,    1,  -27 },   // 0xd6 '0x00F6' U+00F6
+  { 10791,  18,  20,  24,    3,  -19 },   // 0xd7 '0x00F7' U+00F7
+  { 10836,  14,  28,  14,    1,  -27 },   // 0xd8 '0x0159' U+0159
+  { 10885,  18,  30,  22,    2,  -29 },   // 0xd9 '0x016F' U+016F
+  { 10953,  18,  28,  22,    2,  -27 },   // 0xda '0x00FA' U+00FA
+  { 11016,  19,  27,  22,    2,  -26 },   // 0xdb '0x0171' U+0171
+  { 11081,  18,  28,  22,    2,  -27 },   // 0xdc '0x00FC' U+00FC
+  { 11144,  20,  35,  20,    0,  -27 },   // 0xdd '0x00FD' U+00FD
+  { 11232,  13,  33,  13,    0,  -24 },   // 0xde '0x0163' U+0163
+  { 11286,   6,   5,  10,    2,  -26 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_Bold18pt8b PROGMEM = {
+  (uint8_t  *)InterTight_Bold18pt8bBitmaps,
+  (GFXglyph *)InterTight_Bold18pt8bGlyphs,
+  0x20, 0xDF, 43 };
+
+// Approx. 12641 bytes
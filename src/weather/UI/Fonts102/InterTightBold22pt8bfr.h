@@ -0,0 +1,1604 @@
+// Subset of ../InterTightBold22pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_Bold22pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x71,
+  0xF7, 0xFF, 0xFF, 0xDF, 0x1C, 0xFC, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF, 0xE3,
+  0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0xF8, 0xFF,
+  0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0xE0, 0x00, 0xF8, 0x1F, 0x00, 0x1F, 0x03,
+  0xE0, 0x03, 0xC0, 0x7C, 0x00, 0xF8, 0x1F, 0x00, 0x1F, 0x03, 0xE0, 0x03,
+  0xE0, 0x7C, 0x00, 0x7C, 0x0F, 0x80, 0x0F, 0x81, 0xF0, 0x3F, 0xFF, 0xFF,
+  0xE7, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE3, 0xFF,
+  0xFF, 0xFC, 0x07, 0xC0, 0xF8, 0x00, 0xF8, 0x1F, 0x00, 0x3E, 0x03, 0xC0,
+  0x07, 0xC0, 0xF8, 0x00, 0xF8, 0x1F, 0x00, 0x1F, 0x03, 0xE0, 0x7F, 0xFF,
+  0xFF, 0xCF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xE7,
+  0xFF, 0xFF, 0xF8, 0x0F, 0x81, 0xF0, 0x01, 0xF0, 0x3E, 0x00, 0x3E, 0x07,
+  0xC0, 0x0F, 0x80, 0xF8, 0x01, 0xF0, 0x3E, 0x00, 0x3E, 0x07, 0xC0, 0x07,
+  0xC0, 0xF8, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFF,
+  0x80, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x1F, 0xEE,
+  0xFF, 0x8F, 0xE7, 0x1F, 0xCF, 0xE3, 0x8F, 0xE7, 0xF1, 0xC3, 0xFB, 0xF8,
+  0xE0, 0x01, 0xFE, 0x70, 0x00, 0xFF, 0xB8, 0x00, 0x7F, 0xFC, 0x00, 0x1F,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x1C, 0xFF,
+  0x80, 0x0E, 0x1F, 0xFF, 0x87, 0x0F, 0xFF, 0xC3, 0x87, 0xFF, 0xE1, 0xC3,
+  0xFF, 0xF8, 0xE3, 0xFD, 0xFF, 0x77, 0xFC, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x01,
+  0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x0F,
+  0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0x87, 0xFF, 0x80, 0x3C, 0x1F, 0xFE,
+  0x01, 0xF0, 0xFC, 0xFC, 0x07, 0x83, 0xE1, 0xF0, 0x3C, 0x0F, 0x87, 0xC0,
+  0xF0, 0x3E, 0x1F, 0x07, 0x80, 0xF8, 0x7C, 0x3C, 0x03, 0xE1, 0xF0, 0xF0,
+  0x0F, 0x87, 0xC7, 0x80, 0x3F, 0x3F, 0x3E, 0x00, 0x7F, 0xF8, 0xF0, 0x01,
+  0xFF, 0xE7, 0x80, 0x03, 0xFF, 0x3E, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x07,
+  0x8F, 0xFC, 0x00, 0x3E, 0x7F, 0xF8, 0x00, 0xF1, 0xFF, 0xE0, 0x07, 0x8F,
+  0x8F, 0xC0, 0x3E, 0x3C, 0x1F, 0x00, 0xF0, 0xF0, 0x7C, 0x07, 0x83, 0xC1,
+  0xF0, 0x3E, 0x0F, 0x07, 0xC0, 0xF0, 0x3C, 0x1F, 0x07, 0x80, 0xF0, 0x7C,
+  0x1E, 0x03, 0xE3, 0xF0, 0xF0, 0x07, 0xFF, 0x87, 0x80, 0x1F, 0xFE, 0x1E,
+  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00,
+  0x3F, 0x8F, 0xC0, 0x07, 0xE0, 0xF8, 0x00, 0xFC, 0x1F, 0x00, 0x1F, 0x83,
+  0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x7F, 0x3F, 0x00, 0x07, 0xEF, 0xE0, 0x00,
+  0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
+  0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xC1, 0xF0, 0xFF, 0xFC, 0x3E, 0x3F,
+  0xFF, 0xC7, 0xCF, 0xF3, 0xFD, 0xF9, 0xFC, 0x3F, 0xBF, 0x3F, 0x83, 0xFF,
+  0xC7, 0xF0, 0x3F, 0xF8, 0xFE, 0x03, 0xFE, 0x1F, 0xE0, 0x3F, 0xC1, 0xFE,
+  0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+  0x03, 0xFF, 0xE7, 0xF0, 0x1F, 0xE0, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x7E, 0x0F, 0xE0, 0xFC, 0x1F,
+  0xC1, 0xFC, 0x1F, 0x83, 0xF8, 0x3F, 0x83, 0xF0, 0x7F, 0x07, 0xF0, 0x7F,
+  0x07, 0xF0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE,
+  0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0x7F, 0x07, 0xF0, 0x7F,
+  0x07, 0xF0, 0x3F, 0x83, 0xF8, 0x3F, 0x81, 0xFC, 0x1F, 0xC0, 0xFC, 0x0F,
+  0xE0, 0x7E, 0x07, 0xF0, 0xFE, 0x07, 0xE0, 0x7F, 0x03, 0xF0, 0x3F, 0x83,
+  0xF8, 0x1F, 0x81, 0xFC, 0x1F, 0xC1, 0xFC, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0,
+  0xFE, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0,
+  0xFE, 0x1F, 0xC1, 0xFC, 0x1F, 0xC3, 0xF8, 0x3F, 0x83, 0xF0, 0x7F, 0x07,
+  0xE0, 0xFE, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x87, 0x84,
+  0x79, 0xE7, 0x9F, 0x7B, 0xEF, 0xFF, 0xFC, 0xFF, 0xFC, 0x0F, 0xFC, 0x01,
+  0xFF, 0x01, 0xFF, 0xF1, 0xFF, 0xFF, 0x7D, 0xEF, 0x9E, 0x79, 0xE2, 0x1E,
+  0x10, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x00, 0xFC, 0x00, 0x03,
+  0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
+  0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F,
+  0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x7F, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7C, 0x7C, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x38, 0xFB, 0xFF, 0xFF, 0xEF,
+  0x8E, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7C,
+  0x00, 0x7C, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF8,
+  0x01, 0xF8, 0x01, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x0F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x3F, 0x00,
+  0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7C, 0x00,
+  0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xF8,
+  0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x07, 0xF8,
+  0x7F, 0x83, 0xFC, 0x0F, 0xF1, 0xFE, 0x01, 0xFE, 0x7F, 0x00, 0x3F, 0x9F,
+  0xC0, 0x0F, 0xE7, 0xF0, 0x03, 0xFB, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F,
+  0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00,
+  0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE,
+  0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xE7, 0xF0, 0x03, 0xF9, 0xFC, 0x00, 0xFE,
+  0x7F, 0x80, 0x7F, 0x8F, 0xF0, 0x3F, 0xC3, 0xFE, 0x1F, 0xE0, 0x7F, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0xFE, 0x07, 0xFC, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xF8, 0xFF, 0xC1, 0xFE, 0x03, 0xF8, 0x07,
+  0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC,
+  0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00,
+  0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F,
+  0x80, 0x7F, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0xC1, 0xFF,
+  0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xF0, 0x7F, 0x9F, 0xC0, 0x7F, 0x7F, 0x80,
+  0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00,
+  0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F,
+  0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+  0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF,
+  0xFC, 0x7F, 0x83, 0xFC, 0xFF, 0x01, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00,
+  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03,
+  0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
+  0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFF, 0x00, 0xFF, 0x7F, 0x83, 0xFE, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xFC, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x07,
+  0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
+  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xF0,
+  0x00, 0xFD, 0xFC, 0x00, 0x7E, 0x7F, 0x00, 0x1F, 0x9F, 0xC0, 0x0F, 0xC7,
+  0xF0, 0x07, 0xF1, 0xFC, 0x01, 0xF8, 0x7F, 0x00, 0xFC, 0x1F, 0xC0, 0x7F,
+  0x07, 0xF0, 0x1F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF0, 0x1F, 0xC1,
+  0xFC, 0x07, 0xF0, 0xFE, 0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xE0, 0x00, 0x0F,
+  0xC0, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC,
+  0x00, 0x03, 0xF8, 0xFC, 0x07, 0xE7, 0xFE, 0x0F, 0xDF, 0xFE, 0x1F, 0xFF,
+  0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0x87, 0xFC, 0x3E, 0x03, 0xF8, 0x00, 0x07,
+  0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
+  0xFF, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFE, 0x03, 0xF9, 0xFE, 0x1F, 0xF3,
+  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x00,
+  0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x01,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xFF, 0x0F, 0xF8, 0xFE, 0x03, 0xFC,
+  0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x1F, 0xC0, 0x00,
+  0x1F, 0xC1, 0xF8, 0x0F, 0xE3, 0xFF, 0x87, 0xF3, 0xFF, 0xE3, 0xFB, 0xFF,
+  0xF9, 0xFF, 0xFF, 0xFE, 0xFF, 0xE1, 0xFF, 0x7F, 0xC0, 0x7F, 0xBF, 0xC0,
+  0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x01, 0xFD, 0xFC,
+  0x00, 0xFE, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x1F, 0xC0, 0x7F, 0x8F,
+  0xF8, 0x7F, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0,
+  0x0F, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xF0, 0x00,
+  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFE,
+  0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00,
+  0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
+  0x80, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xFE, 0x3F, 0xC1, 0xFE, 0x7F, 0x80, 0xFF, 0x7F, 0x00, 0x7F, 0x7F, 0x00,
+  0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x3F, 0x80, 0xFE, 0x3F, 0xC1,
+  0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0x00, 0xFE, 0xFE, 0x00,
+  0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFF, 0x00, 0xFF, 0x7F, 0xC3, 0xFE, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x03, 0xFF,
+  0xFF, 0xC3, 0xFE, 0x1F, 0xF1, 0xFE, 0x03, 0xF9, 0xFE, 0x00, 0xFE, 0xFE,
+  0x00, 0x7F, 0x7F, 0x00, 0x3F, 0xBF, 0x80, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xE0, 0x07, 0xFF, 0xF8, 0x03, 0xFD, 0xFE, 0x03, 0xFE, 0xFF, 0x87, 0xFF,
+  0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xDF, 0xC7, 0xFF, 0xCF, 0xE1, 0xFF, 0xC7,
+  0xF0, 0x3F, 0x83, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0xFE, 0x00,
+  0xFE, 0x7F, 0x00, 0xFE, 0x3F, 0xC0, 0xFF, 0x1F, 0xF0, 0xFF, 0x07, 0xFF,
+  0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x01,
+  0xFC, 0x00, 0x38, 0xFB, 0xFF, 0xFF, 0xEF, 0x8E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0xFB, 0xFF, 0xFF, 0xEF, 0x8E, 0x00, 0x1C,
+  0x3E, 0x7F, 0x7F, 0x7F, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x7E, 0x7E, 0x7C, 0x7C, 0xFC,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xF0, 0x1F,
+  0xFF, 0x81, 0xFF, 0xF8, 0x1F, 0xFF, 0x03, 0xFF, 0xF0, 0x0F, 0xFE, 0x00,
+  0x3F, 0xE0, 0x00, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x1F,
+  0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x0F,
+  0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x07,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x03, 0x80, 0x00,
+  0x0F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x03,
+  0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
+  0xC0, 0x7F, 0xFE, 0x07, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x3F,
+  0xFC, 0x00, 0xFF, 0x80, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xC7, 0xFF, 0xFF, 0x3F, 0xC7, 0xFB, 0xFC, 0x1F, 0xFF, 0xC0,
+  0x7F, 0xFE, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x7C, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x07,
+  0xC0, 0x00, 0x1C, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
+  0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x07, 0xFC,
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0x01,
+  0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0xFE, 0x7C, 0x7C, 0x3F,
+  0x03, 0xFF, 0x7C, 0x3E, 0x7F, 0x0F, 0xFF, 0xFC, 0x3E, 0x7E, 0x1F, 0xFF,
+  0xFC, 0x3E, 0x7E, 0x1F, 0xFF, 0xFC, 0x1F, 0xFE, 0x3F, 0x83, 0xFC, 0x1F,
+  0xFC, 0x3F, 0x00, 0xFC, 0x1F, 0xFC, 0x7E, 0x00, 0xFC, 0x1F, 0xFC, 0x7C,
+  0x00, 0x7C, 0x1F, 0xFC, 0x7C, 0x00, 0x7C, 0x1F, 0xFC, 0x7C, 0x00, 0x7C,
+  0x1F, 0xFC, 0x7C, 0x00, 0x7C, 0x1F, 0xFC, 0x7C, 0x00, 0x7C, 0x1F, 0xFC,
+  0x7C, 0x00, 0x7C, 0x1F, 0xFC, 0x7E, 0x00, 0xFC, 0x3E, 0xFC, 0x3F, 0x00,
+  0xFC, 0x3E, 0x7E, 0x3F, 0x83, 0xFE, 0x7E, 0x7E, 0x1F, 0xFF, 0xFF, 0xFC,
+  0x7E, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0x0F, 0xFF, 0xBF, 0xF8, 0x3F, 0x87,
+  0xFF, 0x1F, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00,
+  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x04, 0x00, 0x07,
+  0xFF, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
+  0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
+  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0xFE, 0xFE, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x03, 0xF1, 0xF8, 0x00,
+  0x0F, 0xE3, 0xF8, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x3F, 0x07, 0xE0, 0x00,
+  0xFE, 0x0F, 0xE0, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0x1F, 0x80, 0x0F,
+  0xE0, 0x3F, 0x80, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0xFF,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0x80, 0x07, 0xF0, 0xFE, 0x00,
+  0x0F, 0xE1, 0xFC, 0x00, 0x1F, 0xC7, 0xF8, 0x00, 0x3F, 0xCF, 0xE0, 0x00,
+  0x3F, 0x9F, 0xC0, 0x00, 0x7F, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
+  0xFE, 0x03, 0xFE, 0xFE, 0x01, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE,
+  0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x01, 0xFC, 0xFE, 0x03, 0xF8,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFC, 0xFE, 0x03, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFF,
+  0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
+  0xFE, 0x00, 0xFF, 0xFE, 0x01, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xE0,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xC0, 0xFF, 0x87, 0xF8,
+  0x01, 0xFE, 0x7F, 0x80, 0x07, 0xF3, 0xFC, 0x00, 0x3F, 0x9F, 0xC0, 0x00,
+  0xFD, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x3F, 0x80, 0x01, 0xFD, 0xFE, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0xFE,
+  0x3F, 0xC0, 0x0F, 0xF1, 0xFF, 0x81, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+  0xF0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x03,
+  0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE1, 0xFC, 0x07,
+  0xFE, 0x3F, 0x80, 0x3F, 0xE7, 0xF0, 0x01, 0xFC, 0xFE, 0x00, 0x3F, 0xDF,
+  0xC0, 0x03, 0xFB, 0xF8, 0x00, 0x7F, 0x7F, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xFE,
+  0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xBF, 0x80, 0x07, 0xF7, 0xF0,
+  0x01, 0xFE, 0xFE, 0x00, 0x3F, 0x9F, 0xC0, 0x1F, 0xF3, 0xF8, 0x0F, 0xFC,
+  0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+  0xF8, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0x80, 0x00,
+  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE,
+  0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F,
+  0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00,
+  0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF,
+  0xFF, 0xEF, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
+  0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0,
+  0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F, 0xC0, 0xFF, 0x87, 0xF8,
+  0x03, 0xFE, 0x7F, 0x80, 0x0F, 0xF3, 0xFC, 0x00, 0x3F, 0x9F, 0xC0, 0x01,
+  0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
+  0x3F, 0xBF, 0x80, 0x01, 0xFD, 0xFE, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0xFE,
+  0x3F, 0xC0, 0x0F, 0xF1, 0xFF, 0x81, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+  0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF,
+  0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00,
+  0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF,
+  0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xF0,
+  0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80,
+  0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF8,
+  0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01,
+  0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0,
+  0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F,
+  0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00,
+  0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x7F,
+  0xFE, 0x03, 0xFF, 0xF8, 0x3F, 0x9F, 0xE3, 0xFC, 0xFF, 0xFF, 0xE3, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xE0, 0x3F, 0xFE, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x3F,
+  0xDF, 0xC0, 0x07, 0xFB, 0xF8, 0x01, 0xFE, 0x7F, 0x00, 0x7F, 0x8F, 0xE0,
+  0x1F, 0xE1, 0xFC, 0x07, 0xF8, 0x3F, 0x80, 0xFE, 0x07, 0xF0, 0x3F, 0xC0,
+  0xFE, 0x0F, 0xF0, 0x1F, 0xC3, 0xFC, 0x03, 0xF8, 0xFF, 0x00, 0x7F, 0x1F,
+  0xC0, 0x0F, 0xE7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x07,
+  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
+  0x00, 0x7F, 0xEF, 0xF0, 0x0F, 0xF9, 0xFE, 0x01, 0xFE, 0x1F, 0xE0, 0x3F,
+  0x81, 0xFE, 0x07, 0xF0, 0x3F, 0xC0, 0xFE, 0x03, 0xFC, 0x1F, 0xC0, 0x3F,
+  0xC3, 0xF8, 0x07, 0xF8, 0x7F, 0x00, 0x7F, 0x8F, 0xE0, 0x07, 0xF9, 0xFC,
+  0x00, 0xFF, 0x3F, 0x80, 0x0F, 0xF7, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
+  0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
+  0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
+  0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0xF8, 0x07, 0xDF,
+  0xFF, 0xBF, 0x03, 0xF7, 0xFF, 0xEF, 0xC0, 0xFD, 0xFF, 0xF9, 0xF0, 0x7E,
+  0x7F, 0xFE, 0x7E, 0x1F, 0x9F, 0xFF, 0x9F, 0x87, 0xC7, 0xFF, 0xE3, 0xF3,
+  0xF1, 0xFF, 0xF8, 0xFC, 0xFC, 0x7F, 0xFE, 0x1F, 0x7E, 0x1F, 0xFF, 0x87,
+  0xFF, 0x87, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 0xFE,
+  0x0F, 0xFC, 0x1F, 0xFF, 0x83, 0xFE, 0x07, 0xFF, 0xE0, 0x7F, 0x81, 0xFF,
+  0xF8, 0x1F, 0xE0, 0x7F, 0xFE, 0x03, 0xF0, 0x1F, 0xFF, 0x80, 0xFC, 0x07,
+  0xFF, 0xE0, 0x3F, 0x01, 0xFF, 0xF8, 0x07, 0x80, 0x7F, 0xFC, 0x00, 0x1F,
+  0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80,
+  0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+  0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xFC, 0x1F, 0xFF, 0xBF, 0x87, 0xFF, 0xE7, 0xE1, 0xFF, 0xF9, 0xFC,
+  0x7F, 0xFE, 0x3F, 0x9F, 0xFF, 0x87, 0xE7, 0xFF, 0xE1, 0xFD, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+  0xF8, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0,
+  0x01, 0xFF, 0xF8, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xF0,
+  0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0,
+  0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x7F,
+  0x80, 0x07, 0xF9, 0xFE, 0x00, 0x1F, 0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0xC0,
+  0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFD,
+  0xFC, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x7F, 0x9F, 0xE0, 0x01, 0xFE, 0x3F,
+  0xC0, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0xC1, 0xFF, 0xFF, 0xFE, 0x03, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFE, 0x03, 0xFE, 0xFE,
+  0x01, 0xFE, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0xFF, 0xFE, 0x01, 0xFE, 0xFE, 0x03, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFE,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xF0,
+  0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0,
+  0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x7F,
+  0x80, 0x07, 0xF9, 0xFE, 0x00, 0x1F, 0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0xC0,
+  0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFD,
+  0xFC, 0x1F, 0x8F, 0xE7, 0xF8, 0x3F, 0x7F, 0x9F, 0xE0, 0x7F, 0xFE, 0x3F,
+  0xC0, 0xFF, 0xF0, 0xFF, 0xC3, 0xFF, 0xC1, 0xFF, 0xFF, 0xFE, 0x03, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xFE, 0x00, 0x07, 0xF9, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07,
+  0xE0, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xFF, 0xC7, 0xF0, 0x1F, 0xF3, 0xF8, 0x03, 0xF9, 0xFC,
+  0x01, 0xFE, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x3F, 0xBF, 0x80, 0x1F, 0xDF,
+  0xC0, 0x0F, 0xEF, 0xE0, 0x07, 0xF7, 0xF0, 0x07, 0xFB, 0xF8, 0x03, 0xF9,
+  0xFC, 0x07, 0xFC, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE,
+  0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x07, 0xF0, 0x7F, 0x03, 0xF8, 0x1F,
+  0xC1, 0xFC, 0x0F, 0xE0, 0xFE, 0x03, 0xF8, 0x7F, 0x01, 0xFC, 0x3F, 0x80,
+  0x7F, 0x1F, 0xC0, 0x3F, 0xCF, 0xE0, 0x0F, 0xE7, 0xF0, 0x07, 0xFB, 0xF8,
+  0x01, 0xFD, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE1, 0xFE, 0x0F, 0xF8,
+  0xFE, 0x01, 0xFC, 0xFE, 0x00, 0xFE, 0x7F, 0x00, 0x3F, 0xBF, 0x80, 0x00,
+  0x1F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF,
+  0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
+  0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF,
+  0x80, 0x3F, 0xDF, 0xF0, 0x7F, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07,
+  0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF,
+  0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07,
+  0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80,
+  0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF,
+  0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F,
+  0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00,
+  0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x7F,
+  0x80, 0x7F, 0x9F, 0xF0, 0x3F, 0xE3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC,
+  0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFE,
+  0x00, 0xFF, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x07,
+  0xF3, 0xFC, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x7F,
+  0x07, 0xF0, 0x01, 0xFC, 0x0F, 0xE0, 0x03, 0xF8, 0x1F, 0xC0, 0x07, 0xF0,
+  0x1F, 0xC0, 0x1F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x00, 0x7F, 0x00,
+  0x7F, 0x01, 0xFC, 0x00, 0xFE, 0x03, 0xF8, 0x01, 0xFC, 0x07, 0xF0, 0x01,
+  0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x3F, 0x80, 0x07, 0xF0, 0x7F, 0x00, 0x07,
+  0xF1, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x1F,
+  0x8F, 0xC0, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F,
+  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
+  0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xEF, 0xE0,
+  0x07, 0xF0, 0x01, 0xFD, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xBF, 0x80, 0x1F,
+  0xE0, 0x0F, 0xE7, 0xF0, 0x07, 0xFC, 0x01, 0xFC, 0x7F, 0x00, 0xFF, 0x80,
+  0x3F, 0x8F, 0xE0, 0x1F, 0xF8, 0x07, 0xF1, 0xFC, 0x03, 0xFF, 0x01, 0xFC,
+  0x3F, 0x80, 0xFF, 0xE0, 0x3F, 0x83, 0xF8, 0x1F, 0xFC, 0x07, 0xF0, 0x7F,
+  0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xE0, 0x7F, 0xF8, 0x3F, 0x80, 0xFC, 0x1F,
+  0xBF, 0x07, 0xF0, 0x1F, 0xC3, 0xF3, 0xE0, 0xFE, 0x03, 0xF8, 0x7E, 0x7E,
+  0x1F, 0x80, 0x7F, 0x0F, 0x8F, 0xC7, 0xF0, 0x07, 0xE3, 0xF1, 0xF8, 0xFE,
+  0x00, 0xFE, 0x7E, 0x1F, 0x1F, 0xC0, 0x1F, 0xCF, 0xC3, 0xF3, 0xF0, 0x01,
+  0xF9, 0xF0, 0x7E, 0x7E, 0x00, 0x3F, 0x7E, 0x07, 0xDF, 0xC0, 0x07, 0xEF,
+  0xC0, 0xFB, 0xF0, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x0F, 0xFE, 0x03,
+  0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x07, 0xFE,
+  0x00, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00,
+  0x0F, 0xF8, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
+  0xC0, 0x07, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x0F,
+  0xF7, 0xF0, 0x01, 0xFE, 0x7F, 0x80, 0x1F, 0xC3, 0xF8, 0x03, 0xFC, 0x3F,
+  0xC0, 0x3F, 0x81, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0xFF, 0x00, 0xFF, 0x0F,
+  0xE0, 0x07, 0xF1, 0xFE, 0x00, 0x7F, 0x9F, 0xC0, 0x03, 0xFB, 0xFC, 0x00,
+  0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3F,
+  0xBF, 0xC0, 0x07, 0xF9, 0xFC, 0x00, 0x7F, 0x1F, 0xE0, 0x0F, 0xF0, 0xFE,
+  0x00, 0xFE, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x83, 0xFC, 0x03, 0xF8, 0x3F,
+  0x80, 0x3F, 0xC7, 0xF8, 0x01, 0xFE, 0xFF, 0x00, 0x1F, 0xEF, 0xE0, 0x00,
+  0xFF, 0x7F, 0x00, 0x01, 0xFC, 0xFF, 0x00, 0x07, 0xF8, 0xFE, 0x00, 0x0F,
+  0xE1, 0xFE, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x7F, 0x01, 0xFC, 0x01, 0xFC,
+  0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x0F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0,
+  0x07, 0xF0, 0x7F, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
+  0x1F, 0xEF, 0xF0, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
+  0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFE, 0x00,
+  0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+  0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
+  0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01,
+  0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F,
+  0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC,
+  0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F,
+  0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87,
+  0xF0, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC,
+  0x00, 0xFC, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x3E,
+  0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x1F,
+  0x80, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x07,
+  0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x03,
+  0xF0, 0x01, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0xF8, 0x00,
+  0xFC, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x7E, 0x00,
+  0x3E, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xC3,
+  0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8,
+  0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F,
+  0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F,
+  0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xF0, 0x00,
+  0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x1F, 0x78, 0x03,
+  0xEF, 0x80, 0x78, 0xF0, 0x1F, 0x1F, 0x03, 0xC1, 0xE0, 0xF8, 0x3E, 0x1F,
+  0x07, 0xC7, 0xC0, 0x7C, 0xF8, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x3F, 0x0F,
+  0x83, 0xE1, 0xF0, 0x7C, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0x83, 0xFD, 0xF8, 0x0F, 0xE0, 0x40,
+  0x7F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xFE, 0x3F, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xBF, 0xF1, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03,
+  0xFF, 0xF0, 0x3F, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF,
+  0xFD, 0xFC, 0xFF, 0xCF, 0xE1, 0xF8, 0x7F, 0xFE, 0x00, 0x01, 0xFC, 0x00,
+  0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00,
+  0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x1F, 0x81, 0xFC, 0xFF, 0xC3,
+  0xFB, 0xFF, 0xC7, 0xF7, 0xFF, 0xCF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xBF,
+  0xC0, 0x7F, 0x7F, 0x80, 0xFE, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8,
+  0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
+  0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFD, 0xFF, 0x03, 0xFB, 0xFF, 0x1F,
+  0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x9F, 0xDF, 0xFE, 0x3F, 0x9F, 0xF8,
+  0x7F, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFE, 0x07,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0x0F, 0xE7, 0xF8, 0x1F, 0xDF, 0xC0,
+  0x3F, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00,
+  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0x7F,
+  0x00, 0xFD, 0xFE, 0x07, 0xF3, 0xFC, 0x3F, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE,
+  0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
+  0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x03, 0xF0, 0xFE, 0x1F,
+  0xF9, 0xFC, 0x7F, 0xFB, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEF, 0xF8,
+  0x7F, 0xDF, 0xC0, 0x7F, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01,
+  0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F,
+  0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x01, 0xFE, 0xFF, 0x03, 0xFD,
+  0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xEF, 0xE3, 0xFF, 0xDF, 0xC3,
+  0xFF, 0x3F, 0x81, 0xF8, 0x7F, 0x00, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF,
+  0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF1, 0xFE, 0x0F, 0xE7, 0xF0, 0x1F,
+  0x9F, 0xC0, 0x3F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0x7F, 0x00, 0xFD, 0xFC, 0x07, 0xF7, 0xFC, 0x3F, 0x8F, 0xFF, 0xFE,
+  0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x3F, 0x80, 0x00,
+  0x7F, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0x7F, 0x80,
+  0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF,
+  0xEF, 0xFF, 0xF7, 0xFF, 0xF8, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+  0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80,
+  0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE,
+  0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x03, 0xF0,
+  0xFE, 0x0F, 0xF9, 0xFC, 0x7F, 0xFB, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+  0xEF, 0xF8, 0xFF, 0xDF, 0xE0, 0xFF, 0xBF, 0x80, 0xFF, 0xFF, 0x01, 0xFF,
+  0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFE, 0xFE,
+  0x03, 0xFD, 0xFF, 0x1F, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF,
+  0xDF, 0xC3, 0xFF, 0x3F, 0x81, 0xF8, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01,
+  0xFD, 0xF8, 0x07, 0xFB, 0xF8, 0x1F, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+  0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x03,
+  0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8,
+  0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x1F, 0x83, 0xF9, 0xFF,
+  0x8F, 0xEF, 0xFF, 0x3F, 0xBF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFE, 0x1F, 0xFF,
+  0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0,
+  0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F,
+  0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF,
+  0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0x39, 0xFF, 0xFF, 0xFF, 0xC7, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0x81, 0xFC, 0x3F, 0x87, 0xF0,
+  0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x87, 0xF0, 0xFE,
+  0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F,
+  0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3,
+  0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF1, 0xFF, 0xFF, 0xBF, 0xF7,
+  0xFC, 0xFF, 0x1F, 0x80, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00,
+  0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
+  0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0xFC, 0x07, 0xF3, 0xF8, 0x1F, 0xC7,
+  0xF0, 0x7F, 0x8F, 0xE0, 0xFE, 0x1F, 0xC3, 0xF8, 0x3F, 0x8F, 0xE0, 0x7F,
+  0x3F, 0xC0, 0xFE, 0xFF, 0x01, 0xFD, 0xFC, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x7F, 0xBF,
+  0xC0, 0xFE, 0x3F, 0xC1, 0xFC, 0x3F, 0x83, 0xF8, 0x7F, 0x87, 0xF0, 0x7F,
+  0x8F, 0xE0, 0x7F, 0x1F, 0xC0, 0xFF, 0x3F, 0x80, 0xFF, 0x7F, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x80, 0xFC, 0x1F, 0xCF, 0xF8, 0x7F,
+  0xE3, 0xFB, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xFF, 0x1F, 0xFC, 0x7F, 0xFF, 0xC1, 0xFF, 0x07, 0xFF, 0xF0,
+  0x1F, 0xC0, 0x7F, 0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0x01, 0xFF,
+  0xF8, 0x0F, 0xE0, 0x3F, 0xFF, 0x01, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0x80,
+  0xFF, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xF0, 0x1F,
+  0xC0, 0x7F, 0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0x01, 0xFF, 0xF8,
+  0x0F, 0xE0, 0x3F, 0xFF, 0x01, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0x80, 0xFF,
+  0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xC0,
+  0x7F, 0xFE, 0x1F, 0x83, 0xF9, 0xFF, 0x8F, 0xEF, 0xFF, 0x3F, 0xBF, 0xFE,
+  0xFF, 0xFF, 0xFB, 0xFE, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE,
+  0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01,
+  0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF,
+  0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0x00, 0xFE, 0x00, 0x0F, 0xFF,
+  0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xF8, 0xFF,
+  0x9F, 0xC0, 0x7F, 0x3F, 0x80, 0xFE, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF,
+  0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x80, 0x3F, 0xFF, 0x00, 0x7F, 0x7F, 0x01, 0xFC, 0xFE, 0x03, 0xF9, 0xFF,
+  0x1F, 0xE1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x01, 0xFF, 0xFC, 0x01, 0xFF,
+  0xF0, 0x00, 0x7F, 0x00, 0xFE, 0x1F, 0x81, 0xFC, 0xFF, 0xC3, 0xFB, 0xFF,
+  0xC7, 0xF7, 0xFF, 0xCF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xBF, 0xC0, 0x7F,
+  0x7F, 0x80, 0xFE, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF,
+  0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF,
+  0x00, 0x7F, 0xFF, 0x01, 0xFD, 0xFF, 0x03, 0xFB, 0xFF, 0x1F, 0xF7, 0xFF,
+  0xFF, 0xCF, 0xFF, 0xFF, 0x9F, 0xDF, 0xFE, 0x3F, 0x9F, 0xF8, 0x7F, 0x0F,
+  0xC0, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+  0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x1F, 0xF9, 0xFC, 0x7F, 0xFB, 0xF9,
+  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEF, 0xF8, 0xFF, 0xDF, 0xC0, 0x7F, 0xFF,
+  0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0,
+  0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00,
+  0x7F, 0xFF, 0x01, 0xFE, 0xFE, 0x07, 0xFD, 0xFF, 0x1F, 0xF9, 0xFF, 0xFF,
+  0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xDF, 0xC3, 0xFF, 0x3F, 0x81, 0xF8, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00,
+  0x00, 0xFE, 0xFE, 0x3F, 0xFC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x3F, 0xC0, 0x7F, 0x80, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0,
+  0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03,
+  0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0x01,
+  0xFE, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF9, 0xFE, 0x0F, 0xE7, 0xF0, 0x1F, 0x9F, 0xC0, 0x00, 0x7F, 0x80, 0x01,
+  0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x01, 0xFD, 0xFC, 0x07,
+  0xF7, 0xF8, 0x3F, 0xDF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0,
+  0x1F, 0xC0, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F,
+  0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F,
+  0xE0, 0x7F, 0xF0, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x07, 0xF0, 0xFE, 0x01,
+  0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF,
+  0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07,
+  0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xF8, 0x7F, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0xFF, 0xF7, 0xF1, 0xFF,
+  0x9F, 0xC1, 0xF8, 0x7F, 0xFE, 0x00, 0x7F, 0x7E, 0x00, 0x7E, 0x7F, 0x00,
+  0xFE, 0x7F, 0x00, 0xFE, 0x3F, 0x00, 0xFC, 0x3F, 0x80, 0xFC, 0x3F, 0x81,
+  0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0xC3, 0xF8, 0x0F, 0xC3,
+  0xF0, 0x0F, 0xC3, 0xF0, 0x0F, 0xE3, 0xF0, 0x07, 0xE7, 0xE0, 0x07, 0xE7,
+  0xE0, 0x07, 0xE7, 0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+  0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0xFE, 0x03, 0xF8, 0x07, 0xEF, 0xC0, 0x7F, 0x01,
+  0xFD, 0xF8, 0x0F, 0xF0, 0x3F, 0xBF, 0x81, 0xFE, 0x07, 0xE7, 0xF0, 0x7F,
+  0xC0, 0xFC, 0x7E, 0x0F, 0xF8, 0x3F, 0x8F, 0xC1, 0xFF, 0x87, 0xF1, 0xF8,
+  0x3F, 0xF0, 0xFC, 0x3F, 0x8F, 0xFE, 0x1F, 0x83, 0xF1, 0xF7, 0xC3, 0xF0,
+  0x7E, 0x3E, 0xFC, 0xFE, 0x0F, 0xC7, 0xCF, 0x9F, 0x81, 0xFC, 0xF9, 0xF3,
+  0xF0, 0x1F, 0xBE, 0x3E, 0x7E, 0x03, 0xF7, 0xC7, 0xFF, 0x80, 0x7E, 0xF8,
+  0x7F, 0xF0, 0x07, 0xFF, 0x0F, 0xFE, 0x00, 0xFF, 0xC1, 0xFF, 0xC0, 0x1F,
+  0xF8, 0x3F, 0xF0, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
+  0x07, 0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x1F,
+  0xC0, 0x7F, 0x00, 0xFE, 0xFE, 0x03, 0xF8, 0xFE, 0x07, 0xF0, 0xFC, 0x1F,
+  0xC1, 0xFC, 0x3F, 0x01, 0xF8, 0xFE, 0x03, 0xF9, 0xF8, 0x03, 0xF7, 0xF0,
+  0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
+  0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x07,
+  0xEF, 0xE0, 0x1F, 0xCF, 0xC0, 0x3F, 0x1F, 0xC0, 0xFE, 0x1F, 0x83, 0xF8,
+  0x3F, 0x87, 0xF0, 0x3F, 0x9F, 0xC0, 0x3F, 0x3F, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x3F, 0x00,
+  0xFC, 0x3F, 0x01, 0xFC, 0x3F, 0x81, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x81,
+  0xF8, 0x1F, 0xC3, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3,
+  0xF0, 0x07, 0xE7, 0xE0, 0x07, 0xE7, 0xE0, 0x07, 0xE7, 0xE0, 0x03, 0xFF,
+  0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF,
+  0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x11, 0xFC, 0x00, 0x1F, 0xFC,
+  0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x00,
+  0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00,
+  0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x80,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x3F, 0x00, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x07,
+  0xF8, 0x07, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0xFF, 0xC0, 0xFF,
+  0xC0, 0xFF, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x0F,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x03, 0xFF, 0x03,
+  0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0xFF,
+  0x00, 0x3F, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0xF8, 0x07, 0xF0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x80,
+  0xFF, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xC0, 0x7C, 0xFF, 0xC0,
+  0xFB, 0xFF, 0xC1, 0xF7, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0xBE, 0x0F, 0xFF,
+  0x7C, 0x0F, 0xFC, 0xF8, 0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
+  0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
+  0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x01, 0xFD, 0xFC,
+  0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x1F, 0xC7, 0xF0,
+  0x00, 0x3F, 0x07, 0xE0, 0x00, 0xFE, 0x0F, 0xE0, 0x01, 0xFC, 0x1F, 0xC0,
+  0x03, 0xF0, 0x1F, 0x80, 0x0F, 0xE0, 0x3F, 0x80, 0x1F, 0xC0, 0x7F, 0x00,
+  0x3F, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0x03,
+  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F,
+  0x80, 0x07, 0xF0, 0xFE, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x1F, 0xC7, 0xF8,
+  0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x7F, 0x7F, 0x80,
+  0x00, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
+  0x7C, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFB, 0xE3, 0xE7, 0xFF, 0xC7, 0xFF,
+  0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
+  0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
+  0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
+  0x0F, 0xE0, 0x00, 0x0F, 0xEE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00,
+  0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
+  0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
+  0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x03, 0xFC, 0x0C, 0x78, 0xFF,
+  0xF1, 0xEF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xE3, 0xFE, 0x07, 0xFC,
+  0x1F, 0x80, 0x1F, 0x81, 0xF0, 0x00, 0xF8, 0x3E, 0x00, 0x07, 0xC3, 0xC0,
+  0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x1E, 0x78, 0x00, 0x01,
+  0xE7, 0x80, 0x00, 0x1E, 0x78, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x1E, 0x78,
+  0x00, 0x01, 0xE7, 0x80, 0x00, 0x1E, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00,
+  0x3C, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0xF8, 0x1F, 0x80, 0x1F, 0x83,
+  0xFE, 0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFE, 0x38, 0xFF,
+  0xF1, 0xC1, 0x03, 0xFC, 0x08, 0x00, 0x1F, 0x0F, 0xE1, 0xF0, 0xFE, 0x1F,
+  0x0F, 0xE1, 0xF0, 0xFE, 0x1F, 0x0F, 0xE1, 0xF0, 0xFE, 0x1E, 0x0F, 0xE1,
+  0xE0, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03,
+  0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0,
+  0xFF, 0x07, 0xFC, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x7F, 0x3F, 0x80, 0x1F,
+  0xDF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF,
+  0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xEF, 0xF8, 0x3F, 0xE3, 0xFF, 0xFF, 0xF1,
+  0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0x80,
+  0x00, 0x03, 0xF8, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xE0, 0x7F, 0xFF, 0x83,
+  0xFF, 0xFC, 0x3F, 0x87, 0xF1, 0xF8, 0x1F, 0x8F, 0xC0, 0xFC, 0x7E, 0x00,
+  0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xC0, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0xF8, 0x7F, 0xF7, 0xC0, 0xFF,
+  0xFE, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x1F, 0xBF, 0xF0, 0xFC, 0xFF,
+  0xEF, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x1F, 0xF8,
+  0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xF9, 0xF8, 0x0F, 0xCF, 0xC0,
+  0x7E, 0x7F, 0x87, 0xF1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0x80,
+  0x7F, 0xF8, 0x00, 0xFE, 0x00, 0x38, 0x1E, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE,
+  0x7F, 0xFC, 0x7F, 0x38, 0x1E, 0x0F, 0xC1, 0xF8, 0x03, 0xF1, 0xF8, 0x00,
+  0xF8, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFC, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF,
+  0xE0, 0x7F, 0xFF, 0xF8, 0x7F, 0x83, 0xFE, 0x3F, 0x80, 0x7F, 0x3F, 0x80,
+  0x3F, 0x9F, 0xC0, 0x0F, 0xEF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFE,
+  0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0,
+  0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x3F,
+  0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x0F, 0xF7, 0xFC, 0x1F,
+  0xF1, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x07, 0xFF,
+  0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE1, 0xFE, 0x0F, 0xF8,
+  0xFE, 0x01, 0xFC, 0xFE, 0x00, 0x7E, 0x7F, 0x00, 0x3F, 0xBF, 0x80, 0x00,
+  0x1F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF,
+  0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
+  0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF,
+  0x80, 0x3F, 0xDF, 0xF0, 0x7F, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x1C, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x01, 0xF0, 0x7E, 0x00,
+  0x3E, 0x3F, 0x00, 0x07, 0xDF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xE0,
+  0x00, 0x07, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03,
+  0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
+  0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8,
+  0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0,
+  0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x81,
+  0xF8, 0x0F, 0xC3, 0xF0, 0x07, 0xE7, 0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01,
+  0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F,
+  0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFC,
+  0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
+  0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
+  0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE,
+  0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0,
+  0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xC0, 0x3F, 0xE0, 0xFF,
+  0xE3, 0xFF, 0xE7, 0xFF, 0xDF, 0x07, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F,
+  0xF0, 0x7D, 0xFF, 0xF3, 0xFF, 0xE3, 0xFF, 0x83, 0xFE, 0x01, 0xF0, 0x00,
+  0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F,
+  0xFF, 0xF1, 0xFC, 0x1F, 0xE7, 0xE0, 0x3F, 0x80, 0x80, 0xFE, 0x00, 0x03,
+  0xF8, 0x00, 0x1F, 0xE0, 0x3F, 0xFF, 0x87, 0xFF, 0xFE, 0x3F, 0xFF, 0xF9,
+  0xFF, 0x8F, 0xEF, 0xF0, 0x3F, 0xBF, 0x80, 0xFE, 0xFE, 0x03, 0xFB, 0xF8,
+  0x1F, 0xEF, 0xF0, 0xFF, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF9, 0xFF, 0xEF,
+  0xE3, 0xFF, 0x3F, 0x83, 0xF0, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x00,
+  0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0x7C, 0x10, 0x1F, 0x1F, 0xDF, 0x8F, 0x87, 0xC3, 0xE1,
+  0xFE, 0x7F, 0x3F, 0xC7, 0xC0, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81,
+  0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F,
+  0x91, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xC7, 0xFE, 0x27, 0xF0,
+  0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07,
+  0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x3F, 0x1F, 0x8F,
+  0x8F, 0x87, 0x87, 0xC0, 0x00, 0x7F, 0xF9, 0xFF, 0xE7, 0xFF, 0x9F, 0xFE,
+  0x7F, 0xF9, 0xFF, 0xE7, 0xFF, 0x9E, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F,
+  0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F,
+  0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03,
+  0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
+  0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0x80, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xE7, 0xF8, 0x3F, 0x9F, 0xC0, 0x7E, 0x7F, 0x00,
+  0x01, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xF8,
+  0x07, 0xF7, 0xF0, 0x1F, 0xDF, 0xE0, 0xFF, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF,
+  0xE1, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0xFC, 0x1F, 0xBF,
+  0x1F, 0x8F, 0x9F, 0x83, 0xEF, 0x80, 0xFF, 0x80, 0x3F, 0x80, 0x0F, 0x80,
+  0x38, 0x78, 0x7E, 0x1F, 0x0F, 0x0F, 0x1F, 0xFE, 0xFC, 0xF0, 0x1F, 0x83,
+  0xF0, 0x3F, 0x1F, 0x80, 0x7C, 0xFC, 0x00, 0xFB, 0xE0, 0x01, 0xFF, 0x00,
+  0x03, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xC3, 0xFF, 0xFF, 0x9F, 0xE0, 0xFE, 0x7F, 0x01, 0xF9, 0xFC, 0x00, 0x07,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x1F,
+  0xDF, 0xC0, 0x7F, 0x7F, 0x83, 0xFD, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x87,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x3F,
+  0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF9, 0xFE, 0x0F,
+  0xE7, 0xF0, 0x1F, 0x9F, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x80, 0x03,
+  0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00,
+  0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x01, 0xFD, 0xFC, 0x07, 0xF7, 0xF8, 0x3F,
+  0xDF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00,
+  0x7F, 0x80, 0x00, 0x30, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x80,
+  0x00, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03,
+  0xE0, 0x01, 0xF0, 0x00, 0xF8, 0xFE, 0x78, 0x7F, 0x3C, 0x3F, 0x9E, 0x1F,
+  0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x1F, 0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0xE3,
+  0xFF, 0xF1, 0xFF, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8,
+  0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F,
+  0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00,
+  0x07, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x00, 0x1F, 0xC0, 0x03,
+  0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03,
+  0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x01,
+  0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC7, 0xC1, 0xF1,
+  0xF0, 0x7C, 0x7C, 0x1F, 0x1F, 0x07, 0xC3, 0xC0, 0xF0, 0xF8, 0x00, 0x7C,
+  0x0F, 0xC3, 0xE0, 0xF8, 0x1F, 0x1F, 0x01, 0xFB, 0xF0, 0x0F, 0xFE, 0x00,
+  0x7F, 0xC0, 0x03, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
+  0xE0, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
+  0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0xE0, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF0,
+  0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x00,
+  0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00,
+  0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00,
+  0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xF8, 0x0F, 0xF9, 0xFC, 0x01,
+  0xFC, 0xFE, 0x00, 0xFF, 0x7F, 0x00, 0x3F, 0xBF, 0x80, 0x1F, 0xDF, 0xC0,
+  0x0F, 0xEF, 0xE0, 0x07, 0xF7, 0xF0, 0x03, 0xFB, 0xF8, 0x03, 0xFD, 0xFC,
+  0x01, 0xFC, 0xFE, 0x03, 0xFE, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x1F,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x03, 0xF8, 0x3F, 0x81,
+  0xFC, 0x0F, 0xE0, 0xFE, 0x07, 0xF0, 0x7F, 0x01, 0xFC, 0x3F, 0x80, 0xFE,
+  0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x1F, 0xE7, 0xF0, 0x07, 0xF3, 0xF8, 0x03,
+  0xFD, 0xFC, 0x00, 0xFE, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07,
+  0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFC, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x07, 0xE3,
+  0xF0, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x7E, 0x0F,
+  0xC0, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x3F, 0x80, 0x07, 0xE0, 0x3F,
+  0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x7F, 0x00, 0xFE,
+  0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xE1,
+  0xFC, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x7F, 0x9F,
+  0xC0, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0xFE, 0xFF, 0x00, 0x01, 0xFE, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
+  0xFF, 0xC0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x7E,
+  0x0F, 0x80, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFE,
+  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFB, 0xF8,
+  0x00, 0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x3F, 0x8F, 0xE0,
+  0x00, 0x7F, 0x1F, 0xC0, 0x00, 0xFC, 0x1F, 0x80, 0x03, 0xF8, 0x3F, 0x80,
+  0x07, 0xF0, 0x7F, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+  0x7F, 0x01, 0xFC, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x07,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xFF, 0xC1, 0xFE, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x3F, 0x87, 0xF0,
+  0x00, 0x7F, 0x1F, 0xE0, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0xFE, 0x7F, 0x00,
+  0x01, 0xFD, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xF8, 0x3E, 0x00, 0x01, 0xF0,
+  0x7C, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+  0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+  0x00, 0xFD, 0xF8, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x07, 0xE3, 0xF0, 0x00,
+  0x0F, 0xC7, 0xE0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x7E, 0x0F, 0xC0, 0x01,
+  0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x3F, 0x80, 0x07, 0xE0, 0x3F, 0x00, 0x1F,
+  0xC0, 0x7F, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x7F, 0x01, 0xFC, 0x01, 0xFF,
+  0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0x1F, 0xC1, 0xFC, 0x00,
+  0x1F, 0xC3, 0xF8, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x7F, 0x9F, 0xC0, 0x00,
+  0x7F, 0x3F, 0x80, 0x00, 0xFE, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x78, 0x1E,
+  0x00, 0x03, 0xF8, 0xFE, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x0F, 0xE3, 0xF8,
+  0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00,
+  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x0F,
+  0xE3, 0xF8, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE,
+  0x0F, 0xE0, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x3F, 0x80, 0x0F, 0xE0,
+  0x3F, 0x80, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0xFE, 0x00,
+  0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0x0F,
+  0xE1, 0xFC, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x3F,
+  0x9F, 0xC0, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFE,
+  0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07,
+  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+  0xFF, 0x87, 0xFE, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF3, 0xFC, 0x00, 0x3F,
+  0x9F, 0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xEF, 0xF0, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xEF,
+  0xF0, 0x00, 0xFE, 0x7F, 0x80, 0x07, 0xF1, 0xFE, 0x00, 0x7F, 0x8F, 0xFC,
+  0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x7F,
+  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x7F,
+  0xC3, 0xFC, 0x01, 0xFE, 0x7F, 0x80, 0x0F, 0xE7, 0xF8, 0x00, 0x7F, 0x7F,
+  0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F,
+  0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x7F, 0x7F, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0xFE,
+  0x3F, 0xC0, 0x1F, 0xE3, 0xFF, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F,
+  0x3F, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+  0xFC, 0x3F, 0xF0, 0x3F, 0xE1, 0xFE, 0x00, 0x7F, 0x9F, 0xE0, 0x01, 0xFC,
+  0xFF, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x7F,
+  0x80, 0x07, 0xF3, 0xFC, 0x00, 0x3F, 0x8F, 0xF0, 0x03, 0xFC, 0x7F, 0xE0,
+  0x7F, 0xC1, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE,
+  0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00,
+  0x7C, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8,
+  0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
+  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0x80, 0x00,
+  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE,
+  0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0,
+  0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00,
+  0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x0E, 0x03,
+  0xC0, 0xFE, 0x3F, 0x83, 0xF8, 0xFE, 0x0F, 0xE3, 0xF8, 0x3F, 0x0F, 0xE0,
+  0x38, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
+  0x00, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0x3F, 0xFF, 0xFC, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x3F, 0x03, 0xE0, 0x7E, 0x1F, 0x80, 0xF8, 0xFC, 0x01,
+  0xF7, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x1E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFE,
+  0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
+  0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xF8,
+  0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
+  0xC7, 0xE1, 0xF0, 0xFC, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F,
+  0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8,
+  0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F,
+  0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
+  0xF8, 0xFE, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x03, 0xFE, 0x03, 0xFF, 0x83,
+  0xF7, 0xE3, 0xF1, 0xFB, 0xF0, 0x7D, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F,
+  0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00,
+  0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC,
+  0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+  0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80,
+  0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x7E, 0x07, 0xE0,
+  0x07, 0xE1, 0xF8, 0x00, 0x7E, 0x3E, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x7F,
+  0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x87,
+  0xF0, 0x1F, 0xF8, 0xFE, 0x00, 0xFF, 0x9F, 0xC0, 0x07, 0xF3, 0xF8, 0x00,
+  0xFF, 0x7F, 0x00, 0x0F, 0xEF, 0xE0, 0x01, 0xFD, 0xFC, 0x00, 0x1F, 0xFF,
+  0x80, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x01,
+  0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFC,
+  0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0xFE, 0xFE, 0x00, 0x1F,
+  0xDF, 0xC0, 0x07, 0xFB, 0xF8, 0x00, 0xFE, 0x7F, 0x00, 0x7F, 0xCF, 0xE0,
+  0x3F, 0xF1, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07,
+  0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
+  0xFF, 0xFF, 0xF0, 0x07, 0xF0, 0x1F, 0xF8, 0x07, 0xF0, 0x07, 0xFC, 0x07,
+  0xF0, 0x01, 0xFC, 0x07, 0xF0, 0x01, 0xFE, 0x07, 0xF0, 0x00, 0xFE, 0x07,
+  0xF0, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x7F, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0xFF, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x7F, 0x07,
+  0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0xFE, 0x07,
+  0xF0, 0x00, 0xFE, 0x07, 0xF0, 0x01, 0xFE, 0x07, 0xF0, 0x01, 0xFC, 0x07,
+  0xF0, 0x07, 0xFC, 0x07, 0xF0, 0x1F, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x07,
+  0xFF, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xFF,
+  0xE0, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x07,
+  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC,
+  0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF,
+  0xFF, 0x07, 0xFF, 0xEF, 0xE1, 0xFF, 0xF9, 0xF8, 0x7F, 0xFE, 0x7F, 0x1F,
+  0xFF, 0x8F, 0xE7, 0xFF, 0xE1, 0xF9, 0xFF, 0xF8, 0x7F, 0x7F, 0xFE, 0x0F,
+  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFE,
+  0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00,
+  0x7F, 0xFE, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0xF8, 0x00, 0xF8, 0x7E, 0x00,
+  0x3F, 0x3F, 0x00, 0x07, 0xCF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xE0,
+  0x00, 0x03, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF,
+  0xC0, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0xFB, 0xF8, 0x7F, 0xFE,
+  0x7E, 0x1F, 0xFF, 0x9F, 0xC7, 0xFF, 0xE3, 0xF9, 0xFF, 0xF8, 0x7E, 0x7F,
+  0xFE, 0x1F, 0xDF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8,
+  0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x01,
+  0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x0F, 0xFC, 0x3F, 0xC0,
+  0x0F, 0xF1, 0xFE, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x7F, 0x9F, 0xC0, 0x00,
+  0xFE, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x1F,
+  0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFC,
+  0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x3F, 0x9F, 0xE0, 0x01, 0xFE, 0x7F, 0x80,
+  0x07, 0xF8, 0xFF, 0x00, 0x3F, 0xC3, 0xFF, 0x03, 0xFF, 0x07, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0,
+  0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0xFC, 0xF8, 0x00, 0x07, 0xE1, 0xF0, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFE,
+  0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0,
+  0xFF, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x7F, 0x9F, 0xE0, 0x01, 0xFE, 0x7F,
+  0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80,
+  0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07,
+  0xFF, 0xF0, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0xFE, 0x7F, 0x80, 0x07, 0xF9,
+  0xFE, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0xFF, 0x0F, 0xFC, 0x0F, 0xFC, 0x1F,
+  0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF,
+  0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F,
+  0x87, 0xC0, 0x00, 0x7E, 0x3E, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x0F, 0x8F,
+  0x80, 0x00, 0x7C, 0x7C, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x0F, 0xFC, 0x3F, 0xC0,
+  0x0F, 0xF1, 0xFE, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x7F, 0x9F, 0xC0, 0x00,
+  0xFE, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x1F,
+  0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFC,
+  0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x3F, 0x9F, 0xE0, 0x01, 0xFE, 0x7F, 0x80,
+  0x07, 0xF8, 0xFF, 0x00, 0x3F, 0xC3, 0xFF, 0x03, 0xFF, 0x07, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0,
+  0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x70, 0x3C, 0x00,
+  0x07, 0xF3, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x7F, 0x3F, 0x80, 0x01,
+  0xF8, 0xFE, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x0F, 0xFC, 0x3F, 0xC0, 0x0F, 0xF1,
+  0xFE, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x7F, 0x9F, 0xC0, 0x00, 0xFE, 0xFF,
+  0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80,
+  0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F,
+  0xF7, 0xF0, 0x00, 0x3F, 0x9F, 0xE0, 0x01, 0xFE, 0x7F, 0x80, 0x07, 0xF8,
+  0xFF, 0x00, 0x3F, 0xC3, 0xFF, 0x03, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F,
+  0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x10, 0x00, 0x20, 0xE0, 0x01, 0xC7,
+  0xC0, 0x0F, 0x9F, 0x80, 0x7F, 0xFF, 0x03, 0xFD, 0xFE, 0x1F, 0xE3, 0xFC,
+  0xFF, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x3F, 0xF0,
+  0x00, 0x7F, 0x80, 0x03, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07,
+  0xFF, 0xF8, 0x3F, 0xCF, 0xF1, 0xFE, 0x1F, 0xEF, 0xF0, 0x3F, 0xDF, 0x80,
+  0x7E, 0x3C, 0x00, 0xF0, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x81,
+  0xF0, 0x07, 0xC1, 0xF0, 0x01, 0xF1, 0xF8, 0x00, 0xFD, 0xF8, 0x00, 0x3F,
+  0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x0F,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF1, 0xFC, 0x07, 0xFC,
+  0xFE, 0x00, 0xFE, 0x7F, 0x00, 0x7F, 0xBF, 0x80, 0x1F, 0xDF, 0xC0, 0x0F,
+  0xEF, 0xE0, 0x07, 0xF7, 0xF0, 0x03, 0xFB, 0xF8, 0x01, 0xFD, 0xFC, 0x01,
+  0xFE, 0xFE, 0x00, 0xFE, 0x7F, 0x01, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x81, 0xFC,
+  0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x7F, 0x03, 0xF8, 0x3F, 0x80, 0xFE, 0x1F,
+  0xC0, 0x7F, 0x0F, 0xE0, 0x1F, 0xC7, 0xF0, 0x0F, 0xF3, 0xF8, 0x03, 0xF9,
+  0xFC, 0x01, 0xFE, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x1E,
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0x87, 0x00, 0x00,
+  0xE1, 0xC0, 0x00, 0x38, 0x70, 0x00, 0x0F, 0x3C, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0,
+  0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF,
+  0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xF0, 0x03, 0xFD, 0xFE, 0x01, 0xFE, 0x7F, 0xC0, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x00,
+  0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F,
+  0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00,
+  0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE,
+  0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F,
+  0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00,
+  0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xDF, 0xE0, 0x1F, 0xE7, 0xFC, 0x0F, 0xF8,
+  0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3E, 0x3F, 0x00,
+  0x0F, 0x9F, 0x80, 0x07, 0xC7, 0xC0, 0x03, 0xE3, 0xE0, 0x00, 0xF1, 0xF0,
+  0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE,
+  0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F,
+  0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00,
+  0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xDF, 0xE0, 0x1F, 0xE7, 0xFC,
+  0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xC0,
+  0xF0, 0x01, 0xFC, 0xFE, 0x00, 0x7F, 0x3F, 0x80, 0x1F, 0xCF, 0xE0, 0x07,
+  0xE3, 0xF8, 0x00, 0x70, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00,
+  0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0,
+  0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF,
+  0xE0, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xDF, 0xE0, 0x1F,
+  0xE7, 0xFC, 0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+  0x00, 0x03, 0xF9, 0xFE, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x1F, 0xC3, 0xFC,
+  0x00, 0x7F, 0x83, 0xF8, 0x00, 0xFE, 0x03, 0xF8, 0x03, 0xF8, 0x07, 0xF0,
+  0x07, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x0F, 0xF0, 0x7F, 0x80, 0x0F, 0xE0,
+  0xFE, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x3F, 0xDF,
+  0xE0, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x07,
+  0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0F,
+  0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x7F,
+  0x87, 0xF8, 0xFF, 0x03, 0xFC, 0xFE, 0x01, 0xFC, 0xFE, 0x01, 0xFC, 0xFE,
+  0x01, 0xFC, 0xFE, 0x01, 0xFC, 0xFE, 0x01, 0xFC, 0xFE, 0x03, 0xF8, 0xFE,
+  0x07, 0xF0, 0xFE, 0x3F, 0xE0, 0xFE, 0x3F, 0x80, 0xFE, 0x3F, 0xF0, 0xFE,
+  0x3F, 0xF8, 0xFE, 0x3F, 0xFC, 0xFE, 0x01, 0xFE, 0xFE, 0x00, 0xFE, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x3F, 0xFE, 0xFE, 0x3F, 0xFC, 0xFE,
+  0x3F, 0xFC, 0xFE, 0x3F, 0xF0, 0xFE, 0x3F, 0xC0, 0x00, 0xF8, 0x03, 0xF0,
+  0x07, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xFC, 0x7F, 0xF9, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x7F, 0x80, 0xFF, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F,
+  0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0,
+  0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x01, 0xFF, 0xE0, 0x3F, 0xFF, 0xC1, 0xFF, 0xFF, 0x1F, 0xFF, 0xF9, 0xFC,
+  0x1F, 0xEF, 0xC0, 0x7F, 0x02, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x01, 0xFE,
+  0x07, 0xFF, 0xF1, 0xFF, 0xFF, 0x9F, 0xFF, 0xFD, 0xFF, 0x8F, 0xFF, 0xE0,
+  0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x81, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF, 0xEF, 0xE7, 0xFE, 0x7F, 0x0F, 0xC3,
+  0xF8, 0x00, 0x7C, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x00,
+  0x7C, 0xF8, 0x07, 0xE3, 0xE0, 0x7E, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xE0, 0xFF, 0x7E, 0x03, 0xF8, 0x10, 0x1F,
+  0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xEF, 0xFC, 0x7F, 0xFF, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF,
+  0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xFF,
+  0x7F, 0x3F, 0xF3, 0xF8, 0x7E, 0x1F, 0xC0, 0x1F, 0x01, 0xE0, 0x7C, 0x07,
+  0x80, 0xF8, 0x3C, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x07, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F,
+  0xFC, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE7, 0xF8, 0x3F,
+  0xDF, 0xC0, 0x7F, 0x02, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF7, 0xFF, 0x1F, 0xFF, 0xC0,
+  0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xC1, 0xFF,
+  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xDF, 0xC7, 0xFE, 0x7F, 0x07,
+  0xE1, 0xFC, 0x07, 0x81, 0xE0, 0xFE, 0x3F, 0x87, 0xF1, 0xFC, 0x3F, 0x8F,
+  0xE1, 0xFC, 0x7F, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xE0, 0x3F, 0xFF, 0xC3, 0xFF, 0xFF,
+  0x1F, 0xFF, 0xF9, 0xFC, 0x1F, 0xEF, 0xC0, 0x7F, 0x02, 0x03, 0xF8, 0x00,
+  0x1F, 0xC0, 0x01, 0xFE, 0x07, 0xFF, 0xF1, 0xFF, 0xFF, 0x9F, 0xFF, 0xFD,
+  0xFF, 0x8F, 0xFF, 0xE0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x81,
+  0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF, 0xEF, 0xE7,
+  0xFE, 0x7F, 0x0F, 0xC3, 0xF8, 0x0F, 0xC7, 0xE1, 0xF0, 0xFC, 0x3E, 0x1F,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
+  0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE,
+  0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F,
+  0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
+  0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3,
+  0xFC, 0x3F, 0x9F, 0xE0, 0x7F, 0x7F, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xE0,
+  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFF, 0x00, 0xFD, 0xFC, 0x03, 0xF7, 0xF8, 0x1F, 0xCF,
+  0xF0, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC0, 0xFF, 0xFE, 0x01, 0xFF,
+  0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFE,
+  0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0x0F, 0xE7, 0xF0, 0x1F, 0xDF,
+  0xC0, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x7F,
+  0x7F, 0x01, 0xFD, 0xFE, 0x07, 0xF3, 0xFC, 0x7F, 0x8F, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x30,
+  0x00, 0x00, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x83, 0xF0, 0x3F, 0x0F, 0x80, 0x7E, 0x7C, 0x00, 0xFB,
+  0xE0, 0x01, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF0, 0x0F,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF, 0x7F, 0x81,
+  0xFD, 0xFC, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03,
+  0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFC,
+  0x03, 0xF7, 0xF0, 0x0F, 0xDF, 0xE0, 0x7F, 0x3F, 0xC3, 0xF8, 0xFF, 0xFF,
+  0xE1, 0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
+  0x3C, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xF8, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xC7, 0xF8, 0x3F, 0x9F, 0xC0, 0x7E, 0x7F, 0x00, 0xFF, 0xF8,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x03, 0xF7,
+  0xF0, 0x1F, 0xDF, 0xF0, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC0, 0xFF,
+  0xFE, 0x01, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xFE,
+  0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF1, 0xFE, 0x0F, 0xE7,
+  0xF0, 0x1F, 0x9F, 0xC0, 0x3F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0x7F, 0x00, 0xFD, 0xFC, 0x07, 0xF7, 0xFC, 0x3F, 0x8F,
+  0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x3F,
+  0xC0, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00,
+  0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xC0, 0x07,
+  0x81, 0xE0, 0x7F, 0x1F, 0xC1, 0xFC, 0x7F, 0x07, 0xF1, 0xFC, 0x1F, 0xC7,
+  0xF0, 0x1E, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xC3, 0xFF, 0xFF, 0x1F, 0xE0, 0xFE, 0x7F, 0x01, 0xF9, 0xFC, 0x03,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0,
+  0x0F, 0xDF, 0xC0, 0x7F, 0x7F, 0xC3, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+  0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x1F, 0x83, 0xE0,
+  0x3F, 0x1F, 0x00, 0x7C, 0xFC, 0x00, 0xFB, 0xE0, 0x01, 0xFF, 0x00, 0x03,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0xC3,
+  0xFF, 0xFF, 0x1F, 0xE0, 0xFE, 0x7F, 0x01, 0xF9, 0xFC, 0x03, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x0F, 0xDF,
+  0xC0, 0x7F, 0x7F, 0xC3, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x03, 0xFF,
+  0xF8, 0x07, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xC7, 0xE1, 0xF0, 0xFC,
+  0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F,
+  0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
+  0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE,
+  0x00, 0x03, 0xE0, 0x03, 0xF8, 0x03, 0xFE, 0x03, 0xFF, 0x83, 0xF7, 0xE3,
+  0xF1, 0xFB, 0xF0, 0x7F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
+  0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+  0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80,
+  0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE,
+  0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x03,
+  0xF8, 0xF8, 0x00, 0x07, 0xF1, 0xE0, 0x00, 0x0F, 0xE3, 0xC0, 0x00, 0x1F,
+  0xC7, 0x80, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x7F, 0x1E, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x7F, 0xE7, 0xF0,
+  0x01, 0xFF, 0xEF, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80,
+  0x3F, 0xE1, 0xFF, 0x00, 0x7F, 0x01, 0xFE, 0x01, 0xFE, 0x03, 0xFC, 0x03,
+  0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x07, 0xF0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1F,
+  0xC0, 0x1F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0xFE,
+  0x00, 0xFE, 0x01, 0xFE, 0x01, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC,
+  0x0F, 0xF0, 0x07, 0xFC, 0x3F, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xBF, 0x80, 0x0F, 0xFF, 0x7F, 0x00, 0x0F, 0xFC, 0xFE, 0x00, 0x07, 0xE1,
+  0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x0F,
+  0xE0, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0xFE, 0x03, 0xFF, 0x3F, 0x81, 0xFF,
+  0xEF, 0xE0, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x1F, 0xF0, 0xFF, 0x87,
+  0xF0, 0x1F, 0xE3, 0xFC, 0x07, 0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0x80, 0x3F,
+  0x8F, 0xE0, 0x0F, 0xE3, 0xF8, 0x03, 0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0x80,
+  0x3F, 0x8F, 0xE0, 0x0F, 0xE3, 0xFC, 0x03, 0xF8, 0xFF, 0x01, 0xFE, 0x1F,
+  0xE0, 0x7F, 0x87, 0xFC, 0x3F, 0xE0, 0xFF, 0xFF, 0xF8, 0x3F, 0xFE, 0xFE,
+  0x07, 0xFF, 0xBF, 0x80, 0xFF, 0xCF, 0xE0, 0x0F, 0xC3, 0xF8, 0x00, 0x1F,
+  0x80, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
+  0x7E, 0x0F, 0xE7, 0xFE, 0x3F, 0xBF, 0xFC, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF,
+  0xEF, 0xF8, 0x7F, 0xFF, 0xC0, 0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF,
+  0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0,
+  0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F,
+  0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF,
+  0x80, 0x7F, 0xFE, 0x01, 0xFC, 0x3F, 0x03, 0xF0, 0x7E, 0x1F, 0x80, 0xFC,
+  0xFC, 0x01, 0xF3, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xF8, 0x3F,
+  0x9F, 0xF8, 0xFE, 0xFF, 0xF3, 0xFB, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xE1,
+  0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F,
+  0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE,
+  0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01,
+  0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF,
+  0xF8, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00,
+  0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x7F,
+  0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0x3F, 0x80,
+  0xFE, 0x7F, 0x01, 0xFD, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F,
+  0xFE, 0x00, 0xFE, 0xFE, 0x03, 0xF9, 0xFC, 0x07, 0xF3, 0xFE, 0x3F, 0xC3,
+  0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x00,
+  0xFE, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x1F,
+  0x7C, 0x00, 0x7E, 0xFC, 0x01, 0xF8, 0xFC, 0x07, 0xE0, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xFE,
+  0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x3F, 0xE3, 0xFE,
+  0x7F, 0x01, 0xFC, 0xFE, 0x03, 0xFB, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xFE,
+  0x00, 0xFF, 0xFC, 0x01, 0xFD, 0xFC, 0x07, 0xF3, 0xF8, 0x0F, 0xE7, 0xFC,
+  0x7F, 0x87, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x07, 0xFF,
+  0xC0, 0x01, 0xFC, 0x00, 0x00, 0x7C, 0x7C, 0x01, 0xF1, 0xF0, 0x07, 0xC7,
+  0xC0, 0x0F, 0x1F, 0x00, 0x3E, 0x3C, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0x00,
+  0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0x3F,
+  0x80, 0xFE, 0x7F, 0x01, 0xFD, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0,
+  0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00,
+  0x7F, 0xFE, 0x00, 0xFE, 0xFE, 0x03, 0xF9, 0xFC, 0x07, 0xF3, 0xFE, 0x3F,
+  0xC3, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xE0,
+  0x00, 0xFE, 0x00, 0x07, 0x01, 0xE0, 0x3F, 0x8F, 0xE0, 0x7F, 0x1F, 0xC0,
+  0xFE, 0x3F, 0x81, 0xF8, 0x7F, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F,
+  0xFE, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x3F, 0xE3,
+  0xFE, 0x7F, 0x01, 0xFC, 0xFE, 0x03, 0xFB, 0xF8, 0x03, 0xFF, 0xF0, 0x07,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F,
+  0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFD, 0xFC, 0x07, 0xF3, 0xF8, 0x0F, 0xE7,
+  0xFC, 0x7F, 0x87, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x07,
+  0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x70, 0x00, 0x03, 0xE0, 0x00, 0x1F,
+  0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00,
+  0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x1C, 0x00, 0xFC,
+  0x07, 0xDF, 0x83, 0xE3, 0xF1, 0xF0, 0x7E, 0xF8, 0x0F, 0xFE, 0x01, 0xFF,
+  0x00, 0x3F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xF8,
+  0xFE, 0x7E, 0x3F, 0xBF, 0x8F, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 0xC0, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0,
+  0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00,
+  0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F,
+  0x80, 0x0F, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0,
+  0x00, 0xF3, 0xC0, 0x03, 0x87, 0x00, 0x0E, 0x1C, 0x00, 0x38, 0x70, 0x00,
+  0x73, 0x80, 0x01, 0xFE, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F,
+  0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE,
+  0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01,
+  0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF,
+  0xF8, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xE1, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF,
+  0xFF, 0xF3, 0xFF, 0xDF, 0xC7, 0xFE, 0x7F, 0x07, 0xE1, 0xFC, 0x00, 0x1F,
+  0x80, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07,
+  0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF,
+  0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0,
+  0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xE1, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xDF, 0xC7,
+  0xFE, 0x7F, 0x07, 0xE1, 0xFC, 0x00, 0xF8, 0xFC, 0x01, 0xF1, 0xF0, 0x07,
+  0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0x7C, 0x7C, 0x00, 0xF1, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xFB, 0xF8, 0x07,
+  0xF7, 0xF0, 0x0F, 0xEF, 0xE0, 0x1F, 0xDF, 0xC0, 0x3F, 0xBF, 0x80, 0x7F,
+  0x7F, 0x00, 0xFE, 0xFE, 0x01, 0xFD, 0xFC, 0x03, 0xFB, 0xF8, 0x07, 0xF7,
+  0xF0, 0x0F, 0xEF, 0xE0, 0x1F, 0xDF, 0xC0, 0x3F, 0xBF, 0x80, 0x7F, 0x7F,
+  0x00, 0xFE, 0xFE, 0x01, 0xFD, 0xFC, 0x03, 0xFB, 0xFC, 0x0F, 0xF7, 0xFC,
+  0x3F, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0x7F, 0x0F, 0xFC,
+  0xFE, 0x07, 0xE1, 0xFC, 0x07, 0x03, 0xC0, 0x7F, 0x3F, 0x81, 0xFC, 0xFE,
+  0x07, 0xF3, 0xF8, 0x1F, 0x8F, 0xE0, 0x1C, 0x0F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F,
+  0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE,
+  0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01,
+  0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xE1, 0xFF, 0x7F, 0xFF, 0xFD,
+  0xFF, 0xFF, 0xF3, 0xFF, 0xDF, 0xC7, 0xFE, 0x7F, 0x07, 0xE1, 0xFC, 0x00,
+  0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFE, 0x00, 0x7F, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0xFE, 0x7F,
+  0x00, 0xFE, 0x3F, 0x00, 0xFC, 0x3F, 0x01, 0xFC, 0x3F, 0x81, 0xFC, 0x1F,
+  0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0xC3, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F,
+  0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x07, 0xE7, 0xE0, 0x07, 0xE7, 0xE0, 0x07,
+  0xE7, 0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01,
+  0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x11,
+  0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
+  0xE0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE,
+  0x01, 0xFC, 0x03, 0xF8, 0x3F, 0xFF, 0x7F, 0xFE, 0xFF, 0xFD, 0xFF, 0xFB,
+  0xFF, 0xF0, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F,
+  0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0,
+  0x0F, 0xE0, 0x1F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0,
+  0x3F, 0x00, 0x18, 0x00, 0x3C, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x78, 0x00,
+  0xF0, 0x03, 0xE0, 0x3F, 0x80, 0x7E, 0x00, 0xF0, 0x39, 0xFF, 0xFF, 0xFF,
+  0xC7, 0x00 };
+
+const GFXglyph InterTight_Bold22pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   9,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   7,  32,  13,    3,  -31 },   // 0x21 '!' U+0021
+  {    29,  15,  13,  23,    4,  -31 },   // 0x22 '"' U+0022
+  {    54,  27,  32,  27,    0,  -31 },   // 0x23 '#' U+0023
+  {   162,  25,  40,  27,    1,  -35 },   // 0x24 '$' U+0024
+  {   287,  30,  34,  36,    3,  -32 },   // 0x25 '%' U+0025
+  {   415,  27,  32,  27,    1,  -31 },   // 0x26 '&' U+0026
+  {   523,   6,  13,  14,    4,  -31 },   // 0x27 ''' U+0027
+  {   533,  12,  39,  16,    3,  -32 },   // 0x28 '(' U+0028
+  {   592,  12,  39,  15,    0,  -32 },   // 0x29 ')' U+0029
+  {   651,  18,  18,  24,    3,  -31 },   // 0x2a '*' U+002A
+  {   692,  22,  22,  28,    3,  -23 },   // 0x2b '+' U+002B
+  {   753,   8,  13,  14,    2,   -3 },   // 0x2c ',' U+002C
+  {   766,  14,   5,  18,    2,  -14 },   // 0x2d '-' U+002D
+  {   775,   7,   7,  13,    3,   -6 },   // 0x2e '.' U+002E
+  {   782,  16,  38,  15,    0,  -32 },   // 0x2f '/' U+002F
+  {   858,  26,  32,  28,    1,  -31 },   // 0x30 '0' U+0030
+  {   962,  15,  32,  18,    1,  -31 },   // 0x31 '1' U+0031
+  {  1022,  23,  32,  27,    2,  -31 },   // 0x32 '2' U+0032
+  {  1114,  24,  32,  28,    2,  -31 },   // 0x33 '3' U+0033
+  {  1210,  26,  32,  28,    1,  -31 },   // 0x34 '4' U+0034
+  {  1314,  23,  32,  26,    2,  -31 },   // 0x35 '5' U+0035
+  {  1406,  25,  32,  27,    1,  -31 },   // 0x36 '6' U+0036
+  {  1506,  22,  32,  24,    1,  -31 },   // 0x37 '7' U+0037
+  {  1594,  24,  32,  26,    1,  -31 },   // 0x38 '8' U+0038
+  {  1690,  25,  32,  27,    1,  -31 },   // 0x39 '9' U+0039
+  {  1790,   7,  23,  13,    3,  -22 },   // 0x3a ':' U+003A
+  {  1811,   8,  31,  13,    2,  -21 },   // 0x3b ';' U+003B
+  {  1842,  22,  25,  28,    3,  -24 },   // 0x3c '<' U+003C
+  {  1911,  21,  15,  27,    3,  -19 },   // 0x3d '=' U+003D
+  {  1951,  22,  25,  28,    3,  -24 },   // 0x3e '>' U+003E
+  {  2020,  21,  32,  23,    1,  -31 },   // 0x3f '?' U+003F
+  {  2104,  40,  41,  42,    1,  -31 },   // 0x40 '@' U+0040
+  {  2309,  31,  32,  31,    0,  -31 },   // 0x41 'A' U+0041
+  {  2433,  24,  32,  27,    2,  -31 },   // 0x42 'B' U+0042
+  {  2529,  29,  32,  31,    1,  -31 },   // 0x43 'C' U+0043
+  {  2645,  27,  32,  30,    2,  -31 },   // 0x44 'D' U+0044
+  {  2753,  22,  32,  25,    2,  -31 },   // 0x45 'E' U+0045
+  {  2841,  21,  32,  24,    2,  -31 },   // 0x46 'F' U+0046
+  {  2925,  29,  32,  32,    1,  -31 },   // 0x47 'G' U+0047
+  {  3041,  27,  32,  31,    2,  -31 },   // 0x48 'H' U+0048
+  {  3149,   7,  32,  11,    2,  -31 },   // 0x49 'I' U+0049
+  {  3177,  21,  32,  24,    1,  -31 },   // 0x4a 'J' U+004A
+  {  3261,  27,  32,  29,    2,  -31 },   // 0x4b 'K' U+004B
+  {  3369,  20,  32,  23,    2,  -31 },   // 0x4c 'L' U+004C
+  {  3449,  34,  32,  38,    2,  -31 },   // 0x4d 'M' U+004D
+  {  3585,  26,  32,  30,    2,  -31 },   // 0x4e 'N' U+004E
+  {  3689,  30,  32,  32,    1,  -31 },   // 0x4f 'O' U+004F
+  {  3809,  24,  32,  27,    2,  -31 },   // 0x50 'P' U+0050
+  {  3905,  30,  34,  33,    1,  -31 },   // 0x51 'Q' U+0051
+  {  4033,  25,  32,  27,    2,  -31 },   // 0x52 'R' U+0052
+  {  4133,  25,  32,  27,    1,  -31 },   // 0x53 'S' U+0053
+  {  4233,  26,  32,  28,    1,  -31 },   // 0x54 'T' U+0054
+  {  4337,  26,  32,  30,    2,  -31 },   // 0x55 'U' U+0055
+  {  4441,  31,  32,  31,    0,  -31 },   // 0x56 'V' U+0056
+  {  4565,  43,  32,  44,    0,  -31 },   // 0x57 'W' U+0057
+  {  4737,  28,  32,  30,    1,  -31 },   // 0x58 'X' U+0058
+  {  4849,  31,  32,  31,    0,  -31 },   // 0x59 'Y' U+0059
+  {  4973,  24,  32,  28,    2,  -31 },   // 0x5a 'Z' U+005A
+  {  5069,  11,  39,  15,    3,  -32 },   // 0x5b '[' U+005B
+  {  5123,  16,  38,  15,    0,  -32 },   // 0x5c '\' U+005C
+  {  5199,  11,  39,  15,    1,  -32 },   // 0x5d ']' U+005D
+  {  5253,  19,  14,  19,    0,  -31 },   // 0x5e '^' U+005E
+  {  5287,  21,   5,  19,   -1,    1 },   // 0x5f '_' U+005F
+  {  5301,   9,   6,  19,    5,  -32 },   // 0x60 '`' U+0060
+  {  5308,  21,  24,  24,    1,  -23 },   // 0x61 'a' U+0061
+  {  5371,  23,  32,  26,    2,  -31 },   // 0x62 'b' U+0062
+  {  5463,  22,  24,  24,    1,  -23 },   // 0x63 'c' U+0063
+  {  5529,  23,  32,  26,    1,  -31 },   // 0x64 'd' U+0064
+  {  5621,  22,  24,  24,    1,  -23 },   // 0x65 'e' U+0065
+  {  5687,  17,  33,  16,    0,  -32 },   // 0x66 'f' U+0066
+  {  5758,  23,  33,  26,    1,  -23 },   // 0x67 'g' U+0067
+  {  5853,  22,  32,  26,    2,  -31 },   // 0x68 'h' U+0068
+  {  5941,   7,  33,  11,    2,  -32 },   // 0x69 'i' U+0069
+  {  5970,  11,  42,  11,   -2,  -32 },   // 0x6a 'j' U+006A
+  {  6028,  23,  32,  24,    2,  -31 },   // 0x6b 'k' U+006B
+  {  6120,   7,  32,  11,    2,  -31 },   // 0x6c 'l' U+006C
+  {  6148,  35,  24,  39,    2,  -23 },   // 0x6d 'm' U+006D
+  {  6253,  22,  24,  26,    2,  -23 },   // 0x6e 'n' U+006E
+  {  6319,  23,  24,  25,    1,  -23 },   // 0x6f 'o' U+006F
+  {  6388,  23,  33,  26,    2,  -23 },   // 0x70 'p' U+0070
+  {  6483,  23,  33,  26,    1,  -23 },   // 0x71 'q' U+0071
+  {  6578,  15,  24,  17,    2,  -23 },   // 0x72 'r' U+0072
+  {  6623,  22,  24,  23,    0,  -23 },   // 0x73 's' U+0073
+  {  6689,  14,  30,  16,    1,  -29 },   // 0x74 't' U+0074
+  {  6742,  22,  24,  26,    2,  -23 },   // 0x75 'u' U+0075
+  {  6808,  24,  24,  24,    0,  -23 },   // 0x76 'v' U+0076
+  {  6880,  35,  24,  35,    0,  -23 },   // 0x77 'w' U+0077
+  {  6985,  23,  24,  23,    0,  -23 },   // 0x78 'x' U+0078
+  {  7054,  24,  33,  24,    0,  -23 },   // 0x79 'y' U+0079
+  {  7153,  20,  24,  24,    2,  -23 },   // 0x7a 'z' U+007A
+  {  7213,  16,  39,  19,    2,  -32 },   // 0x7b '{' U+007B
+  {  7291,   6,  52,  14,    4,  -41 },   // 0x7c '|' U+007C
+  {  7330,  16,  39,  19,    1,  -32 },   // 0x7d '}' U+007D
+  {  7408,  23,  10,  29,    3,  -17 },   // 0x7e '~' U+007E
+  {     0,   0,   0,  22,    2,  -41 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  7437,   1,   1,   9,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  7438,  31,  41,  31,    0,  -31 },   // 0x81 '0x0104' U+0104
+  {  7597,  15,   7,  19,    2,  -32 },   // 0x82 '0x02D8' U+02D8
+  {  7611,  24,  32,  25,    0,  -31 },   // 0x83 '0x0141' U+0141
+  {  7707,  28,  28,  32,    2,  -27 },   // 0x84 '0x00A4' U+00A4
+  {  7805,  20,  33,  23,    2,  -32 },   // 0x85 '0x013D' U+013D
+  {  7888,  25,  41,  27,    1,  -40 },   // 0x86 '0x015A' U+015A
+  {  8017,  21,  38,  25,    2,  -31 },   // 0x87 '0x00A7' U+00A7
+  {  8117,  16,   6,  22,    3,  -32 },   // 0x88 '0x00A8' U+00A8
+  {  8129,  25,  42,  27,    1,  -41 },   // 0x89 '0x0160' U+0160
+  {  8261,  25,  42,  27,    1,  -31 },   // 0x8a '0x015E' U+015E
+  {  8393,  26,  42,  28,    1,  -41 },   // 0x8b '0x0164' U+0164
+  {  8530,  24,  41,  28,    2,  -40 },   // 0x8c '0x0179' U+0179
+  {  8653,  14,   5,  18,    2,  -14 },   // 0x8d '0x00AD' U+00AD
+  {  8662,  24,  42,  28,    2,  -41 },   // 0x8e '0x017D' U+017D
+  {  8788,  24,  41,  28,    2,  -40 },   // 0x8f '0x017B' U+017B
+  {  8911,  15,  15,  19,    2,  -31 },   // 0x90 '0x00B0' U+00B0
+  {  8940,  22,  32,  24,    1,  -23 },   // 0x91 '0x0105' U+0105
+  {  9028,   9,  11,  11,    1,   -1 },   // 0x92 '0x02DB' U+02DB
+  {  9041,  13,  32,  11,   -1,  -31 },   // 0x93 '0x0142' U+0142
+  {  9093,   9,   6,  19,    5,  -32 },   // 0x94 '0x00B4' U+00B4
+  {  9100,  14,  33,  15,    2,  -32 },   // 0x95 '0x013E' U+013E
+  {  9158,  22,  33,  23,    0,  -32 },   // 0x96 '0x015B' U+015B
+  {  9249,  17,   7,  23,    3,  -33 },   // 0x97 '0x02C7' U+02C7
+  {  9264,   8,  10,  15,    4,    1 },   // 0x98 '0x00B8' U+00B8
+  {  9274,  22,  34,  23,    0,  -33 },   // 0x99 '0x0161' U+0161
+  {  9368,  22,  34,  23,    0,  -23 },   // 0x9a '0x015F' U+015F
+  {  9462,  17,  35,  16,    1,  -34 },   // 0x9b '0x0165' U+0165
+  {  9537,  20,  33,  24,    2,  -32 },   // 0x9c '0x017A' U+017A
+  {  9620,  19,   6,  19,    0,  -31 },   // 0x9d '0x02DD' U+02DD
+  {  9635,  20,  34,  24,    2,  -33 },   // 0x9e '0x017E' U+017E
+  {  9720,  20,  33,  24,    2,  -32 },   // 0x9f '0x017C' U+017C
+  {  9803,  25,  41,  27,    2,  -40 },   // 0xa0 '0x0154' U+0154
+  {  9932,  31,  41,  31,    0,  -40 },   // 0xa1 '0x00C1' U+00C1
+  { 10091,  31,  42,  31,    0,  -41 },   // 0xa2 '0x00C2' U+00C2
+  { 10254,  31,  41,  31,    0,  -40 },   // 0xa3 '0x0102' U+0102
+  { 10413,  31,  41,  31,    0,  -40 },   // 0xa4 '0x00C4' U+00C4
+  { 10572,  20,  41,  23,    2,  -40 },   // 0xa5 '0x0139' U+0139
+  { 10675,  29,  41,  31,    1,  -40 },   // 0xa6 '0x0106' U+0106
+  { 10824,  28,  42,  30,    1,  -31 },   // 0xa7 '0x00C7' U+00C7
+  { 10971,  29,  42,  31,    1,  -41 },   // 0xa8 '0x010C' U+010C
+  { 11124,  22,  41,  25,    2,  -40 },   // 0xa9 '0x00C9' U+00C9
+  { 11237,  22,  41,  25,    2,  -31 },   // 0xaa '0x0118' U+0118
+  { 11350,  22,  41,  25,    2,  -40 },   // 0xab '0x00CB' U+00CB
+  { 11463,  22,  42,  25,    2,  -41 },   // 0xac '0x011A' U+011A
+  { 11579,  10,  41,  11,    2,  -40 },   // 0xad '0x00CD' U+00CD
+  { 11631,  17,  42,  11,   -3,  -41 },   // 0xae '0x00CE' U+00CE
+  { 11721,  27,  42,  30,    2,  -41 },   // 0xaf '0x010E' U+010E
+  { 11863,  32,  32,  30,   -3,  -31 },   // 0xb0 '0x0110' U+0110
+  { 11991,  26,  41,  30,    2,  -40 },   // 0xb1 '0x0143' U+0143
+  { 12125,  26,  42,  30,    2,  -41 },   // 0xb2 '0x0147' U+0147
+  { 12262,  30,  41,  32,    1,  -40 },   // 0xb3 '0x00D3' U+00D3
+  { 12416,  30,  42,  32,    1,  -41 },   // 0xb4 '0x00D4' U+00D4
+  { 12574,  30,  41,  32,    1,  -40 },   // 0xb5 '0x0150' U+0150
+  { 12728,  30,  41,  32,    1,  -40 },   // 0xb6 '0x00D6' U+00D6
+  { 12882,  22,  23,  28,    3,  -23 },   // 0xb7 '0x00D7' U+00D7
+  { 12946,  25,  42,  27,    2,  -41 },   // 0xb8 '0x0158' U+0158
+  { 13078,  26,  43,  30,    2,  -42 },   // 0xb9 '0x016E' U+016E
+  { 13218,  26,  41,  30,    2,  -40 },   // 0xba '0x00DA' U+00DA
+  { 13352,  26,  41,  30,    2,  -40 },   // 0xbb '0x0170' U+0170
+  { 13486,  26,  41,  30,    2,  -40 },   // 0xbc '0x00DC' U+00DC
+  { 13620,  31,  41,  31,    0,  -40 },   // 0xbd '0x00DD' U+00DD
+  { 13779,  26,  42,  28,    1,  -31 },   // 0xbe '0x0162' U+0162
+  { 13916,  24,  32,  27,    2,  -31 },   // 0xbf '0x00DF' U+00DF
+  { 14012,  15,  33,  17,    2,  -32 },   // 0xc0 '0x0155' U+0155
+  { 14074,  21,  33,  24,    1,  -32 },   // 0xc1 '0x00E1' U+00E1
+  { 14161,  21,  34,  24,    1,  -33 },   // 0xc2 '0x00E2' U+00E2
+  { 14251,  22,  33,  25,    1,  -32 },   // 0xc3 '0x0103' U+0103
+  { 14342,  21,  33,  24,    1,  -32 },   // 0xc4 '0x00E4' U+00E4
+  { 14429,  10,  41,  11,    2,  -40 },   // 0xc5 '0x013A' U+013A
+  { 14481,  22,  33,  24,    1,  -32 },   // 0xc6 '0x0107' U+0107
+  { 14572,  22,  34,  24,    1,  -23 },   // 0xc7 '0x00E7' U+00E7
+  { 14666,  22,  34,  24,    1,  -33 },   // 0xc8 '0x010D' U+010D
+  { 14760,  22,  33,  24,    1,  -32 },   // 0xc9 '0x00E9' U+00E9
+  { 14851,  22,  32,  24,    1,  -23 },   // 0xca '0x0119' U+0119
+  { 14939,  22,  34,  24,    1,  -33 },   // 0xcb '0x00EB' U+00EB
+  { 15033,  22,  34,  24,    1,  -33 },   // 0xcc '0x011B' U+011B
+  { 15127,  10,  33,  11,    2,  -32 },   // 0xcd '0x00ED' U+00ED
+  { 15169,  17,  34,  11,   -3,  -33 },   // 0xce '0x00EE' U+00EE
+  { 15242,  31,  34,  31,    1,  -33 },   // 0xcf '0x010F' U+010F
+  { 15374,  26,  32,  26,    1,  -31 },   // 0xd0 '0x0111' U+0111
+  { 15478,  22,  33,  26,    2,  -32 },   // 0xd1 '0x0144' U+0144
+  { 15569,  22,  34,  26,    2,  -33 },   // 0xd2 '0x0148' U+0148
+  { 15663,  23,  33,  25,    1,  -32 },   // 0xd3 '0x00F3' U+00F3
+  { 15758,  23,  34,  25,    1,  -33 },   // 0xd4 '0x00F4' U+00F4
+  { 15856,  23,  33,  25,    1,  -32 },   // 0xd5 '0x0151' U+0151
+  { 15951,  23,  34,  25,    1,  -33 },   // 0xd6 '0x00F6' U+00F6
+  { 16049,  22,  24,  28,    3,  -23 },   // 0xd7 '0x00F7' U+00F7
+  { 16115,  18,  34,  17,    0,  -33 },   // 0xd8 '0x0159' U+0159
+  { 16192,  22,  37,  26,    2,  -36 },   // 0xd9 '0x016F' U+016F
+  { 16294,  22,  33,  26,    2,  -32 },   // 0xda '0x00FA' U+00FA
+  { 16385,  23,  33,  26,    2,  -32 },   // 0xdb '0x0171' U+0171
+  { 16480,  22,  33,  26,    2,  -32 },   // 0xdc '0x00FC' U+00FC
+  { 16571,  24,  42,  24,    0,  -32 },   // 0xdd '0x00FD' U+00FD
+  { 16697,  15,  40,  16,    1,  -29 },   // 0xde '0x0163' U+0163
+  { 16772,   7,   6,  11,    2,  -32 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_Bold22pt8b PROGMEM = {
+  (uint8_t  *)InterTight_Bold22pt8bBitmaps,
+  (GFXglyph *)InterTight_Bold22pt8bGlyphs,
+  0x20, 0xDF, 53 };
+
+// Approx. 18129 bytes
@@ -0,0 +1,1836 @@
+// Subset of ../InterTightBold24pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_Bold24pt8bBitmaps[] PROGMEM = {
+  0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x00, 0x00, 0x00, 0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0xFC,
+  0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC,
+  0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC,
+  0x3F, 0xFC, 0x3F, 0x00, 0x7C, 0x07, 0xC0, 0x07, 0xE0, 0x3E, 0x00, 0x3F,
+  0x03, 0xF0, 0x01, 0xF0, 0x1F, 0x80, 0x0F, 0x80, 0xF8, 0x00, 0x7C, 0x07,
+  0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x3F, 0x01, 0xF0, 0x3F, 0xFF, 0xFF, 0xF9,
+  0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF,
+  0xFF, 0xFF, 0x81, 0xF8, 0x0F, 0x80, 0x0F, 0xC0, 0xFC, 0x00, 0x7C, 0x07,
+  0xE0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0xF8, 0x0F, 0x80,
+  0x0F, 0xC0, 0x7C, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF,
+  0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0x7E, 0x03,
+  0xE0, 0x03, 0xF0, 0x3F, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0xF8, 0x0F, 0x80,
+  0x07, 0xC0, 0x7C, 0x00, 0x3E, 0x03, 0xE0, 0x03, 0xF0, 0x1F, 0x00, 0x1F,
+  0x81, 0xF8, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01,
+  0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF,
+  0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0xB9, 0xFF, 0x1F, 0xC7, 0x1F, 0xE7,
+  0xF0, 0xE1, 0xFC, 0xFE, 0x1C, 0x1F, 0x9F, 0xC3, 0x80, 0x03, 0xFC, 0x70,
+  0x00, 0x7F, 0xCE, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x1F,
+  0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00,
+  0x39, 0xFF, 0x80, 0x07, 0x0F, 0xF0, 0x00, 0xE0, 0xFF, 0xFC, 0x1C, 0x1F,
+  0xFF, 0x83, 0x83, 0xFF, 0xF8, 0x70, 0x7F, 0x7F, 0x8E, 0x1F, 0xCF, 0xFD,
+  0xCF, 0xF8, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0,
+  0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0xE0, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x1E, 0x0F, 0xFE, 0x00, 0x1E, 0x0F, 0xFF, 0x80,
+  0x1F, 0x0F, 0xC7, 0xE0, 0x0F, 0x07, 0xC1, 0xF0, 0x0F, 0x03, 0xE0, 0xF8,
+  0x0F, 0x81, 0xF0, 0x7C, 0x07, 0x80, 0xF8, 0x3E, 0x07, 0x80, 0x7C, 0x1F,
+  0x07, 0x80, 0x3E, 0x0F, 0x87, 0xC0, 0x1F, 0x8F, 0xC3, 0xC0, 0x07, 0xFF,
+  0xC3, 0xC0, 0x01, 0xFF, 0xC3, 0xE0, 0x00, 0x7F, 0xC1, 0xE0, 0x00, 0x1F,
+  0xC1, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xF8, 0x7F, 0xC0,
+  0x00, 0x78, 0x7F, 0xF0, 0x00, 0x78, 0x7F, 0xFC, 0x00, 0x7C, 0x3E, 0x3E,
+  0x00, 0x3C, 0x3E, 0x0F, 0x80, 0x3C, 0x1F, 0x07, 0xC0, 0x3E, 0x0F, 0x83,
+  0xE0, 0x3E, 0x07, 0xC1, 0xF0, 0x1E, 0x03, 0xE0, 0xF8, 0x1E, 0x01, 0xF0,
+  0x7C, 0x1F, 0x00, 0xF8, 0x3E, 0x0F, 0x00, 0x3E, 0x3E, 0x0F, 0x00, 0x1F,
+  0xFF, 0x0F, 0x80, 0x07, 0xFF, 0x07, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xFE,
+  0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0x0F, 0xE0,
+  0x01, 0xF8, 0x1F, 0x80, 0x07, 0xE0, 0x7E, 0x00, 0x1F, 0x81, 0xF8, 0x00,
+  0x7E, 0x07, 0xE0, 0x01, 0xFC, 0x3F, 0x80, 0x07, 0xF1, 0xFC, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
+  0x3F, 0x0F, 0xFF, 0xE0, 0xFC, 0x7F, 0xFF, 0xC3, 0xF1, 0xFE, 0x7F, 0x8F,
+  0xCF, 0xF0, 0xFF, 0x7F, 0x3F, 0x81, 0xFF, 0xF8, 0xFE, 0x03, 0xFF, 0xE3,
+  0xF8, 0x07, 0xFF, 0x8F, 0xE0, 0x0F, 0xFC, 0x3F, 0xC0, 0x3F, 0xE0, 0x7F,
+  0x80, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xE7, 0xF8, 0x0F, 0xFE, 0x0F, 0xF0, 0x01, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x07, 0xF0, 0x7F, 0x0F, 0xE0, 0xFE, 0x1F, 0xC1, 0xFC, 0x1F, 0xC3,
+  0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x87, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
+  0xF0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
+  0xF0, 0x3F, 0x83, 0xF8, 0x3F, 0x81, 0xFC, 0x1F, 0xC1, 0xFC, 0x0F, 0xE0,
+  0xFE, 0x07, 0xF0, 0x7F, 0xFE, 0x0F, 0xE0, 0x7F, 0x07, 0xF0, 0x3F, 0x83,
+  0xF8, 0x3F, 0x81, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC0, 0xFE, 0x0F, 0xE0,
+  0xFE, 0x0F, 0xE0, 0xFE, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x0F, 0xE0,
+  0xFE, 0x0F, 0xE0, 0xFE, 0x1F, 0xC1, 0xFC, 0x1F, 0xC3, 0xF8, 0x3F, 0x83,
+  0xF8, 0x7F, 0x07, 0xF0, 0xFE, 0x0F, 0xE0, 0x01, 0xE0, 0x00, 0x78, 0x00,
+  0x1E, 0x01, 0x87, 0x86, 0x71, 0xE3, 0xBF, 0x7B, 0xFF, 0xFF, 0xFD, 0xFF,
+  0xFE, 0x1F, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0xE1, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xFF, 0x7B, 0xF7, 0x1E, 0x39, 0x87, 0x86, 0x01, 0xE0, 0x00, 0x78, 0x00,
+  0x1E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x3F, 0x9F, 0xCF, 0xCF, 0xE7, 0xF3, 0xF1, 0xF8, 0xFC, 0x7C,
+  0x3E, 0x3F, 0x1F, 0x8F, 0x87, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C,
+  0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x03,
+  0xF8, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x3F, 0x00,
+  0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x03, 0xF8,
+  0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F,
+  0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x03, 0xF8, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F, 0x80,
+  0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x03, 0xF8, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x03,
+  0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0x0F,
+  0xF8, 0x3F, 0xC0, 0x3F, 0xC3, 0xF8, 0x01, 0xFC, 0x7F, 0x80, 0x1F, 0xE7,
+  0xF0, 0x00, 0xFE, 0x7F, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0xFE, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x0F,
+  0xE7, 0xF0, 0x00, 0xFE, 0x7F, 0x00, 0x0F, 0xE7, 0xF8, 0x01, 0xFE, 0x3F,
+  0x80, 0x1F, 0xC3, 0xFC, 0x03, 0xFC, 0x1F, 0xF0, 0xFF, 0x80, 0xFF, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0xFE, 0x07, 0xFC, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xE1, 0xFF, 0x03, 0xF8,
+  0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01,
+  0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F,
+  0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0,
+  0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFF,
+  0xF0, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFE,
+  0x1F, 0xF1, 0xFC, 0x03, 0xF9, 0xFE, 0x01, 0xFE, 0xFE, 0x00, 0x7F, 0x7F,
+  0x00, 0x3F, 0xBF, 0x80, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0,
+  0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
+  0x00, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE,
+  0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE,
+  0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x0F, 0xF8,
+  0x3F, 0xC7, 0xF8, 0x07, 0xF9, 0xFC, 0x00, 0xFE, 0x7F, 0x00, 0x3F, 0x80,
+  0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x7F,
+  0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x03, 0xFD, 0xFC, 0x01,
+  0xFE, 0x7F, 0xC0, 0xFF, 0x8F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF,
+  0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0xFE, 0x7F, 0x00,
+  0x0F, 0xE7, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x3F, 0xC7, 0xF0, 0x03, 0xF8,
+  0x7F, 0x00, 0x7F, 0x07, 0xF0, 0x07, 0xF0, 0x7F, 0x00, 0xFE, 0x07, 0xF0,
+  0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x3F, 0x80, 0x7F, 0x03, 0xF8,
+  0x07, 0xF0, 0x7F, 0x00, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
+  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE1,
+  0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE3, 0xF8, 0x07, 0xF7, 0xFF,
+  0x03, 0xF7, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x7F, 0xC1,
+  0xFF, 0x1F, 0x80, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
+  0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0xFE,
+  0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xCF, 0xE0, 0x1F, 0xE7,
+  0xFC, 0x1F, 0xE1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0,
+  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
+  0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8,
+  0x3F, 0xC0, 0xFF, 0x07, 0xF0, 0x0F, 0xF1, 0xFC, 0x00, 0xFE, 0x3F, 0x00,
+  0x1F, 0xEF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x0F,
+  0xE3, 0xFF, 0xC1, 0xFC, 0xFF, 0xFC, 0x3F, 0xBF, 0xFF, 0xC7, 0xFF, 0xFF,
+  0xFC, 0xFF, 0xE0, 0xFF, 0xDF, 0xF8, 0x07, 0xFB, 0xFE, 0x00, 0x7F, 0x7F,
+  0x80, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x03,
+  0xFB, 0xF8, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xEF, 0xE0, 0x03, 0xFC, 0xFE,
+  0x00, 0x7F, 0x1F, 0xE0, 0x1F, 0xE1, 0xFE, 0x0F, 0xF8, 0x3F, 0xFF, 0xFE,
+  0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x07,
+  0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00,
+  0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00,
+  0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
+  0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
+  0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01,
+  0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03,
+  0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
+  0x0F, 0xF8, 0x7F, 0xC7, 0xF8, 0x07, 0xF9, 0xFC, 0x00, 0xFE, 0x7F, 0x00,
+  0x3F, 0x9F, 0xC0, 0x0F, 0xE7, 0xF0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x3F,
+  0x80, 0x7F, 0x07, 0xF8, 0x7F, 0x80, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0,
+  0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0xFF, 0x03,
+  0xFC, 0x7F, 0x80, 0x7F, 0x9F, 0xC0, 0x0F, 0xEF, 0xE0, 0x01, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x03, 0xFD,
+  0xFE, 0x01, 0xFE, 0x7F, 0xC0, 0xFF, 0x8F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+  0xE0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0xE0, 0x7F, 0xC1, 0xFE, 0x1F, 0xE0, 0x1F, 0xE3, 0xF8,
+  0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xDF, 0xC0, 0x03, 0xFB, 0xF8, 0x00, 0x7F,
+  0x7F, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0,
+  0x0F, 0xFB, 0xFC, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0xE7, 0xFF, 0xFF, 0xFC,
+  0x7F, 0xFF, 0xBF, 0x87, 0xFF, 0xE7, 0xF0, 0x7F, 0xF8, 0xFE, 0x03, 0xF8,
+  0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xDF,
+  0xE0, 0x03, 0xF1, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x0F,
+  0xF0, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x07,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x7E,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0x0F,
+  0x07, 0xE3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF1, 0xF8, 0x3C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x8F, 0xE3, 0xF8, 0xFC, 0x3F, 0x0F, 0xC7, 0xE1, 0xF8, 0x7E, 0x1F,
+  0x87, 0xC1, 0xF0, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFF,
+  0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80,
+  0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0,
+  0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x07,
+  0xFF, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x1F, 0xFF,
+  0xC0, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80,
+  0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC,
+  0x7F, 0xFF, 0xF9, 0xFE, 0x1F, 0xEF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE,
+  0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07,
+  0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
+  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07,
+  0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
+  0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x03,
+  0xFE, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
+  0x81, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x3F, 0x1F, 0x9F, 0xC3,
+  0xF8, 0x1F, 0xFD, 0xF8, 0xFC, 0x3F, 0x03, 0xFF, 0xFF, 0x87, 0xE7, 0xF0,
+  0x7F, 0xFF, 0xF8, 0x7E, 0x7E, 0x0F, 0xFF, 0xFF, 0x87, 0xE7, 0xE1, 0xFE,
+  0x0F, 0xF8, 0x3F, 0x7E, 0x1F, 0xC0, 0x3F, 0x83, 0xFF, 0xC1, 0xF8, 0x03,
+  0xF8, 0x3F, 0xFC, 0x3F, 0x00, 0x1F, 0x83, 0xFF, 0xC3, 0xF0, 0x01, 0xF8,
+  0x3F, 0xFC, 0x3F, 0x00, 0x1F, 0x83, 0xFF, 0xC3, 0xF0, 0x01, 0xF8, 0x3F,
+  0xFC, 0x3F, 0x00, 0x1F, 0x83, 0xFF, 0xC3, 0xF0, 0x01, 0xF8, 0x3F, 0xFC,
+  0x3F, 0x00, 0x1F, 0x83, 0xFF, 0xC3, 0xF8, 0x01, 0xF8, 0x7E, 0xFC, 0x1F,
+  0x80, 0x3F, 0x87, 0xEF, 0xE1, 0xFC, 0x07, 0xF8, 0x7E, 0x7E, 0x1F, 0xE0,
+  0xFF, 0xCF, 0xC7, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0x07, 0xFF, 0xFF,
+  0xFF, 0x87, 0xF0, 0x3F, 0xFE, 0xFF, 0xF0, 0x3F, 0x81, 0xFF, 0xC7, 0xFE,
+  0x03, 0xF8, 0x07, 0xF0, 0x3F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0x18, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0x80, 0x00, 0x1F, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x01, 0xFE, 0x7F,
+  0x80, 0x01, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x3F,
+  0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x07, 0xF8, 0x1F,
+  0xE0, 0x07, 0xF0, 0x0F, 0xE0, 0x07, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xC0, 0x03,
+  0xFC, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x7F, 0x80, 0x01,
+  0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x0F,
+  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0x7F,
+  0xCF, 0xE0, 0x07, 0xFB, 0xF8, 0x00, 0xFE, 0xFE, 0x00, 0x3F, 0xBF, 0x80,
+  0x0F, 0xEF, 0xE0, 0x03, 0xFB, 0xF8, 0x01, 0xFC, 0xFE, 0x00, 0x7F, 0x3F,
+  0x80, 0x7F, 0x8F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF3, 0xF8, 0x03, 0xFE, 0xFE, 0x00,
+  0x7F, 0xBF, 0x80, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE,
+  0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0xFF,
+  0xFE, 0x00, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
+  0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x03, 0xFE, 0x07, 0xF8, 0x03, 0xFE, 0x1F,
+  0xE0, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0xFF, 0x00, 0x03, 0xF9, 0xFC,
+  0x00, 0x07, 0xF3, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x7F, 0x80, 0x01, 0xFC, 0x7F, 0x00, 0x07,
+  0xF8, 0xFF, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x81, 0xFF,
+  0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x07,
+  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xFF, 0xF8, 0x7F, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0xFF, 0x1F, 0xC0, 0x03,
+  0xFC, 0xFE, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0x80, 0x01, 0xFD,
+  0xFC, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8,
+  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F,
+  0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0xFE, 0xFE,
+  0x00, 0x07, 0xF7, 0xF0, 0x00, 0x7F, 0x3F, 0x80, 0x07, 0xF9, 0xFC, 0x00,
+  0x7F, 0x8F, 0xE0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE,
+  0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
+  0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
+  0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01,
+  0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00,
+  0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+  0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00,
+  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF,
+  0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE,
+  0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
+  0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+  0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x01,
+  0xFF, 0x03, 0xFF, 0x07, 0xF8, 0x01, 0xFE, 0x1F, 0xE0, 0x01, 0xFE, 0x3F,
+  0x80, 0x01, 0xFC, 0xFF, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x00, 0x7F, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
+  0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
+  0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x3F, 0xBF, 0x80, 0x00,
+  0xFF, 0x7F, 0x80, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x0F,
+  0xF0, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x81, 0xFF, 0x01, 0xFF, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x1F, 0xE0, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
+  0x80, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00,
+  0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03,
+  0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF,
+  0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0,
+  0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
+  0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00,
+  0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
+  0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07,
+  0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xFE,
+  0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x0F, 0xE7, 0xF8,
+  0x3F, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0x07, 0xFF,
+  0xC0, 0x03, 0xFE, 0x00, 0xFE, 0x00, 0x1F, 0xF7, 0xF0, 0x00, 0xFF, 0x3F,
+  0x80, 0x0F, 0xF1, 0xFC, 0x00, 0xFF, 0x8F, 0xE0, 0x0F, 0xF8, 0x7F, 0x00,
+  0xFF, 0x83, 0xF8, 0x0F, 0xF8, 0x1F, 0xC0, 0x7F, 0x80, 0xFE, 0x07, 0xF8,
+  0x07, 0xF0, 0x7F, 0xC0, 0x3F, 0x87, 0xFC, 0x01, 0xFC, 0x7F, 0xC0, 0x0F,
+  0xE3, 0xFC, 0x00, 0x7F, 0x3F, 0xC0, 0x03, 0xFB, 0xFC, 0x00, 0x1F, 0xFF,
+  0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0,
+  0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD, 0xFE, 0x00, 0x7F, 0xC7, 0xF8, 0x03,
+  0xFE, 0x3F, 0xE0, 0x1F, 0xE0, 0xFF, 0x80, 0xFE, 0x03, 0xFC, 0x07, 0xF0,
+  0x1F, 0xF0, 0x3F, 0x80, 0x7F, 0xC1, 0xFC, 0x01, 0xFE, 0x0F, 0xE0, 0x0F,
+  0xF8, 0x7F, 0x00, 0x3F, 0xE3, 0xF8, 0x00, 0xFF, 0x1F, 0xC0, 0x07, 0xFC,
+  0xFE, 0x00, 0x1F, 0xF7, 0xF0, 0x00, 0x7F, 0x80, 0xFE, 0x00, 0x03, 0xF8,
+  0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
+  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC,
+  0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
+  0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xBF, 0xFF, 0x7E, 0x01, 0xFD, 0xFF, 0xFB,
+  0xF8, 0x0F, 0xEF, 0xFF, 0xDF, 0xC0, 0x7E, 0x7F, 0xFE, 0x7F, 0x07, 0xF3,
+  0xFF, 0xF3, 0xF8, 0x3F, 0x1F, 0xFF, 0x8F, 0xC3, 0xF8, 0xFF, 0xFC, 0x7F,
+  0x1F, 0xC7, 0xFF, 0xE1, 0xF8, 0xFC, 0x3F, 0xFF, 0x0F, 0xEF, 0xE1, 0xFF,
+  0xF8, 0x7F, 0x7E, 0x0F, 0xFF, 0xC1, 0xFF, 0xF0, 0x7F, 0xFE, 0x0F, 0xFF,
+  0x83, 0xFF, 0xF0, 0x3F, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xC0, 0xFF, 0xFC,
+  0x0F, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0x01,
+  0xFF, 0xF8, 0x07, 0xF0, 0x0F, 0xFF, 0xC0, 0x3F, 0x80, 0x7F, 0xFE, 0x01,
+  0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xC0, 0x1F, 0xC0, 0xFC, 0x00, 0x03, 0xFF,
+  0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8,
+  0x00, 0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00,
+  0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x7F, 0x81, 0xFF, 0xFB,
+  0xFE, 0x0F, 0xFF, 0xCF, 0xF8, 0x7F, 0xFE, 0x3F, 0xC3, 0xFF, 0xF0, 0xFF,
+  0x1F, 0xFF, 0x87, 0xFC, 0xFF, 0xFC, 0x1F, 0xF7, 0xFF, 0xE0, 0x7F, 0xBF,
+  0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE,
+  0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x1F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0x80, 0x01, 0xFC,
+  0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0x7F, 0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0xC0, 0x03, 0xFC,
+  0x1F, 0xE0, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0x7F, 0xEF,
+  0xE0, 0x07, 0xFB, 0xF8, 0x00, 0xFE, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x07,
+  0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80,
+  0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0xFE, 0xFE, 0x00, 0x7F, 0xBF,
+  0x80, 0x7F, 0xEF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x07,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0, 0x1F, 0xE0, 0x07, 0xF8, 0x3F,
+  0xC0, 0x03, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x7F, 0x80, 0x01, 0xFE, 0x7F,
+  0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFF, 0xFE,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0x7F,
+  0x00, 0x00, 0xFE, 0x7F, 0x03, 0xF8, 0xFE, 0x7F, 0x81, 0xF9, 0xFE, 0x3F,
+  0x80, 0xFD, 0xFC, 0x3F, 0xC0, 0x7F, 0xFC, 0x1F, 0xE0, 0x7F, 0xF8, 0x0F,
+  0xF8, 0x3F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x01,
+  0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0F, 0xF3, 0xF8, 0x00,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFF, 0xF1, 0xFC, 0x01, 0xFF, 0x3F, 0x80, 0x1F, 0xE7, 0xF0,
+  0x01, 0xFE, 0xFE, 0x00, 0x1F, 0xDF, 0xC0, 0x03, 0xFB, 0xF8, 0x00, 0x7F,
+  0x7F, 0x00, 0x0F, 0xEF, 0xE0, 0x01, 0xFD, 0xFC, 0x00, 0x7F, 0xBF, 0x80,
+  0x1F, 0xE7, 0xF0, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC3,
+  0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x01, 0xFC, 0x0F,
+  0xF0, 0x3F, 0x81, 0xFE, 0x07, 0xF0, 0x1F, 0xE0, 0xFE, 0x03, 0xFC, 0x1F,
+  0xC0, 0x3F, 0xC3, 0xF8, 0x07, 0xF8, 0x7F, 0x00, 0x7F, 0x8F, 0xE0, 0x07,
+  0xF1, 0xFC, 0x00, 0xFF, 0x3F, 0x80, 0x0F, 0xE7, 0xF0, 0x01, 0xFE, 0xFE,
+  0x00, 0x1F, 0xDF, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF,
+  0x00, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xC0, 0xFF, 0x8F, 0xE0, 0x0F, 0xF3, 0xF8, 0x00, 0xFE, 0x7F, 0x00, 0x0F,
+  0xCF, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
+  0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xF8,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00,
+  0x3F, 0xBF, 0xC0, 0x0F, 0xE7, 0xFE, 0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF8,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
+  0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xFE, 0x7F, 0x00, 0x0F, 0xE7, 0xF8,
+  0x01, 0xFE, 0x3F, 0xE0, 0x7F, 0xC1, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
+  0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x7F,
+  0x80, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x1F, 0xE7,
+  0xF8, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x07, 0xF8,
+  0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xE0, 0x01, 0xFE,
+  0x07, 0xF8, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x7F,
+  0x00, 0x7F, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x1F,
+  0xC0, 0x07, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFE, 0x07,
+  0xF0, 0x00, 0x7F, 0x07, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x1F, 0xE1,
+  0xFC, 0x00, 0x07, 0xF1, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0xFE,
+  0x7F, 0x00, 0x00, 0x7F, 0x7F, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F,
+  0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
+  0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0,
+  0x01, 0xFE, 0xFE, 0x00, 0x1F, 0xE0, 0x03, 0xFD, 0xFE, 0x00, 0x3F, 0xC0,
+  0x07, 0xFB, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xE7, 0xF8, 0x01, 0xFF, 0x00,
+  0x3F, 0xC7, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0x8F, 0xF0, 0x07, 0xFE, 0x00,
+  0xFF, 0x1F, 0xE0, 0x1F, 0xFC, 0x01, 0xFC, 0x1F, 0xC0, 0x3F, 0xF8, 0x07,
+  0xF8, 0x3F, 0x80, 0x7F, 0xF8, 0x0F, 0xF0, 0x7F, 0x80, 0xFF, 0xF0, 0x1F,
+  0xC0, 0xFF, 0x03, 0xFF, 0xE0, 0x3F, 0x80, 0xFE, 0x07, 0xEF, 0xC0, 0xFF,
+  0x01, 0xFC, 0x0F, 0xDF, 0xC1, 0xFC, 0x03, 0xFC, 0x3F, 0x9F, 0x83, 0xF8,
+  0x03, 0xF8, 0x7F, 0x3F, 0x07, 0xF0, 0x07, 0xF0, 0xFC, 0x7F, 0x1F, 0xE0,
+  0x0F, 0xE1, 0xF8, 0x7E, 0x3F, 0x80, 0x1F, 0xE7, 0xF0, 0xFC, 0x7F, 0x00,
+  0x1F, 0xCF, 0xC1, 0xF8, 0xFE, 0x00, 0x3F, 0x9F, 0x83, 0xFB, 0xF8, 0x00,
+  0x7F, 0x3F, 0x03, 0xF7, 0xF0, 0x00, 0x7E, 0xFC, 0x07, 0xEF, 0xE0, 0x00,
+  0xFF, 0xF8, 0x0F, 0xDF, 0xC0, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x03,
+  0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x07,
+  0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x0F,
+  0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x3F,
+  0xE0, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F,
+  0x00, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x0F, 0xF9,
+  0xFF, 0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0xFF, 0x03,
+  0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x07,
+  0xF8, 0x7F, 0x80, 0x07, 0xF8, 0xFF, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F,
+  0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFE, 0x7F,
+  0x80, 0x03, 0xFC, 0x7F, 0x80, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xE0, 0xFF,
+  0x00, 0x7F, 0x81, 0xFF, 0x01, 0xFE, 0x01, 0xFE, 0x07, 0xFC, 0x01, 0xFE,
+  0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0x80, 0x07, 0xFD,
+  0xFE, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x7F,
+  0x8F, 0xF0, 0x00, 0x7F, 0x87, 0xF8, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x3F,
+  0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x1F,
+  0xE0, 0x07, 0xF8, 0x0F, 0xF0, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x07,
+  0xF8, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x07, 0xFB,
+  0xFC, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
+  0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
+  0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00,
+  0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x7E,
+  0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x7E, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
+  0x00, 0xFE, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0,
+  0x03, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07,
+  0xE0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80,
+  0x0F, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
+  0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x1F, 0x7C, 0x03, 0xEF, 0x80, 0xF8,
+  0xF8, 0x1F, 0x1F, 0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x3F, 0x07, 0xE7, 0xC0,
+  0x7D, 0xF8, 0x0F, 0xFE, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7E, 0x1F, 0xC3,
+  0xF0, 0x7E, 0x0F, 0x83, 0xF0, 0x7C, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xC0,
+  0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC7, 0xF8, 0x7F, 0x9F,
+  0xC0, 0x3F, 0x9F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00,
+  0x7F, 0xF8, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xDF, 0xFE,
+  0x3F, 0xBF, 0xC0, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x07,
+  0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+  0x9F, 0xFF, 0x7F, 0x1F, 0xFC, 0xFE, 0x0F, 0xE1, 0xFC, 0xFE, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
+  0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x1F,
+  0xC0, 0x7F, 0x3F, 0xF8, 0x3F, 0xBF, 0xFE, 0x1F, 0xDF, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xE7, 0xFE, 0x0F, 0xF3, 0xFE, 0x03, 0xFD, 0xFE, 0x00, 0xFE, 0xFF,
+  0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
+  0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xBF, 0xC0, 0x1F, 0xDF, 0xF0, 0x1F,
+  0xEF, 0xFC, 0x1F, 0xE7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFD, 0xFF,
+  0xF0, 0xFE, 0x7F, 0xF0, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x03,
+  0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x3F,
+  0xC1, 0xFE, 0x7F, 0x80, 0xFF, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+  0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x80, 0xFF, 0x3F, 0xC1, 0xFE, 0x3F,
+  0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x01,
+  0xFF, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0,
+  0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x3F, 0x83, 0xFF, 0x9F,
+  0xC3, 0xFF, 0xEF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF9, 0xFE, 0x0F,
+  0xFD, 0xFE, 0x03, 0xFE, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x00,
+  0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0,
+  0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF,
+  0x80, 0x3F, 0xDF, 0xC0, 0x1F, 0xEF, 0xF0, 0x1F, 0xF3, 0xFC, 0x1F, 0xF9,
+  0xFF, 0xFF, 0xFC, 0x7F, 0xFE, 0xFE, 0x1F, 0xFF, 0x7F, 0x07, 0xFF, 0x3F,
+  0x80, 0xFE, 0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xF0, 0x01, 0xFF,
+  0xFE, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE1, 0xFE, 0x0F, 0xF1, 0xFE,
+  0x03, 0xFC, 0xFE, 0x00, 0xFE, 0x7E, 0x00, 0x7F, 0x7F, 0x00, 0x1F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xF3, 0xFC, 0x0F, 0xF1, 0xFF, 0xFF,
+  0xF8, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0xFF,
+  0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xF0, 0x3F, 0xF8,
+  0x1F, 0xFE, 0x07, 0xFF, 0x83, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
+  0xE0, 0x3F, 0xFF, 0xEF, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xE0, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
+  0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
+  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8,
+  0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
+  0x01, 0xFC, 0x3F, 0x83, 0xFF, 0x9F, 0xC3, 0xFF, 0xEF, 0xE3, 0xFF, 0xFF,
+  0xF3, 0xFF, 0xFF, 0xF9, 0xFE, 0x0F, 0xFD, 0xFE, 0x03, 0xFE, 0xFE, 0x00,
+  0xFF, 0x7F, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0,
+  0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xDF, 0xC0, 0x1F, 0xEF,
+  0xF0, 0x1F, 0xF7, 0xFC, 0x1F, 0xF9, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE,
+  0x1F, 0xFF, 0x7F, 0x07, 0xFF, 0x3F, 0x80, 0xFE, 0x1F, 0xC0, 0x00, 0x0F,
+  0xE0, 0x00, 0x07, 0xF0, 0x60, 0x03, 0xFB, 0xF8, 0x03, 0xF9, 0xFF, 0x07,
+  0xFC, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x01, 0xFF,
+  0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0xFE, 0x3F, 0xF0, 0xFE,
+  0xFF, 0xF8, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0x3C,
+  0x7E, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x03,
+  0x80, 0xF8, 0x3F, 0x87, 0xF0, 0xFE, 0x0F, 0x80, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC,
+  0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F,
+  0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87,
+  0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x1F, 0xFF, 0xFB, 0xFF, 0x7F, 0xCF,
+  0xF1, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0xFE, 0x03, 0xFE, 0xFE, 0x03, 0xFC,
+  0xFE, 0x07, 0xF8, 0xFE, 0x0F, 0xF0, 0xFE, 0x1F, 0xE0, 0xFE, 0x3F, 0xC0,
+  0xFE, 0x7F, 0xC0, 0xFE, 0x7F, 0x80, 0xFE, 0xFF, 0x00, 0xFF, 0xFE, 0x00,
+  0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x80, 0xFF, 0x3F, 0xC0, 0xFE, 0x3F, 0xE0, 0xFE, 0x1F, 0xE0,
+  0xFE, 0x0F, 0xF0, 0xFE, 0x0F, 0xF8, 0xFE, 0x07, 0xF8, 0xFE, 0x03, 0xFC,
+  0xFE, 0x03, 0xFE, 0xFE, 0x01, 0xFE, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xFE, 0x1F, 0x80, 0x3F, 0x07, 0xF3, 0xFF, 0x07, 0xFE,
+  0x3F, 0xBF, 0xFC, 0xFF, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x7F, 0xC3, 0xFF, 0x87, 0xFF, 0xFC, 0x0F, 0xF8, 0x1F, 0xFF,
+  0xC0, 0x3F, 0x80, 0x7F, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xF0, 0x0F, 0xE0,
+  0x1F, 0xFF, 0x80, 0x7F, 0x00, 0xFF, 0xFC, 0x03, 0xF8, 0x07, 0xFF, 0xE0,
+  0x1F, 0xC0, 0x3F, 0xFF, 0x00, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xF0, 0x0F,
+  0xFF, 0xC0, 0x3F, 0x80, 0x7F, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xF0, 0x0F,
+  0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0x00, 0xFF, 0xFC, 0x03, 0xF8, 0x07, 0xFF,
+  0xE0, 0x1F, 0xC0, 0x3F, 0xFF, 0x00, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xF0,
+  0x0F, 0xFF, 0xC0, 0x3F, 0x80, 0x7F, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xF0,
+  0x0F, 0xE0, 0x1F, 0xC0, 0xFE, 0x1F, 0xC0, 0xFE, 0x7F, 0xF0, 0xFE, 0xFF,
+  0xF8, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0x00, 0x7F,
+  0x80, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x01, 0xFF,
+  0xFF, 0xC1, 0xFE, 0x0F, 0xF1, 0xFE, 0x03, 0xFC, 0xFE, 0x00, 0xFE, 0x7F,
+  0x00, 0x7F, 0x7F, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
+  0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0x9F, 0xC0, 0x1F, 0xCF, 0xF0, 0x1F,
+  0xE3, 0xFC, 0x1F, 0xE1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xF0, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0x00, 0x00, 0xFE,
+  0x1F, 0xC0, 0x7F, 0x1F, 0xF8, 0x3F, 0xBF, 0xFE, 0x1F, 0xDF, 0xFF, 0x8F,
+  0xFF, 0xFF, 0xE7, 0xFE, 0x0F, 0xF3, 0xFE, 0x03, 0xFD, 0xFE, 0x00, 0xFE,
+  0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07,
+  0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xBF, 0xC0, 0x1F, 0xDF, 0xF0,
+  0x1F, 0xEF, 0xFC, 0x1F, 0xE7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFD,
+  0xFF, 0xF0, 0xFE, 0x7F, 0xF0, 0x7F, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x1F,
+  0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x83, 0xFF, 0x9F, 0xC3, 0xFF,
+  0xEF, 0xE3, 0xFF, 0xF7, 0xF3, 0xFF, 0xFF, 0xF9, 0xFE, 0x0F, 0xFD, 0xFE,
+  0x03, 0xFE, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x3F,
+  0xDF, 0xC0, 0x1F, 0xEF, 0xF0, 0x1F, 0xF3, 0xFC, 0x1F, 0xF9, 0xFF, 0xFF,
+  0xFC, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0x07, 0xFF, 0x3F, 0x80, 0xFE,
+  0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0xFE, 0x1F, 0xFE,
+  0x7F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0xFF,
+  0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
+  0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
+  0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
+  0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xC3, 0xFF, 0xFF, 0x8F, 0xF0, 0x7F, 0x9F, 0xC0, 0x7F, 0x3F, 0x80, 0x7E,
+  0x7F, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
+  0x07, 0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x07, 0xF7, 0xF0,
+  0x1F, 0xEF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xE0, 0x07, 0xFF, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F,
+  0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F,
+  0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F,
+  0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F,
+  0xF0, 0x0F, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0x7F,
+  0x83, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0x7F, 0x0F,
+  0xFE, 0x7F, 0x03, 0xF0, 0x7F, 0xFF, 0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xF7,
+  0xF0, 0x03, 0xF9, 0xFE, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x8F, 0xE0, 0x1F,
+  0xC3, 0xFC, 0x07, 0xF0, 0x7F, 0x03, 0xFC, 0x1F, 0xC0, 0xFE, 0x07, 0xF0,
+  0x3F, 0x80, 0xFE, 0x0F, 0xE0, 0x3F, 0x87, 0xF0, 0x0F, 0xE1, 0xFC, 0x01,
+  0xFC, 0x7E, 0x00, 0x7F, 0x3F, 0x80, 0x1F, 0xCF, 0xE0, 0x03, 0xF3, 0xF0,
+  0x00, 0xFE, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF,
+  0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0xFE, 0x01, 0xFC, 0xFE,
+  0x03, 0xFC, 0x03, 0xF9, 0xFC, 0x07, 0xFC, 0x07, 0xF3, 0xF8, 0x0F, 0xF8,
+  0x1F, 0xE7, 0xF0, 0x1F, 0xF0, 0x3F, 0x87, 0xF0, 0x7F, 0xE0, 0x7F, 0x0F,
+  0xE0, 0xFF, 0xC0, 0xFE, 0x1F, 0xC1, 0xFF, 0xC1, 0xFC, 0x3F, 0x83, 0xFF,
+  0x87, 0xF0, 0x3F, 0x87, 0xFF, 0x0F, 0xE0, 0x7F, 0x1F, 0xBE, 0x1F, 0xC0,
+  0xFE, 0x3F, 0x7E, 0x3F, 0x00, 0xFC, 0x7C, 0xFC, 0xFE, 0x01, 0xF8, 0xF8,
+  0xF9, 0xFC, 0x03, 0xFB, 0xF1, 0xF3, 0xF8, 0x07, 0xF7, 0xE3, 0xF7, 0xE0,
+  0x07, 0xEF, 0x87, 0xEF, 0xC0, 0x0F, 0xFF, 0x07, 0xFF, 0x80, 0x1F, 0xFE,
+  0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xF8,
+  0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x01, 0xFF,
+  0x00, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x01, 0xFE,
+  0x00, 0x7F, 0x00, 0x7F, 0x9F, 0xC0, 0x3F, 0x8F, 0xE0, 0x3F, 0xC3, 0xF8,
+  0x1F, 0xC1, 0xFC, 0x1F, 0xC0, 0x7F, 0x0F, 0xE0, 0x3F, 0x8F, 0xE0, 0x0F,
+  0xE7, 0xF0, 0x03, 0xF7, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00,
+  0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x01, 0xFC, 0xFE,
+  0x01, 0xFC, 0x7F, 0x00, 0xFE, 0x1F, 0xC0, 0xFE, 0x0F, 0xF0, 0xFF, 0x03,
+  0xF8, 0x7F, 0x01, 0xFE, 0x7F, 0x80, 0x7F, 0x3F, 0x80, 0x1F, 0xC0, 0xFF,
+  0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xF7, 0xF0, 0x03, 0xF9, 0xFE, 0x00, 0xFE,
+  0x3F, 0x80, 0x7F, 0x8F, 0xE0, 0x1F, 0xC3, 0xF8, 0x07, 0xF0, 0x7F, 0x03,
+  0xFC, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x80, 0xFC, 0x0F, 0xE0, 0x3F,
+  0x87, 0xF0, 0x0F, 0xE1, 0xFC, 0x01, 0xF8, 0x7E, 0x00, 0x7F, 0x3F, 0x80,
+  0x1F, 0xCF, 0xE0, 0x03, 0xF3, 0xF0, 0x00, 0xFC, 0xFC, 0x00, 0x3F, 0xFF,
+  0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x0F,
+  0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
+  0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0,
+  0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
+  0xC0, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x3F,
+  0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF8, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F,
+  0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00,
+  0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x03, 0xF8,
+  0x03, 0xF8, 0x0F, 0xF8, 0x07, 0xF0, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0xFF,
+  0xE0, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80,
+  0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE,
+  0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x0F, 0xFE, 0x07, 0xFF, 0x01, 0xFF, 0x80,
+  0x7F, 0xC0, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x3F, 0xF0, 0x1F,
+  0xF8, 0x0F, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0,
+  0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F,
+  0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80,
+  0x0F, 0xF8, 0x01, 0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x83, 0xFE,
+  0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F,
+  0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+  0xFF, 0x83, 0xFF, 0x81, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xCF, 0xFE, 0x07, 0xEF, 0xFF,
+  0x83, 0xF7, 0xFF, 0xE3, 0xFF, 0xF1, 0xFF, 0xFB, 0xF0, 0x7F, 0xFD, 0xF8,
+  0x1F, 0xFC, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01,
+  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x7F, 0x3F, 0x80, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x3F, 0xCF, 0xF0, 0x00,
+  0x1F, 0xC3, 0xF8, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
+  0x07, 0xF0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0xC0, 0x03, 0xFC, 0x0F, 0xF0,
+  0x01, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
+  0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xF0, 0x00,
+  0xFF, 0x07, 0xF8, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x1F, 0xE3, 0xFC, 0x00,
+  0x0F, 0xF1, 0xFE, 0x00, 0x07, 0xF8, 0xFE, 0x00, 0x01, 0xFE, 0xFF, 0x00,
+  0x00, 0xFF, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x0F, 0xFC, 0x07,
+  0xFF, 0x07, 0xEF, 0xFF, 0xE3, 0xFF, 0xE0, 0xFF, 0xE0, 0x1F, 0xC0, 0x0F,
+  0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
+  0x3F, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0xCF, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF,
+  0xFF, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x80, 0xC7, 0xC7, 0xFF,
+  0x87, 0xBF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0, 0xFF,
+  0xC1, 0xFC, 0x00, 0xFE, 0x07, 0xC0, 0x01, 0xF8, 0x1E, 0x00, 0x03, 0xE0,
+  0xF8, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x3C, 0x78,
+  0x00, 0x00, 0x79, 0xE0, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x07, 0x9E, 0x00,
+  0x00, 0x1E, 0x78, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x01, 0xE7, 0x80, 0x00,
+  0x07, 0x9F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x07,
+  0xC1, 0xE0, 0x00, 0x3E, 0x07, 0xC0, 0x01, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0,
+  0xFF, 0xC0, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x9F, 0x7F, 0xFF, 0xBF, 0x38,
+  0x7F, 0xF8, 0x78, 0xC0, 0x7F, 0x80, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
+  0x0F, 0xE0, 0xFC, 0x3F, 0x83, 0xE0, 0xFE, 0x0F, 0x83, 0xF8, 0x3E, 0x0F,
+  0xE0, 0xF8, 0x3F, 0x83, 0xE0, 0xFE, 0x0F, 0x83, 0xF8, 0x00, 0x0F, 0xE0,
+  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00,
+  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFF, 0xFC, 0x3F, 0xE0, 0x7F, 0xC7, 0xF0, 0x07, 0xF9, 0xFC,
+  0x00, 0x7F, 0x3F, 0x80, 0x07, 0xE7, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF,
+  0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xDF, 0xE0, 0x07, 0xF3, 0xFF, 0x03,
+  0xFE, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xFF, 0x00,
+  0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F,
+  0xC0, 0xFE, 0x3F, 0x81, 0xFC, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x80, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x07, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xF8, 0x7E, 0xFF, 0xF9, 0xF8, 0x3F, 0xFB, 0xF0, 0x1F,
+  0xF7, 0xE0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0xDF, 0xF8, 0x1F,
+  0x9F, 0xFE, 0x7E, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80,
+  0x07, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFE, 0x7F, 0x01, 0xFC, 0xFE, 0x03, 0xF9, 0xFF, 0x0F, 0xF1, 0xFF,
+  0xFF, 0xC1, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x7F,
+  0x80, 0x38, 0x0E, 0x3E, 0x0F, 0xBF, 0x8F, 0xFF, 0xC7, 0xFF, 0xE3, 0xFB,
+  0xE0, 0xF8, 0xE0, 0x38, 0x0F, 0xC0, 0x7E, 0x00, 0xFC, 0x1F, 0x80, 0x0F,
+  0xC7, 0xE0, 0x00, 0xFD, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0,
+  0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0x80,
+  0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x3F, 0xE0,
+  0x7F, 0xC7, 0xF0, 0x03, 0xF9, 0xFC, 0x00, 0x7F, 0x3F, 0x80, 0x07, 0xF7,
+  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xF8,
+  0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x1F,
+  0xDF, 0xE0, 0x07, 0xF3, 0xFF, 0x03, 0xFE, 0x3F, 0xFF, 0xFF, 0x83, 0xFF,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x07, 0xFF,
+  0xFF, 0x81, 0xFF, 0xFF, 0xF8, 0x7F, 0xC0, 0xFF, 0x8F, 0xE0, 0x0F, 0xF3,
+  0xF8, 0x00, 0xFE, 0x7F, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x0F,
+  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
+  0xE0, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0F,
+  0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xBF, 0xC0, 0x0F, 0xE7, 0xFE,
+  0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07,
+  0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x3F, 0x07, 0xC0,
+  0x01, 0xF8, 0xFC, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01,
+  0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
+  0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00,
+  0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0xFC, 0x01, 0xF8, 0x7E, 0x00, 0x3F,
+  0x3F, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xF0, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
+  0xE0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00,
+  0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0,
+  0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0x0F, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8,
+  0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F,
+  0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
+  0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xE0,
+  0x07, 0xFC, 0x0F, 0xFF, 0x87, 0xFF, 0xC7, 0xFF, 0xF3, 0xF1, 0xFB, 0xF0,
+  0x7F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x83, 0xE7,
+  0xE3, 0xF1, 0xFF, 0xF0, 0xFF, 0xF0, 0x1F, 0xF0, 0x07, 0xE0, 0x00, 0x00,
+  0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0x00, 0xFE, 0x3F, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x07, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xF8, 0xFE, 0x7F, 0x80, 0xFE, 0xFF,
+  0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x01, 0xFE, 0xFE, 0x01, 0xFE, 0xFF,
+  0x07, 0xFE, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x3F, 0xFE, 0xFE, 0x1F,
+  0xFC, 0xFE, 0x07, 0xF0, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00,
+  0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFE, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x1C, 0x0F, 0xE7, 0xF1,
+  0xF8, 0x7C, 0x1F, 0x07, 0xC1, 0xFF, 0x7F, 0xCF, 0xF0, 0xF8, 0x1F, 0xC0,
+  0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0,
+  0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xCC, 0x7F, 0xF1, 0xFF,
+  0xCF, 0xFF, 0xFF, 0xE3, 0xFF, 0x0F, 0xFC, 0x37, 0xF0, 0x1F, 0xC0, 0x7F,
+  0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F,
+  0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x00, 0x1F, 0xC7,
+  0xE3, 0xF0, 0xFC, 0x7E, 0x1F, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7F, 0xF8,
+  0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x1E, 0xFE, 0x3D,
+  0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F,
+  0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0,
+  0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F,
+  0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8,
+  0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00,
+  0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F,
+  0xFE, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xC1,
+  0xFE, 0x7F, 0x01, 0xFC, 0xFE, 0x01, 0xF9, 0xFC, 0x00, 0x03, 0xFC, 0x00,
+  0x07, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC,
+  0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xE0, 0x1F, 0xDF, 0xC0, 0x7F, 0xBF, 0xFF, 0xFE, 0x3F,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x01,
+  0x80, 0x00, 0xFC, 0x07, 0xEF, 0xC1, 0xF8, 0xFC, 0x7E, 0x0F, 0xDF, 0x80,
+  0xFF, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x3C, 0x1C, 0x0F,
+  0xC7, 0xF0, 0xF8, 0x3C, 0x1E, 0x1F, 0xFF, 0x7F, 0x3E, 0x00, 0x1F, 0x81,
+  0xF8, 0x3F, 0x07, 0xE0, 0x3F, 0x0F, 0xC0, 0x3F, 0x3F, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xFC, 0x03,
+  0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x83, 0xFC, 0xFE,
+  0x03, 0xF9, 0xFC, 0x03, 0xF3, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFF,
+  0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xC0, 0x3F, 0xBF, 0x80, 0xFF, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8,
+  0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0xC3,
+  0xFF, 0xFF, 0x8F, 0xF0, 0x7F, 0x9F, 0xC0, 0x7F, 0x3F, 0x80, 0x7E, 0x7F,
+  0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x01, 0xFF,
+  0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x07,
+  0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x07, 0xF7, 0xF0, 0x1F,
+  0xEF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0,
+  0x07, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00,
+  0x07, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x1F, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00,
+  0x07, 0xC3, 0xF8, 0xF8, 0x7F, 0x1E, 0x0F, 0xE3, 0xC1, 0xFC, 0x00, 0x3F,
+  0x80, 0x07, 0xF0, 0x0F, 0xFF, 0xF1, 0xFF, 0xFE, 0x3F, 0xFF, 0xC7, 0xFF,
+  0xF8, 0xFF, 0xFF, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE,
+  0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC,
+  0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8,
+  0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF,
+  0x80, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00,
+  0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x80,
+  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F,
+  0xE0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00,
+  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F,
+  0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC7, 0xE1,
+  0xF8, 0xFC, 0x3F, 0x0F, 0x83, 0xE1, 0xF0, 0x7C, 0x3E, 0x0F, 0xC7, 0xE0,
+  0xF8, 0xFC, 0x00, 0x7E, 0x03, 0xF0, 0xFC, 0x1F, 0x81, 0xF8, 0xFC, 0x07,
+  0xE7, 0xF0, 0x0F, 0xDF, 0x80, 0x1F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+  0x80, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
+  0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x78, 0x00,
+  0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x03,
+  0xF0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF,
+  0xFF, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x03,
+  0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0,
+  0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
+  0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x00, 0x7F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x3F,
+  0xFF, 0xFF, 0xC7, 0xF0, 0x07, 0xFC, 0xFE, 0x00, 0x7F, 0x9F, 0xC0, 0x07,
+  0xFB, 0xF8, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xEF, 0xE0, 0x01, 0xFD, 0xFC,
+  0x00, 0x3F, 0xBF, 0x80, 0x07, 0xF7, 0xF0, 0x01, 0xFE, 0xFE, 0x00, 0x7F,
+  0x9F, 0xC0, 0x1F, 0xF3, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x07, 0xF0, 0x3F, 0xC0,
+  0xFE, 0x07, 0xF8, 0x1F, 0xC0, 0x7F, 0x83, 0xF8, 0x0F, 0xF0, 0x7F, 0x00,
+  0xFF, 0x0F, 0xE0, 0x1F, 0xE1, 0xFC, 0x01, 0xFE, 0x3F, 0x80, 0x1F, 0xC7,
+  0xF0, 0x03, 0xFC, 0xFE, 0x00, 0x3F, 0x9F, 0xC0, 0x07, 0xFB, 0xF8, 0x00,
+  0x7F, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC,
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFE,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x7F,
+  0x00, 0x00, 0xFE, 0x7F, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFC, 0x3F,
+  0x80, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xF8, 0x1F,
+  0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x07, 0xF8, 0x1F, 0xE0, 0x07, 0xF0, 0x0F,
+  0xE0, 0x07, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x01,
+  0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
+  0xFE, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0xFC, 0x3F,
+  0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC,
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFE,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x7F,
+  0x00, 0x00, 0xFE, 0x7F, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFC, 0x3F,
+  0x80, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xF8, 0x1F,
+  0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x07, 0xF8, 0x1F, 0xE0, 0x07, 0xF0, 0x0F,
+  0xE0, 0x07, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x01,
+  0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
+  0xFE, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0xFC, 0x1F,
+  0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFC,
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xFC,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
+  0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0x7F,
+  0x80, 0x00, 0xFE, 0x3F, 0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFC, 0x3F,
+  0xC0, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x1F,
+  0xE0, 0x07, 0xF8, 0x0F, 0xE0, 0x07, 0xF8, 0x0F, 0xE0, 0x07, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x07, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFC, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0x80, 0x01,
+  0xFE, 0x7F, 0x80, 0x00, 0xFE, 0x7F, 0x80, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x38, 0x0E,
+  0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0xFE, 0x3F,
+  0x80, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x38, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFE,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
+  0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0xFF, 0x7F,
+  0x80, 0x00, 0xFE, 0x3F, 0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFE, 0x3F,
+  0xC0, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03, 0xFC, 0x1F,
+  0xE0, 0x03, 0xF8, 0x0F, 0xE0, 0x07, 0xF8, 0x0F, 0xE0, 0x07, 0xF8, 0x0F,
+  0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFC, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0xC0, 0x01,
+  0xFE, 0x7F, 0x80, 0x00, 0xFE, 0x7F, 0x80, 0x00, 0xFE, 0x7F, 0x80, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00,
+  0x7E, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8,
+  0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
+  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00,
+  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0,
+  0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x0F, 0xE1,
+  0xFC, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x3F, 0x9F,
+  0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00,
+  0x07, 0xF3, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0xC7, 0xF8, 0x00,
+  0x7F, 0x07, 0xF8, 0x01, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFC,
+  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
+  0x01, 0xFF, 0x03, 0xFE, 0x07, 0xF8, 0x01, 0xFE, 0x1F, 0xE0, 0x01, 0xFE,
+  0x3F, 0x80, 0x03, 0xFC, 0xFF, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x07, 0xFB,
+  0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0xFF, 0x7F, 0x80, 0x01, 0xFC, 0x7F, 0x00, 0x07, 0xF8, 0xFF, 0x00,
+  0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x81, 0xFF, 0x01, 0xFF, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x80,
+  0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x03, 0xF7, 0xE0, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F,
+  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8,
+  0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF1, 0xFC, 0x00,
+  0x1F, 0xE7, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x3F, 0xDF, 0xC0, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF3,
+  0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x7F, 0x07,
+  0xF8, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00,
+  0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+  0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00,
+  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF,
+  0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE,
+  0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
+  0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xFE, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x03,
+  0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x01,
+  0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7E, 0x07, 0x01, 0xC0, 0x1F, 0x07,
+  0xC0, 0x7F, 0x1F, 0xC0, 0xFE, 0x3F, 0x81, 0xFC, 0x7F, 0x01, 0xF0, 0x7C,
+  0x01, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8,
+  0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80,
+  0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+  0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x80, 0x00,
+  0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07,
+  0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x03, 0xF8, 0x3F, 0x07, 0xE0, 0x3F,
+  0x1F, 0x80, 0x3F, 0x7E, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07,
+  0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x7F, 0x00,
+  0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+  0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x0F, 0xC3, 0xF8, 0x7E, 0x0F, 0x83, 0xE0, 0x7C, 0x1F,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87,
+  0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0,
+  0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE,
+  0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F,
+  0xC3, 0xF8, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x1F, 0xF0, 0x07,
+  0xFF, 0x01, 0xFB, 0xF0, 0x7E, 0x3F, 0x1F, 0x83, 0xF7, 0xE0, 0x3F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07,
+  0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
+  0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F,
+  0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F,
+  0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F,
+  0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE,
+  0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC,
+  0x00, 0x3F, 0x80, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x03, 0xE3,
+  0xF0, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0x80,
+  0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xF0, 0xFE, 0x00, 0xFF, 0x87, 0xF0, 0x01, 0xFE, 0x3F, 0x80, 0x07, 0xF9,
+  0xFC, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x7F, 0x7F, 0x00, 0x03, 0xFB, 0xF8,
+  0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F,
+  0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE,
+  0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xBF, 0x80, 0x01, 0xFD, 0xFC, 0x00,
+  0x0F, 0xEF, 0xE0, 0x00, 0xFE, 0x7F, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0xFF,
+  0x1F, 0xC0, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x07,
+  0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
+  0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFC, 0x01, 0xFF,
+  0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x03, 0xFC, 0x07, 0xF0, 0x00,
+  0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x03, 0xF8, 0x1F, 0xC0,
+  0x00, 0xFE, 0x07, 0xF0, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
+  0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+  0xFF, 0xE0, 0x07, 0xF0, 0x7F, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x7F,
+  0x07, 0xF0, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x03,
+  0xF8, 0x1F, 0xC0, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x3F, 0x81, 0xFC, 0x00,
+  0x1F, 0xC0, 0x7F, 0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x07, 0xF8, 0x07, 0xF0,
+  0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F,
+  0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+  0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xDF, 0xE0, 0x7F, 0xFE, 0xFF, 0x83, 0xFF, 0xF3, 0xFE, 0x1F, 0xFF, 0x8F,
+  0xF0, 0xFF, 0xFC, 0x3F, 0xC7, 0xFF, 0xE1, 0xFF, 0x3F, 0xFF, 0x07, 0xFD,
+  0xFF, 0xF8, 0x1F, 0xEF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0,
+  0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x01,
+  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF,
+  0xFC, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x3F, 0x00, 0x1F, 0x83, 0xF0, 0x00,
+  0x7E, 0x3F, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F,
+  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0,
+  0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
+  0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x01, 0xFF,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0xFF, 0x03, 0xFF, 0xF7,
+  0xFC, 0x1F, 0xFF, 0x9F, 0xF0, 0xFF, 0xFC, 0x7F, 0x87, 0xFF, 0xE1, 0xFE,
+  0x3F, 0xFF, 0x0F, 0xF9, 0xFF, 0xF8, 0x3F, 0xEF, 0xFF, 0xC0, 0xFF, 0x7F,
+  0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F,
+  0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x1F, 0x80,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0,
+  0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0, 0x1F, 0xE0, 0x07, 0xF8,
+  0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x7F, 0x80, 0x01, 0xFE,
+  0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFF,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x80, 0x01, 0xFE,
+  0x3F, 0x80, 0x01, 0xFC, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xE0, 0x07, 0xF8,
+  0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0,
+  0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
+  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7E, 0x7E, 0x00,
+  0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x03, 0xF8, 0x1F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x1F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0x80, 0x01, 0xFC,
+  0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0x7F, 0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0xC0, 0x03, 0xFC,
+  0x1F, 0xE0, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xC3, 0xE0,
+  0x00, 0x1F, 0x87, 0xE0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x3F, 0x1F, 0x80,
+  0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x1F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0x80, 0x01, 0xFC,
+  0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0x7F, 0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0xC0, 0x03, 0xFC,
+  0x1F, 0xE0, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0xF8, 0x1F, 0x00,
+  0x01, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0x80,
+  0x00, 0xF8, 0x1F, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x1F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0x80, 0x01, 0xFC,
+  0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
+  0x7F, 0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0xC0, 0x03, 0xFC,
+  0x1F, 0xE0, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x08, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x0F, 0x80,
+  0x0F, 0x0F, 0xE0, 0x0F, 0xCF, 0xF8, 0x0F, 0xF3, 0xFE, 0x0F, 0xF8, 0xFF,
+  0x8F, 0xF8, 0x3F, 0xEF, 0xF8, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x00,
+  0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFE, 0x00,
+  0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x0F, 0xFB, 0xFE,
+  0x0F, 0xF8, 0xFF, 0x8F, 0xF8, 0x3F, 0xEF, 0xF8, 0x0F, 0xF3, 0xF8, 0x03,
+  0xF0, 0xF8, 0x00, 0xF0, 0x30, 0x00, 0x30, 0x1F, 0x80, 0xFC, 0x01, 0xF8,
+  0x3F, 0x00, 0x1F, 0x8F, 0xC0, 0x01, 0xFB, 0xF0, 0x00, 0x1F, 0xFC, 0x00,
+  0x01, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+  0xF8, 0xFE, 0x00, 0xFF, 0x9F, 0xC0, 0x0F, 0xF3, 0xF8, 0x00, 0xFF, 0x7F,
+  0x00, 0x0F, 0xEF, 0xE0, 0x01, 0xFD, 0xFC, 0x00, 0x3F, 0xBF, 0x80, 0x07,
+  0xF7, 0xF0, 0x00, 0xFE, 0xFE, 0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xF3, 0xF8,
+  0x03, 0xFE, 0x7F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x80, 0xFE, 0x07, 0xF8, 0x1F, 0xC0,
+  0xFF, 0x03, 0xF8, 0x0F, 0xF0, 0x7F, 0x01, 0xFE, 0x0F, 0xE0, 0x1F, 0xE1,
+  0xFC, 0x03, 0xFC, 0x3F, 0x80, 0x3F, 0xC7, 0xF0, 0x03, 0xF8, 0xFE, 0x00,
+  0x7F, 0x9F, 0xC0, 0x07, 0xF3, 0xF8, 0x00, 0xFF, 0x7F, 0x00, 0x0F, 0xEF,
+  0xE0, 0x01, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x07, 0x9E, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x07, 0x0E, 0x00,
+  0x00, 0x79, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0x7F,
+  0x80, 0x1F, 0xE3, 0xFE, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00,
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xE7, 0xF0, 0x00,
+  0xFE, 0x7F, 0x80, 0x1F, 0xE3, 0xFE, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F,
+  0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x03, 0xF1, 0xF8, 0x00, 0x3E, 0x1F,
+  0x00, 0x07, 0xC3, 0xE0, 0x00, 0xFC, 0x7E, 0x00, 0x0F, 0x8F, 0xC0, 0x01,
+  0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xE7,
+  0xF0, 0x00, 0xFE, 0x7F, 0x80, 0x1F, 0xE3, 0xFE, 0x07, 0xFC, 0x1F, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80,
+  0x00, 0x7F, 0xC0, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x1F, 0x07, 0xC0, 0x03,
+  0xF8, 0xFE, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x1F, 0x07,
+  0xC0, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xFE, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00,
+  0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0x7F, 0x80, 0x1F, 0xE3, 0xFE, 0x07, 0xFC,
+  0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
+  0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xE0, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x1F, 0xE1,
+  0xFE, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFE, 0x03, 0xFC,
+  0x00, 0x7F, 0x83, 0xFC, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x0F, 0xF1, 0xFE,
+  0x00, 0x03, 0xF8, 0xFE, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x7F, 0x7F,
+  0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF,
+  0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F,
+  0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xFF,
+  0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x7F,
+  0xFF, 0xFE, 0x1F, 0xF0, 0x7F, 0x8F, 0xF0, 0x0F, 0xF3, 0xF8, 0x01, 0xFC,
+  0xFE, 0x00, 0x7F, 0x3F, 0x80, 0x1F, 0xCF, 0xE0, 0x07, 0xF3, 0xF8, 0x01,
+  0xFC, 0xFE, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x0F, 0xE1, 0xFF, 0x83, 0xF8,
+  0x7F, 0x80, 0xFE, 0x1F, 0xF8, 0x3F, 0x87, 0xFF, 0x8F, 0xE1, 0xFF, 0xF3,
+  0xF8, 0x03, 0xFE, 0xFE, 0x00, 0x3F, 0xBF, 0x80, 0x0F, 0xFF, 0xE0, 0x01,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0,
+  0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xBF, 0x87, 0xFF, 0xEF,
+  0xE1, 0xFF, 0xF3, 0xF8, 0x7F, 0xF8, 0xFE, 0x1F, 0xFC, 0x3F, 0x87, 0xF8,
+  0x00, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0xF0, 0x03, 0xF0, 0x03,
+  0xE0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xFE,
+  0x7F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0xFF,
+  0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
+  0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
+  0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
+  0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0x00,
+  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xE1, 0xFE, 0x7F,
+  0x00, 0xFE, 0x7E, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x01,
+  0xFF, 0xE0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7F, 0xF8,
+  0xFE, 0xFF, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x1F,
+  0xFF, 0xC0, 0x3F, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE,
+  0x7F, 0xFD, 0xFC, 0x7F, 0xF3, 0xF8, 0x3F, 0x87, 0xF0, 0x00, 0x7F, 0x00,
+  0x01, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0x7E, 0x00,
+  0xFC, 0x7E, 0x03, 0xF0, 0x7E, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFE, 0x01, 0xFF,
+  0xFE, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F, 0xC3, 0xFC, 0xFE, 0x01,
+  0xFC, 0xFC, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFF,
+  0xC1, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0xFF, 0xF1, 0xFD,
+  0xFE, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFB, 0xF8, 0xFF, 0xE7, 0xF0, 0x7F, 0x0F, 0xE0, 0x0F, 0x80, 0xF8, 0x1F,
+  0x01, 0xF0, 0x3F, 0x07, 0xE0, 0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x3F,
+  0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFF, 0x1F, 0xE1, 0xFE, 0x7F, 0x00, 0xFE, 0x7E, 0x01, 0xFC,
+  0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xE0, 0xFF, 0xFF, 0xC7,
+  0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7F, 0xF8, 0xFE, 0xFF, 0x01, 0xFF, 0xFC,
+  0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x7F, 0xFD, 0xFC, 0x7F, 0xF3,
+  0xF8, 0x3F, 0x87, 0xF0, 0x03, 0x80, 0xE0, 0x0F, 0x83, 0xE0, 0x3F, 0x8F,
+  0xE0, 0x7F, 0x1F, 0xC0, 0xFE, 0x3F, 0x80, 0xF8, 0x3E, 0x00, 0xE0, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xFE, 0x3F, 0xC3, 0xFC, 0xFE, 0x01, 0xFC, 0xFC, 0x03, 0xF8, 0x00,
+  0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xC1, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xFF, 0x3F, 0xFF, 0xFE, 0xFF, 0xF1, 0xFD, 0xFE, 0x03, 0xFF, 0xF8, 0x07,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFF,
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFB, 0xF8, 0xFF, 0xE7, 0xF0,
+  0x7F, 0x0F, 0xE0, 0x0F, 0xC3, 0xF8, 0x7E, 0x1F, 0x83, 0xE0, 0x7C, 0x1F,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87,
+  0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0,
+  0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE,
+  0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F,
+  0xC3, 0xF8, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
+  0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x80, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xFE, 0x3F, 0xC1, 0xFE, 0x7F, 0x80, 0xFF, 0x7F, 0x00, 0x7F, 0x7F, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFF, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x80, 0xFF, 0x3F, 0xC1,
+  0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF,
+  0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF,
+  0xE0, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x3F, 0xC1,
+  0xFE, 0x7F, 0x80, 0xFF, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0xFE, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x3F, 0x7F, 0x00, 0x7F, 0x7F, 0x80, 0x7F, 0x3F, 0xC0, 0xFE, 0x3F, 0xFF,
+  0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x01, 0xFF,
+  0xC0, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+  0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x81,
+  0xFC, 0x0F, 0xC1, 0xF8, 0x07, 0xE3, 0xF0, 0x03, 0xF7, 0xE0, 0x01, 0xFF,
+  0xC0, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xE0, 0x07, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x3F, 0xC1, 0xFE, 0x7F, 0x80,
+  0xFE, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x7F, 0x00,
+  0x7F, 0x7F, 0x80, 0xFF, 0x3F, 0xC1, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x0C,
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
+  0xF0, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+  0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8,
+  0x7F, 0x83, 0xFC, 0x7F, 0x80, 0xFF, 0x3F, 0x80, 0x3F, 0x9F, 0x80, 0x1F,
+  0xDF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0xFF,
+  0x03, 0xFC, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x01,
+  0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7F, 0x80,
+  0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+  0xE1, 0xFE, 0x0F, 0xF1, 0xFE, 0x03, 0xFC, 0xFE, 0x00, 0xFE, 0x7E, 0x00,
+  0x7F, 0x7F, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xF3,
+  0xFC, 0x0F, 0xF1, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xE0,
+  0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03,
+  0x80, 0xE0, 0x03, 0xE0, 0xF8, 0x03, 0xF8, 0xFE, 0x01, 0xFC, 0x7F, 0x00,
+  0xFE, 0x3F, 0x80, 0x3E, 0x0F, 0x80, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFC,
+  0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x7F, 0x83,
+  0xFC, 0x7F, 0x80, 0xFF, 0x3F, 0x80, 0x3F, 0x9F, 0x80, 0x1F, 0xDF, 0xC0,
+  0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
+  0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0xFF, 0x03, 0xFC,
+  0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0x80, 0xFC, 0x07, 0xE0,
+  0xFC, 0x01, 0xF8, 0xFE, 0x00, 0xFC, 0xFE, 0x00, 0x3F, 0x7E, 0x00, 0x0F,
+  0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFE, 0x00,
+  0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xC1, 0xFE,
+  0x3F, 0xC0, 0x7F, 0x9F, 0xC0, 0x1F, 0xCF, 0xC0, 0x0F, 0xEF, 0xE0, 0x03,
+  0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
+  0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x01, 0xFE, 0x7F, 0x81, 0xFE, 0x3F,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFE, 0x00, 0x00, 0x20, 0x00, 0x0F, 0xC3, 0xF8, 0x7E, 0x1F, 0x83,
+  0xE0, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x0F, 0xE1,
+  0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC,
+  0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F,
+  0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x00, 0x01, 0xF0, 0x00, 0x7F,
+  0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x01, 0xFB, 0xE0, 0x7E, 0x7E, 0x0F, 0xC7,
+  0xE3, 0xF0, 0x7E, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
+  0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8,
+  0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0,
+  0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
+  0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0,
+  0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
+  0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xE3,
+  0xE0, 0x00, 0x07, 0xF1, 0xF0, 0x00, 0x03, 0xF8, 0xF8, 0x00, 0x01, 0xFC,
+  0x7C, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x00, 0x7F, 0x1E, 0x00, 0x00, 0x3F,
+  0x8F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0xFF, 0xE7,
+  0xF0, 0x00, 0xFF, 0xFB, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
+  0xFE, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x80, 0x3F, 0x80,
+  0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x1F, 0xC0, 0x07, 0xF0, 0x0F, 0xE0,
+  0x03, 0xF8, 0x07, 0xF0, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFC,
+  0x00, 0x7F, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x1F, 0xC0, 0x3F,
+  0x80, 0x0F, 0xE0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF0, 0x07, 0xF8, 0x03,
+  0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFF, 0xBF, 0x80, 0x07, 0xFF, 0xDF, 0xC0, 0x01, 0xFF, 0xCF, 0xE0,
+  0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8,
+  0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x3F,
+  0x80, 0x7F, 0xF3, 0xF8, 0x0F, 0xFF, 0xBF, 0x81, 0xFF, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xFF, 0x83, 0xFC, 0x1F, 0xF8, 0x7F, 0x80, 0xFF, 0x87, 0xF0, 0x07,
+  0xF8, 0xFF, 0x00, 0x7F, 0x8F, 0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0x8F,
+  0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xF8, 0xFE, 0x00,
+  0x3F, 0x8F, 0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0x8F, 0xF0, 0x07, 0xF8,
+  0x7F, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xF8, 0x3F, 0xC1, 0xFF, 0x83, 0xFF,
+  0xFF, 0xF8, 0x1F, 0xFF, 0xBF, 0x80, 0xFF, 0xFB, 0xF8, 0x07, 0xFF, 0x3F,
+  0x80, 0x1F, 0xC3, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
+  0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F,
+  0xC0, 0xFE, 0x7F, 0xF0, 0xFE, 0xFF, 0xF8, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xC3,
+  0xF0, 0x07, 0xE7, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x1F, 0xC0, 0xFE, 0x7F, 0xF0, 0xFE, 0xFF, 0xF8, 0xFE, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x07,
+  0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x01,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0x00,
+  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x7F, 0x83, 0xFC, 0x7F, 0x80, 0xFF,
+  0x3F, 0x80, 0x3F, 0x9F, 0xC0, 0x1F, 0xDF, 0xC0, 0x07, 0xFF, 0xE0, 0x03,
+  0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00,
+  0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x0F, 0xE7, 0xF0,
+  0x07, 0xF3, 0xFC, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0x7F, 0xFF, 0xFC, 0x1F,
+  0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xE0,
+  0x00, 0x3F, 0xF8, 0x00, 0x3F, 0x7E, 0x00, 0x3F, 0x1F, 0x00, 0x1F, 0x8F,
+  0xC0, 0x1F, 0x83, 0xF0, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x7F,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x3F, 0xC1, 0xFE, 0x3F, 0xC0, 0x7F, 0x9F,
+  0xC0, 0x1F, 0xCF, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
+  0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x07, 0xF3, 0xF8, 0x03,
+  0xF9, 0xFE, 0x03, 0xFC, 0x7F, 0x83, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF,
+  0xFE, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x3E, 0x1F, 0x80, 0x3F, 0x1F, 0x80,
+  0x3F, 0x1F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x8F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
+  0xF0, 0x7F, 0x83, 0xFC, 0x7F, 0x80, 0xFF, 0x3F, 0x80, 0x3F, 0x9F, 0xC0,
+  0x1F, 0xDF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8,
+  0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xE0, 0x0F, 0xE7, 0xF0, 0x07, 0xF3, 0xFC, 0x07, 0xF8,
+  0xFF, 0x07, 0xF8, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x80, 0x00, 0x03, 0x80,
+  0xE0, 0x03, 0xE0, 0xF8, 0x03, 0xF8, 0xFE, 0x01, 0xFC, 0x7F, 0x00, 0xFE,
+  0x3F, 0x80, 0x3E, 0x0F, 0x80, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFC, 0x00,
+  0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x7F, 0x83, 0xFC,
+  0x7F, 0x80, 0xFF, 0x3F, 0x80, 0x3F, 0x9F, 0xC0, 0x1F, 0xDF, 0xC0, 0x07,
+  0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0,
+  0x0F, 0xE7, 0xF0, 0x07, 0xF3, 0xFC, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0x7F,
+  0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x00,
+  0x3F, 0xF8, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x3C, 0x00, 0xFC, 0x07, 0xEF, 0xC1, 0xF8, 0xFC, 0x3F, 0x0F, 0xCF,
+  0xC0, 0xFF, 0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x01, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xE3, 0xF9, 0xFC, 0x7F, 0x7F,
+  0x8F, 0xFF, 0xF1, 0xFF, 0xFE, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x00,
+  0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
+  0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00,
+  0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00,
+  0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFF,
+  0x00, 0x01, 0xFF, 0x80, 0x03, 0xC3, 0xC0, 0x03, 0x81, 0xC0, 0x03, 0x81,
+  0xC0, 0x03, 0x81, 0xC0, 0x03, 0xC3, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x01,
+  0xFF, 0x7F, 0x83, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF,
+  0x7F, 0x0F, 0xFE, 0x7F, 0x03, 0xF0, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
+  0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x01,
+  0xFF, 0x7F, 0x83, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF,
+  0x7F, 0x0F, 0xFE, 0x7F, 0x03, 0xF0, 0x7F, 0x00, 0x7E, 0x3F, 0x00, 0x7E,
+  0x1F, 0x00, 0x7E, 0x1F, 0x80, 0x3E, 0x1F, 0x80, 0x3F, 0x1F, 0x80, 0x3F,
+  0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x80, 0x1F, 0xDF, 0xC0, 0x0F, 0xEF, 0xE0, 0x07, 0xF7,
+  0xF0, 0x03, 0xFB, 0xF8, 0x01, 0xFD, 0xFC, 0x00, 0xFE, 0xFE, 0x00, 0x7F,
+  0x7F, 0x00, 0x3F, 0xBF, 0x80, 0x1F, 0xDF, 0xC0, 0x0F, 0xEF, 0xE0, 0x07,
+  0xF7, 0xF0, 0x03, 0xFB, 0xF8, 0x01, 0xFD, 0xFC, 0x00, 0xFE, 0xFE, 0x00,
+  0x7F, 0x7F, 0x00, 0x3F, 0xBF, 0x80, 0x1F, 0xDF, 0xC0, 0x0F, 0xEF, 0xF0,
+  0x0F, 0xF7, 0xF8, 0x0F, 0xF9, 0xFE, 0x0F, 0xFC, 0xFF, 0xFF, 0xFE, 0x3F,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0x83, 0xFF, 0x9F, 0xC0, 0x7E, 0x0F, 0xE0,
+  0x07, 0x01, 0xC0, 0x0F, 0x83, 0xE0, 0x1F, 0xC7, 0xF0, 0x1F, 0xC7, 0xF0,
+  0x1F, 0xC7, 0xF0, 0x0F, 0x83, 0xE0, 0x07, 0x01, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
+  0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
+  0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
+  0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
+  0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
+  0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0x7F, 0x83, 0xFF, 0x7F, 0xFF, 0xFF,
+  0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0x7F, 0x0F, 0xFE, 0x7F, 0x03, 0xF0, 0x7F,
+  0x00, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFD,
+  0xFC, 0x00, 0xFF, 0x7F, 0x00, 0x3F, 0x9F, 0xE0, 0x0F, 0xE3, 0xF8, 0x07,
+  0xF8, 0xFE, 0x01, 0xFC, 0x3F, 0x80, 0x7F, 0x07, 0xF0, 0x3F, 0xC1, 0xFC,
+  0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x0F, 0xC0, 0xFE, 0x03, 0xF8, 0x7F, 0x00,
+  0xFE, 0x1F, 0xC0, 0x1F, 0x87, 0xE0, 0x07, 0xF3, 0xF8, 0x01, 0xFC, 0xFE,
+  0x00, 0x3F, 0x3F, 0x00, 0x0F, 0xCF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0x7F,
+  0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00,
+  0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE,
+  0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
+  0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8,
+  0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x03, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xBF, 0xFF, 0xC1, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00,
+  0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC,
+  0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+  0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xE0, 0x7F, 0xF0, 0x3F, 0xF8, 0x07, 0xFC,
+  0x01, 0xFC, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x1F, 0xC0, 0x01, 0xF0, 0x00,
+  0x78, 0x00, 0x3C, 0x00, 0x3E, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x78, 0x00,
+  0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C };
+
+const GFXglyph InterTight_Bold24pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   9,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   8,  34,  14,    3,  -33 },   // 0x21 '!' U+0021
+  {    35,  16,  14,  24,    4,  -33 },   // 0x22 '"' U+0022
+  {    63,  29,  34,  29,    0,  -33 },   // 0x23 '#' U+0023
+  {   187,  27,  43,  29,    1,  -38 },   // 0x24 '$' U+0024
+  {   333,  33,  36,  39,    3,  -34 },   // 0x25 '%' U+0025
+  {   482,  30,  35,  30,    1,  -33 },   // 0x26 '&' U+0026
+  {   614,   6,  14,  14,    4,  -33 },   // 0x27 ''' U+0027
+  {   625,  12,  42,  16,    3,  -35 },   // 0x28 '(' U+0028
+  {   688,  12,  42,  16,    1,  -35 },   // 0x29 ')' U+0029
+  {   751,  18,  19,  26,    4,  -33 },   // 0x2a '*' U+002A
+  {   794,  24,  24,  30,    3,  -25 },   // 0x2b '+' U+002B
+  {   866,   9,  14,  15,    2,   -3 },   // 0x2c ',' U+002C
+  {   882,  16,   5,  20,    2,  -15 },   // 0x2d '-' U+002D
+  {   892,   8,   8,  14,    3,   -7 },   // 0x2e '.' U+002E
+  {   900,  17,  41,  17,    0,  -35 },   // 0x2f '/' U+002F
+  {   988,  28,  34,  32,    2,  -33 },   // 0x30 '0' U+0030
+  {  1107,  15,  34,  18,    1,  -33 },   // 0x31 '1' U+0031
+  {  1171,  25,  34,  29,    2,  -33 },   // 0x32 '2' U+0032
+  {  1278,  26,  34,  30,    2,  -33 },   // 0x33 '3' U+0033
+  {  1389,  28,  34,  30,    1,  -33 },   // 0x34 '4' U+0034
+  {  1508,  25,  34,  29,    2,  -33 },   // 0x35 '5' U+0035
+  {  1615,  27,  34,  31,    2,  -33 },   // 0x36 '6' U+0036
+  {  1730,  24,  34,  26,    1,  -33 },   // 0x37 '7' U+0037
+  {  1832,  26,  34,  30,    2,  -33 },   // 0x38 '8' U+0038
+  {  1943,  27,  35,  31,    2,  -33 },   // 0x39 '9' U+0039
+  {  2062,   8,  25,  14,    3,  -24 },   // 0x3a ':' U+003A
+  {  2087,  10,  34,  15,    2,  -23 },   // 0x3b ';' U+003B
+  {  2130,  24,  27,  30,    3,  -26 },   // 0x3c '<' U+003C
+  {  2211,  23,  17,  31,    4,  -21 },   // 0x3d '=' U+003D
+  {  2260,  24,  27,  30,    3,  -26 },   // 0x3e '>' U+003E
+  {  2341,  22,  34,  24,    1,  -33 },   // 0x3f '?' U+003F
+  {  2435,  44,  44,  48,    2,  -33 },   // 0x40 '@' U+0040
+  {  2677,  32,  34,  34,    1,  -33 },   // 0x41 'A' U+0041
+  {  2813,  26,  34,  29,    2,  -33 },   // 0x42 'B' U+0042
+  {  2924,  31,  34,  34,    2,  -33 },   // 0x43 'C' U+0043
+  {  3056,  29,  34,  33,    2,  -33 },   // 0x44 'D' U+0044
+  {  3180,  23,  34,  27,    2,  -33 },   // 0x45 'E' U+0045
+  {  3278,  23,  34,  26,    2,  -33 },   // 0x46 'F' U+0046
+  {  3376,  31,  34,  35,    2,  -33 },   // 0x47 'G' U+0047
+  {  3508,  29,  34,  33,    2,  -33 },   // 0x48 'H' U+0048
+  {  3632,   7,  34,  11,    2,  -33 },   // 0x49 'I' U+0049
+  {  3662,  23,  34,  26,    1,  -33 },   // 0x4a 'J' U+004A
+  {  3760,  29,  34,  31,    2,  -33 },   // 0x4b 'K' U+004B
+  {  3884,  22,  34,  25,    2,  -33 },   // 0x4c 'L' U+004C
+  {  3978,  37,  34,  41,    2,  -33 },   // 0x4d 'M' U+004D
+  {  4136,  29,  34,  33,    2,  -33 },   // 0x4e 'N' U+004E
+  {  4260,  32,  34,  36,    2,  -33 },   // 0x4f 'O' U+004F
+  {  4396,  26,  34,  29,    2,  -33 },   // 0x50 'P' U+0050
+  {  4507,  32,  37,  36,    2,  -33 },   // 0x51 'Q' U+0051
+  {  4655,  27,  34,  29,    2,  -33 },   // 0x52 'R' U+0052
+  {  4770,  27,  34,  29,    1,  -33 },   // 0x53 'S' U+0053
+  {  4885,  28,  34,  30,    1,  -33 },   // 0x54 'T' U+0054
+  {  5004,  28,  34,  32,    2,  -33 },   // 0x55 'U' U+0055
+  {  5123,  33,  34,  34,    0,  -33 },   // 0x56 'V' U+0056
+  {  5264,  47,  34,  47,    0,  -33 },   // 0x57 'W' U+0057
+  {  5464,  31,  34,  32,    1,  -33 },   // 0x58 'X' U+0058
+  {  5596,  33,  34,  33,    0,  -33 },   // 0x59 'Y' U+0059
+  {  5737,  26,  34,  30,    2,  -33 },   // 0x5a 'Z' U+005A
+  {  5848,  12,  43,  16,    3,  -36 },   // 0x5b '[' U+005B
+  {  5913,  17,  41,  17,    0,  -35 },   // 0x5c '\' U+005C
+  {  6001,  12,  43,  16,    1,  -36 },   // 0x5d ']' U+005D
+  {  6066,  19,  15,  21,    1,  -33 },   // 0x5e '^' U+005E
+  {  6102,  23,   5,  21,   -1,    1 },   // 0x5f '_' U+005F
+  {  6117,  10,   7,  20,    5,  -35 },   // 0x60 '`' U+0060
+  {  6126,  23,  26,  26,    1,  -25 },   // 0x61 'a' U+0061
+  {  6201,  25,  34,  28,    2,  -33 },   // 0x62 'b' U+0062
+  {  6308,  24,  27,  26,    1,  -25 },   // 0x63 'c' U+0063
+  {  6389,  25,  34,  28,    1,  -33 },   // 0x64 'd' U+0064
+  {  6496,  25,  27,  27,    1,  -25 },   // 0x65 'e' U+0065
+  {  6581,  18,  35,  17,    0,  -34 },   // 0x66 'f' U+0066
+  {  6660,  25,  36,  28,    1,  -25 },   // 0x67 'g' U+0067
+  {  6773,  24,  34,  28,    2,  -33 },   // 0x68 'h' U+0068
+  {  6875,   8,  36,  12,    2,  -35 },   // 0x69 'i' U+0069
+  {  6911,  11,  46,  11,   -2,  -35 },   // 0x6a 'j' U+006A
+  {  6975,  24,  34,  26,    2,  -33 },   // 0x6b 'k' U+006B
+  {  7077,   7,  34,  11,    2,  -33 },   // 0x6c 'l' U+006C
+  {  7107,  37,  26,  41,    2,  -25 },   // 0x6d 'm' U+006D
+  {  7228,  24,  26,  28,    2,  -25 },   // 0x6e 'n' U+006E
+  {  7306,  25,  27,  27,    1,  -25 },   // 0x6f 'o' U+006F
+  {  7391,  25,  36,  28,    2,  -25 },   // 0x70 'p' U+0070
+  {  7504,  25,  36,  28,    1,  -25 },   // 0x71 'q' U+0071
+  {  7617,  16,  26,  18,    2,  -25 },   // 0x72 'r' U+0072
+  {  7669,  23,  27,  25,    1,  -25 },   // 0x73 's' U+0073
+  {  7747,  16,  32,  17,    0,  -31 },   // 0x74 't' U+0074
+  {  7811,  24,  26,  28,    2,  -25 },   // 0x75 'u' U+0075
+  {  7889,  26,  26,  26,    0,  -25 },   // 0x76 'v' U+0076
+  {  7974,  39,  26,  39,    0,  -25 },   // 0x77 'w' U+0077
+  {  8101,  25,  26,  26,    0,  -25 },   // 0x78 'x' U+0078
+  {  8183,  26,  36,  26,    0,  -25 },   // 0x79 'y' U+0079
+  {  8300,  22,  26,  26,    2,  -25 },   // 0x7a 'z' U+007A
+  {  8372,  17,  43,  21,    2,  -36 },   // 0x7b '{' U+007B
+  {  8464,   7,  56,  17,    5,  -44 },   // 0x7c '|' U+007C
+  {  8513,  17,  43,  21,    2,  -36 },   // 0x7d '}' U+007D
+  {  8605,  25,  10,  31,    3,  -17 },   // 0x7e '~' U+007E
+  {     0,   0,   0,  24,    3,  -45 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  8637,   1,   1,   9,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  8638,  33,  43,  34,    1,  -33 },   // 0x81 '0x0104' U+0104
+  {  8816,  17,   7,  21,    2,  -35 },   // 0x82 '0x02D8' U+02D8
+  {  8831,  26,  34,  27,    0,  -33 },   // 0x83 '0x0141' U+0141
+  {  8942,  30,  30,  34,    2,  -29 },   // 0x84 '0x00A4' U+00A4
+  {  9055,  22,  36,  25,    2,  -35 },   // 0x85 '0x013D' U+013D
+  {  9154,  27,  45,  29,    1,  -44 },   // 0x86 '0x015A' U+015A
+  {  9306,  23,  40,  27,    2,  -33 },   // 0x87 '0x00A7' U+00A7
+  {  9421,  17,   7,  23,    3,  -35 },   // 0x88 '0x00A8' U+00A8
+  {  9436,  27,  45,  29,    1,  -44 },   // 0x89 '0x0160' U+0160
+  {  9588,  27,  44,  29,    1,  -33 },   // 0x8a '0x015E' U+015E
+  {  9737,  28,  45,  30,    1,  -44 },   // 0x8b '0x0164' U+0164
+  {  9895,  26,  44,  30,    2,  -43 },   // 0x8c '0x0179' U+0179
+  { 10038,  16,   5,  20,    2,  -15 },   // 0x8d '0x00AD' U+00AD
+  { 10048,  26,  45,  30,    2,  -44 },   // 0x8e '0x017D' U+017D
+  { 10195,  26,  45,  30,    2,  -44 },   // 0x8f '0x017B' U+017B
+  { 10342,  17,  17,  21,    2,  -34 },   // 0x90 '0x00B0' U+00B0
+  { 10379,  24,  35,  26,    1,  -25 },   // 0x91 '0x0105' U+0105
+  { 10484,  10,  11,  12,    1,    0 },   // 0x92 '0x02DB' U+02DB
+  { 10498,  14,  34,  12,   -1,  -33 },   // 0x93 '0x0142' U+0142
+  { 10558,  10,   7,  20,    5,  -35 },   // 0x94 '0x00B4' U+00B4
+  { 10567,  15,  36,  16,    2,  -35 },   // 0x95 '0x013E' U+013E
+  { 10635,  23,  37,  25,    1,  -35 },   // 0x96 '0x015B' U+015B
+  { 10742,  19,   8,  25,    3,  -36 },   // 0x97 '0x02C7' U+02C7
+  { 10761,   9,  11,  16,    4,    1 },   // 0x98 '0x00B8' U+00B8
+  { 10774,  23,  38,  25,    1,  -36 },   // 0x99 '0x0161' U+0161
+  { 10884,  23,  37,  25,    1,  -25 },   // 0x9a '0x015F' U+015F
+  { 10991,  19,  38,  17,    0,  -37 },   // 0x9b '0x0165' U+0165
+  { 11082,  22,  36,  26,    2,  -35 },   // 0x9c '0x017A' U+017A
+  { 11181,  20,   7,  20,    1,  -34 },   // 0x9d '0x02DD' U+02DD
+  { 11199,  22,  37,  26,    2,  -36 },   // 0x9e '0x017E' U+017E
+  { 11301,  22,  36,  26,    2,  -35 },   // 0x9f '0x017C' U+017C
+  { 11400,  27,  44,  29,    2,  -43 },   // 0xa0 '0x0154' U+0154
+  { 11549,  32,  44,  34,    1,  -43 },   // 0xa1 '0x00C1' U+00C1
+  { 11725,  32,  45,  34,    1,  -44 },   // 0xa2 '0x00C2' U+00C2
+  { 11905,  32,  44,  34,    1,  -43 },   // 0xa3 '0x0102' U+0102
+  { 12081,  32,  45,  34,    1,  -44 },   // 0xa4 '0x00C4' U+00C4
+  { 12261,  22,  44,  25,    2,  -43 },   // 0xa5 '0x0139' U+0139
+  { 12382,  31,  45,  34,    2,  -44 },   // 0xa6 '0x0106' U+0106
+  { 12557,  31,  44,  34,    2,  -33 },   // 0xa7 '0x00C7' U+00C7
+  { 12728,  31,  45,  34,    2,  -44 },   // 0xa8 '0x010C' U+010C
+  { 12903,  23,  44,  27,    2,  -43 },   // 0xa9 '0x00C9' U+00C9
+  { 13030,  24,  43,  27,    2,  -33 },   // 0xaa '0x0118' U+0118
+  { 13159,  23,  45,  27,    2,  -44 },   // 0xab '0x00CB' U+00CB
+  { 13289,  23,  45,  27,    2,  -44 },   // 0xac '0x011A' U+011A
+  { 13419,  11,  44,  11,    2,  -43 },   // 0xad '0x00CD' U+00CD
+  { 13480,  19,  45,  11,   -4,  -44 },   // 0xae '0x00CE' U+00CE
+  { 13587,  29,  45,  33,    2,  -44 },   // 0xaf '0x010E' U+010E
+  { 13751,  34,  34,  34,   -2,  -33 },   // 0xb0 '0x0110' U+0110
+  { 13896,  29,  44,  33,    2,  -43 },   // 0xb1 '0x0143' U+0143
+  { 14056,  29,  45,  33,    2,  -44 },   // 0xb2 '0x0147' U+0147
+  { 14220,  32,  45,  36,    2,  -44 },   // 0xb3 '0x00D3' U+00D3
+  { 14400,  32,  46,  36,    2,  -45 },   // 0xb4 '0x00D4' U+00D4
+  { 14584,  32,  45,  36,    2,  -44 },   // 0xb5 '0x0150' U+0150
+  { 14764,  32,  45,  36,    2,  -44 },   // 0xb6 '0x00D6' U+00D6
+  { 14944,  25,  24,  31,    3,  -25 },   // 0xb7 '0x00D7' U+00D7
+  { 15019,  27,  45,  29,    2,  -44 },   // 0xb8 '0x0158' U+0158
+  { 15171,  28,  47,  32,    2,  -46 },   // 0xb9 '0x016E' U+016E
+  { 15336,  28,  45,  32,    2,  -44 },   // 0xba '0x00DA' U+00DA
+  { 15494,  28,  45,  32,    2,  -44 },   // 0xbb '0x0170' U+0170
+  { 15652,  28,  45,  32,    2,  -44 },   // 0xbc '0x00DC' U+00DC
+  { 15810,  33,  44,  33,    0,  -43 },   // 0xbd '0x00DD' U+00DD
+  { 15992,  28,  45,  30,    1,  -33 },   // 0xbe '0x0162' U+0162
+  { 16150,  26,  34,  29,    2,  -33 },   // 0xbf '0x00DF' U+00DF
+  { 16261,  16,  36,  18,    2,  -35 },   // 0xc0 '0x0155' U+0155
+  { 16333,  23,  36,  26,    1,  -35 },   // 0xc1 '0x00E1' U+00E1
+  { 16437,  23,  37,  26,    1,  -36 },   // 0xc2 '0x00E2' U+00E2
+  { 16544,  23,  36,  26,    1,  -35 },   // 0xc3 '0x0103' U+0103
+  { 16648,  23,  37,  26,    1,  -36 },   // 0xc4 '0x00E4' U+00E4
+  { 16755,  11,  44,  11,    2,  -43 },   // 0xc5 '0x013A' U+013A
+  { 16816,  24,  37,  26,    1,  -35 },   // 0xc6 '0x0107' U+0107
+  { 16927,  24,  37,  26,    1,  -25 },   // 0xc7 '0x00E7' U+00E7
+  { 17038,  24,  37,  26,    1,  -35 },   // 0xc8 '0x010D' U+010D
+  { 17149,  25,  37,  27,    1,  -35 },   // 0xc9 '0x00E9' U+00E9
+  { 17265,  25,  35,  27,    1,  -25 },   // 0xca '0x0119' U+0119
+  { 17375,  25,  37,  27,    1,  -35 },   // 0xcb '0x00EB' U+00EB
+  { 17491,  25,  38,  27,    1,  -36 },   // 0xcc '0x011B' U+011B
+  { 17610,  11,  36,  11,    2,  -35 },   // 0xcd '0x00ED' U+00ED
+  { 17660,  19,  37,  11,   -4,  -36 },   // 0xce '0x00EE' U+00EE
+  { 17748,  33,  36,  33,    1,  -35 },   // 0xcf '0x010F' U+010F
+  { 17897,  28,  34,  28,    1,  -33 },   // 0xd0 '0x0111' U+0111
+  { 18016,  24,  36,  28,    2,  -35 },   // 0xd1 '0x0144' U+0144
+  { 18124,  24,  37,  28,    2,  -36 },   // 0xd2 '0x0148' U+0148
+  { 18235,  25,  37,  27,    1,  -35 },   // 0xd3 '0x00F3' U+00F3
+  { 18351,  25,  38,  27,    1,  -36 },   // 0xd4 '0x00F4' U+00F4
+  { 18470,  25,  37,  27,    1,  -35 },   // 0xd5 '0x0151' U+0151
+  { 18586,  25,  37,  27,    1,  -35 },   // 0xd6 '0x00F6' U+00F6
+  { 18702,  24,  27,  32,    4,  -26 },   // 0xd7 '0x00F7' U+00F7
+  { 18783,  19,  37,  18,    0,  -36 },   // 0xd8 '0x0159' U+0159
+  { 18871,  24,  40,  28,    2,  -39 },   // 0xd9 '0x016F' U+016F
+  { 18991,  24,  36,  28,    2,  -35 },   // 0xda '0x00FA' U+00FA
+  { 19099,  25,  36,  28,    2,  -35 },   // 0xdb '0x0171' U+0171
+  { 19212,  24,  36,  28,    2,  -35 },   // 0xdc '0x00FC' U+00FC
+  { 19320,  26,  46,  26,    0,  -35 },   // 0xdd '0x00FD' U+00FD
+  { 19470,  17,  42,  17,    0,  -31 },   // 0xde '0x0163' U+0163
+  { 19560,   8,   7,  12,    2,  -35 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_Bold24pt8b PROGMEM = {
+  (uint8_t  *)InterTight_Bold24pt8bBitmaps,
+  (GFXglyph *)InterTight_Bold24pt8bGlyphs,
+  0x20, 0xDF, 57 };
+
+// Approx. 20918 bytes
@@ -0,0 +1,833 @@
+// Subset of ../InterTightBold52pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 18 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTightBold52pt8bfrBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+  0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80,
+  0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F,
+  0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
+  0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00,
+  0x07, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x00,
+  0x00, 0x00, 0x0F, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
+  0xF9, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xDF, 0xFC, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00,
+  0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE7,
+  0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x1F, 0xFE, 0x00, 0x00,
+  0x00, 0x1F, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF8,
+  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
+  0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0x00,
+  0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xFF,
+  0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00,
+  0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xF0,
+  0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF,
+  0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF7,
+  0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC1, 0xFF,
+  0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
+  0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80,
+  0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07,
+  0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF,
+  0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0,
+  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07,
+  0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF,
+  0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0,
+  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07,
+  0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF,
+  0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0,
+  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x07,
+  0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x83,
+  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC1, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF1,
+  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
+  0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF8, 0x00, 0x00, 0x07, 0xFF,
+  0xBF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
+  0xEF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x00, 0x01,
+  0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xE0, 0x00,
+  0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0x80,
+  0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC7, 0xFF,
+  0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC7,
+  0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0x80, 0x00,
+  0x00, 0x1F, 0xFE, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xE7, 0xFF, 0xE0,
+  0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC3, 0xFF,
+  0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x9F, 0xFC, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC7, 0xFF,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
+  0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xF8,
+  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x00,
+  0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x03,
+  0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
+  0x80, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F,
+  0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xE0,
+  0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00,
+  0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF8, 0x00,
+  0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xE0, 0x00,
+  0x00, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0xFF, 0xFF, 0xF8,
+  0x00, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x7F, 0xFF, 0xFF,
+  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00,
+  0x01, 0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0x00,
+  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00,
+  0x00, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0xC0, 0x00,
+  0x00, 0x1F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xFE, 0x00,
+  0x00, 0x03, 0xFF, 0xC7, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF8,
+  0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x07, 0xFF,
+  0xF0, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00,
+  0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF0,
+  0x00, 0x03, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF,
+  0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+  0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x1F,
+  0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0x00,
+  0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00,
+  0x07, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFF,
+  0x80, 0x01, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x00, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFE, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+  0xFF, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0xE7, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFD, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xFF,
+  0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFB,
+  0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x01, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x7F, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF8,
+  0x00, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xEF,
+  0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+  0xF9, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x00,
+  0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE1, 0xFF, 0xE0, 0x00,
+  0x00, 0x0F, 0xFF, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC,
+  0x00, 0x00, 0x0F, 0xFF, 0x81, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x07,
+  0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x03, 0xFF,
+  0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0,
+  0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x00, 0x3F,
+  0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xC0,
+  0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF,
+  0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+  0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
+  0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00,
+  0x07, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00,
+  0x00, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x03, 0xFF,
+  0x80, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+  0x80, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00,
+  0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0xFF,
+  0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC,
+  0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x03,
+  0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00,
+  0x00, 0x03, 0xFF, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFE,
+  0x00, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x07,
+  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0x00,
+  0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xF8,
+  0x00, 0x00, 0x1F, 0xFE, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x7F,
+  0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE,
+  0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x01,
+  0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00,
+  0x00, 0x7F, 0xF3, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xDF, 0xFC, 0x00,
+  0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFD,
+  0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x03, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xF8, 0x00,
+  0x00, 0x01, 0xFF, 0xFB, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFE, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF3,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
+  0xFC, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE1, 0xFF, 0xFC, 0x00, 0x1F,
+  0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xBF, 0xF8, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xF9, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x80,
+  0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+  0x7F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
+  0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x0F,
+  0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00,
+  0x07, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0xFE, 0x00,
+  0x00, 0x07, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x03, 0xFF,
+  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFE,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xF0, 0x00, 0x00,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xF8, 0x00, 0x00,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xFC, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x1F, 0xFC, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFE, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFE, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFE, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00,
+  0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00,
+  0x07, 0xFF, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x00,
+  0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x00,
+  0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00,
+  0x1F, 0xFC, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x1F, 0xF8, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x3F, 0xF8, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+  0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x01,
+  0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x01,
+  0xFF, 0x80, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x01,
+  0xFF, 0x80, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x01,
+  0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x03,
+  0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x03,
+  0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x03,
+  0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x03,
+  0xFF, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x07,
+  0xFE, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x87,
+  0xFE, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x87,
+  0xFE, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x87,
+  0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x8F,
+  0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xCF,
+  0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xCF,
+  0xFC, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xCF,
+  0xF8, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xDF,
+  0xF8, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x07, 0xFF,
+  0xE0, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+  0xC7, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+  0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x87, 0xFF,
+  0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x7F, 0xFF,
+  0xE0, 0x00, 0x1F, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xE0,
+  0x00, 0x00, 0x7F, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xFC, 0x00, 0x00,
+  0xFF, 0xFF, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0x7F, 0xFF, 0x00, 0x7F,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF1,
+  0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x07,
+  0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x1F,
+  0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
+  0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00,
+  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE,
+  0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
+  0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x00,
+  0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xF8, 0x00, 0x00,
+  0x00, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00,
+  0x00, 0x01, 0xFF, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x00, 0x07, 0x80, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC1,
+  0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
+  0x83, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+  0xFC, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x3F,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFE, 0x01,
+  0xFF, 0xFF, 0x80, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x3F,
+  0xFF, 0xFF, 0xC0, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xC1, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x00,
+  0x7F, 0xFF, 0x9F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0x80, 0x00,
+  0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00,
+  0x3F, 0xFD, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xC0, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+  0x73, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+  0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+  0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF8,
+  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+  0x7F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
+  0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
+  0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF0,
+  0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0xC7, 0xFF, 0x00,
+  0x3F, 0xF9, 0xFF, 0x80, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0xFF, 0xBF, 0xE0,
+  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+  0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F,
+  0xF7, 0xFC, 0x00, 0x0F, 0xF9, 0xFF, 0x80, 0x07, 0xFE, 0x7F, 0xF0, 0x03,
+  0xFF, 0x8F, 0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
+  0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00 };
+
+const GFXglyph InterTightBold52pt8bfrGlyphs[] PROGMEM = {
+  {     0,   0,   0,  27,    0,    0 },   // 0x20 ' ' U+0020
+  {     0,   0,   0,  31,    8,  -74 },   // 0x21 '!' U+0021
+  {     0,   0,   0,  42,    7,  -73 },   // 0x22 '"' U+0022
+  {     0,   0,   0,  65,    2,  -74 },   // 0x23 '#' U+0023
+  {     0,   0,   0,  65,    5,  -84 },   // 0x24 '$' U+0024
+  {     0,   0,   0,  86,    9,  -75 },   // 0x25 '%' U+0025
+  {     0,   0,   0,  67,    5,  -75 },   // 0x26 '&' U+0026
+  {     0,   0,   0,  23,    7,  -73 },   // 0x27 ''' U+0027
+  {     0,   0,   0,  38,   10,  -76 },   // 0x28 '(' U+0028
+  {     0,   0,   0,  38,    4,  -76 },   // 0x29 ')' U+0029
+  {     0,   0,   0,  53,    6,  -74 },   // 0x2a '*' U+002A
+  {     0,   0,   0,  68,    9,  -54 },   // 0x2b '+' U+002B
+  {     0,   0,   0,  30,    6,   -9 },   // 0x2c ',' U+002C
+  {     0,  33,   9,  47,    7,  -35 },   // 0x2d '-' U+002D
+  {     0,   0,   0,  29,    7,  -12 },   // 0x2e '.' U+002E
+  {     0,   0,   0,  38,    2,  -78 },   // 0x2f '/' U+002F
+  {    38,  55,  77,  67,    6,  -75 },   // 0x30 '0' U+0030
+  {   568,  30,  75,  48,    5,  -74 },   // 0x31 '1' U+0031
+  {   850,  49,  76,  63,    7,  -75 },   // 0x32 '2' U+0032
+  {  1316,  52,  77,  66,    7,  -75 },   // 0x33 '3' U+0033
+  {  1817,  57,  75,  67,    5,  -74 },   // 0x34 '4' U+0034
+  {  2352,  50,  76,  63,    7,  -74 },   // 0x35 '5' U+0035
+  {  2827,  53,  77,  65,    6,  -75 },   // 0x36 '6' U+0036
+  {  3338,  49,  75,  59,    5,  -74 },   // 0x37 '7' U+0037
+  {  3798,  53,  77,  65,    6,  -75 },   // 0x38 '8' U+0038
+  {  4309,  53,  77,  65,    6,  -75 },   // 0x39 '9' U+0039
+  {     0,   0,   0,  29,    7,  -53 },   // 0x3a ':' U+003A
+  {     0,   0,   0,  30,    7,  -54 },   // 0x3b ';' U+003B
+  {     0,   0,   0,  68,   10,  -56 },   // 0x3c '<' U+003C
+  {     0,   0,   0,  69,   11,  -44 },   // 0x3d '=' U+003D
+  {     0,   0,   0,  68,    9,  -56 },   // 0x3e '>' U+003E
+  {     0,   0,   0,  54,    4,  -75 },   // 0x3f '?' U+003F
+  {     0,   0,   0,  99,    5,  -73 },   // 0x40 '@' U+0040
+  {     0,   0,   0,  72,    2,  -74 },   // 0x41 'A' U+0041
+  {     0,   0,   0,  67,    8,  -74 },   // 0x42 'B' U+0042
+  {     0,   0,   0,  75,    6,  -75 },   // 0x43 'C' U+0043
+  {     0,   0,   0,  74,    8,  -74 },   // 0x44 'D' U+0044
+  {     0,   0,   0,  61,    8,  -74 },   // 0x45 'E' U+0045
+  {     0,   0,   0,  60,    8,  -74 },   // 0x46 'F' U+0046
+  {     0,   0,   0,  77,    6,  -75 },   // 0x47 'G' U+0047
+  {     0,   0,   0,  76,    8,  -74 },   // 0x48 'H' U+0048
+  {     0,   0,   0,  27,    8,  -74 },   // 0x49 'I' U+0049
+  {     0,   0,   0,  57,    4,  -74 },   // 0x4a 'J' U+004A
+  {     0,   0,   0,  68,    8,  -74 },   // 0x4b 'K' U+004B
+  {     0,   0,   0,  58,    8,  -74 },   // 0x4c 'L' U+004C
+  {     0,   0,   0,  92,    8,  -74 },   // 0x4d 'M' U+004D
+  {     0,   0,   0,  76,    8,  -74 },   // 0x4e 'N' U+004E
+  {     0,   0,   0,  79,    6,  -75 },   // 0x4f 'O' U+004F
+  {     0,   0,   0,  65,    8,  -73 },   // 0x50 'P' U+0050
+  {     0,   0,   0,  79,    6,  -75 },   // 0x51 'Q' U+0051
+  {     0,   0,   0,  66,    8,  -73 },   // 0x52 'R' U+0052
+  {     0,   0,   0,  65,    5,  -75 },   // 0x53 'S' U+0053
+  {     0,   0,   0,  68,    5,  -73 },   // 0x54 'T' U+0054
+  {     0,   0,   0,  75,    8,  -75 },   // 0x55 'U' U+0055
+  {     0,   0,   0,  72,    3,  -74 },   // 0x56 'V' U+0056
+  {  4820,  96,  75, 100,    2,  -74 },   // 0x57 'W' U+0057
+  {     0,   0,   0,  68,    3,  -74 },   // 0x58 'X' U+0058
+  {     0,   0,   0,  70,    2,  -74 },   // 0x59 'Y' U+0059
+  {     0,   0,   0,  65,    6,  -74 },   // 0x5a 'Z' U+005A
+  {     0,   0,   0,  39,   12,  -77 },   // 0x5b '[' U+005B
+  {     0,   0,   0,  38,    2,  -78 },   // 0x5c '\' U+005C
+  {     0,   0,   0,  40,    3,  -77 },   // 0x5d ']' U+005D
+  {     0,   0,   0,  49,    4,  -72 },   // 0x5e '^' U+005E
+  {     0,   0,   0,  47,    0,    1 },   // 0x5f '_' U+005F
+  {     0,   0,   0,  51,   16,  -80 },   // 0x60 '`' U+0060
+  {  5720,  47,  59,  59,    5,  -56 },   // 0x61 'a' U+0061
+  {     0,   0,   0,  64,    8,  -74 },   // 0x62 'b' U+0062
+  {     0,   0,   0,  58,    5,  -56 },   // 0x63 'c' U+0063
+  {     0,   0,   0,  64,    5,  -74 },   // 0x64 'd' U+0064
+  {  6067,  51,  59,  61,    5,  -56 },   // 0x65 'e' U+0065
+  {     0,   0,   0,  38,    2,  -77 },   // 0x66 'f' U+0066
+  {     0,   0,   0,  63,    5,  -56 },   // 0x67 'g' U+0067
+  {  6444,  47,  75,  61,    7,  -74 },   // 0x68 'h' U+0068
+  {     0,   0,   0,  26,    6,  -77 },   // 0x69 'i' U+0069
+  {     0,   0,   0,  26,   -2,  -77 },   // 0x6a 'j' U+006A
+  {     0,   0,   0,  57,    7,  -74 },   // 0x6b 'k' U+006B
+  {     0,   0,   0,  25,    7,  -74 },   // 0x6c 'l' U+006C
+  {     0,   0,   0,  90,    7,  -56 },   // 0x6d 'm' U+006D
+  {     0,   0,   0,  61,    7,  -56 },   // 0x6e 'n' U+006E
+  {     0,   0,   0,  62,    5,  -56 },   // 0x6f 'o' U+006F
+  {     0,   0,   0,  63,    7,  -56 },   // 0x70 'p' U+0070
+  {     0,   0,   0,  63,    5,  -56 },   // 0x71 'q' U+0071
+  {  6885,  30,  57,  39,    7,  -56 },   // 0x72 'r' U+0072
+  {     0,   0,   0,  55,    4,  -56 },   // 0x73 's' U+0073
+  {  7099,  32,  71,  38,    3,  -69 },   // 0x74 't' U+0074
+  {     0,   0,   0,  60,    7,  -55 },   // 0x75 'u' U+0075
+  {     0,   0,   0,  58,    3,  -55 },   // 0x76 'v' U+0076
+  {     0,   0,   0,  85,    3,  -55 },   // 0x77 'w' U+0077
+  {     0,   0,   0,  57,    4,  -55 },   // 0x78 'x' U+0078
+  {     0,   0,   0,  58,    3,  -55 },   // 0x79 'y' U+0079
+  {     0,   0,   0,  57,    6,  -55 },   // 0x7a 'z' U+007A
+  {     0,   0,   0,  39,    4,  -77 },   // 0x7b '{' U+007B
+  {     0,   0,   0,  36,   13,  -99 },   // 0x7c '|' U+007C
+  {     0,   0,   0,  39,    3,  -77 },   // 0x7d '}' U+007D
+  {     0,   0,   0,  68,    8,  -39 },   // 0x7e '~' U+007E
+  {     0,   0,   0, 104,    9,  -97 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {     0,   0,   0,  27,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {     0,   0,   0,  72,    2,  -74 },   // 0x81 '0x0104' U+0104
+  {     0,   0,   0,  47,    8,  -74 },   // 0x82 '0x02D8' U+02D8
+  {     0,   0,   0,  58,    1,  -74 },   // 0x83 '0x0141' U+0141
+  {     0,   0,   0,  76,    7,  -62 },   // 0x84 '0x00A4' U+00A4
+  {     0,   0,   0,  58,    8,  -78 },   // 0x85 '0x013D' U+013D
+  {     0,   0,   0,  65,    5,  -99 },   // 0x86 '0x015A' U+015A
+  {     0,   0,   0,  57,    5,  -75 },   // 0x87 '0x00A7' U+00A7
+  {     0,   0,   0,  58,   12,  -77 },   // 0x88 '0x00A8' U+00A8
+  {     0,   0,   0,  65,    5,  -97 },   // 0x89 '0x0160' U+0160
+  {     0,   0,   0,  65,    5,  -75 },   // 0x8a '0x015E' U+015E
+  {     0,   0,   0,  68,    5,  -97 },   // 0x8b '0x0164' U+0164
+  {     0,   0,   0,  65,    6,  -99 },   // 0x8c '0x0179' U+0179
+  {     0,   0,   0,  47,    7,  -35 },   // 0x8d '0x00AD' U+00AD
+  {     0,   0,   0,  65,    6,  -97 },   // 0x8e '0x017D' U+017D
+  {     0,   0,   0,  65,    6,  -96 },   // 0x8f '0x017B' U+017B
+  {  7383,  34,  35,  46,    6,  -75 },   // 0x90 '0x00B0' U+00B0
+  {     0,   0,   0,  59,    5,  -56 },   // 0x91 '0x0105' U+0105
+  {     0,   0,   0,  29,    5,   -2 },   // 0x92 '0x02DB' U+02DB
+  {     0,   0,   0,  25,   -1,  -74 },   // 0x93 '0x0142' U+0142
+  {     0,   0,   0,  51,   20,  -80 },   // 0x94 '0x00B4' U+00B4
+  {     0,   0,   0,  33,    7,  -78 },   // 0x95 '0x013E' U+013E
+  {     0,   0,   0,  55,    4,  -79 },   // 0x96 '0x015B' U+015B
+  {     0,   0,   0,  50,    8,  -78 },   // 0x97 '0x02C7' U+02C7
+  {     0,   0,   0,  31,    9,    1 },   // 0x98 '0x00B8' U+00B8
+  {     0,   0,   0,  55,    4,  -78 },   // 0x99 '0x0161' U+0161
+  {     0,   0,   0,  55,    4,  -56 },   // 0x9a '0x015F' U+015F
+  {     0,   0,   0,  38,    3,  -81 },   // 0x9b '0x0165' U+0165
+  {     0,   0,   0,  57,    6,  -79 },   // 0x9c '0x017A' U+017A
+  {     0,   0,   0,  41,    4,  -76 },   // 0x9d '0x02DD' U+02DD
+  {     0,   0,   0,  57,    6,  -78 },   // 0x9e '0x017E' U+017E
+  {     0,   0,   0,  57,    6,  -77 },   // 0x9f '0x017C' U+017C
+  {     0,   0,   0,  66,    8,  -98 },   // 0xa0 '0x0154' U+0154
+  {     0,   0,   0,  72,    2,  -99 },   // 0xa1 '0x00C1' U+00C1
+  {     0,   0,   0,  72,    2,  -97 },   // 0xa2 '0x00C2' U+00C2
+  {     0,   0,   0,  72,    2,  -93 },   // 0xa3 '0x0102' U+0102
+  {     0,   0,   0,  72,    2,  -96 },   // 0xa4 '0x00C4' U+00C4
+  {     0,   0,   0,  58,    8,  -99 },   // 0xa5 '0x0139' U+0139
+  {     0,   0,   0,  75,    6,  -99 },   // 0xa6 '0x0106' U+0106
+  {     0,   0,   0,  75,    6,  -75 },   // 0xa7 '0x00C7' U+00C7
+  {     0,   0,   0,  75,    6,  -97 },   // 0xa8 '0x010C' U+010C
+  {     0,   0,   0,  61,    8,  -99 },   // 0xa9 '0x00C9' U+00C9
+  {     0,   0,   0,  61,    8,  -73 },   // 0xaa '0x0118' U+0118
+  {     0,   0,   0,  61,    8,  -96 },   // 0xab '0x00CB' U+00CB
+  {     0,   0,   0,  61,    8,  -97 },   // 0xac '0x011A' U+011A
+  {     0,   0,   0,  27,    8,  -99 },   // 0xad '0x00CD' U+00CD
+  {     0,   0,   0,  27,   -4,  -97 },   // 0xae '0x00CE' U+00CE
+  {     0,   0,   0,  74,    8,  -97 },   // 0xaf '0x010E' U+010E
+  {     0,   0,   0,  74,   -3,  -74 },   // 0xb0 '0x0110' U+0110
+  {     0,   0,   0,  76,    8,  -99 },   // 0xb1 '0x0143' U+0143
+  {     0,   0,   0,  76,    8,  -97 },   // 0xb2 '0x0147' U+0147
+  {     0,   0,   0,  79,    6,  -99 },   // 0xb3 '0x00D3' U+00D3
+  {     0,   0,   0,  79,    6,  -97 },   // 0xb4 '0x00D4' U+00D4
+  {     0,   0,   0,  79,    6,  -96 },   // 0xb5 '0x0150' U+0150
+  {     0,   0,   0,  79,    6,  -96 },   // 0xb6 '0x00D6' U+00D6
+  {     0,   0,   0,  68,   10,  -53 },   // 0xb7 '0x00D7' U+00D7
+  {     0,   0,   0,  66,    8,  -97 },   // 0xb8 '0x0158' U+0158
+  {     0,   0,   0,  75,    8, -100 },   // 0xb9 '0x016E' U+016E
+  {     0,   0,   0,  75,    8,  -99 },   // 0xba '0x00DA' U+00DA
+  {     0,   0,   0,  75,    8,  -96 },   // 0xbb '0x0170' U+0170
+  {     0,   0,   0,  75,    8,  -96 },   // 0xbc '0x00DC' U+00DC
+  {     0,   0,   0,  70,    2,  -99 },   // 0xbd '0x00DD' U+00DD
+  {     0,   0,   0,  68,    5,  -73 },   // 0xbe '0x0162' U+0162
+  {     0,   0,   0,  64,    8,  -75 },   // 0xbf '0x00DF' U+00DF
+  {     0,   0,   0,  39,    7,  -80 },   // 0xc0 '0x0155' U+0155
+  {     0,   0,   0,  59,    5,  -79 },   // 0xc1 '0x00E1' U+00E1
+  {     0,   0,   0,  59,    5,  -78 },   // 0xc2 '0x00E2' U+00E2
+  {     0,   0,   0,  59,    5,  -74 },   // 0xc3 '0x0103' U+0103
+  {     0,   0,   0,  59,    5,  -76 },   // 0xc4 '0x00E4' U+00E4
+  {     0,   0,   0,  25,    7,  -99 },   // 0xc5 '0x013A' U+013A
+  {     0,   0,   0,  58,    5,  -80 },   // 0xc6 '0x0107' U+0107
+  {     0,   0,   0,  58,    5,  -56 },   // 0xc7 '0x00E7' U+00E7
+  {     0,   0,   0,  58,    5,  -78 },   // 0xc8 '0x010D' U+010D
+  {     0,   0,   0,  61,    5,  -79 },   // 0xc9 '0x00E9' U+00E9
+  {     0,   0,   0,  61,    5,  -56 },   // 0xca '0x0119' U+0119
+  {     0,   0,   0,  61,    5,  -77 },   // 0xcb '0x00EB' U+00EB
+  {     0,   0,   0,  61,    5,  -78 },   // 0xcc '0x011B' U+011B
+  {     0,   0,   0,  25,    7,  -80 },   // 0xcd '0x00ED' U+00ED
+  {     0,   0,   0,  25,   -5,  -78 },   // 0xce '0x00EE' U+00EE
+  {     0,   0,   0,  72,    5,  -77 },   // 0xcf '0x010F' U+010F
+  {     0,   0,   0,  64,    5,  -74 },   // 0xd0 '0x0111' U+0111
+  {     0,   0,   0,  61,    7,  -80 },   // 0xd1 '0x0144' U+0144
+  {     0,   0,   0,  61,    7,  -78 },   // 0xd2 '0x0148' U+0148
+  {     0,   0,   0,  62,    5,  -80 },   // 0xd3 '0x00F3' U+00F3
+  {     0,   0,   0,  62,    5,  -78 },   // 0xd4 '0x00F4' U+00F4
+  {     0,   0,   0,  62,    5,  -76 },   // 0xd5 '0x0151' U+0151
+  {     0,   0,   0,  62,    5,  -77 },   // 0xd6 '0x00F6' U+00F6
+  {     0,   0,   0,  68,   10,  -55 },   // 0xd7 '0x00F7' U+00F7
+  {     0,   0,   0,  39,    4,  -78 },   // 0xd8 '0x0159' U+0159
+  {     0,   0,   0,  60,    7,  -86 },   // 0xd9 '0x016F' U+016F
+  {     0,   0,   0,  60,    7,  -80 },   // 0xda '0x00FA' U+00FA
+  {     0,   0,   0,  60,    7,  -77 },   // 0xdb '0x0171' U+0171
+  {     0,   0,   0,  60,    7,  -77 },   // 0xdc '0x00FC' U+00FC
+  {     0,   0,   0,  58,    3,  -80 },   // 0xdd '0x00FD' U+00FD
+  {     0,   0,   0,  38,    3,  -69 },   // 0xde '0x0163' U+0163
+  {     0,   0,   0,  26,    6,  -77 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTightBold52pt8bfr PROGMEM = {
+  (uint8_t  *)InterTightBold52pt8bfrBitmaps,
+  (GFXglyph *)InterTightBold52pt8bfrGlyphs,
+  0x20, 0xDF, 124 };
+
+// Approx. 8883 bytes
@@ -0,0 +1,394 @@
+// Subset of ../InterTightBold8pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_Bold8pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0x0F, 0xDE, 0xF7, 0xBD, 0x80, 0x19, 0x84, 0x43, 0x11,
+  0xFF, 0x7F, 0xCC, 0xC3, 0x33, 0xFE, 0xFF, 0x99, 0x86, 0x61, 0x98, 0x04,
+  0x02, 0x07, 0x87, 0xE6, 0x7B, 0x21, 0xD0, 0x7C, 0x1F, 0x03, 0xF9, 0x6C,
+  0xB7, 0xF1, 0xF0, 0x10, 0x08, 0x70, 0xDF, 0x13, 0x64, 0x7D, 0x87, 0x20,
+  0x08, 0x03, 0x70, 0x5F, 0x1B, 0x66, 0x6C, 0x8F, 0xB0, 0xE0, 0x3C, 0x1F,
+  0x86, 0x61, 0x98, 0x7C, 0x0E, 0x07, 0x9B, 0xF6, 0xCF, 0xB1, 0xCF, 0xF0,
+  0xF6, 0xFF, 0xC0, 0x76, 0x6E, 0xCC, 0xCC, 0xCC, 0xCE, 0x66, 0x70, 0xE6,
+  0x67, 0x33, 0x33, 0x33, 0x37, 0x66, 0xE0, 0x18, 0x5A, 0x7E, 0x7E, 0x5A,
+  0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFB, 0x68, 0xFF,
+  0xC0, 0xFC, 0x1C, 0x61, 0x86, 0x38, 0xC3, 0x0C, 0x61, 0x86, 0x18, 0xC3,
+  0x00, 0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1,
+  0x9F, 0xC7, 0xC0, 0x3B, 0xFF, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x30, 0x3C,
+  0x7E, 0xE7, 0xC3, 0x03, 0x06, 0x0E, 0x1C, 0x38, 0x70, 0xFF, 0xFF, 0x3C,
+  0x7E, 0xE3, 0x03, 0x03, 0x1E, 0x1E, 0x03, 0x03, 0xE3, 0x7E, 0x3C, 0x07,
+  0x03, 0xC0, 0xF0, 0x7C, 0x1B, 0x0C, 0xC7, 0x31, 0x8C, 0xFF, 0xFF, 0xF0,
+  0x30, 0x0C, 0x7E, 0x7E, 0xC0, 0xC0, 0xDC, 0xFE, 0x47, 0x03, 0x03, 0xC7,
+  0x7E, 0x3C, 0x1E, 0x3F, 0x98, 0xF8, 0x0D, 0xE7, 0xFB, 0x8F, 0x83, 0xC1,
+  0xB1, 0xDF, 0xC7, 0xC0, 0xFF, 0xFF, 0x07, 0x06, 0x0E, 0x0C, 0x1C, 0x18,
+  0x38, 0x30, 0x70, 0x70, 0x1C, 0x3F, 0x98, 0xCC, 0x66, 0x31, 0xF1, 0xFD,
+  0xC7, 0xC1, 0xF1, 0xDF, 0xC7, 0xC0, 0x3E, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F,
+  0x1D, 0xFE, 0x7B, 0x01, 0xF1, 0x9F, 0xC7, 0x80, 0xFC, 0x0F, 0xC0, 0x6D,
+  0x80, 0x03, 0x69, 0x20, 0x03, 0x0F, 0x3E, 0xF0, 0xE0, 0xFC, 0x1F, 0x07,
+  0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xF0, 0x7C, 0x0F, 0x07,
+  0x1F, 0xF8, 0xE0, 0x80, 0x38, 0xFF, 0x1E, 0x30, 0x63, 0x8E, 0x18, 0x30,
+  0x00, 0xE1, 0xC0, 0x07, 0xE0, 0x3F, 0xF0, 0xE0, 0xF3, 0xBF, 0x66, 0xFE,
+  0xFB, 0x9C, 0xF6, 0x19, 0xEC, 0x33, 0xD8, 0x67, 0xB9, 0xDF, 0xBF, 0xF3,
+  0x39, 0xC7, 0x80, 0x07, 0xFC, 0x03, 0xF8, 0x00, 0x1E, 0x07, 0x81, 0xE0,
+  0xFC, 0x33, 0x0C, 0xC7, 0x39, 0xFE, 0x7F, 0xB8, 0x7E, 0x1F, 0x03, 0xFE,
+  0x7F, 0xB0, 0xD8, 0x6C, 0x37, 0xF3, 0xFD, 0x87, 0xC1, 0xE0, 0xFF, 0xDF,
+  0xC0, 0x1E, 0x0F, 0xE6, 0x3B, 0x87, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE1,
+  0xD8, 0xE3, 0xF8, 0x78, 0xFC, 0x7F, 0xB0, 0xD8, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE1, 0xBF, 0xDF, 0x80, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFE,
+  0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x0F, 0xE6, 0x1F, 0x83, 0xC0,
+  0x31, 0xFC, 0x7F, 0x03, 0xE0, 0xD8, 0x63, 0xF8, 0x78, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xFF, 0xFF, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0xC7, 0xCD,
+  0xF1, 0xC0, 0xC3, 0xE3, 0xB3, 0x99, 0x8D, 0xC7, 0xC3, 0xF1, 0xF8, 0xCE,
+  0x63, 0xB1, 0xD8, 0x70, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0x7E, 0x07, 0xF0, 0xFF, 0x0F, 0xF1, 0xFD,
+  0x9B, 0xD9, 0xBD, 0xFB, 0xCF, 0x3C, 0xF3, 0xC6, 0x3C, 0x63, 0xC1, 0xF0,
+  0xF8, 0x7E, 0x3F, 0x9E, 0xEF, 0x77, 0x9F, 0xC7, 0xE1, 0xF0, 0xF8, 0x30,
+  0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xE0,
+  0xEE, 0x38, 0xFE, 0x0F, 0x80, 0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0xC7, 0xFE,
+  0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x7C, 0x07,
+  0x80, 0xF0, 0x1E, 0x03, 0xE6, 0xEE, 0x78, 0xFE, 0x0F, 0xE0, 0x04, 0xFC,
+  0xFE, 0xC7, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC, 0xCE, 0xC6, 0xC7, 0xC3, 0x1E,
+  0x1F, 0x98, 0xEC, 0x07, 0x01, 0xF0, 0x7C, 0x07, 0xE1, 0xB0, 0xDF, 0xC7,
+  0xC0, 0xFF, 0xFF, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06,
+  0x03, 0x01, 0x80, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xF1, 0xDF, 0xC7, 0xC0, 0xE0, 0xEC, 0x1D, 0xC3, 0x38, 0xE3, 0x1C,
+  0x63, 0x0E, 0xE0, 0xDC, 0x1B, 0x03, 0xE0, 0x3C, 0x07, 0x00, 0xE1, 0x87,
+  0xE3, 0x86, 0x63, 0xC6, 0x63, 0xCE, 0x73, 0xCE, 0x37, 0xCC, 0x36, 0x6C,
+  0x36, 0x7C, 0x3E, 0x78, 0x1C, 0x78, 0x1C, 0x38, 0x1C, 0x38, 0x61, 0xCE,
+  0x38, 0xCE, 0x1D, 0x81, 0xF0, 0x3C, 0x07, 0x80, 0xF8, 0x3B, 0x06, 0x71,
+  0xC7, 0x70, 0xE0, 0xE1, 0xD8, 0x67, 0x38, 0xCC, 0x3F, 0x07, 0x81, 0xE0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xE0, 0x70, 0x70, 0x70, 0x30, 0x3F, 0xFF, 0xF0, 0xFF, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCF, 0xF0, 0xC3, 0x06, 0x18, 0x61, 0x83, 0x0C, 0x30, 0xE1,
+  0x86, 0x18, 0x30, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0xF0, 0x38,
+  0x70, 0xB3, 0x64, 0x58, 0xC0, 0xFF, 0xFF, 0xCC, 0x3C, 0x7F, 0xE7, 0x07,
+  0x7F, 0xC3, 0xC7, 0xFF, 0x7B, 0xC0, 0xC0, 0xC0, 0xDC, 0xFE, 0xE7, 0xC3,
+  0xC3, 0xC3, 0xE7, 0xFE, 0xDC, 0x3C, 0x7E, 0xE7, 0xC0, 0xC0, 0xC0, 0xE7,
+  0x7E, 0x3C, 0x03, 0x03, 0x03, 0x3B, 0x7F, 0xE7, 0xC3, 0xC3, 0xC3, 0xE7,
+  0x7F, 0x3B, 0x3C, 0x7E, 0xE3, 0xFF, 0xFF, 0xC0, 0xE3, 0x7E, 0x3C, 0x01,
+  0xDE, 0xCF, 0xFD, 0x8C, 0x63, 0x18, 0xC6, 0x00, 0x3B, 0x7F, 0xE7, 0xC3,
+  0xC3, 0xC3, 0xE7, 0x7F, 0x3B, 0x63, 0x7F, 0x3C, 0xC0, 0xC0, 0xC0, 0xDE,
+  0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x30, 0xFF, 0xFF, 0xC0,
+  0x03, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFE, 0xC0, 0xC0, 0xC0, 0xC6,
+  0xCE, 0xDC, 0xF8, 0xF8, 0xF8, 0xDC, 0xCE, 0xC6, 0xFF, 0xFF, 0xFF, 0xDC,
+  0xEF, 0xFF, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6,
+  0x30, 0xDE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x7E,
+  0xE7, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0xDC, 0xFE, 0xE7, 0xC3, 0xC3,
+  0xC3, 0xE7, 0xFE, 0xDC, 0xC0, 0xC0, 0xC0, 0x3B, 0x7F, 0xE7, 0xC3, 0xC3,
+  0xC3, 0xE7, 0x7F, 0x3B, 0x03, 0x03, 0x03, 0xDF, 0xF9, 0x8C, 0x63, 0x18,
+  0xC0, 0x79, 0xFB, 0x1F, 0x07, 0xC1, 0xF1, 0xFF, 0x7C, 0x63, 0x3F, 0xF6,
+  0x31, 0x8C, 0x63, 0xCE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFF,
+  0x7B, 0xE3, 0xB1, 0x98, 0xCE, 0xE3, 0x61, 0xB0, 0xF8, 0x38, 0x1C, 0x00,
+  0xE7, 0x3F, 0x39, 0x99, 0xCC, 0xDA, 0x66, 0xDF, 0x3E, 0xF0, 0xF7, 0x87,
+  0x1C, 0x38, 0xE0, 0xE3, 0x67, 0x36, 0x3C, 0x1C, 0x3C, 0x36, 0x67, 0xE3,
+  0xE3, 0xB1, 0x99, 0xCC, 0xE3, 0x61, 0xB0, 0xF0, 0x38, 0x1C, 0x0C, 0x1E,
+  0x0E, 0x00, 0xFF, 0xFC, 0x30, 0xE3, 0x86, 0x18, 0x7F, 0xFE, 0x04, 0x73,
+  0xCC, 0x30, 0xC3, 0x3C, 0xE0, 0xC3, 0x0C, 0x30, 0xC3, 0xC7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x83, 0x8F, 0x0C, 0x30, 0xC3, 0x0F, 0x1C, 0xC3, 0x0C,
+  0x30, 0xCF, 0x38, 0x63, 0xF3, 0xCF, 0xC6, 0x00, 0x1E, 0x03, 0xC0, 0x78,
+  0x1F, 0x83, 0x30, 0x66, 0x1C, 0xE3, 0xFC, 0x7F, 0x9C, 0x3B, 0x87, 0x60,
+  0x70, 0x0C, 0x01, 0x80, 0x38, 0x07, 0xCB, 0xE7, 0x00, 0x60, 0x30, 0x18,
+  0x0C, 0x06, 0x83, 0xC3, 0x80, 0xC0, 0x60, 0x30, 0x1F, 0xEF, 0xF0, 0xDE,
+  0xFF, 0xF6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0xFF, 0xC7, 0x80,
+  0xCC, 0xCC, 0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+  0x06, 0x06, 0x00, 0x03, 0xC3, 0xF3, 0x1D, 0x80, 0xE0, 0x3E, 0x0F, 0x80,
+  0xFC, 0x36, 0x1B, 0xF8, 0xF8, 0x3C, 0x7E, 0x66, 0x60, 0x78, 0x7E, 0xCE,
+  0xC7, 0x7E, 0x1C, 0x06, 0x66, 0x7E, 0x3C, 0xCF, 0x30, 0x33, 0x0F, 0x03,
+  0x00, 0x01, 0xE1, 0xFD, 0x86, 0xC0, 0x70, 0x1F, 0x07, 0xC0, 0x7E, 0x1B,
+  0x0D, 0xFC, 0x7C, 0x1E, 0x1F, 0x98, 0xEC, 0x07, 0x01, 0xF0, 0x7C, 0x07,
+  0xE1, 0xB0, 0xDF, 0xC7, 0xC0, 0xC0, 0x30, 0x18, 0x18, 0x33, 0x0F, 0x03,
+  0x00, 0x0F, 0xFF, 0xFC, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0,
+  0x60, 0x30, 0x18, 0x0E, 0x06, 0x00, 0x1F, 0xFF, 0xF8, 0x18, 0x1C, 0x1C,
+  0x1C, 0x0E, 0x0E, 0x0E, 0x06, 0x07, 0xFF, 0xFE, 0xFF, 0xC0, 0x63, 0x1B,
+  0x07, 0x00, 0x0F, 0xFF, 0xFC, 0x0C, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x07,
+  0x03, 0x03, 0xFF, 0xFF, 0x18, 0x0C, 0x00, 0x1F, 0xFF, 0xF8, 0x38, 0x3C,
+  0x1C, 0x1C, 0x1C, 0x0E, 0x0E, 0x06, 0x07, 0xFF, 0xFE, 0x7B, 0xFC, 0xF3,
+  0xFD, 0xE0, 0x3C, 0x7F, 0xE7, 0x07, 0x7F, 0xC3, 0xC7, 0xFF, 0x7B, 0x06,
+  0x07, 0x03, 0x5F, 0x76, 0x66, 0x66, 0x7F, 0xE6, 0x66, 0x66, 0x78, 0xDE,
+  0xF7, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x80, 0x18, 0x30, 0x03, 0xCF, 0xD8,
+  0xF8, 0x3E, 0x0F, 0x8F, 0xFB, 0xE0, 0xCD, 0xE3, 0x80, 0x47, 0x3E, 0x6C,
+  0xD0, 0xE0, 0x07, 0x9F, 0xB1, 0xF0, 0x7C, 0x1F, 0x1F, 0xF7, 0xC0, 0x79,
+  0xFB, 0x1F, 0x07, 0xC1, 0xF1, 0xFF, 0x7C, 0x30, 0x30, 0x63, 0x80, 0x0C,
+  0x36, 0xD8, 0xFB, 0xE6, 0x18, 0x61, 0x86, 0x1E, 0x38, 0x1C, 0x30, 0x07,
+  0xFF, 0xE1, 0x87, 0x1C, 0x30, 0xC3, 0xFF, 0xF0, 0x6C, 0xB0, 0xC6, 0xD8,
+  0xE0, 0x0F, 0xFF, 0xC3, 0x0E, 0x38, 0x61, 0x87, 0xFF, 0xE0, 0x00, 0x30,
+  0x00, 0x0F, 0xFF, 0xC3, 0x0E, 0x38, 0x71, 0xC7, 0xFF, 0xE0, 0x0C, 0x18,
+  0x00, 0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC, 0xCE, 0xC6, 0xC7,
+  0xC3, 0x06, 0x03, 0x00, 0x00, 0x78, 0x1E, 0x07, 0x83, 0xF0, 0xCC, 0x33,
+  0x1C, 0xE7, 0xF9, 0xFE, 0xE1, 0xF8, 0x7C, 0x0C, 0x0C, 0x07, 0x83, 0x30,
+  0x00, 0x1E, 0x07, 0x81, 0xE0, 0xFC, 0x33, 0x0C, 0xC7, 0x39, 0xFE, 0x7F,
+  0xB8, 0x7E, 0x1F, 0x03, 0x33, 0x07, 0x81, 0xE0, 0x00, 0x1E, 0x07, 0x81,
+  0xE0, 0xFC, 0x33, 0x0C, 0xC7, 0x39, 0xFE, 0x7F, 0xB8, 0x7E, 0x1F, 0x03,
+  0x33, 0x0C, 0xC0, 0x00, 0x78, 0x1E, 0x0F, 0xC3, 0xF0, 0xCC, 0x33, 0x1C,
+  0xE7, 0xF9, 0xFE, 0xE1, 0xF8, 0x7C, 0x0C, 0x60, 0xC0, 0x00, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x06, 0x03,
+  0x00, 0x00, 0x78, 0x3F, 0x98, 0xEE, 0x1F, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+  0x87, 0x63, 0x8F, 0xE1, 0xE0, 0x1F, 0x0F, 0xE6, 0x1F, 0x83, 0xC0, 0x30,
+  0x0C, 0x03, 0x00, 0xE0, 0xD8, 0x73, 0xF8, 0x7C, 0x0C, 0x01, 0x80, 0x60,
+  0x30, 0x33, 0x07, 0x80, 0xC0, 0x00, 0x1E, 0x0F, 0xE6, 0x1B, 0x87, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xE1, 0xD8, 0xE3, 0xF8, 0x78, 0x0C, 0x18, 0x00,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+  0x06, 0x06, 0x07, 0x07, 0x66, 0x66, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x46, 0x6C, 0x38, 0x00, 0xFF,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x78,
+  0x6D, 0xB6, 0xDB, 0x6D, 0xB0, 0x31, 0xEC, 0xC0, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xCE, 0x36, 0x0E, 0x00, 0x0F, 0xC7, 0xFB,
+  0x0D, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x1B, 0xFD, 0xF8, 0x3F,
+  0x07, 0xF8, 0xC3, 0x18, 0x33, 0x07, 0xF8, 0xFF, 0x19, 0x83, 0x30, 0x66,
+  0x18, 0xFF, 0x1F, 0x80, 0x0E, 0x06, 0x00, 0x18, 0x3E, 0x1F, 0x0F, 0xC7,
+  0xF3, 0xDD, 0xEE, 0xF3, 0xF8, 0xFC, 0x3E, 0x1F, 0x06, 0x63, 0x1B, 0x07,
+  0x00, 0x0C, 0x1F, 0x0F, 0x87, 0xE3, 0xF9, 0xEE, 0xF7, 0x79, 0xFC, 0x7E,
+  0x1F, 0x0F, 0x83, 0x07, 0x00, 0xC0, 0x00, 0x0F, 0x83, 0xF8, 0xE3, 0xB8,
+  0x3E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xF0, 0x77, 0x1C, 0x7F, 0x07, 0xC0,
+  0x0E, 0x03, 0xE0, 0xEE, 0x00, 0x01, 0xF0, 0x7F, 0x1C, 0x77, 0x07, 0xC0,
+  0x78, 0x0F, 0x01, 0xE0, 0x3E, 0x0E, 0xE3, 0x8F, 0xE0, 0xF8, 0x0C, 0xC3,
+  0x30, 0x00, 0x0F, 0x83, 0xF8, 0xE3, 0xB8, 0x3E, 0x03, 0xC0, 0x78, 0x0F,
+  0x01, 0xF0, 0x77, 0x1C, 0x7F, 0x07, 0xC0, 0x1B, 0x03, 0x60, 0x00, 0x0F,
+  0x83, 0xF8, 0xE3, 0xB8, 0x3E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xF0, 0x77,
+  0x1C, 0x7F, 0x07, 0xC0, 0x42, 0xE7, 0x7E, 0x3C, 0x3C, 0x7E, 0xE7, 0x43,
+  0x66, 0x3C, 0x38, 0x00, 0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC,
+  0xCE, 0xC6, 0xC7, 0xC3, 0x0C, 0x09, 0x03, 0x00, 0x0C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F, 0x1D, 0xFC, 0x7C, 0x0E, 0x06,
+  0x00, 0x18, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3E,
+  0x3B, 0xF8, 0xF8, 0x1B, 0x1B, 0x00, 0x18, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3E, 0x3B, 0xF8, 0xF8, 0x36, 0x1B, 0x00, 0x18,
+  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3E, 0x3B, 0xF8,
+  0xF8, 0x06, 0x03, 0x00, 0x03, 0x87, 0x61, 0x9C, 0xE3, 0x30, 0xFC, 0x1E,
+  0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0xC3, 0x01,
+  0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0x80, 0x30,
+  0x18, 0x18, 0x3C, 0x3F, 0x38, 0xD8, 0x6C, 0x36, 0x73, 0x3D, 0x87, 0xC1,
+  0xE0, 0xF3, 0xF9, 0xC0, 0x31, 0x01, 0xBF, 0xF3, 0x18, 0xC6, 0x31, 0x80,
+  0x0E, 0x0C, 0x00, 0x3C, 0x7F, 0xE7, 0x07, 0x7F, 0xC3, 0xC7, 0xFF, 0x7B,
+  0x1C, 0x36, 0x66, 0x00, 0x3C, 0x7F, 0xE7, 0x07, 0x7F, 0xC3, 0xC7, 0xFF,
+  0x7B, 0x62, 0x3E, 0x3C, 0x00, 0x3C, 0x7F, 0xE7, 0x07, 0x7F, 0xC3, 0xC7,
+  0xFF, 0x7B, 0x00, 0x66, 0x00, 0x00, 0x3C, 0x7F, 0xE7, 0x07, 0x7F, 0xC3,
+  0xC7, 0xFF, 0x7B, 0x78, 0x6D, 0xB6, 0xDB, 0x6D, 0xB0, 0x0C, 0x18, 0x00,
+  0x3C, 0x7E, 0xE7, 0xC0, 0xC0, 0xC0, 0xE7, 0x7E, 0x3C, 0x3C, 0x7E, 0xE7,
+  0xC0, 0xC0, 0xC0, 0xE7, 0x7E, 0x3C, 0x18, 0x0C, 0x0C, 0x18, 0x66, 0x3C,
+  0x18, 0x00, 0x3C, 0x7F, 0xE7, 0xC0, 0xC0, 0xC3, 0xE7, 0x7E, 0x3C, 0x0C,
+  0x18, 0x00, 0x3C, 0x7E, 0xE3, 0xFF, 0xFF, 0xC0, 0xE3, 0x7E, 0x3C, 0x3C,
+  0x7E, 0xE3, 0xFF, 0xFF, 0xC0, 0xE3, 0x7E, 0x3C, 0x18, 0x1C, 0x0C, 0x00,
+  0x66, 0x00, 0x00, 0x3C, 0x7E, 0xE3, 0xFF, 0xFF, 0xC0, 0xE3, 0x7E, 0x3C,
+  0x66, 0x3C, 0x18, 0x00, 0x3C, 0x7E, 0xE3, 0xFF, 0xFF, 0xC0, 0xE3, 0x7E,
+  0x3C, 0x78, 0x6D, 0xB6, 0xDB, 0x60, 0x31, 0xEC, 0xC0, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x30, 0x00, 0x60, 0x6C, 0x0D, 0x81, 0x83, 0xB0, 0xFE,
+  0x39, 0xC6, 0x18, 0xC3, 0x18, 0x63, 0x9C, 0x3F, 0x83, 0xB0, 0x03, 0x07,
+  0xC3, 0xE7, 0x67, 0xF7, 0x3B, 0x0D, 0x86, 0xC3, 0x73, 0x9F, 0xC7, 0x60,
+  0x0C, 0x18, 0x00, 0xDE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0x66, 0x3C, 0x3C, 0x00, 0xDE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0x0C, 0x18, 0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E,
+  0x3C, 0x18, 0x3C, 0x66, 0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xE7,
+  0x7E, 0x3C, 0x1B, 0x36, 0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xE7,
+  0x7E, 0x3C, 0x00, 0x36, 0x00, 0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3,
+  0xE7, 0x7E, 0x3C, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0x18, 0x18,
+  0xCE, 0xD8, 0xE0, 0x06, 0xCF, 0x9C, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x00,
+  0x18, 0x24, 0x24, 0x18, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+  0xFF, 0x7B, 0x0C, 0x18, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+  0xFF, 0x7B, 0x3B, 0x36, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+  0xFF, 0x7B, 0x00, 0x66, 0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xE7, 0xFF, 0x7B, 0x0C, 0x06, 0x00, 0x00, 0x0E, 0x3B, 0x19, 0x9C, 0xCE,
+  0x36, 0x1B, 0x0F, 0x03, 0x81, 0xC0, 0xC1, 0xE0, 0xE0, 0x61, 0x8F, 0xBE,
+  0x61, 0x86, 0x18, 0x79, 0xE3, 0x86, 0x0C, 0x33, 0x80, 0xF0 };
+
+const GFXglyph InterTight_Bold8pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   2,  12,   4,    1,  -11 },   // 0x21 '!' U+0021
+  {     4,   5,   5,   7,    1,  -11 },   // 0x22 '"' U+0022
+  {     8,  10,  12,  10,    0,  -11 },   // 0x23 '#' U+0023
+  {    23,   9,  16,  10,    0,  -13 },   // 0x24 '$' U+0024
+  {    41,  11,  12,  13,    1,  -11 },   // 0x25 '%' U+0025
+  {    58,  10,  12,  11,    1,  -11 },   // 0x26 '&' U+0026
+  {    73,   2,   5,   4,    1,  -11 },   // 0x27 ''' U+0027
+  {    75,   4,  15,   5,    1,  -12 },   // 0x28 '(' U+0028
+  {    83,   4,  15,   5,    0,  -12 },   // 0x29 ')' U+0029
+  {    91,   8,   6,  10,    1,  -11 },   // 0x2a '*' U+002A
+  {    97,   8,   8,  10,    1,   -8 },   // 0x2b '+' U+002B
+  {   105,   3,   5,   5,    1,   -1 },   // 0x2c ',' U+002C
+  {   107,   5,   2,   7,    1,   -5 },   // 0x2d '-' U+002D
+  {   109,   2,   3,   4,    1,   -2 },   // 0x2e '.' U+002E
+  {   110,   6,  14,   6,    0,  -11 },   // 0x2f '/' U+002F
+  {   121,   9,  12,  11,    1,  -11 },   // 0x30 '0' U+0030
+  {   135,   5,  12,   6,    0,  -11 },   // 0x31 '1' U+0031
+  {   143,   8,  12,  10,    1,  -11 },   // 0x32 '2' U+0032
+  {   155,   8,  12,  10,    1,  -11 },   // 0x33 '3' U+0033
+  {   167,  10,  12,  10,    0,  -11 },   // 0x34 '4' U+0034
+  {   182,   8,  12,  10,    1,  -11 },   // 0x35 '5' U+0035
+  {   194,   9,  12,  11,    1,  -11 },   // 0x36 '6' U+0036
+  {   208,   8,  12,  10,    1,  -11 },   // 0x37 '7' U+0037
+  {   220,   9,  12,  11,    1,  -11 },   // 0x38 '8' U+0038
+  {   234,   9,  12,  11,    1,  -11 },   // 0x39 '9' U+0039
+  {   248,   2,   9,   4,    1,   -8 },   // 0x3a ':' U+003A
+  {   251,   3,  12,   4,    0,   -8 },   // 0x3b ';' U+003B
+  {   256,   8,   9,  10,    1,   -8 },   // 0x3c '<' U+003C
+  {   265,   8,   6,  10,    1,   -7 },   // 0x3d '=' U+003D
+  {   271,   8,   9,  10,    1,   -8 },   // 0x3e '>' U+003E
+  {   280,   7,  12,   9,    1,  -11 },   // 0x3f '?' U+003F
+  {   291,  15,  15,  17,    1,  -11 },   // 0x40 '@' U+0040
+  {   320,  10,  12,  12,    1,  -11 },   // 0x41 'A' U+0041
+  {   335,   9,  12,  11,    1,  -11 },   // 0x42 'B' U+0042
+  {   349,  10,  12,  11,    1,  -11 },   // 0x43 'C' U+0043
+  {   364,   9,  12,  11,    1,  -11 },   // 0x44 'D' U+0044
+  {   378,   8,  12,   9,    1,  -11 },   // 0x45 'E' U+0045
+  {   390,   8,  12,   9,    1,  -11 },   // 0x46 'F' U+0046
+  {   402,  10,  12,  12,    1,  -11 },   // 0x47 'G' U+0047
+  {   417,  10,  12,  12,    1,  -11 },   // 0x48 'H' U+0048
+  {   432,   2,  12,   4,    1,  -11 },   // 0x49 'I' U+0049
+  {   435,   7,  12,   9,    1,  -11 },   // 0x4a 'J' U+004A
+  {   446,   9,  12,  10,    1,  -11 },   // 0x4b 'K' U+004B
+  {   460,   8,  12,   9,    1,  -11 },   // 0x4c 'L' U+004C
+  {   472,  12,  12,  14,    1,  -11 },   // 0x4d 'M' U+004D
+  {   490,   9,  12,  11,    1,  -11 },   // 0x4e 'N' U+004E
+  {   504,  11,  12,  13,    1,  -11 },   // 0x4f 'O' U+004F
+  {   521,   8,  12,  10,    1,  -11 },   // 0x50 'P' U+0050
+  {   533,  11,  13,  13,    1,  -11 },   // 0x51 'Q' U+0051
+  {   551,   8,  12,  10,    1,  -11 },   // 0x52 'R' U+0052
+  {   563,   9,  12,  10,    0,  -11 },   // 0x53 'S' U+0053
+  {   577,   9,  12,  11,    1,  -11 },   // 0x54 'T' U+0054
+  {   591,   9,  12,  11,    1,  -11 },   // 0x55 'U' U+0055
+  {   605,  11,  12,  11,    0,  -11 },   // 0x56 'V' U+0056
+  {   622,  16,  12,  16,    0,  -11 },   // 0x57 'W' U+0057
+  {   646,  11,  12,  11,    0,  -11 },   // 0x58 'X' U+0058
+  {   663,  10,  12,  10,    0,  -11 },   // 0x59 'Y' U+0059
+  {   678,   9,  12,  11,    1,  -11 },   // 0x5a 'Z' U+005A
+  {   692,   4,  15,   6,    1,  -12 },   // 0x5b '[' U+005B
+  {   700,   6,  14,   6,    0,  -11 },   // 0x5c '\' U+005C
+  {   711,   4,  15,   5,    0,  -12 },   // 0x5d ']' U+005D
+  {   719,   7,   6,   7,    0,  -11 },   // 0x5e '^' U+005E
+  {   725,   8,   2,   8,    0,    1 },   // 0x5f '_' U+005F
+  {   727,   3,   2,   7,    2,  -11 },   // 0x60 '`' U+0060
+  {   728,   8,   9,  10,    1,   -8 },   // 0x61 'a' U+0061
+  {   737,   8,  12,  10,    1,  -11 },   // 0x62 'b' U+0062
+  {   749,   8,   9,  10,    1,   -8 },   // 0x63 'c' U+0063
+  {   758,   8,  12,  10,    1,  -11 },   // 0x64 'd' U+0064
+  {   770,   8,   9,  10,    1,   -8 },   // 0x65 'e' U+0065
+  {   779,   5,  13,   7,    1,  -12 },   // 0x66 'f' U+0066
+  {   788,   8,  12,  10,    1,   -8 },   // 0x67 'g' U+0067
+  {   800,   8,  12,  10,    1,  -11 },   // 0x68 'h' U+0068
+  {   812,   2,  13,   4,    1,  -12 },   // 0x69 'i' U+0069
+  {   816,   4,  16,   4,   -1,  -12 },   // 0x6a 'j' U+006A
+  {   824,   8,  12,   9,    1,  -11 },   // 0x6b 'k' U+006B
+  {   836,   2,  12,   4,    1,  -11 },   // 0x6c 'l' U+006C
+  {   839,  12,   9,  14,    1,   -8 },   // 0x6d 'm' U+006D
+  {   853,   8,   9,  10,    1,   -8 },   // 0x6e 'n' U+006E
+  {   862,   8,   9,  10,    1,   -8 },   // 0x6f 'o' U+006F
+  {   871,   8,  12,  10,    1,   -8 },   // 0x70 'p' U+0070
+  {   883,   8,  12,  10,    1,   -8 },   // 0x71 'q' U+0071
+  {   895,   5,   9,   7,    1,   -8 },   // 0x72 'r' U+0072
+  {   901,   7,   9,   9,    1,   -8 },   // 0x73 's' U+0073
+  {   909,   5,  11,   7,    1,  -10 },   // 0x74 't' U+0074
+  {   916,   8,   9,  10,    1,   -8 },   // 0x75 'u' U+0075
+  {   925,   9,   9,   9,    0,   -8 },   // 0x76 'v' U+0076
+  {   936,  13,   9,  13,    0,   -8 },   // 0x77 'w' U+0077
+  {   951,   8,   9,   9,    0,   -8 },   // 0x78 'x' U+0078
+  {   960,   9,  12,   9,    0,   -8 },   // 0x79 'y' U+0079
+  {   974,   7,   9,   9,    1,   -8 },   // 0x7a 'z' U+007A
+  {   982,   6,  16,   7,    1,  -12 },   // 0x7b '{' U+007B
+  {   994,   2,  19,   6,    2,  -14 },   // 0x7c '|' U+007C
+  {   999,   6,  16,   7,    0,  -12 },   // 0x7d '}' U+007D
+  {  1011,   8,   4,  10,    1,   -6 },   // 0x7e '~' U+007E
+  {     0,   0,   0,   8,    1,  -14 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  1015,   1,   1,   3,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  1016,  11,  16,  12,    1,  -11 },   // 0x81 '0x0104' U+0104
+  {  1038,   6,   3,   7,    1,  -12 },   // 0x82 '0x02D8' U+02D8
+  {  1041,   9,  12,   9,    0,  -11 },   // 0x83 '0x0141' U+0141
+  {  1055,  10,  10,  12,    1,   -9 },   // 0x84 '0x00A4' U+00A4
+  {  1068,   8,  12,   9,    1,  -11 },   // 0x85 '0x013D' U+013D
+  {  1080,   9,  15,  10,    0,  -14 },   // 0x86 '0x015A' U+015A
+  {  1097,   8,  14,   8,    0,  -11 },   // 0x87 '0x00A7' U+00A7
+  {  1111,   6,   2,   8,    1,  -11 },   // 0x88 '0x00A8' U+00A8
+  {  1113,   9,  16,  10,    0,  -15 },   // 0x89 '0x0160' U+0160
+  {  1131,   9,  16,  10,    0,  -11 },   // 0x8a '0x015E' U+015E
+  {  1149,   9,  16,  11,    1,  -15 },   // 0x8b '0x0164' U+0164
+  {  1167,   9,  15,  11,    1,  -14 },   // 0x8c '0x0179' U+0179
+  {  1184,   5,   2,   7,    1,   -5 },   // 0x8d '0x00AD' U+00AD
+  {  1186,   9,  16,  11,    1,  -15 },   // 0x8e '0x017D' U+017D
+  {  1204,   9,  15,  11,    1,  -14 },   // 0x8f '0x017B' U+017B
+  {  1221,   6,   6,   8,    1,  -11 },   // 0x90 '0x00B0' U+00B0
+  {  1226,   8,  12,  10,    1,   -8 },   // 0x91 '0x0105' U+0105
+  {  1238,   3,   5,   4,    0,   -1 },   // 0x92 '0x02DB' U+02DB
+  {  1240,   4,  12,   4,    0,  -11 },   // 0x93 '0x0142' U+0142
+  {  1246,   3,   2,   7,    2,  -11 },   // 0x94 '0x00B4' U+00B4
+  {  1247,   5,  12,   6,    1,  -11 },   // 0x95 '0x013E' U+013E
+  {  1255,   7,  12,   9,    1,  -11 },   // 0x96 '0x015B' U+015B
+  {  1266,   6,   3,   8,    1,  -12 },   // 0x97 '0x02C7' U+02C7
+  {  1269,   4,   4,   6,    1,    1 },   // 0x98 '0x00B8' U+00B8
+  {  1271,   7,  13,   9,    1,  -12 },   // 0x99 '0x0161' U+0161
+  {  1283,   7,  13,   9,    1,   -8 },   // 0x9a '0x015F' U+015F
+  {  1295,   6,  13,   7,    1,  -12 },   // 0x9b '0x0165' U+0165
+  {  1305,   7,  12,   9,    1,  -11 },   // 0x9c '0x017A' U+017A
+  {  1316,   7,   2,   7,    0,  -11 },   // 0x9d '0x02DD' U+02DD
+  {  1318,   7,  13,   9,    1,  -12 },   // 0x9e '0x017E' U+017E
+  {  1330,   7,  13,   9,    1,  -12 },   // 0x9f '0x017C' U+017C
+  {  1342,   8,  15,  10,    1,  -14 },   // 0xa0 '0x0154' U+0154
+  {  1357,  10,  15,  12,    1,  -14 },   // 0xa1 '0x00C1' U+00C1
+  {  1376,  10,  16,  12,    1,  -15 },   // 0xa2 '0x00C2' U+00C2
+  {  1396,  10,  16,  12,    1,  -15 },   // 0xa3 '0x0102' U+0102
+  {  1416,  10,  15,  12,    1,  -14 },   // 0xa4 '0x00C4' U+00C4
+  {  1435,   8,  15,   9,    1,  -14 },   // 0xa5 '0x0139' U+0139
+  {  1450,  10,  15,  11,    1,  -14 },   // 0xa6 '0x0106' U+0106
+  {  1469,  10,  16,  12,    1,  -11 },   // 0xa7 '0x00C7' U+00C7
+  {  1489,  10,  16,  11,    1,  -15 },   // 0xa8 '0x010C' U+010C
+  {  1509,   8,  15,   9,    1,  -14 },   // 0xa9 '0x00C9' U+00C9
+  {  1524,   8,  16,   9,    1,  -11 },   // 0xaa '0x0118' U+0118
+  {  1540,   8,  15,   9,    1,  -14 },   // 0xab '0x00CB' U+00CB
+  {  1555,   8,  16,   9,    1,  -15 },   // 0xac '0x011A' U+011A
+  {  1571,   3,  15,   4,    1,  -14 },   // 0xad '0x00CD' U+00CD
+  {  1577,   6,  16,   4,   -1,  -15 },   // 0xae '0x00CE' U+00CE
+  {  1589,   9,  16,  11,    1,  -15 },   // 0xaf '0x010E' U+010E
+  {  1607,  11,  12,  11,   -1,  -11 },   // 0xb0 '0x0110' U+0110
+  {  1624,   9,  15,  11,    1,  -14 },   // 0xb1 '0x0143' U+0143
+  {  1641,   9,  16,  11,    1,  -15 },   // 0xb2 '0x0147' U+0147
+  {  1659,  11,  15,  13,    1,  -14 },   // 0xb3 '0x00D3' U+00D3
+  {  1680,  11,  16,  13,    1,  -15 },   // 0xb4 '0x00D4' U+00D4
+  {  1702,  11,  15,  13,    1,  -14 },   // 0xb5 '0x0150' U+0150
+  {  1723,  11,  15,  13,    1,  -14 },   // 0xb6 '0x00D6' U+00D6
+  {  1744,   8,   8,  10,    1,   -8 },   // 0xb7 '0x00D7' U+00D7
+  {  1752,   8,  16,  10,    1,  -15 },   // 0xb8 '0x0158' U+0158
+  {  1768,   9,  16,  11,    1,  -15 },   // 0xb9 '0x016E' U+016E
+  {  1786,   9,  15,  11,    1,  -14 },   // 0xba '0x00DA' U+00DA
+  {  1803,   9,  15,  11,    1,  -14 },   // 0xbb '0x0170' U+0170
+  {  1820,   9,  15,  11,    1,  -14 },   // 0xbc '0x00DC' U+00DC
+  {  1837,  10,  15,  10,    0,  -14 },   // 0xbd '0x00DD' U+00DD
+  {  1856,   9,  16,  11,    1,  -11 },   // 0xbe '0x0162' U+0162
+  {  1874,   9,  12,  11,    1,  -11 },   // 0xbf '0x00DF' U+00DF
+  {  1888,   5,  12,   7,    1,  -11 },   // 0xc0 '0x0155' U+0155
+  {  1896,   8,  12,  10,    1,  -11 },   // 0xc1 '0x00E1' U+00E1
+  {  1908,   8,  13,  10,    1,  -12 },   // 0xc2 '0x00E2' U+00E2
+  {  1921,   8,  13,  10,    1,  -12 },   // 0xc3 '0x0103' U+0103
+  {  1934,   8,  13,  10,    1,  -12 },   // 0xc4 '0x00E4' U+00E4
+  {  1947,   3,  15,   4,    1,  -14 },   // 0xc5 '0x013A' U+013A
+  {  1953,   8,  12,  10,    1,  -11 },   // 0xc6 '0x0107' U+0107
+  {  1965,   8,  13,  10,    1,   -8 },   // 0xc7 '0x00E7' U+00E7
+  {  1978,   8,  13,  10,    1,  -12 },   // 0xc8 '0x010D' U+010D
+  {  1991,   8,  12,  10,    1,  -11 },   // 0xc9 '0x00E9' U+00E9
+  {  2003,   8,  12,  10,    1,   -8 },   // 0xca '0x0119' U+0119
+  {  2015,   8,  13,  10,    1,  -12 },   // 0xcb '0x00EB' U+00EB
+  {  2028,   8,  13,  10,    1,  -12 },   // 0xcc '0x011B' U+011B
+  {  2041,   3,  12,   4,    1,  -11 },   // 0xcd '0x00ED' U+00ED
+  {  2046,   6,  13,   4,   -1,  -12 },   // 0xce '0x00EE' U+00EE
+  {  2056,  11,  13,  12,    1,  -12 },   // 0xcf '0x010F' U+010F
+  {  2074,   9,  12,  10,    1,  -11 },   // 0xd0 '0x0111' U+0111
+  {  2088,   8,  12,  10,    1,  -11 },   // 0xd1 '0x0144' U+0144
+  {  2100,   8,  13,  10,    1,  -12 },   // 0xd2 '0x0148' U+0148
+  {  2113,   8,  12,  10,    1,  -11 },   // 0xd3 '0x00F3' U+00F3
+  {  2125,   8,  13,  10,    1,  -12 },   // 0xd4 '0x00F4' U+00F4
+  {  2138,   8,  12,  10,    1,  -11 },   // 0xd5 '0x0151' U+0151
+  {  2150,   8,  13,  10,    1,  -12 },   // 0xd6 '0x00F6' U+00F6
+  {  2163,   8,   9,  10,    1,   -8 },   // 0xd7 '0x00F7' U+00F7
+  {  2172,   7,  13,   7,    0,  -12 },   // 0xd8 '0x0159' U+0159
+  {  2184,   8,  14,  10,    1,  -13 },   // 0xd9 '0x016F' U+016F
+  {  2198,   8,  12,  10,    1,  -11 },   // 0xda '0x00FA' U+00FA
+  {  2210,   8,  12,  10,    1,  -11 },   // 0xdb '0x0171' U+0171
+  {  2222,   8,  13,  10,    1,  -12 },   // 0xdc '0x00FC' U+00FC
+  {  2235,   9,  16,   9,    0,  -12 },   // 0xdd '0x00FD' U+00FD
+  {  2253,   6,  15,   7,    1,  -10 },   // 0xde '0x0163' U+0163
+  {  2265,   2,   2,   4,    1,  -11 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_Bold8pt8b PROGMEM = {
+  (uint8_t  *)InterTight_Bold8pt8bBitmaps,
+  (GFXglyph *)InterTight_Bold8pt8bGlyphs,
+  0x20, 0xDF, 19 };
+
+// Approx. 3617 bytes
@@ -0,0 +1,493 @@
+// Subset of ../InterTightSemiBold10pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_SemiBold10pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0xCF, 0x3C, 0xF3, 0xCF, 0x30,
+  0x0C, 0x61, 0x8C, 0x18, 0xC7, 0xFF, 0x7F, 0xF1, 0x8C, 0x18, 0xC3, 0x18,
+  0xFF, 0xEF, 0xFE, 0x31, 0x83, 0x18, 0x31, 0x86, 0x30, 0x02, 0x00, 0x20,
+  0x02, 0x00, 0xF8, 0x3F, 0xE7, 0xAF, 0x72, 0x77, 0x20, 0x7E, 0x03, 0xF8,
+  0x0F, 0xE0, 0x2F, 0x02, 0x77, 0x27, 0x72, 0xF3, 0xFE, 0x1F, 0x80, 0x20,
+  0x02, 0x00, 0x78, 0x37, 0xE3, 0x33, 0x11, 0x99, 0x8F, 0xD8, 0x3C, 0x80,
+  0x0C, 0x00, 0xDE, 0x05, 0xF8, 0x6C, 0xC6, 0x66, 0x23, 0x33, 0x1F, 0xB0,
+  0x78, 0x1E, 0x03, 0xF0, 0x71, 0x87, 0x18, 0x73, 0x83, 0xF0, 0x3E, 0x03,
+  0xE6, 0x7E, 0x6E, 0x7E, 0xE3, 0xCF, 0x1C, 0x7F, 0xE3, 0xE6, 0xFF, 0xF0,
+  0x19, 0xCC, 0xE7, 0x33, 0x9C, 0xE7, 0x39, 0xCE, 0x39, 0xCE, 0x38, 0xC0,
+  0xC7, 0x18, 0xE7, 0x18, 0xE7, 0x39, 0xCE, 0x73, 0xB9, 0xCE, 0xE6, 0x00,
+  0x18, 0x18, 0xFF, 0x7E, 0x7E, 0xFF, 0x18, 0x18, 0x0C, 0x03, 0x00, 0xC0,
+  0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x7F, 0xED, 0x80,
+  0xFF, 0xF0, 0xFF, 0x80, 0x06, 0x1C, 0x30, 0x61, 0xC3, 0x06, 0x0C, 0x38,
+  0x60, 0xC1, 0x87, 0x0C, 0x18, 0x30, 0xE1, 0x80, 0x1F, 0x07, 0xF1, 0xC7,
+  0x38, 0xEE, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1D, 0xC7, 0x38,
+  0xE3, 0xF8, 0x3E, 0x00, 0x1E, 0x7F, 0xFE, 0x78, 0xE1, 0xC3, 0x87, 0x0E,
+  0x1C, 0x38, 0x70, 0xE1, 0xC0, 0x3F, 0x1F, 0xEF, 0x3F, 0x87, 0x01, 0xC0,
+  0x70, 0x38, 0x1C, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xFF, 0xFF, 0xF0, 0x3F,
+  0x0F, 0xF3, 0xC7, 0x00, 0xE0, 0x1C, 0x1E, 0x03, 0xE0, 0x0E, 0x00, 0xE0,
+  0x1F, 0x83, 0xF8, 0xE7, 0xFC, 0x3E, 0x00, 0x03, 0xC0, 0x7C, 0x0F, 0xC0,
+  0xFC, 0x1D, 0xC3, 0x9C, 0x31, 0xC7, 0x1C, 0xE1, 0xCF, 0xFF, 0xFF, 0xF0,
+  0x1C, 0x01, 0xC0, 0x1C, 0x7F, 0x9F, 0xE6, 0x01, 0x80, 0x6F, 0x3F, 0xEE,
+  0x3C, 0x07, 0x01, 0xC0, 0x7E, 0x1F, 0xCE, 0x7F, 0x8F, 0x80, 0x1F, 0x07,
+  0xF9, 0xC7, 0xB0, 0x0E, 0x79, 0xFF, 0xBC, 0x7F, 0x87, 0xE0, 0xFC, 0x1F,
+  0xC3, 0xB8, 0xE3, 0xFC, 0x3E, 0x00, 0xFF, 0xFF, 0xF0, 0x1C, 0x0E, 0x03,
+  0x81, 0xC0, 0x70, 0x38, 0x0E, 0x07, 0x01, 0xC0, 0xE0, 0x38, 0x1C, 0x00,
+  0x3F, 0x0F, 0xF3, 0x8F, 0x70, 0xEF, 0x1C, 0x7E, 0x0F, 0xE3, 0x8E, 0xE0,
+  0xFC, 0x1F, 0x83, 0xF8, 0xF7, 0xFC, 0x3E, 0x00, 0x1F, 0x0F, 0xF1, 0xC7,
+  0x70, 0xFE, 0x0F, 0xC3, 0xFC, 0x7B, 0xFF, 0x3C, 0xE0, 0x1F, 0x87, 0x38,
+  0xE7, 0xF8, 0x3E, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x77, 0x70, 0x00, 0x00,
+  0x76, 0x66, 0x6C, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0xF0, 0x38, 0x0F, 0xC0,
+  0x7C, 0x07, 0xC0, 0x70, 0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
+  0xFE, 0xC0, 0x3C, 0x0F, 0xC0, 0x7C, 0x07, 0xC0, 0xF0, 0xF8, 0xF8, 0xF8,
+  0x38, 0x08, 0x00, 0x3E, 0x3F, 0xB8, 0xFC, 0x70, 0x38, 0x3C, 0x3C, 0x3C,
+  0x1C, 0x0E, 0x00, 0x03, 0x81, 0xC0, 0xE0, 0x03, 0xF8, 0x03, 0xFF, 0x83,
+  0xC0, 0xF0, 0xC0, 0x0E, 0x63, 0xD9, 0x99, 0xFE, 0x3C, 0xE3, 0x8F, 0x30,
+  0x63, 0xCC, 0x18, 0xF3, 0x06, 0x3C, 0xC1, 0x8F, 0x38, 0xE6, 0xE7, 0xFF,
+  0x98, 0xF3, 0xC7, 0x00, 0x00, 0xF0, 0x20, 0x1F, 0xFC, 0x00, 0xFE, 0x00,
+  0x07, 0x80, 0x1E, 0x00, 0xFC, 0x03, 0xF0, 0x0C, 0xC0, 0x73, 0x81, 0xCE,
+  0x06, 0x18, 0x3F, 0xF0, 0xFF, 0xC7, 0x03, 0x9C, 0x0E, 0x60, 0x1B, 0x80,
+  0x70, 0xFF, 0x1F, 0xF3, 0x8F, 0x70, 0xEE, 0x1D, 0xC7, 0x3F, 0xC7, 0xFC,
+  0xE1, 0xDC, 0x1F, 0x83, 0xF0, 0xFF, 0xFD, 0xFF, 0x00, 0x0F, 0xC1, 0xFF,
+  0x1E, 0x1C, 0xE0, 0x7E, 0x03, 0xF0, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07,
+  0x01, 0xDC, 0x0E, 0xF0, 0xE3, 0xFE, 0x07, 0xE0, 0xFF, 0x0F, 0xFC, 0xE1,
+  0xEE, 0x0E, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0xEE, 0x1E, 0xFF, 0xCF, 0xF0, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xE0, 0x38,
+  0x0F, 0xFB, 0xFE, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xF8, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0xFF, 0xE0, 0x70, 0x38, 0x1C,
+  0x0E, 0x07, 0x00, 0x0F, 0xC1, 0xFF, 0x1E, 0x1C, 0xE0, 0xFE, 0x00, 0x70,
+  0x03, 0x87, 0xFC, 0x3F, 0xE0, 0x3F, 0x01, 0xDC, 0x1C, 0xF1, 0xE3, 0xFE,
+  0x07, 0xE0, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+  0x0E, 0x07, 0x03, 0x81, 0xF8, 0xFC, 0x77, 0xF1, 0xF0, 0xE0, 0xFE, 0x1E,
+  0xE1, 0xCE, 0x38, 0xE7, 0x0E, 0xE0, 0xFE, 0x0F, 0xE0, 0xF7, 0x0E, 0x38,
+  0xE3, 0x8E, 0x1C, 0xE0, 0xEE, 0x0F, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0F, 0xFF, 0xFC, 0xF0, 0x1F,
+  0xE0, 0x3F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x8D, 0xFB, 0x1B, 0xF6,
+  0x37, 0xE6, 0xCF, 0xCD, 0x9F, 0x9F, 0x3F, 0x1C, 0x7E, 0x38, 0xFC, 0x61,
+  0xC0, 0xE0, 0x7F, 0x07, 0xF0, 0x7F, 0x87, 0xFC, 0x7E, 0xC7, 0xEE, 0x7E,
+  0x77, 0xE3, 0x7E, 0x3F, 0xE1, 0xFE, 0x0F, 0xE0, 0xFE, 0x07, 0x0F, 0x81,
+  0xFF, 0x1E, 0x3C, 0xE0, 0xEE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0,
+  0x3F, 0x01, 0xDC, 0x1C, 0xF1, 0xE3, 0xFE, 0x07, 0xC0, 0xFF, 0x1F, 0xFB,
+  0x87, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x7F, 0xFE, 0xFF, 0x9C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x00, 0x0F, 0x81, 0xFF, 0x1E, 0x3C, 0xE0, 0xEE,
+  0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x19, 0xDC, 0x7C, 0xF3,
+  0xE3, 0xFE, 0x07, 0xF0, 0x01, 0xC0, 0xFF, 0x0F, 0xFC, 0xE1, 0xEE, 0x0E,
+  0xE0, 0xEE, 0x0E, 0xE1, 0xEF, 0xFC, 0xFF, 0x0E, 0x38, 0xE3, 0x8E, 0x1C,
+  0xE1, 0xEE, 0x0E, 0x0F, 0x83, 0xFE, 0x78, 0xF7, 0x07, 0x70, 0x07, 0xC0,
+  0x3F, 0x80, 0xFE, 0x00, 0xF0, 0x07, 0x70, 0x77, 0x0F, 0x3F, 0xE1, 0xF8,
+  0xFF, 0xFF, 0xFC, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x7E, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0x77, 0x0E, 0x7F, 0xE1, 0xF8, 0xE0, 0x3B, 0x01, 0xDC, 0x0E, 0xE0, 0xE3,
+  0x07, 0x1C, 0x30, 0xE3, 0x83, 0x9C, 0x1C, 0xC0, 0x6E, 0x03, 0xF0, 0x1F,
+  0x00, 0x78, 0x03, 0xC0, 0xE0, 0xE0, 0xFC, 0x1C, 0x1D, 0x83, 0xC3, 0x38,
+  0xF8, 0xE7, 0x1B, 0x1C, 0x63, 0x63, 0x8C, 0x6E, 0x61, 0xDC, 0xDC, 0x3B,
+  0x1B, 0x83, 0x63, 0x60, 0x7C, 0x7C, 0x0F, 0x07, 0x80, 0xE0, 0xF0, 0x1C,
+  0x1C, 0x00, 0x70, 0x73, 0x83, 0x8E, 0x38, 0x73, 0x81, 0xDC, 0x07, 0xC0,
+  0x3E, 0x01, 0xF0, 0x0F, 0x80, 0xEE, 0x0E, 0x70, 0x71, 0xC7, 0x07, 0x78,
+  0x38, 0xE0, 0x3B, 0x83, 0x9C, 0x1C, 0x71, 0xC3, 0x8E, 0x0E, 0xE0, 0x3E,
+  0x01, 0xF0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80,
+  0xFF, 0xFF, 0xFC, 0x07, 0x00, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x38, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xF9, 0xCE, 0x73,
+  0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xFF, 0xC0, 0xC1, 0x83, 0x83, 0x06,
+  0x0C, 0x0C, 0x18, 0x30, 0x70, 0x60, 0xC1, 0x83, 0x83, 0x06, 0x0C, 0x1C,
+  0xFF, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0xFF, 0xC0,
+  0x1C, 0x1C, 0x36, 0x36, 0x63, 0x63, 0xC3, 0xFF, 0xFF, 0xC0, 0x66, 0x30,
+  0x3E, 0x3F, 0x9C, 0xE0, 0x70, 0x7B, 0xFF, 0xCF, 0xC7, 0xE7, 0xFF, 0xDE,
+  0xE0, 0xE0, 0x38, 0x0E, 0x03, 0xBC, 0xFF, 0xBC, 0xEE, 0x1F, 0x87, 0xE1,
+  0xF8, 0x7E, 0x1F, 0xCE, 0xFF, 0xBB, 0xC0, 0x1F, 0x1F, 0xE7, 0x1F, 0x83,
+  0xE0, 0x38, 0x0E, 0x03, 0x83, 0x71, 0xDF, 0xE1, 0xF0, 0x01, 0xC0, 0x70,
+  0x1C, 0xF7, 0x7F, 0xDC, 0xFE, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1D, 0xCF,
+  0x7F, 0xCF, 0x70, 0x1E, 0x1F, 0xE7, 0x3B, 0x87, 0xFF, 0xFF, 0xFE, 0x03,
+  0x80, 0x71, 0xDF, 0xE1, 0xF0, 0x04, 0x1E, 0x3E, 0x38, 0xFE, 0xFE, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3D, 0xDF, 0xF7, 0x3F,
+  0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xF3, 0xDF, 0xF3, 0xDC, 0x07, 0xF3,
+  0xDF, 0xE3, 0xF0, 0xE0, 0x38, 0x0E, 0x03, 0xBC, 0xFF, 0xBC, 0xFE, 0x1F,
+  0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x70, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x39, 0xCE, 0x03, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C,
+  0xE7, 0x3F, 0xFC, 0xE0, 0x38, 0x0E, 0x03, 0x87, 0xE3, 0xB9, 0xCE, 0xE3,
+  0xB0, 0xFC, 0x3F, 0x8E, 0x73, 0x9C, 0xE3, 0xB8, 0x70, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xEF, 0x3D, 0xFE, 0xFF, 0xCF, 0x3F, 0x1C, 0x7E, 0x38,
+  0xFC, 0x71, 0xF8, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xC7, 0x1F, 0x8E, 0x38,
+  0xEF, 0x3F, 0xEF, 0x3F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8,
+  0x7E, 0x1C, 0x1F, 0x0F, 0xF9, 0xC7, 0x70, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
+  0x07, 0x71, 0xCF, 0xF0, 0x7C, 0x00, 0xEF, 0x3F, 0xEF, 0x3B, 0x87, 0xE1,
+  0xF8, 0x7E, 0x1F, 0x87, 0xF3, 0xBF, 0xEE, 0xF3, 0x80, 0xE0, 0x38, 0x0E,
+  0x00, 0x3D, 0xDF, 0xF7, 0x3F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x73,
+  0xDF, 0xF3, 0xDC, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0xEF, 0xFF, 0x38, 0xE3,
+  0x8E, 0x38, 0xE3, 0x8E, 0x00, 0x3E, 0x3F, 0xB8, 0xDC, 0x0F, 0x83, 0xF8,
+  0x3E, 0x07, 0xE3, 0xFF, 0x8F, 0x80, 0x38, 0x70, 0xE7, 0xFF, 0xE7, 0x0E,
+  0x1C, 0x38, 0x70, 0xE1, 0xC3, 0xC3, 0xC0, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
+  0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xF3, 0xDF, 0xF3, 0xDC, 0xE0, 0xCC, 0x39,
+  0xC7, 0x38, 0xC3, 0x38, 0x67, 0x0E, 0xC0, 0xD8, 0x1F, 0x03, 0xC0, 0x38,
+  0x00, 0xE3, 0x87, 0x63, 0xC6, 0x63, 0xCE, 0x73, 0xCE, 0x77, 0xCC, 0x36,
+  0xEC, 0x36, 0x7C, 0x3E, 0x7C, 0x3C, 0x78, 0x1C, 0x38, 0x1C, 0x38, 0x61,
+  0xDC, 0x63, 0x38, 0xFC, 0x1E, 0x07, 0x81, 0xE0, 0xFC, 0x33, 0x9C, 0x66,
+  0x1C, 0xE0, 0xCC, 0x39, 0xC7, 0x38, 0xC3, 0x38, 0x67, 0x0E, 0xC0, 0xD8,
+  0x1F, 0x03, 0xC0, 0x38, 0x07, 0x01, 0xC0, 0xF8, 0x1E, 0x00, 0xFF, 0xFF,
+  0xC1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x70, 0x7F, 0xFF, 0xE0, 0x02,
+  0x3C, 0xF9, 0xC3, 0x87, 0x0E, 0x1C, 0x39, 0xE3, 0xE1, 0xC3, 0x87, 0x0E,
+  0x1C, 0x38, 0x3C, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x01, 0xE3, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x3C, 0xF9, 0xC3,
+  0x87, 0x0E, 0x1C, 0x79, 0xE3, 0x80, 0x78, 0xFF, 0x3C, 0xFF, 0x1E, 0x00,
+  0x07, 0x80, 0x1E, 0x00, 0xFC, 0x03, 0xF0, 0x0C, 0xC0, 0x73, 0x81, 0xCE,
+  0x06, 0x18, 0x3F, 0xF0, 0xFF, 0xC7, 0x03, 0x1C, 0x0E, 0x60, 0x1B, 0x80,
+  0x60, 0x03, 0x80, 0x0C, 0x00, 0x3C, 0x00, 0x70, 0xCD, 0xF9, 0xE0, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x74, 0x0F, 0x87, 0xC0, 0x38, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0xFE, 0x7F, 0xC0, 0xCF, 0x3F, 0xFF, 0x70, 0xE6,
+  0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0x67, 0x0E, 0xFF, 0xF0,
+  0xF0, 0x06, 0x73, 0x39, 0x9C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70,
+  0x38, 0x1C, 0x0E, 0x07, 0xFF, 0xFE, 0x03, 0x80, 0x30, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0xF8, 0x3F, 0xE7, 0x8F, 0x70, 0x77, 0x00, 0x7C, 0x03, 0xF8,
+  0x0F, 0xE0, 0x0F, 0x00, 0x77, 0x07, 0x70, 0xF3, 0xFE, 0x1F, 0x80, 0x3E,
+  0x1F, 0xCE, 0x3B, 0x8E, 0xF0, 0x1F, 0x0F, 0xF3, 0x1E, 0xC1, 0xBC, 0x67,
+  0xF8, 0x7C, 0x07, 0xB8, 0xEE, 0x39, 0xFC, 0x3E, 0x00, 0xEF, 0xDC, 0x19,
+  0xC0, 0xD8, 0x0F, 0x00, 0x60, 0x00, 0x00, 0xFC, 0x3F, 0xE7, 0x87, 0x70,
+  0x07, 0x00, 0x7C, 0x03, 0xF8, 0x0F, 0xE0, 0x0F, 0x00, 0x77, 0x07, 0x78,
+  0xF3, 0xFE, 0x1F, 0x80, 0x0F, 0x83, 0xFE, 0x78, 0xF7, 0x07, 0x70, 0x07,
+  0xC0, 0x3F, 0x80, 0xFE, 0x00, 0xF0, 0x07, 0x70, 0x77, 0x0F, 0x3F, 0xE1,
+  0xF8, 0x06, 0x00, 0x30, 0x03, 0x00, 0x70, 0x06, 0x00, 0x31, 0x83, 0x60,
+  0x38, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x70, 0x0E, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x00,
+  0x03, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x0E, 0x01,
+  0xC0, 0x70, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0x70, 0x1F,
+  0xFF, 0xFF, 0x80, 0xFF, 0xF0, 0x31, 0x83, 0x60, 0x38, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xF8, 0x0E, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x00, 0xE0, 0x38,
+  0x0E, 0x03, 0x80, 0x70, 0x1F, 0xFF, 0xFF, 0x80, 0x0E, 0x01, 0xC0, 0x38,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x0E, 0x01, 0xC0, 0x70, 0x1C, 0x07,
+  0x00, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0x70, 0x1F, 0xFF, 0xFF, 0x80, 0x38,
+  0xFB, 0x1E, 0x3C, 0x6F, 0x8E, 0x00, 0x3E, 0x3F, 0x9C, 0xE0, 0x70, 0x7B,
+  0xFF, 0xCF, 0xC7, 0xE7, 0xFF, 0xDE, 0xE0, 0xE0, 0x60, 0x3C, 0x0E, 0x6C,
+  0xCF, 0x70, 0x38, 0xE3, 0x8E, 0x38, 0xF7, 0xFE, 0x38, 0xE3, 0x8E, 0x38,
+  0xE0, 0x76, 0xC0, 0x0F, 0xBE, 0xF8, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38,
+  0xE3, 0x8E, 0x00, 0x06, 0x06, 0x02, 0x00, 0x03, 0xE3, 0xFB, 0x8D, 0xC0,
+  0xF8, 0x3F, 0x83, 0xE0, 0x7E, 0x3F, 0xF8, 0xF8, 0x66, 0xF8, 0xE0, 0x46,
+  0x3F, 0xE0, 0x63, 0x1B, 0x07, 0x01, 0x00, 0x01, 0xF1, 0xFD, 0xC6, 0xE0,
+  0x7C, 0x1F, 0xC1, 0xF0, 0x3F, 0x1F, 0xFC, 0x7C, 0x3E, 0x3F, 0xB8, 0xDC,
+  0x0F, 0x83, 0xF8, 0x3E, 0x07, 0xE3, 0xFF, 0x8F, 0x81, 0x80, 0x60, 0x30,
+  0x78, 0x38, 0x03, 0x02, 0x3A, 0x38, 0x38, 0xFE, 0xFE, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x3C, 0x1E, 0x06, 0x06, 0x03, 0x00, 0x0F, 0xFF,
+  0xFC, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x07, 0xFF, 0xFE, 0x37,
+  0x66, 0x6C, 0x63, 0x1B, 0x8F, 0x83, 0x80, 0x07, 0xFF, 0xFE, 0x0E, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0x83, 0x83, 0xFF, 0xFF, 0x1C, 0x0E, 0x07, 0x00,
+  0x0F, 0xFF, 0xFC, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x07, 0xFF,
+  0xFE, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xCE,
+  0x1E, 0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x1E, 0xFF, 0xCF, 0xF0, 0xE3, 0x8E,
+  0x38, 0xE1, 0xCE, 0x1E, 0xE0, 0xE0, 0x01, 0xC0, 0x06, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x03, 0xF0, 0x0F, 0xC0, 0x33, 0x01,
+  0xCE, 0x07, 0x38, 0x18, 0x60, 0xFF, 0xC3, 0xFF, 0x1C, 0x0E, 0x70, 0x39,
+  0x80, 0x6E, 0x01, 0xC0, 0x07, 0x80, 0x3E, 0x01, 0xCC, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0x00, 0x78, 0x03, 0xF0, 0x0F, 0xC0, 0x33, 0x01, 0xCE, 0x07,
+  0x38, 0x18, 0x60, 0xFF, 0xC3, 0xFF, 0x1C, 0x0E, 0x70, 0x39, 0x80, 0x6E,
+  0x01, 0xC0, 0x0C, 0xC0, 0x33, 0x00, 0xFC, 0x01, 0xE0, 0x00, 0x00, 0x1E,
+  0x00, 0x78, 0x03, 0xF0, 0x0F, 0xC0, 0x33, 0x01, 0xCE, 0x07, 0x38, 0x18,
+  0x60, 0xFF, 0xC3, 0xFF, 0x1C, 0x0E, 0x70, 0x39, 0x80, 0x6E, 0x01, 0xC0,
+  0x1D, 0xC0, 0x77, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1E, 0x00, 0xF8,
+  0x03, 0x60, 0x1D, 0xC0, 0x73, 0x01, 0x8E, 0x0E, 0x38, 0x3F, 0xF0, 0xFF,
+  0xC7, 0x03, 0x1C, 0x0E, 0x60, 0x3B, 0x80, 0x70, 0x30, 0x30, 0x18, 0x00,
+  0x00, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,
+  0x81, 0xC0, 0xE0, 0x7F, 0xFF, 0xE0, 0x01, 0x80, 0x0C, 0x00, 0xC0, 0x00,
+  0x00, 0x00, 0x07, 0xE0, 0xFF, 0x8F, 0x0E, 0x70, 0x3F, 0x01, 0xF8, 0x01,
+  0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0xEE, 0x07, 0x78, 0x71, 0xFF, 0x03,
+  0xF0, 0x0F, 0xC1, 0xFF, 0x1E, 0x1C, 0xE0, 0x7E, 0x03, 0xF0, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x07, 0x01, 0xDC, 0x0E, 0xF0, 0xE3, 0xFE, 0x07, 0xE0,
+  0x0C, 0x00, 0x30, 0x01, 0x80, 0x3C, 0x01, 0xC0, 0x0C, 0xC0, 0x7E, 0x01,
+  0xE0, 0x06, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0xCF, 0x0E, 0x70, 0x3F, 0x00,
+  0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0xEE, 0x07, 0x78, 0x71,
+  0xFF, 0x03, 0xE0, 0x06, 0x01, 0x80, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0x80, 0xE0, 0x38, 0x0E, 0x03, 0xFE, 0xFF, 0xB8, 0x0E, 0x03, 0x80, 0xE0,
+  0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xE0, 0x38, 0x0F, 0xFB,
+  0xFE, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xFF, 0xFF, 0xF0, 0x38, 0x0C, 0x03,
+  0xC0, 0x70, 0x77, 0x1D, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x03, 0x80,
+  0xE0, 0x38, 0x0F, 0xFB, 0xFE, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xFF, 0xFF,
+  0xF0, 0x33, 0x07, 0x80, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0xE0,
+  0x38, 0x0E, 0x03, 0xFE, 0xFF, 0xB8, 0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xFF,
+  0xFC, 0x36, 0x60, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x38,
+  0xDB, 0x18, 0x00, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E,
+  0x1C, 0x38, 0x70, 0xE0, 0x73, 0x03, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0xFF, 0xCE, 0x1E, 0xE0, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x0E, 0xE1, 0xEF, 0xFC, 0xFF, 0x00, 0x3F, 0xC0, 0xFF,
+  0xC3, 0x87, 0x8E, 0x0E, 0x38, 0x1F, 0xF8, 0x7F, 0xE1, 0xCE, 0x07, 0x38,
+  0x1C, 0xE0, 0x73, 0x83, 0x8E, 0x1E, 0x3F, 0xF0, 0xFF, 0x00, 0x03, 0x00,
+  0x30, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x7F, 0x07, 0xF8, 0x7F,
+  0xC7, 0xEC, 0x7E, 0xE7, 0xE7, 0x7E, 0x37, 0xE3, 0xFE, 0x1F, 0xE0, 0xFE,
+  0x0F, 0xE0, 0x70, 0x19, 0x80, 0xF0, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x07,
+  0xF0, 0x7F, 0x07, 0xF8, 0x7F, 0xC7, 0xEC, 0x7E, 0xE7, 0xE7, 0x7E, 0x37,
+  0xE3, 0xFE, 0x1F, 0xE0, 0xFE, 0x0F, 0xE0, 0x70, 0x01, 0x80, 0x18, 0x00,
+  0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0x8F, 0x1E, 0x70, 0x77, 0x01,
+  0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xEE, 0x0E, 0x78, 0xF1,
+  0xFF, 0x03, 0xE0, 0x07, 0x00, 0x6C, 0x03, 0x60, 0x00, 0x00, 0x00, 0x07,
+  0xC0, 0xFF, 0x8F, 0x1E, 0x70, 0x77, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03,
+  0xF0, 0x1F, 0x80, 0xEE, 0x0E, 0x78, 0xF1, 0xFF, 0x03, 0xE0, 0x06, 0x60,
+  0x36, 0x03, 0x60, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0x8F, 0x1E, 0x70,
+  0x77, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xEE, 0x0E,
+  0x78, 0xF1, 0xFF, 0x03, 0xE0, 0x1D, 0xC0, 0xEE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xC0, 0xFF, 0x8F, 0x1E, 0x70, 0x77, 0x01, 0xF8, 0x0F, 0xC0,
+  0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xEE, 0x0E, 0x78, 0xF1, 0xFF, 0x03, 0xE0,
+  0x00, 0x98, 0x77, 0x3C, 0xFE, 0x1F, 0x07, 0x83, 0xF1, 0xEE, 0xF1, 0xD8,
+  0x20, 0x33, 0x81, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xCE,
+  0x1E, 0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x1E, 0xFF, 0xCF, 0xF0, 0xE3, 0x8E,
+  0x38, 0xE1, 0xCE, 0x1E, 0xE0, 0xE0, 0x06, 0x00, 0x90, 0x09, 0x00, 0x60,
+  0x00, 0x00, 0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x0E, 0x7F, 0xE1, 0xF8,
+  0x03, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x7E, 0x07,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
+  0x70, 0xE7, 0xFE, 0x1F, 0x80, 0x06, 0xE0, 0xDC, 0x09, 0x80, 0x00, 0x00,
+  0x0E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0xE7, 0xFE, 0x1F, 0x80, 0x3B, 0x83,
+  0xB8, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0xE7,
+  0xFE, 0x1F, 0x80, 0x01, 0x80, 0x18, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x70,
+  0x1D, 0xC1, 0xCE, 0x0E, 0x38, 0xE1, 0xC7, 0x07, 0x70, 0x1F, 0x00, 0xF8,
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0xFF, 0xFF,
+  0xFC, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x01, 0x00, 0x38, 0x03, 0x01, 0xE0, 0x38,
+  0x00, 0x3F, 0x0F, 0xF3, 0xCF, 0x70, 0xEE, 0x1D, 0xC7, 0x3B, 0xC7, 0x7E,
+  0xE1, 0xFC, 0x1F, 0x83, 0xF0, 0xFE, 0xFD, 0xDF, 0x00, 0x18, 0x61, 0x00,
+  0xEF, 0xFF, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x00, 0x06, 0x02, 0x03,
+  0x00, 0x03, 0xE3, 0xF9, 0xCE, 0x07, 0x07, 0xBF, 0xFC, 0xFC, 0x7E, 0x7F,
+  0xFD, 0xEE, 0x08, 0x0E, 0x0D, 0x86, 0x60, 0x01, 0xF1, 0xFC, 0xE7, 0x03,
+  0x83, 0xDF, 0xFE, 0x7E, 0x3F, 0x3F, 0xFE, 0xF7, 0x3F, 0x0F, 0x00, 0x07,
+  0xC7, 0xF3, 0x9C, 0x0E, 0x0F, 0x7F, 0xF9, 0xF8, 0xFC, 0xFF, 0xFB, 0xDC,
+  0x20, 0x39, 0xC0, 0x40, 0x03, 0xE3, 0xFB, 0xCE, 0x07, 0x07, 0xBF, 0xFC,
+  0xFC, 0x7E, 0x7F, 0xFD, 0xEE, 0x33, 0x98, 0x00, 0x73, 0x9C, 0xE7, 0x39,
+  0xCE, 0x73, 0x9C, 0xE7, 0x38, 0x03, 0x01, 0x80, 0x60, 0x00, 0x1F, 0x1F,
+  0xE7, 0x1F, 0x83, 0xE0, 0x38, 0x0E, 0x03, 0x83, 0x71, 0xDF, 0xE1, 0xF0,
+  0x1E, 0x1F, 0xE7, 0x3B, 0x86, 0xE0, 0x38, 0x0E, 0x03, 0x86, 0x73, 0x9F,
+  0xE1, 0xE0, 0x30, 0x06, 0x01, 0x80, 0xE0, 0x30, 0x39, 0x86, 0xC0, 0xE0,
+  0x00, 0x1F, 0x1F, 0xE7, 0x1F, 0x83, 0xE0, 0x38, 0x0E, 0x03, 0x83, 0x71,
+  0xDF, 0xE1, 0xF0, 0x06, 0x01, 0x00, 0xC0, 0x00, 0x1E, 0x1F, 0xE7, 0x3B,
+  0x87, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0x71, 0xDF, 0xE1, 0xF0, 0x1E, 0x1F,
+  0xE7, 0x3B, 0x87, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0x71, 0xDF, 0xE1, 0xF0,
+  0x30, 0x0C, 0x03, 0x80, 0xE0, 0x01, 0x0C, 0xE0, 0x00, 0x00, 0x1E, 0x1F,
+  0xE7, 0x3B, 0x87, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0x71, 0xDF, 0xE1, 0xF0,
+  0x73, 0x0F, 0xC1, 0xE0, 0x30, 0x00, 0x07, 0x87, 0xF9, 0xCE, 0xE1, 0xFF,
+  0xFF, 0xFF, 0x80, 0xE0, 0x1C, 0x77, 0xF8, 0x7C, 0x33, 0x98, 0x0E, 0x73,
+  0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x80, 0x38, 0x71, 0xB6, 0x30, 0x07, 0x0E,
+  0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x00, 0x18, 0x07, 0x60,
+  0x1D, 0x80, 0x70, 0x3D, 0xC1, 0xFF, 0x07, 0x3C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x0E, 0x1C, 0x38, 0x70, 0x73, 0xC1, 0xFF, 0x03, 0xDC, 0x00, 0x07,
+  0xF0, 0x7F, 0x01, 0xC3, 0xDC, 0x7F, 0xC7, 0x3C, 0xE1, 0xCE, 0x1C, 0xE1,
+  0xCE, 0x1C, 0xE1, 0xC7, 0x3C, 0x7F, 0xC3, 0xDC, 0x06, 0x01, 0x80, 0xC0,
+  0x00, 0xEF, 0x3F, 0xEF, 0x3F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1,
+  0xF8, 0x7E, 0x1C, 0x33, 0x07, 0x80, 0xC0, 0x00, 0xEF, 0x3F, 0xEF, 0x3F,
+  0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1C, 0x03, 0x00,
+  0xC0, 0x18, 0x00, 0x01, 0xF0, 0xFF, 0x9C, 0x77, 0x07, 0xE0, 0xFC, 0x1F,
+  0x83, 0xF0, 0x77, 0x1C, 0xFF, 0x07, 0xC0, 0x04, 0x01, 0xC0, 0x6C, 0x18,
+  0xC0, 0x00, 0x3E, 0x1F, 0xF3, 0x8E, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E,
+  0x0E, 0xE3, 0x9F, 0xE0, 0xF8, 0x0C, 0xC1, 0xB0, 0x6C, 0x00, 0x01, 0xF0,
+  0xFF, 0x9C, 0x77, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x77, 0x1C, 0xFF,
+  0x07, 0xC0, 0x11, 0x07, 0x70, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0x9C, 0x77,
+  0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x77, 0x1C, 0xFF, 0x07, 0xC0, 0x1C,
+  0x07, 0x01, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1C, 0x07, 0x01,
+  0xC0, 0xE3, 0x76, 0x3C, 0x1C, 0x00, 0x76, 0x7E, 0x78, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x1C, 0x08, 0x82, 0x20, 0x88, 0x1C, 0x00,
+  0x0E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7F, 0x3D,
+  0xFF, 0x3D, 0xC0, 0x06, 0x01, 0x80, 0xC0, 0x00, 0xE1, 0xF8, 0x7E, 0x1F,
+  0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xF3, 0xDF, 0xF3, 0xDC, 0x0D, 0xC6,
+  0x63, 0x30, 0x00, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F,
+  0x87, 0xF3, 0xDF, 0xF3, 0xDC, 0x22, 0x1D, 0xC0, 0x00, 0x00, 0xE1, 0xF8,
+  0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xF3, 0xDF, 0xF3, 0xDC,
+  0x07, 0x00, 0xC0, 0x10, 0x00, 0x0E, 0x0C, 0xC3, 0x9C, 0x73, 0x8C, 0x33,
+  0x86, 0x70, 0xEC, 0x0D, 0x81, 0xF0, 0x3C, 0x03, 0x80, 0x70, 0x1C, 0x0F,
+  0x81, 0xE0, 0x00, 0x38, 0x70, 0xE7, 0xEF, 0xC7, 0x0E, 0x1C, 0x38, 0x70,
+  0xE1, 0xE3, 0xC3, 0x81, 0x03, 0x06, 0x1C, 0x30, 0xFF, 0x80 };
+
+const GFXglyph InterTight_SemiBold10pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   3,  14,   5,    1,  -13 },   // 0x21 '!' U+0021
+  {     7,   6,   6,  10,    2,  -13 },   // 0x22 '"' U+0022
+  {    12,  12,  14,  12,    0,  -13 },   // 0x23 '#' U+0023
+  {    33,  12,  19,  13,    0,  -16 },   // 0x24 '$' U+0024
+  {    62,  13,  14,  15,    1,  -13 },   // 0x25 '%' U+0025
+  {    85,  12,  14,  13,    1,  -13 },   // 0x26 '&' U+0026
+  {   106,   2,   6,   6,    2,  -13 },   // 0x27 ''' U+0027
+  {   108,   5,  18,   7,    1,  -14 },   // 0x28 '(' U+0028
+  {   120,   5,  18,   7,    1,  -14 },   // 0x29 ')' U+0029
+  {   132,   8,   8,  10,    1,  -13 },   // 0x2a '*' U+002A
+  {   140,  10,  10,  12,    1,  -10 },   // 0x2b '+' U+002B
+  {   153,   3,   6,   6,    1,   -1 },   // 0x2c ',' U+002C
+  {   156,   6,   2,   8,    1,   -6 },   // 0x2d '-' U+002D
+  {   158,   3,   3,   5,    1,   -2 },   // 0x2e '.' U+002E
+  {   160,   7,  18,   7,    0,  -15 },   // 0x2f '/' U+002F
+  {   176,  11,  14,  13,    1,  -13 },   // 0x30 '0' U+0030
+  {   196,   7,  14,   8,    0,  -13 },   // 0x31 '1' U+0031
+  {   209,  10,  14,  12,    1,  -13 },   // 0x32 '2' U+0032
+  {   227,  11,  14,  13,    1,  -13 },   // 0x33 '3' U+0033
+  {   247,  12,  14,  13,    1,  -13 },   // 0x34 '4' U+0034
+  {   268,  10,  14,  12,    1,  -13 },   // 0x35 '5' U+0035
+  {   286,  11,  14,  13,    1,  -13 },   // 0x36 '6' U+0036
+  {   306,  10,  14,  12,    1,  -13 },   // 0x37 '7' U+0037
+  {   324,  11,  14,  13,    1,  -13 },   // 0x38 '8' U+0038
+  {   344,  11,  14,  13,    1,  -13 },   // 0x39 '9' U+0039
+  {   364,   3,  10,   5,    1,   -9 },   // 0x3a ':' U+003A
+  {   368,   4,  14,   5,    0,   -9 },   // 0x3b ';' U+003B
+  {   375,  10,  11,  12,    1,  -10 },   // 0x3c '<' U+003C
+  {   389,   9,   7,  13,    2,   -8 },   // 0x3d '=' U+003D
+  {   397,  10,  11,  12,    1,  -10 },   // 0x3e '>' U+003E
+  {   411,   9,  14,  11,    1,  -13 },   // 0x3f '?' U+003F
+  {   427,  18,  18,  20,    1,  -13 },   // 0x40 '@' U+0040
+  {   468,  14,  14,  14,    0,  -13 },   // 0x41 'A' U+0041
+  {   493,  11,  14,  13,    1,  -13 },   // 0x42 'B' U+0042
+  {   513,  13,  14,  15,    1,  -13 },   // 0x43 'C' U+0043
+  {   536,  12,  14,  14,    1,  -13 },   // 0x44 'D' U+0044
+  {   557,  10,  14,  11,    1,  -13 },   // 0x45 'E' U+0045
+  {   575,   9,  14,  11,    1,  -13 },   // 0x46 'F' U+0046
+  {   591,  13,  14,  15,    1,  -13 },   // 0x47 'G' U+0047
+  {   614,  12,  14,  14,    1,  -13 },   // 0x48 'H' U+0048
+  {   635,   3,  14,   5,    1,  -13 },   // 0x49 'I' U+0049
+  {   641,   9,  14,  11,    1,  -13 },   // 0x4a 'J' U+004A
+  {   657,  12,  14,  13,    1,  -13 },   // 0x4b 'K' U+004B
+  {   678,   9,  14,  11,    1,  -13 },   // 0x4c 'L' U+004C
+  {   694,  15,  14,  17,    1,  -13 },   // 0x4d 'M' U+004D
+  {   721,  12,  14,  14,    1,  -13 },   // 0x4e 'N' U+004E
+  {   742,  13,  14,  15,    1,  -13 },   // 0x4f 'O' U+004F
+  {   765,  11,  14,  13,    1,  -13 },   // 0x50 'P' U+0050
+  {   785,  13,  15,  15,    1,  -13 },   // 0x51 'Q' U+0051
+  {   810,  12,  14,  13,    1,  -13 },   // 0x52 'R' U+0052
+  {   831,  12,  14,  13,    0,  -13 },   // 0x53 'S' U+0053
+  {   852,  11,  14,  13,    1,  -13 },   // 0x54 'T' U+0054
+  {   872,  12,  14,  14,    1,  -13 },   // 0x55 'U' U+0055
+  {   893,  13,  14,  14,    0,  -13 },   // 0x56 'V' U+0056
+  {   916,  19,  14,  19,    0,  -13 },   // 0x57 'W' U+0057
+  {   950,  13,  14,  13,    0,  -13 },   // 0x58 'X' U+0058
+  {   973,  13,  14,  13,    0,  -13 },   // 0x59 'Y' U+0059
+  {   996,  11,  14,  13,    1,  -13 },   // 0x5a 'Z' U+005A
+  {  1016,   5,  18,   6,    1,  -14 },   // 0x5b '[' U+005B
+  {  1028,   7,  18,   7,    0,  -15 },   // 0x5c '\' U+005C
+  {  1044,   5,  18,   7,    1,  -14 },   // 0x5d ']' U+005D
+  {  1056,   8,   7,   9,    0,  -13 },   // 0x5e '^' U+005E
+  {  1063,   9,   2,   9,    0,    1 },   // 0x5f '_' U+005F
+  {  1066,   4,   3,   8,    2,  -14 },   // 0x60 '`' U+0060
+  {  1068,   9,  11,  11,    1,  -10 },   // 0x61 'a' U+0061
+  {  1081,  10,  14,  12,    1,  -13 },   // 0x62 'b' U+0062
+  {  1099,  10,  11,  12,    1,  -10 },   // 0x63 'c' U+0063
+  {  1113,  10,  14,  12,    1,  -13 },   // 0x64 'd' U+0064
+  {  1131,  10,  11,  12,    1,  -10 },   // 0x65 'e' U+0065
+  {  1145,   8,  15,   8,    0,  -14 },   // 0x66 'f' U+0066
+  {  1160,  10,  15,  12,    1,  -10 },   // 0x67 'g' U+0067
+  {  1179,  10,  14,  12,    1,  -13 },   // 0x68 'h' U+0068
+  {  1197,   3,  15,   5,    1,  -14 },   // 0x69 'i' U+0069
+  {  1203,   5,  19,   5,   -1,  -14 },   // 0x6a 'j' U+006A
+  {  1215,  10,  14,  11,    1,  -13 },   // 0x6b 'k' U+006B
+  {  1233,   3,  14,   5,    1,  -13 },   // 0x6c 'l' U+006C
+  {  1239,  15,  11,  17,    1,  -10 },   // 0x6d 'm' U+006D
+  {  1260,  10,  11,  12,    1,  -10 },   // 0x6e 'n' U+006E
+  {  1274,  11,  11,  13,    1,  -10 },   // 0x6f 'o' U+006F
+  {  1290,  10,  15,  12,    1,  -10 },   // 0x70 'p' U+0070
+  {  1309,  10,  15,  12,    1,  -10 },   // 0x71 'q' U+0071
+  {  1328,   6,  11,   8,    1,  -10 },   // 0x72 'r' U+0072
+  {  1337,   9,  11,  11,    1,  -10 },   // 0x73 's' U+0073
+  {  1350,   7,  14,   7,    0,  -13 },   // 0x74 't' U+0074
+  {  1363,  10,  11,  12,    1,  -10 },   // 0x75 'u' U+0075
+  {  1377,  11,  11,  11,    0,  -10 },   // 0x76 'v' U+0076
+  {  1393,  16,  11,  16,    0,  -10 },   // 0x77 'w' U+0077
+  {  1415,  10,  11,  10,    0,  -10 },   // 0x78 'x' U+0078
+  {  1429,  11,  15,  11,    0,  -10 },   // 0x79 'y' U+0079
+  {  1450,   9,  11,  11,    1,  -10 },   // 0x7a 'z' U+007A
+  {  1463,   7,  19,   8,    1,  -14 },   // 0x7b '{' U+007B
+  {  1480,   3,  24,   7,    2,  -18 },   // 0x7c '|' U+007C
+  {  1489,   7,  19,   9,    1,  -14 },   // 0x7d '}' U+007D
+  {  1506,  10,   4,  12,    1,   -7 },   // 0x7e '~' U+007E
+  {     0,   0,   0,  10,    1,  -18 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  1511,   1,   1,   4,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  1512,  14,  18,  14,    0,  -13 },   // 0x81 '0x0104' U+0104
+  {  1544,   7,   3,   9,    1,  -14 },   // 0x82 '0x02D8' U+02D8
+  {  1547,  11,  14,  12,    0,  -13 },   // 0x83 '0x0141' U+0141
+  {  1567,  12,  12,  14,    1,  -11 },   // 0x84 '0x00A4' U+00A4
+  {  1585,   9,  15,  11,    1,  -14 },   // 0x85 '0x013D' U+013D
+  {  1602,  12,  19,  13,    0,  -18 },   // 0x86 '0x015A' U+015A
+  {  1631,  10,  17,  11,    1,  -13 },   // 0x87 '0x00A7' U+00A7
+  {  1653,   7,   2,  11,    2,  -13 },   // 0x88 '0x00A8' U+00A8
+  {  1655,  12,  19,  13,    0,  -18 },   // 0x89 '0x0160' U+0160
+  {  1684,  12,  19,  13,    0,  -13 },   // 0x8a '0x015E' U+015E
+  {  1713,  11,  19,  13,    1,  -18 },   // 0x8b '0x0164' U+0164
+  {  1740,  11,  19,  13,    1,  -18 },   // 0x8c '0x0179' U+0179
+  {  1767,   6,   2,   8,    1,   -6 },   // 0x8d '0x00AD' U+00AD
+  {  1769,  11,  19,  13,    1,  -18 },   // 0x8e '0x017D' U+017D
+  {  1796,  11,  19,  13,    1,  -18 },   // 0x8f '0x017B' U+017B
+  {  1823,   7,   7,   9,    1,  -14 },   // 0x90 '0x00B0' U+00B0
+  {  1830,   9,  15,  11,    1,  -10 },   // 0x91 '0x0105' U+0105
+  {  1847,   4,   5,   5,    1,    0 },   // 0x92 '0x02DB' U+02DB
+  {  1850,   6,  14,   5,   -1,  -13 },   // 0x93 '0x0142' U+0142
+  {  1861,   4,   3,   8,    2,  -14 },   // 0x94 '0x00B4' U+00B4
+  {  1863,   6,  15,   6,    1,  -14 },   // 0x95 '0x013E' U+013E
+  {  1875,   9,  15,  11,    1,  -14 },   // 0x96 '0x015B' U+015B
+  {  1892,   7,   3,  10,    1,  -14 },   // 0x97 '0x02C7' U+02C7
+  {  1895,   4,   5,   6,    1,    0 },   // 0x98 '0x00B8' U+00B8
+  {  1898,   9,  16,  11,    1,  -15 },   // 0x99 '0x0161' U+0161
+  {  1916,   9,  16,  11,    1,  -10 },   // 0x9a '0x015F' U+015F
+  {  1934,   8,  16,   7,    0,  -15 },   // 0x9b '0x0165' U+0165
+  {  1950,   9,  15,  11,    1,  -14 },   // 0x9c '0x017A' U+017A
+  {  1967,   8,   3,   8,    0,  -14 },   // 0x9d '0x02DD' U+02DD
+  {  1970,   9,  16,  11,    1,  -15 },   // 0x9e '0x017E' U+017E
+  {  1988,   9,  15,  11,    1,  -14 },   // 0x9f '0x017C' U+017C
+  {  2005,  12,  19,  13,    1,  -18 },   // 0xa0 '0x0154' U+0154
+  {  2034,  14,  19,  14,    0,  -18 },   // 0xa1 '0x00C1' U+00C1
+  {  2068,  14,  19,  14,    0,  -18 },   // 0xa2 '0x00C2' U+00C2
+  {  2102,  14,  19,  14,    0,  -18 },   // 0xa3 '0x0102' U+0102
+  {  2136,  14,  18,  14,    0,  -17 },   // 0xa4 '0x00C4' U+00C4
+  {  2168,   9,  19,  11,    1,  -18 },   // 0xa5 '0x0139' U+0139
+  {  2190,  13,  19,  15,    1,  -18 },   // 0xa6 '0x0106' U+0106
+  {  2221,  13,  19,  15,    1,  -13 },   // 0xa7 '0x00C7' U+00C7
+  {  2252,  13,  19,  15,    1,  -18 },   // 0xa8 '0x010C' U+010C
+  {  2283,  10,  19,  11,    1,  -18 },   // 0xa9 '0x00C9' U+00C9
+  {  2307,  10,  18,  11,    1,  -13 },   // 0xaa '0x0118' U+0118
+  {  2330,  10,  18,  11,    1,  -17 },   // 0xab '0x00CB' U+00CB
+  {  2353,  10,  19,  11,    1,  -18 },   // 0xac '0x011A' U+011A
+  {  2377,   4,  19,   5,    1,  -18 },   // 0xad '0x00CD' U+00CD
+  {  2387,   7,  19,   5,   -1,  -18 },   // 0xae '0x00CE' U+00CE
+  {  2404,  12,  19,  14,    1,  -18 },   // 0xaf '0x010E' U+010E
+  {  2433,  14,  14,  14,   -1,  -13 },   // 0xb0 '0x0110' U+0110
+  {  2458,  12,  19,  14,    1,  -18 },   // 0xb1 '0x0143' U+0143
+  {  2487,  12,  19,  14,    1,  -18 },   // 0xb2 '0x0147' U+0147
+  {  2516,  13,  19,  15,    1,  -18 },   // 0xb3 '0x00D3' U+00D3
+  {  2547,  13,  19,  15,    1,  -18 },   // 0xb4 '0x00D4' U+00D4
+  {  2578,  13,  19,  15,    1,  -18 },   // 0xb5 '0x0150' U+0150
+  {  2609,  13,  19,  15,    1,  -18 },   // 0xb6 '0x00D6' U+00D6
+  {  2640,  10,  10,  13,    1,  -10 },   // 0xb7 '0x00D7' U+00D7
+  {  2653,  12,  19,  13,    1,  -18 },   // 0xb8 '0x0158' U+0158
+  {  2682,  12,  20,  14,    1,  -19 },   // 0xb9 '0x016E' U+016E
+  {  2712,  12,  19,  14,    1,  -18 },   // 0xba '0x00DA' U+00DA
+  {  2741,  12,  19,  14,    1,  -18 },   // 0xbb '0x0170' U+0170
+  {  2770,  12,  19,  14,    1,  -18 },   // 0xbc '0x00DC' U+00DC
+  {  2799,  13,  19,  13,    0,  -18 },   // 0xbd '0x00DD' U+00DD
+  {  2830,  11,  19,  13,    1,  -13 },   // 0xbe '0x0162' U+0162
+  {  2857,  11,  14,  13,    1,  -13 },   // 0xbf '0x00DF' U+00DF
+  {  2877,   6,  15,   8,    1,  -14 },   // 0xc0 '0x0155' U+0155
+  {  2889,   9,  15,  11,    1,  -14 },   // 0xc1 '0x00E1' U+00E1
+  {  2906,   9,  16,  11,    1,  -15 },   // 0xc2 '0x00E2' U+00E2
+  {  2924,   9,  14,  11,    1,  -13 },   // 0xc3 '0x0103' U+0103
+  {  2940,   9,  15,  11,    1,  -14 },   // 0xc4 '0x00E4' U+00E4
+  {  2957,   5,  19,   5,    1,  -18 },   // 0xc5 '0x013A' U+013A
+  {  2969,  10,  15,  12,    1,  -14 },   // 0xc6 '0x0107' U+0107
+  {  2988,  10,  16,  11,    1,  -10 },   // 0xc7 '0x00E7' U+00E7
+  {  3008,  10,  15,  12,    1,  -14 },   // 0xc8 '0x010D' U+010D
+  {  3027,  10,  15,  12,    1,  -14 },   // 0xc9 '0x00E9' U+00E9
+  {  3046,  10,  15,  12,    1,  -10 },   // 0xca '0x0119' U+0119
+  {  3065,  10,  15,  12,    1,  -14 },   // 0xcb '0x00EB' U+00EB
+  {  3084,  10,  16,  12,    1,  -15 },   // 0xcc '0x011B' U+011B
+  {  3104,   5,  15,   5,    1,  -14 },   // 0xcd '0x00ED' U+00ED
+  {  3114,   7,  16,   5,   -1,  -15 },   // 0xce '0x00EE' U+00EE
+  {  3128,  14,  15,  14,    1,  -14 },   // 0xcf '0x010F' U+010F
+  {  3155,  12,  14,  12,    1,  -13 },   // 0xd0 '0x0111' U+0111
+  {  3176,  10,  15,  12,    1,  -14 },   // 0xd1 '0x0144' U+0144
+  {  3195,  10,  15,  12,    1,  -14 },   // 0xd2 '0x0148' U+0148
+  {  3214,  11,  15,  13,    1,  -14 },   // 0xd3 '0x00F3' U+00F3
+  {  3235,  11,  16,  13,    1,  -15 },   // 0xd4 '0x00F4' U+00F4
+  {  3257,  11,  15,  13,    1,  -14 },   // 0xd5 '0x0151' U+0151
+  {  3278,  11,  15,  13,    1,  -14 },   // 0xd6 '0x00F6' U+00F6
+  {  3299,  10,  11,  13,    1,  -10 },   // 0xd7 '0x00F7' U+00F7
+  {  3313,   8,  16,   8,    0,  -15 },   // 0xd8 '0x0159' U+0159
+  {  3329,  10,  17,  12,    1,  -16 },   // 0xd9 '0x016F' U+016F
+  {  3351,  10,  15,  12,    1,  -14 },   // 0xda '0x00FA' U+00FA
+  {  3370,  10,  15,  12,    1,  -14 },   // 0xdb '0x0171' U+0171
+  {  3389,  10,  15,  12,    1,  -14 },   // 0xdc '0x00FC' U+00FC
+  {  3408,  11,  19,  11,    0,  -14 },   // 0xdd '0x00FD' U+00FD
+  {  3435,   7,  19,   7,    0,  -13 },   // 0xde '0x0163' U+0163
+  {  3452,   3,   3,   5,    1,  -14 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_SemiBold10pt8b PROGMEM = {
+  (uint8_t  *)InterTight_SemiBold10pt8bBitmaps,
+  (GFXglyph *)InterTight_SemiBold10pt8bGlyphs,
+  0x20, 0xDF, 24 };
+
+// Approx. 4805 bytes
@@ -0,0 +1,602 @@
+// Subset of ../InterTightSemiBold12pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_SemiBold12pt8bBitmaps[] PROGMEM = {
+  0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0xFF, 0xF0, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x0E, 0x38, 0x38, 0xE0, 0xC3, 0x03, 0x0C,
+  0x7F, 0xFD, 0xFF, 0xF1, 0xC7, 0x07, 0x1C, 0x18, 0x60, 0x61, 0x8F, 0xFF,
+  0xBF, 0xFE, 0x38, 0xE0, 0xE3, 0x83, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0x01,
+  0x00, 0x04, 0x00, 0x10, 0x03, 0xF8, 0x1F, 0xF0, 0xE4, 0xE7, 0x11, 0xDC,
+  0x40, 0x79, 0x01, 0xFC, 0x03, 0xFC, 0x07, 0xFC, 0x07, 0xF8, 0x05, 0xF0,
+  0x11, 0xFC, 0x47, 0x71, 0x1D, 0xE4, 0xE3, 0xFF, 0x03, 0xF8, 0x01, 0x00,
+  0x04, 0x00, 0x7C, 0x06, 0xFE, 0x0C, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x30,
+  0xFE, 0x60, 0x7C, 0xC0, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x1C, 0x07, 0x3E,
+  0x06, 0x63, 0x0C, 0x63, 0x18, 0x63, 0x18, 0x63, 0x30, 0x3E, 0x60, 0x1C,
+  0x1F, 0x80, 0x7F, 0x81, 0xE7, 0x83, 0x87, 0x07, 0x0E, 0x0F, 0x3C, 0x0F,
+  0xF0, 0x1F, 0xC0, 0x3E, 0x00, 0xFE, 0x3B, 0xDE, 0x77, 0x1E, 0xEE, 0x1F,
+  0x9C, 0x1F, 0x1C, 0x3E, 0x3F, 0xFE, 0x1F, 0x9E, 0xFF, 0xFF, 0xF8, 0x18,
+  0xE3, 0x9C, 0x71, 0xCF, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x1C, 0x71,
+  0xC3, 0x8E, 0x1C, 0xE1, 0xC7, 0x0E, 0x38, 0xE3, 0xC7, 0x1C, 0x71, 0xC7,
+  0x1C, 0x71, 0xCE, 0x38, 0xE7, 0x1C, 0xE0, 0x0C, 0x03, 0x06, 0xD9, 0xFE,
+  0x1E, 0x1F, 0xE6, 0xD8, 0x30, 0x0C, 0x00, 0x07, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x07, 0x0F, 0xFF, 0xFF, 0xF0, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x77, 0x6E, 0xEE, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0x07, 0x07,
+  0x06, 0x0E, 0x0E, 0x0E, 0x0C, 0x1C, 0x1C, 0x18, 0x38, 0x38, 0x38, 0x30,
+  0x70, 0x70, 0x70, 0x60, 0xE0, 0xE0, 0x0F, 0x81, 0xFF, 0x0E, 0x38, 0xE0,
+  0xE7, 0x07, 0x70, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F,
+  0xC0, 0x77, 0x07, 0x38, 0x39, 0xE3, 0xC7, 0xFC, 0x0F, 0x80, 0x1E, 0x7F,
+  0xFF, 0x7C, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87,
+  0x0E, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x07, 0xE0, 0x70, 0x07, 0x00, 0x70,
+  0x0E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0xFF, 0xFF, 0xF0, 0x1F, 0x83, 0xFF, 0x1C, 0x39, 0xC0, 0xE0, 0x07, 0x00,
+  0x38, 0x03, 0x81, 0xF8, 0x0F, 0xE0, 0x07, 0x80, 0x0E, 0x00, 0x7E, 0x03,
+  0xF0, 0x1D, 0xC3, 0xCF, 0xFC, 0x1F, 0x80, 0x01, 0xE0, 0x1F, 0x00, 0xF8,
+  0x0F, 0xC0, 0xEE, 0x07, 0x70, 0x73, 0x83, 0x9C, 0x38, 0xE1, 0x87, 0x1C,
+  0x39, 0xC1, 0xCF, 0xFF, 0xFF, 0xFC, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x7F,
+  0xE7, 0xFE, 0x70, 0x07, 0x00, 0x70, 0x06, 0x00, 0x6F, 0x8F, 0xFC, 0xF1,
+  0xE0, 0x0F, 0x00, 0x70, 0x07, 0xE0, 0x7E, 0x0F, 0x70, 0xE7, 0xFC, 0x1F,
+  0x80, 0x0F, 0xC0, 0xFF, 0x0E, 0x1C, 0xE0, 0xF7, 0x03, 0xF0, 0x03, 0x9F,
+  0x1D, 0xFC, 0xF8, 0xF7, 0x83, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xB8, 0x3D,
+  0xE3, 0xC7, 0xFC, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0E, 0x01,
+  0xE0, 0x1C, 0x03, 0xC0, 0x38, 0x07, 0x80, 0x70, 0x0F, 0x00, 0xE0, 0x1E,
+  0x01, 0xC0, 0x3C, 0x03, 0x80, 0x78, 0x00, 0x0F, 0x81, 0xFF, 0x1E, 0x3C,
+  0xE0, 0xE7, 0x07, 0x38, 0x38, 0xE3, 0x83, 0xF8, 0x3F, 0xE3, 0xC7, 0xB8,
+  0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1D, 0xC1, 0xC7, 0xFC, 0x1F, 0xC0, 0x0F,
+  0x81, 0xFF, 0x1E, 0x3D, 0xE0, 0xEE, 0x07, 0xF0, 0x1F, 0x80, 0xFE, 0x0F,
+  0x78, 0xF9, 0xFD, 0xC7, 0xCE, 0x00, 0x7E, 0x07, 0x78, 0x39, 0xC3, 0x87,
+  0xF8, 0x1F, 0x80, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x77, 0x70, 0x00, 0x00,
+  0x07, 0x66, 0x66, 0xCC, 0x00, 0x30, 0x0F, 0x07, 0xF1, 0xFC, 0x7E, 0x0F,
+  0x80, 0xF0, 0x0F, 0xC0, 0x3F, 0x80, 0x7E, 0x01, 0xF0, 0x07, 0x00, 0x10,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
+  0x0F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0x00, 0xF0, 0x7E, 0x1F,
+  0x8F, 0xE0, 0xF8, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0xFB, 0xC7, 0xF0,
+  0x70, 0x0E, 0x01, 0xC0, 0x78, 0x3E, 0x0F, 0x83, 0xC0, 0x70, 0x0E, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0xF0, 0x1E, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF,
+  0x00, 0xF0, 0x3E, 0x07, 0x00, 0x3C, 0x38, 0x00, 0x79, 0xC0, 0x00, 0xE7,
+  0x0F, 0x73, 0xFC, 0xFF, 0xC7, 0xE3, 0x8F, 0x1F, 0x9C, 0x1C, 0x7E, 0x70,
+  0x71, 0xF9, 0xC1, 0xC7, 0xE7, 0x07, 0x1F, 0x9C, 0x1C, 0x6E, 0x38, 0xF3,
+  0x9C, 0xFF, 0xFC, 0x70, 0xF3, 0xE0, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0xC0, 0x40, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0x80,
+  0x1F, 0x00, 0x7F, 0x00, 0xEE, 0x01, 0xDC, 0x07, 0x1C, 0x0E, 0x38, 0x1C,
+  0x70, 0x70, 0x70, 0xE0, 0xE3, 0xFF, 0xE7, 0xFF, 0xCE, 0x03, 0xBC, 0x07,
+  0xF0, 0x07, 0xE0, 0x0E, 0xFF, 0x87, 0xFF, 0x38, 0x3D, 0xC0, 0xEE, 0x07,
+  0x70, 0x3B, 0x83, 0x9F, 0xF8, 0xFF, 0xE7, 0x03, 0xB8, 0x0F, 0xC0, 0x7E,
+  0x03, 0xF0, 0x1F, 0x81, 0xDF, 0xFE, 0xFF, 0xC0, 0x07, 0xE0, 0x3F, 0xF0,
+  0xFF, 0xF3, 0xE1, 0xE7, 0x01, 0xFE, 0x01, 0xF8, 0x00, 0x70, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x77, 0x01, 0xEF, 0x87, 0x8F, 0xFF,
+  0x0F, 0xF8, 0x07, 0xE0, 0xFF, 0x83, 0xFF, 0x8E, 0x0F, 0x38, 0x0E, 0xE0,
+  0x3B, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
+  0x07, 0xE0, 0x3B, 0x80, 0xEE, 0x0F, 0x3F, 0xF8, 0xFF, 0x80, 0xFF, 0xFF,
+  0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF, 0xFC, 0x03,
+  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF, 0xFF, 0xFF,
+  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x00, 0x07, 0xE0,
+  0x3F, 0xE0, 0xFF, 0xE3, 0xC1, 0xE7, 0x01, 0xFE, 0x01, 0xF8, 0x00, 0x70,
+  0x00, 0xE0, 0xFF, 0xC1, 0xFF, 0x80, 0x3F, 0x80, 0x77, 0x01, 0xEF, 0x87,
+  0x8F, 0xFF, 0x0F, 0xFC, 0x07, 0xE0, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
+  0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7E,
+  0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x7E,
+  0x0F, 0xC1, 0xFC, 0x73, 0xFE, 0x1F, 0x00, 0xE0, 0x7B, 0x81, 0xCE, 0x0F,
+  0x38, 0x78, 0xE3, 0xC3, 0x9E, 0x0E, 0xF0, 0x3F, 0x80, 0xFF, 0x03, 0xFC,
+  0x0F, 0x78, 0x38, 0xF0, 0xE1, 0xE3, 0x83, 0x8E, 0x0F, 0x38, 0x1E, 0xE0,
+  0x38, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF,
+  0xE0, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xFC, 0x0F,
+  0xFF, 0x03, 0xFF, 0xC1, 0xDF, 0xB8, 0x77, 0xEE, 0x1D, 0xF9, 0xCE, 0x7E,
+  0x73, 0x9F, 0x8F, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x1E, 0x1F, 0x87,
+  0x87, 0xE0, 0xC1, 0xC0, 0xE0, 0x1F, 0xC0, 0x7F, 0x01, 0xFE, 0x07, 0xFC,
+  0x1F, 0xF8, 0x7E, 0xE1, 0xFB, 0xC7, 0xE7, 0x9F, 0x8F, 0x7E, 0x1D, 0xF8,
+  0x7F, 0xE0, 0xFF, 0x81, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x1C, 0x07, 0xE0,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x0E,
+  0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0xFF, 0x8F, 0xFC, 0xE0,
+  0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xEF, 0xFC, 0xFF,
+  0x8E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x07, 0xE0,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF1, 0xCF, 0x70, 0xEE,
+  0x7C, 0x7E, 0x3F, 0xFC, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x0E, 0xFF, 0x87,
+  0xFF, 0x38, 0x39, 0xC0, 0xEE, 0x07, 0x70, 0x3B, 0x81, 0xDC, 0x1C, 0xFF,
+  0xE7, 0xFC, 0x38, 0xE1, 0xC3, 0x8E, 0x1C, 0x70, 0x73, 0x83, 0x9C, 0x0E,
+  0xE0, 0x70, 0x0F, 0xE0, 0x7F, 0xC3, 0x83, 0x9C, 0x07, 0x70, 0x01, 0xE0,
+  0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF0, 0x1F, 0xE0, 0x07, 0xC0, 0x07, 0xF0,
+  0x1D, 0xC0, 0x77, 0x83, 0x8F, 0xFC, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00,
+  0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0,
+  0x07, 0x00, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xF0,
+  0x3D, 0xE1, 0xE7, 0xFF, 0x8F, 0xFC, 0x0F, 0xC0, 0xF0, 0x07, 0x70, 0x0F,
+  0x70, 0x0E, 0x78, 0x0E, 0x38, 0x1E, 0x38, 0x1C, 0x3C, 0x1C, 0x1C, 0x38,
+  0x1C, 0x38, 0x0E, 0x78, 0x0E, 0x70, 0x0E, 0x70, 0x07, 0xF0, 0x07, 0xE0,
+  0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0xF0, 0x38, 0x1F, 0xE0, 0x70, 0x3D,
+  0xC1, 0xF0, 0x73, 0x83, 0xE0, 0xE7, 0x87, 0xC3, 0xC7, 0x1D, 0x87, 0x0E,
+  0x3B, 0x8E, 0x1C, 0x77, 0x1C, 0x3C, 0xC6, 0x78, 0x3B, 0x8E, 0xE0, 0x77,
+  0x1D, 0xC0, 0xEE, 0x3B, 0x80, 0xF8, 0x3E, 0x01, 0xF0, 0x7C, 0x03, 0xE0,
+  0xF8, 0x07, 0x80, 0xF0, 0x07, 0x01, 0xC0, 0x70, 0x1E, 0xF0, 0x38, 0xE0,
+  0xF1, 0xE3, 0xC1, 0xE7, 0x01, 0xDE, 0x03, 0xF8, 0x03, 0xE0, 0x03, 0xC0,
+  0x0F, 0x80, 0x3F, 0x80, 0x77, 0x81, 0xE7, 0x07, 0x8F, 0x0E, 0x0F, 0x3C,
+  0x0E, 0x70, 0x1E, 0xF0, 0x1E, 0xE0, 0x39, 0xE0, 0xF1, 0xC1, 0xC3, 0xC7,
+  0x83, 0x8E, 0x03, 0xB8, 0x07, 0x70, 0x07, 0xC0, 0x0F, 0x80, 0x0E, 0x00,
+  0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x1C, 0x01, 0xE0, 0x1E, 0x00, 0xE0, 0x0F, 0x00, 0xF0,
+  0x07, 0x00, 0x78, 0x07, 0x80, 0x38, 0x03, 0xC0, 0x3C, 0x01, 0xC0, 0x1F,
+  0xFF, 0xFF, 0xF8, 0xFF, 0xFE, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38,
+  0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x3F, 0xFC, 0xE0, 0xE0, 0xE0, 0x60, 0x70,
+  0x70, 0x30, 0x30, 0x38, 0x38, 0x18, 0x1C, 0x1C, 0x1C, 0x0C, 0x0E, 0x0E,
+  0x06, 0x06, 0x07, 0x07, 0xFF, 0xF1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+  0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xFF, 0xFC, 0x0E, 0x07, 0x81, 0xB0,
+  0xCC, 0x33, 0x9C, 0x66, 0x1C, 0xFF, 0xFF, 0xFC, 0xE6, 0x30, 0x1F, 0x8F,
+  0xF9, 0xC7, 0x90, 0x70, 0x0E, 0x3F, 0xDF, 0xFF, 0xC7, 0xE0, 0xFC, 0x1F,
+  0xC7, 0xBF, 0xF3, 0xEE, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE7, 0x8F,
+  0xFC, 0xF0, 0xEF, 0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F,
+  0x0F, 0xF0, 0xEF, 0xFC, 0xE7, 0x80, 0x0F, 0x83, 0xFC, 0x78, 0xE7, 0x0E,
+  0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x0F, 0x78, 0xE3, 0xFC,
+  0x1F, 0x80, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x1F, 0x73, 0xFF, 0x70,
+  0xFF, 0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F, 0x70,
+  0xF3, 0xFF, 0x1E, 0x70, 0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x07, 0xE0, 0x7F,
+  0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x07, 0x07, 0x78, 0xE3, 0xFE, 0x1F, 0x80,
+  0x0F, 0x1F, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1E, 0x73, 0xFF, 0x70, 0xFF, 0x0F,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F, 0x70, 0xF3, 0xFF,
+  0x1E, 0x70, 0x07, 0x00, 0x77, 0x0E, 0x7F, 0xE1, 0xF8, 0xE0, 0x1C, 0x03,
+  0x80, 0x70, 0x0E, 0xF9, 0xFF, 0xBC, 0x7F, 0x07, 0xE0, 0xFC, 0x1F, 0x83,
+  0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xE0, 0xFF, 0x81, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x39, 0xCE, 0x00, 0x1C, 0xE7, 0x39, 0xCE, 0x73,
+  0x9C, 0xE7, 0x39, 0xCE, 0x73, 0xFB, 0x80, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
+  0x00, 0xE1, 0xEE, 0x1C, 0xE3, 0x8E, 0x78, 0xEF, 0x0E, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFF, 0x0E, 0x78, 0xE3, 0xCE, 0x1E, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE7, 0x8F, 0x9F, 0xFB, 0xFB, 0xC7, 0xC7, 0xF0,
+  0x70, 0x7E, 0x0E, 0x0F, 0xC1, 0xC1, 0xF8, 0x38, 0x3F, 0x07, 0x07, 0xE0,
+  0xE0, 0xFC, 0x1C, 0x1F, 0x83, 0x83, 0xF0, 0x70, 0x7E, 0x0E, 0x0E, 0xEF,
+  0x9F, 0xFB, 0xC7, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC,
+  0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0x1F, 0x83, 0xFC, 0x70, 0xE7, 0x0E, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x0E, 0x70, 0xE3, 0xFC, 0x1F,
+  0x80, 0xE7, 0x8F, 0xFC, 0xF0, 0xEF, 0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7F, 0x0F, 0xF0, 0xEF, 0xFC, 0xEF, 0x8E, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0x1E, 0x73, 0xFF, 0x70, 0xFF, 0x0F, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F, 0x70, 0xF3, 0xFF, 0x1F, 0x70,
+  0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0xEF, 0xFF, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0x0F, 0xFB, 0xC7,
+  0xF0, 0x6F, 0x01, 0xFE, 0x1F, 0xF0, 0x7F, 0x01, 0xFC, 0x1F, 0x87, 0xBF,
+  0xE3, 0xF0, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x1E, 0x0F, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0xC7, 0xBF, 0xF3, 0xCE,
+  0xF0, 0x73, 0x83, 0x9C, 0x1C, 0xE1, 0xC3, 0x8E, 0x1C, 0x70, 0xE7, 0x03,
+  0xB8, 0x1D, 0xC0, 0xEC, 0x03, 0xE0, 0x1F, 0x00, 0x70, 0x00, 0xE0, 0xE0,
+  0xEE, 0x1C, 0x39, 0xC7, 0xC7, 0x38, 0xF8, 0xE7, 0x1B, 0x1C, 0x73, 0x67,
+  0x0E, 0xEE, 0xE1, 0xD9, 0xDC, 0x1B, 0x1B, 0x03, 0xE3, 0xE0, 0x7C, 0x7C,
+  0x0F, 0x07, 0x80, 0xE0, 0xE0, 0x70, 0x77, 0x0E, 0x39, 0xE3, 0xDC, 0x1F,
+  0x80, 0xF8, 0x0F, 0x00, 0xF8, 0x1F, 0x83, 0xDC, 0x39, 0xE7, 0x0E, 0x70,
+  0x70, 0xE0, 0x73, 0x83, 0x9C, 0x1C, 0xE1, 0xC3, 0x8E, 0x1C, 0x70, 0xE7,
+  0x03, 0xB8, 0x1D, 0xC0, 0xEC, 0x03, 0xE0, 0x1F, 0x00, 0xF0, 0x03, 0x80,
+  0x3C, 0x07, 0xC0, 0x7E, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x38, 0x1E,
+  0x07, 0x03, 0x81, 0xE0, 0x70, 0x3C, 0x1E, 0x07, 0x03, 0xFF, 0xFF, 0xC0,
+  0x0F, 0x1F, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF8, 0xE0, 0xF8,
+  0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0x3C, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x0F, 0x1E, 0x1C, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x3C, 0xF8, 0xF0, 0x3C, 0x3B, 0xF1, 0xFD, 0xFF, 0xC7, 0xE0,
+  0x0E, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xE0, 0x0E,
+  0xE0, 0x0E, 0xE0, 0x1C, 0x70, 0x1C, 0x70, 0x1C, 0x70, 0x38, 0x38, 0x38,
+  0x38, 0x7F, 0xF8, 0x7F, 0xFC, 0x70, 0x1C, 0xF0, 0x1C, 0xE0, 0x0E, 0xE0,
+  0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0F, 0xE7,
+  0xE7, 0x7E, 0x3C, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
+  0x00, 0xE4, 0x07, 0xE0, 0xFE, 0x07, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x07, 0xFF, 0x3F, 0xF8, 0xCF, 0xCF, 0xFF, 0xF7, 0x87,
+  0x98, 0x06, 0xE0, 0x1F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80,
+  0x76, 0x01, 0x9E, 0x1E, 0xFF, 0xFD, 0x3F, 0x20, 0x03, 0x1C, 0x63, 0x8C,
+  0x71, 0x8E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xC0, 0x07,
+  0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFF, 0x0E, 0x0E, 0x70,
+  0x1D, 0xC0, 0x07, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xC0, 0x7F, 0x80,
+  0x1F, 0x00, 0x1F, 0xC0, 0x77, 0x01, 0xDE, 0x0E, 0x3F, 0xF0, 0x3F, 0x80,
+  0x1F, 0x07, 0xF1, 0xC7, 0x38, 0xE7, 0x00, 0x78, 0x0F, 0xC3, 0xFC, 0xE3,
+  0xDC, 0x3F, 0xC3, 0xBE, 0x73, 0xFC, 0x3F, 0x01, 0xF0, 0x0E, 0xE1, 0xDE,
+  0x39, 0xFE, 0x1F, 0x80, 0xE7, 0xE7, 0xE7, 0x1C, 0x70, 0x33, 0x80, 0x7C,
+  0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xFE, 0x38, 0x39, 0xC0,
+  0x77, 0x00, 0x1E, 0x00, 0x7E, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFE, 0x00,
+  0x7C, 0x00, 0x7F, 0x01, 0xDC, 0x07, 0x78, 0x38, 0xFF, 0xC0, 0xFE, 0x00,
+  0x0F, 0xE0, 0x7F, 0xC3, 0x83, 0x9C, 0x07, 0x70, 0x01, 0xE0, 0x07, 0xE0,
+  0x0F, 0xF0, 0x1F, 0xF0, 0x1F, 0xE0, 0x07, 0xC0, 0x07, 0xF0, 0x1D, 0xC0,
+  0x77, 0x83, 0x8F, 0xFC, 0x0F, 0xE0, 0x0E, 0x00, 0x0C, 0x00, 0x30, 0x03,
+  0xC0, 0x0E, 0x00, 0x38, 0xE0, 0x77, 0x00, 0xDC, 0x01, 0xE0, 0x07, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0,
+  0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70,
+  0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x1C, 0x00,
+  0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0, 0x0F,
+  0x00, 0x70, 0x07, 0x80, 0x78, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x1C, 0x01,
+  0xE0, 0x1E, 0x00, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x38, 0xE0,
+  0xEE, 0x03, 0x60, 0x1F, 0x00, 0x70, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
+  0x70, 0x07, 0x80, 0x78, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x1C, 0x01, 0xE0,
+  0x1E, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
+  0x1E, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x07, 0x80, 0x78, 0x03, 0x80, 0x3C,
+  0x03, 0xC0, 0x1C, 0x01, 0xE0, 0x1E, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC,
+  0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x1F, 0x8F, 0xF9, 0xC7,
+  0x90, 0x70, 0x0E, 0x3F, 0xDF, 0xFF, 0xC7, 0xE0, 0xFC, 0x1F, 0xC7, 0xBF,
+  0xF3, 0xCE, 0x03, 0x80, 0x60, 0x0C, 0x01, 0xE0, 0x1C, 0x23, 0x98, 0xC7,
+  0xBC, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0F, 0x9F, 0xF9, 0xF0, 0xE1, 0xC3,
+  0x87, 0x0E, 0x1C, 0x38, 0x7E, 0xC0, 0x0F, 0xDF, 0xBF, 0x6E, 0x1C, 0x38,
+  0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC0, 0x03, 0x80,
+  0xE0, 0x38, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0xF7, 0x8F, 0xE0, 0xDE, 0x03,
+  0xFC, 0x3F, 0xE0, 0xFE, 0x03, 0xF8, 0x3F, 0x0F, 0x7F, 0xC7, 0xE0, 0x63,
+  0x9B, 0x8F, 0x83, 0x80, 0x4E, 0x33, 0xFE, 0x71, 0xC6, 0x70, 0xEC, 0x0F,
+  0x80, 0xE0, 0x00, 0x07, 0xC3, 0xFE, 0xF1, 0xFC, 0x1B, 0xC0, 0x7F, 0x87,
+  0xFC, 0x1F, 0xC0, 0x7F, 0x07, 0xE1, 0xEF, 0xF8, 0xFC, 0x00, 0x1F, 0x0F,
+  0xFB, 0xC7, 0xF0, 0x6F, 0x01, 0xFE, 0x1F, 0xF0, 0x7F, 0x01, 0xFC, 0x1F,
+  0x87, 0xBF, 0xE3, 0xF0, 0x1C, 0x00, 0xC0, 0x18, 0x0F, 0x01, 0x80, 0x03,
+  0x81, 0xC0, 0xE7, 0x63, 0x81, 0xC3, 0xFD, 0xFE, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x0F, 0x03, 0xC0, 0x07, 0x01, 0x80,
+  0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x0E, 0x07, 0x81, 0xC0, 0xE0, 0x78,
+  0x1C, 0x0F, 0x07, 0x81, 0xC0, 0xFF, 0xFF, 0xF0, 0x39, 0x9C, 0xC6, 0x60,
+  0x73, 0x8F, 0xC1, 0xE0, 0x30, 0x00, 0x3F, 0xFF, 0xFC, 0x0E, 0x07, 0x81,
+  0xC0, 0xE0, 0x78, 0x1C, 0x0F, 0x07, 0x81, 0xC0, 0xFF, 0xFF, 0xF0, 0x0E,
+  0x03, 0x80, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x0F, 0x03, 0x81, 0xC0,
+  0xF0, 0x38, 0x1E, 0x0F, 0x07, 0x81, 0xE0, 0xFF, 0xFF, 0xF0, 0x03, 0x80,
+  0x38, 0x01, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x9C, 0x1C, 0xE0,
+  0x77, 0x03, 0xB8, 0x1D, 0xC0, 0xEE, 0x0E, 0x7F, 0xF3, 0xFE, 0x1C, 0x70,
+  0xE1, 0xC7, 0x0E, 0x38, 0x39, 0xC1, 0xCE, 0x07, 0x70, 0x38, 0x00, 0xC0,
+  0x03, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x03,
+  0xE0, 0x0F, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0xE3, 0x81, 0xC7, 0x03, 0x8E,
+  0x0E, 0x0E, 0x1C, 0x1C, 0x7F, 0xFC, 0xFF, 0xF9, 0xC0, 0x77, 0x80, 0xFE,
+  0x00, 0xFC, 0x01, 0xC0, 0x03, 0x80, 0x0F, 0x00, 0x1B, 0x00, 0x77, 0x01,
+  0xC7, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0xC0, 0x3B,
+  0x80, 0x77, 0x01, 0xC7, 0x03, 0x8E, 0x07, 0x1C, 0x1C, 0x1C, 0x38, 0x38,
+  0xFF, 0xF9, 0xFF, 0xF3, 0x80, 0xEF, 0x01, 0xFC, 0x01, 0xF8, 0x03, 0x80,
+  0x1C, 0x70, 0x38, 0xE0, 0x3F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x01,
+  0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0xE3, 0x81, 0xC7,
+  0x03, 0x8E, 0x0E, 0x0E, 0x1C, 0x1C, 0x3F, 0xF8, 0xFF, 0xF9, 0xC0, 0x77,
+  0x80, 0xFE, 0x00, 0xFC, 0x01, 0xC0, 0x0E, 0x70, 0x1C, 0xE0, 0x39, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x1F,
+  0xC0, 0x39, 0xC0, 0x73, 0x81, 0xE7, 0x03, 0x87, 0x0F, 0x0E, 0x1C, 0x1C,
+  0x3F, 0xFC, 0xFF, 0xF9, 0xC0, 0x77, 0x80, 0xFE, 0x00, 0xFC, 0x01, 0xC0,
+  0x30, 0x0E, 0x01, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xE0, 0x03, 0x80, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xFE, 0x1F, 0xFE, 0x7C, 0x3C,
+  0xE0, 0x3F, 0xC0, 0x3F, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xF0, 0x0E, 0xE0, 0x3D, 0xF0, 0xF1, 0xFF, 0xE1, 0xFF, 0x00, 0xFC,
+  0x00, 0x07, 0xE0, 0x3F, 0xE0, 0xFF, 0xE3, 0xC1, 0xE7, 0x01, 0xDE, 0x03,
+  0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x77,
+  0x01, 0xCF, 0x07, 0x8F, 0xFE, 0x0F, 0xF8, 0x07, 0xC0, 0x03, 0x00, 0x03,
+  0x00, 0x06, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x0C, 0x70, 0x1D, 0xC0, 0x1F,
+  0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xFC, 0x3F, 0xFC,
+  0xF8, 0x7D, 0xC0, 0x3F, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xE0, 0x01, 0xE0, 0x1D, 0xC0, 0x7B, 0xE1, 0xE3, 0xFF, 0x83, 0xFE,
+  0x01, 0xF8, 0x00, 0x03, 0x00, 0xE0, 0x18, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0xFF, 0xFF, 0xF8, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF, 0xFC, 0x03,
+  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF, 0xE0, 0x18, 0x07,
+  0x00, 0xE0, 0x1E, 0x01, 0xC0, 0x39, 0xC7, 0x38, 0xE7, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0xFF, 0xFF,
+  0xF8, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0xFF, 0xFF, 0xC0,
+  0x71, 0xC7, 0x70, 0x6C, 0x07, 0x80, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x0E, 0x01, 0xFF, 0xFF, 0xF8, 0x33, 0x98, 0x00, 0x73,
+  0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x70, 0x1C, 0x0E,
+  0x0D, 0x8E, 0xEE, 0x38, 0x00, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70,
+  0x71, 0xC0, 0xCE, 0x03, 0xF0, 0x07, 0x80, 0x0C, 0x00, 0x00, 0x0F, 0xF8,
+  0x3F, 0xF8, 0xE0, 0xF3, 0x80, 0xEE, 0x03, 0xB8, 0x07, 0xE0, 0x1F, 0x80,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x03, 0xB8, 0x0E, 0xE0,
+  0xF3, 0xFF, 0x8F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F, 0xFE, 0x07, 0x07, 0x83,
+  0x80, 0xE1, 0xC0, 0x70, 0xE0, 0x1C, 0x70, 0x0F, 0xFE, 0x07, 0xFF, 0x03,
+  0x8E, 0x01, 0xC7, 0x00, 0xE3, 0x80, 0x71, 0xC0, 0x70, 0xE0, 0x38, 0x70,
+  0x78, 0x3F, 0xF8, 0x1F, 0xF0, 0x00, 0x01, 0xC0, 0x06, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x03, 0x80, 0x7F, 0x01, 0xFC, 0x07, 0xF8, 0x1F, 0xF0, 0x7F,
+  0xE1, 0xFB, 0x87, 0xEF, 0x1F, 0x9E, 0x7E, 0x3D, 0xF8, 0x77, 0xE1, 0xFF,
+  0x83, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0x70, 0x18, 0x60, 0x73,
+  0x80, 0xFC, 0x01, 0xE0, 0x03, 0x00, 0x00, 0x0E, 0x01, 0xFC, 0x07, 0xF0,
+  0x1F, 0xE0, 0x7F, 0xC1, 0xFF, 0x87, 0xEE, 0x1F, 0xBC, 0x7E, 0x79, 0xF8,
+  0xF7, 0xE1, 0xDF, 0x87, 0xFE, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0xFE,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0E, 0xF0, 0x0F,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0F,
+  0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x01, 0x80,
+  0x03, 0xC0, 0x07, 0xE0, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x0E,
+  0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x03, 0x9C, 0x07, 0x38,
+  0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC,
+  0x7C, 0x3E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC,
+  0x1F, 0xF8, 0x07, 0xE0, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0E,
+  0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xF0, 0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0,
+  0x40, 0x5C, 0x1F, 0xC7, 0xBD, 0xE3, 0xF8, 0x3E, 0x07, 0xC1, 0xFC, 0x7B,
+  0xDE, 0x3F, 0x83, 0xA0, 0x20, 0x71, 0xC1, 0xCC, 0x06, 0xC0, 0x1E, 0x00,
+  0x60, 0x00, 0x03, 0xFE, 0x1F, 0xFC, 0xE0, 0xE7, 0x03, 0xB8, 0x1D, 0xC0,
+  0xEE, 0x07, 0x70, 0x73, 0xFF, 0x9F, 0xF0, 0xE3, 0x87, 0x0E, 0x38, 0x71,
+  0xC1, 0xCE, 0x0E, 0x70, 0x3B, 0x81, 0xC0, 0x03, 0x00, 0x1E, 0x00, 0x48,
+  0x01, 0x20, 0x07, 0x80, 0x0C, 0x00, 0x00, 0x38, 0x07, 0xE0, 0x1F, 0x80,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
+  0x1F, 0x80, 0x7E, 0x01, 0xFC, 0x0F, 0x78, 0x79, 0xFF, 0xE3, 0xFF, 0x03,
+  0xF0, 0x01, 0xC0, 0x06, 0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0x80, 0x7E,
+  0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F,
+  0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0xF7, 0x87, 0x9F, 0xFE,
+  0x3F, 0xF0, 0x3F, 0x00, 0x07, 0x38, 0x19, 0xC0, 0xCC, 0x00, 0x00, 0x00,
+  0x03, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
+  0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0xF7,
+  0x87, 0x9F, 0xFE, 0x3F, 0xF0, 0x3F, 0x00, 0x1C, 0xE0, 0x73, 0x81, 0xCE,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
+  0x1F, 0xC0, 0xF7, 0x87, 0x9F, 0xFE, 0x3F, 0xF0, 0x3F, 0x00, 0x00, 0xC0,
+  0x03, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xDC, 0x07, 0x3C,
+  0x1E, 0x38, 0x38, 0x78, 0xF0, 0x71, 0xC0, 0x77, 0x00, 0xEE, 0x00, 0xF8,
+  0x01, 0xF0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x70, 0x01, 0xC0, 0x07,
+  0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01,
+  0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x0C, 0x00,
+  0x3C, 0x00, 0x30, 0x00, 0xC0, 0x1E, 0x00, 0x70, 0x00, 0x1F, 0x07, 0xFC,
+  0xF1, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0xE1, 0xCE, 0x78, 0xE7, 0xCE, 0x0E,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xFE, 0x7E, 0xE7, 0x80, 0x0E,
+  0x1C, 0x18, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x03, 0x80, 0x60, 0x18, 0x00, 0x00, 0x00,
+  0x3F, 0x1F, 0xF3, 0x8F, 0x20, 0xE0, 0x1C, 0x7F, 0xBF, 0xFF, 0x8F, 0xC1,
+  0xF8, 0x3F, 0x8F, 0x7F, 0xE7, 0xDC, 0x06, 0x01, 0xE0, 0x7E, 0x1C, 0xC3,
+  0x0C, 0x00, 0x07, 0xE3, 0xFE, 0x71, 0xE4, 0x1C, 0x03, 0x8F, 0xF7, 0xFF,
+  0xF1, 0xF8, 0x3F, 0x07, 0xF1, 0xEF, 0xFC, 0xFB, 0x80, 0x39, 0xC7, 0x38,
+  0x7E, 0x07, 0x80, 0x00, 0x3F, 0x1F, 0xF3, 0x8F, 0x30, 0xE0, 0x1C, 0x7F,
+  0xBF, 0xFF, 0x8F, 0xC1, 0xF8, 0x3F, 0x8F, 0x7F, 0xE7, 0xDC, 0x39, 0xC7,
+  0x38, 0xE7, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xF3, 0x8F, 0x20, 0xE0, 0x1C,
+  0x7F, 0xBF, 0xFF, 0x8F, 0xC1, 0xF8, 0x3F, 0x8F, 0x7F, 0xE7, 0xDC, 0x33,
+  0x98, 0x00, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE,
+  0x70, 0x03, 0x80, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0xC7,
+  0x8E, 0x70, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0xF7,
+  0x8E, 0x3F, 0xC1, 0xF8, 0x0F, 0x83, 0xFE, 0x78, 0xE7, 0x07, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x07, 0x78, 0xE3, 0xFE, 0x0F, 0x80,
+  0x70, 0x01, 0x80, 0x18, 0x07, 0x80, 0x60, 0x39, 0xC1, 0xD8, 0x0F, 0x00,
+  0x60, 0x00, 0x00, 0xF8, 0x3F, 0xC7, 0x8E, 0x70, 0x7E, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0x70, 0xE7, 0x8E, 0x3F, 0xC1, 0xF8, 0x03, 0x80,
+  0x30, 0x06, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x0E, 0x60, 0x7E,
+  0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0x70, 0x77, 0x8E, 0x3F, 0xE1,
+  0xF8, 0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE,
+  0x00, 0xE0, 0x07, 0x07, 0x78, 0xE3, 0xFE, 0x1F, 0x80, 0x60, 0x0E, 0x00,
+  0xF8, 0x07, 0x80, 0x39, 0xC3, 0x9C, 0x39, 0xC0, 0x00, 0x00, 0x01, 0xF8,
+  0x3F, 0xC7, 0x0E, 0x60, 0x7E, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00,
+  0x70, 0x77, 0x8E, 0x3F, 0xE1, 0xF8, 0x30, 0xC3, 0x9C, 0x1F, 0x80, 0xF0,
+  0x06, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x07, 0xE0, 0x7F, 0xFF,
+  0xFF, 0xFE, 0x00, 0xE0, 0x07, 0x07, 0x78, 0xE3, 0xFE, 0x1F, 0x80, 0x33,
+  0x98, 0x00, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x00, 0x1C,
+  0x1F, 0x1D, 0xDC, 0x70, 0x00, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,
+  0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x77,
+  0x00, 0x77, 0x00, 0x76, 0x00, 0x70, 0x1F, 0x70, 0x3F, 0xF0, 0x70, 0xF0,
+  0xF0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+  0xF0, 0xF0, 0x70, 0xF0, 0x3F, 0xF0, 0x1E, 0x70, 0x00, 0x70, 0x0F, 0xF0,
+  0x3F, 0xC0, 0x1C, 0x1F, 0x70, 0xFF, 0xC7, 0x0F, 0x3C, 0x3C, 0xE0, 0x73,
+  0x81, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0x73, 0xC3, 0xC7, 0x0F, 0x0F, 0xFC,
+  0x1E, 0x70, 0x03, 0x00, 0xE0, 0x18, 0x00, 0x00, 0x01, 0xDF, 0x3F, 0xF7,
+  0x8F, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
+  0xE0, 0xFC, 0x1C, 0x31, 0x83, 0x60, 0x7C, 0x07, 0x00, 0x01, 0xDF, 0x3F,
+  0xF7, 0x8F, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
+  0x07, 0xE0, 0xFC, 0x1C, 0x03, 0x80, 0x30, 0x06, 0x00, 0x00, 0x00, 0x01,
+  0xF8, 0x3F, 0xC7, 0x0E, 0x70, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0x70, 0xE7, 0x0E, 0x3F, 0xC1, 0xF8, 0x06, 0x00, 0xF0, 0x1F, 0x83,
+  0x98, 0x30, 0xC0, 0x00, 0x1F, 0x83, 0xFC, 0x70, 0xE7, 0x0E, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x0E, 0x70, 0xE3, 0xFC, 0x1F, 0x80,
+  0x0E, 0x60, 0xCC, 0x19, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x0E,
+  0x70, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0xE7, 0x0E,
+  0x3F, 0xC1, 0xF8, 0x39, 0xC3, 0x9C, 0x39, 0xC0, 0x00, 0x00, 0x01, 0xF8,
+  0x3F, 0xC7, 0x0E, 0x70, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
+  0x70, 0xE7, 0x0E, 0x3F, 0xC1, 0xF8, 0x0E, 0x01, 0xC0, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x38, 0x07, 0x00, 0xE0,
+  0x63, 0x9B, 0x87, 0x83, 0x80, 0x03, 0xBD, 0xFE, 0xF0, 0x70, 0x38, 0x1C,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x00, 0x0E, 0x07, 0xF0,
+  0xC6, 0x18, 0xC3, 0xF8, 0x3E, 0x00, 0x07, 0x07, 0xE0, 0xFC, 0x1F, 0x83,
+  0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFE, 0x3D, 0xFF, 0x9E,
+  0x70, 0x03, 0x00, 0xE0, 0x18, 0x00, 0x00, 0x01, 0xC1, 0xF8, 0x3F, 0x07,
+  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x8F, 0x7F,
+  0xE7, 0x9C, 0x0C, 0xE3, 0xB8, 0x6E, 0x00, 0x00, 0x01, 0xC1, 0xF8, 0x3F,
+  0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x8F,
+  0x7F, 0xE7, 0x9C, 0x39, 0xC7, 0x38, 0xE7, 0x00, 0x00, 0x01, 0xC1, 0xF8,
+  0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
+  0x8F, 0x7F, 0xE7, 0x9C, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x00, 0x0E, 0x07,
+  0x38, 0x39, 0xC1, 0xCE, 0x1C, 0x38, 0xE1, 0xC7, 0x0E, 0x70, 0x3B, 0x81,
+  0xDC, 0x0E, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00, 0x38, 0x03, 0xC0, 0x7C,
+  0x07, 0xE0, 0x3C, 0x00, 0x38, 0x38, 0x38, 0xFE, 0xFE, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x3E, 0x3E, 0x0E, 0x06, 0x03, 0x03, 0x0F,
+  0x0E, 0xFF, 0x80 };
+
+const GFXglyph InterTight_SemiBold12pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   4,  17,   8,    2,  -16 },   // 0x21 '!' U+0021
+  {    10,   8,   7,  12,    2,  -16 },   // 0x22 '"' U+0022
+  {    17,  14,  17,  14,    0,  -16 },   // 0x23 '#' U+0023
+  {    47,  14,  22,  15,    0,  -19 },   // 0x24 '$' U+0024
+  {    86,  16,  17,  20,    2,  -16 },   // 0x25 '%' U+0025
+  {   120,  15,  17,  16,    1,  -16 },   // 0x26 '&' U+0026
+  {   152,   3,   7,   7,    2,  -16 },   // 0x27 ''' U+0027
+  {   155,   6,  21,   8,    2,  -17 },   // 0x28 '(' U+0028
+  {   171,   6,  21,   8,    0,  -17 },   // 0x29 ')' U+0029
+  {   187,  10,   9,  12,    1,  -16 },   // 0x2a '*' U+002A
+  {   199,  12,  12,  15,    1,  -12 },   // 0x2b '+' U+002B
+  {   217,   4,   7,   7,    1,   -1 },   // 0x2c ',' U+002C
+  {   221,   8,   2,  10,    1,   -7 },   // 0x2d '-' U+002D
+  {   223,   3,   3,   5,    1,   -2 },   // 0x2e '.' U+002E
+  {   225,   8,  21,   8,    0,  -17 },   // 0x2f '/' U+002F
+  {   246,  13,  17,  15,    1,  -16 },   // 0x30 '0' U+0030
+  {   274,   7,  17,   9,    1,  -16 },   // 0x31 '1' U+0031
+  {   289,  12,  17,  14,    1,  -16 },   // 0x32 '2' U+0032
+  {   315,  13,  17,  15,    1,  -16 },   // 0x33 '3' U+0033
+  {   343,  13,  17,  15,    1,  -16 },   // 0x34 '4' U+0034
+  {   371,  12,  17,  14,    1,  -16 },   // 0x35 '5' U+0035
+  {   397,  13,  17,  15,    1,  -16 },   // 0x36 '6' U+0036
+  {   425,  12,  17,  14,    1,  -16 },   // 0x37 '7' U+0037
+  {   451,  13,  17,  15,    1,  -16 },   // 0x38 '8' U+0038
+  {   479,  13,  17,  15,    1,  -16 },   // 0x39 '9' U+0039
+  {   507,   3,  12,   5,    1,  -11 },   // 0x3a ':' U+003A
+  {   512,   4,  16,   6,    1,  -10 },   // 0x3b ';' U+003B
+  {   520,  12,  13,  15,    2,  -12 },   // 0x3c '<' U+003C
+  {   540,  11,   8,  15,    2,  -10 },   // 0x3d '=' U+003D
+  {   551,  12,  13,  15,    2,  -12 },   // 0x3e '>' U+003E
+  {   571,  11,  17,  13,    1,  -16 },   // 0x3f '?' U+003F
+  {   595,  22,  22,  24,    1,  -16 },   // 0x40 '@' U+0040
+  {   656,  15,  17,  17,    1,  -16 },   // 0x41 'A' U+0041
+  {   688,  13,  17,  15,    1,  -16 },   // 0x42 'B' U+0042
+  {   716,  15,  17,  17,    1,  -16 },   // 0x43 'C' U+0043
+  {   748,  14,  17,  16,    1,  -16 },   // 0x44 'D' U+0044
+  {   778,  11,  17,  13,    1,  -16 },   // 0x45 'E' U+0045
+  {   802,  11,  17,  13,    1,  -16 },   // 0x46 'F' U+0046
+  {   826,  15,  17,  17,    1,  -16 },   // 0x47 'G' U+0047
+  {   858,  14,  17,  16,    1,  -16 },   // 0x48 'H' U+0048
+  {   888,   3,  17,   5,    1,  -16 },   // 0x49 'I' U+0049
+  {   895,  11,  17,  13,    1,  -16 },   // 0x4a 'J' U+004A
+  {   919,  14,  17,  15,    1,  -16 },   // 0x4b 'K' U+004B
+  {   949,  11,  17,  12,    1,  -16 },   // 0x4c 'L' U+004C
+  {   973,  18,  17,  20,    1,  -16 },   // 0x4d 'M' U+004D
+  {  1012,  14,  17,  16,    1,  -16 },   // 0x4e 'N' U+004E
+  {  1042,  16,  17,  18,    1,  -16 },   // 0x4f 'O' U+004F
+  {  1076,  12,  17,  14,    1,  -16 },   // 0x50 'P' U+0050
+  {  1102,  16,  18,  18,    1,  -16 },   // 0x51 'Q' U+0051
+  {  1138,  13,  17,  14,    1,  -16 },   // 0x52 'R' U+0052
+  {  1166,  14,  17,  15,    0,  -16 },   // 0x53 'S' U+0053
+  {  1196,  14,  17,  16,    1,  -16 },   // 0x54 'T' U+0054
+  {  1226,  14,  17,  16,    1,  -16 },   // 0x55 'U' U+0055
+  {  1256,  16,  17,  16,    0,  -16 },   // 0x56 'V' U+0056
+  {  1290,  23,  17,  23,    0,  -16 },   // 0x57 'W' U+0057
+  {  1339,  15,  17,  15,    0,  -16 },   // 0x58 'X' U+0058
+  {  1371,  15,  17,  15,    0,  -16 },   // 0x59 'Y' U+0059
+  {  1403,  13,  17,  15,    1,  -16 },   // 0x5a 'Z' U+005A
+  {  1431,   6,  21,   8,    2,  -17 },   // 0x5b '[' U+005B
+  {  1447,   8,  21,   8,    0,  -17 },   // 0x5c '\' U+005C
+  {  1468,   6,  21,   8,    0,  -17 },   // 0x5d ']' U+005D
+  {  1484,  10,   7,  11,    0,  -15 },   // 0x5e '^' U+005E
+  {  1493,  11,   2,  11,    0,    1 },   // 0x5f '_' U+005F
+  {  1496,   4,   3,  10,    3,  -16 },   // 0x60 '`' U+0060
+  {  1498,  11,  13,  13,    1,  -12 },   // 0x61 'a' U+0061
+  {  1516,  12,  17,  14,    1,  -16 },   // 0x62 'b' U+0062
+  {  1542,  12,  13,  13,    1,  -12 },   // 0x63 'c' U+0063
+  {  1562,  12,  17,  14,    1,  -16 },   // 0x64 'd' U+0064
+  {  1588,  12,  13,  14,    1,  -12 },   // 0x65 'e' U+0065
+  {  1608,   8,  18,   9,    1,  -17 },   // 0x66 'f' U+0066
+  {  1626,  12,  18,  14,    1,  -12 },   // 0x67 'g' U+0067
+  {  1653,  11,  17,  13,    1,  -16 },   // 0x68 'h' U+0068
+  {  1677,   3,  18,   5,    1,  -17 },   // 0x69 'i' U+0069
+  {  1684,   5,  23,   5,   -1,  -17 },   // 0x6a 'j' U+006A
+  {  1699,  12,  17,  12,    1,  -16 },   // 0x6b 'k' U+006B
+  {  1725,   3,  17,   5,    1,  -16 },   // 0x6c 'l' U+006C
+  {  1732,  19,  13,  21,    1,  -12 },   // 0x6d 'm' U+006D
+  {  1763,  11,  13,  13,    1,  -12 },   // 0x6e 'n' U+006E
+  {  1781,  12,  13,  14,    1,  -12 },   // 0x6f 'o' U+006F
+  {  1801,  12,  18,  14,    1,  -12 },   // 0x70 'p' U+0070
+  {  1828,  12,  18,  14,    1,  -12 },   // 0x71 'q' U+0071
+  {  1855,   8,  13,   9,    1,  -12 },   // 0x72 'r' U+0072
+  {  1868,  11,  13,  13,    1,  -12 },   // 0x73 's' U+0073
+  {  1886,   8,  16,   9,    1,  -15 },   // 0x74 't' U+0074
+  {  1902,  11,  13,  13,    1,  -12 },   // 0x75 'u' U+0075
+  {  1920,  13,  13,  13,    0,  -12 },   // 0x76 'v' U+0076
+  {  1942,  19,  13,  19,    0,  -12 },   // 0x77 'w' U+0077
+  {  1973,  12,  13,  12,    0,  -12 },   // 0x78 'x' U+0078
+  {  1993,  13,  18,  13,    0,  -12 },   // 0x79 'y' U+0079
+  {  2023,  10,  13,  12,    1,  -12 },   // 0x7a 'z' U+007A
+  {  2040,   8,  21,  10,    1,  -17 },   // 0x7b '{' U+007B
+  {  2061,   3,  28,   7,    2,  -21 },   // 0x7c '|' U+007C
+  {  2072,   8,  21,   9,    0,  -17 },   // 0x7d '}' U+007D
+  {  2093,  13,   5,  15,    1,   -8 },   // 0x7e '~' U+007E
+  {     0,   0,   0,  12,    1,  -22 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  2102,   1,   1,   5,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  2103,  16,  22,  16,    1,  -16 },   // 0x81 '0x0104' U+0104
+  {  2147,   8,   4,  10,    1,  -17 },   // 0x82 '0x02D8' U+02D8
+  {  2151,  13,  17,  13,    0,  -16 },   // 0x83 '0x0141' U+0141
+  {  2179,  14,  14,  16,    1,  -13 },   // 0x84 '0x00A4' U+00A4
+  {  2204,  11,  18,  12,    1,  -17 },   // 0x85 '0x013D' U+013D
+  {  2229,  14,  22,  15,    0,  -21 },   // 0x86 '0x015A' U+015A
+  {  2268,  11,  20,  13,    1,  -16 },   // 0x87 '0x00A7' U+00A7
+  {  2296,   8,   3,  12,    2,  -17 },   // 0x88 '0x00A8' U+00A8
+  {  2299,  14,  23,  15,    0,  -22 },   // 0x89 '0x0160' U+0160
+  {  2340,  14,  22,  15,    0,  -16 },   // 0x8a '0x015E' U+015E
+  {  2379,  14,  23,  16,    1,  -22 },   // 0x8b '0x0164' U+0164
+  {  2420,  13,  22,  15,    1,  -21 },   // 0x8c '0x0179' U+0179
+  {  2456,   8,   2,  10,    1,   -7 },   // 0x8d '0x00AD' U+00AD
+  {  2458,  13,  23,  15,    1,  -22 },   // 0x8e '0x017D' U+017D
+  {  2496,  13,  22,  15,    1,  -21 },   // 0x8f '0x017B' U+017B
+  {  2532,   8,   8,  10,    1,  -16 },   // 0x90 '0x00B0' U+00B0
+  {  2540,  11,  18,  13,    1,  -12 },   // 0x91 '0x0105' U+0105
+  {  2565,   5,   6,   6,    0,    0 },   // 0x92 '0x02DB' U+02DB
+  {  2569,   7,  17,   5,   -1,  -16 },   // 0x93 '0x0142' U+0142
+  {  2584,   4,   3,  10,    3,  -16 },   // 0x94 '0x00B4' U+00B4
+  {  2586,   7,  18,   7,    1,  -17 },   // 0x95 '0x013E' U+013E
+  {  2602,  11,  18,  13,    1,  -17 },   // 0x96 '0x015B' U+015B
+  {  2627,   9,   4,  12,    1,  -17 },   // 0x97 '0x02C7' U+02C7
+  {  2632,   4,   6,   7,    2,    0 },   // 0x98 '0x00B8' U+00B8
+  {  2635,  11,  19,  13,    1,  -18 },   // 0x99 '0x0161' U+0161
+  {  2662,  11,  18,  13,    1,  -12 },   // 0x9a '0x015F' U+015F
+  {  2687,   9,  19,   9,    1,  -18 },   // 0x9b '0x0165' U+0165
+  {  2709,  10,  18,  12,    1,  -17 },   // 0x9c '0x017A' U+017A
+  {  2732,  10,   3,   9,    0,  -16 },   // 0x9d '0x02DD' U+02DD
+  {  2736,  10,  18,  12,    1,  -17 },   // 0x9e '0x017E' U+017E
+  {  2759,  10,  18,  12,    1,  -17 },   // 0x9f '0x017C' U+017C
+  {  2782,  13,  22,  14,    1,  -21 },   // 0xa0 '0x0154' U+0154
+  {  2818,  15,  22,  17,    1,  -21 },   // 0xa1 '0x00C1' U+00C1
+  {  2860,  15,  23,  17,    1,  -22 },   // 0xa2 '0x00C2' U+00C2
+  {  2904,  15,  22,  17,    1,  -21 },   // 0xa3 '0x0102' U+0102
+  {  2946,  15,  22,  17,    1,  -21 },   // 0xa4 '0x00C4' U+00C4
+  {  2988,  11,  22,  12,    1,  -21 },   // 0xa5 '0x0139' U+0139
+  {  3019,  15,  22,  17,    1,  -21 },   // 0xa6 '0x0106' U+0106
+  {  3061,  15,  22,  16,    1,  -16 },   // 0xa7 '0x00C7' U+00C7
+  {  3103,  15,  23,  17,    1,  -22 },   // 0xa8 '0x010C' U+010C
+  {  3147,  11,  22,  13,    1,  -21 },   // 0xa9 '0x00C9' U+00C9
+  {  3178,  11,  22,  13,    1,  -16 },   // 0xaa '0x0118' U+0118
+  {  3209,  11,  22,  13,    1,  -21 },   // 0xab '0x00CB' U+00CB
+  {  3240,  11,  23,  13,    1,  -22 },   // 0xac '0x011A' U+011A
+  {  3272,   5,  22,   5,    1,  -21 },   // 0xad '0x00CD' U+00CD
+  {  3286,   9,  23,   5,   -2,  -22 },   // 0xae '0x00CE' U+00CE
+  {  3312,  14,  23,  16,    1,  -22 },   // 0xaf '0x010E' U+010E
+  {  3353,  17,  17,  16,   -2,  -16 },   // 0xb0 '0x0110' U+0110
+  {  3390,  14,  22,  16,    1,  -21 },   // 0xb1 '0x0143' U+0143
+  {  3429,  14,  23,  16,    1,  -22 },   // 0xb2 '0x0147' U+0147
+  {  3470,  16,  22,  18,    1,  -21 },   // 0xb3 '0x00D3' U+00D3
+  {  3514,  16,  23,  18,    1,  -22 },   // 0xb4 '0x00D4' U+00D4
+  {  3560,  16,  22,  18,    1,  -21 },   // 0xb5 '0x0150' U+0150
+  {  3604,  16,  22,  18,    1,  -21 },   // 0xb6 '0x00D6' U+00D6
+  {  3648,  11,  12,  15,    2,  -12 },   // 0xb7 '0x00D7' U+00D7
+  {  3665,  13,  23,  14,    1,  -22 },   // 0xb8 '0x0158' U+0158
+  {  3703,  14,  24,  16,    1,  -23 },   // 0xb9 '0x016E' U+016E
+  {  3745,  14,  22,  16,    1,  -21 },   // 0xba '0x00DA' U+00DA
+  {  3784,  14,  22,  16,    1,  -21 },   // 0xbb '0x0170' U+0170
+  {  3823,  14,  22,  16,    1,  -21 },   // 0xbc '0x00DC' U+00DC
+  {  3862,  15,  22,  15,    0,  -21 },   // 0xbd '0x00DD' U+00DD
+  {  3904,  14,  23,  16,    1,  -16 },   // 0xbe '0x0162' U+0162
+  {  3945,  12,  17,  14,    1,  -16 },   // 0xbf '0x00DF' U+00DF
+  {  3971,   8,  18,   9,    1,  -17 },   // 0xc0 '0x0155' U+0155
+  {  3989,  11,  18,  13,    1,  -17 },   // 0xc1 '0x00E1' U+00E1
+  {  4014,  11,  19,  13,    1,  -18 },   // 0xc2 '0x00E2' U+00E2
+  {  4041,  11,  18,  13,    1,  -17 },   // 0xc3 '0x0103' U+0103
+  {  4066,  11,  18,  13,    1,  -17 },   // 0xc4 '0x00E4' U+00E4
+  {  4091,   5,  22,   5,    1,  -21 },   // 0xc5 '0x013A' U+013A
+  {  4105,  12,  18,  13,    1,  -17 },   // 0xc6 '0x0107' U+0107
+  {  4132,  12,  18,  14,    1,  -12 },   // 0xc7 '0x00E7' U+00E7
+  {  4159,  12,  18,  13,    1,  -17 },   // 0xc8 '0x010D' U+010D
+  {  4186,  12,  18,  14,    1,  -17 },   // 0xc9 '0x00E9' U+00E9
+  {  4213,  12,  17,  14,    1,  -12 },   // 0xca '0x0119' U+0119
+  {  4239,  12,  18,  14,    1,  -17 },   // 0xcb '0x00EB' U+00EB
+  {  4266,  12,  19,  14,    1,  -18 },   // 0xcc '0x011B' U+011B
+  {  4295,   5,  18,   5,    1,  -17 },   // 0xcd '0x00ED' U+00ED
+  {  4307,   9,  18,   5,   -2,  -17 },   // 0xce '0x00EE' U+00EE
+  {  4328,  16,  18,  16,    1,  -17 },   // 0xcf '0x010F' U+010F
+  {  4364,  14,  17,  15,    1,  -16 },   // 0xd0 '0x0111' U+0111
+  {  4394,  11,  18,  13,    1,  -17 },   // 0xd1 '0x0144' U+0144
+  {  4419,  11,  18,  13,    1,  -17 },   // 0xd2 '0x0148' U+0148
+  {  4444,  12,  18,  14,    1,  -17 },   // 0xd3 '0x00F3' U+00F3
+  {  4471,  12,  19,  14,    1,  -18 },   // 0xd4 '0x00F4' U+00F4
+  {  4500,  12,  18,  14,    1,  -17 },   // 0xd5 '0x0151' U+0151
+  {  4527,  12,  18,  14,    1,  -17 },   // 0xd6 '0x00F6' U+00F6
+  {  4554,  11,  13,  15,    2,  -12 },   // 0xd7 '0x00F7' U+00F7
+  {  4572,   9,  18,   9,    0,  -17 },   // 0xd8 '0x0159' U+0159
+  {  4593,  11,  20,  13,    1,  -19 },   // 0xd9 '0x016F' U+016F
+  {  4621,  11,  18,  13,    1,  -17 },   // 0xda '0x00FA' U+00FA
+  {  4646,  11,  18,  13,    1,  -17 },   // 0xdb '0x0171' U+0171
+  {  4671,  11,  18,  13,    1,  -17 },   // 0xdc '0x00FC' U+00FC
+  {  4696,  13,  22,  13,    0,  -16 },   // 0xdd '0x00FD' U+00FD
+  {  4732,   8,  21,   9,    1,  -15 },   // 0xde '0x0163' U+0163
+  {  4753,   3,   3,   5,    1,  -17 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_SemiBold12pt8b PROGMEM = {
+  (uint8_t  *)InterTight_SemiBold12pt8bBitmaps,
+  (GFXglyph *)InterTight_SemiBold12pt8bGlyphs,
+  0x20, 0xDF, 29 };
+
+// Approx. 6106 bytes
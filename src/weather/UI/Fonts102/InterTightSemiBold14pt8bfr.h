@@ -0,0 +1,749 @@
+// Subset of ../InterTightSemiBold14pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_SemiBold14pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xF6, 0xE3,
+  0xF1, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0x07, 0x0E, 0x03, 0x87,
+  0x01, 0x83, 0x80, 0xC1, 0x80, 0xE1, 0xC3, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF,
+  0xFF, 0x0C, 0x1C, 0x06, 0x0C, 0x07, 0x0E, 0x03, 0x87, 0x0F, 0xFF, 0xF7,
+  0xFF, 0xFB, 0xFF, 0xF8, 0x30, 0x60, 0x38, 0x70, 0x1C, 0x38, 0x0E, 0x1C,
+  0x07, 0x0E, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x07, 0xF0, 0x1F,
+  0xFC, 0x3F, 0xFE, 0x7D, 0xBE, 0x79, 0x9F, 0x79, 0x8F, 0x79, 0x80, 0x7D,
+  0x80, 0x3F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x01, 0xFE, 0x01, 0x9F, 0x01,
+  0x8F, 0xF1, 0x8F, 0x79, 0x8F, 0x7D, 0xBE, 0x3F, 0xFE, 0x1F, 0xFC, 0x07,
+  0xF0, 0x01, 0x80, 0x01, 0x80, 0x3E, 0x01, 0x8F, 0xE0, 0x63, 0x8E, 0x1C,
+  0x71, 0xC3, 0x0E, 0x38, 0xC1, 0xC7, 0x38, 0x38, 0xEE, 0x03, 0xF9, 0x80,
+  0x3E, 0x70, 0x00, 0x1C, 0x00, 0x03, 0x00, 0x00, 0xE7, 0xC0, 0x39, 0xFC,
+  0x06, 0x71, 0xC1, 0xCE, 0x38, 0x71, 0xC7, 0x0C, 0x38, 0xE3, 0x87, 0x1C,
+  0xE0, 0x7F, 0x18, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x07,
+  0x9E, 0x03, 0x87, 0x01, 0xC3, 0x80, 0xE3, 0xC0, 0x3B, 0xC0, 0x1F, 0xC0,
+  0x07, 0xC0, 0x0F, 0xE0, 0x0F, 0xF8, 0xE7, 0x9E, 0x77, 0x87, 0x7B, 0xC3,
+  0xF9, 0xE0, 0xFC, 0xF8, 0x7C, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0xF8, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x1E, 0x38, 0xF1, 0xE3, 0x8F, 0x1E, 0x3C, 0xF1, 0xE3,
+  0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF0, 0xF1, 0xE3, 0xC3, 0xC7, 0x87, 0x8F,
+  0xE1, 0xE1, 0xE3, 0xC3, 0x87, 0x8F, 0x1E, 0x1E, 0x3C, 0x78, 0xF1, 0xE3,
+  0xC7, 0x8F, 0x1E, 0x78, 0xF1, 0xE7, 0x8F, 0x3C, 0x78, 0x0C, 0x03, 0x0C,
+  0xCF, 0xB7, 0x7F, 0x87, 0x87, 0xFB, 0xB7, 0xCC, 0xC3, 0x00, 0xC0, 0x07,
+  0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00,
+  0x7B, 0xDC, 0xE7, 0x73, 0x9C, 0xFF, 0xFF, 0xFF, 0xE0, 0x6F, 0xF6, 0x03,
+  0xC0, 0xE0, 0x38, 0x0E, 0x07, 0x01, 0xC0, 0x70, 0x3C, 0x0E, 0x03, 0x80,
+  0xE0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0xE0, 0x38, 0x0E, 0x07, 0x81, 0xC0,
+  0x70, 0x1C, 0x0E, 0x03, 0x80, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C,
+  0x3C, 0x78, 0x1E, 0x78, 0x1E, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0x78, 0x1E, 0x78,
+  0x1E, 0x7C, 0x3C, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x0F, 0x8F, 0xDF,
+  0xFF, 0xFE, 0x7E, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x0F, 0xC0, 0xFF, 0xC7,
+  0xFF, 0x9E, 0x1F, 0xF0, 0x3F, 0xC0, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x78,
+  0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80,
+  0x7C, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0x3F, 0xE0, 0xFF,
+  0xE3, 0xC3, 0xE7, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x07, 0xF0,
+  0x0F, 0x80, 0x1F, 0xE0, 0x03, 0xE0, 0x01, 0xE0, 0x03, 0xFC, 0x07, 0xF8,
+  0x0F, 0xF8, 0x3C, 0xFF, 0xF8, 0xFF, 0xE0, 0x7F, 0x00, 0x00, 0x7C, 0x00,
+  0xFC, 0x01, 0xFC, 0x01, 0xFC, 0x03, 0xFC, 0x07, 0xBC, 0x07, 0x3C, 0x0F,
+  0x3C, 0x1E, 0x3C, 0x1C, 0x3C, 0x3C, 0x3C, 0x38, 0x3C, 0x78, 0x3C, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+  0x3C, 0x3F, 0xF9, 0xFF, 0xE7, 0xFF, 0x9E, 0x00, 0x78, 0x01, 0xE0, 0x07,
+  0x00, 0x1C, 0xF0, 0x7F, 0xF1, 0xFF, 0xEF, 0x8F, 0x80, 0x1F, 0x00, 0x3C,
+  0x00, 0xFF, 0x03, 0xFC, 0x1F, 0xF8, 0x79, 0xFF, 0xE3, 0xFF, 0x03, 0xF0,
+  0x07, 0xE0, 0x3F, 0xF0, 0xFF, 0xF1, 0xE1, 0xE7, 0x83, 0xEF, 0x03, 0xFC,
+  0x00, 0x78, 0xF0, 0xF7, 0xF9, 0xFF, 0xFB, 0xF1, 0xF7, 0xC1, 0xFF, 0x81,
+  0xFE, 0x03, 0xFE, 0x07, 0xBC, 0x1F, 0x7C, 0x7C, 0x7F, 0xF8, 0x7F, 0xC0,
+  0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0x78, 0x01,
+  0xE0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07,
+  0x80, 0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0x0F,
+  0x00, 0x0F, 0xC0, 0x7F, 0xE1, 0xFF, 0xE7, 0xC3, 0xEF, 0x03, 0xDE, 0x07,
+  0xBC, 0x0F, 0x3C, 0x3C, 0x3F, 0xF0, 0x1F, 0xC0, 0xFF, 0xE3, 0xE3, 0xEF,
+  0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF8, 0x3C, 0xFF, 0xF8, 0xFF,
+  0xE0, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0xE1, 0xFF, 0xE3, 0xE3, 0xEF, 0x83,
+  0xDE, 0x07, 0xFC, 0x07, 0xF8, 0x1F, 0xF8, 0x3E, 0xF8, 0xFD, 0xFF, 0xF9,
+  0xFE, 0xF0, 0xF1, 0xE0, 0x03, 0xFC, 0x0F, 0x7C, 0x1E, 0x7C, 0x78, 0xFF,
+  0xF0, 0xFF, 0xC0, 0x7E, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xF6,
+  0x33, 0xDE, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x39, 0xCC, 0xE7, 0x38,
+  0x00, 0x0C, 0x01, 0xF0, 0x1F, 0xC1, 0xFE, 0x1F, 0xC1, 0xFC, 0x0F, 0x80,
+  0x3E, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x7C, 0x00,
+  0x70, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x1F,
+  0xC0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0F, 0xC0, 0x1F, 0x01, 0xFC, 0x3F, 0x83,
+  0xF8, 0x3F, 0x80, 0xF8, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFF,
+  0x1F, 0xFD, 0xF1, 0xFF, 0x07, 0xF8, 0x3C, 0x01, 0xE0, 0x1F, 0x01, 0xF0,
+  0x3E, 0x01, 0xE0, 0x1E, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x00, 0x78, 0x03, 0xC0, 0x0C, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xF0,
+  0x01, 0xFF, 0xFE, 0x03, 0xF0, 0x1F, 0x81, 0xE0, 0x01, 0xE1, 0xE0, 0x00,
+  0x79, 0xE0, 0x00, 0x1C, 0xE0, 0xFB, 0x8E, 0x70, 0xFF, 0xC3, 0xF8, 0xFF,
+  0xE1, 0xF8, 0x70, 0xF0, 0xFC, 0x70, 0x38, 0x7E, 0x38, 0x1C, 0x3F, 0x1C,
+  0x0E, 0x1F, 0x8E, 0x07, 0x0F, 0xC7, 0x03, 0x8F, 0xE3, 0xC3, 0xC7, 0x78,
+  0xFF, 0xFF, 0x9C, 0x3F, 0xBF, 0x8F, 0x0F, 0x8F, 0x03, 0xC0, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x7E, 0x03, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xE0,
+  0x00, 0x7F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x01,
+  0xFC, 0x00, 0x3B, 0x80, 0x0F, 0x78, 0x01, 0xEF, 0x00, 0x78, 0xF0, 0x0F,
+  0x1E, 0x01, 0xE3, 0xC0, 0x78, 0x3C, 0x0F, 0x07, 0x81, 0xFF, 0xF0, 0x7F,
+  0xFF, 0x0F, 0xFF, 0xE1, 0xC0, 0x1C, 0x78, 0x03, 0xCF, 0x00, 0x7B, 0xC0,
+  0x07, 0x78, 0x00, 0xF0, 0xFF, 0xE1, 0xFF, 0xE3, 0xFF, 0xE7, 0x83, 0xEF,
+  0x03, 0xDE, 0x07, 0xBC, 0x0F, 0x78, 0x3C, 0xFF, 0xF1, 0xFF, 0xC3, 0xFF,
+  0xE7, 0x81, 0xEF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x3F,
+  0xFF, 0xFB, 0xFF, 0xE7, 0xFF, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x81, 0xFF,
+  0xF0, 0xF8, 0x3E, 0x7C, 0x07, 0x9E, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3E,
+  0x00, 0xF7, 0x80, 0x3D, 0xF0, 0x1E, 0x3E, 0x0F, 0x87, 0xFF, 0xC0, 0xFF,
+  0xE0, 0x0F, 0xE0, 0xFF, 0xE0, 0x7F, 0xFC, 0x3F, 0xFF, 0x1E, 0x07, 0xCF,
+  0x01, 0xF7, 0x80, 0x7B, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03,
+  0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x3D, 0xE0,
+  0x3E, 0xF0, 0x3E, 0x7F, 0xFE, 0x3F, 0xFE, 0x1F, 0xFC, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0xFF, 0xBF,
+  0xFD, 0xFF, 0xEF, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0xF8,
+  0x7E, 0x7C, 0x07, 0x9E, 0x01, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0xF7,
+  0x80, 0x7D, 0xF0, 0x1E, 0x3E, 0x0F, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F,
+  0xE0, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F,
+  0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0,
+  0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E,
+  0x00, 0xF0, 0x07, 0x80, 0x3F, 0xC1, 0xFE, 0x0F, 0xF8, 0xFB, 0xFF, 0x8F,
+  0xF8, 0x3F, 0x80, 0xF0, 0x0F, 0x78, 0x0F, 0x3C, 0x0F, 0x1E, 0x0F, 0x8F,
+  0x0F, 0x87, 0x8F, 0x83, 0xC7, 0x81, 0xE7, 0x80, 0xF7, 0x80, 0x7F, 0xC0,
+  0x3F, 0xF0, 0x1F, 0xFC, 0x0F, 0x9E, 0x07, 0x87, 0x83, 0xC3, 0xE1, 0xE0,
+  0xF0, 0xF0, 0x3C, 0x78, 0x1F, 0x3C, 0x07, 0xDE, 0x01, 0xE0, 0xF0, 0x07,
+  0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0,
+  0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0xFF, 0xC0, 0x07,
+  0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xE0, 0xEF, 0xF7, 0x07, 0x7F, 0xB8, 0x7B, 0xFC, 0xE3, 0x9F,
+  0xE7, 0x1C, 0xFF, 0x3D, 0xE7, 0xF8, 0xEE, 0x3F, 0xC7, 0xF1, 0xFE, 0x1F,
+  0x0F, 0xF0, 0xF8, 0x7F, 0x87, 0xC3, 0xFC, 0x1C, 0x1F, 0xE0, 0xE0, 0xF0,
+  0xF0, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0xFF, 0xE0, 0x7F, 0xF0,
+  0x3F, 0xFC, 0x1F, 0xEF, 0x0F, 0xF7, 0x87, 0xF9, 0xE3, 0xFC, 0x79, 0xFE,
+  0x1E, 0xFF, 0x0F, 0x7F, 0x83, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xF0, 0x1F,
+  0xF8, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0xF0, 0x03, 0xF8, 0x01, 0xFF, 0xC0,
+  0x7F, 0xFC, 0x1F, 0x07, 0xC7, 0xC0, 0x7C, 0xF0, 0x07, 0xBE, 0x00, 0xFF,
+  0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF,
+  0x00, 0x1F, 0xF0, 0x07, 0xDE, 0x00, 0xF3, 0xE0, 0x3E, 0x3E, 0x0F, 0x83,
+  0xFF, 0xE0, 0x3F, 0xF8, 0x01, 0xFC, 0x00, 0xFF, 0xE1, 0xFF, 0xF3, 0xFF,
+  0xF7, 0x83, 0xEF, 0x03, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x3F,
+  0xE0, 0xFB, 0xFF, 0xF7, 0xFF, 0xCF, 0xFE, 0x1E, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x00, 0x03, 0xF8, 0x01,
+  0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0x07, 0xC7, 0xC0, 0x7C, 0xF0, 0x07, 0xBE,
+  0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8,
+  0x00, 0xFF, 0x00, 0x1F, 0xF1, 0xE7, 0xDE, 0x1E, 0xF3, 0xE1, 0xFE, 0x3E,
+  0x1F, 0x83, 0xFF, 0xE0, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0x80, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xFC, 0xF0, 0x7C, 0xF0, 0x3E,
+  0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3C, 0xFF, 0xFC,
+  0xFF, 0xF8, 0xFF, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0xF0, 0x3C,
+  0xF0, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE,
+  0x7C, 0x3E, 0x78, 0x1F, 0x78, 0x0F, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0xC0,
+  0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0x00, 0x0F, 0xF0, 0x0F,
+  0x78, 0x0F, 0x7C, 0x3E, 0x3F, 0xFE, 0x1F, 0xFC, 0x07, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0x7C, 0x3E,
+  0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0xF0, 0x01, 0xEF, 0x00, 0x79, 0xE0,
+  0x0F, 0x3C, 0x01, 0xE3, 0xC0, 0x78, 0x78, 0x0F, 0x0F, 0x01, 0xE0, 0xF0,
+  0x78, 0x1E, 0x0F, 0x01, 0xC1, 0xC0, 0x3C, 0x78, 0x07, 0x8F, 0x00, 0x71,
+  0xC0, 0x0F, 0x78, 0x01, 0xEF, 0x00, 0x1D, 0xC0, 0x03, 0xF8, 0x00, 0x7F,
+  0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF0, 0x1E, 0x01, 0xFE, 0x03, 0xE0,
+  0x79, 0xE0, 0x7C, 0x0F, 0x3C, 0x0F, 0x81, 0xE7, 0x83, 0xF0, 0x3C, 0x70,
+  0x7F, 0x0F, 0x0F, 0x0E, 0xE1, 0xE1, 0xE1, 0xDC, 0x3C, 0x3C, 0x7B, 0x87,
+  0x03, 0x8E, 0x38, 0xE0, 0x79, 0xC7, 0x3C, 0x0F, 0x38, 0xE7, 0x80, 0xEE,
+  0x1C, 0xE0, 0x1D, 0xC1, 0xDC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x07, 0xE0,
+  0x07, 0xC0, 0x7C, 0x00, 0xF8, 0x0F, 0x80, 0x1F, 0x01, 0xF0, 0x01, 0xC0,
+  0x3C, 0x00, 0x78, 0x07, 0x9E, 0x01, 0xE3, 0xC0, 0xF0, 0x78, 0x7C, 0x1E,
+  0x1E, 0x03, 0xCF, 0x00, 0xF3, 0xC0, 0x1F, 0xE0, 0x03, 0xF0, 0x00, 0xFC,
+  0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xF8, 0x03, 0xCF, 0x00, 0xF3, 0xC0,
+  0x78, 0x78, 0x3E, 0x1F, 0x0F, 0x03, 0xC7, 0x80, 0x79, 0xE0, 0x1E, 0xF0,
+  0x03, 0xDE, 0x01, 0xE7, 0x80, 0x78, 0xF0, 0x3C, 0x3C, 0x0F, 0x07, 0x87,
+  0x81, 0xF3, 0xE0, 0x3C, 0xF0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0x00,
+  0x0F, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01,
+  0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x1E, 0x00, 0x78, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFC, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xCF, 0xFF, 0xFC, 0xE0, 0x38, 0x0F, 0x01, 0xC0, 0x70, 0x1C,
+  0x03, 0x80, 0xE0, 0x38, 0x0F, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x80, 0xE0,
+  0x38, 0x0E, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x80, 0xE0, 0x38, 0x0E, 0xFF,
+  0xFF, 0xF8, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7,
+  0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xFF, 0xFF, 0xFE, 0x0E, 0x03, 0xE0,
+  0x7C, 0x1D, 0xC3, 0xB8, 0xE3, 0x9C, 0x77, 0x07, 0xE0, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x71, 0xC3, 0x86, 0x0F, 0xC1, 0xFF, 0x9F, 0xFC, 0xF1,
+  0xF1, 0x07, 0x80, 0x3C, 0x1F, 0xE7, 0xFF, 0x7C, 0x7F, 0x83, 0xFC, 0x1F,
+  0xF1, 0xFF, 0xFF, 0xBF, 0xBC, 0xF9, 0xE0, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xCF, 0x8F, 0x7F, 0x3F, 0xFE, 0xF8, 0x7B, 0xE1,
+  0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFE, 0x1F, 0xF8,
+  0x7B, 0xFF, 0xEF, 0x7F, 0x3C, 0xF0, 0x0F, 0xC0, 0x7F, 0xC3, 0xFF, 0x9F,
+  0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x83, 0xDF, 0x1F, 0x3F, 0xF8, 0x7F, 0xC0, 0xFC, 0x00, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x3C, 0xF3, 0xFB, 0xDF, 0xFF, 0x78,
+  0x7F, 0xE1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFE,
+  0x1F, 0x78, 0x7D, 0xFF, 0xF3, 0xFB, 0xC7, 0xCF, 0x0F, 0xC0, 0x7F, 0xC3,
+  0xFF, 0x1E, 0x1E, 0xF0, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x0F, 0x80, 0x1F, 0x0F, 0x3F, 0xF8, 0x7F, 0xC0, 0xFC, 0x00, 0x0F,
+  0x8F, 0xCF, 0xE7, 0x83, 0xC1, 0xE3, 0xFF, 0xFF, 0xFF, 0x9E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC0, 0x0F,
+  0x3C, 0xFE, 0xF7, 0xFF, 0xDF, 0x1F, 0xF8, 0x7F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xDE, 0x1F, 0x7F, 0xFC, 0xFE, 0xF1,
+  0xF3, 0xC0, 0x0F, 0x10, 0x3D, 0xE1, 0xF7, 0xFF, 0x8F, 0xFC, 0x0F, 0xC0,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xCF, 0x8F, 0x7F,
+  0xBF, 0xFE, 0xF8, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
+  0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0x6F,
+  0xF6, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x18, 0xF3,
+  0xC6, 0x00, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xFF, 0xFB, 0xC0, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC1, 0xEF, 0x0F, 0x3C, 0x7C, 0xF3, 0xE3, 0xCF, 0x0F,
+  0x78, 0x3F, 0xC0, 0xFF, 0x83, 0xFE, 0x0F, 0x3C, 0x3C, 0x78, 0xF1, 0xF3,
+  0xC3, 0xCF, 0x07, 0xBC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF3, 0xE1, 0xF3, 0xDF, 0xDF, 0xEF, 0xFF, 0x7F, 0xFE,
+  0x3F, 0x1F, 0xF0, 0x78, 0x3F, 0xC1, 0xE0, 0xFF, 0x07, 0x83, 0xFC, 0x1E,
+  0x0F, 0xF0, 0x78, 0x3F, 0xC1, 0xE0, 0xFF, 0x07, 0x83, 0xFC, 0x1E, 0x0F,
+  0xF0, 0x78, 0x3F, 0xC1, 0xE0, 0xFF, 0x07, 0x83, 0xC0, 0xF3, 0xE7, 0xBF,
+  0xBF, 0xFD, 0xF1, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
+  0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xE0, 0x0F, 0xE0,
+  0x3F, 0xE0, 0xFF, 0xE3, 0xE3, 0xEF, 0x83, 0xFE, 0x03, 0xFC, 0x07, 0xF8,
+  0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0xF3, 0xE3, 0xE3, 0xFF, 0x83, 0xFE,
+  0x03, 0xF0, 0x00, 0xF3, 0xE3, 0xDF, 0xCF, 0xFF, 0xBE, 0x1E, 0xF8, 0x7F,
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xFE, 0x1E,
+  0xFF, 0xFB, 0xDF, 0xCF, 0x3E, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x00, 0x0F, 0x3C, 0xFE, 0xF7, 0xFF, 0xDE, 0x1F, 0xF8,
+  0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xDE,
+  0x1F, 0x7F, 0xFC, 0xFE, 0xF1, 0xF3, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0xF3, 0xFB, 0xFF, 0xFF, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC0, 0x1F, 0x83,
+  0xFF, 0x3F, 0xFD, 0xF1, 0xEF, 0x06, 0x78, 0x01, 0xFC, 0x07, 0xFC, 0x03,
+  0xF0, 0x03, 0xFC, 0x1F, 0xE1, 0xFF, 0xFF, 0x3F, 0xF0, 0x7F, 0x00, 0x3C,
+  0x1E, 0x0F, 0x07, 0x8F, 0xFF, 0xFF, 0xFE, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3F, 0x0F, 0xC3, 0xE0, 0xF0, 0x7F, 0x83,
+  0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
+  0x83, 0xFC, 0x1F, 0xF1, 0xF7, 0xFF, 0xBF, 0xBC, 0xF9, 0xE0, 0xF0, 0x1E,
+  0xE0, 0x39, 0xE0, 0xF3, 0xC1, 0xE3, 0x83, 0x87, 0x8F, 0x0F, 0x1C, 0x0E,
+  0x38, 0x1E, 0xF0, 0x3D, 0xC0, 0x3B, 0x80, 0x7F, 0x00, 0x7C, 0x00, 0xF8,
+  0x01, 0xF0, 0x00, 0xF0, 0x78, 0x3D, 0xC1, 0xE0, 0xF7, 0x07, 0x83, 0x9E,
+  0x3F, 0x1E, 0x78, 0xFC, 0x78, 0xE3, 0xF1, 0xC3, 0x8E, 0xE7, 0x0F, 0x73,
+  0xBC, 0x1D, 0xCE, 0xF0, 0x77, 0x3B, 0x81, 0xD8, 0x7E, 0x07, 0xE1, 0xF8,
+  0x0F, 0x87, 0xC0, 0x3E, 0x0F, 0x00, 0xF0, 0x3C, 0x00, 0x70, 0x3D, 0xE1,
+  0xE3, 0xC7, 0x87, 0x3C, 0x1E, 0xE0, 0x3F, 0x80, 0xFC, 0x01, 0xF0, 0x0F,
+  0xC0, 0x3F, 0x81, 0xEE, 0x0F, 0x3C, 0x3C, 0x79, 0xE0, 0xE7, 0x03, 0xC0,
+  0xF0, 0x1E, 0xE0, 0x39, 0xE0, 0xF3, 0xC1, 0xE3, 0x83, 0x87, 0x8F, 0x0F,
+  0x1C, 0x0E, 0x38, 0x1C, 0xF0, 0x3D, 0xC0, 0x3B, 0x80, 0x7F, 0x00, 0xFC,
+  0x00, 0xF8, 0x01, 0xF0, 0x01, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0xFC, 0x01,
+  0xF0, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x03, 0xC0,
+  0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x03, 0x87, 0xC7, 0xE3, 0xE1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x0F, 0x9F, 0x8F, 0x07, 0xE0, 0xF8, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF8, 0x7E, 0x1F, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0x7E, 0x3F, 0x07, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
+  0x07, 0xC1, 0xF0, 0x78, 0x7C, 0x7C, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1,
+  0xE1, 0xF3, 0xF1, 0xF8, 0xF0, 0x00, 0x3C, 0x01, 0xF8, 0x7F, 0xF3, 0xFC,
+  0xFF, 0xE1, 0xF8, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0F,
+  0xE0, 0x01, 0xFC, 0x00, 0x3B, 0x80, 0x0F, 0x78, 0x01, 0xEF, 0x00, 0x78,
+  0xE0, 0x0F, 0x1E, 0x01, 0xE3, 0xC0, 0x78, 0x38, 0x0F, 0x07, 0x81, 0xFF,
+  0xF0, 0x7F, 0xFE, 0x0F, 0xFF, 0xE1, 0xC0, 0x1C, 0x78, 0x03, 0x8F, 0x00,
+  0x7B, 0xC0, 0x07, 0x78, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x00,
+  0xE0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0xE3, 0xF1, 0xDF, 0xC7,
+  0xC0, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80,
+  0x0F, 0x00, 0x1E, 0x40, 0x3F, 0x80, 0xFE, 0x03, 0xF0, 0x05, 0xE0, 0x03,
+  0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x7F, 0xFC, 0xFF,
+  0xF9, 0xFF, 0xF0, 0x47, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x3E, 0x70,
+  0x0E, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xE0, 0x06, 0x70, 0x0E, 0x7C, 0x1E, 0xFF, 0xFF, 0xDF, 0xFB, 0x07,
+  0xE0, 0x01, 0xC7, 0x8E, 0x3C, 0x61, 0xE3, 0x0F, 0x18, 0x78, 0x03, 0xC0,
+  0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+  0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0xF0, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE, 0x7C, 0x3E, 0x78, 0x1F, 0x78, 0x0F,
+  0x78, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFE,
+  0x00, 0x1F, 0x00, 0x0F, 0xF0, 0x0F, 0x78, 0x0F, 0x7C, 0x3E, 0x3F, 0xFE,
+  0x1F, 0xFC, 0x07, 0xF0, 0x0F, 0x81, 0xFF, 0x0F, 0xF8, 0xF3, 0xE7, 0x0F,
+  0x38, 0x01, 0xF0, 0x07, 0xE0, 0x3F, 0xC7, 0xBF, 0x38, 0x7D, 0xC0, 0xFF,
+  0x03, 0xBE, 0x1D, 0xFD, 0xE3, 0xFC, 0x07, 0xE0, 0x0F, 0x80, 0x3C, 0xE1,
+  0xE7, 0x8F, 0x1F, 0xF8, 0xFF, 0x81, 0xF0, 0x61, 0xBC, 0xF6, 0x18, 0x0E,
+  0x38, 0x0E, 0x70, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF0, 0x1F, 0xFC, 0x3F, 0xFE, 0x7C, 0x1E, 0x78, 0x0F, 0x78, 0x00, 0x78,
+  0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFE, 0x00,
+  0x1F, 0x00, 0x0F, 0x70, 0x0F, 0x78, 0x0F, 0x7C, 0x3E, 0x3F, 0xFE, 0x1F,
+  0xFC, 0x07, 0xF0, 0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFE, 0x7C, 0x3E, 0x78,
+  0x1F, 0x78, 0x0F, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x07,
+  0xFC, 0x00, 0xFE, 0x00, 0x1F, 0x00, 0x0F, 0xF0, 0x0F, 0x78, 0x0F, 0x7C,
+  0x3E, 0x3F, 0xFE, 0x1F, 0xFC, 0x07, 0xF0, 0x01, 0x80, 0x01, 0xE0, 0x00,
+  0x60, 0x00, 0x60, 0x01, 0xC0, 0x1C, 0x38, 0x0E, 0x70, 0x07, 0xE0, 0x03,
+  0xC0, 0x03, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0xE0, 0x03,
+  0x80, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x78, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x07, 0x80, 0x1E, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x1C, 0x70, 0x1D, 0xE0, 0x3B, 0x80, 0x3E, 0x00, 0x38, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x01, 0xE0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x1E, 0x00, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x01, 0xE0,
+  0x07, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x00, 0x1E, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0x1F, 0xE7, 0xFB, 0xCF, 0xE1, 0xF8, 0x7F,
+  0x3D, 0xFE, 0x7F, 0x87, 0x80, 0x0F, 0xC1, 0xFF, 0x9F, 0xFC, 0xF1, 0xF1,
+  0x07, 0x80, 0x3C, 0x1F, 0xE7, 0xFF, 0x7C, 0x7F, 0x83, 0xFC, 0x1F, 0xF1,
+  0xFF, 0xFF, 0xBF, 0xBC, 0xF9, 0xE0, 0x1E, 0x00, 0xE0, 0x07, 0x00, 0x3E,
+  0x01, 0xF0, 0x07, 0x80, 0x7B, 0xB9, 0xCF, 0xBD, 0xE0, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3F, 0x7E, 0xFC, 0xBC, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B, 0x9D, 0xC0, 0x07, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x7E, 0x0F, 0xFC, 0xFF, 0xF7, 0xC7, 0xBC, 0x19, 0xE0,
+  0x07, 0xF0, 0x1F, 0xF0, 0x0F, 0xC0, 0x0F, 0xF0, 0x7F, 0x87, 0xFF, 0xFC,
+  0xFF, 0xC1, 0xFC, 0x00, 0xE1, 0xFC, 0xE7, 0x70, 0xF8, 0x1E, 0x00, 0x63,
+  0x8E, 0x31, 0xF0, 0x38, 0xE0, 0xEE, 0x03, 0xE0, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x7E, 0x0F, 0xFC, 0xFF, 0xF7, 0xC7, 0xBC, 0x19, 0xE0, 0x07, 0xF0,
+  0x1F, 0xF0, 0x0F, 0xC0, 0x0F, 0xF0, 0x7F, 0x87, 0xFF, 0xFC, 0xFF, 0xC1,
+  0xFC, 0x00, 0x1F, 0x83, 0xFF, 0x3F, 0xFD, 0xF1, 0xEF, 0x04, 0x78, 0x01,
+  0xFC, 0x07, 0xFC, 0x03, 0xF0, 0x03, 0xFC, 0x1F, 0xE1, 0xFF, 0xFF, 0x3F,
+  0xF0, 0x7F, 0x00, 0xC0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x01,
+  0xC0, 0x70, 0x1C, 0xF7, 0x3D, 0xCF, 0x03, 0xC3, 0xFE, 0xFF, 0xBF, 0xE3,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xFC,
+  0x1F, 0x83, 0xE0, 0x03, 0xC0, 0x38, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF0,
+  0x1E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1C,
+  0xE7, 0x39, 0xCE, 0x33, 0x80, 0x70, 0xE3, 0x9C, 0x1F, 0x80, 0xF0, 0x06,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07,
+  0x80, 0xF0, 0x1E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x06, 0x00, 0xF0, 0x0F, 0x00, 0x60, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x01,
+  0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xE0, 0x01,
+  0xC0, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF,
+  0xF8, 0xFF, 0xFC, 0xF0, 0x7C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
+  0x1E, 0xF0, 0x1E, 0xF0, 0x3C, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xE0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x1E, 0xF0,
+  0x1E, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03, 0xF8, 0x00, 0x7F,
+  0x00, 0x0E, 0xE0, 0x03, 0xDE, 0x00, 0x7B, 0xC0, 0x1E, 0x3C, 0x03, 0xC7,
+  0x80, 0x78, 0xF0, 0x1E, 0x0F, 0x03, 0xC1, 0xE0, 0x7F, 0xFC, 0x1F, 0xFF,
+  0xC3, 0xFF, 0xF8, 0x70, 0x07, 0x1E, 0x00, 0xF3, 0xC0, 0x1E, 0xF0, 0x01,
+  0xDE, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x3E, 0x00, 0x0E, 0xE0, 0x03, 0x8E,
+  0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03, 0xF8,
+  0x00, 0x7F, 0x00, 0x0E, 0xE0, 0x03, 0xDE, 0x00, 0x7B, 0xC0, 0x1E, 0x3C,
+  0x03, 0xC7, 0x80, 0x78, 0xF0, 0x1E, 0x0F, 0x03, 0xC1, 0xE0, 0x7F, 0xFC,
+  0x1F, 0xFF, 0xC3, 0xFF, 0xF8, 0x70, 0x07, 0x1E, 0x00, 0xF3, 0xC0, 0x1E,
+  0xF0, 0x01, 0xDE, 0x00, 0x3C, 0x07, 0x1C, 0x00, 0xE3, 0x80, 0x1E, 0xF0,
+  0x01, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x7F, 0x00, 0x0E, 0xE0, 0x01, 0xDC, 0x00, 0x7B, 0xC0,
+  0x0E, 0x38, 0x03, 0xC7, 0x80, 0x78, 0xF0, 0x0E, 0x0E, 0x03, 0xC1, 0xE0,
+  0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xF8, 0x70, 0x07, 0x1E, 0x00, 0xF3,
+  0xC0, 0x1E, 0x70, 0x01, 0xDE, 0x00, 0x3C, 0x06, 0x18, 0x01, 0xE7, 0x80,
+  0x18, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x00,
+  0x1F, 0x80, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x1E, 0xE0, 0x03, 0x9E, 0x00,
+  0xF3, 0xC0, 0x1E, 0x3C, 0x03, 0x87, 0x80, 0xF0, 0x70, 0x1E, 0x0F, 0x03,
+  0xFF, 0xE0, 0xFF, 0xFE, 0x1F, 0xFF, 0xC7, 0x80, 0x78, 0xF0, 0x07, 0x9E,
+  0x00, 0xF7, 0x80, 0x0E, 0xF0, 0x01, 0xE0, 0x3C, 0x01, 0xC0, 0x1C, 0x00,
+  0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xF8, 0x1F, 0xFF, 0x0F, 0x83,
+  0xE7, 0xC0, 0x79, 0xE0, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x0F, 0x78,
+  0x03, 0xDF, 0x01, 0xE3, 0xE0, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE, 0x00, 0xFE,
+  0x00, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0xF8, 0x3C, 0x7C, 0x07,
+  0x9E, 0x01, 0xEF, 0x80, 0x3B, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0xE7, 0x80, 0x39, 0xF0,
+  0x1E, 0x3E, 0x0F, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00,
+  0x07, 0x1C, 0x00, 0xEE, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x80, 0x3F, 0xF8, 0x1F, 0xFF, 0x0F, 0x83, 0xE7, 0xC0,
+  0x3D, 0xE0, 0x0F, 0xF8, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x0F, 0x78, 0x03, 0xDF,
+  0x01, 0xE3, 0xE0, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x01,
+  0xC0, 0x0E, 0x00, 0xE0, 0x06, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x07, 0x00, 0x70, 0x03, 0x80, 0x1F, 0x00, 0xF8, 0x03,
+  0xC0, 0x18, 0xC1, 0xEF, 0x06, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0xF0, 0xE7, 0x03, 0xF0, 0x0F,
+  0x00, 0x70, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3C, 0x01,
+  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x3C, 0xE7, 0x1C, 0x00, 0x0F, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xC0, 0x1E, 0x0F, 0xC7,
+  0xFB, 0xCE, 0xE1, 0xC0, 0x01, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+  0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07,
+  0x81, 0xE0, 0x78, 0x1E, 0x07, 0x80, 0x38, 0xE0, 0x0E, 0xE0, 0x07, 0x60,
+  0x01, 0xF0, 0x00, 0x70, 0x00, 0x00, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0xFF,
+  0xFC, 0x78, 0x1F, 0x3C, 0x07, 0xDE, 0x01, 0xEF, 0x00, 0xFF, 0x80, 0x3F,
+  0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x01,
+  0xFF, 0x00, 0xF7, 0x80, 0xFB, 0xC0, 0xF9, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F,
+  0xF0, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x81, 0xE0, 0x7C,
+  0x1E, 0x03, 0xE1, 0xE0, 0x1E, 0x1E, 0x01, 0xF1, 0xE0, 0x0F, 0x1E, 0x00,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xF1, 0xE0, 0x0F, 0x1E, 0x00, 0xF1, 0xE0,
+  0x1F, 0x1E, 0x01, 0xE1, 0xE0, 0x3E, 0x1E, 0x07, 0xC1, 0xFF, 0xF8, 0x1F,
+  0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFE,
+  0x03, 0xFF, 0x81, 0xFF, 0xC0, 0xFF, 0xF0, 0x7F, 0xBC, 0x3F, 0xDE, 0x1F,
+  0xE7, 0x8F, 0xF1, 0xE7, 0xF8, 0x7B, 0xFC, 0x3D, 0xFE, 0x0F, 0xFF, 0x03,
+  0xFF, 0x81, 0xFF, 0xC0, 0x7F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xC0,
+  0x0E, 0x38, 0x03, 0xB8, 0x01, 0xDC, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x00,
+  0x03, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFE, 0x03, 0xFF, 0x81, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x7F, 0xBC, 0x3F, 0xDE, 0x1F, 0xE7, 0x8F, 0xF1, 0xE7,
+  0xF8, 0x7B, 0xFC, 0x3D, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0x81, 0xFF, 0xC0,
+  0x7F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x0E,
+  0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+  0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x07, 0xC1, 0xF1, 0xF0, 0x1F, 0x3C, 0x01,
+  0xEF, 0x80, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
+  0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x01, 0xF7, 0x80, 0x3C, 0xF8, 0x0F,
+  0x8F, 0x83, 0xE0, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0xE0,
+  0x00, 0x3E, 0x00, 0x0E, 0xE0, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x07, 0xC1, 0xF1, 0xF0, 0x1F,
+  0x3C, 0x01, 0xEF, 0x80, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F,
+  0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x01, 0xF7, 0x80, 0x3C,
+  0xF8, 0x0F, 0x8F, 0x83, 0xE0, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 0x7F, 0x00,
+  0x00, 0xE7, 0x00, 0x39, 0xC0, 0x0E, 0x70, 0x01, 0x8C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x07, 0xC1, 0xF1,
+  0xF0, 0x1F, 0x3C, 0x01, 0xEF, 0x80, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x7F,
+  0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x01, 0xF7,
+  0x80, 0x3C, 0xF8, 0x0F, 0x8F, 0x83, 0xE0, 0xFF, 0xF8, 0x0F, 0xFE, 0x00,
+  0x7F, 0x00, 0x06, 0x18, 0x01, 0xE7, 0x80, 0x18, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xF8, 0x3E, 0x0F, 0x8F,
+  0x80, 0xF9, 0xE0, 0x0F, 0x7C, 0x01, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC,
+  0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xBC,
+  0x01, 0xE7, 0xC0, 0x7C, 0x7C, 0x1F, 0x07, 0xFF, 0xC0, 0x7F, 0xF0, 0x03,
+  0xF8, 0x00, 0x00, 0x01, 0x80, 0xCF, 0x07, 0x9E, 0x3E, 0x3D, 0xF0, 0x7F,
+  0x80, 0xFC, 0x03, 0xE0, 0x1F, 0xC0, 0xFF, 0x87, 0xCF, 0x3E, 0x1E, 0x70,
+  0x38, 0x80, 0x40, 0x3C, 0x70, 0x1C, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x03,
+  0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xFC, 0xF0, 0x7C, 0xF0,
+  0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3C, 0xFF,
+  0xFC, 0xFF, 0xF8, 0xFF, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0xF0,
+  0x3C, 0xF0, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x03, 0xC0, 0x06, 0x60, 0x06,
+  0x60, 0x06, 0x60, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0x7C, 0x3E, 0x3F,
+  0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x03, 0x9C, 0x03, 0x38, 0x07, 0x30, 0x06,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8,
+  0x1F, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x0C, 0x30, 0x1E,
+  0x78, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07,
+  0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x3D, 0xE0, 0x1E, 0x78, 0x07, 0x8F, 0x03, 0xC3,
+  0xC0, 0xF0, 0x78, 0x78, 0x1F, 0x3E, 0x03, 0xCF, 0x00, 0x7F, 0x80, 0x1F,
+  0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0,
+  0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x60,
+  0x00, 0xC0, 0x03, 0x80, 0x1F, 0x80, 0x7F, 0xC1, 0xFF, 0xC7, 0xC7, 0xCF,
+  0x07, 0x9E, 0x0F, 0x3C, 0x1E, 0x78, 0x3C, 0xF0, 0xF1, 0xE7, 0xC3, 0xCF,
+  0xC7, 0x9F, 0xEF, 0x03, 0xDE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x3F,
+  0xE7, 0xFB, 0xCF, 0xE7, 0x9F, 0x80, 0x07, 0x07, 0x03, 0x83, 0x80, 0x00,
+  0x03, 0xCF, 0xEF, 0xFF, 0xFC, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x00, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xFE, 0x7F, 0xF3, 0xC7, 0xC4, 0x1E,
+  0x00, 0xF0, 0x7F, 0x9F, 0xFD, 0xF1, 0xFE, 0x0F, 0xF0, 0x7F, 0xC7, 0xFF,
+  0xFE, 0xFE, 0xF3, 0xE7, 0x80, 0x07, 0x80, 0x7E, 0x07, 0x38, 0x39, 0xE0,
+  0x00, 0x00, 0x00, 0x3F, 0x07, 0xFE, 0x7F, 0xF3, 0xC7, 0xC4, 0x1E, 0x00,
+  0xF0, 0x7F, 0x9F, 0xFD, 0xF1, 0xFE, 0x0F, 0xF0, 0x7F, 0xC7, 0xFF, 0xFE,
+  0xFE, 0xF3, 0xE7, 0x80, 0x38, 0x71, 0xC3, 0x87, 0xF8, 0x1F, 0x80, 0x00,
+  0x00, 0x00, 0x3F, 0x07, 0xFE, 0x7F, 0xF3, 0xC7, 0xC4, 0x1E, 0x00, 0xF0,
+  0x7F, 0x9F, 0xFD, 0xF1, 0xFE, 0x0F, 0xF0, 0x7F, 0xC7, 0xFF, 0xFE, 0xFE,
+  0xF3, 0xE7, 0x80, 0x18, 0x61, 0xE7, 0x86, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x07, 0xFE, 0x7F, 0xF3, 0xC7, 0xC4, 0x1E, 0x00, 0xF0, 0x7F,
+  0x9F, 0xFD, 0xF1, 0xFE, 0x0F, 0xF0, 0x7F, 0xC7, 0xFF, 0xFE, 0xFE, 0xF3,
+  0xE7, 0x80, 0x3C, 0xE7, 0x1C, 0x00, 0x0F, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xC0, 0x00, 0xE0,
+  0x07, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xFC,
+  0x3F, 0xF9, 0xF1, 0xFF, 0x83, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF8, 0x3D, 0xF1, 0xF3, 0xFF, 0x87, 0xFC, 0x0F, 0xC0, 0x0F,
+  0xC0, 0xFF, 0x8F, 0xFE, 0xF8, 0xFF, 0x83, 0xF8, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0x80, 0x3E, 0x0E, 0xF8, 0xF3, 0xFF, 0x9F, 0xF8, 0x3F, 0x00,
+  0x60, 0x03, 0xC0, 0x06, 0x00, 0x30, 0x06, 0x00, 0x1C, 0x70, 0x3B, 0xC0,
+  0xFE, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xFC, 0x3F, 0xF9,
+  0xF0, 0xFF, 0x83, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF8, 0x3D, 0xF1, 0xF3, 0xFF, 0x87, 0xFC, 0x0F, 0xC0, 0x01, 0xC0, 0x07,
+  0x00, 0x38, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xFC, 0x3F,
+  0xF1, 0xE1, 0xEF, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF8, 0x01, 0xF0, 0xF3, 0xFF, 0x87, 0xFC, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x7F, 0xC3, 0xFF, 0x1E, 0x1E, 0xF0, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x0F, 0x80, 0x1F, 0x0F, 0x3F, 0xF8, 0x7F, 0xC0, 0xFC,
+  0x01, 0xC0, 0x07, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xF0, 0x18, 0x60, 0xF3,
+  0xC1, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xFC, 0x3F,
+  0xF1, 0xE1, 0xEF, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF8, 0x01, 0xF0, 0xF3, 0xFF, 0x87, 0xFC, 0x0F, 0xC0, 0x1C, 0xE0,
+  0x33, 0x80, 0xFC, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xFC,
+  0x3F, 0xF1, 0xE1, 0xEF, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF8, 0x01, 0xF0, 0xF3, 0xFF, 0x87, 0xFC, 0x0F, 0xC0, 0x3C,
+  0xE7, 0x1C, 0x00, 0x0F, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0xF0, 0x1E, 0x0F, 0xC7, 0xFB, 0xCE, 0xE1, 0xC0, 0x01, 0xE0,
+  0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E,
+  0x07, 0x81, 0xE0, 0x78, 0x1E, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x9C, 0x00,
+  0xF3, 0x80, 0x1E, 0x60, 0x03, 0xCC, 0x00, 0x78, 0x03, 0xCF, 0x01, 0xFD,
+  0xE0, 0x7F, 0xFC, 0x0F, 0x0F, 0x83, 0xE1, 0xF0, 0x78, 0x1E, 0x0F, 0x03,
+  0xC1, 0xE0, 0x78, 0x3C, 0x0F, 0x07, 0x81, 0xE0, 0xF8, 0x7C, 0x0F, 0x0F,
+  0x81, 0xFF, 0xF0, 0x1F, 0xDE, 0x01, 0xF3, 0xC0, 0x00, 0x3C, 0x00, 0x3C,
+  0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3C, 0x0F, 0x3C, 0x3F, 0xBC, 0x7F, 0xFC,
+  0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C,
+  0xF0, 0x3C, 0xF8, 0x7C, 0x78, 0x7C, 0x7F, 0xFC, 0x3F, 0xBC, 0x1F, 0x3C,
+  0x01, 0xC0, 0x1C, 0x00, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x03, 0xCF, 0x9E,
+  0xFE, 0xFF, 0xF7, 0xC7, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
+  0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0x80, 0x38,
+  0xE0, 0xEE, 0x03, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xCF, 0x9E, 0xFE,
+  0xFF, 0xF7, 0xC7, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
+  0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0x80, 0x00, 0xE0,
+  0x03, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F,
+  0xF8, 0x3F, 0xF8, 0xF8, 0xFB, 0xE0, 0xFF, 0x80, 0xFF, 0x01, 0xFE, 0x03,
+  0xFC, 0x07, 0xF8, 0x0F, 0xF8, 0x3C, 0xF8, 0xF8, 0xFF, 0xE0, 0xFF, 0x80,
+  0xFC, 0x00, 0x03, 0x80, 0x0F, 0x80, 0x3B, 0x80, 0xE3, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x3F, 0xF8, 0xF8, 0xFB, 0xE0, 0xFF, 0x80,
+  0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF8, 0x3C, 0xF8, 0xF8,
+  0xFF, 0xE0, 0xFF, 0x80, 0xFC, 0x00, 0x03, 0x9C, 0x0E, 0x70, 0x39, 0xC0,
+  0x63, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x3F, 0xF8, 0xF8,
+  0xFB, 0xE0, 0xFF, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F,
+  0xF8, 0x3C, 0xF8, 0xF8, 0xFF, 0xE0, 0xFF, 0x80, 0xFC, 0x00, 0x18, 0x60,
+  0x79, 0xE0, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F,
+  0xF8, 0x3F, 0xF8, 0xF8, 0xFB, 0xE0, 0xFF, 0x80, 0xFF, 0x01, 0xFE, 0x03,
+  0xFC, 0x07, 0xF8, 0x0F, 0xF8, 0x3C, 0xF8, 0xF8, 0xFF, 0xE0, 0xFF, 0x80,
+  0xFC, 0x00, 0x03, 0x00, 0x3C, 0x01, 0xE0, 0x06, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x78, 0x03,
+  0xC0, 0x0C, 0x00, 0x71, 0xDE, 0xE3, 0xF0, 0x7C, 0x0E, 0x00, 0x07, 0x9D,
+  0xEF, 0x7F, 0xDF, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+  0x1E, 0x07, 0x81, 0xE0, 0x78, 0x00, 0x07, 0x00, 0xEE, 0x06, 0x30, 0x31,
+  0x81, 0xDC, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x83, 0xFC, 0x1F,
+  0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
+  0x1F, 0xF1, 0xF7, 0xFF, 0xBF, 0xBC, 0xF9, 0xE0, 0x01, 0xC0, 0x1C, 0x00,
+  0xC0, 0x06, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83,
+  0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
+  0xC7, 0xDF, 0xFE, 0xFE, 0xF3, 0xE7, 0x80, 0x07, 0x78, 0x73, 0x83, 0x38,
+  0x3B, 0x80, 0x00, 0x78, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
+  0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF8, 0xFB, 0xFF,
+  0xDF, 0xDE, 0x7C, 0xF0, 0x18, 0xC1, 0xEF, 0x06, 0x30, 0x00, 0x00, 0x00,
+  0x78, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF,
+  0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF8, 0xFB, 0xFF, 0xDF, 0xDE, 0x7C,
+  0xF0, 0x00, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x03,
+  0xDC, 0x07, 0x3C, 0x1E, 0x78, 0x3C, 0x70, 0x70, 0xF1, 0xE1, 0xE3, 0x81,
+  0xC7, 0x03, 0x9E, 0x07, 0xB8, 0x07, 0x70, 0x0F, 0xE0, 0x1F, 0x80, 0x1F,
+  0x00, 0x3E, 0x00, 0x38, 0x00, 0xF0, 0x01, 0xE0, 0x1F, 0x80, 0x3E, 0x00,
+  0xF8, 0x00, 0x3C, 0x1E, 0x0F, 0x07, 0x8F, 0xF7, 0xFB, 0xFC, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x7C, 0x3F, 0x0F, 0x83, 0xC0,
+  0xC0, 0x78, 0x0C, 0x06, 0x03, 0x06, 0x00, 0x6F, 0xF6 };
+
+const GFXglyph InterTight_SemiBold14pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   4,  20,   8,    2,  -19 },   // 0x21 '!' U+0021
+  {    11,   9,   8,  13,    2,  -19 },   // 0x22 '"' U+0022
+  {    20,  17,  20,  17,    0,  -19 },   // 0x23 '#' U+0023
+  {    63,  16,  25,  17,    0,  -22 },   // 0x24 '$' U+0024
+  {   113,  19,  20,  23,    2,  -19 },   // 0x25 '%' U+0025
+  {   161,  17,  20,  18,    1,  -19 },   // 0x26 '&' U+0026
+  {   204,   3,   8,   7,    2,  -19 },   // 0x27 ''' U+0027
+  {   207,   7,  24,  10,    2,  -19 },   // 0x28 '(' U+0028
+  {   228,   7,  24,  10,    1,  -19 },   // 0x29 ')' U+0029
+  {   249,  10,  11,  14,    2,  -19 },   // 0x2a '*' U+002A
+  {   263,  14,  14,  17,    2,  -14 },   // 0x2b '+' U+002B
+  {   288,   5,   8,   8,    1,   -1 },   // 0x2c ',' U+002C
+  {   293,   9,   3,  11,    1,   -9 },   // 0x2d '-' U+002D
+  {   297,   4,   4,   8,    2,   -3 },   // 0x2e '.' U+002E
+  {   299,  10,  24,   9,    0,  -20 },   // 0x2f '/' U+002F
+  {   329,  16,  20,  18,    1,  -19 },   // 0x30 '0' U+0030
+  {   369,   9,  20,  11,    1,  -19 },   // 0x31 '1' U+0031
+  {   392,  14,  20,  16,    1,  -19 },   // 0x32 '2' U+0032
+  {   427,  15,  20,  17,    1,  -19 },   // 0x33 '3' U+0033
+  {   465,  16,  20,  17,    0,  -19 },   // 0x34 '4' U+0034
+  {   505,  14,  20,  16,    1,  -19 },   // 0x35 '5' U+0035
+  {   540,  15,  20,  17,    1,  -19 },   // 0x36 '6' U+0036
+  {   578,  14,  20,  16,    1,  -19 },   // 0x37 '7' U+0037
+  {   613,  15,  20,  17,    1,  -19 },   // 0x38 '8' U+0038
+  {   651,  15,  20,  17,    1,  -19 },   // 0x39 '9' U+0039
+  {   689,   4,  14,   8,    2,  -13 },   // 0x3a ':' U+003A
+  {   696,   5,  19,   8,    1,  -12 },   // 0x3b ';' U+003B
+  {   708,  14,  15,  18,    2,  -14 },   // 0x3c '<' U+003C
+  {   735,  13,   9,  17,    2,  -11 },   // 0x3d '=' U+003D
+  {   750,  14,  15,  18,    2,  -14 },   // 0x3e '>' U+003E
+  {   777,  13,  20,  15,    1,  -19 },   // 0x3f '?' U+003F
+  {   810,  25,  26,  27,    1,  -19 },   // 0x40 '@' U+0040
+  {   892,  19,  20,  19,    0,  -19 },   // 0x41 'A' U+0041
+  {   940,  15,  20,  17,    1,  -19 },   // 0x42 'B' U+0042
+  {   978,  18,  20,  20,    1,  -19 },   // 0x43 'C' U+0043
+  {  1023,  17,  20,  19,    1,  -19 },   // 0x44 'D' U+0044
+  {  1066,  13,  20,  15,    1,  -19 },   // 0x45 'E' U+0045
+  {  1099,  13,  20,  15,    1,  -19 },   // 0x46 'F' U+0046
+  {  1132,  18,  20,  20,    1,  -19 },   // 0x47 'G' U+0047
+  {  1177,  17,  20,  19,    1,  -19 },   // 0x48 'H' U+0048
+  {  1220,   4,  20,   6,    1,  -19 },   // 0x49 'I' U+0049
+  {  1230,  13,  20,  15,    1,  -19 },   // 0x4a 'J' U+004A
+  {  1263,  17,  20,  18,    1,  -19 },   // 0x4b 'K' U+004B
+  {  1306,  13,  20,  14,    1,  -19 },   // 0x4c 'L' U+004C
+  {  1339,  21,  20,  23,    1,  -19 },   // 0x4d 'M' U+004D
+  {  1392,  17,  20,  19,    1,  -19 },   // 0x4e 'N' U+004E
+  {  1435,  19,  20,  21,    1,  -19 },   // 0x4f 'O' U+004F
+  {  1483,  15,  20,  17,    1,  -19 },   // 0x50 'P' U+0050
+  {  1521,  19,  22,  21,    1,  -19 },   // 0x51 'Q' U+0051
+  {  1574,  16,  20,  17,    1,  -19 },   // 0x52 'R' U+0052
+  {  1614,  16,  20,  17,    0,  -19 },   // 0x53 'S' U+0053
+  {  1654,  16,  20,  18,    1,  -19 },   // 0x54 'T' U+0054
+  {  1694,  16,  20,  18,    1,  -19 },   // 0x55 'U' U+0055
+  {  1734,  19,  20,  19,    0,  -19 },   // 0x56 'V' U+0056
+  {  1782,  27,  20,  27,    0,  -19 },   // 0x57 'W' U+0057
+  {  1850,  18,  20,  18,    0,  -19 },   // 0x58 'X' U+0058
+  {  1895,  18,  20,  18,    0,  -19 },   // 0x59 'Y' U+0059
+  {  1940,  15,  20,  17,    1,  -19 },   // 0x5a 'Z' U+005A
+  {  1978,   6,  25,   9,    2,  -20 },   // 0x5b '[' U+005B
+  {  1997,  10,  24,   9,    0,  -20 },   // 0x5c '\' U+005C
+  {  2027,   7,  25,  10,    1,  -20 },   // 0x5d ']' U+005D
+  {  2049,  11,   9,  13,    1,  -19 },   // 0x5e '^' U+005E
+  {  2062,  13,   3,  13,    0,    1 },   // 0x5f '_' U+005F
+  {  2067,   6,   4,  12,    3,  -20 },   // 0x60 '`' U+0060
+  {  2070,  13,  15,  15,    1,  -14 },   // 0x61 'a' U+0061
+  {  2095,  14,  20,  16,    1,  -19 },   // 0x62 'b' U+0062
+  {  2130,  14,  15,  16,    1,  -14 },   // 0x63 'c' U+0063
+  {  2157,  14,  20,  16,    1,  -19 },   // 0x64 'd' U+0064
+  {  2192,  14,  15,  16,    1,  -14 },   // 0x65 'e' U+0065
+  {  2219,   9,  21,  10,    1,  -20 },   // 0x66 'f' U+0066
+  {  2243,  14,  21,  16,    1,  -14 },   // 0x67 'g' U+0067
+  {  2280,  14,  20,  16,    1,  -19 },   // 0x68 'h' U+0068
+  {  2315,   4,  21,   6,    1,  -20 },   // 0x69 'i' U+0069
+  {  2326,   6,  26,   6,   -1,  -19 },   // 0x6a 'j' U+006A
+  {  2346,  14,  20,  15,    1,  -19 },   // 0x6b 'k' U+006B
+  {  2381,   4,  20,   6,    1,  -19 },   // 0x6c 'l' U+006C
+  {  2391,  22,  15,  24,    1,  -14 },   // 0x6d 'm' U+006D
+  {  2433,  13,  15,  15,    1,  -14 },   // 0x6e 'n' U+006E
+  {  2458,  15,  15,  17,    1,  -14 },   // 0x6f 'o' U+006F
+  {  2487,  14,  21,  16,    1,  -14 },   // 0x70 'p' U+0070
+  {  2524,  14,  21,  16,    1,  -14 },   // 0x71 'q' U+0071
+  {  2561,   9,  15,  10,    1,  -14 },   // 0x72 'r' U+0072
+  {  2578,  13,  15,  15,    1,  -14 },   // 0x73 's' U+0073
+  {  2603,   9,  19,  10,    1,  -18 },   // 0x74 't' U+0074
+  {  2625,  13,  15,  15,    1,  -14 },   // 0x75 'u' U+0075
+  {  2650,  15,  15,  15,    0,  -14 },   // 0x76 'v' U+0076
+  {  2679,  22,  15,  22,    0,  -14 },   // 0x77 'w' U+0077
+  {  2721,  14,  15,  15,    0,  -14 },   // 0x78 'x' U+0078
+  {  2748,  15,  21,  15,    0,  -14 },   // 0x79 'y' U+0079
+  {  2788,  12,  15,  14,    1,  -14 },   // 0x7a 'z' U+007A
+  {  2811,   9,  25,  11,    1,  -20 },   // 0x7b '{' U+007B
+  {  2840,   4,  33,  10,    3,  -26 },   // 0x7c '|' U+007C
+  {  2857,   9,  25,  11,    1,  -20 },   // 0x7d '}' U+007D
+  {  2886,  14,   6,  18,    2,  -10 },   // 0x7e '~' U+007E
+  {     0,   0,   0,  14,    2,  -26 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {  2897,   1,   1,   6,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {  2898,  19,  26,  19,    0,  -19 },   // 0x81 '0x0104' U+0104
+  {  2960,   9,   4,  11,    1,  -20 },   // 0x82 '0x02D8' U+02D8
+  {  2965,  15,  20,  15,    0,  -19 },   // 0x83 '0x0141' U+0141
+  {  3003,  16,  17,  20,    2,  -16 },   // 0x84 '0x00A4' U+00A4
+  {  3037,  13,  21,  14,    1,  -20 },   // 0x85 '0x013D' U+013D
+  {  3072,  16,  26,  17,    0,  -25 },   // 0x86 '0x015A' U+015A
+  {  3124,  13,  24,  15,    1,  -19 },   // 0x87 '0x00A7' U+00A7
+  {  3163,  10,   3,  14,    2,  -19 },   // 0x88 '0x00A8' U+00A8
+  {  3167,  16,  26,  17,    0,  -25 },   // 0x89 '0x0160' U+0160
+  {  3219,  16,  25,  17,    0,  -19 },   // 0x8a '0x015E' U+015E
+  {  3269,  16,  26,  18,    1,  -25 },   // 0x8b '0x0164' U+0164
+  {  3321,  15,  26,  17,    1,  -25 },   // 0x8c '0x0179' U+0179
+  {  3370,   9,   3,  11,    1,   -9 },   // 0x8d '0x00AD' U+00AD
+  {  3374,  15,  26,  17,    1,  -25 },   // 0x8e '0x017D' U+017D
+  {  3423,  15,  26,  17,    1,  -25 },   // 0x8f '0x017B' U+017B
+  {  3472,  10,  10,  12,    1,  -20 },   // 0x90 '0x00B0' U+00B0
+  {  3485,  13,  21,  15,    1,  -14 },   // 0x91 '0x0105' U+0105
+  {  3520,   5,   7,   7,    1,    0 },   // 0x92 '0x02DB' U+02DB
+  {  3525,   8,  20,   6,   -1,  -19 },   // 0x93 '0x0142' U+0142
+  {  3545,   5,   4,  12,    3,  -20 },   // 0x94 '0x00B4' U+00B4
+  {  3548,   8,  21,   9,    1,  -20 },   // 0x95 '0x013E' U+013E
+  {  3569,  13,  21,  15,    1,  -20 },   // 0x96 '0x015B' U+015B
+  {  3604,  10,   5,  13,    2,  -21 },   // 0x97 '0x02C7' U+02C7
+  {  3611,   5,   6,   8,    2,    1 },   // 0x98 '0x00B8' U+00B8
+  {  3615,  13,  21,  15,    1,  -20 },   // 0x99 '0x0161' U+0161
+  {  3650,  13,  20,  15,    1,  -14 },   // 0x9a '0x015F' U+015F
+  {  3683,  10,  22,  10,    1,  -21 },   // 0x9b '0x0165' U+0165
+  {  3711,  12,  21,  14,    1,  -20 },   // 0x9c '0x017A' U+017A
+  {  3743,  11,   4,  11,    0,  -19 },   // 0x9d '0x02DD' U+02DD
+  {  3749,  12,  21,  14,    1,  -20 },   // 0x9e '0x017E' U+017E
+  {  3781,  12,  21,  14,    1,  -20 },   // 0x9f '0x017C' U+017C
+  {  3813,  16,  26,  17,    1,  -25 },   // 0xa0 '0x0154' U+0154
+  {  3865,  19,  26,  19,    0,  -25 },   // 0xa1 '0x00C1' U+00C1
+  {  3927,  19,  26,  19,    0,  -25 },   // 0xa2 '0x00C2' U+00C2
+  {  3989,  19,  26,  19,    0,  -25 },   // 0xa3 '0x0102' U+0102
+  {  4051,  19,  25,  19,    0,  -24 },   // 0xa4 '0x00C4' U+00C4
+  {  4111,  13,  26,  14,    1,  -25 },   // 0xa5 '0x0139' U+0139
+  {  4154,  18,  26,  20,    1,  -25 },   // 0xa6 '0x0106' U+0106
+  {  4213,  18,  26,  19,    1,  -19 },   // 0xa7 '0x00C7' U+00C7
+  {  4272,  18,  26,  20,    1,  -25 },   // 0xa8 '0x010C' U+010C
+  {  4331,  13,  26,  15,    1,  -25 },   // 0xa9 '0x00C9' U+00C9
+  {  4374,  13,  26,  15,    1,  -19 },   // 0xaa '0x0118' U+0118
+  {  4417,  13,  25,  15,    1,  -24 },   // 0xab '0x00CB' U+00CB
+  {  4458,  13,  26,  15,    1,  -25 },   // 0xac '0x011A' U+011A
+  {  4501,   6,  26,   6,    1,  -25 },   // 0xad '0x00CD' U+00CD
+  {  4521,  10,  26,   6,   -2,  -25 },   // 0xae '0x00CE' U+00CE
+  {  4554,  17,  26,  19,    1,  -25 },   // 0xaf '0x010E' U+010E
+  {  4610,  20,  20,  20,   -1,  -19 },   // 0xb0 '0x0110' U+0110
+  {  4660,  17,  26,  19,    1,  -25 },   // 0xb1 '0x0143' U+0143
+  {  4716,  17,  26,  19,    1,  -25 },   // 0xb2 '0x0147' U+0147
+  {  4772,  19,  26,  21,    1,  -25 },   // 0xb3 '0x00D3' U+00D3
+  {  4834,  19,  26,  21,    1,  -25 },   // 0xb4 '0x00D4' U+00D4
+  {  4896,  19,  26,  21,    1,  -25 },   // 0xb5 '0x0150' U+0150
+  {  4958,  19,  25,  21,    1,  -24 },   // 0xb6 '0x00D6' U+00D6
+  {  5018,  14,  14,  18,    2,  -14 },   // 0xb7 '0x00D7' U+00D7
+  {  5043,  16,  26,  17,    1,  -25 },   // 0xb8 '0x0158' U+0158
+  {  5095,  16,  27,  18,    1,  -26 },   // 0xb9 '0x016E' U+016E
+  {  5149,  16,  26,  18,    1,  -25 },   // 0xba '0x00DA' U+00DA
+  {  5201,  16,  26,  18,    1,  -25 },   // 0xbb '0x0170' U+0170
+  {  5253,  16,  26,  18,    1,  -25 },   // 0xbc '0x00DC' U+00DC
+  {  5305,  18,  26,  18,    0,  -25 },   // 0xbd '0x00DD' U+00DD
+  {  5364,  16,  26,  18,    1,  -19 },   // 0xbe '0x0162' U+0162
+  {  5416,  15,  20,  17,    1,  -19 },   // 0xbf '0x00DF' U+00DF
+  {  5454,   9,  21,  10,    1,  -20 },   // 0xc0 '0x0155' U+0155
+  {  5478,  13,  21,  15,    1,  -20 },   // 0xc1 '0x00E1' U+00E1
+  {  5513,  13,  21,  15,    1,  -20 },   // 0xc2 '0x00E2' U+00E2
+  {  5548,  13,  21,  15,    1,  -20 },   // 0xc3 '0x0103' U+0103
+  {  5583,  13,  21,  15,    1,  -20 },   // 0xc4 '0x00E4' U+00E4
+  {  5618,   6,  26,   6,    1,  -25 },   // 0xc5 '0x013A' U+013A
+  {  5638,  14,  21,  16,    1,  -20 },   // 0xc6 '0x0107' U+0107
+  {  5675,  13,  20,  15,    1,  -14 },   // 0xc7 '0x00E7' U+00E7
+  {  5708,  14,  21,  16,    1,  -20 },   // 0xc8 '0x010D' U+010D
+  {  5745,  14,  21,  16,    1,  -20 },   // 0xc9 '0x00E9' U+00E9
+  {  5782,  14,  20,  16,    1,  -14 },   // 0xca '0x0119' U+0119
+  {  5817,  14,  21,  16,    1,  -20 },   // 0xcb '0x00EB' U+00EB
+  {  5854,  14,  21,  16,    1,  -20 },   // 0xcc '0x011B' U+011B
+  {  5891,   6,  21,   6,    1,  -20 },   // 0xcd '0x00ED' U+00ED
+  {  5907,  10,  21,   6,   -2,  -20 },   // 0xce '0x00EE' U+00EE
+  {  5934,  19,  21,  19,    1,  -20 },   // 0xcf '0x010F' U+010F
+  {  5984,  16,  20,  17,    1,  -19 },   // 0xd0 '0x0111' U+0111
+  {  6024,  13,  21,  15,    1,  -20 },   // 0xd1 '0x0144' U+0144
+  {  6059,  13,  21,  15,    1,  -20 },   // 0xd2 '0x0148' U+0148
+  {  6094,  15,  21,  17,    1,  -20 },   // 0xd3 '0x00F3' U+00F3
+  {  6134,  15,  21,  17,    1,  -20 },   // 0xd4 '0x00F4' U+00F4
+  {  6174,  15,  21,  17,    1,  -20 },   // 0xd5 '0x0151' U+0151
+  {  6214,  15,  21,  17,    1,  -20 },   // 0xd6 '0x00F6' U+00F6
+  {  6254,  13,  15,  17,    2,  -14 },   // 0xd7 '0x00F7' U+00F7
+  {  6279,  10,  21,  10,    0,  -20 },   // 0xd8 '0x0159' U+0159
+  {  6306,  13,  23,  15,    1,  -22 },   // 0xd9 '0x016F' U+016F
+  {  6344,  13,  21,  15,    1,  -20 },   // 0xda '0x00FA' U+00FA
+  {  6379,  13,  20,  15,    1,  -19 },   // 0xdb '0x0171' U+0171
+  {  6412,  13,  20,  15,    1,  -19 },   // 0xdc '0x00FC' U+00FC
+  {  6445,  15,  26,  15,    0,  -19 },   // 0xdd '0x00FD' U+00FD
+  {  6494,   9,  25,  10,    1,  -18 },   // 0xde '0x0163' U+0163
+  {  6523,   4,   4,   6,    1,  -20 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_SemiBold14pt8b PROGMEM = {
+  (uint8_t  *)InterTight_SemiBold14pt8bBitmaps,
+  (GFXglyph *)InterTight_SemiBold14pt8bGlyphs,
+  0x20, 0xDF, 33 };
+
+// Approx. 7876 bytes
@@ -0,0 +1,320 @@
+// Subset of ../InterTightSemiBold6pt8bfr.h - generated by fontSubset_script.py, do not edit.
+// 191 of 192 glyphs keep their bitmap, the rest only advance the cursor.
+
+const uint8_t InterTight_SemiBold6pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xF3, 0xC0, 0xFF, 0xF0, 0x24, 0x49, 0xF9, 0x26, 0xDF, 0xD2,
+  0x24, 0x48, 0x10, 0xFB, 0x5E, 0x8F, 0x0F, 0x87, 0xEB, 0xD6, 0xF8, 0x40,
+  0x62, 0x96, 0x94, 0x68, 0x18, 0x16, 0x29, 0x69, 0x46, 0x78, 0xCC, 0xCC,
+  0xF8, 0x70, 0xFA, 0xDA, 0xC4, 0x7A, 0xFC, 0x2D, 0x6D, 0xB6, 0x4C, 0x80,
+  0x99, 0x36, 0xDB, 0x5A, 0x00, 0x27, 0xC9, 0xF2, 0x00, 0x30, 0xC3, 0x3F,
+  0x30, 0xC0, 0x49, 0x20, 0xF0, 0xF0, 0x13, 0x22, 0x26, 0x44, 0x4C, 0x80,
+  0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xB6, 0x38, 0x7F, 0xB3, 0x33, 0x33,
+  0x30, 0x7B, 0x38, 0xC3, 0x18, 0xC7, 0x18, 0xFC, 0x3C, 0x8C, 0x18, 0x31,
+  0x80, 0xC1, 0xA3, 0x3C, 0x1C, 0x38, 0xF3, 0x64, 0xD9, 0xBF, 0x86, 0x0C,
+  0x7C, 0x81, 0x03, 0xE4, 0xE0, 0xC1, 0xA7, 0x3C, 0x3C, 0xCF, 0x06, 0xEE,
+  0xF8, 0xF1, 0xB7, 0x3C, 0xFC, 0x30, 0x86, 0x10, 0xC2, 0x18, 0x40, 0x7B,
+  0x3C, 0xF3, 0x33, 0x3C, 0xF3, 0x78, 0x79, 0xDB, 0x1E, 0x3C, 0xEE, 0xC1,
+  0xE6, 0x78, 0xF0, 0x3C, 0xF0, 0x3A, 0x80, 0x04, 0xFF, 0x30, 0x70, 0x70,
+  0x40, 0xFC, 0x00, 0x3F, 0x83, 0xC3, 0xC3, 0x3B, 0x88, 0x00, 0x7B, 0x30,
+  0xC7, 0x30, 0xC0, 0x0C, 0x30, 0x1F, 0x06, 0x39, 0x83, 0x6F, 0xBF, 0x17,
+  0xE2, 0xFC, 0x5F, 0x8B, 0xDF, 0xCC, 0x01, 0xC0, 0x0F, 0x80, 0x1C, 0x0E,
+  0x05, 0x06, 0xC3, 0x63, 0x11, 0xFC, 0x82, 0xC1, 0x80, 0xF9, 0x9B, 0x36,
+  0x6F, 0x98, 0xF1, 0xE3, 0xFC, 0x3C, 0x62, 0xC3, 0xC0, 0xC0, 0xC0, 0xC3,
+  0x62, 0x3C, 0xF9, 0x9B, 0x1E, 0x3C, 0x78, 0xF1, 0xE6, 0xF8, 0xFF, 0x0C,
+  0x30, 0xFF, 0x0C, 0x30, 0xFC, 0xFF, 0x0C, 0x30, 0xFF, 0x0C, 0x30, 0xC0,
+  0x3C, 0x66, 0xC3, 0xC0, 0xCF, 0xC3, 0xC3, 0x66, 0x3C, 0xC7, 0x8F, 0x1E,
+  0x3F, 0xF8, 0xF1, 0xE3, 0xC6, 0xFF, 0xFF, 0xC0, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xF3, 0x78, 0xC7, 0x9B, 0x66, 0x8F, 0x1F, 0x33, 0x62, 0xC6, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xFC, 0xC3, 0xF1, 0xF8, 0xFC, 0xFD, 0x5E,
+  0xAF, 0x57, 0x93, 0xC9, 0x80, 0xC7, 0xCF, 0x9F, 0xBD, 0x7B, 0xF3, 0xE7,
+  0xC6, 0x3C, 0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0xFB, 0x3C,
+  0xF3, 0xCF, 0xEC, 0x30, 0xC0, 0x3C, 0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xCB,
+  0x6E, 0x3E, 0x03, 0xFB, 0x3C, 0xF3, 0xFB, 0x4D, 0xB2, 0xCC, 0x7D, 0x8F,
+  0x07, 0x87, 0xC1, 0xF1, 0xE3, 0x7C, 0xFE, 0x60, 0xC1, 0x83, 0x06, 0x0C,
+  0x18, 0x30, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x78, 0xC3, 0x43,
+  0x62, 0x66, 0x26, 0x34, 0x3C, 0x1C, 0x18, 0xC6, 0x38, 0xCD, 0x39, 0xB7,
+  0x36, 0xB4, 0x53, 0x8E, 0x71, 0x8C, 0x31, 0x80, 0xC6, 0x66, 0x2C, 0x3C,
+  0x18, 0x3C, 0x2C, 0x66, 0xC2, 0xC3, 0x66, 0x66, 0x3C, 0x3C, 0x18, 0x18,
+  0x18, 0x18, 0xFC, 0x31, 0x84, 0x30, 0x86, 0x30, 0xFC, 0xFB, 0x6D, 0xB6,
+  0xDB, 0x80, 0x8C, 0x44, 0x46, 0x22, 0x23, 0x10, 0xED, 0xB6, 0xDB, 0x6F,
+  0x80, 0x23, 0x94, 0xAC, 0x80, 0xFC, 0x48, 0x7B, 0x30, 0xDF, 0xCF, 0x37,
+  0xC0, 0xC3, 0x0F, 0xB3, 0xCF, 0x3C, 0xF3, 0xF8, 0x79, 0xBC, 0x30, 0xC3,
+  0x97, 0x80, 0x0C, 0x37, 0xF3, 0xCF, 0x3C, 0xF3, 0x7C, 0x7B, 0x3C, 0xFF,
+  0xC3, 0x37, 0x80, 0x3B, 0x3C, 0xC6, 0x31, 0x8C, 0x60, 0x7F, 0x3C, 0xF3,
+  0xCF, 0x37, 0xC3, 0xCD, 0xE0, 0xC3, 0x0F, 0xB3, 0xCF, 0x3C, 0xF3, 0xCC,
+  0xF3, 0xFF, 0xF0, 0x6C, 0x36, 0xDB, 0x6D, 0xBC, 0xC3, 0x0C, 0xF6, 0xF3,
+  0xCD, 0xB6, 0xCC, 0xFF, 0xFF, 0xC0, 0xFB, 0xB3, 0x3C, 0xCF, 0x33, 0xCC,
+  0xF3, 0x3C, 0xCC, 0xFB, 0x3C, 0xF3, 0xCF, 0x3C, 0xC0, 0x7B, 0x3C, 0xF3,
+  0xCF, 0x37, 0x80, 0xFB, 0x3C, 0xF3, 0xCF, 0x3F, 0xB0, 0xC3, 0x00, 0x7F,
+  0x3C, 0xF3, 0xCF, 0x37, 0xC3, 0x0C, 0x30, 0xFC, 0xCC, 0xCC, 0xC0, 0x7B,
+  0x2E, 0x1E, 0x1F, 0x37, 0x80, 0x66, 0xF6, 0x66, 0x66, 0x30, 0xCF, 0x3C,
+  0xF3, 0xCF, 0x37, 0xC0, 0xC5, 0x34, 0xDA, 0x38, 0xE3, 0x00, 0xCC, 0xE6,
+  0xD7, 0x6A, 0xA7, 0x73, 0x98, 0xCC, 0xCD, 0xA3, 0x8C, 0x39, 0xAC, 0xC0,
+  0xC5, 0x34, 0xDA, 0x78, 0xE3, 0x0C, 0x31, 0x80, 0xF8, 0xCC, 0x46, 0x63,
+  0xE0, 0x36, 0x66, 0x6C, 0x66, 0x66, 0x30, 0xFF, 0xFF, 0xFF, 0xFC, 0xE1,
+  0x8C, 0x63, 0x0C, 0xC6, 0x31, 0xB8, 0xE6, 0x70, 0x00, 0x1C, 0x0E, 0x05,
+  0x06, 0xC3, 0x63, 0x11, 0xFC, 0x82, 0xC1, 0x80, 0x80, 0x40, 0x30, 0x96,
+  0x60, 0xC1, 0x83, 0x0F, 0x0C, 0x18, 0x30, 0x7E, 0xBA, 0x8A, 0x0C, 0x18,
+  0x30, 0x71, 0xDD, 0x16, 0xB1, 0x8C, 0x63, 0x18, 0xC7, 0xC0, 0x18, 0x20,
+  0x03, 0xEC, 0x78, 0x3C, 0x3E, 0x0F, 0x8F, 0x1B, 0xE0, 0x39, 0x34, 0x0C,
+  0x59, 0x17, 0x4E, 0x0D, 0x33, 0x80, 0xF0, 0x28, 0x60, 0x03, 0xEC, 0x78,
+  0x3C, 0x3E, 0x0F, 0x8F, 0x1B, 0xE0, 0x7D, 0x8F, 0x07, 0x87, 0xC1, 0xF1,
+  0xE3, 0x7C, 0x20, 0x20, 0x80, 0x48, 0x60, 0x07, 0xF3, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x80, 0x10, 0x40, 0x3F, 0x0C, 0x61, 0x0C, 0x21, 0x8C,
+  0x3F, 0xF0, 0x78, 0xC0, 0x3F, 0x0C, 0x61, 0x0C, 0x21, 0x8C, 0x3F, 0x30,
+  0xC0, 0x3F, 0x0C, 0x61, 0x0C, 0x21, 0x8C, 0x3F, 0x69, 0x96, 0x7B, 0x30,
+  0xDF, 0xCF, 0x37, 0xC2, 0x0C, 0x59, 0x80, 0x66, 0x67, 0xE6, 0x66, 0x60,
+  0x58, 0x3F, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0x40, 0x1E, 0xCB, 0x87, 0x87,
+  0xCD, 0xE0, 0xB6, 0x9C, 0x78, 0xC0, 0x1E, 0xCB, 0x87, 0x87, 0xCD, 0xE0,
+  0x7B, 0x2E, 0x1E, 0x1F, 0x37, 0x8C, 0x10, 0xC0, 0x1B, 0xD9, 0xE6, 0x31,
+  0x8C, 0x61, 0x80, 0x11, 0x01, 0xF1, 0x98, 0x8C, 0xC7, 0xC0, 0x5E, 0x80,
+  0xDA, 0x88, 0x0F, 0x8C, 0xC4, 0x66, 0x3E, 0x31, 0x81, 0xF1, 0x88, 0xCC,
+  0x67, 0xC0, 0x10, 0x80, 0x3E, 0xCF, 0x3C, 0xFE, 0xD3, 0x6C, 0xB3, 0x0C,
+  0x04, 0x00, 0x03, 0x81, 0xC0, 0xA0, 0xD8, 0x6C, 0x62, 0x3F, 0x90, 0x58,
+  0x30, 0x1C, 0x1A, 0x00, 0x03, 0x81, 0xC0, 0xA0, 0xD8, 0x6C, 0x62, 0x3F,
+  0x90, 0x58, 0x30, 0x36, 0x0E, 0x00, 0x03, 0x81, 0xC0, 0xA0, 0xD8, 0x6C,
+  0x62, 0x3F, 0x90, 0x58, 0x30, 0x36, 0x00, 0x00, 0x03, 0x81, 0xC0, 0xA0,
+  0xD8, 0x6C, 0x62, 0x3F, 0x90, 0x58, 0x30, 0x63, 0x00, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x3F, 0x0C, 0x08, 0x00, 0x3C, 0x62, 0xC3, 0xC0, 0xC0,
+  0xC0, 0xC3, 0x62, 0x3C, 0x3C, 0xCF, 0x0E, 0x0C, 0x18, 0x30, 0xB3, 0x3C,
+  0x30, 0x20, 0xC0, 0x14, 0x18, 0x00, 0x3C, 0x62, 0xC3, 0xC0, 0xC0, 0xC0,
+  0xC3, 0x62, 0x3C, 0x18, 0x40, 0x3F, 0xC3, 0x0C, 0x3F, 0xC3, 0x0C, 0x3F,
+  0xFF, 0x0C, 0x30, 0xFF, 0x0C, 0x30, 0xFC, 0x30, 0x83, 0x78, 0x00, 0x3F,
+  0xC3, 0x0C, 0x3E, 0xC3, 0x0C, 0x3F, 0x68, 0xC0, 0x3F, 0xC3, 0x0C, 0x3F,
+  0xC3, 0x0C, 0x3F, 0x78, 0x6D, 0xB6, 0xDB, 0x60, 0x69, 0x06, 0x66, 0x66,
+  0x66, 0x66, 0x50, 0x60, 0x07, 0xCC, 0xD8, 0xF1, 0xE3, 0xC7, 0x8F, 0x37,
+  0xC0, 0x7C, 0x66, 0x63, 0x63, 0xF3, 0x63, 0x63, 0x66, 0x7C, 0x18, 0x20,
+  0x06, 0x3E, 0x7C, 0xFD, 0xEB, 0xDF, 0x9F, 0x3E, 0x30, 0x28, 0x20, 0x06,
+  0x3E, 0x7C, 0xFD, 0xEB, 0xDF, 0x9F, 0x3E, 0x30, 0x08, 0x08, 0x00, 0x3C,
+  0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x18, 0x3C, 0x00, 0x3C,
+  0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x14, 0x14, 0x00, 0x3C,
+  0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x3C, 0x00, 0x00, 0x3C,
+  0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x8B, 0x27, 0x8C, 0x7B,
+  0x30, 0x00, 0x70, 0xC0, 0x3E, 0xCF, 0x3C, 0xFE, 0xD3, 0x6C, 0xB3, 0x10,
+  0x60, 0x40, 0x0C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x37, 0x80, 0x18,
+  0x20, 0x06, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1B, 0xC0, 0x1C, 0x50,
+  0x06, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1B, 0xC0, 0x6C, 0x00, 0x06,
+  0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1B, 0xC0, 0x0C, 0x18, 0x00, 0xC3,
+  0x66, 0x66, 0x3C, 0x3C, 0x18, 0x18, 0x18, 0x18, 0xFE, 0x60, 0xC1, 0x83,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0x61, 0x80, 0x7B, 0x3C, 0xF3, 0xDB, 0x3C,
+  0xF3, 0xD8, 0x22, 0x0F, 0xCC, 0xCC, 0xCC, 0x18, 0x40, 0x1E, 0xCC, 0x37,
+  0xF3, 0xCD, 0xF0, 0x31, 0xA0, 0x1E, 0xCC, 0x37, 0xF3, 0xCD, 0xF0, 0x38,
+  0x07, 0xB3, 0x0D, 0xFC, 0xF3, 0x7C, 0x78, 0x07, 0xB3, 0x0D, 0xFC, 0xF3,
+  0x7C, 0x78, 0x6D, 0xB6, 0xDB, 0x60, 0x08, 0x40, 0x1E, 0x6F, 0x0C, 0x30,
+  0xE5, 0xE0, 0x7B, 0x3C, 0x30, 0xC3, 0xB7, 0x84, 0x10, 0x40, 0x28, 0x60,
+  0x1E, 0x67, 0x0C, 0x30, 0xED, 0xE0, 0x10, 0x40, 0x1E, 0xCF, 0x3F, 0xF0,
+  0xCD, 0xE0, 0x7B, 0x3C, 0xFF, 0xC3, 0x37, 0x88, 0x30, 0x78, 0x07, 0xB3,
+  0xCF, 0xFC, 0x33, 0x78, 0x78, 0xC0, 0x1E, 0xCF, 0x3F, 0xF0, 0xCD, 0xE0,
+  0x78, 0x6D, 0xB6, 0xD8, 0x66, 0x90, 0x66, 0x66, 0x66, 0x60, 0x01, 0x0D,
+  0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x1E, 0x19, 0xF6, 0x6C,
+  0xD9, 0xB3, 0x66, 0x7C, 0x10, 0x40, 0x3E, 0xCF, 0x3C, 0xF3, 0xCF, 0x30,
+  0x78, 0xC0, 0x3E, 0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x10, 0x40, 0x1E, 0xCF,
+  0x3C, 0xF3, 0xCD, 0xE0, 0x31, 0xC0, 0x1E, 0xCF, 0x3C, 0xF3, 0xCD, 0xE0,
+  0x28, 0xC0, 0x1E, 0xCF, 0x3C, 0xF3, 0xCD, 0xE0, 0x78, 0x07, 0xB3, 0xCF,
+  0x3C, 0xF3, 0x78, 0x30, 0xC0, 0x3F, 0x00, 0xC3, 0x00, 0x9E, 0x60, 0xFC,
+  0xCC, 0xCC, 0xC0, 0x71, 0x47, 0x00, 0xCF, 0x3C, 0xF3, 0xCF, 0x37, 0xC0,
+  0x10, 0x40, 0x33, 0xCF, 0x3C, 0xF3, 0xCD, 0xF0, 0x2C, 0xA0, 0x33, 0xCF,
+  0x3C, 0xF3, 0xCD, 0xF0, 0x78, 0x0C, 0xF3, 0xCF, 0x3C, 0xF3, 0x7C, 0x18,
+  0x40, 0x31, 0x4D, 0x36, 0x9E, 0x38, 0xC3, 0x0C, 0x60, 0x66, 0xF6, 0x66,
+  0x67, 0x71, 0x13, 0xF0 };
+
+const GFXglyph InterTight_SemiBold6pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' ' U+0020
+  {     1,   2,   9,   4,    1,   -8 },   // 0x21 '!' U+0021
+  {     4,   4,   3,   6,    1,   -8 },   // 0x22 '"' U+0022
+  {     6,   7,   9,   7,    0,   -8 },   // 0x23 '#' U+0023
+  {    14,   7,  11,   9,    1,   -9 },   // 0x24 '$' U+0024
+  {    24,   8,   9,  10,    1,   -8 },   // 0x25 '%' U+0025
+  {    33,   8,   9,   9,    1,   -8 },   // 0x26 '&' U+0026
+  {    42,   2,   3,   4,    1,   -8 },   // 0x27 ''' U+0027
+  {    43,   3,  11,   5,    1,   -8 },   // 0x28 '(' U+0028
+  {    48,   3,  11,   5,    1,   -8 },   // 0x29 ')' U+0029
+  {    53,   5,   5,   7,    1,   -8 },   // 0x2a '*' U+002A
+  {    57,   6,   6,   8,    1,   -6 },   // 0x2b '+' U+002B
+  {    62,   3,   4,   4,    0,    0 },   // 0x2c ',' U+002C
+  {    64,   4,   1,   6,    1,   -3 },   // 0x2d '-' U+002D
+  {    65,   2,   2,   4,    1,   -1 },   // 0x2e '.' U+002E
+  {    66,   4,  11,   4,    0,   -9 },   // 0x2f '/' U+002F
+  {    72,   7,   9,   9,    1,   -8 },   // 0x30 '0' U+0030
+  {    80,   4,   9,   6,    1,   -8 },   // 0x31 '1' U+0031
+  {    85,   6,   9,   8,    1,   -8 },   // 0x32 '2' U+0032
+  {    92,   7,   9,   8,    0,   -8 },   // 0x33 '3' U+0033
+  {   100,   7,   9,   8,    1,   -8 },   // 0x34 '4' U+0034
+  {   108,   7,   9,   8,    0,   -8 },   // 0x35 '5' U+0035
+  {   116,   7,   9,   9,    1,   -8 },   // 0x36 '6' U+0036
+  {   124,   6,   9,   8,    1,   -8 },   // 0x37 '7' U+0037
+  {   131,   6,   9,   8,    1,   -8 },   // 0x38 '8' U+0038
+  {   138,   7,   9,   9,    1,   -8 },   // 0x39 '9' U+0039
+  {   146,   2,   7,   4,    1,   -6 },   // 0x3a ':' U+003A
+  {   148,   2,   9,   4,    1,   -5 },   // 0x3b ';' U+003B
+  {   151,   6,   7,   8,    1,   -6 },   // 0x3c '<' U+003C
+  {   157,   6,   4,   8,    1,   -5 },   // 0x3d '=' U+003D
+  {   160,   6,   7,   8,    1,   -6 },   // 0x3e '>' U+003E
+  {   166,   6,   9,   8,    1,   -8 },   // 0x3f '?' U+003F
+  {   173,  11,  12,  13,    1,   -8 },   // 0x40 '@' U+0040
+  {   190,   9,   9,   9,    0,   -8 },   // 0x41 'A' U+0041
+  {   201,   7,   9,   9,    1,   -8 },   // 0x42 'B' U+0042
+  {   209,   8,   9,   9,    1,   -8 },   // 0x43 'C' U+0043
+  {   218,   7,   9,   9,    1,   -8 },   // 0x44 'D' U+0044
+  {   226,   6,   9,   8,    1,   -8 },   // 0x45 'E' U+0045
+  {   233,   6,   9,   7,    1,   -8 },   // 0x46 'F' U+0046
+  {   240,   8,   9,  10,    1,   -8 },   // 0x47 'G' U+0047
+  {   249,   7,   9,   9,    1,   -8 },   // 0x48 'H' U+0048
+  {   257,   2,   9,   4,    1,   -8 },   // 0x49 'I' U+0049
+  {   260,   6,   9,   8,    1,   -8 },   // 0x4a 'J' U+004A
+  {   267,   7,   9,   8,    1,   -8 },   // 0x4b 'K' U+004B
+  {   275,   6,   9,   7,    1,   -8 },   // 0x4c 'L' U+004C
+  {   282,   9,   9,  11,    1,   -8 },   // 0x4d 'M' U+004D
+  {   293,   7,   9,   9,    1,   -8 },   // 0x4e 'N' U+004E
+  {   301,   8,   9,  10,    1,   -8 },   // 0x4f 'O' U+004F
+  {   310,   6,   9,   8,    1,   -8 },   // 0x50 'P' U+0050
+  {   317,   8,  10,  10,    1,   -8 },   // 0x51 'Q' U+0051
+  {   327,   6,   9,   8,    1,   -8 },   // 0x52 'R' U+0052
+  {   334,   7,   9,   9,    1,   -8 },   // 0x53 'S' U+0053
+  {   342,   7,   9,   9,    1,   -8 },   // 0x54 'T' U+0054
+  {   350,   7,   9,   9,    1,   -8 },   // 0x55 'U' U+0055
+  {   358,   8,   9,   8,    0,   -8 },   // 0x56 'V' U+0056
+  {   367,  11,   9,  12,    0,   -8 },   // 0x57 'W' U+0057
+  {   380,   8,   9,   8,    0,   -8 },   // 0x58 'X' U+0058
+  {   389,   8,   9,   8,    0,   -8 },   // 0x59 'Y' U+0059
+  {   398,   6,   9,   8,    1,   -8 },   // 0x5a 'Z' U+005A
+  {   405,   3,  11,   5,    1,   -8 },   // 0x5b '[' U+005B
+  {   410,   4,  11,   4,    0,   -9 },   // 0x5c '\' U+005C
+  {   416,   3,  11,   5,    1,   -8 },   // 0x5d ']' U+005D
+  {   421,   5,   5,   5,    0,   -9 },   // 0x5e '^' U+005E
+  {   425,   6,   1,   6,    0,    1 },   // 0x5f '_' U+005F
+  {   426,   3,   2,   5,    1,   -9 },   // 0x60 '`' U+0060
+  {   427,   6,   7,   8,    1,   -6 },   // 0x61 'a' U+0061
+  {   433,   6,   9,   8,    1,   -8 },   // 0x62 'b' U+0062
+  {   440,   6,   7,   8,    1,   -6 },   // 0x63 'c' U+0063
+  {   446,   6,   9,   8,    1,   -8 },   // 0x64 'd' U+0064
+  {   453,   6,   7,   8,    1,   -6 },   // 0x65 'e' U+0065
+  {   459,   5,   9,   5,    0,   -8 },   // 0x66 'f' U+0066
+  {   465,   6,  10,   8,    1,   -6 },   // 0x67 'g' U+0067
+  {   473,   6,   9,   8,    1,   -8 },   // 0x68 'h' U+0068
+  {   480,   2,  10,   4,    1,   -9 },   // 0x69 'i' U+0069
+  {   483,   3,  13,   4,    0,   -9 },   // 0x6a 'j' U+006A
+  {   488,   6,   9,   7,    1,   -8 },   // 0x6b 'k' U+006B
+  {   495,   2,   9,   4,    1,   -8 },   // 0x6c 'l' U+006C
+  {   498,  10,   7,  12,    1,   -6 },   // 0x6d 'm' U+006D
+  {   507,   6,   7,   8,    1,   -6 },   // 0x6e 'n' U+006E
+  {   513,   6,   7,   8,    1,   -6 },   // 0x6f 'o' U+006F
+  {   519,   6,  10,   8,    1,   -6 },   // 0x70 'p' U+0070
+  {   527,   6,  10,   8,    1,   -6 },   // 0x71 'q' U+0071
+  {   535,   4,   7,   5,    1,   -6 },   // 0x72 'r' U+0072
+  {   539,   6,   7,   8,    1,   -6 },   // 0x73 's' U+0073
+  {   545,   4,   9,   5,    0,   -8 },   // 0x74 't' U+0074
+  {   550,   6,   7,   8,    1,   -6 },   // 0x75 'u' U+0075
+  {   556,   6,   7,   6,    0,   -6 },   // 0x76 'v' U+0076
+  {   562,   9,   7,   9,    0,   -6 },   // 0x77 'w' U+0077
+  {   570,   6,   7,   6,    0,   -6 },   // 0x78 'x' U+0078
+  {   576,   6,  10,   6,    0,   -6 },   // 0x79 'y' U+0079
+  {   584,   5,   7,   7,    1,   -6 },   // 0x7a 'z' U+007A
+  {   589,   4,  11,   6,    1,   -8 },   // 0x7b '{' U+007B
+  {   595,   2,  15,   4,    1,  -11 },   // 0x7c '|' U+007C
+  {   599,   5,  11,   6,    0,   -8 },   // 0x7d '}' U+007D
+  {   606,   6,   2,   8,    1,   -4 },   // 0x7e '~' U+007E
+  {     0,   0,   0,   6,    0,  -11 },   // 0x7f 'REPLACEMENT CHARACTER *' U+2370
+  {   608,   1,   1,   3,    0,    0 },   // 0x80 '0x00A0' U+00A0
+  {   609,   9,  12,   9,    0,   -8 },   // 0x81 '0x0104' U+0104
+  {   623,   4,   2,   6,    1,   -9 },   // 0x82 '0x02D8' U+02D8
+  {   624,   7,   9,   7,    0,   -8 },   // 0x83 '0x0141' U+0141
+  {   632,   7,   8,   9,    1,   -7 },   // 0x84 '0x00A4' U+00A4
+  {   639,   5,  10,   7,    1,   -9 },   // 0x85 '0x013D' U+013D
+  {   646,   7,  12,   9,    1,  -11 },   // 0x86 '0x015A' U+015A
+  {   657,   6,  11,   7,    0,   -8 },   // 0x87 '0x00A7' U+00A7
+  {   666,   4,   1,   6,    1,   -8 },   // 0x88 '0x00A8' U+00A8
+  {   667,   7,  12,   9,    1,  -11 },   // 0x89 '0x0160' U+0160
+  {   678,   7,  12,   9,    1,   -8 },   // 0x8a '0x015E' U+015E
+  {   689,   7,  12,   9,    1,  -11 },   // 0x8b '0x0164' U+0164
+  {   700,   6,  12,   8,    1,  -11 },   // 0x8c '0x0179' U+0179
+  {   709,   4,   1,   6,    1,   -3 },   // 0x8d '0x00AD' U+00AD
+  {   710,   6,  12,   8,    1,  -11 },   // 0x8e '0x017D' U+017D
+  {   719,   6,  12,   8,    1,  -11 },   // 0x8f '0x017B' U+017B
+  {   728,   4,   4,   6,    1,   -8 },   // 0x90 '0x00B0' U+00B0
+  {   730,   6,   9,   8,    1,   -6 },   // 0x91 '0x0105' U+0105
+  {   737,   3,   3,   3,    0,    1 },   // 0x92 '0x02DB' U+02DB
+  {   739,   4,   9,   4,    0,   -8 },   // 0x93 '0x0142' U+0142
+  {   744,   3,   2,   5,    1,   -9 },   // 0x94 '0x00B4' U+00B4
+  {   745,   4,  10,   4,    1,   -9 },   // 0x95 '0x013E' U+013E
+  {   750,   6,  10,   8,    1,   -9 },   // 0x96 '0x015B' U+015B
+  {   758,   4,   2,   6,    1,   -9 },   // 0x97 '0x02C7' U+02C7
+  {   759,   2,   3,   4,    1,    1 },   // 0x98 '0x00B8' U+00B8
+  {   760,   6,  10,   8,    1,   -9 },   // 0x99 '0x0161' U+0161
+  {   768,   6,  10,   8,    1,   -6 },   // 0x9a '0x015F' U+015F
+  {   776,   5,  10,   4,    0,   -9 },   // 0x9b '0x0165' U+0165
+  {   783,   5,  10,   7,    1,   -9 },   // 0x9c '0x017A' U+017A
+  {   790,   5,   2,   5,    0,   -9 },   // 0x9d '0x02DD' U+02DD
+  {   792,   5,  11,   7,    1,  -10 },   // 0x9e '0x017E' U+017E
+  {   799,   5,  10,   7,    1,   -9 },   // 0x9f '0x017C' U+017C
+  {   806,   6,  12,   8,    1,  -11 },   // 0xa0 '0x0154' U+0154
+  {   815,   9,  12,   9,    0,  -11 },   // 0xa1 '0x00C1' U+00C1
+  {   829,   9,  12,   9,    0,  -11 },   // 0xa2 '0x00C2' U+00C2
+  {   843,   9,  12,   9,    0,  -11 },   // 0xa3 '0x0102' U+0102
+  {   857,   9,  12,   9,    0,  -11 },   // 0xa4 '0x00C4' U+00C4
+  {   871,   6,  12,   7,    1,  -11 },   // 0xa5 '0x0139' U+0139
+  {   880,   8,  12,   9,    1,  -11 },   // 0xa6 '0x0106' U+0106
+  {   892,   7,  12,   9,    1,   -8 },   // 0xa7 '0x00C7' U+00C7
+  {   903,   8,  12,   9,    1,  -11 },   // 0xa8 '0x010C' U+010C
+  {   915,   6,  12,   8,    1,  -11 },   // 0xa9 '0x00C9' U+00C9
+  {   924,   6,  12,   8,    1,   -8 },   // 0xaa '0x0118' U+0118
+  {   933,   6,  12,   7,    1,  -11 },   // 0xab '0x00CB' U+00CB
+  {   942,   6,  12,   8,    1,  -11 },   // 0xac '0x011A' U+011A
+  {   951,   3,  12,   4,    1,  -11 },   // 0xad '0x00CD' U+00CD
+  {   956,   4,  12,   4,    0,  -11 },   // 0xae '0x00CE' U+00CE
+  {   962,   7,  12,   9,    1,  -11 },   // 0xaf '0x010E' U+010E
+  {   973,   8,   9,   9,    0,   -8 },   // 0xb0 '0x0110' U+0110
+  {   982,   7,  12,   9,    1,  -11 },   // 0xb1 '0x0143' U+0143
+  {   993,   7,  12,   9,    1,  -11 },   // 0xb2 '0x0147' U+0147
+  {  1004,   8,  12,  10,    1,  -11 },   // 0xb3 '0x00D3' U+00D3
+  {  1016,   8,  12,  10,    1,  -11 },   // 0xb4 '0x00D4' U+00D4
+  {  1028,   8,  12,  10,    1,  -11 },   // 0xb5 '0x0150' U+0150
+  {  1040,   8,  12,  10,    1,  -11 },   // 0xb6 '0x00D6' U+00D6
+  {  1052,   6,   7,   8,    1,   -6 },   // 0xb7 '0x00D7' U+00D7
+  {  1058,   6,  12,   8,    1,  -11 },   // 0xb8 '0x0158' U+0158
+  {  1067,   7,  13,   9,    1,  -12 },   // 0xb9 '0x016E' U+016E
+  {  1079,   7,  12,   9,    1,  -11 },   // 0xba '0x00DA' U+00DA
+  {  1090,   7,  12,   9,    1,  -11 },   // 0xbb '0x0170' U+0170
+  {  1101,   7,  12,   9,    1,  -11 },   // 0xbc '0x00DC' U+00DC
+  {  1112,   8,  12,   8,    0,  -11 },   // 0xbd '0x00DD' U+00DD
+  {  1124,   7,  12,   9,    1,   -8 },   // 0xbe '0x0162' U+0162
+  {  1135,   6,   9,   8,    1,   -8 },   // 0xbf '0x00DF' U+00DF
+  {  1142,   4,  10,   5,    1,   -9 },   // 0xc0 '0x0155' U+0155
+  {  1147,   6,  10,   8,    1,   -9 },   // 0xc1 '0x00E1' U+00E1
+  {  1155,   6,  10,   8,    1,   -9 },   // 0xc2 '0x00E2' U+00E2
+  {  1163,   6,   9,   8,    1,   -8 },   // 0xc3 '0x0103' U+0103
+  {  1170,   6,   9,   8,    1,   -8 },   // 0xc4 '0x00E4' U+00E4
+  {  1177,   3,  12,   4,    1,  -11 },   // 0xc5 '0x013A' U+013A
+  {  1182,   6,  10,   8,    1,   -9 },   // 0xc6 '0x0107' U+0107
+  {  1190,   6,  10,   7,    1,   -6 },   // 0xc7 '0x00E7' U+00E7
+  {  1198,   6,  10,   8,    1,   -9 },   // 0xc8 '0x010D' U+010D
+  {  1206,   6,  10,   8,    1,   -9 },   // 0xc9 '0x00E9' U+00E9
+  {  1214,   6,   9,   8,    1,   -6 },   // 0xca '0x0119' U+0119
+  {  1221,   6,   9,   8,    1,   -8 },   // 0xcb '0x00EB' U+00EB
+  {  1228,   6,  10,   8,    1,   -9 },   // 0xcc '0x011B' U+011B
+  {  1236,   3,  10,   4,    1,   -9 },   // 0xcd '0x00ED' U+00ED
+  {  1240,   4,  11,   4,    0,  -10 },   // 0xce '0x00EE' U+00EE
+  {  1246,   8,  10,   9,    1,   -9 },   // 0xcf '0x010F' U+010F
+  {  1256,   7,   9,   8,    1,   -8 },   // 0xd0 '0x0111' U+0111
+  {  1264,   6,  10,   8,    1,   -9 },   // 0xd1 '0x0144' U+0144
+  {  1272,   6,  10,   8,    1,   -9 },   // 0xd2 '0x0148' U+0148
+  {  1280,   6,  10,   8,    1,   -9 },   // 0xd3 '0x00F3' U+00F3
+  {  1288,   6,  10,   8,    1,   -9 },   // 0xd4 '0x00F4' U+00F4
+  {  1296,   6,  10,   8,    1,   -9 },   // 0xd5 '0x0151' U+0151
+  {  1304,   6,   9,   8,    1,   -8 },   // 0xd6 '0x00F6' U+00F6
+  {  1311,   6,   7,   8,    1,   -6 },   // 0xd7 '0x00F7' U+00F7
+  {  1317,   4,  11,   5,    1,  -10 },   // 0xd8 '0x0159' U+0159
+  {  1323,   6,  11,   8,    1,  -10 },   // 0xd9 '0x016F' U+016F
+  {  1332,   6,  10,   8,    1,   -9 },   // 0xda '0x00FA' U+00FA
+  {  1340,   6,  10,   8,    1,   -9 },   // 0xdb '0x0171' U+0171
+  {  1348,   6,   9,   8,    1,   -8 },   // 0xdc '0x00FC' U+00FC
+  {  1355,   6,  13,   6,    0,   -9 },   // 0xdd '0x00FD' U+00FD
+  {  1365,   4,  12,   4,    0,   -8 },   // 0xde '0x0163' U+0163
+  {  1371,   2,   2,   4,    1,   -9 } };   // 0xdf '0x02D9' U+002D9
+
+const GFXfont InterTight_SemiBold6pt8b PROGMEM = {
+  (uint8_t  *)InterTight_SemiBold6pt8bBitmaps,
+  (GFXglyph *)InterTight_SemiBold6pt8bGlyphs,
+  0x20, 0xDF, 14 };
+
+// Approx. 2723 bytes
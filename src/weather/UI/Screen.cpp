@@ -4,12 +4,23 @@
 #include "decodeutf8.h"
 #include "../Localization/Localization.hpp"
 #include "../consts.h"
+#include "../Logging/Profiler.hpp"
 #include <qrcode.h>
 
 WeatherScreen::WeatherScreen() : display()
 {
 }
 
+// "HH:MM" of an ISO timestamp ("2024-05-01T05:12"), or the start of a bare time
+static void isoTimeOfDay(const String &iso, char out[6])
+{
+    const char *text = iso.c_str();
+    const char *t = strchr(text, 'T');
+    if (t != nullptr && t != text) text = t + 1;
+    strncpy(out, text, 5);
+    out[5] = '\0';
+}
+
 void WeatherScreen::drawBootScreen()
 {
     display.beginDraw();
@@ -35,74 +46,118 @@ void WeatherScreen::drawBootScreen()
     display.endDraw();
 }
 
-void WeatherScreen::drawPopup(ScreenInfoData_t info)
+void WeatherScreen::drawPopup(const ScreenInfoData_t &info)
 {
     // Define popup dimensions - at bottom of screen, aligned to 8 pixels
     int popupHeight = 400;  // divisible by 8
     int popupWidth = display.getDisplayWidth();  // full width, divisible by 8
     int popupX = 0;
     int popupY = display.getDisplayHeight() - popupHeight;  // align to bottom
-    
-    display.setPopupMode(true, popupX, popupY, popupWidth, popupHeight);
-    display.beginDraw();
-    
-    // White background with border
-    display.fillRect(popupX, popupY, popupWidth, popupHeight, GxEPD_WHITE);
-    display.fillRect(popupX, popupY, popupWidth, 4, GxEPD_BLACK);  // Top border
-    
-    int contentY = popupY + 40;
     int centerX = display.getDisplayWidth() / 2;
     
-    // Title
+    // Layout first - each part is a window of its own on the popup surface
+    int contentY = popupY + 40;
+    int titleY = contentY;
     if (info.title.length() > 0) {
-        display.drawText(MEDIUM, info.title, centerX, contentY,
-            CENTER, LEADING, 0, 0, GxEPD_BLACK);
         contentY += 50;
     }
     
-    // QR Code
+    QRCode qrcode;
+    uint8_t qrcodeData[(QR_SIZE * QR_SIZE + 7) / 8];
+    int qrSize = 0, scale = 0, qrDrawSize = 0;
+    int qrX = 0, qrY = contentY;
     if (info.qrCode.length() > 0) {
-        // Generate QR code
-        QRCode qrcode;
-        uint8_t qrcodeData[qrcode_getBufferSize(3)];
-        qrcode_initText(&qrcode, qrcodeData, 3, ECC_LOW, info.qrCode.c_str());
-        
-        int qrSize = qrcode.size;
-        int scale = min((popupHeight - 120) / qrSize, 6);  // Scale QR to fit
-        int qrDrawSize = qrSize * scale;
-        int qrX = centerX - qrDrawSize / 2;
-        int qrY = contentY;
-        
-        for (int y = 0; y < qrSize; y++) {
-            for (int x = 0; x < qrSize; x++) {
-                if (qrcode_getModule(&qrcode, x, y)) {
-                    display.fillRect(qrX + x * scale, qrY + y * scale, scale, scale, GxEPD_BLACK);
-                }
-            }
-        }
+        qrcode_initText(&qrcode, qrcodeData, QR_VERSION, ECC_LOW, info.qrCode.c_str());
+        qrSize = qrcode.size;
+        scale = min((popupHeight - 120) / qrSize, 6);  // Scale QR to fit
+        qrDrawSize = qrSize * scale;
+        qrX = centerX - qrDrawSize / 2;
         contentY += qrDrawSize + 20;
     }
-    
-    // Subtitle
+    int subtitleY = contentY;
+    
+    char tempStr[16];
+    snprintf(tempStr, sizeof(tempStr), "%.1f°C", info.temperature);
+    int tempX = popupX + popupWidth - 20, tempY = popupY + popupHeight - 30;
+    
+    // A window around everything each part inks, on whole bytes so neighbours
+    // never share a buffer byte - pixels outside all windows are dropped
+    display.beginPopupSurface(popupX, popupY, popupWidth, popupHeight);
+    auto addWindow = [&](int x, int y, int w, int h) {
+        int x0 = x / 8 * 8, y0 = y / 8 * 8;
+        display.addPopupWindow(x0, y0, (x + w + 7) / 8 * 8 - x0, (y + h + 7) / 8 * 8 - y0);
+    };
+    int borderBottom = popupY + 4;
+    if (info.title.length() > 0) {
+        Rectangle_t title = display.textInkBounds(MEDIUM, info.title, centerX, titleY, CENTER, LEADING, 0, 0);
+        borderBottom = max(borderBottom, title.y + title.h);
+    }
+    addWindow(popupX, popupY, popupWidth, borderBottom - popupY);  // Border and title
+    if (qrSize > 0) {
+        addWindow(qrX, qrY, qrDrawSize, qrDrawSize);
+    }
     if (info.subtitle.length() > 0) {
-        display.drawText(SMALL, info.subtitle, centerX, contentY,
-            CENTER, LEADING, 0, 0, GxEPD_DARKGREY);
+        Rectangle_t subtitle = display.textInkBounds(SMALL, info.subtitle, centerX, subtitleY, CENTER, LEADING, 0, 0);
+        addWindow(subtitle.x, subtitle.y, subtitle.w, subtitle.h);
     }
-    
-    // Temperature (if shown)
     if (info.showTemperature) {
-        String tempStr = String(info.temperature, 1) + "°C";
-        display.drawText(SMALL, tempStr, popupX + popupWidth - 20, popupY + popupHeight - 30,
-            TRAILING, TRAILING, 0, 0, GxEPD_DARKGREY);
+        Rectangle_t temp = display.textInkBounds(SMALL, tempStr, tempX, tempY, TRAILING, TRAILING, 0, 0);
+        addWindow(temp.x, temp.y, temp.w, temp.h);
     }
     
-    // Use windowed partial refresh - only updates popup area
-    display.updateWindow(popupX, popupY, popupWidth, popupHeight);
+    // Modules as a 1bpp bitmap, blitted at the module scale
+    int qrStride = (qrSize + 7) / 8;
+    uint8_t qrRows[(QR_SIZE + 7) / 8 * QR_SIZE];
+    memset(qrRows, 0, sizeof(qrRows));
+    for (int y = 0; y < qrSize; y++) {
+        for (int x = 0; x < qrSize; x++) {
+            if (qrcode_getModule(&qrcode, x, y)) {
+                qrRows[y * qrStride + x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+    }
+    Bitmap_t qrBitmap = { (uint16_t)qrSize, (uint16_t)qrSize, 1, BITMAP_ROWS, qrRows };
+    
+    if (!display.firstPopupWindow()) {
+        // No buffer for the first window - the panel keeps what it shows
+        display.setPopupMode(false);
+        return;
+    }
+    do {
+        // White background with border
+        display.fillRect(popupX, popupY, popupWidth, popupHeight, GxEPD_WHITE);
+        display.fillRect(popupX, popupY, popupWidth, 4, GxEPD_BLACK);  // Top border
+        
+        // Title
+        if (info.title.length() > 0) {
+            display.drawText(MEDIUM, info.title, centerX, titleY,
+                CENTER, LEADING, 0, 0, GxEPD_BLACK);
+        }
+        
+        // QR Code
+        if (qrSize > 0) {
+            display.blit(&qrBitmap, qrX, qrY, scale, BLIT_SET, GxEPD_BLACK);
+        }
+        
+        // Subtitle
+        if (info.subtitle.length() > 0) {
+            display.drawText(SMALL, info.subtitle, centerX, subtitleY,
+                CENTER, LEADING, 0, 0, GxEPD_DARKGREY);
+        }
+        
+        // Temperature (if shown)
+        if (info.showTemperature) {
+            display.drawText(SMALL, tempStr, tempX, tempY,
+                TRAILING, TRAILING, 0, 0, GxEPD_DARKGREY);
+        }
+    } while (display.nextPopupWindow());
+    
+    // One partial refresh of the popup area, after the last window
     display.endDraw();
     display.setPopupMode(false);
 }
 
-void WeatherScreen::drawWebSetupPopupOverlay(String softAPSSID, String softAPIP, String staSSID, String staIP)
+void WeatherScreen::drawWebSetupPopupOverlay(const String &softAPSSID, const String &softAPIP, const String &staSSID, const String &staIP)
 {
     // Draw popup at bottom, aligned to 8 pixels
     int popupHeight = 200;  // divisible by 8: 200 = 25*8
@@ -125,20 +180,25 @@ void WeatherScreen::drawWebSetupPopupOverlay(String softAPSSID, String softAPIP,
     textY += 35;
     
     // Show AP info
-    display.drawText(TINY, "WiFi: " + softAPSSID, textX, textY,
+    char line[EPD102_TEXT_BUFFER];
+    snprintf(line, sizeof(line), "WiFi: %s", softAPSSID.c_str());
+    display.drawText(TINY, line, textX, textY,
         LEADING, LEADING, 0, 0, GxEPD_DARKGREY);
     textY += 25;
     
-    display.drawText(TINY, "IP: " + softAPIP, textX, textY,
+    snprintf(line, sizeof(line), "IP: %s", softAPIP.c_str());
+    display.drawText(TINY, line, textX, textY,
         LEADING, LEADING, 0, 0, GxEPD_DARKGREY);
     textY += 35;
     
     // Show STA info if connected
     if (staIP != "0.0.0.0") {
-        display.drawText(TINY, String(Localization::get(STR_STATUS_CONNECTED_TO)) + ": " + staSSID, textX, textY,
+        snprintf(line, sizeof(line), "%s: %s", Localization::get(STR_STATUS_CONNECTED_TO), staSSID.c_str());
+        display.drawText(TINY, line, textX, textY,
             LEADING, LEADING, 0, 0, GxEPD_DARKGREY);
         textY += 25;
-        display.drawText(TINY, "IP: " + staIP, textX, textY,
+        snprintf(line, sizeof(line), "IP: %s", staIP.c_str());
+        display.drawText(TINY, line, textX, textY,
             LEADING, LEADING, 0, 0, GxEPD_DARKGREY);
     }
     
@@ -148,47 +208,88 @@ void WeatherScreen::drawWebSetupPopupOverlay(String softAPSSID, String softAPIP,
     display.setPopupMode(false);
 }
 
+void WeatherScreen::drawClock(time_t currentTime)
+{
+    // Time box of the header bar - same text position as drawHeaderBar()
+    int clockX = display.getDisplayWidth() / 2 - CLOCK_WIDTH / 2;
+    int clockY = 0;
+    
+    struct tm timeinfo;
+    localtime_r(&currentTime, &timeinfo);
+    char timeStr[10];
+    sprintf(timeStr, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+    
+    display.setPopupMode(true, clockX, clockY, CLOCK_WIDTH, HEADER_HEIGHT);
+    display.beginDraw();
+    
+    display.fillRect(clockX, clockY, CLOCK_WIDTH, HEADER_HEIGHT, GxEPD_BLACK);
+    display.drawText(MEDIUM, timeStr, display.getDisplayWidth() / 2, clockY + 12,
+        CENTER, LEADING, 0, 0, GxEPD_WHITE);
+    
+    display.updateWindow(clockX, clockY, CLOCK_WIDTH, HEADER_HEIGHT);
+    display.endDraw();
+    display.setPopupMode(false);
+}
+
 // ============================================================================
 // ULTIMATE WEATHER DASHBOARD - Maximum Information Density
 // ============================================================================
 
 void WeatherScreen::drawWeatherScreen(WeatherScreenData_t& screenData, WeatherData_t& weatherData)
 {
+    // Lay the dashboard out once; every page then only replays the primitives
+    // that touch it. If the display list cannot hold the frame, fall back to
+    // running the layout inside the paging loop.
+    PROFILE_FRAME_BEGIN();
+    bool recorded = display.beginRecording();
+    if (recorded) {
+        drawDashboard(screenData, weatherData);
+        recorded = display.endRecording();
+    }
+    
     display.beginDraw();
     display.firstPage();
     do {
         display.clear();
-        
-        int screenW = display.getDisplayWidth();   // 640
-        int screenH = display.getDisplayHeight();  // 960
-        
-        int y = 0;
-        
-        // ========== HEADER BAR (compact) ==========
-        drawHeaderBar(0, y, screenW, screenData, weatherData.current);
-        y += 50;
-        
-        // ========== MAIN CURRENT WEATHER (hero section) ==========
-        drawCurrentWeatherHero(0, y, screenW, 180, weatherData.current);
-        y += 185;
-        
-        // ========== WEATHER DETAILS GRID (2x3 cards) ==========
-        drawWeatherDetailsGrid(0, y, screenW, 120, weatherData.current, weatherData.daily[0]);
-        y += 125;
-        
-        // ========== HOURLY FORECAST (next 8 hours) ==========
-        drawHourlyTimeline(0, y, screenW, 130, weatherData.hourly, weatherData.hourlyCount, screenData.currentTime);
-        y += 135;
-        
-        // ========== 7-DAY FORECAST ==========
-        draw7DayForecast(0, y, screenW, 290, weatherData.daily, weatherData.dailyCount);
-        y += 295;
-        
-        // ========== SUN & MOON INFO ==========
-        drawSunMoonInfo(0, y, screenW, 70, weatherData.daily[0], screenData.currentTime);
-        
+        if (recorded) {
+            display.replay();
+        } else {
+            drawDashboard(screenData, weatherData);
+        }
     } while (display.nextPage());
     display.endDraw();
+    PROFILE_FRAME_END(display.getPageCount());
+}
+
+void WeatherScreen::drawDashboard(WeatherScreenData_t& screenData, WeatherData_t& weatherData)
+{
+    int screenW = display.getDisplayWidth();   // 640
+    int screenH = display.getDisplayHeight();  // 960
+    
+    int y = 0;
+    
+    // ========== HEADER BAR (compact) ==========
+    drawHeaderBar(0, y, screenW, screenData, weatherData.current);
+    y += 50;
+    
+    // ========== MAIN CURRENT WEATHER (hero section) ==========
+    drawCurrentWeatherHero(0, y, screenW, 180, weatherData.current);
+    y += 185;
+    
+    // ========== WEATHER DETAILS GRID (2x3 cards) ==========
+    drawWeatherDetailsGrid(0, y, screenW, 120, weatherData.current, weatherData.daily[0]);
+    y += 125;
+    
+    // ========== HOURLY FORECAST (next 8 hours) ==========
+    drawHourlyTimeline(0, y, screenW, 130, weatherData.hourly, weatherData.hourlyCount, screenData.currentTime);
+    y += 135;
+    
+    // ========== 7-DAY FORECAST ==========
+    draw7DayForecast(0, y, screenW, 290, weatherData.daily, weatherData.dailyCount);
+    y += 295;
+    
+    // ========== SUN & MOON INFO ==========
+    drawSunMoonInfo(0, y, screenW, 70, weatherData.daily[0], screenData.currentTime);
 }
 
 // ============================================================================
@@ -197,11 +298,13 @@ void WeatherScreen::drawWeatherScreen(WeatherScreenData_t& screenData, WeatherDa
 
 void WeatherScreen::drawHeaderBar(int x, int y, int width, WeatherScreenData_t& screenData, CurrentWeather_t& current)
 {
+    PROFILE_SCOPE(PROFILE_HEADER);
+    
     struct tm timeinfo;
     localtime_r(&screenData.currentTime, &timeinfo);
     
     // INVERTED header bar - black background, white text
-    display.fillRect(x, y, width, 48, GxEPD_BLACK);
+    display.fillRect(x, y, width, HEADER_HEIGHT, GxEPD_BLACK);
     
     // Location name (left side) - WHITE on black
     display.drawText(MEDIUM, screenData.locationName, x + MARGIN, y + 12, 
@@ -214,8 +317,8 @@ void WeatherScreen::drawHeaderBar(int x, int y, int width, WeatherScreenData_t&
         CENTER, LEADING, 0, 0, GxEPD_WHITE);
     
     // Date (right of center) - WHITE
-    String dateStr = String(timeinfo.tm_mday) + ". " + 
-                     String(Localization::getMonthShort(timeinfo.tm_mon));
+    char dateStr[24];
+    snprintf(dateStr, sizeof(dateStr), "%d. %s", timeinfo.tm_mday, Localization::getMonthShort(timeinfo.tm_mon));
     display.drawText(SMALL, dateStr, width / 2 + 60, y + 15,
         LEADING, LEADING, 0, 0, GxEPD_WHITE);
     
@@ -236,11 +339,13 @@ void WeatherScreen::drawHeaderBar(int x, int y, int width, WeatherScreenData_t&
 
 void WeatherScreen::drawCurrentWeatherHero(int x, int y, int width, int height, CurrentWeather_t& current)
 {
+    PROFILE_SCOPE(PROFILE_HERO);
+    
     bool isDay = current.isDay;
     int centerX = x + width / 2;
     
     // Large weather icon (left)
-    int iconSize = 140;
+    int iconSize = WEATHER_ICON_SIZE_CURRENT;
     int iconX = x + MARGIN + 20;
     int iconY = y + (height - iconSize) / 2;
     drawWeatherIcon(iconX, iconY, iconSize, current.weatherCode, isDay);
@@ -248,16 +353,18 @@ void WeatherScreen::drawCurrentWeatherHero(int x, int y, int width, int height,
     // Giant temperature (center-right)
     int tempX = x + 200;
     int tempY = y + 10;
-    String tempStr = String((int)round(current.temperature)) + "°";
+    char tempStr[12];
+    snprintf(tempStr, sizeof(tempStr), "%d°", (int)round(current.temperature));
     display.drawText(HUGE, tempStr, tempX, tempY, LEADING, LEADING, 0, 0, GxEPD_BLACK);
     
     // Weather description (below temp)
-    String weatherDesc = getWeatherDescription(current.weatherCode);
+    const char *weatherDesc = getWeatherDescription(current.weatherCode);
     display.drawText(MEDIUM, weatherDesc, tempX, tempY + 90, LEADING, LEADING, 0, 0, GxEPD_BLACK);
     
     // Feels like (below description) - black text, no grey
-    String feelsLike = String(Localization::get(STR_WEATHER_FEELS_LIKE)) + " " + 
-                       String((int)round(current.apparentTemperature)) + "°";
+    char feelsLike[40];
+    snprintf(feelsLike, sizeof(feelsLike), "%s %d°", Localization::get(STR_WEATHER_FEELS_LIKE),
+        (int)round(current.apparentTemperature));
     display.drawText(SMALL, feelsLike, tempX, tempY + 125, LEADING, LEADING, 0, 0, GxEPD_BLACK);
     
     // Day/Night indicator in inverted box
@@ -266,7 +373,7 @@ void WeatherScreen::drawCurrentWeatherHero(int x, int y, int width, int height,
     int indicatorX = width - MARGIN - indicatorW;
     int indicatorY = y + 10;
     display.fillRect(indicatorX, indicatorY, indicatorW, indicatorH, GxEPD_BLACK);
-    String dayNight = isDay ? "DEN" : "NOC";
+    const char *dayNight = isDay ? "DEN" : "NOC";
     display.drawText(TINY, dayNight, indicatorX + indicatorW/2, indicatorY + 8, CENTER, LEADING, 0, 0, GxEPD_WHITE);
 }
 
@@ -276,50 +383,62 @@ void WeatherScreen::drawCurrentWeatherHero(int x, int y, int width, int height,
 
 void WeatherScreen::drawWeatherDetailsGrid(int x, int y, int width, int height, CurrentWeather_t& current, DailyForecast_t& today)
 {
+    PROFILE_SCOPE(PROFILE_DETAILS);
+    
     int cardWidth = (width - 2 * MARGIN - 10) / 3;  // 3 cards per row
     int cardHeight = (height - 5) / 2;  // 2 rows
     int spacing = 5;
     
     int startX = x + MARGIN;
+    char value[24];
+    char subtext[24];
     
     // Row 1: Wind, Humidity, Precipitation
+    snprintf(value, sizeof(value), "%d km/h", (int)current.windSpeed);
     drawMetricCard(startX, y, cardWidth, cardHeight, 
         Localization::get(STR_LABEL_WIND), 
-        String((int)current.windSpeed) + " km/h",
+        value,
         getWindDirection(current.windDirection));
     
+    snprintf(value, sizeof(value), "%d%%", current.humidity);
     drawMetricCard(startX + cardWidth + spacing, y, cardWidth, cardHeight,
         Localization::get(STR_LABEL_HUMIDITY),
-        String(current.humidity) + "%",
+        value,
         current.humidity > 70 ? "Vysoká" : (current.humidity < 30 ? "Nízká" : "OK"));
     
+    snprintf(value, sizeof(value), "%.1f mm", current.precipitation);
+    snprintf(subtext, sizeof(subtext), "%d%% prob.", today.precipitationProbability);
     drawMetricCard(startX + 2 * (cardWidth + spacing), y, cardWidth, cardHeight,
         Localization::get(STR_LABEL_PRECIPITATION),
-        String(current.precipitation, 1) + " mm",
-        String(today.precipitationProbability) + "% prob.");
+        value,
+        subtext);
     
     // Row 2: High/Low, Rain Chance, UV (estimated)
     int row2Y = y + cardHeight + spacing;
     
+    snprintf(value, sizeof(value), "%d° / %d°", (int)round(today.tempMax), (int)round(today.tempMin));
     drawMetricCard(startX, row2Y, cardWidth, cardHeight,
         "Max/Min",
-        String((int)round(today.tempMax)) + "° / " + String((int)round(today.tempMin)) + "°",
+        value,
         "");
     
+    snprintf(value, sizeof(value), "%.1f mm", today.precipitationSum);
+    snprintf(subtext, sizeof(subtext), "%d%%", today.precipitationProbability);
     drawMetricCard(startX + cardWidth + spacing, row2Y, cardWidth, cardHeight,
         "Srážky dnes",
-        String(today.precipitationSum, 1) + " mm",
-        String(today.precipitationProbability) + "%");
+        value,
+        subtext);
     
     // UV Index estimation
     int uvIndex = estimateUVIndex(current.weatherCode, current.isDay);
+    snprintf(value, sizeof(value), "%d", uvIndex);
     drawMetricCard(startX + 2 * (cardWidth + spacing), row2Y, cardWidth, cardHeight,
         Localization::get(STR_LABEL_UV_INDEX),
-        String(uvIndex),
+        value,
         getUVLevelText(uvIndex));
 }
 
-void WeatherScreen::drawMetricCard(int x, int y, int w, int h, String label, String value, String subtext)
+void WeatherScreen::drawMetricCard(int x, int y, int w, int h, const char *label, const char *value, const char *subtext)
 {
     // Card with BLACK border, no grey
     display.fillRect(x, y, w, h, GxEPD_WHITE);
@@ -339,7 +458,7 @@ void WeatherScreen::drawMetricCard(int x, int y, int w, int h, String label, Str
     display.drawText(MEDIUM, value, centerX, y + 24, CENTER, LEADING, 0, 0, GxEPD_BLACK);
     
     // Subtext (bottom) - BLACK, smaller
-    if (subtext.length() > 0) {
+    if (subtext[0] != '\0') {
         display.drawText(EXTRA_SMALL, subtext, centerX, y + 45, CENTER, LEADING, 0, 0, GxEPD_BLACK);
     }
 }
@@ -350,6 +469,8 @@ void WeatherScreen::drawMetricCard(int x, int y, int w, int h, String label, Str
 
 void WeatherScreen::drawHourlyTimeline(int x, int y, int width, int height, HourlyForecast_t* hourly, int count, time_t currentTime)
 {
+    PROFILE_SCOPE(PROFILE_HOURLY);
+    
     // Section title - inverted
     display.fillRect(x, y, width, 22, GxEPD_BLACK);
     display.drawText(SMALL, Localization::get(STR_WEATHER_HOURLY), x + MARGIN, y + 3, 
@@ -358,7 +479,7 @@ void WeatherScreen::drawHourlyTimeline(int x, int y, int width, int height, Hour
     int contentY = y + 28;
     int hoursToShow = min(count, 8);
     int columnWidth = (width - 2 * MARGIN) / hoursToShow;
-    int iconSize = 36;
+    int iconSize = WEATHER_ICON_SIZE_HOURLY;
     
     struct tm currentTm;
     localtime_r(&currentTime, &currentTm);
@@ -381,12 +502,14 @@ void WeatherScreen::drawHourlyTimeline(int x, int y, int width, int height, Hour
             drawWeatherIcon(colX - iconSize/2, contentY + 16, iconSize, h.weatherCode, isDay);
             
             // Temperature - BLACK
-            String tempStr = String((int)round(h.temperature)) + "°";
+            char tempStr[12];
+            snprintf(tempStr, sizeof(tempStr), "%d°", (int)round(h.temperature));
             display.drawText(SMALL, tempStr, colX, contentY + 56, CENTER, LEADING, 0, 0, GxEPD_BLACK);
             
             // Precipitation probability (if > 0) - in small inverted box
             if (h.precipitationProbability > 0) {
-                String probStr = String(h.precipitationProbability) + "%";
+                char probStr[16];
+                snprintf(probStr, sizeof(probStr), "%d%%", h.precipitationProbability);
                 int probW = 30;
                 display.fillRect(colX - probW/2, contentY + 76, probW, 14, GxEPD_BLACK);
                 display.drawText(EXTRA_SMALL, probStr, colX, contentY + 77, CENTER, LEADING, 0, 0, GxEPD_WHITE);
@@ -404,15 +527,19 @@ void WeatherScreen::drawHourlyTimeline(int x, int y, int width, int height, Hour
 
 void WeatherScreen::draw7DayForecast(int x, int y, int width, int height, DailyForecast_t* daily, int count)
 {
+    PROFILE_SCOPE(PROFILE_FORECAST);
+    
     // Section title - inverted
     display.fillRect(x, y, width, 22, GxEPD_BLACK);
-    display.drawText(SMALL, "7 " + String(Localization::get(STR_WEATHER_DAILY)), x + MARGIN, y + 3, 
+    char title[32];
+    snprintf(title, sizeof(title), "7 %s", Localization::get(STR_WEATHER_DAILY));
+    display.drawText(SMALL, title, x + MARGIN, y + 3, 
         LEADING, LEADING, 0, 0, GxEPD_WHITE);
     
     int contentY = y + 26;
     int daysToShow = min(count, 7);
     int rowHeight = (height - 32) / daysToShow;
-    int iconSize = 32;
+    int iconSize = WEATHER_ICON_SIZE_DAILY;
     
     for (int d = 0; d < daysToShow; d++) {
         DailyForecast_t& day = daily[d];
@@ -429,7 +556,7 @@ void WeatherScreen::draw7DayForecast(int x, int y, int width, int height, DailyF
         int colX = x + MARGIN + 5;
         
         // Day name (Today, Tomorrow, or day name)
-        String dayName;
+        const char *dayName;
         if (d == 0) {
             dayName = Localization::get(STR_LABEL_TODAY);
         } else if (d == 1) {
@@ -440,31 +567,31 @@ void WeatherScreen::draw7DayForecast(int x, int y, int width, int height, DailyF
         display.drawText(SMALL, dayName, colX, rowY + 6, LEADING, LEADING, 0, 0, textColor);
         
         // Date
-        String dateStr = String(day.dayOfMonth) + "." + String(day.month + 1) + ".";
+        char dateStr[32];
+        snprintf(dateStr, sizeof(dateStr), "%d.%d.", day.dayOfMonth, day.month + 1);
         display.drawText(EXTRA_SMALL, dateStr, colX + 70, rowY + 9, LEADING, LEADING, 0, 0, textColor);
         
-        // Weather icon - need inverted version for dark rows
-        if (inverted) {
-            drawWeatherIconInverted(colX + 120, rowY + 3, iconSize, day.weatherCode, true);
-        } else {
-            drawWeatherIcon(colX + 120, rowY + 3, iconSize, day.weatherCode, true);
-        }
+        // Weather icon - white on dark rows
+        drawWeatherIcon(colX + 120, rowY + 3, iconSize, day.weatherCode, true, textColor);
         
         // Weather description (short)
-        String desc = getWeatherDescriptionShort(day.weatherCode);
+        const char *desc = getWeatherDescriptionShort(day.weatherCode);
         display.drawText(EXTRA_SMALL, desc, colX + 165, rowY + 11, LEADING, LEADING, 0, 0, textColor);
         
         // High temperature
-        String highStr = String((int)round(day.tempMax)) + "°";
+        char highStr[12];
+        snprintf(highStr, sizeof(highStr), "%d°", (int)round(day.tempMax));
         display.drawText(SMALL, highStr, width - MARGIN - 90, rowY + 6, TRAILING, LEADING, 0, 0, textColor);
         
         // Low temperature (slightly smaller emphasis)
-        String lowStr = String((int)round(day.tempMin)) + "°";
+        char lowStr[12];
+        snprintf(lowStr, sizeof(lowStr), "%d°", (int)round(day.tempMin));
         display.drawText(TINY, lowStr, width - MARGIN - 50, rowY + 9, TRAILING, LEADING, 0, 0, textColor);
         
         // Precipitation chance
         if (day.precipitationProbability > 0) {
-            String probStr = String(day.precipitationProbability) + "%";
+            char probStr[16];
+            snprintf(probStr, sizeof(probStr), "%d%%", day.precipitationProbability);
             display.drawText(EXTRA_SMALL, probStr, width - MARGIN - 5, rowY + 9, TRAILING, LEADING, 0, 0, textColor);
         }
     }
@@ -476,19 +603,19 @@ void WeatherScreen::draw7DayForecast(int x, int y, int width, int height, DailyF
 
 void WeatherScreen::drawSunMoonInfo(int x, int y, int width, int height, DailyForecast_t& today, time_t currentTime)
 {
+    PROFILE_SCOPE(PROFILE_SUN_MOON);
+    
     // INVERTED footer - black background, white text
     display.fillRect(x, y, width, height, GxEPD_BLACK);
     
     int thirdWidth = width / 3;
     int contentY = y + 12;
     
-    // Parse times
-    String sunriseTime = today.sunrise;
-    String sunsetTime = today.sunset;
-    int tIdx = sunriseTime.indexOf('T');
-    if (tIdx > 0) sunriseTime = sunriseTime.substring(tIdx + 1, tIdx + 6);
-    tIdx = sunsetTime.indexOf('T');
-    if (tIdx > 0) sunsetTime = sunsetTime.substring(tIdx + 1, tIdx + 6);
+    // Parse times - "HH:MM" after the 'T' of the ISO timestamps
+    char sunriseTime[6];
+    char sunsetTime[6];
+    isoTimeOfDay(today.sunrise, sunriseTime);
+    isoTimeOfDay(today.sunset, sunsetTime);
     
     // Sunrise (left) - white text on black
     display.drawText(EXTRA_SMALL, Localization::get(STR_LABEL_SUNRISE), x + MARGIN, contentY, 
@@ -497,17 +624,18 @@ void WeatherScreen::drawSunMoonInfo(int x, int y, int width, int height, DailyFo
         LEADING, LEADING, 0, 0, GxEPD_WHITE);
     
     // Day length (center)
-    int sunriseH = sunriseTime.substring(0, 2).toInt();
-    int sunriseM = sunriseTime.substring(3, 5).toInt();
-    int sunsetH = sunsetTime.substring(0, 2).toInt();
-    int sunsetM = sunsetTime.substring(3, 5).toInt();
+    int sunriseH = atoi(sunriseTime);
+    int sunriseM = atoi(sunriseTime + 3);
+    int sunsetH = atoi(sunsetTime);
+    int sunsetM = atoi(sunsetTime + 3);
     int dayMinutes = (sunsetH * 60 + sunsetM) - (sunriseH * 60 + sunriseM);
     int dayHours = dayMinutes / 60;
     int dayMins = dayMinutes % 60;
     
     display.drawText(EXTRA_SMALL, "Délka dne", x + thirdWidth + 20, contentY, 
         LEADING, LEADING, 0, 0, GxEPD_WHITE);
-    String dayLengthStr = String(dayHours) + "h " + String(dayMins) + "m";
+    char dayLengthStr[16];
+    snprintf(dayLengthStr, sizeof(dayLengthStr), "%dh %dm", dayHours, dayMins);
     display.drawText(MEDIUM, dayLengthStr, x + thirdWidth + 20, contentY + 18, 
         LEADING, LEADING, 0, 0, GxEPD_WHITE);
     
@@ -521,7 +649,7 @@ void WeatherScreen::drawSunMoonInfo(int x, int y, int width, int height, DailyFo
     struct tm timeinfo;
     localtime_r(&currentTime, &timeinfo);
     char updateStr[32];
-    sprintf(updateStr, "%s %02d:%02d", Localization::get(STR_WEATHER_UPDATED), timeinfo.tm_hour, timeinfo.tm_min);
+    snprintf(updateStr, sizeof(updateStr), "%s %02d:%02d", Localization::get(STR_WEATHER_UPDATED), timeinfo.tm_hour, timeinfo.tm_min);
     display.drawText(EXTRA_SMALL, updateStr, width - MARGIN - 5, contentY + 25, 
         TRAILING, LEADING, 0, 0, GxEPD_WHITE);
 }
@@ -530,7 +658,7 @@ void WeatherScreen::drawSunMoonInfo(int x, int y, int width, int height, DailyFo
 // Helper Functions
 // ============================================================================
 
-String WeatherScreen::getWeatherDescription(int weatherCode) {
+const char *WeatherScreen::getWeatherDescription(int weatherCode) {
     // Map WMO codes to localized descriptions
     if (weatherCode == 0) return Localization::get(STR_WEATHER_CLEAR);
     if (weatherCode <= 3) return Localization::get((StringID)(STR_WEATHER_CLEAR + min(weatherCode, 3)));
@@ -545,7 +673,7 @@ String WeatherScreen::getWeatherDescription(int weatherCode) {
     return Localization::get(STR_WEATHER_UNKNOWN);
 }
 
-String WeatherScreen::getWeatherDescriptionShort(int weatherCode) {
+const char *WeatherScreen::getWeatherDescriptionShort(int weatherCode) {
     // Shorter versions for compact display
     if (weatherCode == 0) return "Jasno";
     if (weatherCode == 1) return "Jasno";
@@ -562,10 +690,10 @@ String WeatherScreen::getWeatherDescriptionShort(int weatherCode) {
     return "?";
 }
 
-String WeatherScreen::getWindDirection(int degrees) {
-    const char* directions[] = {"S", "SV", "V", "JV", "J", "JZ", "Z", "SZ"};
+const char *WeatherScreen::getWindDirection(int degrees) {
+    static const char* const directions[] = {"S", "SV", "V", "JV", "J", "JZ", "Z", "SZ"};
     int index = ((degrees + 22) % 360) / 45;
-    return String(directions[index]);
+    return directions[index];
 }
 
 int WeatherScreen::estimateUVIndex(int weatherCode, bool isDay) {
@@ -578,7 +706,7 @@ int WeatherScreen::estimateUVIndex(int weatherCode, bool isDay) {
     return 3;
 }
 
-String WeatherScreen::getUVLevelText(int uvIndex) {
+const char *WeatherScreen::getUVLevelText(int uvIndex) {
     if (uvIndex <= 2) return Localization::get(STR_UV_LOW);
     if (uvIndex <= 5) return Localization::get(STR_UV_MODERATE);
     if (uvIndex <= 7) return Localization::get(STR_UV_HIGH);
@@ -621,60 +749,12 @@ void WeatherScreen::drawHorizontalLine(int x, int y, int width)
     display.fillRect(x, y, width, 2, GxEPD_BLACK);
 }
 
-void WeatherScreen::drawWeatherIcon(int x, int y, int size, int weatherCode, bool isDay)
-{
-    const uint8_t* icon = getWeatherIcon(weatherCode, isDay);
-    
-    // Scale icon to desired size (icons are 64x64)
-    float scale = (float)size / 64.0f;
-    
-    // Draw icon bitmap - BLACK pixels on white background
-    for (int iy = 0; iy < 64; iy++) {
-        for (int ix = 0; ix < 64; ix++) {
-            int byteIdx = (iy * 64 + ix) / 8;
-            int bitIdx = 7 - (ix % 8);
-            
-            if (pgm_read_byte(&icon[byteIdx]) & (1 << bitIdx)) {
-                int dx = x + (int)(ix * scale);
-                int dy = y + (int)(iy * scale);
-                
-                if (scale >= 1.5f) {
-                    int blockSize = (int)scale;
-                    display.fillRect(dx, dy, blockSize, blockSize, GxEPD_BLACK);
-                } else {
-                    display.drawPixel(dx, dy, GxEPD_BLACK);
-                }
-            }
-        }
-    }
-}
-
-void WeatherScreen::drawWeatherIconInverted(int x, int y, int size, int weatherCode, bool isDay)
+void WeatherScreen::drawWeatherIcon(int x, int y, int size, int weatherCode, bool isDay, uint16_t color)
 {
-    const uint8_t* icon = getWeatherIcon(weatherCode, isDay);
-    
-    // Scale icon to desired size (icons are 64x64)
-    float scale = (float)size / 64.0f;
-    
-    // Draw icon bitmap - WHITE pixels on black background
-    for (int iy = 0; iy < 64; iy++) {
-        for (int ix = 0; ix < 64; ix++) {
-            int byteIdx = (iy * 64 + ix) / 8;
-            int bitIdx = 7 - (ix % 8);
-            
-            if (pgm_read_byte(&icon[byteIdx]) & (1 << bitIdx)) {
-                int dx = x + (int)(ix * scale);
-                int dy = y + (int)(iy * scale);
-                
-                if (scale >= 1.5f) {
-                    int blockSize = (int)scale;
-                    display.fillRect(dx, dy, blockSize, blockSize, GxEPD_WHITE);
-                } else {
-                    display.drawPixel(dx, dy, GxEPD_WHITE);
-                }
-            }
-        }
-    }
+    // Icon pixels in color (WHITE on dark rows), background left as drawn. A
+    // size without its own raster gets a smaller one, centred in the box.
+    const Bitmap_t *icon = getWeatherIconBitmap(getWeatherIcon(weatherCode, isDay), size);
+    display.blit(icon, x + (size - icon->width) / 2, y + (size - icon->height) / 2, 1, BLIT_TRANSPARENT, color);
 }
 
 void WeatherScreen::drawBatteryIcon(int x, int y, int level)
@@ -58,17 +58,22 @@ public:
     /**
      * Draw popup overlay (for status messages, QR codes, etc.)
      */
-    void drawPopup(ScreenInfoData_t info);
+    void drawPopup(const ScreenInfoData_t &info);
     
     /**
      * Draw the main weather screen
      */
     void drawWeatherScreen(WeatherScreenData_t& screenData, WeatherData_t& weatherData);
     
+    /**
+     * Repaint only the header clock (windowed partial refresh)
+     */
+    void drawClock(time_t currentTime);
+    
     /**
      * Draw web setup popup overlay
      */
-    void drawWebSetupPopupOverlay(String softAPSSID, String softAPIP, String staSSID, String staIP);
+    void drawWebSetupPopupOverlay(const String &softAPSSID, const String &softAPIP, const String &staSSID, const String &staIP);
     
     /**
      * Get display reference for direct access if needed
@@ -81,12 +86,19 @@ private:
     // Layout constants
     static const int MARGIN = 15;
     static const int SPACING = 10;
+    static const int HEADER_HEIGHT = 48;
+    static const int CLOCK_WIDTH = 112;  // Time box centred in the header, divisible by 8
+    static const int QR_VERSION = 3;  // Popup QR code, 29x29 modules
+    static const int QR_SIZE = 4 * QR_VERSION + 17;
+    
+    // Full dashboard layout - recorded once or drawn per page
+    void drawDashboard(WeatherScreenData_t& screenData, WeatherData_t& weatherData);
     
     // NEW: Ultimate Dashboard Sections
     void drawHeaderBar(int x, int y, int width, WeatherScreenData_t& screenData, CurrentWeather_t& current);
     void drawCurrentWeatherHero(int x, int y, int width, int height, CurrentWeather_t& current);
     void drawWeatherDetailsGrid(int x, int y, int width, int height, CurrentWeather_t& current, DailyForecast_t& today);
-    void drawMetricCard(int x, int y, int w, int h, String label, String value, String subtext);
+    void drawMetricCard(int x, int y, int w, int h, const char *label, const char *value, const char *subtext);
     void drawHourlyTimeline(int x, int y, int width, int height, HourlyForecast_t* hourly, int count, time_t currentTime);
     void draw7DayForecast(int x, int y, int width, int height, DailyForecast_t* daily, int count);
     void drawSunMoonInfo(int x, int y, int width, int height, DailyForecast_t& today, time_t currentTime);
@@ -99,8 +111,7 @@ private:
     void drawFooter(int x, int y, int width, DailyForecast_t& today, int uvIndex);
     
     // Helper functions
-    void drawWeatherIcon(int x, int y, int size, int weatherCode, bool isDay);
-    void drawWeatherIconInverted(int x, int y, int size, int weatherCode, bool isDay);
+    void drawWeatherIcon(int x, int y, int size, int weatherCode, bool isDay, uint16_t color = GxEPD_BLACK);
     void drawBatteryIcon(int x, int y, int level);
     void drawBatteryIconInverted(int x, int y, int level);
     void drawWiFiIcon(int x, int y, int level);
@@ -108,11 +119,11 @@ private:
     void drawHorizontalLine(int x, int y, int width);
     
     // Text helpers
-    String getWeatherDescription(int weatherCode);
-    String getWeatherDescriptionShort(int weatherCode);
-    String getWindDirection(int degrees);
+    const char *getWeatherDescription(int weatherCode);
+    const char *getWeatherDescriptionShort(int weatherCode);
+    const char *getWindDirection(int degrees);
     int estimateUVIndex(int weatherCode, bool isDay);
-    String getUVLevelText(int uvIndex);
+    const char *getUVLevelText(int uvIndex);
     
     // Get localized time period name
     const char* getTimePeriodName(int hour);
@@ -0,0 +1,7 @@
+#pragma once
+
+// Sizes the weather icons are pre-rasterized at - images/icons/convert_to_c.py
+// reads these defines, so a new icon size goes here before Screen.cpp uses it
+#define WEATHER_ICON_SIZE_CURRENT 140  // Current conditions
+#define WEATHER_ICON_SIZE_HOURLY 36    // Hourly forecast columns
+#define WEATHER_ICON_SIZE_DAILY 32     // 7-day forecast rows
@@ -152,3 +152,23 @@ void utf8tocp(char* s) {
   s[k]=0;
 }
 
+
+// Conversion into a caller-provided buffer - no heap allocation
+size_t utf8tocp(const char* s, size_t length, char* out, size_t outSize) {
+  if (outSize == 0) return 0;
+  size_t k = 0;
+  uint16_t ucs2;
+  resetUTF8decoder();
+  for (size_t i=0; i<length && k+1<outSize; i++) {
+    ucs2 = recode(s[i]);
+
+    if (0x20 <= ucs2 && ucs2 <= 0x7F)
+      out[k++] = (char) ucs2;
+    else if (0xA0 <= ucs2 && ucs2 <= 0xFF)
+      out[k++] = (char) (ucs2 - 32);
+    else if (showUnmapped && 0xFF < ucs2 && ucs2 < 0xFFFF)
+      out[k++] = (char) 0x7F;
+  }
+  out[k]=0;
+  return k;
+}
@@ -22,4 +22,8 @@ String utf8tocp(String s);
 // Be careful, the in-situ conversion will "destroy" the UTF-8 string s.
 void utf8tocp(char* s);    
 
+// Convert length bytes of UTF-8 into the caller's buffer, which always ends
+// NUL terminated. Stops when out is full; returns the converted length.
+size_t utf8tocp(const char* s, size_t length, char* out, size_t outSize);
+
 #endif
@@ -5,6 +5,7 @@
 #include "WeatherWebSetupServer.hpp"
 #include "../Storage/WeatherConfiguration.hpp"
 #include "../Logging/Logging.hpp"
+#include "../Logging/Profiler.hpp"
 #include "../Localization/Localization.hpp"
 #include "../consts.h"
 
@@ -20,6 +21,9 @@ WeatherWebSetupServer::WeatherWebSetupServer(WeatherConfiguration *configuration
     webServer.on("/style.css", std::bind(&WeatherWebSetupServer::handleCSSStyle, this));
     webServer.on("/wifi", std::bind(&WeatherWebSetupServer::handleWiFiScan, this));
     webServer.on("/config", std::bind(&WeatherWebSetupServer::handleGETConfig, this));
+#if PROFILING
+    webServer.on("/profile", std::bind(&WeatherWebSetupServer::handleGETProfile, this));
+#endif
     webServer.on("/complete-setup", HTTP_POST, std::bind(&WeatherWebSetupServer::handlePOSTSetup, this));
     webServer.on("/update-firmware", HTTP_POST, std::bind(&WeatherWebSetupServer::handlePOSTUpdateFirmware, this), std::bind(&WeatherWebSetupServer::handleUploadFirmware, this));
     webServer.onNotFound(std::bind(&WeatherWebSetupServer::handleGETSetup, this));
@@ -41,6 +45,9 @@ void WeatherWebSetupServer::handlePOSTSetup()
 {
     LOGD("Starting handlePOSTSetup with " + String(webServer.args()) + " arguments");
     
+    // Unchecked checkboxes are not submitted at all
+    configuration->clockMode = webServer.hasArg("clock_mode");
+    
     for (uint8_t i = 0; i < webServer.args(); i++)
     {
         String param_name = webServer.argName(i);
@@ -164,6 +171,13 @@ void WeatherWebSetupServer::handleCSSStyle()
     webServer.send_P(200, "text/css", (const char *)CSS_STYLE, CSS_STYLE_END - CSS_STYLE);
 }
 
+#if PROFILING
+void WeatherWebSetupServer::handleGETProfile()
+{
+    webServer.send(200, "text/plain", Profiler::report());
+}
+#endif
+
 void WeatherWebSetupServer::handleGETSetup()
 {
     LOGD("handleGETSetup called");
@@ -277,6 +291,7 @@ void WeatherWebSetupServer::handleGETConfig()
     (*doc)["latitude"] = configuration->latitude;
     (*doc)["longitude"] = configuration->longitude;
     (*doc)["refreshInterval"] = configuration->refreshIntervalMinutes;
+    (*doc)["clockMode"] = configuration->clockMode;
     (*doc)["language"] = configuration->language;
     
     String response;
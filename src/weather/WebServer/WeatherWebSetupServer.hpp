@@ -42,6 +42,9 @@ private:
     void handleCSSStyle();
     void handleWiFiScan();
     void handleGETConfig();
+#if PROFILING
+    void handleGETProfile();
+#endif
     void handlePOSTSetup();
     void handlePOSTUpdateFirmware();
     void handleUploadFirmware();
@@ -6,6 +6,10 @@
 #define DEMO 0
 #endif
 
+#ifndef PROFILING
+#define PROFILING 0
+#endif
+
 #ifndef OTA_ENABLED
 #define OTA_ENABLED 0
 #endif
@@ -16,6 +16,7 @@
 #include <esp_partition.h>
 #include "weather/consts.h"
 #include "weather/Logging/Logging.hpp"
+#include "weather/Logging/Profiler.hpp"
 
 #include "weather/UI/Screen.hpp"
 #include "weather/UI/Display102/Display102.hpp"
@@ -61,6 +62,7 @@ typedef enum {
     STATE_LOADING_DATA,
     STATE_SHOW_RESULT,
     STATE_POST_WEB_SETUP,
+    STATE_CLOCK,
     STATE_INFINITE_SLEEP,
     STATE_DEEP_SLEEP,
 #if DEMO
@@ -86,6 +88,7 @@ struct WeatherStationState_t {
 // Flags
 bool forceDrawPopup = false;
 unsigned long webSetupWaitStartTime = 0;
+time_t clockFetchTime = 0;  // Clock mode ends here and the next fetch cycle starts
 
 // ============================================================================
 // Helper Functions
@@ -267,6 +270,17 @@ void initTimeSync()
 // Deep Sleep
 // ============================================================================
 
+// Post-draw work that overlaps the panel refresh - send the logs, then turn the
+// radio off so waitRefresh() can light sleep
+void flushLogsAndStopRadio()
+{
+    if (WiFi.isConnected() && remoteLogger.hasLogsToSend()) {
+        remoteLogger.flush();
+    }
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+}
+
 void startDeepSleep(uint64_t seconds)
 {
     deepSleepCounter++;
@@ -276,9 +290,37 @@ void startDeepSleep(uint64_t seconds)
     if (seconds > 0) {
         esp_sleep_enable_timer_wakeup(seconds * 1000000ULL);
     }
+    
+    flushLogsAndStopRadio();
+    
+    // Panel may still be refreshing the last frame - let it finish and power off
+    screen.getDisplay().waitRefresh();
+#if PROFILING
+    Serial.print(Profiler::report());
+    Serial.flush();
+#endif
     esp_deep_sleep_start();
 }
 
+void lightSleepUntilNextMinute()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    uint64_t sleepUs = (60 - tv.tv_sec % 60) * 1000000ULL - tv.tv_usec;
+    
+    // Clock mode turns the radio off on entry; light sleep with it on would
+    // drop the connection and save nothing
+    if (WiFi.getMode() != WIFI_OFF) {
+        LOGD("Radio still on before light sleep, turning it off");
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
+    }
+    
+    Serial.flush();
+    esp_sleep_enable_timer_wakeup(sleepUs);
+    esp_light_sleep_start();
+}
+
 // ============================================================================
 // Data Fetching
 // ============================================================================
@@ -470,6 +512,16 @@ void onEntering(state_t newState)
         initTimeSync();
         break;
         
+    case STATE_CLOCK:
+        // Cold boot and setup paths get here with the radio still on. The
+        // dashboard refresh is still running - wait for it (light sleeping on
+        // BUSY) so the panel powers off instead of idling until the next minute.
+        flushLogsAndStopRadio();
+        screen.getDisplay().waitRefresh();
+        clockFetchTime = time(NULL) + currentState.nextUpdatePeriodSec;
+        LOGD("Clock mode until next fetch in " + String(currentState.nextUpdatePeriodSec) + "s");
+        break;
+        
     case STATE_POST_WEB_SETUP:
         startCaptivePortal();
         startWebServer();
@@ -682,13 +734,9 @@ void updateState()
             
             currentState.nextUpdatePeriodSec = computeNextUpdatePeriod();
             
-            // Flush remote logs before disconnecting WiFi
-            if (remoteLogger.hasLogsToSend()) {
-                remoteLogger.flush();
-            }
-            
-            // Disconnect WiFi to free memory before drawing
-            if (isDeepSleepWakeup()) {
+            // Disconnect WiFi to free memory before drawing. Pending remote
+            // logs keep it on - they are sent while the panel refreshes.
+            if (isDeepSleepWakeup() && !remoteLogger.hasLogsToSend()) {
                 LOGD("Disconnecting WiFi to free memory");
                 WiFi.disconnect();
                 WiFi.mode(WIFI_OFF);
@@ -715,11 +763,26 @@ void updateState()
         // Show post web setup popup on power-on reset
         if (isPowerOnReset()) {
             moveToState(STATE_POST_WEB_SETUP);
+        } else if (configuration.clockMode) {
+            moveToState(STATE_CLOCK);
         } else {
             moveToState(STATE_DEEP_SLEEP);
         }
         break;
         
+    case STATE_CLOCK: {
+        // Radio stays off - light sleep to each minute and repaint only the time
+        time_t now = time(NULL);
+        int untilFetch = (int)(clockFetchTime - now);
+        if (untilFetch <= 60 - now % 60) {
+            currentState.nextUpdatePeriodSec = max(untilFetch, 1);
+            moveToState(STATE_DEEP_SLEEP);
+        } else {
+            lightSleepUntilNextMinute();
+            screen.drawClock(time(NULL));
+        }
+    } break;
+        
     case STATE_POST_WEB_SETUP:
         if (webServer->isSetupCompleted()) {
             configuration.load();
@@ -799,6 +862,11 @@ void setup()
     }
     
     initTimeSync();
+    
+    // Full-screen refreshes run in the background; the next draw or deep sleep waits for them
+    screen.getDisplay().setAsyncRefresh(true);
+    // Redraw only what changed since the last wake, with a periodic full refresh
+    screen.getDisplay().setDifferentialRefresh(true);
 }
 
 void loop()